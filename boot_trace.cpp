@@ -0,0 +1,57 @@
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+
+#include "boot_trace.hpp"
+
+#define BOOT_TRACE_CAPACITY 16 ///< Maximum number of recorded phases
+
+struct BootTraceEntry
+{
+    const char *phase;
+    uint64_t time_us;
+    std::atomic<bool> valid;
+};
+
+static BootTraceEntry entries[BOOT_TRACE_CAPACITY];
+static std::atomic<uint32_t> entry_count{0};
+
+void boot_trace(const char *phase)
+{
+    uint64_t now = time_us_64();
+    uint32_t i = entry_count.fetch_add(1, std::memory_order_relaxed);
+    if (i >= BOOT_TRACE_CAPACITY)
+    {
+        return;
+    }
+    entries[i].phase = phase;
+    entries[i].time_us = now;
+    entries[i].valid.store(true, std::memory_order_release);
+}
+
+void boot_trace_print()
+{
+    uint64_t previous = 0;
+    for (uint32_t i = 0; i < BOOT_TRACE_CAPACITY; i++)
+    {
+        if (!entries[i].valid.load(std::memory_order_acquire))
+        {
+            continue;
+        }
+        printf("boot %10llu us (+%8llu us) %s\n", (unsigned long long)entries[i].time_us,
+               (unsigned long long)(entries[i].time_us - previous), entries[i].phase);
+        previous = entries[i].time_us;
+    }
+}
+
+uint64_t boot_trace_time_us(const char *phase)
+{
+    for (uint32_t i = 0; i < BOOT_TRACE_CAPACITY; i++)
+    {
+        if (entries[i].valid.load(std::memory_order_acquire) && strcmp(entries[i].phase, phase) == 0)
+        {
+            return entries[i].time_us;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "pico/stdlib.h"
+
+/**
+ * @brief Records a boot phase with the current time.
+ *
+ * Lock-free and callable from both cores. Phases beyond the capacity of the trace are dropped.
+ *
+ * @param phase Name of the phase which has just completed (string literal).
+ */
+void boot_trace(const char *phase);
+
+/**
+ * @brief Prints all recorded boot phases with their timestamps since power-up.
+ */
+void boot_trace_print();
+
+/**
+ * @brief Returns the time in microseconds at which a phase was recorded.
+ *
+ * @param phase Name of the phase, compared by content.
+ * @return Timestamp in microseconds since boot, or 0 if the phase has not been recorded.
+ */
+uint64_t boot_trace_time_us(const char *phase);
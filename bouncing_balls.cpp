@@ -1,7 +1,7 @@
 // Example derived from https://github.com/pimoroni/pimoroni-pico/blob/main/examples/interstate75/interstate75_balls_demo.cpp
 
 #include "bouncing_balls.hpp"
-#include <random>
+#include "scene_random.hpp"
 
 #include "lvgl.h"
 
@@ -60,22 +60,17 @@ void BouncingBalls::bounce()
 
 void BouncingBalls::mCreateShapes(int quantityOfBalls)
 {
-    static std::random_device rd;
-    static std::mt19937 gen(rd());
-    static std::uniform_int_distribution<int> rand_x(0, width - 1);
-    static std::uniform_int_distribution<int> rand_y(0, height - 1);
-    static std::uniform_int_distribution<int> rand_r(2, 6);
-    static std::uniform_real_distribution<float> rand_speed(-2.0f, 2.0f);
-    static std::uniform_int_distribution<uint8_t> rand_color(0, 255);
+    // Speeds in [-2, 2), from the upper 24 bits
+    auto random_speed = []() { return (scene_random() >> 8) * (4.0f / 16777216.0f) - 2.0f; };
 
     for (uint8_t i = 0; i < quantityOfBalls; i++)
     {
-        mShapes.emplace_back(mPoint{
-            static_cast<float>(rand_x(gen)),
-            static_cast<float>(rand_y(gen)),
-            static_cast<float>(rand_r(gen)),
-            rand_speed(gen),
-            rand_speed(gen),
-            lv_color_make(rand_color(gen), rand_color(gen), rand_color(gen))});
+        float x = static_cast<float>(scene_random_below(width));
+        float y = static_cast<float>(scene_random_below(height));
+        float r = static_cast<float>(2 + scene_random_below(5));
+        float dx = random_speed();
+        float dy = random_speed();
+        uint32_t colour = scene_random();
+        mShapes.emplace_back(mPoint{x, y, r, dx, dy, lv_color_make(colour & 0xFF, (colour >> 8) & 0xFF, (colour >> 16) & 0xFF)});
     }
 }
@@ -9,11 +9,14 @@
 #include "lvgl/src/misc/lv_color.h"
 #include "lvgl/src/widgets/canvas/lv_canvas.h"
 #include "lvgl/src/draw/lv_draw_rect.h"
-#include "lvgl/src/widgets/label/lv_label.h"
+#include "lvgl/src/font/lv_font.h"
+
+#include "scene.hpp"
+#include "text_strip.hpp"
 
 #define BYTES_PER_PIXEL (LV_COLOR_FORMAT_GET_SIZE(LV_COLOR_FORMAT_RGB888))
 
-class BouncingBalls
+class BouncingBalls : public Scene
 {
 private:
     struct mPoint
@@ -26,6 +29,7 @@ private:
         lv_color_t pen;
     };
 
+    uint quantityOfBalls;
     uint width, height;
 
     std::vector<mPoint> mShapes;
@@ -33,81 +37,92 @@ private:
     void mCreateShapes(int quantityOfBalls);
 
     lv_obj_t *canvas;
-    lv_draw_buf_t *draw_buf;
+    lv_draw_buf_t draw_buf;
     lv_layer_t layer;
     uint8_t *data_buf;
-    lv_obj_t *screen;
     lv_draw_rect_dsc_t circle_dsc;
-    lv_style_t label_style;
-    lv_style_t style_shadow;
-    lv_style_t scrolling_label_style;
+    TextStrip title;  ///< Static two-line label, shown twice for the text and its shadow
+    TextStrip ticker; ///< Circularly scrolling label
 
 public:
-    explicit BouncingBalls(uint quantityOfBalls = 10, uint width = 64, uint height = 64) : width(width), height(height)
+    explicit BouncingBalls(uint quantityOfBalls = 10, uint width = 64, uint height = 64) : quantityOfBalls(quantityOfBalls), width(width), height(height)
+    {
+    }
+
+    const char *name() const override
+    {
+        return "balls";
+    }
+
+    bool create(SceneArena::Region &memory) override
     {
         mShapes.reserve(quantityOfBalls);
 
-        data_buf = new uint8_t[width * height * BYTES_PER_PIXEL]();
+        data_buf = memory.allocate<uint8_t>(width * height * BYTES_PER_PIXEL);
         if (data_buf == nullptr)
         {
             printf("Failed to allocate data_buf\n");
-            return;
+            return false;
         }
 
-        /*Create a buffer for the canvas*/
-        draw_buf = lv_draw_buf_create(width, height, LV_COLOR_FORMAT_RGB888, LV_STRIDE_AUTO);
-        lv_result_t res = lv_draw_buf_init(draw_buf, width, height, LV_COLOR_FORMAT_RGB888, LV_STRIDE_AUTO, data_buf, width * height * BYTES_PER_PIXEL);
+        /*Initialise the canvas buffer descriptor with the arena memory*/
+        lv_result_t res = lv_draw_buf_init(&draw_buf, width, height, LV_COLOR_FORMAT_RGB888, LV_STRIDE_AUTO, data_buf, width * height * BYTES_PER_PIXEL);
         if (res != LV_RESULT_OK)
         {
             printf("lv_draw_buf_init failed %d\n", res);
+            return false;
         }
 
         screen = lv_obj_create(NULL);
 
         canvas = lv_canvas_create(screen);
-        lv_canvas_set_buffer(canvas, data_buf, width, height, LV_COLOR_FORMAT_RGB888);
-        lv_canvas_set_draw_buf(canvas, draw_buf);
+        lv_canvas_set_draw_buf(canvas, &draw_buf);
         lv_obj_center(canvas);
         lv_canvas_fill_bg(canvas, lv_color_make(200, 120, 70), LV_OPA_COVER);
 
         mCreateShapes(quantityOfBalls);
 
-        lv_style_init(&label_style);
-        lv_style_set_text_color(&label_style, lv_color_make(250, 250, 250));
-        lv_obj_t *label1 = lv_label_create(screen);
-        lv_label_set_text(label1, "Hello\nworld\xEF\x80\x8C");
-        lv_obj_align(label1, LV_ALIGN_TOP_MID, 0, 0);
-        lv_obj_add_style(label1, &label_style, LV_STATE_DEFAULT);
-
-        /*Create a style for the shadow*/
-        lv_style_init(&style_shadow);
-        lv_style_set_text_opa(&style_shadow, LV_OPA_30);
-        lv_style_set_text_color(&style_shadow, lv_color_black());
-
-        /*Create a label for the shadow first (it's in the background)*/
-        lv_obj_t *shadow_label = lv_label_create(screen);
-        lv_obj_add_style(shadow_label, &style_shadow, 0);
+        /*The labels never change their text, so they are rasterised once instead of on every frame*/
+        const lv_font_t *font = lv_font_get_default();
+        if (!title.render("Hello\nworld\xEF\x80\x8C", font, memory) ||
+            !ticker.render("This is a circulating scrolling text. ", font, memory, TEXT_STRIP_TICKER_GAP))
+        {
+            printf("Failed to allocate the text strips\n");
+            return false;
+        }
 
-        lv_label_set_text(shadow_label, lv_label_get_text(label1));
+        lv_obj_t *label1 = title.create_label(screen, lv_color_make(250, 250, 250));
+        lv_obj_align(label1, LV_ALIGN_TOP_MID, 0, 0);
 
-        /*Shift the second label down and to the right by 2 pixel*/
+        /*The shadow shows the same strip, shifted down and to the right by 1 pixel*/
+        lv_obj_t *shadow_label = title.create_label(screen, lv_color_black(), LV_OPA_30);
         lv_obj_align_to(shadow_label, label1, LV_ALIGN_TOP_LEFT, 1, 1);
 
-        lv_style_init(&scrolling_label_style);
-        lv_style_set_text_color(&scrolling_label_style, lv_color_make(200, 100, 120));
-        lv_obj_t *label2 = lv_label_create(screen);
-        lv_label_set_long_mode(label2, LV_LABEL_LONG_MODE_SCROLL_CIRCULAR); /*Circular scroll*/
-        lv_obj_set_width(label2, 64);
-
-        lv_label_set_text(label2, "This is a circulating scrolling text. ");
+        lv_obj_t *label2 = ticker.create_ticker(screen, 64, lv_color_make(200, 100, 120), 40); /*Circular scroll at the label's default speed*/
         lv_obj_align(label2, LV_ALIGN_CENTER, 0, 20);
-        lv_obj_add_style(label2, &scrolling_label_style, LV_STATE_DEFAULT);
+
+        return true;
     }
 
     void bounce();
 
-    void show()
+    void update() override
+    {
+        bounce();
+    }
+
+    void show() override
     {
         lv_screen_load_anim(screen, LV_SCR_LOAD_ANIM_FADE_IN, 2000, 0, false);
     }
+
+    void destroy() override
+    {
+        Scene::destroy();
+        title.release();
+        ticker.release();
+        mShapes.clear();
+        mShapes.shrink_to_fit();
+        data_buf = nullptr;
+    }
 };
\ No newline at end of file
@@ -0,0 +1,1556 @@
+// Generated by tools/hub75_clip.py - 64x64, 50 frames, 24772 bytes
+#pragma once
+
+#include <cstdint>
+
+static const uint8_t clip_64x64[24772] __attribute__((aligned(4))) = {
+    0x48, 0x37, 0x35, 0x41, 0x40, 0x00, 0x40, 0x00, 0x32, 0x00, 0x28, 0x00, 0xd4, 0x00, 0x00, 0x00,
+    0x28, 0x2e, 0x00, 0x00, 0x38, 0x2f, 0x00, 0x00, 0x57, 0x30, 0x00, 0x00, 0x81, 0x31, 0x00, 0x00,
+    0x15, 0x32, 0x00, 0x00, 0x4c, 0x33, 0x00, 0x00, 0xdd, 0x33, 0x00, 0x00, 0x76, 0x34, 0x00, 0x00,
+    0x48, 0x36, 0x00, 0x00, 0xed, 0x36, 0x00, 0x00, 0xa8, 0x38, 0x00, 0x00, 0x4f, 0x3a, 0x00, 0x00,
+    0xe7, 0x3a, 0x00, 0x00, 0x64, 0x3c, 0x00, 0x00, 0xd7, 0x3d, 0x00, 0x00, 0x2c, 0x3f, 0x00, 0x00,
+    0x71, 0x40, 0x00, 0x00, 0xf7, 0x40, 0x00, 0x00, 0x32, 0x42, 0x00, 0x00, 0xc0, 0x42, 0x00, 0x00,
+    0x4f, 0x43, 0x00, 0x00, 0x3d, 0x44, 0x00, 0x00, 0xd0, 0x44, 0x00, 0x00, 0xda, 0x45, 0x00, 0x00,
+    0xe0, 0x46, 0x00, 0x00, 0xf8, 0x47, 0x00, 0x00, 0x07, 0x49, 0x00, 0x00, 0x26, 0x4a, 0x00, 0x00,
+    0x50, 0x4b, 0x00, 0x00, 0xe4, 0x4b, 0x00, 0x00, 0x1b, 0x4d, 0x00, 0x00, 0xac, 0x4d, 0x00, 0x00,
+    0x45, 0x4e, 0x00, 0x00, 0x17, 0x50, 0x00, 0x00, 0xbc, 0x50, 0x00, 0x00, 0x78, 0x52, 0x00, 0x00,
+    0x1f, 0x54, 0x00, 0x00, 0xb7, 0x54, 0x00, 0x00, 0x3c, 0x56, 0x00, 0x00, 0xaf, 0x57, 0x00, 0x00,
+    0x04, 0x59, 0x00, 0x00, 0x49, 0x5a, 0x00, 0x00, 0xcf, 0x5a, 0x00, 0x00, 0x0a, 0x5c, 0x00, 0x00,
+    0x98, 0x5c, 0x00, 0x00, 0x27, 0x5d, 0x00, 0x00, 0x1d, 0x5e, 0x00, 0x00, 0xb0, 0x5e, 0x00, 0x00,
+    0xba, 0x5f, 0x00, 0x00, 0xbf, 0x14, 0x00, 0x0a, 0x14, 0x00, 0x0a, 0x15, 0x00, 0x0a, 0x15, 0x00,
+    0x0a, 0x16, 0x00, 0x0a, 0x17, 0x00, 0x0a, 0x17, 0x00, 0x0a, 0x18, 0x00, 0x0a, 0x19, 0x00, 0x0a,
+    0x19, 0x00, 0x0a, 0x1a, 0x00, 0x0a, 0x1a, 0x00, 0x0a, 0x1b, 0x00, 0x0a, 0x1c, 0x00, 0x0a, 0x1c,
+    0x00, 0x0a, 0x1d, 0x00, 0x0a, 0x1e, 0x00, 0x0a, 0x1e, 0x00, 0x0a, 0x1f, 0x00, 0x0a, 0x1f, 0x00,
+    0x0a, 0x20, 0x00, 0x0a, 0x21, 0x00, 0x0a, 0x21, 0x00, 0x0a, 0x22, 0x00, 0x0a, 0x23, 0x00, 0x0a,
+    0x23, 0x00, 0x0a, 0x24, 0x00, 0x0a, 0x24, 0x00, 0x0a, 0x25, 0x00, 0x0a, 0x26, 0x00, 0x0a, 0x26,
+    0x00, 0x0a, 0x27, 0x00, 0x0a, 0x28, 0x00, 0x0a, 0x28, 0x00, 0x0a, 0x29, 0x00, 0x0a, 0x29, 0x00,
+    0x0a, 0x2a, 0x00, 0x0a, 0x2b, 0x00, 0x0a, 0x2b, 0x00, 0x0a, 0x2c, 0x00, 0x0a, 0x2d, 0x00, 0x0a,
+    0x2d, 0x00, 0x0a, 0x2e, 0x00, 0x0a, 0x2e, 0x00, 0x0a, 0x2f, 0x00, 0x0a, 0x30, 0x00, 0x0a, 0x30,
+    0x00, 0x0a, 0x31, 0x00, 0x0a, 0x32, 0x00, 0x0a, 0x32, 0x00, 0x0a, 0x33, 0x00, 0x0a, 0x33, 0x00,
+    0x0a, 0x34, 0x00, 0x0a, 0x35, 0x00, 0x0a, 0x35, 0x00, 0x0a, 0x36, 0x00, 0x0a, 0x37, 0x00, 0x0a,
+    0x37, 0x00, 0x0a, 0x38, 0x00, 0x0a, 0x38, 0x00, 0x0a, 0x39, 0x00, 0x0a, 0x3a, 0x00, 0x0a, 0x3a,
+    0x00, 0x0a, 0x3b, 0x00, 0x0a, 0xbf, 0x14, 0x00, 0x0a, 0x14, 0x00, 0x0a, 0x15, 0x00, 0x0a, 0x15,
+    0x00, 0x0a, 0x16, 0x00, 0x0a, 0x17, 0x00, 0x0a, 0x17, 0x00, 0x0a, 0x18, 0x00, 0x0a, 0x19, 0x00,
+    0x0a, 0x19, 0x00, 0x0a, 0x1a, 0x00, 0x0a, 0x1a, 0x00, 0x0a, 0x1b, 0x00, 0x0a, 0x1c, 0x00, 0x0a,
+    0x1c, 0x00, 0x0a, 0x1d, 0x00, 0x0a, 0x1e, 0x00, 0x0a, 0x1e, 0x00, 0x0a, 0x1f, 0x00, 0x0a, 0x1f,
+    0x00, 0x0a, 0x20, 0x00, 0x0a, 0x21, 0x00, 0x0a, 0x21, 0x00, 0x0a, 0x22, 0x00, 0x0a, 0x23, 0x00,
+    0x0a, 0x23, 0x00, 0x0a, 0x24, 0x00, 0x0a, 0x24, 0x00, 0x0a, 0x25, 0x00, 0x0a, 0x26, 0x00, 0x0a,
+    0x26, 0x00, 0x0a, 0x27, 0x00, 0x0a, 0x28, 0x00, 0x0a, 0x28, 0x00, 0x0a, 0x29, 0x00, 0x0a, 0x29,
+    0x00, 0x0a, 0x2a, 0x00, 0x0a, 0x2b, 0x00, 0x0a, 0x2b, 0x00, 0x0a, 0x2c, 0x00, 0x0a, 0x2d, 0x00,
+    0x0a, 0x2d, 0x00, 0x0a, 0x2e, 0x00, 0x0a, 0x2e, 0x00, 0x0a, 0x2f, 0x00, 0x0a, 0x30, 0x00, 0x0a,
+    0x30, 0x00, 0x0a, 0x31, 0x00, 0x0a, 0x32, 0x00, 0x0a, 0x32, 0x00, 0x0a, 0x33, 0x00, 0x0a, 0x33,
+    0x00, 0x0a, 0x34, 0x00, 0x0a, 0x35, 0x00, 0x0a, 0x35, 0x00, 0x0a, 0x36, 0x00, 0x0a, 0x37, 0x00,
+    0x0a, 0x37, 0x00, 0x0a, 0x38, 0x00, 0x0a, 0x38, 0x00, 0x0a, 0x39, 0x00, 0x0a, 0x3a, 0x00, 0x0a,
+    0x3a, 0x00, 0x0a, 0x3b, 0x00, 0x0a, 0xbf, 0x14, 0x00, 0x0a, 0x14, 0x00, 0x0a, 0x15, 0x00, 0x0a,
+    0x15, 0x00, 0x0a, 0x16, 0x00, 0x0a, 0x17, 0x00, 0x0a, 0x17, 0x00, 0x0a, 0x18, 0x00, 0x0a, 0x19,
+    0x00, 0x0a, 0x19, 0x00, 0x0a, 0x1a, 0x00, 0x0a, 0x1a, 0x00, 0x0a, 0x1b, 0x00, 0x0a, 0x1c, 0x00,
+    0x0a, 0x1c, 0x00, 0x0a, 0x1d, 0x00, 0x0a, 0x1e, 0x00, 0x0a, 0x1e, 0x00, 0x0a, 0x1f, 0x00, 0x0a,
+    0x1f, 0x00, 0x0a, 0x20, 0x00, 0x0a, 0x21, 0x00, 0x0a, 0x21, 0x00, 0x0a, 0x22, 0x00, 0x0a, 0x23,
+    0x00, 0x0a, 0x23, 0x00, 0x0a, 0x24, 0x00, 0x0a, 0x24, 0x00, 0x0a, 0x25, 0x00, 0x0a, 0x26, 0x00,
+    0x0a, 0x26, 0x00, 0x0a, 0x27, 0x00, 0x0a, 0x28, 0x00, 0x0a, 0x28, 0x00, 0x0a, 0x29, 0x00, 0x0a,
+    0x29, 0x00, 0x0a, 0x2a, 0x00, 0x0a, 0x2b, 0x00, 0x0a, 0x2b, 0x00, 0x0a, 0x2c, 0x00, 0x0a, 0x2d,
+    0x00, 0x0a, 0x2d, 0x00, 0x0a, 0x2e, 0x00, 0x0a, 0x2e, 0x00, 0x0a, 0x2f, 0x00, 0x0a, 0x30, 0x00,
+    0x0a, 0x30, 0x00, 0x0a, 0x31, 0x00, 0x0a, 0x32, 0x00, 0x0a, 0x32, 0x00, 0x0a, 0x33, 0x00, 0x0a,
+    0x33, 0x00, 0x0a, 0x34, 0x00, 0x0a, 0x35, 0x00, 0x0a, 0x35, 0x00, 0x0a, 0x36, 0x00, 0x0a, 0x37,
+    0x00, 0x0a, 0x37, 0x00, 0x0a, 0x38, 0x00, 0x0a, 0x38, 0x00, 0x0a, 0x39, 0x00, 0x0a, 0x3a, 0x00,
+    0x0a, 0x3a, 0x00, 0x0a, 0x3b, 0x00, 0x0a, 0xbf, 0x14, 0x00, 0x0b, 0x14, 0x00, 0x0b, 0x15, 0x00,
+    0x0b, 0x15, 0x00, 0x0b, 0x16, 0x00, 0x0b, 0x17, 0x00, 0x0b, 0x17, 0x00, 0x0b, 0x18, 0x00, 0x0b,
+    0x19, 0x00, 0x0b, 0x19, 0x00, 0x0b, 0x1a, 0x00, 0x0b, 0x1a, 0x00, 0x0b, 0x1b, 0x00, 0x0b, 0x1c,
+    0x00, 0x0b, 0x1c, 0x00, 0x0b, 0x1d, 0x00, 0x0b, 0x1e, 0x00, 0x0b, 0x1e, 0x00, 0x0b, 0x1f, 0x00,
+    0x0b, 0x1f, 0x00, 0x0b, 0x20, 0x00, 0x0b, 0x21, 0x00, 0x0b, 0x21, 0x00, 0x0b, 0x22, 0x00, 0x0b,
+    0x23, 0x00, 0x0b, 0x23, 0x00, 0x0b, 0x24, 0x00, 0x0b, 0x24, 0x00, 0x0b, 0x25, 0x00, 0x0b, 0x26,
+    0x00, 0x0b, 0x26, 0x00, 0x0b, 0x27, 0x00, 0x0b, 0x28, 0x00, 0x0b, 0x28, 0x00, 0x0b, 0x29, 0x00,
+    0x0b, 0x29, 0x00, 0x0b, 0x2a, 0x00, 0x0b, 0x2b, 0x00, 0x0b, 0x2b, 0x00, 0x0b, 0x2c, 0x00, 0x0b,
+    0x2d, 0x00, 0x0b, 0x2d, 0x00, 0x0b, 0x2e, 0x00, 0x0b, 0x2e, 0x00, 0x0b, 0x2f, 0x00, 0x0b, 0x30,
+    0x00, 0x0b, 0x30, 0x00, 0x0b, 0x31, 0x00, 0x0b, 0x32, 0x00, 0x0b, 0x32, 0x00, 0x0b, 0x33, 0x00,
+    0x0b, 0x33, 0x00, 0x0b, 0x34, 0x00, 0x0b, 0x35, 0x00, 0x0b, 0x35, 0x00, 0x0b, 0x36, 0x00, 0x0b,
+    0x37, 0x00, 0x0b, 0x37, 0x00, 0x0b, 0x38, 0x00, 0x0b, 0x38, 0x00, 0x0b, 0x39, 0x00, 0x0b, 0x3a,
+    0x00, 0x0b, 0x3a, 0x00, 0x0b, 0x3b, 0x00, 0x0b, 0xbf, 0x14, 0x00, 0x0b, 0x14, 0x00, 0x0b, 0x15,
+    0x00, 0x0b, 0x15, 0x00, 0x0b, 0x16, 0x00, 0x0b, 0x17, 0x00, 0x0b, 0x17, 0x00, 0x0b, 0x18, 0x00,
+    0x0b, 0x19, 0x00, 0x0b, 0x19, 0x00, 0x0b, 0x1a, 0x00, 0x0b, 0x1a, 0x00, 0x0b, 0x1b, 0x00, 0x0b,
+    0x1c, 0x00, 0x0b, 0x1c, 0x00, 0x0b, 0x1d, 0x00, 0x0b, 0x1e, 0x00, 0x0b, 0x1e, 0x00, 0x0b, 0x1f,
+    0x00, 0x0b, 0x1f, 0x00, 0x0b, 0x20, 0x00, 0x0b, 0x21, 0x00, 0x0b, 0x21, 0x00, 0x0b, 0x22, 0x00,
+    0x0b, 0x23, 0x00, 0x0b, 0x23, 0x00, 0x0b, 0x24, 0x00, 0x0b, 0x24, 0x00, 0x0b, 0x25, 0x00, 0x0b,
+    0x26, 0x00, 0x0b, 0x26, 0x00, 0x0b, 0x27, 0x00, 0x0b, 0x28, 0x00, 0x0b, 0x28, 0x00, 0x0b, 0x29,
+    0x00, 0x0b, 0x29, 0x00, 0x0b, 0x2a, 0x00, 0x0b, 0x2b, 0x00, 0x0b, 0x2b, 0x00, 0x0b, 0x2c, 0x00,
+    0x0b, 0x2d, 0x00, 0x0b, 0x2d, 0x00, 0x0b, 0x2e, 0x00, 0x0b, 0x2e, 0x00, 0x0b, 0x2f, 0x00, 0x0b,
+    0x30, 0x00, 0x0b, 0x30, 0x00, 0x0b, 0x31, 0x00, 0x0b, 0x32, 0x00, 0x0b, 0x32, 0x00, 0x0b, 0x33,
+    0x00, 0x0b, 0x33, 0x00, 0x0b, 0x34, 0x00, 0x0b, 0x35, 0x00, 0x0b, 0x35, 0x00, 0x0b, 0x36, 0x00,
+    0x0b, 0x37, 0x00, 0x0b, 0x37, 0x00, 0x0b, 0x38, 0x00, 0x0b, 0x38, 0x00, 0x0b, 0x39, 0x00, 0x0b,
+    0x3a, 0x00, 0x0b, 0x3a, 0x00, 0x0b, 0x3b, 0x00, 0x0b, 0xbf, 0x14, 0x00, 0x0c, 0x14, 0x00, 0x0c,
+    0x15, 0x00, 0x0c, 0x15, 0x00, 0x0c, 0x16, 0x00, 0x0c, 0x17, 0x00, 0x0c, 0x17, 0x00, 0x0c, 0x18,
+    0x00, 0x0c, 0x19, 0x00, 0x0c, 0x19, 0x00, 0x0c, 0x1a, 0x00, 0x0c, 0x1a, 0x00, 0x0c, 0x1b, 0x00,
+    0x0c, 0x1c, 0x00, 0x0c, 0x1c, 0x00, 0x0c, 0x1d, 0x00, 0x0c, 0x1e, 0x00, 0x0c, 0x1e, 0x00, 0x0c,
+    0x1f, 0x00, 0x0c, 0x1f, 0x00, 0x0c, 0x20, 0x00, 0x0c, 0x21, 0x00, 0x0c, 0x21, 0x00, 0x0c, 0x22,
+    0x00, 0x0c, 0x23, 0x00, 0x0c, 0x23, 0x00, 0x0c, 0x24, 0x00, 0x0c, 0x24, 0x00, 0x0c, 0x25, 0x00,
+    0x0c, 0x26, 0x00, 0x0c, 0x26, 0x00, 0x0c, 0x27, 0x00, 0x0c, 0x28, 0x00, 0x0c, 0x28, 0x00, 0x0c,
+    0x29, 0x00, 0x0c, 0x29, 0x00, 0x0c, 0x2a, 0x00, 0x0c, 0x2b, 0x00, 0x0c, 0x2b, 0x00, 0x0c, 0x2c,
+    0x00, 0x0c, 0x2d, 0x00, 0x0c, 0x2d, 0x00, 0x0c, 0x2e, 0x00, 0x0c, 0x2e, 0x00, 0x0c, 0x2f, 0x00,
+    0x0c, 0x30, 0x00, 0x0c, 0x30, 0x00, 0x0c, 0x31, 0x00, 0x0c, 0x32, 0x00, 0x0c, 0x32, 0x00, 0x0c,
+    0x33, 0x00, 0x0c, 0x33, 0x00, 0x0c, 0x34, 0x00, 0x0c, 0x35, 0x00, 0x0c, 0x35, 0x00, 0x0c, 0x36,
+    0x00, 0x0c, 0x37, 0x00, 0x0c, 0x37, 0x00, 0x0c, 0x38, 0x00, 0x0c, 0x38, 0x00, 0x0c, 0x39, 0x00,
+    0x0c, 0x3a, 0x00, 0x0c, 0x3a, 0x00, 0x0c, 0x3b, 0x00, 0x0c, 0xbf, 0x14, 0x00, 0x0c, 0x14, 0x00,
+    0x0c, 0x15, 0x00, 0x0c, 0x15, 0x00, 0x0c, 0x16, 0x00, 0x0c, 0x17, 0x00, 0x0c, 0x17, 0x00, 0x0c,
+    0x18, 0x00, 0x0c, 0x19, 0x00, 0x0c, 0x19, 0x00, 0x0c, 0x1a, 0x00, 0x0c, 0x1a, 0x00, 0x0c, 0x1b,
+    0x00, 0x0c, 0x1c, 0x00, 0x0c, 0x1c, 0x00, 0x0c, 0x1d, 0x00, 0x0c, 0x1e, 0x00, 0x0c, 0x1e, 0x00,
+    0x0c, 0x1f, 0x00, 0x0c, 0x1f, 0x00, 0x0c, 0x20, 0x00, 0x0c, 0x21, 0x00, 0x0c, 0x21, 0x00, 0x0c,
+    0x22, 0x00, 0x0c, 0x23, 0x00, 0x0c, 0x23, 0x00, 0x0c, 0x24, 0x00, 0x0c, 0x24, 0x00, 0x0c, 0x25,
+    0x00, 0x0c, 0x26, 0x00, 0x0c, 0x26, 0x00, 0x0c, 0x27, 0x00, 0x0c, 0x28, 0x00, 0x0c, 0x28, 0x00,
+    0x0c, 0x29, 0x00, 0x0c, 0x29, 0x00, 0x0c, 0x2a, 0x00, 0x0c, 0x2b, 0x00, 0x0c, 0x2b, 0x00, 0x0c,
+    0x2c, 0x00, 0x0c, 0x2d, 0x00, 0x0c, 0x2d, 0x00, 0x0c, 0x2e, 0x00, 0x0c, 0x2e, 0x00, 0x0c, 0x2f,
+    0x00, 0x0c, 0x30, 0x00, 0x0c, 0x30, 0x00, 0x0c, 0x31, 0x00, 0x0c, 0x32, 0x00, 0x0c, 0x32, 0x00,
+    0x0c, 0x33, 0x00, 0x0c, 0x33, 0x00, 0x0c, 0x34, 0x00, 0x0c, 0x35, 0x00, 0x0c, 0x35, 0x00, 0x0c,
+    0x36, 0x00, 0x0c, 0x37, 0x00, 0x0c, 0x37, 0x00, 0x0c, 0x38, 0x00, 0x0c, 0x38, 0x00, 0x0c, 0x39,
+    0x00, 0x0c, 0x3a, 0x00, 0x0c, 0x3a, 0x00, 0x0c, 0x3b, 0x00, 0x0c, 0xbf, 0x14, 0x00, 0x0d, 0x14,
+    0x00, 0x0d, 0x15, 0x00, 0x0d, 0x15, 0x00, 0x0d, 0x16, 0x00, 0x0d, 0x17, 0x00, 0x0d, 0x17, 0x00,
+    0x0d, 0x18, 0x00, 0x0d, 0x19, 0x00, 0x0d, 0x19, 0x00, 0x0d, 0x1a, 0x00, 0x0d, 0x1a, 0x00, 0x0d,
+    0x1b, 0x00, 0x0d, 0x1c, 0x00, 0x0d, 0x1c, 0x00, 0x0d, 0x1d, 0x00, 0x0d, 0x1e, 0x00, 0x0d, 0x1e,
+    0x00, 0x0d, 0x1f, 0x00, 0x0d, 0x1f, 0x00, 0x0d, 0x20, 0x00, 0x0d, 0x21, 0x00, 0x0d, 0x21, 0x00,
+    0x0d, 0x22, 0x00, 0x0d, 0x23, 0x00, 0x0d, 0x23, 0x00, 0x0d, 0x24, 0x00, 0x0d, 0x24, 0x00, 0x0d,
+    0x25, 0x00, 0x0d, 0x26, 0x00, 0x0d, 0x26, 0x00, 0x0d, 0x27, 0x00, 0x0d, 0x28, 0x00, 0x0d, 0x28,
+    0x00, 0x0d, 0x29, 0x00, 0x0d, 0x29, 0x00, 0x0d, 0x2a, 0x00, 0x0d, 0x2b, 0x00, 0x0d, 0x2b, 0x00,
+    0x0d, 0x2c, 0x00, 0x0d, 0x2d, 0x00, 0x0d, 0x2d, 0x00, 0x0d, 0x2e, 0x00, 0x0d, 0x2e, 0x00, 0x0d,
+    0x2f, 0x00, 0x0d, 0x30, 0x00, 0x0d, 0x30, 0x00, 0x0d, 0x31, 0x00, 0x0d, 0x32, 0x00, 0x0d, 0x32,
+    0x00, 0x0d, 0x33, 0x00, 0x0d, 0x33, 0x00, 0x0d, 0x34, 0x00, 0x0d, 0x35, 0x00, 0x0d, 0x35, 0x00,
+    0x0d, 0x36, 0x00, 0x0d, 0x37, 0x00, 0x0d, 0x37, 0x00, 0x0d, 0x38, 0x00, 0x0d, 0x38, 0x00, 0x0d,
+    0x39, 0x00, 0x0d, 0x3a, 0x00, 0x0d, 0x3a, 0x00, 0x0d, 0x3b, 0x00, 0x0d, 0xbf, 0x14, 0x00, 0x0d,
+    0x14, 0x00, 0x0d, 0x15, 0x00, 0x0d, 0x15, 0x00, 0x0d, 0x16, 0x00, 0x0d, 0x17, 0x00, 0x0d, 0x17,
+    0x00, 0x0d, 0x18, 0x00, 0x0d, 0x19, 0x00, 0x0d, 0x19, 0x00, 0x0d, 0x1a, 0x00, 0x0d, 0x1a, 0x00,
+    0x0d, 0x1b, 0x00, 0x0d, 0x1c, 0x00, 0x0d, 0x1c, 0x00, 0x0d, 0x1d, 0x00, 0x0d, 0x1e, 0x00, 0x0d,
+    0x1e, 0x00, 0x0d, 0x1f, 0x00, 0x0d, 0x1f, 0x00, 0x0d, 0x20, 0x00, 0x0d, 0x21, 0x00, 0x0d, 0x21,
+    0x00, 0x0d, 0x22, 0x00, 0x0d, 0x23, 0x00, 0x0d, 0x23, 0x00, 0x0d, 0x24, 0x00, 0x0d, 0x24, 0x00,
+    0x0d, 0x25, 0x00, 0x0d, 0x26, 0x00, 0x0d, 0x26, 0x00, 0x0d, 0x27, 0x00, 0x0d, 0x28, 0x00, 0x0d,
+    0x28, 0x00, 0x0d, 0x29, 0x00, 0x0d, 0x29, 0x00, 0x0d, 0x2a, 0x00, 0x0d, 0x2b, 0x00, 0x0d, 0x2b,
+    0x00, 0x0d, 0x2c, 0x00, 0x0d, 0x2d, 0x00, 0x0d, 0x2d, 0x00, 0x0d, 0x2e, 0x00, 0x0d, 0x2e, 0x00,
+    0x0d, 0x2f, 0x00, 0x0d, 0x30, 0x00, 0x0d, 0x30, 0x00, 0x0d, 0x31, 0x00, 0x0d, 0x32, 0x00, 0x0d,
+    0x32, 0x00, 0x0d, 0x33, 0x00, 0x0d, 0x33, 0x00, 0x0d, 0x34, 0x00, 0x0d, 0x35, 0x00, 0x0d, 0x35,
+    0x00, 0x0d, 0x36, 0x00, 0x0d, 0x37, 0x00, 0x0d, 0x37, 0x00, 0x0d, 0x38, 0x00, 0x0d, 0x38, 0x00,
+    0x0d, 0x39, 0x00, 0x0d, 0x3a, 0x00, 0x0d, 0x3a, 0x00, 0x0d, 0x3b, 0x00, 0x0d, 0xbf, 0x14, 0x00,
+    0x0e, 0x14, 0x00, 0x0e, 0x15, 0x00, 0x0e, 0x15, 0x00, 0x0e, 0x16, 0x00, 0x0e, 0x17, 0x00, 0x0e,
+    0x17, 0x00, 0x0e, 0x18, 0x00, 0x0e, 0x19, 0x00, 0x0e, 0x19, 0x00, 0x0e, 0x1a, 0x00, 0x0e, 0x1a,
+    0x00, 0x0e, 0x1b, 0x00, 0x0e, 0x1c, 0x00, 0x0e, 0x1c, 0x00, 0x0e, 0x1d, 0x00, 0x0e, 0x1e, 0x00,
+    0x0e, 0x1e, 0x00, 0x0e, 0x1f, 0x00, 0x0e, 0x1f, 0x00, 0x0e, 0x20, 0x00, 0x0e, 0x21, 0x00, 0x0e,
+    0x21, 0x00, 0x0e, 0x22, 0x00, 0x0e, 0x23, 0x00, 0x0e, 0x23, 0x00, 0x0e, 0x24, 0x00, 0x0e, 0x24,
+    0x00, 0x0e, 0x25, 0x00, 0x0e, 0x26, 0x00, 0x0e, 0x26, 0x00, 0x0e, 0x27, 0x00, 0x0e, 0x28, 0x00,
+    0x0e, 0x28, 0x00, 0x0e, 0x29, 0x00, 0x0e, 0x29, 0x00, 0x0e, 0x2a, 0x00, 0x0e, 0x2b, 0x00, 0x0e,
+    0x2b, 0x00, 0x0e, 0x2c, 0x00, 0x0e, 0x2d, 0x00, 0x0e, 0x2d, 0x00, 0x0e, 0x2e, 0x00, 0x0e, 0x2e,
+    0x00, 0x0e, 0x2f, 0x00, 0x0e, 0x30, 0x00, 0x0e, 0x30, 0x00, 0x0e, 0x31, 0x00, 0x0e, 0x32, 0x00,
+    0x0e, 0x32, 0x00, 0x0e, 0x33, 0x00, 0x0e, 0x33, 0x00, 0x0e, 0x34, 0x00, 0x0e, 0x35, 0x00, 0x0e,
+    0x35, 0x00, 0x0e, 0x36, 0x00, 0x0e, 0x37, 0x00, 0x0e, 0x37, 0x00, 0x0e, 0x38, 0x00, 0x0e, 0x38,
+    0x00, 0x0e, 0x39, 0x00, 0x0e, 0x3a, 0x00, 0x0e, 0x3a, 0x00, 0x0e, 0x3b, 0x00, 0x0e, 0xbf, 0x14,
+    0x00, 0x0e, 0x14, 0x00, 0x0e, 0x15, 0x00, 0x0e, 0x15, 0x00, 0x0e, 0x16, 0x00, 0x0e, 0x17, 0x00,
+    0x0e, 0x17, 0x00, 0x0e, 0x18, 0x00, 0x0e, 0x19, 0x00, 0x0e, 0x19, 0x00, 0x0e, 0x1a, 0x00, 0x0e,
+    0x1a, 0x00, 0x0e, 0x1b, 0x00, 0x0e, 0x1c, 0x00, 0x0e, 0x1c, 0x00, 0x0e, 0x1d, 0x00, 0x0e, 0x1e,
+    0x00, 0x0e, 0x1e, 0x00, 0x0e, 0x1f, 0x00, 0x0e, 0x1f, 0x00, 0x0e, 0x20, 0x00, 0x0e, 0x21, 0x00,
+    0x0e, 0x21, 0x00, 0x0e, 0x22, 0x00, 0x0e, 0x23, 0x00, 0x0e, 0x23, 0x00, 0x0e, 0x24, 0x00, 0x0e,
+    0x24, 0x00, 0x0e, 0x25, 0x00, 0x0e, 0x26, 0x00, 0x0e, 0x26, 0x00, 0x0e, 0x27, 0x00, 0x0e, 0x28,
+    0x00, 0x0e, 0x28, 0x00, 0x0e, 0x29, 0x00, 0x0e, 0x29, 0x00, 0x0e, 0x2a, 0x00, 0x0e, 0x2b, 0x00,
+    0x0e, 0x2b, 0x00, 0x0e, 0x2c, 0x00, 0x0e, 0x2d, 0x00, 0x0e, 0x2d, 0x00, 0x0e, 0x2e, 0x00, 0x0e,
+    0x2e, 0x00, 0x0e, 0x2f, 0x00, 0x0e, 0x30, 0x00, 0x0e, 0x30, 0x00, 0x0e, 0x31, 0x00, 0x0e, 0x32,
+    0x00, 0x0e, 0x32, 0x00, 0x0e, 0x33, 0x00, 0x0e, 0x33, 0x00, 0x0e, 0x34, 0x00, 0x0e, 0x35, 0x00,
+    0x0e, 0x35, 0x00, 0x0e, 0x36, 0x00, 0x0e, 0x37, 0x00, 0x0e, 0x37, 0x00, 0x0e, 0x38, 0x00, 0x0e,
+    0x38, 0x00, 0x0e, 0x39, 0x00, 0x0e, 0x3a, 0x00, 0x0e, 0x3a, 0x00, 0x0e, 0x3b, 0x00, 0x0e, 0xbf,
+    0x14, 0x00, 0x0f, 0x14, 0x00, 0x0f, 0x15, 0x00, 0x0f, 0x15, 0x00, 0x0f, 0x16, 0x00, 0x0f, 0x17,
+    0x00, 0x0f, 0x17, 0x00, 0x0f, 0x18, 0x00, 0x0f, 0x19, 0x00, 0x0f, 0x19, 0x00, 0x0f, 0x1a, 0x00,
+    0x0f, 0x1a, 0x00, 0x0f, 0x1b, 0x00, 0x0f, 0x1c, 0x00, 0x0f, 0x1c, 0x00, 0x0f, 0x1d, 0x00, 0x0f,
+    0x1e, 0x00, 0x0f, 0x1e, 0x00, 0x0f, 0x1f, 0x00, 0x0f, 0x1f, 0x00, 0x0f, 0x20, 0x00, 0x0f, 0x21,
+    0x00, 0x0f, 0x21, 0x00, 0x0f, 0x22, 0x00, 0x0f, 0x23, 0x00, 0x0f, 0x23, 0x00, 0x0f, 0x24, 0x00,
+    0x0f, 0x24, 0x00, 0x0f, 0x25, 0x00, 0x0f, 0x26, 0x00, 0x0f, 0x26, 0x00, 0x0f, 0x27, 0x00, 0x0f,
+    0x28, 0x00, 0x0f, 0x28, 0x00, 0x0f, 0x29, 0x00, 0x0f, 0x29, 0x00, 0x0f, 0x2a, 0x00, 0x0f, 0x2b,
+    0x00, 0x0f, 0x2b, 0x00, 0x0f, 0x2c, 0x00, 0x0f, 0x2d, 0x00, 0x0f, 0x2d, 0x00, 0x0f, 0x2e, 0x00,
+    0x0f, 0x2e, 0x00, 0x0f, 0x2f, 0x00, 0x0f, 0x30, 0x00, 0x0f, 0x30, 0x00, 0x0f, 0x31, 0x00, 0x0f,
+    0x32, 0x00, 0x0f, 0x32, 0x00, 0x0f, 0x33, 0x00, 0x0f, 0x33, 0x00, 0x0f, 0x34, 0x00, 0x0f, 0x35,
+    0x00, 0x0f, 0x35, 0x00, 0x0f, 0x36, 0x00, 0x0f, 0x37, 0x00, 0x0f, 0x37, 0x00, 0x0f, 0x38, 0x00,
+    0x0f, 0x38, 0x00, 0x0f, 0x39, 0x00, 0x0f, 0x3a, 0x00, 0x0f, 0x3a, 0x00, 0x0f, 0x3b, 0x00, 0x0f,
+    0xbf, 0x14, 0x00, 0x0f, 0x14, 0x00, 0x0f, 0x15, 0x00, 0x0f, 0x15, 0x00, 0x0f, 0x16, 0x00, 0x0f,
+    0x17, 0x00, 0x0f, 0x17, 0x00, 0x0f, 0x18, 0x00, 0x0f, 0x19, 0x00, 0x0f, 0x19, 0x00, 0x0f, 0x1a,
+    0x00, 0x0f, 0x1a, 0x00, 0x0f, 0x1b, 0x00, 0x0f, 0x1c, 0x00, 0x0f, 0x1c, 0x00, 0x0f, 0x1d, 0x00,
+    0x0f, 0x1e, 0x00, 0x0f, 0x1e, 0x00, 0x0f, 0x1f, 0x00, 0x0f, 0x1f, 0x00, 0x0f, 0x20, 0x00, 0x0f,
+    0x21, 0x00, 0x0f, 0x21, 0x00, 0x0f, 0x22, 0x00, 0x0f, 0x23, 0x00, 0x0f, 0x23, 0x00, 0x0f, 0x24,
+    0x00, 0x0f, 0x24, 0x00, 0x0f, 0x25, 0x00, 0x0f, 0x26, 0x00, 0x0f, 0x26, 0x00, 0x0f, 0x27, 0x00,
+    0x0f, 0x28, 0x00, 0x0f, 0x28, 0x00, 0x0f, 0x29, 0x00, 0x0f, 0x29, 0x00, 0x0f, 0x2a, 0x00, 0x0f,
+    0x2b, 0x00, 0x0f, 0x2b, 0x00, 0x0f, 0x2c, 0x00, 0x0f, 0x2d, 0x00, 0x0f, 0x2d, 0x00, 0x0f, 0x2e,
+    0x00, 0x0f, 0x2e, 0x00, 0x0f, 0x2f, 0x00, 0x0f, 0x30, 0x00, 0x0f, 0x30, 0x00, 0x0f, 0x31, 0x00,
+    0x0f, 0x32, 0x00, 0x0f, 0x32, 0x00, 0x0f, 0x33, 0x00, 0x0f, 0x33, 0x00, 0x0f, 0x34, 0x00, 0x0f,
+    0x35, 0x00, 0x0f, 0x35, 0x00, 0x0f, 0x36, 0x00, 0x0f, 0x37, 0x00, 0x0f, 0x37, 0x00, 0x0f, 0x38,
+    0x00, 0x0f, 0x38, 0x00, 0x0f, 0x39, 0x00, 0x0f, 0x3a, 0x00, 0x0f, 0x3a, 0x00, 0x0f, 0x3b, 0x00,
+    0x0f, 0xbf, 0x14, 0x00, 0x10, 0x14, 0x00, 0x10, 0x15, 0x00, 0x10, 0x15, 0x00, 0x10, 0x16, 0x00,
+    0x10, 0x17, 0x00, 0x10, 0x17, 0x00, 0x10, 0x18, 0x00, 0x10, 0x19, 0x00, 0x10, 0x19, 0x00, 0x10,
+    0x1a, 0x00, 0x10, 0x1a, 0x00, 0x10, 0x1b, 0x00, 0x10, 0x1c, 0x00, 0x10, 0x1c, 0x00, 0x10, 0x1d,
+    0x00, 0x10, 0x1e, 0x00, 0x10, 0x1e, 0x00, 0x10, 0x1f, 0x00, 0x10, 0x1f, 0x00, 0x10, 0x20, 0x00,
+    0x10, 0x21, 0x00, 0x10, 0x21, 0x00, 0x10, 0x22, 0x00, 0x10, 0x23, 0x00, 0x10, 0x23, 0x00, 0x10,
+    0x24, 0x00, 0x10, 0x24, 0x00, 0x10, 0x25, 0x00, 0x10, 0x26, 0x00, 0x10, 0x26, 0x00, 0x10, 0x27,
+    0x00, 0x10, 0x28, 0x00, 0x10, 0x28, 0x00, 0x10, 0x29, 0x00, 0x10, 0x29, 0x00, 0x10, 0x2a, 0x00,
+    0x10, 0x2b, 0x00, 0x10, 0x2b, 0x00, 0x10, 0x2c, 0x00, 0x10, 0x2d, 0x00, 0x10, 0x2d, 0x00, 0x10,
+    0x2e, 0x00, 0x10, 0x2e, 0x00, 0x10, 0x2f, 0x00, 0x10, 0x30, 0x00, 0x10, 0x30, 0x00, 0x10, 0x31,
+    0x00, 0x10, 0x32, 0x00, 0x10, 0x32, 0x00, 0x10, 0x33, 0x00, 0x10, 0x33, 0x00, 0x10, 0x34, 0x00,
+    0x10, 0x35, 0x00, 0x10, 0x35, 0x00, 0x10, 0x36, 0x00, 0x10, 0x37, 0x00, 0x10, 0x37, 0x00, 0x10,
+    0x38, 0x00, 0x10, 0x38, 0x00, 0x10, 0x39, 0x00, 0x10, 0x3a, 0x00, 0x10, 0x3a, 0x00, 0x10, 0x3b,
+    0x00, 0x10, 0xbf, 0x14, 0x00, 0x10, 0x14, 0x00, 0x10, 0x15, 0x00, 0x10, 0x15, 0x00, 0x10, 0x16,
+    0x00, 0x10, 0x17, 0x00, 0x10, 0x17, 0x00, 0x10, 0x18, 0x00, 0x10, 0x19, 0x00, 0x10, 0x19, 0x00,
+    0x10, 0x1a, 0x00, 0x10, 0x1a, 0x00, 0x10, 0x1b, 0x00, 0x10, 0x1c, 0x00, 0x10, 0x1c, 0x00, 0x10,
+    0x1d, 0x00, 0x10, 0x1e, 0x00, 0x10, 0x1e, 0x00, 0x10, 0x1f, 0x00, 0x10, 0x1f, 0x00, 0x10, 0x20,
+    0x00, 0x10, 0x21, 0x00, 0x10, 0x21, 0x00, 0x10, 0x22, 0x00, 0x10, 0x23, 0x00, 0x10, 0x23, 0x00,
+    0x10, 0x24, 0x00, 0x10, 0x24, 0x00, 0x10, 0x25, 0x00, 0x10, 0x26, 0x00, 0x10, 0x26, 0x00, 0x10,
+    0x27, 0x00, 0x10, 0x28, 0x00, 0x10, 0x28, 0x00, 0x10, 0x29, 0x00, 0x10, 0x29, 0x00, 0x10, 0x2a,
+    0x00, 0x10, 0x2b, 0x00, 0x10, 0x2b, 0x00, 0x10, 0x2c, 0x00, 0x10, 0x2d, 0x00, 0x10, 0x2d, 0x00,
+    0x10, 0x2e, 0x00, 0x10, 0x2e, 0x00, 0x10, 0x2f, 0x00, 0x10, 0x30, 0x00, 0x10, 0x30, 0x00, 0x10,
+    0x31, 0x00, 0x10, 0x32, 0x00, 0x10, 0x32, 0x00, 0x10, 0x33, 0x00, 0x10, 0x33, 0x00, 0x10, 0x34,
+    0x00, 0x10, 0x35, 0x00, 0x10, 0x35, 0x00, 0x10, 0x36, 0x00, 0x10, 0x37, 0x00, 0x10, 0x37, 0x00,
+    0x10, 0x38, 0x00, 0x10, 0x38, 0x00, 0x10, 0x39, 0x00, 0x10, 0x3a, 0x00, 0x10, 0x3a, 0x00, 0x10,
+    0x3b, 0x00, 0x10, 0xbf, 0x14, 0x00, 0x11, 0x14, 0x00, 0x11, 0x15, 0x00, 0x11, 0x15, 0x00, 0x11,
+    0x16, 0x00, 0x11, 0x17, 0x00, 0x11, 0x17, 0x00, 0x11, 0x18, 0x00, 0x11, 0x19, 0x00, 0x11, 0x19,
+    0x00, 0x11, 0x1a, 0x00, 0x11, 0x1a, 0x00, 0x11, 0x1b, 0x00, 0x11, 0x1c, 0x00, 0x11, 0x1c, 0x00,
+    0x11, 0x1d, 0x00, 0x11, 0x1e, 0x00, 0x11, 0x1e, 0x00, 0x11, 0x1f, 0x00, 0x11, 0x1f, 0x00, 0x11,
+    0x20, 0x00, 0x11, 0x21, 0x00, 0x11, 0x21, 0x00, 0x11, 0x22, 0x00, 0x11, 0x23, 0x00, 0x11, 0x23,
+    0x00, 0x11, 0x24, 0x00, 0x11, 0x24, 0x00, 0x11, 0x25, 0x00, 0x11, 0x26, 0x00, 0x11, 0x26, 0x00,
+    0x11, 0x27, 0x00, 0x11, 0x28, 0x00, 0x11, 0x28, 0x00, 0x11, 0x29, 0x00, 0x11, 0x29, 0x00, 0x11,
+    0x2a, 0x00, 0x11, 0x2b, 0x00, 0x11, 0x2b, 0x00, 0x11, 0x2c, 0x00, 0x11, 0x2d, 0x00, 0x11, 0x2d,
+    0x00, 0x11, 0x2e, 0x00, 0x11, 0x2e, 0x00, 0x11, 0x2f, 0x00, 0x11, 0x30, 0x00, 0x11, 0x30, 0x00,
+    0x11, 0x31, 0x00, 0x11, 0x32, 0x00, 0x11, 0x32, 0x00, 0x11, 0x33, 0x00, 0x11, 0x33, 0x00, 0x11,
+    0x34, 0x00, 0x11, 0x35, 0x00, 0x11, 0x35, 0x00, 0x11, 0x36, 0x00, 0x11, 0x37, 0x00, 0x11, 0x37,
+    0x00, 0x11, 0x38, 0x00, 0x11, 0x38, 0x00, 0x11, 0x39, 0x00, 0x11, 0x3a, 0x00, 0x11, 0x3a, 0x00,
+    0x11, 0x3b, 0x00, 0x11, 0xbf, 0x14, 0x00, 0x11, 0x14, 0x00, 0x11, 0x15, 0x00, 0x11, 0x15, 0x00,
+    0x11, 0x16, 0x00, 0x11, 0x17, 0x00, 0x11, 0x17, 0x00, 0x11, 0x18, 0x00, 0x11, 0x19, 0x00, 0x11,
+    0x19, 0x00, 0x11, 0x1a, 0x00, 0x11, 0x1a, 0x00, 0x11, 0x1b, 0x00, 0x11, 0x1c, 0x00, 0x11, 0x1c,
+    0x00, 0x11, 0x1d, 0x00, 0x11, 0x1e, 0x00, 0x11, 0x1e, 0x00, 0x11, 0x1f, 0x00, 0x11, 0x1f, 0x00,
+    0x11, 0x20, 0x00, 0x11, 0x21, 0x00, 0x11, 0x21, 0x00, 0x11, 0x22, 0x00, 0x11, 0x23, 0x00, 0x11,
+    0x23, 0x00, 0x11, 0x24, 0x00, 0x11, 0x24, 0x00, 0x11, 0x25, 0x00, 0x11, 0x26, 0x00, 0x11, 0x26,
+    0x00, 0x11, 0x27, 0x00, 0x11, 0x28, 0x00, 0x11, 0x28, 0x00, 0x11, 0x29, 0x00, 0x11, 0x29, 0x00,
+    0x11, 0x2a, 0x00, 0x11, 0x2b, 0x00, 0x11, 0x2b, 0x00, 0x11, 0x2c, 0x00, 0x11, 0x2d, 0x00, 0x11,
+    0x2d, 0x00, 0x11, 0x2e, 0x00, 0x11, 0x2e, 0x00, 0x11, 0x2f, 0x00, 0x11, 0x30, 0x00, 0x11, 0x30,
+    0x00, 0x11, 0x31, 0x00, 0x11, 0x32, 0x00, 0x11, 0x32, 0x00, 0x11, 0x33, 0x00, 0x11, 0x33, 0x00,
+    0x11, 0x34, 0x00, 0x11, 0x35, 0x00, 0x11, 0x35, 0x00, 0x11, 0x36, 0x00, 0x11, 0x37, 0x00, 0x11,
+    0x37, 0x00, 0x11, 0x38, 0x00, 0x11, 0x38, 0x00, 0x11, 0x39, 0x00, 0x11, 0x3a, 0x00, 0x11, 0x3a,
+    0x00, 0x11, 0x3b, 0x00, 0x11, 0xb2, 0x14, 0x00, 0x11, 0x14, 0x00, 0x11, 0x15, 0x00, 0x11, 0x15,
+    0x00, 0x11, 0x16, 0x00, 0x11, 0x17, 0x00, 0x11, 0x17, 0x00, 0x11, 0x18, 0x00, 0x11, 0x19, 0x00,
+    0x11, 0x19, 0x00, 0x11, 0x1a, 0x00, 0x11, 0x1a, 0x00, 0x11, 0x1b, 0x00, 0x11, 0x1c, 0x00, 0x11,
+    0x1c, 0x00, 0x11, 0x1d, 0x00, 0x11, 0x1e, 0x00, 0x11, 0x1e, 0x00, 0x11, 0x1f, 0x00, 0x11, 0x1f,
+    0x00, 0x11, 0x20, 0x00, 0x11, 0x21, 0x00, 0x11, 0x21, 0x00, 0x11, 0x22, 0x00, 0x11, 0x23, 0x00,
+    0x11, 0x23, 0x00, 0x11, 0x24, 0x00, 0x11, 0x24, 0x00, 0x11, 0x25, 0x00, 0x11, 0x26, 0x00, 0x11,
+    0x26, 0x00, 0x11, 0x27, 0x00, 0x11, 0x28, 0x00, 0x11, 0x28, 0x00, 0x11, 0x29, 0x00, 0x11, 0x29,
+    0x00, 0x11, 0x2a, 0x00, 0x11, 0x2b, 0x00, 0x11, 0x2b, 0x00, 0x11, 0x2c, 0x00, 0x11, 0x2d, 0x00,
+    0x11, 0x2d, 0x00, 0x11, 0x2e, 0x00, 0x11, 0x2e, 0x00, 0x11, 0x2f, 0x00, 0x11, 0x30, 0x00, 0x11,
+    0x30, 0x00, 0x11, 0x31, 0x00, 0x11, 0x32, 0x00, 0x11, 0x32, 0x00, 0x11, 0x33, 0x00, 0x11, 0x42,
+    0x37, 0x37, 0x0d, 0x89, 0x35, 0x00, 0x11, 0x36, 0x00, 0x11, 0x37, 0x00, 0x11, 0x37, 0x00, 0x11,
+    0x38, 0x00, 0x11, 0x38, 0x00, 0x11, 0x39, 0x00, 0x11, 0x3a, 0x00, 0x11, 0x3a, 0x00, 0x11, 0x3b,
+    0x00, 0x11, 0xb2, 0x14, 0x00, 0x12, 0x14, 0x00, 0x12, 0x15, 0x00, 0x12, 0x15, 0x00, 0x12, 0x16,
+    0x00, 0x12, 0x17, 0x00, 0x12, 0x17, 0x00, 0x12, 0x18, 0x00, 0x12, 0x19, 0x00, 0x12, 0x19, 0x00,
+    0x12, 0x1a, 0x00, 0x12, 0x1a, 0x00, 0x12, 0x1b, 0x00, 0x12, 0x1c, 0x00, 0x12, 0x1c, 0x00, 0x12,
+    0x1d, 0x00, 0x12, 0x1e, 0x00, 0x12, 0x1e, 0x00, 0x12, 0x1f, 0x00, 0x12, 0x1f, 0x00, 0x12, 0x20,
+    0x00, 0x12, 0x21, 0x00, 0x12, 0x21, 0x00, 0x12, 0x22, 0x00, 0x12, 0x23, 0x00, 0x12, 0x23, 0x00,
+    0x12, 0x24, 0x00, 0x12, 0x24, 0x00, 0x12, 0x25, 0x00, 0x12, 0x26, 0x00, 0x12, 0x26, 0x00, 0x12,
+    0x27, 0x00, 0x12, 0x28, 0x00, 0x12, 0x28, 0x00, 0x12, 0x29, 0x00, 0x12, 0x29, 0x00, 0x12, 0x2a,
+    0x00, 0x12, 0x2b, 0x00, 0x12, 0x2b, 0x00, 0x12, 0x2c, 0x00, 0x12, 0x2d, 0x00, 0x12, 0x2d, 0x00,
+    0x12, 0x2e, 0x00, 0x12, 0x2e, 0x00, 0x12, 0x2f, 0x00, 0x12, 0x30, 0x00, 0x12, 0x30, 0x00, 0x12,
+    0x31, 0x00, 0x12, 0x32, 0x00, 0x12, 0x32, 0x00, 0x12, 0x33, 0x00, 0x12, 0x42, 0x37, 0x37, 0x0d,
+    0x89, 0x35, 0x00, 0x12, 0x36, 0x00, 0x12, 0x37, 0x00, 0x12, 0x37, 0x00, 0x12, 0x38, 0x00, 0x12,
+    0x38, 0x00, 0x12, 0x39, 0x00, 0x12, 0x3a, 0x00, 0x12, 0x3a, 0x00, 0x12, 0x3b, 0x00, 0x12, 0xb2,
+    0x14, 0x00, 0x12, 0x14, 0x00, 0x12, 0x15, 0x00, 0x12, 0x15, 0x00, 0x12, 0x16, 0x00, 0x12, 0x17,
+    0x00, 0x12, 0x17, 0x00, 0x12, 0x18, 0x00, 0x12, 0x19, 0x00, 0x12, 0x19, 0x00, 0x12, 0x1a, 0x00,
+    0x12, 0x1a, 0x00, 0x12, 0x1b, 0x00, 0x12, 0x1c, 0x00, 0x12, 0x1c, 0x00, 0x12, 0x1d, 0x00, 0x12,
+    0x1e, 0x00, 0x12, 0x1e, 0x00, 0x12, 0x1f, 0x00, 0x12, 0x1f, 0x00, 0x12, 0x20, 0x00, 0x12, 0x21,
+    0x00, 0x12, 0x21, 0x00, 0x12, 0x22, 0x00, 0x12, 0x23, 0x00, 0x12, 0x23, 0x00, 0x12, 0x24, 0x00,
+    0x12, 0x24, 0x00, 0x12, 0x25, 0x00, 0x12, 0x26, 0x00, 0x12, 0x26, 0x00, 0x12, 0x27, 0x00, 0x12,
+    0x28, 0x00, 0x12, 0x28, 0x00, 0x12, 0x29, 0x00, 0x12, 0x29, 0x00, 0x12, 0x2a, 0x00, 0x12, 0x2b,
+    0x00, 0x12, 0x2b, 0x00, 0x12, 0x2c, 0x00, 0x12, 0x2d, 0x00, 0x12, 0x2d, 0x00, 0x12, 0x2e, 0x00,
+    0x12, 0x2e, 0x00, 0x12, 0x2f, 0x00, 0x12, 0x30, 0x00, 0x12, 0x30, 0x00, 0x12, 0x31, 0x00, 0x12,
+    0x32, 0x00, 0x12, 0x32, 0x00, 0x12, 0x33, 0x00, 0x12, 0x42, 0x37, 0x37, 0x0d, 0x89, 0x5f, 0x5f,
+    0x17, 0x36, 0x00, 0x12, 0x37, 0x00, 0x12, 0x37, 0x00, 0x12, 0x38, 0x00, 0x12, 0x38, 0x00, 0x12,
+    0x39, 0x00, 0x12, 0x3a, 0x00, 0x12, 0x3a, 0x00, 0x12, 0x3b, 0x00, 0x12, 0xb3, 0x14, 0x00, 0x13,
+    0x14, 0x00, 0x13, 0x15, 0x00, 0x13, 0x15, 0x00, 0x13, 0x16, 0x00, 0x13, 0x17, 0x00, 0x13, 0x17,
+    0x00, 0x13, 0x18, 0x00, 0x13, 0x19, 0x00, 0x13, 0x19, 0x00, 0x13, 0x1a, 0x00, 0x13, 0x1a, 0x00,
+    0x13, 0x1b, 0x00, 0x13, 0x1c, 0x00, 0x13, 0x1c, 0x00, 0x13, 0x1d, 0x00, 0x13, 0x1e, 0x00, 0x13,
+    0x1e, 0x00, 0x13, 0x1f, 0x00, 0x13, 0x1f, 0x00, 0x13, 0x20, 0x00, 0x13, 0x21, 0x00, 0x13, 0x21,
+    0x00, 0x13, 0x22, 0x00, 0x13, 0x23, 0x00, 0x13, 0x23, 0x00, 0x13, 0x24, 0x00, 0x13, 0x24, 0x00,
+    0x13, 0x25, 0x00, 0x13, 0x26, 0x00, 0x13, 0x26, 0x00, 0x13, 0x27, 0x00, 0x13, 0x28, 0x00, 0x13,
+    0x28, 0x00, 0x13, 0x29, 0x00, 0x13, 0x29, 0x00, 0x13, 0x2a, 0x00, 0x13, 0x2b, 0x00, 0x13, 0x2b,
+    0x00, 0x13, 0x2c, 0x00, 0x13, 0x2d, 0x00, 0x13, 0x2d, 0x00, 0x13, 0x2e, 0x00, 0x13, 0x2e, 0x00,
+    0x13, 0x2f, 0x00, 0x13, 0x30, 0x00, 0x13, 0x30, 0x00, 0x13, 0x31, 0x00, 0x13, 0x32, 0x00, 0x13,
+    0x32, 0x00, 0x13, 0x33, 0x00, 0x13, 0x33, 0x00, 0x13, 0x42, 0x5f, 0x5f, 0x17, 0x88, 0x36, 0x00,
+    0x13, 0x37, 0x00, 0x13, 0x37, 0x00, 0x13, 0x38, 0x00, 0x13, 0x38, 0x00, 0x13, 0x39, 0x00, 0x13,
+    0x3a, 0x00, 0x13, 0x3a, 0x00, 0x13, 0x3b, 0x00, 0x13, 0xb3, 0x14, 0x00, 0x13, 0x14, 0x00, 0x13,
+    0x15, 0x00, 0x13, 0x15, 0x00, 0x13, 0x16, 0x00, 0x13, 0x17, 0x00, 0x13, 0x17, 0x00, 0x13, 0x18,
+    0x00, 0x13, 0x19, 0x00, 0x13, 0x19, 0x00, 0x13, 0x1a, 0x00, 0x13, 0x1a, 0x00, 0x13, 0x1b, 0x00,
+    0x13, 0x1c, 0x00, 0x13, 0x1c, 0x00, 0x13, 0x1d, 0x00, 0x13, 0x1e, 0x00, 0x13, 0x1e, 0x00, 0x13,
+    0x1f, 0x00, 0x13, 0x1f, 0x00, 0x13, 0x20, 0x00, 0x13, 0x21, 0x00, 0x13, 0x21, 0x00, 0x13, 0x22,
+    0x00, 0x13, 0x23, 0x00, 0x13, 0x23, 0x00, 0x13, 0x24, 0x00, 0x13, 0x24, 0x00, 0x13, 0x25, 0x00,
+    0x13, 0x26, 0x00, 0x13, 0x26, 0x00, 0x13, 0x00, 0xa0, 0xff, 0x00, 0xa0, 0xff, 0x28, 0x00, 0x13,
+    0x29, 0x00, 0x13, 0x29, 0x00, 0x13, 0x2a, 0x00, 0x13, 0x2b, 0x00, 0x13, 0x2b, 0x00, 0x13, 0x2c,
+    0x00, 0x13, 0x2d, 0x00, 0x13, 0x2d, 0x00, 0x13, 0x2e, 0x00, 0x13, 0x2e, 0x00, 0x13, 0x2f, 0x00,
+    0x13, 0x30, 0x00, 0x13, 0x30, 0x00, 0x13, 0x31, 0x00, 0x13, 0x32, 0x00, 0x13, 0x32, 0x00, 0x13,
+    0x33, 0x00, 0x13, 0x33, 0x00, 0x13, 0x42, 0x5f, 0x5f, 0x17, 0x88, 0x36, 0x00, 0x13, 0x37, 0x00,
+    0x13, 0x37, 0x00, 0x13, 0x38, 0x00, 0x13, 0x38, 0x00, 0x13, 0x39, 0x00, 0x13, 0x3a, 0x00, 0x13,
+    0x3a, 0x00, 0x13, 0x3b, 0x00, 0x13, 0x9d, 0x14, 0x00, 0x14, 0x14, 0x00, 0x14, 0x15, 0x00, 0x14,
+    0x15, 0x00, 0x14, 0x16, 0x00, 0x14, 0x17, 0x00, 0x14, 0x17, 0x00, 0x14, 0x18, 0x00, 0x14, 0x19,
+    0x00, 0x14, 0x19, 0x00, 0x14, 0x1a, 0x00, 0x14, 0x1a, 0x00, 0x14, 0x1b, 0x00, 0x14, 0x1c, 0x00,
+    0x14, 0x1c, 0x00, 0x14, 0x1d, 0x00, 0x14, 0x1e, 0x00, 0x14, 0x1e, 0x00, 0x14, 0x1f, 0x00, 0x14,
+    0x1f, 0x00, 0x14, 0x20, 0x00, 0x14, 0x21, 0x00, 0x14, 0x21, 0x00, 0x14, 0x22, 0x00, 0x14, 0x23,
+    0x00, 0x14, 0x23, 0x00, 0x14, 0x24, 0x00, 0x14, 0x24, 0x00, 0x14, 0x25, 0x00, 0x14, 0x26, 0x00,
+    0x14, 0x43, 0x00, 0xa0, 0xff, 0x92, 0x29, 0x00, 0x14, 0x29, 0x00, 0x14, 0x2a, 0x00, 0x14, 0x2b,
+    0x00, 0x14, 0x2b, 0x00, 0x14, 0x2c, 0x00, 0x14, 0x2d, 0x00, 0x14, 0x2d, 0x00, 0x14, 0x2e, 0x00,
+    0x14, 0x2e, 0x00, 0x14, 0x2f, 0x00, 0x14, 0x30, 0x00, 0x14, 0x30, 0x00, 0x14, 0x31, 0x00, 0x14,
+    0x32, 0x00, 0x14, 0x32, 0x00, 0x14, 0x33, 0x00, 0x14, 0x33, 0x00, 0x14, 0x34, 0x00, 0x14, 0x42,
+    0x87, 0x87, 0x21, 0x87, 0x37, 0x00, 0x14, 0x37, 0x00, 0x14, 0x38, 0x00, 0x14, 0x38, 0x00, 0x14,
+    0x39, 0x00, 0x14, 0x3a, 0x00, 0x14, 0x3a, 0x00, 0x14, 0x3b, 0x00, 0x14, 0x9c, 0x14, 0x00, 0x14,
+    0x14, 0x00, 0x14, 0x15, 0x00, 0x14, 0x15, 0x00, 0x14, 0x16, 0x00, 0x14, 0x17, 0x00, 0x14, 0x17,
+    0x00, 0x14, 0x18, 0x00, 0x14, 0x19, 0x00, 0x14, 0x19, 0x00, 0x14, 0x1a, 0x00, 0x14, 0x1a, 0x00,
+    0x14, 0x1b, 0x00, 0x14, 0x1c, 0x00, 0x14, 0x1c, 0x00, 0x14, 0x1d, 0x00, 0x14, 0x1e, 0x00, 0x14,
+    0x1e, 0x00, 0x14, 0x1f, 0x00, 0x14, 0x1f, 0x00, 0x14, 0x20, 0x00, 0x14, 0x21, 0x00, 0x14, 0x21,
+    0x00, 0x14, 0x22, 0x00, 0x14, 0x23, 0x00, 0x14, 0x23, 0x00, 0x14, 0x24, 0x00, 0x14, 0x24, 0x00,
+    0x14, 0x25, 0x00, 0x14, 0x45, 0x00, 0xa0, 0xff, 0x91, 0x29, 0x00, 0x14, 0x2a, 0x00, 0x14, 0x2b,
+    0x00, 0x14, 0x2b, 0x00, 0x14, 0x2c, 0x00, 0x14, 0x2d, 0x00, 0x14, 0x2d, 0x00, 0x14, 0x2e, 0x00,
+    0x14, 0x2e, 0x00, 0x14, 0x2f, 0x00, 0x14, 0x30, 0x00, 0x14, 0x30, 0x00, 0x14, 0x31, 0x00, 0x14,
+    0x32, 0x00, 0x14, 0x32, 0x00, 0x14, 0x33, 0x00, 0x14, 0x33, 0x00, 0x14, 0x34, 0x00, 0x14, 0x42,
+    0x87, 0x87, 0x21, 0x87, 0x37, 0x00, 0x14, 0x37, 0x00, 0x14, 0x38, 0x00, 0x14, 0x38, 0x00, 0x14,
+    0x39, 0x00, 0x14, 0x3a, 0x00, 0x14, 0x3a, 0x00, 0x14, 0x3b, 0x00, 0x14, 0x9b, 0x14, 0x00, 0x15,
+    0x14, 0x00, 0x15, 0x15, 0x00, 0x15, 0x15, 0x00, 0x15, 0x16, 0x00, 0x15, 0x17, 0x00, 0x15, 0x17,
+    0x00, 0x15, 0x18, 0x00, 0x15, 0x19, 0x00, 0x15, 0x19, 0x00, 0x15, 0x1a, 0x00, 0x15, 0x1a, 0x00,
+    0x15, 0x1b, 0x00, 0x15, 0x1c, 0x00, 0x15, 0x1c, 0x00, 0x15, 0x1d, 0x00, 0x15, 0x1e, 0x00, 0x15,
+    0x1e, 0x00, 0x15, 0x1f, 0x00, 0x15, 0x1f, 0x00, 0x15, 0x20, 0x00, 0x15, 0x21, 0x00, 0x15, 0x21,
+    0x00, 0x15, 0x22, 0x00, 0x15, 0x23, 0x00, 0x15, 0x23, 0x00, 0x15, 0x24, 0x00, 0x15, 0x24, 0x00,
+    0x15, 0x47, 0x00, 0xa0, 0xff, 0x90, 0x2a, 0x00, 0x15, 0x2b, 0x00, 0x15, 0x2b, 0x00, 0x15, 0x2c,
+    0x00, 0x15, 0x2d, 0x00, 0x15, 0x2d, 0x00, 0x15, 0x2e, 0x00, 0x15, 0x2e, 0x00, 0x15, 0x2f, 0x00,
+    0x15, 0x30, 0x00, 0x15, 0x30, 0x00, 0x15, 0x31, 0x00, 0x15, 0x32, 0x00, 0x15, 0x32, 0x00, 0x15,
+    0x33, 0x00, 0x15, 0x33, 0x00, 0x15, 0x34, 0x00, 0x15, 0x42, 0x87, 0x87, 0x21, 0x87, 0x37, 0x00,
+    0x15, 0x37, 0x00, 0x15, 0x38, 0x00, 0x15, 0x38, 0x00, 0x15, 0x39, 0x00, 0x15, 0x3a, 0x00, 0x15,
+    0x3a, 0x00, 0x15, 0x3b, 0x00, 0x15, 0x9a, 0x14, 0x00, 0x15, 0x14, 0x00, 0x15, 0x15, 0x00, 0x15,
+    0x15, 0x00, 0x15, 0x16, 0x00, 0x15, 0x17, 0x00, 0x15, 0x17, 0x00, 0x15, 0x18, 0x00, 0x15, 0x19,
+    0x00, 0x15, 0x19, 0x00, 0x15, 0x1a, 0x00, 0x15, 0x1a, 0x00, 0x15, 0x1b, 0x00, 0x15, 0x1c, 0x00,
+    0x15, 0x1c, 0x00, 0x15, 0x1d, 0x00, 0x15, 0x1e, 0x00, 0x15, 0x1e, 0x00, 0x15, 0x1f, 0x00, 0x15,
+    0x1f, 0x00, 0x15, 0x20, 0x00, 0x15, 0x21, 0x00, 0x15, 0x21, 0x00, 0x15, 0x22, 0x00, 0x15, 0x23,
+    0x00, 0x15, 0x23, 0x00, 0x15, 0x24, 0x00, 0x15, 0x49, 0x00, 0xa0, 0xff, 0x90, 0x2b, 0x00, 0x15,
+    0x2b, 0x00, 0x15, 0x2c, 0x00, 0x15, 0x2d, 0x00, 0x15, 0x2d, 0x00, 0x15, 0x2e, 0x00, 0x15, 0x2e,
+    0x00, 0x15, 0x2f, 0x00, 0x15, 0x30, 0x00, 0x15, 0x30, 0x00, 0x15, 0x31, 0x00, 0x15, 0x32, 0x00,
+    0x15, 0x32, 0x00, 0x15, 0x33, 0x00, 0x15, 0x33, 0x00, 0x15, 0x34, 0x00, 0x15, 0x35, 0x00, 0x15,
+    0x42, 0xaf, 0xaf, 0x2b, 0x86, 0x37, 0x00, 0x15, 0x38, 0x00, 0x15, 0x38, 0x00, 0x15, 0x39, 0x00,
+    0x15, 0x3a, 0x00, 0x15, 0x3a, 0x00, 0x15, 0x3b, 0x00, 0x15, 0x99, 0x14, 0x00, 0x16, 0x14, 0x00,
+    0x16, 0x15, 0x00, 0x16, 0x15, 0x00, 0x16, 0x16, 0x00, 0x16, 0x17, 0x00, 0x16, 0x17, 0x00, 0x16,
+    0x18, 0x00, 0x16, 0x19, 0x00, 0x16, 0x19, 0x00, 0x16, 0x1a, 0x00, 0x16, 0x1a, 0x00, 0x16, 0x1b,
+    0x00, 0x16, 0x1c, 0x00, 0x16, 0x1c, 0x00, 0x16, 0x1d, 0x00, 0x16, 0x1e, 0x00, 0x16, 0x1e, 0x00,
+    0x16, 0x1f, 0x00, 0x16, 0x1f, 0x00, 0x16, 0x20, 0x00, 0x16, 0x21, 0x00, 0x16, 0x21, 0x00, 0x16,
+    0x22, 0x00, 0x16, 0x23, 0x00, 0x16, 0x23, 0x00, 0x16, 0x4b, 0x00, 0xa0, 0xff, 0x8f, 0x2b, 0x00,
+    0x16, 0x2c, 0x00, 0x16, 0x2d, 0x00, 0x16, 0x2d, 0x00, 0x16, 0x2e, 0x00, 0x16, 0x2e, 0x00, 0x16,
+    0x2f, 0x00, 0x16, 0x30, 0x00, 0x16, 0x30, 0x00, 0x16, 0x31, 0x00, 0x16, 0x32, 0x00, 0x16, 0x32,
+    0x00, 0x16, 0x33, 0x00, 0x16, 0x33, 0x00, 0x16, 0x34, 0x00, 0x16, 0x35, 0x00, 0x16, 0x42, 0xaf,
+    0xaf, 0x2b, 0x86, 0x37, 0x00, 0x16, 0x38, 0x00, 0x16, 0x38, 0x00, 0x16, 0x39, 0x00, 0x16, 0x3a,
+    0x00, 0x16, 0x3a, 0x00, 0x16, 0x3b, 0x00, 0x16, 0x98, 0x14, 0x00, 0x16, 0x14, 0x00, 0x16, 0x15,
+    0x00, 0x16, 0x15, 0x00, 0x16, 0x16, 0x00, 0x16, 0x17, 0x00, 0x16, 0x17, 0x00, 0x16, 0x18, 0x00,
+    0x16, 0x19, 0x00, 0x16, 0x19, 0x00, 0x16, 0x1a, 0x00, 0x16, 0x1a, 0x00, 0x16, 0x1b, 0x00, 0x16,
+    0x1c, 0x00, 0x16, 0x1c, 0x00, 0x16, 0x1d, 0x00, 0x16, 0x1e, 0x00, 0x16, 0x1e, 0x00, 0x16, 0x1f,
+    0x00, 0x16, 0x1f, 0x00, 0x16, 0x20, 0x00, 0x16, 0x21, 0x00, 0x16, 0x21, 0x00, 0x16, 0x22, 0x00,
+    0x16, 0x23, 0x00, 0x16, 0x4d, 0x00, 0xa0, 0xff, 0x8e, 0x2c, 0x00, 0x16, 0x2d, 0x00, 0x16, 0x2d,
+    0x00, 0x16, 0x2e, 0x00, 0x16, 0x2e, 0x00, 0x16, 0x2f, 0x00, 0x16, 0x30, 0x00, 0x16, 0x30, 0x00,
+    0x16, 0x31, 0x00, 0x16, 0x32, 0x00, 0x16, 0x32, 0x00, 0x16, 0x33, 0x00, 0x16, 0x33, 0x00, 0x16,
+    0x34, 0x00, 0x16, 0x35, 0x00, 0x16, 0x42, 0xaf, 0xaf, 0x2b, 0x86, 0x37, 0x00, 0x16, 0x38, 0x00,
+    0x16, 0x38, 0x00, 0x16, 0x39, 0x00, 0x16, 0x3a, 0x00, 0x16, 0x3a, 0x00, 0x16, 0x3b, 0x00, 0x16,
+    0x97, 0x14, 0x00, 0x17, 0x14, 0x00, 0x17, 0x15, 0x00, 0x17, 0x15, 0x00, 0x17, 0x16, 0x00, 0x17,
+    0x17, 0x00, 0x17, 0x17, 0x00, 0x17, 0x18, 0x00, 0x17, 0x19, 0x00, 0x17, 0x19, 0x00, 0x17, 0x1a,
+    0x00, 0x17, 0x1a, 0x00, 0x17, 0x1b, 0x00, 0x17, 0x1c, 0x00, 0x17, 0x1c, 0x00, 0x17, 0x1d, 0x00,
+    0x17, 0x1e, 0x00, 0x17, 0x1e, 0x00, 0x17, 0x1f, 0x00, 0x17, 0x1f, 0x00, 0x17, 0x20, 0x00, 0x17,
+    0x21, 0x00, 0x17, 0x21, 0x00, 0x17, 0x22, 0x00, 0x17, 0x4f, 0x00, 0xa0, 0xff, 0x8e, 0x2d, 0x00,
+    0x17, 0x2d, 0x00, 0x17, 0x2e, 0x00, 0x17, 0x2e, 0x00, 0x17, 0x2f, 0x00, 0x17, 0x30, 0x00, 0x17,
+    0x30, 0x00, 0x17, 0x31, 0x00, 0x17, 0x32, 0x00, 0x17, 0x32, 0x00, 0x17, 0x33, 0x00, 0x17, 0x33,
+    0x00, 0x17, 0x34, 0x00, 0x17, 0x35, 0x00, 0x17, 0x35, 0x00, 0x17, 0x42, 0xd7, 0xd7, 0x35, 0x85,
+    0x38, 0x00, 0x17, 0x38, 0x00, 0x17, 0x39, 0x00, 0x17, 0x3a, 0x00, 0x17, 0x3a, 0x00, 0x17, 0x3b,
+    0x00, 0x17, 0x96, 0x14, 0x00, 0x17, 0x14, 0x00, 0x17, 0x15, 0x00, 0x17, 0x15, 0x00, 0x17, 0x16,
+    0x00, 0x17, 0x17, 0x00, 0x17, 0x17, 0x00, 0x17, 0x18, 0x00, 0x17, 0x19, 0x00, 0x17, 0x19, 0x00,
+    0x17, 0x1a, 0x00, 0x17, 0x1a, 0x00, 0x17, 0x1b, 0x00, 0x17, 0x1c, 0x00, 0x17, 0x1c, 0x00, 0x17,
+    0x1d, 0x00, 0x17, 0x1e, 0x00, 0x17, 0x1e, 0x00, 0x17, 0x1f, 0x00, 0x17, 0x1f, 0x00, 0x17, 0x20,
+    0x00, 0x17, 0x21, 0x00, 0x17, 0x21, 0x00, 0x17, 0x51, 0x00, 0xa0, 0xff, 0x8d, 0x2d, 0x00, 0x17,
+    0x2e, 0x00, 0x17, 0x2e, 0x00, 0x17, 0x2f, 0x00, 0x17, 0x30, 0x00, 0x17, 0x30, 0x00, 0x17, 0x31,
+    0x00, 0x17, 0x32, 0x00, 0x17, 0x32, 0x00, 0x17, 0x33, 0x00, 0x17, 0x33, 0x00, 0x17, 0x34, 0x00,
+    0x17, 0x35, 0x00, 0x17, 0x35, 0x00, 0x17, 0x42, 0xd7, 0xd7, 0x35, 0x85, 0x38, 0x00, 0x17, 0x38,
+    0x00, 0x17, 0x39, 0x00, 0x17, 0x3a, 0x00, 0x17, 0x3a, 0x00, 0x17, 0x3b, 0x00, 0x17, 0x95, 0x14,
+    0x00, 0x18, 0x14, 0x00, 0x18, 0x15, 0x00, 0x18, 0x15, 0x00, 0x18, 0x16, 0x00, 0x18, 0x17, 0x00,
+    0x18, 0x17, 0x00, 0x18, 0x18, 0x00, 0x18, 0x19, 0x00, 0x18, 0x19, 0x00, 0x18, 0x1a, 0x00, 0x18,
+    0x1a, 0x00, 0x18, 0x1b, 0x00, 0x18, 0x1c, 0x00, 0x18, 0x1c, 0x00, 0x18, 0x1d, 0x00, 0x18, 0x1e,
+    0x00, 0x18, 0x1e, 0x00, 0x18, 0x1f, 0x00, 0x18, 0x1f, 0x00, 0x18, 0x20, 0x00, 0x18, 0x21, 0x00,
+    0x18, 0x53, 0x00, 0xa0, 0xff, 0x8c, 0x2e, 0x00, 0x18, 0x2e, 0x00, 0x18, 0x2f, 0x00, 0x18, 0x30,
+    0x00, 0x18, 0x30, 0x00, 0x18, 0x31, 0x00, 0x18, 0x32, 0x00, 0x18, 0x32, 0x00, 0x18, 0x33, 0x00,
+    0x18, 0x33, 0x00, 0x18, 0x34, 0x00, 0x18, 0x35, 0x00, 0x18, 0x35, 0x00, 0x18, 0x42, 0xd7, 0xd7,
+    0x35, 0x85, 0x38, 0x00, 0x18, 0x38, 0x00, 0x18, 0x39, 0x00, 0x18, 0x3a, 0x00, 0x18, 0x3a, 0x00,
+    0x18, 0x3b, 0x00, 0x18, 0x94, 0x14, 0x00, 0x18, 0x14, 0x00, 0x18, 0x15, 0x00, 0x18, 0x15, 0x00,
+    0x18, 0x16, 0x00, 0x18, 0x17, 0x00, 0x18, 0x17, 0x00, 0x18, 0x18, 0x00, 0x18, 0x19, 0x00, 0x18,
+    0x19, 0x00, 0x18, 0x1a, 0x00, 0x18, 0x1a, 0x00, 0x18, 0x1b, 0x00, 0x18, 0x1c, 0x00, 0x18, 0x1c,
+    0x00, 0x18, 0x1d, 0x00, 0x18, 0x1e, 0x00, 0x18, 0x1e, 0x00, 0x18, 0x1f, 0x00, 0x18, 0x1f, 0x00,
+    0x18, 0x20, 0x00, 0x18, 0x55, 0x00, 0xa0, 0xff, 0x8b, 0x2e, 0x00, 0x18, 0x2f, 0x00, 0x18, 0x30,
+    0x00, 0x18, 0x30, 0x00, 0x18, 0x31, 0x00, 0x18, 0x32, 0x00, 0x18, 0x32, 0x00, 0x18, 0x33, 0x00,
+    0x18, 0x33, 0x00, 0x18, 0x34, 0x00, 0x18, 0x35, 0x00, 0x18, 0x35, 0x00, 0x18, 0x42, 0xff, 0xff,
+    0x3f, 0x85, 0x38, 0x00, 0x18, 0x38, 0x00, 0x18, 0x39, 0x00, 0x18, 0x3a, 0x00, 0x18, 0x3a, 0x00,
+    0x18, 0x3b, 0x00, 0x18, 0x94, 0x14, 0x00, 0x19, 0x14, 0x00, 0x19, 0x15, 0x00, 0x19, 0x15, 0x00,
+    0x19, 0x16, 0x00, 0x19, 0x17, 0x00, 0x19, 0x17, 0x00, 0x19, 0x18, 0x00, 0x19, 0x19, 0x00, 0x19,
+    0x19, 0x00, 0x19, 0x1a, 0x00, 0x19, 0x1a, 0x00, 0x19, 0x1b, 0x00, 0x19, 0x1c, 0x00, 0x19, 0x1c,
+    0x00, 0x19, 0x1d, 0x00, 0x19, 0x1e, 0x00, 0x19, 0x1e, 0x00, 0x19, 0x1f, 0x00, 0x19, 0x1f, 0x00,
+    0x19, 0x20, 0x00, 0x19, 0x55, 0x00, 0xa0, 0xff, 0x8b, 0x2e, 0x00, 0x19, 0x2f, 0x00, 0x19, 0x30,
+    0x00, 0x19, 0x30, 0x00, 0x19, 0x31, 0x00, 0x19, 0x32, 0x00, 0x19, 0x32, 0x00, 0x19, 0x33, 0x00,
+    0x19, 0x33, 0x00, 0x19, 0x34, 0x00, 0x19, 0x35, 0x00, 0x19, 0x35, 0x00, 0x19, 0x42, 0xff, 0xff,
+    0x3f, 0x85, 0x38, 0x00, 0x19, 0x38, 0x00, 0x19, 0x39, 0x00, 0x19, 0x3a, 0x00, 0x19, 0x3a, 0x00,
+    0x19, 0x3b, 0x00, 0x19, 0x95, 0x14, 0x00, 0x19, 0x14, 0x00, 0x19, 0x15, 0x00, 0x19, 0x15, 0x00,
+    0x19, 0x16, 0x00, 0x19, 0x17, 0x00, 0x19, 0x17, 0x00, 0x19, 0x18, 0x00, 0x19, 0x19, 0x00, 0x19,
+    0x19, 0x00, 0x19, 0x1a, 0x00, 0x19, 0x1a, 0x00, 0x19, 0x1b, 0x00, 0x19, 0x1c, 0x00, 0x19, 0x1c,
+    0x00, 0x19, 0x1d, 0x00, 0x19, 0x1e, 0x00, 0x19, 0x1e, 0x00, 0x19, 0x1f, 0x00, 0x19, 0x1f, 0x00,
+    0x19, 0x20, 0x00, 0x19, 0x21, 0x00, 0x19, 0x53, 0x00, 0xa0, 0xff, 0x8c, 0x2e, 0x00, 0x19, 0x2e,
+    0x00, 0x19, 0x2f, 0x00, 0x19, 0x30, 0x00, 0x19, 0x30, 0x00, 0x19, 0x31, 0x00, 0x19, 0x32, 0x00,
+    0x19, 0x32, 0x00, 0x19, 0x33, 0x00, 0x19, 0x33, 0x00, 0x19, 0x34, 0x00, 0x19, 0x35, 0x00, 0x19,
+    0x35, 0x00, 0x19, 0x42, 0xff, 0xff, 0x3f, 0x85, 0x38, 0x00, 0x19, 0x38, 0x00, 0x19, 0x39, 0x00,
+    0x19, 0x3a, 0x00, 0x19, 0x3a, 0x00, 0x19, 0x3b, 0x00, 0x19, 0x96, 0x14, 0x00, 0x19, 0x14, 0x00,
+    0x19, 0x15, 0x00, 0x19, 0x15, 0x00, 0x19, 0x16, 0x00, 0x19, 0x17, 0x00, 0x19, 0x17, 0x00, 0x19,
+    0x18, 0x00, 0x19, 0x19, 0x00, 0x19, 0x19, 0x00, 0x19, 0x1a, 0x00, 0x19, 0x1a, 0x00, 0x19, 0x1b,
+    0x00, 0x19, 0x1c, 0x00, 0x19, 0x1c, 0x00, 0x19, 0x1d, 0x00, 0x19, 0x1e, 0x00, 0x19, 0x1e, 0x00,
+    0x19, 0x1f, 0x00, 0x19, 0x1f, 0x00, 0x19, 0x20, 0x00, 0x19, 0x21, 0x00, 0x19, 0x21, 0x00, 0x19,
+    0x51, 0x00, 0xa0, 0xff, 0x96, 0x2d, 0x00, 0x19, 0x2e, 0x00, 0x19, 0x2e, 0x00, 0x19, 0x2f, 0x00,
+    0x19, 0x30, 0x00, 0x19, 0x30, 0x00, 0x19, 0x31, 0x00, 0x19, 0x32, 0x00, 0x19, 0x32, 0x00, 0x19,
+    0x33, 0x00, 0x19, 0x33, 0x00, 0x19, 0x34, 0x00, 0x19, 0x35, 0x00, 0x19, 0x35, 0x00, 0x19, 0x36,
+    0x00, 0x19, 0x37, 0x00, 0x19, 0x37, 0x00, 0x19, 0x38, 0x00, 0x19, 0x38, 0x00, 0x19, 0x39, 0x00,
+    0x19, 0x3a, 0x00, 0x19, 0x3a, 0x00, 0x19, 0x3b, 0x00, 0x19, 0x97, 0x14, 0x00, 0x1a, 0x14, 0x00,
+    0x1a, 0x15, 0x00, 0x1a, 0x15, 0x00, 0x1a, 0x16, 0x00, 0x1a, 0x17, 0x00, 0x1a, 0x17, 0x00, 0x1a,
+    0x18, 0x00, 0x1a, 0x19, 0x00, 0x1a, 0x19, 0x00, 0x1a, 0x1a, 0x00, 0x1a, 0x1a, 0x00, 0x1a, 0x1b,
+    0x00, 0x1a, 0x1c, 0x00, 0x1a, 0x1c, 0x00, 0x1a, 0x1d, 0x00, 0x1a, 0x1e, 0x00, 0x1a, 0x1e, 0x00,
+    0x1a, 0x1f, 0x00, 0x1a, 0x1f, 0x00, 0x1a, 0x20, 0x00, 0x1a, 0x21, 0x00, 0x1a, 0x21, 0x00, 0x1a,
+    0x22, 0x00, 0x1a, 0x4f, 0x00, 0xa0, 0xff, 0x97, 0x2d, 0x00, 0x1a, 0x2d, 0x00, 0x1a, 0x2e, 0x00,
+    0x1a, 0x2e, 0x00, 0x1a, 0x2f, 0x00, 0x1a, 0x30, 0x00, 0x1a, 0x30, 0x00, 0x1a, 0x31, 0x00, 0x1a,
+    0x32, 0x00, 0x1a, 0x32, 0x00, 0x1a, 0x33, 0x00, 0x1a, 0x33, 0x00, 0x1a, 0x34, 0x00, 0x1a, 0x35,
+    0x00, 0x1a, 0x35, 0x00, 0x1a, 0x36, 0x00, 0x1a, 0x37, 0x00, 0x1a, 0x37, 0x00, 0x1a, 0x38, 0x00,
+    0x1a, 0x38, 0x00, 0x1a, 0x39, 0x00, 0x1a, 0x3a, 0x00, 0x1a, 0x3a, 0x00, 0x1a, 0x3b, 0x00, 0x1a,
+    0x98, 0x14, 0x00, 0x1a, 0x14, 0x00, 0x1a, 0x15, 0x00, 0x1a, 0x15, 0x00, 0x1a, 0x16, 0x00, 0x1a,
+    0x17, 0x00, 0x1a, 0x17, 0x00, 0x1a, 0x18, 0x00, 0x1a, 0x19, 0x00, 0x1a, 0x19, 0x00, 0x1a, 0x1a,
+    0x00, 0x1a, 0x1a, 0x00, 0x1a, 0x1b, 0x00, 0x1a, 0x1c, 0x00, 0x1a, 0x1c, 0x00, 0x1a, 0x1d, 0x00,
+    0x1a, 0x1e, 0x00, 0x1a, 0x1e, 0x00, 0x1a, 0x1f, 0x00, 0x1a, 0x1f, 0x00, 0x1a, 0x20, 0x00, 0x1a,
+    0x21, 0x00, 0x1a, 0x21, 0x00, 0x1a, 0x22, 0x00, 0x1a, 0x23, 0x00, 0x1a, 0x4d, 0x00, 0xa0, 0xff,
+    0x98, 0x2c, 0x00, 0x1a, 0x2d, 0x00, 0x1a, 0x2d, 0x00, 0x1a, 0x2e, 0x00, 0x1a, 0x2e, 0x00, 0x1a,
+    0x2f, 0x00, 0x1a, 0x30, 0x00, 0x1a, 0x30, 0x00, 0x1a, 0x31, 0x00, 0x1a, 0x32, 0x00, 0x1a, 0x32,
+    0x00, 0x1a, 0x33, 0x00, 0x1a, 0x33, 0x00, 0x1a, 0x34, 0x00, 0x1a, 0x35, 0x00, 0x1a, 0x35, 0x00,
+    0x1a, 0x36, 0x00, 0x1a, 0x37, 0x00, 0x1a, 0x37, 0x00, 0x1a, 0x38, 0x00, 0x1a, 0x38, 0x00, 0x1a,
+    0x39, 0x00, 0x1a, 0x3a, 0x00, 0x1a, 0x3a, 0x00, 0x1a, 0x3b, 0x00, 0x1a, 0x99, 0x14, 0x00, 0x1b,
+    0x14, 0x00, 0x1b, 0x15, 0x00, 0x1b, 0x15, 0x00, 0x1b, 0x16, 0x00, 0x1b, 0x17, 0x00, 0x1b, 0x17,
+    0x00, 0x1b, 0x18, 0x00, 0x1b, 0x19, 0x00, 0x1b, 0x19, 0x00, 0x1b, 0x1a, 0x00, 0x1b, 0x1a, 0x00,
+    0x1b, 0x1b, 0x00, 0x1b, 0x1c, 0x00, 0x1b, 0x1c, 0x00, 0x1b, 0x1d, 0x00, 0x1b, 0x1e, 0x00, 0x1b,
+    0x1e, 0x00, 0x1b, 0x1f, 0x00, 0x1b, 0x1f, 0x00, 0x1b, 0x20, 0x00, 0x1b, 0x21, 0x00, 0x1b, 0x21,
+    0x00, 0x1b, 0x22, 0x00, 0x1b, 0x23, 0x00, 0x1b, 0x23, 0x00, 0x1b, 0x4b, 0x00, 0xa0, 0xff, 0x99,
+    0x2b, 0x00, 0x1b, 0x2c, 0x00, 0x1b, 0x2d, 0x00, 0x1b, 0x2d, 0x00, 0x1b, 0x2e, 0x00, 0x1b, 0x2e,
+    0x00, 0x1b, 0x2f, 0x00, 0x1b, 0x30, 0x00, 0x1b, 0x30, 0x00, 0x1b, 0x31, 0x00, 0x1b, 0x32, 0x00,
+    0x1b, 0x32, 0x00, 0x1b, 0x33, 0x00, 0x1b, 0x33, 0x00, 0x1b, 0x34, 0x00, 0x1b, 0x35, 0x00, 0x1b,
+    0x35, 0x00, 0x1b, 0x36, 0x00, 0x1b, 0x37, 0x00, 0x1b, 0x37, 0x00, 0x1b, 0x38, 0x00, 0x1b, 0x38,
+    0x00, 0x1b, 0x39, 0x00, 0x1b, 0x3a, 0x00, 0x1b, 0x3a, 0x00, 0x1b, 0x3b, 0x00, 0x1b, 0x9a, 0x14,
+    0x00, 0x1b, 0x14, 0x00, 0x1b, 0x15, 0x00, 0x1b, 0x15, 0x00, 0x1b, 0x16, 0x00, 0x1b, 0x17, 0x00,
+    0x1b, 0x17, 0x00, 0x1b, 0x18, 0x00, 0x1b, 0x19, 0x00, 0x1b, 0x19, 0x00, 0x1b, 0x1a, 0x00, 0x1b,
+    0x1a, 0x00, 0x1b, 0x1b, 0x00, 0x1b, 0x1c, 0x00, 0x1b, 0x1c, 0x00, 0x1b, 0x1d, 0x00, 0x1b, 0x1e,
+    0x00, 0x1b, 0x1e, 0x00, 0x1b, 0x1f, 0x00, 0x1b, 0x1f, 0x00, 0x1b, 0x20, 0x00, 0x1b, 0x21, 0x00,
+    0x1b, 0x21, 0x00, 0x1b, 0x22, 0x00, 0x1b, 0x23, 0x00, 0x1b, 0x23, 0x00, 0x1b, 0x24, 0x00, 0x1b,
+    0x49, 0x00, 0xa0, 0xff, 0x9a, 0x2b, 0x00, 0x1b, 0x2b, 0x00, 0x1b, 0x2c, 0x00, 0x1b, 0x2d, 0x00,
+    0x1b, 0x2d, 0x00, 0x1b, 0x2e, 0x00, 0x1b, 0x2e, 0x00, 0x1b, 0x2f, 0x00, 0x1b, 0x30, 0x00, 0x1b,
+    0x30, 0x00, 0x1b, 0x31, 0x00, 0x1b, 0x32, 0x00, 0x1b, 0x32, 0x00, 0x1b, 0x33, 0x00, 0x1b, 0x33,
+    0x00, 0x1b, 0x34, 0x00, 0x1b, 0x35, 0x00, 0x1b, 0x35, 0x00, 0x1b, 0x36, 0x00, 0x1b, 0x37, 0x00,
+    0x1b, 0x37, 0x00, 0x1b, 0x38, 0x00, 0x1b, 0x38, 0x00, 0x1b, 0x39, 0x00, 0x1b, 0x3a, 0x00, 0x1b,
+    0x3a, 0x00, 0x1b, 0x3b, 0x00, 0x1b, 0x9b, 0x14, 0x00, 0x1c, 0x14, 0x00, 0x1c, 0x15, 0x00, 0x1c,
+    0x15, 0x00, 0x1c, 0x16, 0x00, 0x1c, 0x17, 0x00, 0x1c, 0x17, 0x00, 0x1c, 0x18, 0x00, 0x1c, 0x19,
+    0x00, 0x1c, 0x19, 0x00, 0x1c, 0x1a, 0x00, 0x1c, 0x1a, 0x00, 0x1c, 0x1b, 0x00, 0x1c, 0x1c, 0x00,
+    0x1c, 0x1c, 0x00, 0x1c, 0x1d, 0x00, 0x1c, 0x1e, 0x00, 0x1c, 0x1e, 0x00, 0x1c, 0x1f, 0x00, 0x1c,
+    0x1f, 0x00, 0x1c, 0x20, 0x00, 0x1c, 0x21, 0x00, 0x1c, 0x21, 0x00, 0x1c, 0x22, 0x00, 0x1c, 0x23,
+    0x00, 0x1c, 0x23, 0x00, 0x1c, 0x24, 0x00, 0x1c, 0x24, 0x00, 0x1c, 0x47, 0x00, 0xa0, 0xff, 0x9b,
+    0x2a, 0x00, 0x1c, 0x2b, 0x00, 0x1c, 0x2b, 0x00, 0x1c, 0x2c, 0x00, 0x1c, 0x2d, 0x00, 0x1c, 0x2d,
+    0x00, 0x1c, 0x2e, 0x00, 0x1c, 0x2e, 0x00, 0x1c, 0x2f, 0x00, 0x1c, 0x30, 0x00, 0x1c, 0x30, 0x00,
+    0x1c, 0x31, 0x00, 0x1c, 0x32, 0x00, 0x1c, 0x32, 0x00, 0x1c, 0x33, 0x00, 0x1c, 0x33, 0x00, 0x1c,
+    0x34, 0x00, 0x1c, 0x35, 0x00, 0x1c, 0x35, 0x00, 0x1c, 0x36, 0x00, 0x1c, 0x37, 0x00, 0x1c, 0x37,
+    0x00, 0x1c, 0x38, 0x00, 0x1c, 0x38, 0x00, 0x1c, 0x39, 0x00, 0x1c, 0x3a, 0x00, 0x1c, 0x3a, 0x00,
+    0x1c, 0x3b, 0x00, 0x1c, 0x9c, 0x14, 0x00, 0x1c, 0x14, 0x00, 0x1c, 0x15, 0x00, 0x1c, 0x15, 0x00,
+    0x1c, 0x16, 0x00, 0x1c, 0x17, 0x00, 0x1c, 0x17, 0x00, 0x1c, 0x18, 0x00, 0x1c, 0x19, 0x00, 0x1c,
+    0x19, 0x00, 0x1c, 0x1a, 0x00, 0x1c, 0x1a, 0x00, 0x1c, 0x1b, 0x00, 0x1c, 0x1c, 0x00, 0x1c, 0x1c,
+    0x00, 0x1c, 0x1d, 0x00, 0x1c, 0x1e, 0x00, 0x1c, 0x1e, 0x00, 0x1c, 0x1f, 0x00, 0x1c, 0x1f, 0x00,
+    0x1c, 0x20, 0x00, 0x1c, 0x21, 0x00, 0x1c, 0x21, 0x00, 0x1c, 0x22, 0x00, 0x1c, 0x23, 0x00, 0x1c,
+    0x23, 0x00, 0x1c, 0x24, 0x00, 0x1c, 0x24, 0x00, 0x1c, 0x25, 0x00, 0x1c, 0x45, 0x00, 0xa0, 0xff,
+    0x9c, 0x29, 0x00, 0x1c, 0x2a, 0x00, 0x1c, 0x2b, 0x00, 0x1c, 0x2b, 0x00, 0x1c, 0x2c, 0x00, 0x1c,
+    0x2d, 0x00, 0x1c, 0x2d, 0x00, 0x1c, 0x2e, 0x00, 0x1c, 0x2e, 0x00, 0x1c, 0x2f, 0x00, 0x1c, 0x30,
+    0x00, 0x1c, 0x30, 0x00, 0x1c, 0x31, 0x00, 0x1c, 0x32, 0x00, 0x1c, 0x32, 0x00, 0x1c, 0x33, 0x00,
+    0x1c, 0x33, 0x00, 0x1c, 0x34, 0x00, 0x1c, 0x35, 0x00, 0x1c, 0x35, 0x00, 0x1c, 0x36, 0x00, 0x1c,
+    0x37, 0x00, 0x1c, 0x37, 0x00, 0x1c, 0x38, 0x00, 0x1c, 0x38, 0x00, 0x1c, 0x39, 0x00, 0x1c, 0x3a,
+    0x00, 0x1c, 0x3a, 0x00, 0x1c, 0x3b, 0x00, 0x1c, 0x9d, 0x14, 0x00, 0x1d, 0x14, 0x00, 0x1d, 0x15,
+    0x00, 0x1d, 0x15, 0x00, 0x1d, 0x16, 0x00, 0x1d, 0x17, 0x00, 0x1d, 0x17, 0x00, 0x1d, 0x18, 0x00,
+    0x1d, 0x19, 0x00, 0x1d, 0x19, 0x00, 0x1d, 0x1a, 0x00, 0x1d, 0x1a, 0x00, 0x1d, 0x1b, 0x00, 0x1d,
+    0x1c, 0x00, 0x1d, 0x1c, 0x00, 0x1d, 0x1d, 0x00, 0x1d, 0x1e, 0x00, 0x1d, 0x1e, 0x00, 0x1d, 0x1f,
+    0x00, 0x1d, 0x1f, 0x00, 0x1d, 0x20, 0x00, 0x1d, 0x21, 0x00, 0x1d, 0x21, 0x00, 0x1d, 0x22, 0x00,
+    0x1d, 0x23, 0x00, 0x1d, 0x23, 0x00, 0x1d, 0x24, 0x00, 0x1d, 0x24, 0x00, 0x1d, 0x25, 0x00, 0x1d,
+    0x26, 0x00, 0x1d, 0x43, 0x00, 0xa0, 0xff, 0x9d, 0x29, 0x00, 0x1d, 0x29, 0x00, 0x1d, 0x2a, 0x00,
+    0x1d, 0x2b, 0x00, 0x1d, 0x2b, 0x00, 0x1d, 0x2c, 0x00, 0x1d, 0x2d, 0x00, 0x1d, 0x2d, 0x00, 0x1d,
+    0x2e, 0x00, 0x1d, 0x2e, 0x00, 0x1d, 0x2f, 0x00, 0x1d, 0x30, 0x00, 0x1d, 0x30, 0x00, 0x1d, 0x31,
+    0x00, 0x1d, 0x32, 0x00, 0x1d, 0x32, 0x00, 0x1d, 0x33, 0x00, 0x1d, 0x33, 0x00, 0x1d, 0x34, 0x00,
+    0x1d, 0x35, 0x00, 0x1d, 0x35, 0x00, 0x1d, 0x36, 0x00, 0x1d, 0x37, 0x00, 0x1d, 0x37, 0x00, 0x1d,
+    0x38, 0x00, 0x1d, 0x38, 0x00, 0x1d, 0x39, 0x00, 0x1d, 0x3a, 0x00, 0x1d, 0x3a, 0x00, 0x1d, 0x3b,
+    0x00, 0x1d, 0xbf, 0x14, 0x00, 0x1d, 0x14, 0x00, 0x1d, 0x15, 0x00, 0x1d, 0x15, 0x00, 0x1d, 0x16,
+    0x00, 0x1d, 0x17, 0x00, 0x1d, 0x17, 0x00, 0x1d, 0x18, 0x00, 0x1d, 0x19, 0x00, 0x1d, 0x19, 0x00,
+    0x1d, 0x1a, 0x00, 0x1d, 0x1a, 0x00, 0x1d, 0x1b, 0x00, 0x1d, 0x1c, 0x00, 0x1d, 0x1c, 0x00, 0x1d,
+    0x1d, 0x00, 0x1d, 0x1e, 0x00, 0x1d, 0x1e, 0x00, 0x1d, 0x1f, 0x00, 0x1d, 0x1f, 0x00, 0x1d, 0x20,
+    0x00, 0x1d, 0x21, 0x00, 0x1d, 0x21, 0x00, 0x1d, 0x22, 0x00, 0x1d, 0x23, 0x00, 0x1d, 0x23, 0x00,
+    0x1d, 0x24, 0x00, 0x1d, 0x24, 0x00, 0x1d, 0x25, 0x00, 0x1d, 0x26, 0x00, 0x1d, 0x26, 0x00, 0x1d,
+    0x00, 0xa0, 0xff, 0x00, 0xa0, 0xff, 0x28, 0x00, 0x1d, 0x29, 0x00, 0x1d, 0x29, 0x00, 0x1d, 0x2a,
+    0x00, 0x1d, 0x2b, 0x00, 0x1d, 0x2b, 0x00, 0x1d, 0x2c, 0x00, 0x1d, 0x2d, 0x00, 0x1d, 0x2d, 0x00,
+    0x1d, 0x2e, 0x00, 0x1d, 0x2e, 0x00, 0x1d, 0x2f, 0x00, 0x1d, 0x30, 0x00, 0x1d, 0x30, 0x00, 0x1d,
+    0x31, 0x00, 0x1d, 0x32, 0x00, 0x1d, 0x32, 0x00, 0x1d, 0x33, 0x00, 0x1d, 0x33, 0x00, 0x1d, 0x34,
+    0x00, 0x1d, 0x35, 0x00, 0x1d, 0x35, 0x00, 0x1d, 0x36, 0x00, 0x1d, 0x37, 0x00, 0x1d, 0x37, 0x00,
+    0x1d, 0x38, 0x00, 0x1d, 0x38, 0x00, 0x1d, 0x39, 0x00, 0x1d, 0x3a, 0x00, 0x1d, 0x3a, 0x00, 0x1d,
+    0x3b, 0x00, 0x1d, 0xbf, 0x14, 0x00, 0x1e, 0x14, 0x00, 0x1e, 0x15, 0x00, 0x1e, 0x15, 0x00, 0x1e,
+    0x16, 0x00, 0x1e, 0x17, 0x00, 0x1e, 0x17, 0x00, 0x1e, 0x18, 0x00, 0x1e, 0x19, 0x00, 0x1e, 0x19,
+    0x00, 0x1e, 0x1a, 0x00, 0x1e, 0x1a, 0x00, 0x1e, 0x1b, 0x00, 0x1e, 0x1c, 0x00, 0x1e, 0x1c, 0x00,
+    0x1e, 0x1d, 0x00, 0x1e, 0x1e, 0x00, 0x1e, 0x1e, 0x00, 0x1e, 0x1f, 0x00, 0x1e, 0x1f, 0x00, 0x1e,
+    0x20, 0x00, 0x1e, 0x21, 0x00, 0x1e, 0x21, 0x00, 0x1e, 0x22, 0x00, 0x1e, 0x23, 0x00, 0x1e, 0x23,
+    0x00, 0x1e, 0x24, 0x00, 0x1e, 0x24, 0x00, 0x1e, 0x25, 0x00, 0x1e, 0x26, 0x00, 0x1e, 0x26, 0x00,
+    0x1e, 0x27, 0x00, 0x1e, 0x28, 0x00, 0x1e, 0x28, 0x00, 0x1e, 0x29, 0x00, 0x1e, 0x29, 0x00, 0x1e,
+    0x2a, 0x00, 0x1e, 0x2b, 0x00, 0x1e, 0x2b, 0x00, 0x1e, 0x2c, 0x00, 0x1e, 0x2d, 0x00, 0x1e, 0x2d,
+    0x00, 0x1e, 0x2e, 0x00, 0x1e, 0x2e, 0x00, 0x1e, 0x2f, 0x00, 0x1e, 0x30, 0x00, 0x1e, 0x30, 0x00,
+    0x1e, 0x31, 0x00, 0x1e, 0x32, 0x00, 0x1e, 0x32, 0x00, 0x1e, 0x33, 0x00, 0x1e, 0x33, 0x00, 0x1e,
+    0x34, 0x00, 0x1e, 0x35, 0x00, 0x1e, 0x35, 0x00, 0x1e, 0x36, 0x00, 0x1e, 0x37, 0x00, 0x1e, 0x37,
+    0x00, 0x1e, 0x38, 0x00, 0x1e, 0x38, 0x00, 0x1e, 0x39, 0x00, 0x1e, 0x3a, 0x00, 0x1e, 0x3a, 0x00,
+    0x1e, 0x3b, 0x00, 0x1e, 0xbf, 0x14, 0x00, 0x1e, 0x14, 0x00, 0x1e, 0x15, 0x00, 0x1e, 0x15, 0x00,
+    0x1e, 0x16, 0x00, 0x1e, 0x17, 0x00, 0x1e, 0x17, 0x00, 0x1e, 0x18, 0x00, 0x1e, 0x19, 0x00, 0x1e,
+    0x19, 0x00, 0x1e, 0x1a, 0x00, 0x1e, 0x1a, 0x00, 0x1e, 0x1b, 0x00, 0x1e, 0x1c, 0x00, 0x1e, 0x1c,
+    0x00, 0x1e, 0x1d, 0x00, 0x1e, 0x1e, 0x00, 0x1e, 0x1e, 0x00, 0x1e, 0x1f, 0x00, 0x1e, 0x1f, 0x00,
+    0x1e, 0x20, 0x00, 0x1e, 0x21, 0x00, 0x1e, 0x21, 0x00, 0x1e, 0x22, 0x00, 0x1e, 0x23, 0x00, 0x1e,
+    0x23, 0x00, 0x1e, 0x24, 0x00, 0x1e, 0x24, 0x00, 0x1e, 0x25, 0x00, 0x1e, 0x26, 0x00, 0x1e, 0x26,
+    0x00, 0x1e, 0x27, 0x00, 0x1e, 0x28, 0x00, 0x1e, 0x28, 0x00, 0x1e, 0x29, 0x00, 0x1e, 0x29, 0x00,
+    0x1e, 0x2a, 0x00, 0x1e, 0x2b, 0x00, 0x1e, 0x2b, 0x00, 0x1e, 0x2c, 0x00, 0x1e, 0x2d, 0x00, 0x1e,
+    0x2d, 0x00, 0x1e, 0x2e, 0x00, 0x1e, 0x2e, 0x00, 0x1e, 0x2f, 0x00, 0x1e, 0x30, 0x00, 0x1e, 0x30,
+    0x00, 0x1e, 0x31, 0x00, 0x1e, 0x32, 0x00, 0x1e, 0x32, 0x00, 0x1e, 0x33, 0x00, 0x1e, 0x33, 0x00,
+    0x1e, 0x34, 0x00, 0x1e, 0x35, 0x00, 0x1e, 0x35, 0x00, 0x1e, 0x36, 0x00, 0x1e, 0x37, 0x00, 0x1e,
+    0x37, 0x00, 0x1e, 0x38, 0x00, 0x1e, 0x38, 0x00, 0x1e, 0x39, 0x00, 0x1e, 0x3a, 0x00, 0x1e, 0x3a,
+    0x00, 0x1e, 0x3b, 0x00, 0x1e, 0xbf, 0x14, 0x00, 0x1f, 0x14, 0x00, 0x1f, 0x15, 0x00, 0x1f, 0x15,
+    0x00, 0x1f, 0x16, 0x00, 0x1f, 0x17, 0x00, 0x1f, 0x17, 0x00, 0x1f, 0x18, 0x00, 0x1f, 0x19, 0x00,
+    0x1f, 0x19, 0x00, 0x1f, 0x1a, 0x00, 0x1f, 0x1a, 0x00, 0x1f, 0x1b, 0x00, 0x1f, 0x1c, 0x00, 0x1f,
+    0x1c, 0x00, 0x1f, 0x1d, 0x00, 0x1f, 0x1e, 0x00, 0x1f, 0x1e, 0x00, 0x1f, 0x1f, 0x00, 0x1f, 0x1f,
+    0x00, 0x1f, 0x20, 0x00, 0x1f, 0x21, 0x00, 0x1f, 0x21, 0x00, 0x1f, 0x22, 0x00, 0x1f, 0x23, 0x00,
+    0x1f, 0x23, 0x00, 0x1f, 0x24, 0x00, 0x1f, 0x24, 0x00, 0x1f, 0x25, 0x00, 0x1f, 0x26, 0x00, 0x1f,
+    0x26, 0x00, 0x1f, 0x27, 0x00, 0x1f, 0x28, 0x00, 0x1f, 0x28, 0x00, 0x1f, 0x29, 0x00, 0x1f, 0x29,
+    0x00, 0x1f, 0x2a, 0x00, 0x1f, 0x2b, 0x00, 0x1f, 0x2b, 0x00, 0x1f, 0x2c, 0x00, 0x1f, 0x2d, 0x00,
+    0x1f, 0x2d, 0x00, 0x1f, 0x2e, 0x00, 0x1f, 0x2e, 0x00, 0x1f, 0x2f, 0x00, 0x1f, 0x30, 0x00, 0x1f,
+    0x30, 0x00, 0x1f, 0x31, 0x00, 0x1f, 0x32, 0x00, 0x1f, 0x32, 0x00, 0x1f, 0x33, 0x00, 0x1f, 0x33,
+    0x00, 0x1f, 0x34, 0x00, 0x1f, 0x35, 0x00, 0x1f, 0x35, 0x00, 0x1f, 0x36, 0x00, 0x1f, 0x37, 0x00,
+    0x1f, 0x37, 0x00, 0x1f, 0x38, 0x00, 0x1f, 0x38, 0x00, 0x1f, 0x39, 0x00, 0x1f, 0x3a, 0x00, 0x1f,
+    0x3a, 0x00, 0x1f, 0x3b, 0x00, 0x1f, 0xbf, 0x14, 0x00, 0x1f, 0x14, 0x00, 0x1f, 0x15, 0x00, 0x1f,
+    0x15, 0x00, 0x1f, 0x16, 0x00, 0x1f, 0x17, 0x00, 0x1f, 0x17, 0x00, 0x1f, 0x18, 0x00, 0x1f, 0x19,
+    0x00, 0x1f, 0x19, 0x00, 0x1f, 0x1a, 0x00, 0x1f, 0x1a, 0x00, 0x1f, 0x1b, 0x00, 0x1f, 0x1c, 0x00,
+    0x1f, 0x1c, 0x00, 0x1f, 0x1d, 0x00, 0x1f, 0x1e, 0x00, 0x1f, 0x1e, 0x00, 0x1f, 0x1f, 0x00, 0x1f,
+    0x1f, 0x00, 0x1f, 0x20, 0x00, 0x1f, 0x21, 0x00, 0x1f, 0x21, 0x00, 0x1f, 0x22, 0x00, 0x1f, 0x23,
+    0x00, 0x1f, 0x23, 0x00, 0x1f, 0x24, 0x00, 0x1f, 0x24, 0x00, 0x1f, 0x25, 0x00, 0x1f, 0x26, 0x00,
+    0x1f, 0x26, 0x00, 0x1f, 0x27, 0x00, 0x1f, 0x28, 0x00, 0x1f, 0x28, 0x00, 0x1f, 0x29, 0x00, 0x1f,
+    0x29, 0x00, 0x1f, 0x2a, 0x00, 0x1f, 0x2b, 0x00, 0x1f, 0x2b, 0x00, 0x1f, 0x2c, 0x00, 0x1f, 0x2d,
+    0x00, 0x1f, 0x2d, 0x00, 0x1f, 0x2e, 0x00, 0x1f, 0x2e, 0x00, 0x1f, 0x2f, 0x00, 0x1f, 0x30, 0x00,
+    0x1f, 0x30, 0x00, 0x1f, 0x31, 0x00, 0x1f, 0x32, 0x00, 0x1f, 0x32, 0x00, 0x1f, 0x33, 0x00, 0x1f,
+    0x33, 0x00, 0x1f, 0x34, 0x00, 0x1f, 0x35, 0x00, 0x1f, 0x35, 0x00, 0x1f, 0x36, 0x00, 0x1f, 0x37,
+    0x00, 0x1f, 0x37, 0x00, 0x1f, 0x38, 0x00, 0x1f, 0x38, 0x00, 0x1f, 0x39, 0x00, 0x1f, 0x3a, 0x00,
+    0x1f, 0x3a, 0x00, 0x1f, 0x3b, 0x00, 0x1f, 0xbf, 0x14, 0x00, 0x20, 0x14, 0x00, 0x20, 0x15, 0x00,
+    0x20, 0x15, 0x00, 0x20, 0x16, 0x00, 0x20, 0x17, 0x00, 0x20, 0x17, 0x00, 0x20, 0x18, 0x00, 0x20,
+    0x19, 0x00, 0x20, 0x19, 0x00, 0x20, 0x1a, 0x00, 0x20, 0x1a, 0x00, 0x20, 0x1b, 0x00, 0x20, 0x1c,
+    0x00, 0x20, 0x1c, 0x00, 0x20, 0x1d, 0x00, 0x20, 0x1e, 0x00, 0x20, 0x1e, 0x00, 0x20, 0x1f, 0x00,
+    0x20, 0x1f, 0x00, 0x20, 0x20, 0x00, 0x20, 0x21, 0x00, 0x20, 0x21, 0x00, 0x20, 0x22, 0x00, 0x20,
+    0x23, 0x00, 0x20, 0x23, 0x00, 0x20, 0x24, 0x00, 0x20, 0x24, 0x00, 0x20, 0x25, 0x00, 0x20, 0x26,
+    0x00, 0x20, 0x26, 0x00, 0x20, 0x27, 0x00, 0x20, 0x28, 0x00, 0x20, 0x28, 0x00, 0x20, 0x29, 0x00,
+    0x20, 0x29, 0x00, 0x20, 0x2a, 0x00, 0x20, 0x2b, 0x00, 0x20, 0x2b, 0x00, 0x20, 0x2c, 0x00, 0x20,
+    0x2d, 0x00, 0x20, 0x2d, 0x00, 0x20, 0x2e, 0x00, 0x20, 0x2e, 0x00, 0x20, 0x2f, 0x00, 0x20, 0x30,
+    0x00, 0x20, 0x30, 0x00, 0x20, 0x31, 0x00, 0x20, 0x32, 0x00, 0x20, 0x32, 0x00, 0x20, 0x33, 0x00,
+    0x20, 0x33, 0x00, 0x20, 0x34, 0x00, 0x20, 0x35, 0x00, 0x20, 0x35, 0x00, 0x20, 0x36, 0x00, 0x20,
+    0x37, 0x00, 0x20, 0x37, 0x00, 0x20, 0x38, 0x00, 0x20, 0x38, 0x00, 0x20, 0x39, 0x00, 0x20, 0x3a,
+    0x00, 0x20, 0x3a, 0x00, 0x20, 0x3b, 0x00, 0x20, 0xbf, 0x14, 0x00, 0x20, 0x14, 0x00, 0x20, 0x15,
+    0x00, 0x20, 0x15, 0x00, 0x20, 0x16, 0x00, 0x20, 0x17, 0x00, 0x20, 0x17, 0x00, 0x20, 0x18, 0x00,
+    0x20, 0x19, 0x00, 0x20, 0x19, 0x00, 0x20, 0x1a, 0x00, 0x20, 0x1a, 0x00, 0x20, 0x1b, 0x00, 0x20,
+    0x1c, 0x00, 0x20, 0x1c, 0x00, 0x20, 0x1d, 0x00, 0x20, 0x1e, 0x00, 0x20, 0x1e, 0x00, 0x20, 0x1f,
+    0x00, 0x20, 0x1f, 0x00, 0x20, 0x20, 0x00, 0x20, 0x21, 0x00, 0x20, 0x21, 0x00, 0x20, 0x22, 0x00,
+    0x20, 0x23, 0x00, 0x20, 0x23, 0x00, 0x20, 0x24, 0x00, 0x20, 0x24, 0x00, 0x20, 0x25, 0x00, 0x20,
+    0x26, 0x00, 0x20, 0x26, 0x00, 0x20, 0x27, 0x00, 0x20, 0x28, 0x00, 0x20, 0x28, 0x00, 0x20, 0x29,
+    0x00, 0x20, 0x29, 0x00, 0x20, 0x2a, 0x00, 0x20, 0x2b, 0x00, 0x20, 0x2b, 0x00, 0x20, 0x2c, 0x00,
+    0x20, 0x2d, 0x00, 0x20, 0x2d, 0x00, 0x20, 0x2e, 0x00, 0x20, 0x2e, 0x00, 0x20, 0x2f, 0x00, 0x20,
+    0x30, 0x00, 0x20, 0x30, 0x00, 0x20, 0x31, 0x00, 0x20, 0x32, 0x00, 0x20, 0x32, 0x00, 0x20, 0x33,
+    0x00, 0x20, 0x33, 0x00, 0x20, 0x34, 0x00, 0x20, 0x35, 0x00, 0x20, 0x35, 0x00, 0x20, 0x36, 0x00,
+    0x20, 0x37, 0x00, 0x20, 0x37, 0x00, 0x20, 0x38, 0x00, 0x20, 0x38, 0x00, 0x20, 0x39, 0x00, 0x20,
+    0x3a, 0x00, 0x20, 0x3a, 0x00, 0x20, 0x3b, 0x00, 0x20, 0xbf, 0x14, 0x00, 0x20, 0x14, 0x00, 0x20,
+    0x15, 0x00, 0x20, 0x15, 0x00, 0x20, 0x16, 0x00, 0x20, 0x17, 0x00, 0x20, 0x17, 0x00, 0x20, 0x18,
+    0x00, 0x20, 0x19, 0x00, 0x20, 0x19, 0x00, 0x20, 0x1a, 0x00, 0x20, 0x1a, 0x00, 0x20, 0x1b, 0x00,
+    0x20, 0x1c, 0x00, 0x20, 0x1c, 0x00, 0x20, 0x1d, 0x00, 0x20, 0x1e, 0x00, 0x20, 0x1e, 0x00, 0x20,
+    0x1f, 0x00, 0x20, 0x1f, 0x00, 0x20, 0x20, 0x00, 0x20, 0x21, 0x00, 0x20, 0x21, 0x00, 0x20, 0x22,
+    0x00, 0x20, 0x23, 0x00, 0x20, 0x23, 0x00, 0x20, 0x24, 0x00, 0x20, 0x24, 0x00, 0x20, 0x25, 0x00,
+    0x20, 0x26, 0x00, 0x20, 0x26, 0x00, 0x20, 0x27, 0x00, 0x20, 0x28, 0x00, 0x20, 0x28, 0x00, 0x20,
+    0x29, 0x00, 0x20, 0x29, 0x00, 0x20, 0x2a, 0x00, 0x20, 0x2b, 0x00, 0x20, 0x2b, 0x00, 0x20, 0x2c,
+    0x00, 0x20, 0x2d, 0x00, 0x20, 0x2d, 0x00, 0x20, 0x2e, 0x00, 0x20, 0x2e, 0x00, 0x20, 0x2f, 0x00,
+    0x20, 0x30, 0x00, 0x20, 0x30, 0x00, 0x20, 0x31, 0x00, 0x20, 0x32, 0x00, 0x20, 0x32, 0x00, 0x20,
+    0x33, 0x00, 0x20, 0x33, 0x00, 0x20, 0x34, 0x00, 0x20, 0x35, 0x00, 0x20, 0x35, 0x00, 0x20, 0x36,
+    0x00, 0x20, 0x37, 0x00, 0x20, 0x37, 0x00, 0x20, 0x38, 0x00, 0x20, 0x38, 0x00, 0x20, 0x39, 0x00,
+    0x20, 0x3a, 0x00, 0x20, 0x3a, 0x00, 0x20, 0x3b, 0x00, 0x20, 0xbf, 0x14, 0x00, 0x21, 0x14, 0x00,
+    0x21, 0x15, 0x00, 0x21, 0x15, 0x00, 0x21, 0x16, 0x00, 0x21, 0x17, 0x00, 0x21, 0x17, 0x00, 0x21,
+    0x18, 0x00, 0x21, 0x19, 0x00, 0x21, 0x19, 0x00, 0x21, 0x1a, 0x00, 0x21, 0x1a, 0x00, 0x21, 0x1b,
+    0x00, 0x21, 0x1c, 0x00, 0x21, 0x1c, 0x00, 0x21, 0x1d, 0x00, 0x21, 0x1e, 0x00, 0x21, 0x1e, 0x00,
+    0x21, 0x1f, 0x00, 0x21, 0x1f, 0x00, 0x21, 0x20, 0x00, 0x21, 0x21, 0x00, 0x21, 0x21, 0x00, 0x21,
+    0x22, 0x00, 0x21, 0x23, 0x00, 0x21, 0x23, 0x00, 0x21, 0x24, 0x00, 0x21, 0x24, 0x00, 0x21, 0x25,
+    0x00, 0x21, 0x26, 0x00, 0x21, 0x26, 0x00, 0x21, 0x27, 0x00, 0x21, 0x28, 0x00, 0x21, 0x28, 0x00,
+    0x21, 0x29, 0x00, 0x21, 0x29, 0x00, 0x21, 0x2a, 0x00, 0x21, 0x2b, 0x00, 0x21, 0x2b, 0x00, 0x21,
+    0x2c, 0x00, 0x21, 0x2d, 0x00, 0x21, 0x2d, 0x00, 0x21, 0x2e, 0x00, 0x21, 0x2e, 0x00, 0x21, 0x2f,
+    0x00, 0x21, 0x30, 0x00, 0x21, 0x30, 0x00, 0x21, 0x31, 0x00, 0x21, 0x32, 0x00, 0x21, 0x32, 0x00,
+    0x21, 0x33, 0x00, 0x21, 0x33, 0x00, 0x21, 0x34, 0x00, 0x21, 0x35, 0x00, 0x21, 0x35, 0x00, 0x21,
+    0x36, 0x00, 0x21, 0x37, 0x00, 0x21, 0x37, 0x00, 0x21, 0x38, 0x00, 0x21, 0x38, 0x00, 0x21, 0x39,
+    0x00, 0x21, 0x3a, 0x00, 0x21, 0x3a, 0x00, 0x21, 0x3b, 0x00, 0x21, 0xbf, 0x14, 0x00, 0x21, 0x14,
+    0x00, 0x21, 0x15, 0x00, 0x21, 0x15, 0x00, 0x21, 0x16, 0x00, 0x21, 0x17, 0x00, 0x21, 0x17, 0x00,
+    0x21, 0x18, 0x00, 0x21, 0x19, 0x00, 0x21, 0x19, 0x00, 0x21, 0x1a, 0x00, 0x21, 0x1a, 0x00, 0x21,
+    0x1b, 0x00, 0x21, 0x1c, 0x00, 0x21, 0x1c, 0x00, 0x21, 0x1d, 0x00, 0x21, 0x1e, 0x00, 0x21, 0x1e,
+    0x00, 0x21, 0x1f, 0x00, 0x21, 0x1f, 0x00, 0x21, 0x20, 0x00, 0x21, 0x21, 0x00, 0x21, 0x21, 0x00,
+    0x21, 0x22, 0x00, 0x21, 0x23, 0x00, 0x21, 0x23, 0x00, 0x21, 0x24, 0x00, 0x21, 0x24, 0x00, 0x21,
+    0x25, 0x00, 0x21, 0x26, 0x00, 0x21, 0x26, 0x00, 0x21, 0x27, 0x00, 0x21, 0x28, 0x00, 0x21, 0x28,
+    0x00, 0x21, 0x29, 0x00, 0x21, 0x29, 0x00, 0x21, 0x2a, 0x00, 0x21, 0x2b, 0x00, 0x21, 0x2b, 0x00,
+    0x21, 0x2c, 0x00, 0x21, 0x2d, 0x00, 0x21, 0x2d, 0x00, 0x21, 0x2e, 0x00, 0x21, 0x2e, 0x00, 0x21,
+    0x2f, 0x00, 0x21, 0x30, 0x00, 0x21, 0x30, 0x00, 0x21, 0x31, 0x00, 0x21, 0x32, 0x00, 0x21, 0x32,
+    0x00, 0x21, 0x33, 0x00, 0x21, 0x33, 0x00, 0x21, 0x34, 0x00, 0x21, 0x35, 0x00, 0x21, 0x35, 0x00,
+    0x21, 0x36, 0x00, 0x21, 0x37, 0x00, 0x21, 0x37, 0x00, 0x21, 0x38, 0x00, 0x21, 0x38, 0x00, 0x21,
+    0x39, 0x00, 0x21, 0x3a, 0x00, 0x21, 0x3a, 0x00, 0x21, 0x3b, 0x00, 0x21, 0xbf, 0x14, 0x00, 0x22,
+    0x14, 0x00, 0x22, 0x15, 0x00, 0x22, 0x15, 0x00, 0x22, 0x16, 0x00, 0x22, 0x17, 0x00, 0x22, 0x17,
+    0x00, 0x22, 0x18, 0x00, 0x22, 0x19, 0x00, 0x22, 0x19, 0x00, 0x22, 0x1a, 0x00, 0x22, 0x1a, 0x00,
+    0x22, 0x1b, 0x00, 0x22, 0x1c, 0x00, 0x22, 0x1c, 0x00, 0x22, 0x1d, 0x00, 0x22, 0x1e, 0x00, 0x22,
+    0x1e, 0x00, 0x22, 0x1f, 0x00, 0x22, 0x1f, 0x00, 0x22, 0x20, 0x00, 0x22, 0x21, 0x00, 0x22, 0x21,
+    0x00, 0x22, 0x22, 0x00, 0x22, 0x23, 0x00, 0x22, 0x23, 0x00, 0x22, 0x24, 0x00, 0x22, 0x24, 0x00,
+    0x22, 0x25, 0x00, 0x22, 0x26, 0x00, 0x22, 0x26, 0x00, 0x22, 0x27, 0x00, 0x22, 0x28, 0x00, 0x22,
+    0x28, 0x00, 0x22, 0x29, 0x00, 0x22, 0x29, 0x00, 0x22, 0x2a, 0x00, 0x22, 0x2b, 0x00, 0x22, 0x2b,
+    0x00, 0x22, 0x2c, 0x00, 0x22, 0x2d, 0x00, 0x22, 0x2d, 0x00, 0x22, 0x2e, 0x00, 0x22, 0x2e, 0x00,
+    0x22, 0x2f, 0x00, 0x22, 0x30, 0x00, 0x22, 0x30, 0x00, 0x22, 0x31, 0x00, 0x22, 0x32, 0x00, 0x22,
+    0x32, 0x00, 0x22, 0x33, 0x00, 0x22, 0x33, 0x00, 0x22, 0x34, 0x00, 0x22, 0x35, 0x00, 0x22, 0x35,
+    0x00, 0x22, 0x36, 0x00, 0x22, 0x37, 0x00, 0x22, 0x37, 0x00, 0x22, 0x38, 0x00, 0x22, 0x38, 0x00,
+    0x22, 0x39, 0x00, 0x22, 0x3a, 0x00, 0x22, 0x3a, 0x00, 0x22, 0x3b, 0x00, 0x22, 0xbf, 0x14, 0x00,
+    0x22, 0x14, 0x00, 0x22, 0x15, 0x00, 0x22, 0x15, 0x00, 0x22, 0x16, 0x00, 0x22, 0x17, 0x00, 0x22,
+    0x17, 0x00, 0x22, 0x18, 0x00, 0x22, 0x19, 0x00, 0x22, 0x19, 0x00, 0x22, 0x1a, 0x00, 0x22, 0x1a,
+    0x00, 0x22, 0x1b, 0x00, 0x22, 0x1c, 0x00, 0x22, 0x1c, 0x00, 0x22, 0x1d, 0x00, 0x22, 0x1e, 0x00,
+    0x22, 0x1e, 0x00, 0x22, 0x1f, 0x00, 0x22, 0x1f, 0x00, 0x22, 0x20, 0x00, 0x22, 0x21, 0x00, 0x22,
+    0x21, 0x00, 0x22, 0x22, 0x00, 0x22, 0x23, 0x00, 0x22, 0x23, 0x00, 0x22, 0x24, 0x00, 0x22, 0x24,
+    0x00, 0x22, 0x25, 0x00, 0x22, 0x26, 0x00, 0x22, 0x26, 0x00, 0x22, 0x27, 0x00, 0x22, 0x28, 0x00,
+    0x22, 0x28, 0x00, 0x22, 0x29, 0x00, 0x22, 0x29, 0x00, 0x22, 0x2a, 0x00, 0x22, 0x2b, 0x00, 0x22,
+    0x2b, 0x00, 0x22, 0x2c, 0x00, 0x22, 0x2d, 0x00, 0x22, 0x2d, 0x00, 0x22, 0x2e, 0x00, 0x22, 0x2e,
+    0x00, 0x22, 0x2f, 0x00, 0x22, 0x30, 0x00, 0x22, 0x30, 0x00, 0x22, 0x31, 0x00, 0x22, 0x32, 0x00,
+    0x22, 0x32, 0x00, 0x22, 0x33, 0x00, 0x22, 0x33, 0x00, 0x22, 0x34, 0x00, 0x22, 0x35, 0x00, 0x22,
+    0x35, 0x00, 0x22, 0x36, 0x00, 0x22, 0x37, 0x00, 0x22, 0x37, 0x00, 0x22, 0x38, 0x00, 0x22, 0x38,
+    0x00, 0x22, 0x39, 0x00, 0x22, 0x3a, 0x00, 0x22, 0x3a, 0x00, 0x22, 0x3b, 0x00, 0x22, 0xbf, 0x14,
+    0x00, 0x23, 0x14, 0x00, 0x23, 0x15, 0x00, 0x23, 0x15, 0x00, 0x23, 0x16, 0x00, 0x23, 0x17, 0x00,
+    0x23, 0x17, 0x00, 0x23, 0x18, 0x00, 0x23, 0x19, 0x00, 0x23, 0x19, 0x00, 0x23, 0x1a, 0x00, 0x23,
+    0x1a, 0x00, 0x23, 0x1b, 0x00, 0x23, 0x1c, 0x00, 0x23, 0x1c, 0x00, 0x23, 0x1d, 0x00, 0x23, 0x1e,
+    0x00, 0x23, 0x1e, 0x00, 0x23, 0x1f, 0x00, 0x23, 0x1f, 0x00, 0x23, 0x20, 0x00, 0x23, 0x21, 0x00,
+    0x23, 0x21, 0x00, 0x23, 0x22, 0x00, 0x23, 0x23, 0x00, 0x23, 0x23, 0x00, 0x23, 0x24, 0x00, 0x23,
+    0x24, 0x00, 0x23, 0x25, 0x00, 0x23, 0x26, 0x00, 0x23, 0x26, 0x00, 0x23, 0x27, 0x00, 0x23, 0x28,
+    0x00, 0x23, 0x28, 0x00, 0x23, 0x29, 0x00, 0x23, 0x29, 0x00, 0x23, 0x2a, 0x00, 0x23, 0x2b, 0x00,
+    0x23, 0x2b, 0x00, 0x23, 0x2c, 0x00, 0x23, 0x2d, 0x00, 0x23, 0x2d, 0x00, 0x23, 0x2e, 0x00, 0x23,
+    0x2e, 0x00, 0x23, 0x2f, 0x00, 0x23, 0x30, 0x00, 0x23, 0x30, 0x00, 0x23, 0x31, 0x00, 0x23, 0x32,
+    0x00, 0x23, 0x32, 0x00, 0x23, 0x33, 0x00, 0x23, 0x33, 0x00, 0x23, 0x34, 0x00, 0x23, 0x35, 0x00,
+    0x23, 0x35, 0x00, 0x23, 0x36, 0x00, 0x23, 0x37, 0x00, 0x23, 0x37, 0x00, 0x23, 0x38, 0x00, 0x23,
+    0x38, 0x00, 0x23, 0x39, 0x00, 0x23, 0x3a, 0x00, 0x23, 0x3a, 0x00, 0x23, 0x3b, 0x00, 0x23, 0xbf,
+    0x14, 0x00, 0x23, 0x14, 0x00, 0x23, 0x15, 0x00, 0x23, 0x15, 0x00, 0x23, 0x16, 0x00, 0x23, 0x17,
+    0x00, 0x23, 0x17, 0x00, 0x23, 0x18, 0x00, 0x23, 0x19, 0x00, 0x23, 0x19, 0x00, 0x23, 0x1a, 0x00,
+    0x23, 0x1a, 0x00, 0x23, 0x1b, 0x00, 0x23, 0x1c, 0x00, 0x23, 0x1c, 0x00, 0x23, 0x1d, 0x00, 0x23,
+    0x1e, 0x00, 0x23, 0x1e, 0x00, 0x23, 0x1f, 0x00, 0x23, 0x1f, 0x00, 0x23, 0x20, 0x00, 0x23, 0x21,
+    0x00, 0x23, 0x21, 0x00, 0x23, 0x22, 0x00, 0x23, 0x23, 0x00, 0x23, 0x23, 0x00, 0x23, 0x24, 0x00,
+    0x23, 0x24, 0x00, 0x23, 0x25, 0x00, 0x23, 0x26, 0x00, 0x23, 0x26, 0x00, 0x23, 0x27, 0x00, 0x23,
+    0x28, 0x00, 0x23, 0x28, 0x00, 0x23, 0x29, 0x00, 0x23, 0x29, 0x00, 0x23, 0x2a, 0x00, 0x23, 0x2b,
+    0x00, 0x23, 0x2b, 0x00, 0x23, 0x2c, 0x00, 0x23, 0x2d, 0x00, 0x23, 0x2d, 0x00, 0x23, 0x2e, 0x00,
+    0x23, 0x2e, 0x00, 0x23, 0x2f, 0x00, 0x23, 0x30, 0x00, 0x23, 0x30, 0x00, 0x23, 0x31, 0x00, 0x23,
+    0x32, 0x00, 0x23, 0x32, 0x00, 0x23, 0x33, 0x00, 0x23, 0x33, 0x00, 0x23, 0x34, 0x00, 0x23, 0x35,
+    0x00, 0x23, 0x35, 0x00, 0x23, 0x36, 0x00, 0x23, 0x37, 0x00, 0x23, 0x37, 0x00, 0x23, 0x38, 0x00,
+    0x23, 0x38, 0x00, 0x23, 0x39, 0x00, 0x23, 0x3a, 0x00, 0x23, 0x3a, 0x00, 0x23, 0x3b, 0x00, 0x23,
+    0xbf, 0x14, 0x00, 0x24, 0x14, 0x00, 0x24, 0x15, 0x00, 0x24, 0x15, 0x00, 0x24, 0x16, 0x00, 0x24,
+    0x17, 0x00, 0x24, 0x17, 0x00, 0x24, 0x18, 0x00, 0x24, 0x19, 0x00, 0x24, 0x19, 0x00, 0x24, 0x1a,
+    0x00, 0x24, 0x1a, 0x00, 0x24, 0x1b, 0x00, 0x24, 0x1c, 0x00, 0x24, 0x1c, 0x00, 0x24, 0x1d, 0x00,
+    0x24, 0x1e, 0x00, 0x24, 0x1e, 0x00, 0x24, 0x1f, 0x00, 0x24, 0x1f, 0x00, 0x24, 0x20, 0x00, 0x24,
+    0x21, 0x00, 0x24, 0x21, 0x00, 0x24, 0x22, 0x00, 0x24, 0x23, 0x00, 0x24, 0x23, 0x00, 0x24, 0x24,
+    0x00, 0x24, 0x24, 0x00, 0x24, 0x25, 0x00, 0x24, 0x26, 0x00, 0x24, 0x26, 0x00, 0x24, 0x27, 0x00,
+    0x24, 0x28, 0x00, 0x24, 0x28, 0x00, 0x24, 0x29, 0x00, 0x24, 0x29, 0x00, 0x24, 0x2a, 0x00, 0x24,
+    0x2b, 0x00, 0x24, 0x2b, 0x00, 0x24, 0x2c, 0x00, 0x24, 0x2d, 0x00, 0x24, 0x2d, 0x00, 0x24, 0x2e,
+    0x00, 0x24, 0x2e, 0x00, 0x24, 0x2f, 0x00, 0x24, 0x30, 0x00, 0x24, 0x30, 0x00, 0x24, 0x31, 0x00,
+    0x24, 0x32, 0x00, 0x24, 0x32, 0x00, 0x24, 0x33, 0x00, 0x24, 0x33, 0x00, 0x24, 0x34, 0x00, 0x24,
+    0x35, 0x00, 0x24, 0x35, 0x00, 0x24, 0x36, 0x00, 0x24, 0x37, 0x00, 0x24, 0x37, 0x00, 0x24, 0x38,
+    0x00, 0x24, 0x38, 0x00, 0x24, 0x39, 0x00, 0x24, 0x3a, 0x00, 0x24, 0x3a, 0x00, 0x24, 0x3b, 0x00,
+    0x24, 0xbf, 0x14, 0x00, 0x24, 0x14, 0x00, 0x24, 0x15, 0x00, 0x24, 0x15, 0x00, 0x24, 0x16, 0x00,
+    0x24, 0x17, 0x00, 0x24, 0x17, 0x00, 0x24, 0x18, 0x00, 0x24, 0x19, 0x00, 0x24, 0x19, 0x00, 0x24,
+    0x1a, 0x00, 0x24, 0x1a, 0x00, 0x24, 0x1b, 0x00, 0x24, 0x1c, 0x00, 0x24, 0x1c, 0x00, 0x24, 0x1d,
+    0x00, 0x24, 0x1e, 0x00, 0x24, 0x1e, 0x00, 0x24, 0x1f, 0x00, 0x24, 0x1f, 0x00, 0x24, 0x20, 0x00,
+    0x24, 0x21, 0x00, 0x24, 0x21, 0x00, 0x24, 0x22, 0x00, 0x24, 0x23, 0x00, 0x24, 0x23, 0x00, 0x24,
+    0x24, 0x00, 0x24, 0x24, 0x00, 0x24, 0x25, 0x00, 0x24, 0x26, 0x00, 0x24, 0x26, 0x00, 0x24, 0x27,
+    0x00, 0x24, 0x28, 0x00, 0x24, 0x28, 0x00, 0x24, 0x29, 0x00, 0x24, 0x29, 0x00, 0x24, 0x2a, 0x00,
+    0x24, 0x2b, 0x00, 0x24, 0x2b, 0x00, 0x24, 0x2c, 0x00, 0x24, 0x2d, 0x00, 0x24, 0x2d, 0x00, 0x24,
+    0x2e, 0x00, 0x24, 0x2e, 0x00, 0x24, 0x2f, 0x00, 0x24, 0x30, 0x00, 0x24, 0x30, 0x00, 0x24, 0x31,
+    0x00, 0x24, 0x32, 0x00, 0x24, 0x32, 0x00, 0x24, 0x33, 0x00, 0x24, 0x33, 0x00, 0x24, 0x34, 0x00,
+    0x24, 0x35, 0x00, 0x24, 0x35, 0x00, 0x24, 0x36, 0x00, 0x24, 0x37, 0x00, 0x24, 0x37, 0x00, 0x24,
+    0x38, 0x00, 0x24, 0x38, 0x00, 0x24, 0x39, 0x00, 0x24, 0x3a, 0x00, 0x24, 0x3a, 0x00, 0x24, 0x3b,
+    0x00, 0x24, 0xbf, 0x14, 0x00, 0x25, 0x14, 0x00, 0x25, 0x15, 0x00, 0x25, 0x15, 0x00, 0x25, 0x16,
+    0x00, 0x25, 0x17, 0x00, 0x25, 0x17, 0x00, 0x25, 0x18, 0x00, 0x25, 0x19, 0x00, 0x25, 0x19, 0x00,
+    0x25, 0x1a, 0x00, 0x25, 0x1a, 0x00, 0x25, 0x1b, 0x00, 0x25, 0x1c, 0x00, 0x25, 0x1c, 0x00, 0x25,
+    0x1d, 0x00, 0x25, 0x1e, 0x00, 0x25, 0x1e, 0x00, 0x25, 0x1f, 0x00, 0x25, 0x1f, 0x00, 0x25, 0x20,
+    0x00, 0x25, 0x21, 0x00, 0x25, 0x21, 0x00, 0x25, 0x22, 0x00, 0x25, 0x23, 0x00, 0x25, 0x23, 0x00,
+    0x25, 0x24, 0x00, 0x25, 0x24, 0x00, 0x25, 0x25, 0x00, 0x25, 0x26, 0x00, 0x25, 0x26, 0x00, 0x25,
+    0x27, 0x00, 0x25, 0x28, 0x00, 0x25, 0x28, 0x00, 0x25, 0x29, 0x00, 0x25, 0x29, 0x00, 0x25, 0x2a,
+    0x00, 0x25, 0x2b, 0x00, 0x25, 0x2b, 0x00, 0x25, 0x2c, 0x00, 0x25, 0x2d, 0x00, 0x25, 0x2d, 0x00,
+    0x25, 0x2e, 0x00, 0x25, 0x2e, 0x00, 0x25, 0x2f, 0x00, 0x25, 0x30, 0x00, 0x25, 0x30, 0x00, 0x25,
+    0x31, 0x00, 0x25, 0x32, 0x00, 0x25, 0x32, 0x00, 0x25, 0x33, 0x00, 0x25, 0x33, 0x00, 0x25, 0x34,
+    0x00, 0x25, 0x35, 0x00, 0x25, 0x35, 0x00, 0x25, 0x36, 0x00, 0x25, 0x37, 0x00, 0x25, 0x37, 0x00,
+    0x25, 0x38, 0x00, 0x25, 0x38, 0x00, 0x25, 0x39, 0x00, 0x25, 0x3a, 0x00, 0x25, 0x3a, 0x00, 0x25,
+    0x3b, 0x00, 0x25, 0xbf, 0x14, 0x00, 0x25, 0x14, 0x00, 0x25, 0x15, 0x00, 0x25, 0x15, 0x00, 0x25,
+    0x16, 0x00, 0x25, 0x17, 0x00, 0x25, 0x17, 0x00, 0x25, 0x18, 0x00, 0x25, 0x19, 0x00, 0x25, 0x19,
+    0x00, 0x25, 0x1a, 0x00, 0x25, 0x1a, 0x00, 0x25, 0x1b, 0x00, 0x25, 0x1c, 0x00, 0x25, 0x1c, 0x00,
+    0x25, 0x1d, 0x00, 0x25, 0x1e, 0x00, 0x25, 0x1e, 0x00, 0x25, 0x1f, 0x00, 0x25, 0x1f, 0x00, 0x25,
+    0x20, 0x00, 0x25, 0x21, 0x00, 0x25, 0x21, 0x00, 0x25, 0x22, 0x00, 0x25, 0x23, 0x00, 0x25, 0x23,
+    0x00, 0x25, 0x24, 0x00, 0x25, 0x24, 0x00, 0x25, 0x25, 0x00, 0x25, 0x26, 0x00, 0x25, 0x26, 0x00,
+    0x25, 0x27, 0x00, 0x25, 0x28, 0x00, 0x25, 0x28, 0x00, 0x25, 0x29, 0x00, 0x25, 0x29, 0x00, 0x25,
+    0x2a, 0x00, 0x25, 0x2b, 0x00, 0x25, 0x2b, 0x00, 0x25, 0x2c, 0x00, 0x25, 0x2d, 0x00, 0x25, 0x2d,
+    0x00, 0x25, 0x2e, 0x00, 0x25, 0x2e, 0x00, 0x25, 0x2f, 0x00, 0x25, 0x30, 0x00, 0x25, 0x30, 0x00,
+    0x25, 0x31, 0x00, 0x25, 0x32, 0x00, 0x25, 0x32, 0x00, 0x25, 0x33, 0x00, 0x25, 0x33, 0x00, 0x25,
+    0x34, 0x00, 0x25, 0x35, 0x00, 0x25, 0x35, 0x00, 0x25, 0x36, 0x00, 0x25, 0x37, 0x00, 0x25, 0x37,
+    0x00, 0x25, 0x38, 0x00, 0x25, 0x38, 0x00, 0x25, 0x39, 0x00, 0x25, 0x3a, 0x00, 0x25, 0x3a, 0x00,
+    0x25, 0x3b, 0x00, 0x25, 0xbf, 0x14, 0x00, 0x26, 0x14, 0x00, 0x26, 0x15, 0x00, 0x26, 0x15, 0x00,
+    0x26, 0x16, 0x00, 0x26, 0x17, 0x00, 0x26, 0x17, 0x00, 0x26, 0x18, 0x00, 0x26, 0x19, 0x00, 0x26,
+    0x19, 0x00, 0x26, 0x1a, 0x00, 0x26, 0x1a, 0x00, 0x26, 0x1b, 0x00, 0x26, 0x1c, 0x00, 0x26, 0x1c,
+    0x00, 0x26, 0x1d, 0x00, 0x26, 0x1e, 0x00, 0x26, 0x1e, 0x00, 0x26, 0x1f, 0x00, 0x26, 0x1f, 0x00,
+    0x26, 0x20, 0x00, 0x26, 0x21, 0x00, 0x26, 0x21, 0x00, 0x26, 0x22, 0x00, 0x26, 0x23, 0x00, 0x26,
+    0x23, 0x00, 0x26, 0x24, 0x00, 0x26, 0x24, 0x00, 0x26, 0x25, 0x00, 0x26, 0x26, 0x00, 0x26, 0x26,
+    0x00, 0x26, 0x27, 0x00, 0x26, 0x28, 0x00, 0x26, 0x28, 0x00, 0x26, 0x29, 0x00, 0x26, 0x29, 0x00,
+    0x26, 0x2a, 0x00, 0x26, 0x2b, 0x00, 0x26, 0x2b, 0x00, 0x26, 0x2c, 0x00, 0x26, 0x2d, 0x00, 0x26,
+    0x2d, 0x00, 0x26, 0x2e, 0x00, 0x26, 0x2e, 0x00, 0x26, 0x2f, 0x00, 0x26, 0x30, 0x00, 0x26, 0x30,
+    0x00, 0x26, 0x31, 0x00, 0x26, 0x32, 0x00, 0x26, 0x32, 0x00, 0x26, 0x33, 0x00, 0x26, 0x33, 0x00,
+    0x26, 0x34, 0x00, 0x26, 0x35, 0x00, 0x26, 0x35, 0x00, 0x26, 0x36, 0x00, 0x26, 0x37, 0x00, 0x26,
+    0x37, 0x00, 0x26, 0x38, 0x00, 0x26, 0x38, 0x00, 0x26, 0x39, 0x00, 0x26, 0x3a, 0x00, 0x26, 0x3a,
+    0x00, 0x26, 0x3b, 0x00, 0x26, 0xbf, 0x14, 0x00, 0x26, 0x14, 0x00, 0x26, 0x15, 0x00, 0x26, 0x15,
+    0x00, 0x26, 0x16, 0x00, 0x26, 0x17, 0x00, 0x26, 0x17, 0x00, 0x26, 0x18, 0x00, 0x26, 0x19, 0x00,
+    0x26, 0x19, 0x00, 0x26, 0x1a, 0x00, 0x26, 0x1a, 0x00, 0x26, 0x1b, 0x00, 0x26, 0x1c, 0x00, 0x26,
+    0x1c, 0x00, 0x26, 0x1d, 0x00, 0x26, 0x1e, 0x00, 0x26, 0x1e, 0x00, 0x26, 0x1f, 0x00, 0x26, 0x1f,
+    0x00, 0x26, 0x20, 0x00, 0x26, 0x21, 0x00, 0x26, 0x21, 0x00, 0x26, 0x22, 0x00, 0x26, 0x23, 0x00,
+    0x26, 0x23, 0x00, 0x26, 0x24, 0x00, 0x26, 0x24, 0x00, 0x26, 0x25, 0x00, 0x26, 0x26, 0x00, 0x26,
+    0x26, 0x00, 0x26, 0x27, 0x00, 0x26, 0x28, 0x00, 0x26, 0x28, 0x00, 0x26, 0x29, 0x00, 0x26, 0x29,
+    0x00, 0x26, 0x2a, 0x00, 0x26, 0x2b, 0x00, 0x26, 0x2b, 0x00, 0x26, 0x2c, 0x00, 0x26, 0x2d, 0x00,
+    0x26, 0x2d, 0x00, 0x26, 0x2e, 0x00, 0x26, 0x2e, 0x00, 0x26, 0x2f, 0x00, 0x26, 0x30, 0x00, 0x26,
+    0x30, 0x00, 0x26, 0x31, 0x00, 0x26, 0x32, 0x00, 0x26, 0x32, 0x00, 0x26, 0x33, 0x00, 0x26, 0x33,
+    0x00, 0x26, 0x34, 0x00, 0x26, 0x35, 0x00, 0x26, 0x35, 0x00, 0x26, 0x36, 0x00, 0x26, 0x37, 0x00,
+    0x26, 0x37, 0x00, 0x26, 0x38, 0x00, 0x26, 0x38, 0x00, 0x26, 0x39, 0x00, 0x26, 0x3a, 0x00, 0x26,
+    0x3a, 0x00, 0x26, 0x3b, 0x00, 0x26, 0xbf, 0x14, 0x00, 0x27, 0x14, 0x00, 0x27, 0x15, 0x00, 0x27,
+    0x15, 0x00, 0x27, 0x16, 0x00, 0x27, 0x17, 0x00, 0x27, 0x17, 0x00, 0x27, 0x18, 0x00, 0x27, 0x19,
+    0x00, 0x27, 0x19, 0x00, 0x27, 0x1a, 0x00, 0x27, 0x1a, 0x00, 0x27, 0x1b, 0x00, 0x27, 0x1c, 0x00,
+    0x27, 0x1c, 0x00, 0x27, 0x1d, 0x00, 0x27, 0x1e, 0x00, 0x27, 0x1e, 0x00, 0x27, 0x1f, 0x00, 0x27,
+    0x1f, 0x00, 0x27, 0x20, 0x00, 0x27, 0x21, 0x00, 0x27, 0x21, 0x00, 0x27, 0x22, 0x00, 0x27, 0x23,
+    0x00, 0x27, 0x23, 0x00, 0x27, 0x24, 0x00, 0x27, 0x24, 0x00, 0x27, 0x25, 0x00, 0x27, 0x26, 0x00,
+    0x27, 0x26, 0x00, 0x27, 0x27, 0x00, 0x27, 0x28, 0x00, 0x27, 0x28, 0x00, 0x27, 0x29, 0x00, 0x27,
+    0x29, 0x00, 0x27, 0x2a, 0x00, 0x27, 0x2b, 0x00, 0x27, 0x2b, 0x00, 0x27, 0x2c, 0x00, 0x27, 0x2d,
+    0x00, 0x27, 0x2d, 0x00, 0x27, 0x2e, 0x00, 0x27, 0x2e, 0x00, 0x27, 0x2f, 0x00, 0x27, 0x30, 0x00,
+    0x27, 0x30, 0x00, 0x27, 0x31, 0x00, 0x27, 0x32, 0x00, 0x27, 0x32, 0x00, 0x27, 0x33, 0x00, 0x27,
+    0x33, 0x00, 0x27, 0x34, 0x00, 0x27, 0x35, 0x00, 0x27, 0x35, 0x00, 0x27, 0x36, 0x00, 0x27, 0x37,
+    0x00, 0x27, 0x37, 0x00, 0x27, 0x38, 0x00, 0x27, 0x38, 0x00, 0x27, 0x39, 0x00, 0x27, 0x3a, 0x00,
+    0x27, 0x3a, 0x00, 0x27, 0x3b, 0x00, 0x27, 0xbf, 0x14, 0x00, 0x27, 0x14, 0x00, 0x27, 0x15, 0x00,
+    0x27, 0x15, 0x00, 0x27, 0x16, 0x00, 0x27, 0x17, 0x00, 0x27, 0x17, 0x00, 0x27, 0x18, 0x00, 0x27,
+    0x19, 0x00, 0x27, 0x19, 0x00, 0x27, 0x1a, 0x00, 0x27, 0x1a, 0x00, 0x27, 0x1b, 0x00, 0x27, 0x1c,
+    0x00, 0x27, 0x1c, 0x00, 0x27, 0x1d, 0x00, 0x27, 0x1e, 0x00, 0x27, 0x1e, 0x00, 0x27, 0x1f, 0x00,
+    0x27, 0x1f, 0x00, 0x27, 0x20, 0x00, 0x27, 0x21, 0x00, 0x27, 0x21, 0x00, 0x27, 0x22, 0x00, 0x27,
+    0x23, 0x00, 0x27, 0x23, 0x00, 0x27, 0x24, 0x00, 0x27, 0x24, 0x00, 0x27, 0x25, 0x00, 0x27, 0x26,
+    0x00, 0x27, 0x26, 0x00, 0x27, 0x27, 0x00, 0x27, 0x28, 0x00, 0x27, 0x28, 0x00, 0x27, 0x29, 0x00,
+    0x27, 0x29, 0x00, 0x27, 0x2a, 0x00, 0x27, 0x2b, 0x00, 0x27, 0x2b, 0x00, 0x27, 0x2c, 0x00, 0x27,
+    0x2d, 0x00, 0x27, 0x2d, 0x00, 0x27, 0x2e, 0x00, 0x27, 0x2e, 0x00, 0x27, 0x2f, 0x00, 0x27, 0x30,
+    0x00, 0x27, 0x30, 0x00, 0x27, 0x31, 0x00, 0x27, 0x32, 0x00, 0x27, 0x32, 0x00, 0x27, 0x33, 0x00,
+    0x27, 0x33, 0x00, 0x27, 0x34, 0x00, 0x27, 0x35, 0x00, 0x27, 0x35, 0x00, 0x27, 0x36, 0x00, 0x27,
+    0x37, 0x00, 0x27, 0x37, 0x00, 0x27, 0x38, 0x00, 0x27, 0x38, 0x00, 0x27, 0x39, 0x00, 0x27, 0x3a,
+    0x00, 0x27, 0x3a, 0x00, 0x27, 0x3b, 0x00, 0x27, 0xd0, 0x32, 0x82, 0x33, 0x00, 0x11, 0x34, 0x00,
+    0x11, 0x35, 0x00, 0x11, 0x09, 0x32, 0x82, 0x33, 0x00, 0x12, 0x34, 0x00, 0x12, 0x35, 0x00, 0x12,
+    0x09, 0x32, 0x80, 0x33, 0x00, 0x12, 0x01, 0x80, 0x37, 0x37, 0x0d, 0x08, 0x1e, 0x81, 0x00, 0xa0,
+    0xff, 0x00, 0xa0, 0xff, 0x12, 0x42, 0x37, 0x37, 0x0d, 0x08, 0x1d, 0x43, 0x00, 0xa0, 0xff, 0x11,
+    0x42, 0x37, 0x37, 0x0d, 0x08, 0x1c, 0x45, 0x00, 0xa0, 0xff, 0x11, 0x42, 0x5f, 0x5f, 0x17, 0x07,
+    0x1b, 0x47, 0x00, 0xa0, 0xff, 0x10, 0x42, 0x5f, 0x5f, 0x17, 0x07, 0x1a, 0x49, 0x00, 0xa0, 0xff,
+    0x0f, 0x42, 0x5f, 0x5f, 0x17, 0x07, 0x19, 0x4b, 0x00, 0xa0, 0xff, 0x0f, 0x42, 0x87, 0x87, 0x21,
+    0x06, 0x18, 0x4d, 0x00, 0xa0, 0xff, 0x0e, 0x42, 0x87, 0x87, 0x21, 0x06, 0x17, 0x4f, 0x00, 0xa0,
+    0xff, 0x0d, 0x42, 0x87, 0x87, 0x21, 0x06, 0x16, 0x51, 0x00, 0xa0, 0xff, 0x0d, 0x42, 0xaf, 0xaf,
+    0x2b, 0x05, 0x15, 0x53, 0x00, 0xa0, 0xff, 0x0c, 0x42, 0xaf, 0xaf, 0x2b, 0x05, 0x14, 0x55, 0x00,
+    0xa0, 0xff, 0x0b, 0x42, 0xaf, 0xaf, 0x2b, 0x05, 0x13, 0x57, 0x00, 0xa0, 0xff, 0x0a, 0x42, 0xd7,
+    0xd7, 0x35, 0x05, 0x13, 0x57, 0x00, 0xa0, 0xff, 0x0a, 0x42, 0xd7, 0xd7, 0x35, 0x05, 0x14, 0x55,
+    0x00, 0xa0, 0xff, 0x0b, 0x42, 0xd7, 0xd7, 0x35, 0x05, 0x15, 0x53, 0x00, 0xa0, 0xff, 0x0c, 0x42,
+    0xff, 0xff, 0x3f, 0x05, 0x16, 0x51, 0x00, 0xa0, 0xff, 0x0d, 0x42, 0xff, 0xff, 0x3f, 0x05, 0x17,
+    0x4f, 0x00, 0xa0, 0xff, 0x0e, 0x42, 0xff, 0xff, 0x3f, 0x05, 0x18, 0x4d, 0x00, 0xa0, 0xff, 0x18,
+    0x19, 0x4b, 0x00, 0xa0, 0xff, 0x19, 0x1a, 0x49, 0x00, 0xa0, 0xff, 0x1a, 0x1b, 0x47, 0x00, 0xa0,
+    0xff, 0x1b, 0x1c, 0x45, 0x00, 0xa0, 0xff, 0x1c, 0x1d, 0x43, 0x00, 0xa0, 0xff, 0x1d, 0x1e, 0x81,
+    0x00, 0xa0, 0xff, 0x00, 0xa0, 0xff, 0x1e, 0xd3, 0xd2, 0x1e, 0x81, 0x00, 0xa0, 0xff, 0x00, 0xa0,
+    0xff, 0x12, 0x82, 0x34, 0x00, 0x12, 0x35, 0x00, 0x12, 0x35, 0x00, 0x12, 0x08, 0x1d, 0x43, 0x00,
+    0xa0, 0xff, 0x11, 0x82, 0x34, 0x00, 0x13, 0x35, 0x00, 0x13, 0x35, 0x00, 0x13, 0x08, 0x1c, 0x45,
+    0x00, 0xa0, 0xff, 0x10, 0x82, 0x34, 0x00, 0x13, 0x35, 0x00, 0x13, 0x35, 0x00, 0x13, 0x08, 0x1b,
+    0x47, 0x00, 0xa0, 0xff, 0x10, 0x42, 0x37, 0x37, 0x0d, 0x07, 0x1a, 0x49, 0x00, 0xa0, 0xff, 0x0f,
+    0x42, 0x37, 0x37, 0x0d, 0x07, 0x19, 0x4b, 0x00, 0xa0, 0xff, 0x0e, 0x42, 0x37, 0x37, 0x0d, 0x07,
+    0x18, 0x4d, 0x00, 0xa0, 0xff, 0x0e, 0x42, 0x5f, 0x5f, 0x17, 0x06, 0x17, 0x4f, 0x00, 0xa0, 0xff,
+    0x0d, 0x42, 0x5f, 0x5f, 0x17, 0x06, 0x16, 0x51, 0x00, 0xa0, 0xff, 0x0c, 0x42, 0x5f, 0x5f, 0x17,
+    0x06, 0x15, 0x53, 0x00, 0xa0, 0xff, 0x0c, 0x42, 0x87, 0x87, 0x21, 0x05, 0x14, 0x55, 0x00, 0xa0,
+    0xff, 0x0b, 0x42, 0x87, 0x87, 0x21, 0x05, 0x13, 0x57, 0x00, 0xa0, 0xff, 0x0a, 0x42, 0x87, 0x87,
+    0x21, 0x05, 0x12, 0x59, 0x00, 0xa0, 0xff, 0x09, 0x42, 0xaf, 0xaf, 0x2b, 0x05, 0x12, 0x59, 0x00,
+    0xa0, 0xff, 0x09, 0x42, 0xaf, 0xaf, 0x2b, 0x05, 0x13, 0x57, 0x00, 0xa0, 0xff, 0x0a, 0x42, 0xaf,
+    0xaf, 0x2b, 0x05, 0x14, 0x55, 0x00, 0xa0, 0xff, 0x0b, 0x42, 0xd7, 0xd7, 0x35, 0x05, 0x15, 0x53,
+    0x00, 0xa0, 0xff, 0x0c, 0x42, 0xd7, 0xd7, 0x35, 0x05, 0x16, 0x51, 0x00, 0xa0, 0xff, 0x0d, 0x42,
+    0xd7, 0xd7, 0x35, 0x05, 0x17, 0x4f, 0x00, 0xa0, 0xff, 0x0d, 0x42, 0xff, 0xff, 0x3f, 0x06, 0x18,
+    0x4d, 0x00, 0xa0, 0xff, 0x0e, 0x42, 0xff, 0xff, 0x3f, 0x06, 0x19, 0x4b, 0x00, 0xa0, 0xff, 0x0f,
+    0x42, 0xff, 0xff, 0x3f, 0x06, 0x1a, 0x49, 0x00, 0xa0, 0xff, 0x1a, 0x1b, 0x47, 0x00, 0xa0, 0xff,
+    0x1b, 0x1c, 0x45, 0x00, 0xa0, 0xff, 0x1c, 0x1d, 0x43, 0x00, 0xa0, 0xff, 0x1d, 0x1e, 0x81, 0x00,
+    0xa0, 0xff, 0x00, 0xa0, 0xff, 0x1e, 0xd2, 0xd1, 0x1e, 0x81, 0x00, 0xa0, 0xff, 0x00, 0xa0, 0xff,
+    0x1e, 0x1d, 0x43, 0x00, 0xa0, 0xff, 0x1d, 0x1c, 0x45, 0x00, 0xa0, 0xff, 0x1c, 0x1b, 0x47, 0x00,
+    0xa0, 0xff, 0x1b, 0x1a, 0x49, 0x00, 0xa0, 0xff, 0x0f, 0x82, 0x35, 0x00, 0x14, 0x35, 0x00, 0x14,
+    0x36, 0x00, 0x14, 0x07, 0x19, 0x4b, 0x00, 0xa0, 0xff, 0x0e, 0x82, 0x35, 0x00, 0x14, 0x35, 0x00,
+    0x14, 0x36, 0x00, 0x14, 0x07, 0x18, 0x4d, 0x00, 0xa0, 0xff, 0x0d, 0x82, 0x35, 0x00, 0x15, 0x35,
+    0x00, 0x15, 0x36, 0x00, 0x15, 0x07, 0x17, 0x4f, 0x00, 0xa0, 0xff, 0x0d, 0x42, 0x37, 0x37, 0x0d,
+    0x06, 0x16, 0x51, 0x00, 0xa0, 0xff, 0x0c, 0x42, 0x37, 0x37, 0x0d, 0x06, 0x15, 0x53, 0x00, 0xa0,
+    0xff, 0x0b, 0x42, 0x37, 0x37, 0x0d, 0x06, 0x14, 0x55, 0x00, 0xa0, 0xff, 0x0b, 0x42, 0x5f, 0x5f,
+    0x17, 0x05, 0x13, 0x57, 0x00, 0xa0, 0xff, 0x0a, 0x42, 0x5f, 0x5f, 0x17, 0x05, 0x12, 0x59, 0x00,
+    0xa0, 0xff, 0x09, 0x42, 0x5f, 0x5f, 0x17, 0x05, 0x11, 0x5b, 0x00, 0xa0, 0xff, 0x08, 0x42, 0x87,
+    0x87, 0x21, 0x05, 0x11, 0x5b, 0x00, 0xa0, 0xff, 0x08, 0x42, 0x87, 0x87, 0x21, 0x05, 0x12, 0x59,
+    0x00, 0xa0, 0xff, 0x09, 0x42, 0x87, 0x87, 0x21, 0x05, 0x13, 0x57, 0x00, 0xa0, 0xff, 0x0a, 0x42,
+    0xaf, 0xaf, 0x2b, 0x05, 0x14, 0x55, 0x00, 0xa0, 0xff, 0x0b, 0x42, 0xaf, 0xaf, 0x2b, 0x05, 0x15,
+    0x53, 0x00, 0xa0, 0xff, 0x0c, 0x42, 0xaf, 0xaf, 0x2b, 0x05, 0x16, 0x51, 0x00, 0xa0, 0xff, 0x0c,
+    0x42, 0xd7, 0xd7, 0x35, 0x06, 0x17, 0x4f, 0x00, 0xa0, 0xff, 0x0d, 0x42, 0xd7, 0xd7, 0x35, 0x06,
+    0x18, 0x4d, 0x00, 0xa0, 0xff, 0x0d, 0x80, 0xff, 0xff, 0x3f, 0x42, 0xd7, 0xd7, 0x35, 0x06, 0x19,
+    0x4b, 0x00, 0xa0, 0xff, 0x0e, 0x42, 0xff, 0xff, 0x3f, 0x07, 0x1a, 0x49, 0x00, 0xa0, 0xff, 0x0f,
+    0x42, 0xff, 0xff, 0x3f, 0x07, 0x1b, 0x47, 0x00, 0xa0, 0xff, 0x1b, 0x1c, 0x45, 0x00, 0xa0, 0xff,
+    0x1c, 0x1d, 0x43, 0x00, 0xa0, 0xff, 0x1d, 0x1e, 0x81, 0x00, 0xa0, 0xff, 0x00, 0xa0, 0xff, 0x1e,
+    0xd1, 0xd8, 0x35, 0x82, 0x35, 0x00, 0x15, 0x36, 0x00, 0x15, 0x37, 0x00, 0x15, 0x06, 0x35, 0x82,
+    0x35, 0x00, 0x16, 0x36, 0x00, 0x16, 0x37, 0x00, 0x16, 0x06, 0x35, 0x82, 0x35, 0x00, 0x16, 0x36,
+    0x00, 0x16, 0x37, 0x00, 0x16, 0x06, 0x36, 0x42, 0x37, 0x37, 0x0d, 0x05, 0x36, 0x42, 0x37, 0x37,
+    0x0d, 0x05, 0x36, 0x42, 0x37, 0x37, 0x0d, 0x05, 0x36, 0x42, 0x5f, 0x5f, 0x17, 0x05, 0x36, 0x42,
+    0x5f, 0x5f, 0x17, 0x05, 0x36, 0x42, 0x5f, 0x5f, 0x17, 0x05, 0x36, 0x42, 0x87, 0x87, 0x21, 0x05,
+    0x36, 0x42, 0x87, 0x87, 0x21, 0x05, 0x36, 0x42, 0x87, 0x87, 0x21, 0x05, 0x35, 0x42, 0xaf, 0xaf,
+    0x2b, 0x06, 0x35, 0x42, 0xaf, 0xaf, 0x2b, 0x06, 0x34, 0x80, 0x35, 0x00, 0x1c, 0x42, 0xaf, 0xaf,
+    0x2b, 0x06, 0x34, 0x42, 0xd7, 0xd7, 0x35, 0x07, 0x34, 0x42, 0xd7, 0xd7, 0x35, 0x07, 0x33, 0x80,
+    0xff, 0xff, 0x3f, 0x42, 0xd7, 0xd7, 0x35, 0x07, 0x33, 0x42, 0xff, 0xff, 0x3f, 0x08, 0x33, 0x42,
+    0xff, 0xff, 0x3f, 0x08, 0xd2, 0xd0, 0x1e, 0x81, 0x00, 0xa0, 0xff, 0x00, 0xa0, 0xff, 0x1e, 0x1d,
+    0x43, 0x00, 0xa0, 0xff, 0x1d, 0x1c, 0x45, 0x00, 0xa0, 0xff, 0x1c, 0x1b, 0x47, 0x00, 0xa0, 0xff,
+    0x1b, 0x1a, 0x49, 0x00, 0xa0, 0xff, 0x1a, 0x19, 0x4b, 0x00, 0xa0, 0xff, 0x19, 0x18, 0x4d, 0x00,
+    0xa0, 0xff, 0x18, 0x17, 0x4f, 0x00, 0xa0, 0xff, 0x17, 0x16, 0x51, 0x00, 0xa0, 0xff, 0x16, 0x15,
+    0x53, 0x00, 0xa0, 0xff, 0x15, 0x14, 0x55, 0x00, 0xa0, 0xff, 0x14, 0x13, 0x57, 0x00, 0xa0, 0xff,
+    0x0a, 0x82, 0x36, 0x00, 0x17, 0x37, 0x00, 0x17, 0x37, 0x00, 0x17, 0x05, 0x12, 0x59, 0x00, 0xa0,
+    0xff, 0x09, 0x82, 0x36, 0x00, 0x17, 0x37, 0x00, 0x17, 0x37, 0x00, 0x17, 0x05, 0x11, 0x5b, 0x00,
+    0xa0, 0xff, 0x08, 0x82, 0x36, 0x00, 0x18, 0x37, 0x00, 0x18, 0x37, 0x00, 0x18, 0x05, 0x10, 0x5d,
+    0x00, 0xa0, 0xff, 0x07, 0x42, 0x37, 0x37, 0x0d, 0x05, 0x10, 0x5d, 0x00, 0xa0, 0xff, 0x07, 0x42,
+    0x37, 0x37, 0x0d, 0x05, 0x11, 0x5b, 0x00, 0xa0, 0xff, 0x08, 0x42, 0x37, 0x37, 0x0d, 0x05, 0x12,
+    0x59, 0x00, 0xa0, 0xff, 0x09, 0x42, 0x5f, 0x5f, 0x17, 0x05, 0x13, 0x57, 0x00, 0xa0, 0xff, 0x0a,
+    0x42, 0x5f, 0x5f, 0x17, 0x05, 0x14, 0x55, 0x00, 0xa0, 0xff, 0x0b, 0x42, 0x5f, 0x5f, 0x17, 0x05,
+    0x15, 0x53, 0x00, 0xa0, 0xff, 0x0b, 0x42, 0x87, 0x87, 0x21, 0x06, 0x16, 0x51, 0x00, 0xa0, 0xff,
+    0x0c, 0x42, 0x87, 0x87, 0x21, 0x06, 0x17, 0x4f, 0x00, 0xa0, 0xff, 0x0d, 0x42, 0x87, 0x87, 0x21,
+    0x06, 0x18, 0x4d, 0x00, 0xa0, 0xff, 0x0d, 0x42, 0xaf, 0xaf, 0x2b, 0x07, 0x19, 0x4b, 0x00, 0xa0,
+    0xff, 0x0e, 0x42, 0xaf, 0xaf, 0x2b, 0x07, 0x1a, 0x49, 0x00, 0xa0, 0xff, 0x0e, 0x80, 0xd7, 0xd7,
+    0x35, 0x42, 0xaf, 0xaf, 0x2b, 0x07, 0x1b, 0x47, 0x00, 0xa0, 0xff, 0x0f, 0x42, 0xd7, 0xd7, 0x35,
+    0x08, 0x1c, 0x45, 0x00, 0xa0, 0xff, 0x10, 0x42, 0xd7, 0xd7, 0x35, 0x08, 0x1d, 0x43, 0x00, 0xa0,
+    0xff, 0x0f, 0x42, 0xff, 0xff, 0x3f, 0x0a, 0x1e, 0x81, 0x00, 0xa0, 0xff, 0x00, 0xa0, 0xff, 0x10,
+    0x42, 0xff, 0xff, 0x3f, 0x0a, 0x31, 0x42, 0xff, 0xff, 0x3f, 0x0a, 0xcf, 0xde, 0x36, 0x82, 0x36,
+    0x00, 0x18, 0x37, 0x00, 0x18, 0x37, 0x00, 0x18, 0x05, 0x36, 0x82, 0x36, 0x00, 0x19, 0x37, 0x00,
+    0x19, 0x37, 0x00, 0x19, 0x05, 0x36, 0x82, 0x36, 0x00, 0x19, 0x37, 0x00, 0x19, 0x37, 0x00, 0x19,
+    0x05, 0x36, 0x42, 0x37, 0x37, 0x0d, 0x05, 0x36, 0x42, 0x37, 0x37, 0x0d, 0x05, 0x36, 0x42, 0x37,
+    0x37, 0x0d, 0x05, 0x35, 0x42, 0x5f, 0x5f, 0x17, 0x06, 0x35, 0x42, 0x5f, 0x5f, 0x17, 0x06, 0x35,
+    0x42, 0x5f, 0x5f, 0x17, 0x06, 0x34, 0x42, 0x87, 0x87, 0x21, 0x07, 0x34, 0x42, 0x87, 0x87, 0x21,
+    0x07, 0x33, 0x80, 0xaf, 0xaf, 0x2b, 0x42, 0x87, 0x87, 0x21, 0x07, 0x33, 0x42, 0xaf, 0xaf, 0x2b,
+    0x08, 0x33, 0x42, 0xaf, 0xaf, 0x2b, 0x08, 0x31, 0x42, 0xd7, 0xd7, 0x35, 0x0a, 0x31, 0x42, 0xd7,
+    0xd7, 0x35, 0x0a, 0x2f, 0x81, 0xff, 0xff, 0x3f, 0xff, 0xff, 0x3f, 0x42, 0xd7, 0xd7, 0x35, 0x0a,
+    0x2f, 0x42, 0xff, 0xff, 0x3f, 0x0c, 0x2f, 0x42, 0xff, 0xff, 0x3f, 0x0c, 0xcd, 0xe1, 0x36, 0x82,
+    0x36, 0x00, 0x19, 0x37, 0x00, 0x19, 0x37, 0x00, 0x19, 0x05, 0x36, 0x82, 0x36, 0x00, 0x1a, 0x37,
+    0x00, 0x1a, 0x37, 0x00, 0x1a, 0x05, 0x36, 0x82, 0x36, 0x00, 0x1a, 0x37, 0x00, 0x1a, 0x37, 0x00,
+    0x1a, 0x05, 0x35, 0x42, 0x37, 0x37, 0x0d, 0x06, 0x35, 0x42, 0x37, 0x37, 0x0d, 0x06, 0x35, 0x42,
+    0x37, 0x37, 0x0d, 0x06, 0x34, 0x42, 0x5f, 0x5f, 0x17, 0x07, 0x34, 0x42, 0x5f, 0x5f, 0x17, 0x07,
+    0x33, 0x80, 0x34, 0x00, 0x1d, 0x42, 0x5f, 0x5f, 0x17, 0x07, 0x33, 0x42, 0x87, 0x87, 0x21, 0x08,
+    0x33, 0x42, 0x87, 0x87, 0x21, 0x08, 0x31, 0x81, 0xaf, 0xaf, 0x2b, 0xaf, 0xaf, 0x2b, 0x42, 0x87,
+    0x87, 0x21, 0x08, 0x31, 0x42, 0xaf, 0xaf, 0x2b, 0x0a, 0x2f, 0x81, 0xd7, 0xd7, 0x35, 0xd7, 0xd7,
+    0x35, 0x42, 0xaf, 0xaf, 0x2b, 0x0a, 0x2f, 0x42, 0xd7, 0xd7, 0x35, 0x0c, 0x2d, 0x81, 0xff, 0xff,
+    0x3f, 0xff, 0xff, 0x3f, 0x42, 0xd7, 0xd7, 0x35, 0x0c, 0x2d, 0x42, 0xff, 0xff, 0x3f, 0x0e, 0x2d,
+    0x42, 0xff, 0xff, 0x3f, 0x0e, 0xcb, 0xd0, 0x1e, 0x81, 0x27, 0x00, 0x11, 0x28, 0x00, 0x11, 0x1e,
+    0x1d, 0x80, 0x26, 0x00, 0x12, 0x01, 0x80, 0x28, 0x00, 0x12, 0x1d, 0x1c, 0x80, 0x26, 0x00, 0x12,
+    0x03, 0x80, 0x29, 0x00, 0x12, 0x1c, 0x1b, 0x80, 0x25, 0x00, 0x13, 0x05, 0x80, 0x29, 0x00, 0x13,
+    0x1b, 0x1a, 0x80, 0x24, 0x00, 0x13, 0x07, 0x80, 0x2a, 0x00, 0x13, 0x1a, 0x19, 0x80, 0x24, 0x00,
+    0x14, 0x09, 0x80, 0x2b, 0x00, 0x14, 0x19, 0x18, 0x80, 0x23, 0x00, 0x14, 0x0b, 0x80, 0x2b, 0x00,
+    0x14, 0x18, 0x17, 0x80, 0x23, 0x00, 0x15, 0x0d, 0x80, 0x2c, 0x00, 0x15, 0x17, 0x16, 0x80, 0x22,
+    0x00, 0x15, 0x0f, 0x80, 0x2d, 0x00, 0x15, 0x16, 0x15, 0x80, 0x21, 0x00, 0x16, 0x11, 0x80, 0x2d,
+    0x00, 0x16, 0x15, 0x14, 0x80, 0x21, 0x00, 0x16, 0x13, 0x80, 0x2e, 0x00, 0x16, 0x14, 0x13, 0x80,
+    0x20, 0x00, 0x17, 0x15, 0x80, 0x2e, 0x00, 0x17, 0x13, 0x12, 0x80, 0x1f, 0x00, 0x17, 0x17, 0x80,
+    0x2f, 0x00, 0x17, 0x12, 0x11, 0x80, 0x1f, 0x00, 0x18, 0x19, 0x80, 0x30, 0x00, 0x18, 0x11, 0x10,
+    0x80, 0x1e, 0x00, 0x18, 0x1b, 0x80, 0x30, 0x00, 0x18, 0x10, 0x10, 0x80, 0x1e, 0x00, 0x19, 0x1b,
+    0x80, 0x30, 0x00, 0x19, 0x10, 0x11, 0x80, 0x1f, 0x00, 0x19, 0x19, 0x80, 0x30, 0x00, 0x19, 0x11,
+    0x12, 0x80, 0x1f, 0x00, 0x19, 0x17, 0x80, 0x2f, 0x00, 0x19, 0x12, 0x13, 0x80, 0x20, 0x00, 0x1a,
+    0x15, 0x80, 0x2e, 0x00, 0x1a, 0x13, 0x14, 0x80, 0x21, 0x00, 0x1a, 0x13, 0x80, 0x2e, 0x00, 0x1a,
+    0x14, 0x15, 0x80, 0x21, 0x00, 0x1b, 0x11, 0x80, 0x2d, 0x00, 0x1b, 0x0b, 0x82, 0x35, 0x00, 0x1b,
+    0x36, 0x00, 0x1b, 0x37, 0x00, 0x1b, 0x06, 0x16, 0x80, 0x22, 0x00, 0x1b, 0x0f, 0x80, 0x2d, 0x00,
+    0x1b, 0x0c, 0x82, 0x35, 0x00, 0x1b, 0x36, 0x00, 0x1b, 0x37, 0x00, 0x1b, 0x06, 0x17, 0x80, 0x23,
+    0x00, 0x1c, 0x0d, 0x80, 0x2c, 0x00, 0x1c, 0x0d, 0x82, 0x35, 0x00, 0x1c, 0x36, 0x00, 0x1c, 0x37,
+    0x00, 0x1c, 0x06, 0x18, 0x80, 0x23, 0x00, 0x1c, 0x0b, 0x80, 0x2b, 0x00, 0x1c, 0x0d, 0x42, 0x37,
+    0x37, 0x0d, 0x07, 0x19, 0x80, 0x24, 0x00, 0x1d, 0x09, 0x80, 0x2b, 0x00, 0x1d, 0x0e, 0x42, 0x37,
+    0x37, 0x0d, 0x07, 0x1a, 0x80, 0x24, 0x00, 0x1d, 0x07, 0x80, 0x2a, 0x00, 0x1d, 0x0f, 0x42, 0x37,
+    0x37, 0x0d, 0x07, 0x1b, 0x80, 0x25, 0x00, 0x1e, 0x05, 0x80, 0x29, 0x00, 0x1e, 0x0f, 0x42, 0x5f,
+    0x5f, 0x17, 0x08, 0x1c, 0x80, 0x26, 0x00, 0x1e, 0x03, 0x80, 0x29, 0x00, 0x1e, 0x10, 0x42, 0x5f,
+    0x5f, 0x17, 0x08, 0x1d, 0x80, 0x26, 0x00, 0x1f, 0x01, 0x80, 0x28, 0x00, 0x1f, 0x0f, 0x81, 0x87,
+    0x87, 0x21, 0x87, 0x87, 0x21, 0x42, 0x5f, 0x5f, 0x17, 0x08, 0x1e, 0x81, 0x27, 0x00, 0x1f, 0x28,
+    0x00, 0x1f, 0x10, 0x42, 0x87, 0x87, 0x21, 0x0a, 0x2f, 0x81, 0xaf, 0xaf, 0x2b, 0xaf, 0xaf, 0x2b,
+    0x42, 0x87, 0x87, 0x21, 0x0a, 0x2f, 0x42, 0xaf, 0xaf, 0x2b, 0x0c, 0x2d, 0x81, 0xd7, 0xd7, 0x35,
+    0xd7, 0xd7, 0x35, 0x42, 0xaf, 0xaf, 0x2b, 0x0c, 0x2d, 0x42, 0xd7, 0xd7, 0x35, 0x0e, 0x2b, 0x81,
+    0xff, 0xff, 0x3f, 0xff, 0xff, 0x3f, 0x42, 0xd7, 0xd7, 0x35, 0x0e, 0x2b, 0x42, 0xff, 0xff, 0x3f,
+    0x10, 0x2b, 0x42, 0xff, 0xff, 0x3f, 0x10, 0xc9, 0xe7, 0x34, 0x82, 0x35, 0x00, 0x1c, 0x35, 0x00,
+    0x1c, 0x36, 0x00, 0x1c, 0x07, 0x34, 0x82, 0x35, 0x00, 0x1d, 0x35, 0x00, 0x1d, 0x36, 0x00, 0x1d,
+    0x07, 0x34, 0x82, 0x35, 0x00, 0x1d, 0x35, 0x00, 0x1d, 0x36, 0x00, 0x1d, 0x07, 0x32, 0x42, 0x37,
+    0x37, 0x0d, 0x80, 0x35, 0x00, 0x1e, 0x08, 0x32, 0x42, 0x37, 0x37, 0x0d, 0x80, 0x35, 0x00, 0x1e,
+    0x08, 0x31, 0x80, 0x5f, 0x5f, 0x17, 0x42, 0x37, 0x37, 0x0d, 0x80, 0x35, 0x00, 0x1f, 0x08, 0x31,
+    0x42, 0x5f, 0x5f, 0x17, 0x0a, 0x2f, 0x81, 0x87, 0x87, 0x21, 0x87, 0x87, 0x21, 0x42, 0x5f, 0x5f,
+    0x17, 0x0a, 0x2f, 0x42, 0x87, 0x87, 0x21, 0x0c, 0x2d, 0x81, 0xaf, 0xaf, 0x2b, 0xaf, 0xaf, 0x2b,
+    0x42, 0x87, 0x87, 0x21, 0x0c, 0x2d, 0x42, 0xaf, 0xaf, 0x2b, 0x0e, 0x2a, 0x42, 0xd7, 0xd7, 0x35,
+    0x42, 0xaf, 0xaf, 0x2b, 0x0e, 0x2a, 0x42, 0xd7, 0xd7, 0x35, 0x80, 0x30, 0x00, 0x22, 0x10, 0x28,
+    0x81, 0xff, 0xff, 0x3f, 0xff, 0xff, 0x3f, 0x42, 0xd7, 0xd7, 0x35, 0x80, 0x30, 0x00, 0x22, 0x10,
+    0x28, 0x42, 0xff, 0xff, 0x3f, 0x13, 0x28, 0x42, 0xff, 0xff, 0x3f, 0x13, 0xc7, 0xd1, 0x1e, 0x81,
+    0x27, 0x00, 0x12, 0x28, 0x00, 0x12, 0x1e, 0x1d, 0x80, 0x26, 0x00, 0x12, 0x01, 0x80, 0x28, 0x00,
+    0x12, 0x1d, 0x1c, 0x80, 0x26, 0x00, 0x13, 0x03, 0x80, 0x29, 0x00, 0x13, 0x1c, 0x1b, 0x80, 0x25,
+    0x00, 0x13, 0x05, 0x80, 0x29, 0x00, 0x13, 0x1b, 0x1a, 0x80, 0x24, 0x00, 0x14, 0x07, 0x80, 0x2a,
+    0x00, 0x14, 0x1a, 0x19, 0x80, 0x24, 0x00, 0x14, 0x09, 0x80, 0x2b, 0x00, 0x14, 0x19, 0x18, 0x80,
+    0x23, 0x00, 0x15, 0x0b, 0x80, 0x2b, 0x00, 0x15, 0x18, 0x17, 0x80, 0x23, 0x00, 0x15, 0x0d, 0x80,
+    0x2c, 0x00, 0x15, 0x17, 0x16, 0x80, 0x22, 0x00, 0x16, 0x0f, 0x80, 0x2d, 0x00, 0x16, 0x16, 0x15,
+    0x80, 0x21, 0x00, 0x16, 0x11, 0x80, 0x2d, 0x00, 0x16, 0x15, 0x14, 0x80, 0x21, 0x00, 0x17, 0x13,
+    0x80, 0x2e, 0x00, 0x17, 0x14, 0x13, 0x80, 0x20, 0x00, 0x17, 0x15, 0x80, 0x2e, 0x00, 0x17, 0x13,
+    0x12, 0x80, 0x1f, 0x00, 0x18, 0x17, 0x80, 0x2f, 0x00, 0x18, 0x12, 0x11, 0x80, 0x1f, 0x00, 0x18,
+    0x19, 0x80, 0x30, 0x00, 0x18, 0x11, 0x11, 0x80, 0x1f, 0x00, 0x19, 0x19, 0x80, 0x30, 0x00, 0x19,
+    0x11, 0x12, 0x80, 0x1f, 0x00, 0x19, 0x17, 0x80, 0x2f, 0x00, 0x19, 0x12, 0x13, 0x80, 0x20, 0x00,
+    0x19, 0x15, 0x80, 0x2e, 0x00, 0x19, 0x13, 0x14, 0x80, 0x21, 0x00, 0x1a, 0x13, 0x80, 0x2e, 0x00,
+    0x1a, 0x14, 0x15, 0x80, 0x21, 0x00, 0x1a, 0x11, 0x80, 0x2d, 0x00, 0x1a, 0x15, 0x16, 0x80, 0x22,
+    0x00, 0x1b, 0x0f, 0x80, 0x2d, 0x00, 0x1b, 0x16, 0x17, 0x80, 0x23, 0x00, 0x1b, 0x0d, 0x80, 0x2c,
+    0x00, 0x1b, 0x17, 0x18, 0x80, 0x23, 0x00, 0x1c, 0x0b, 0x80, 0x2b, 0x00, 0x1c, 0x18, 0x19, 0x80,
+    0x24, 0x00, 0x1c, 0x09, 0x80, 0x2b, 0x00, 0x1c, 0x19, 0x1a, 0x80, 0x24, 0x00, 0x1d, 0x07, 0x80,
+    0x2a, 0x00, 0x1d, 0x1a, 0x1b, 0x80, 0x25, 0x00, 0x1d, 0x05, 0x80, 0x29, 0x00, 0x1d, 0x1b, 0x1c,
+    0x80, 0x26, 0x00, 0x1e, 0x03, 0x80, 0x29, 0x00, 0x1e, 0x0f, 0x82, 0x33, 0x00, 0x1e, 0x34, 0x00,
+    0x1e, 0x35, 0x00, 0x1e, 0x09, 0x1d, 0x80, 0x26, 0x00, 0x1e, 0x01, 0x80, 0x28, 0x00, 0x1e, 0x10,
+    0x82, 0x33, 0x00, 0x1e, 0x34, 0x00, 0x1e, 0x35, 0x00, 0x1e, 0x09, 0x1e, 0x81, 0x27, 0x00, 0x1f,
+    0x28, 0x00, 0x1f, 0x10, 0x42, 0x37, 0x37, 0x0d, 0x80, 0x35, 0x00, 0x1f, 0x09, 0x31, 0x42, 0x37,
+    0x37, 0x0d, 0x0a, 0x2f, 0x81, 0x32, 0x00, 0x20, 0x32, 0x00, 0x20, 0x42, 0x37, 0x37, 0x0d, 0x0a,
+    0x2f, 0x42, 0x5f, 0x5f, 0x17, 0x0c, 0x2d, 0x81, 0x87, 0x87, 0x21, 0x87, 0x87, 0x21, 0x42, 0x5f,
+    0x5f, 0x17, 0x0c, 0x2d, 0x81, 0x87, 0x87, 0x21, 0x87, 0x87, 0x21, 0x42, 0x5f, 0x5f, 0x17, 0x0c,
+    0x2a, 0x42, 0xaf, 0xaf, 0x2b, 0x42, 0x87, 0x87, 0x21, 0x0e, 0x2a, 0x42, 0xaf, 0xaf, 0x2b, 0x11,
+    0x28, 0x81, 0xd7, 0xd7, 0x35, 0xd7, 0xd7, 0x35, 0x42, 0xaf, 0xaf, 0x2b, 0x11, 0x25, 0x42, 0xff,
+    0xff, 0x3f, 0x42, 0xd7, 0xd7, 0x35, 0x13, 0x25, 0x42, 0xff, 0xff, 0x3f, 0x42, 0xd7, 0xd7, 0x35,
+    0x13, 0x25, 0x42, 0xff, 0xff, 0x3f, 0x16, 0xc6, 0xd2, 0x1e, 0x81, 0x27, 0x00, 0x12, 0x28, 0x00,
+    0x12, 0x1e, 0x1d, 0x80, 0x26, 0x00, 0x13, 0x01, 0x80, 0x28, 0x00, 0x13, 0x1d, 0x1c, 0x80, 0x26,
+    0x00, 0x13, 0x03, 0x80, 0x29, 0x00, 0x13, 0x1c, 0x1b, 0x80, 0x25, 0x00, 0x14, 0x05, 0x80, 0x29,
+    0x00, 0x14, 0x1b, 0x1a, 0x80, 0x24, 0x00, 0x14, 0x07, 0x80, 0x2a, 0x00, 0x14, 0x1a, 0x19, 0x80,
+    0x24, 0x00, 0x15, 0x09, 0x80, 0x2b, 0x00, 0x15, 0x19, 0x18, 0x80, 0x23, 0x00, 0x15, 0x0b, 0x80,
+    0x2b, 0x00, 0x15, 0x18, 0x17, 0x80, 0x23, 0x00, 0x16, 0x0d, 0x80, 0x2c, 0x00, 0x16, 0x17, 0x16,
+    0x80, 0x22, 0x00, 0x16, 0x0f, 0x80, 0x2d, 0x00, 0x16, 0x16, 0x15, 0x80, 0x21, 0x00, 0x17, 0x11,
+    0x80, 0x2d, 0x00, 0x17, 0x15, 0x14, 0x80, 0x21, 0x00, 0x17, 0x13, 0x80, 0x2e, 0x00, 0x17, 0x14,
+    0x13, 0x80, 0x20, 0x00, 0x18, 0x15, 0x80, 0x2e, 0x00, 0x18, 0x13, 0x12, 0x80, 0x1f, 0x00, 0x18,
+    0x17, 0x80, 0x2f, 0x00, 0x18, 0x12, 0x12, 0x80, 0x1f, 0x00, 0x19, 0x17, 0x80, 0x2f, 0x00, 0x19,
+    0x12, 0x13, 0x80, 0x20, 0x00, 0x19, 0x15, 0x80, 0x2e, 0x00, 0x19, 0x13, 0x14, 0x80, 0x21, 0x00,
+    0x19, 0x13, 0x80, 0x2e, 0x00, 0x19, 0x14, 0x15, 0x80, 0x21, 0x00, 0x1a, 0x11, 0x80, 0x2d, 0x00,
+    0x1a, 0x15, 0x16, 0x80, 0x22, 0x00, 0x1a, 0x0f, 0x80, 0x2d, 0x00, 0x1a, 0x16, 0x17, 0x80, 0x23,
+    0x00, 0x1b, 0x0d, 0x80, 0x2c, 0x00, 0x1b, 0x17, 0x18, 0x80, 0x23, 0x00, 0x1b, 0x0b, 0x80, 0x2b,
+    0x00, 0x1b, 0x18, 0x19, 0x80, 0x24, 0x00, 0x1c, 0x09, 0x80, 0x2b, 0x00, 0x1c, 0x19, 0x1a, 0x80,
+    0x24, 0x00, 0x1c, 0x07, 0x80, 0x2a, 0x00, 0x1c, 0x1a, 0x1b, 0x80, 0x25, 0x00, 0x1d, 0x05, 0x80,
+    0x29, 0x00, 0x1d, 0x1b, 0x1c, 0x80, 0x26, 0x00, 0x1d, 0x03, 0x80, 0x29, 0x00, 0x1d, 0x1c, 0x1d,
+    0x80, 0x26, 0x00, 0x1e, 0x01, 0x80, 0x28, 0x00, 0x1e, 0x1d, 0x1e, 0x81, 0x27, 0x00, 0x1e, 0x28,
+    0x00, 0x1e, 0x1e, 0x31, 0x82, 0x33, 0x00, 0x1f, 0x33, 0x00, 0x1f, 0x34, 0x00, 0x1f, 0x0a, 0x31,
+    0x82, 0x33, 0x00, 0x1f, 0x33, 0x00, 0x1f, 0x34, 0x00, 0x1f, 0x0a, 0x31, 0x82, 0x33, 0x00, 0x20,
+    0x33, 0x00, 0x20, 0x34, 0x00, 0x20, 0x0a, 0x2f, 0x42, 0x37, 0x37, 0x0d, 0x0c, 0x2d, 0x81, 0x30,
+    0x00, 0x20, 0x31, 0x00, 0x20, 0x42, 0x37, 0x37, 0x0d, 0x0c, 0x2d, 0x81, 0x5f, 0x5f, 0x17, 0x5f,
+    0x5f, 0x17, 0x42, 0x37, 0x37, 0x0d, 0x0c, 0x2a, 0x42, 0x87, 0x87, 0x21, 0x42, 0x5f, 0x5f, 0x17,
+    0x0e, 0x2a, 0x42, 0x87, 0x87, 0x21, 0x42, 0x5f, 0x5f, 0x17, 0x0e, 0x28, 0x81, 0xaf, 0xaf, 0x2b,
+    0xaf, 0xaf, 0x2b, 0x42, 0x87, 0x87, 0x21, 0x11, 0x22, 0x42, 0xff, 0xff, 0x3f, 0x42, 0xd7, 0xd7,
+    0x35, 0x42, 0xaf, 0xaf, 0x2b, 0x13, 0x22, 0x42, 0xff, 0xff, 0x3f, 0x42, 0xd7, 0xd7, 0x35, 0x42,
+    0xaf, 0xaf, 0x2b, 0x13, 0x22, 0x42, 0xff, 0xff, 0x3f, 0x42, 0xd7, 0xd7, 0x35, 0x16, 0xc6, 0xef,
+    0x2f, 0x82, 0x32, 0x00, 0x20, 0x32, 0x00, 0x20, 0x33, 0x00, 0x20, 0x0c, 0x2f, 0x82, 0x32, 0x00,
+    0x20, 0x32, 0x00, 0x20, 0x33, 0x00, 0x20, 0x0c, 0x2c, 0x42, 0x37, 0x37, 0x0d, 0x82, 0x32, 0x00,
+    0x21, 0x32, 0x00, 0x21, 0x33, 0x00, 0x21, 0x0c, 0x2a, 0x81, 0x5f, 0x5f, 0x17, 0x5f, 0x5f, 0x17,
+    0x42, 0x37, 0x37, 0x0d, 0x80, 0x32, 0x00, 0x21, 0x0e, 0x2a, 0x81, 0x5f, 0x5f, 0x17, 0x5f, 0x5f,
+    0x17, 0x42, 0x37, 0x37, 0x0d, 0x80, 0x32, 0x00, 0x22, 0x0e, 0x27, 0x42, 0x87, 0x87, 0x21, 0x42,
+    0x5f, 0x5f, 0x17, 0x11, 0x22, 0x42, 0xd7, 0xd7, 0x35, 0x81, 0xaf, 0xaf, 0x2b, 0xaf, 0xaf, 0x2b,
+    0x42, 0x87, 0x87, 0x21, 0x80, 0x2e, 0x00, 0x23, 0x13, 0x1f, 0x42, 0xff, 0xff, 0x3f, 0x42, 0xd7,
+    0xd7, 0x35, 0x81, 0xaf, 0xaf, 0x2b, 0xaf, 0xaf, 0x2b, 0x42, 0x87, 0x87, 0x21, 0x80, 0x2e, 0x00,
+    0x23, 0x13, 0x1f, 0x42, 0xff, 0xff, 0x3f, 0x42, 0xd7, 0xd7, 0x35, 0x42, 0xaf, 0xaf, 0x2b, 0x16,
+    0x1f, 0x42, 0xff, 0xff, 0x3f, 0x1c, 0xc5, 0xd3, 0x1e, 0x81, 0x27, 0x00, 0x13, 0x28, 0x00, 0x13,
+    0x1e, 0x1d, 0x80, 0x26, 0x00, 0x13, 0x01, 0x80, 0x28, 0x00, 0x13, 0x1d, 0x1c, 0x80, 0x26, 0x00,
+    0x14, 0x03, 0x80, 0x29, 0x00, 0x14, 0x1c, 0x1b, 0x80, 0x25, 0x00, 0x14, 0x05, 0x80, 0x29, 0x00,
+    0x14, 0x1b, 0x1a, 0x80, 0x24, 0x00, 0x15, 0x07, 0x80, 0x2a, 0x00, 0x15, 0x1a, 0x19, 0x80, 0x24,
+    0x00, 0x15, 0x09, 0x80, 0x2b, 0x00, 0x15, 0x19, 0x18, 0x80, 0x23, 0x00, 0x16, 0x0b, 0x80, 0x2b,
+    0x00, 0x16, 0x18, 0x17, 0x80, 0x23, 0x00, 0x16, 0x0d, 0x80, 0x2c, 0x00, 0x16, 0x17, 0x16, 0x80,
+    0x22, 0x00, 0x17, 0x0f, 0x80, 0x2d, 0x00, 0x17, 0x16, 0x15, 0x80, 0x21, 0x00, 0x17, 0x11, 0x80,
+    0x2d, 0x00, 0x17, 0x15, 0x14, 0x80, 0x21, 0x00, 0x18, 0x13, 0x80, 0x2e, 0x00, 0x18, 0x14, 0x13,
+    0x80, 0x20, 0x00, 0x18, 0x15, 0x80, 0x2e, 0x00, 0x18, 0x13, 0x13, 0x80, 0x20, 0x00, 0x19, 0x15,
+    0x80, 0x2e, 0x00, 0x19, 0x13, 0x14, 0x80, 0x21, 0x00, 0x19, 0x13, 0x80, 0x2e, 0x00, 0x19, 0x14,
+    0x15, 0x80, 0x21, 0x00, 0x19, 0x11, 0x80, 0x2d, 0x00, 0x19, 0x15, 0x16, 0x80, 0x22, 0x00, 0x1a,
+    0x0f, 0x80, 0x2d, 0x00, 0x1a, 0x16, 0x17, 0x80, 0x23, 0x00, 0x1a, 0x0d, 0x80, 0x2c, 0x00, 0x1a,
+    0x17, 0x18, 0x80, 0x23, 0x00, 0x1b, 0x0b, 0x80, 0x2b, 0x00, 0x1b, 0x18, 0x19, 0x80, 0x24, 0x00,
+    0x1b, 0x09, 0x80, 0x2b, 0x00, 0x1b, 0x19, 0x1a, 0x80, 0x24, 0x00, 0x1c, 0x07, 0x80, 0x2a, 0x00,
+    0x1c, 0x1a, 0x1b, 0x80, 0x25, 0x00, 0x1c, 0x05, 0x80, 0x29, 0x00, 0x1c, 0x1b, 0x1c, 0x80, 0x26,
+    0x00, 0x1d, 0x03, 0x80, 0x29, 0x00, 0x1d, 0x1c, 0x1d, 0x80, 0x26, 0x00, 0x1d, 0x01, 0x80, 0x28,
+    0x00, 0x1d, 0x1d, 0x1e, 0x81, 0x27, 0x00, 0x1e, 0x28, 0x00, 0x1e, 0x1e, 0xc5, 0x2c, 0x82, 0x30,
+    0x00, 0x21, 0x30, 0x00, 0x21, 0x31, 0x00, 0x21, 0x0f, 0x2a, 0x42, 0x37, 0x37, 0x0d, 0x81, 0x30,
+    0x00, 0x21, 0x31, 0x00, 0x21, 0x0f, 0x2a, 0x42, 0x37, 0x37, 0x0d, 0x81, 0x30, 0x00, 0x22, 0x31,
+    0x00, 0x22, 0x0f, 0x27, 0x42, 0x5f, 0x5f, 0x17, 0x42, 0x37, 0x37, 0x0d, 0x11, 0x22, 0x42, 0xaf,
+    0xaf, 0x2b, 0x81, 0x87, 0x87, 0x21, 0x87, 0x87, 0x21, 0x42, 0x5f, 0x5f, 0x17, 0x14, 0x1c, 0x42,
+    0xff, 0xff, 0x3f, 0x42, 0xd7, 0xd7, 0x35, 0x42, 0xaf, 0xaf, 0x2b, 0x81, 0x87, 0x87, 0x21, 0x87,
+    0x87, 0x21, 0x42, 0x5f, 0x5f, 0x17, 0x14, 0x1c, 0x42, 0xff, 0xff, 0x3f, 0x42, 0xd7, 0xd7, 0x35,
+    0x42, 0xaf, 0xaf, 0x2b, 0x42, 0x87, 0x87, 0x21, 0x16, 0x1c, 0x42, 0xff, 0xff, 0x3f, 0x42, 0xd7,
+    0xd7, 0x35, 0x1c, 0xc5, 0xd4, 0x1e, 0x81, 0x27, 0x00, 0x13, 0x28, 0x00, 0x13, 0x1e, 0x1d, 0x80,
+    0x26, 0x00, 0x14, 0x01, 0x80, 0x28, 0x00, 0x14, 0x1d, 0x1c, 0x80, 0x26, 0x00, 0x14, 0x03, 0x80,
+    0x29, 0x00, 0x14, 0x1c, 0x1b, 0x80, 0x25, 0x00, 0x15, 0x05, 0x80, 0x29, 0x00, 0x15, 0x1b, 0x1a,
+    0x80, 0x24, 0x00, 0x15, 0x07, 0x80, 0x2a, 0x00, 0x15, 0x1a, 0x19, 0x80, 0x24, 0x00, 0x16, 0x09,
+    0x80, 0x2b, 0x00, 0x16, 0x19, 0x18, 0x80, 0x23, 0x00, 0x16, 0x0b, 0x80, 0x2b, 0x00, 0x16, 0x18,
+    0x17, 0x80, 0x23, 0x00, 0x17, 0x0d, 0x80, 0x2c, 0x00, 0x17, 0x17, 0x16, 0x80, 0x22, 0x00, 0x17,
+    0x0f, 0x80, 0x2d, 0x00, 0x17, 0x16, 0x15, 0x80, 0x21, 0x00, 0x18, 0x11, 0x80, 0x2d, 0x00, 0x18,
+    0x15, 0x14, 0x80, 0x21, 0x00, 0x18, 0x13, 0x80, 0x2e, 0x00, 0x18, 0x14, 0x14, 0x80, 0x21, 0x00,
+    0x19, 0x13, 0x80, 0x2e, 0x00, 0x19, 0x14, 0x15, 0x80, 0x21, 0x00, 0x19, 0x11, 0x80, 0x2d, 0x00,
+    0x19, 0x15, 0x16, 0x80, 0x22, 0x00, 0x19, 0x0f, 0x80, 0x2d, 0x00, 0x19, 0x16, 0x17, 0x80, 0x23,
+    0x00, 0x1a, 0x0d, 0x80, 0x2c, 0x00, 0x1a, 0x17, 0x18, 0x80, 0x23, 0x00, 0x1a, 0x0b, 0x80, 0x2b,
+    0x00, 0x1a, 0x18, 0x19, 0x80, 0x24, 0x00, 0x1b, 0x09, 0x80, 0x2b, 0x00, 0x1b, 0x19, 0x1a, 0x80,
+    0x24, 0x00, 0x1b, 0x07, 0x80, 0x2a, 0x00, 0x1b, 0x1a, 0x1b, 0x80, 0x25, 0x00, 0x1c, 0x05, 0x80,
+    0x29, 0x00, 0x1c, 0x1b, 0x1c, 0x80, 0x26, 0x00, 0x1c, 0x03, 0x80, 0x29, 0x00, 0x1c, 0x1c, 0x1d,
+    0x80, 0x26, 0x00, 0x1d, 0x01, 0x80, 0x28, 0x00, 0x1d, 0x1d, 0x1e, 0x81, 0x27, 0x00, 0x1d, 0x28,
+    0x00, 0x1d, 0x1e, 0xc7, 0x2a, 0x82, 0x2e, 0x00, 0x21, 0x2f, 0x00, 0x21, 0x30, 0x00, 0x21, 0x11,
+    0x2a, 0x82, 0x2e, 0x00, 0x22, 0x2f, 0x00, 0x22, 0x30, 0x00, 0x22, 0x11, 0x27, 0x42, 0x37, 0x37,
+    0x0d, 0x82, 0x2e, 0x00, 0x22, 0x2f, 0x00, 0x22, 0x30, 0x00, 0x22, 0x11, 0x19, 0x42, 0xff, 0xff,
+    0x3f, 0x05, 0x81, 0x87, 0x87, 0x21, 0x87, 0x87, 0x21, 0x42, 0x5f, 0x5f, 0x17, 0x42, 0x37, 0x37,
+    0x0d, 0x14, 0x19, 0x42, 0xff, 0xff, 0x3f, 0x42, 0xd7, 0xd7, 0x35, 0x42, 0xaf, 0xaf, 0x2b, 0x81,
+    0x87, 0x87, 0x21, 0x87, 0x87, 0x21, 0x42, 0x5f, 0x5f, 0x17, 0x42, 0x37, 0x37, 0x0d, 0x14, 0x19,
+    0x42, 0xff, 0xff, 0x3f, 0x42, 0xd7, 0xd7, 0x35, 0x42, 0xaf, 0xaf, 0x2b, 0x81, 0x87, 0x87, 0x21,
+    0x87, 0x87, 0x21, 0x42, 0x5f, 0x5f, 0x17, 0x80, 0x2d, 0x00, 0x24, 0x16, 0x1c, 0x42, 0xd7, 0xd7,
+    0x35, 0x42, 0xaf, 0xaf, 0x2b, 0x1c, 0xc5, 0xd5, 0x1e, 0x81, 0x27, 0x00, 0x14, 0x28, 0x00, 0x14,
+    0x1e, 0x1d, 0x80, 0x26, 0x00, 0x14, 0x01, 0x80, 0x28, 0x00, 0x14, 0x1d, 0x1c, 0x80, 0x26, 0x00,
+    0x15, 0x03, 0x80, 0x29, 0x00, 0x15, 0x1c, 0x1b, 0x80, 0x25, 0x00, 0x15, 0x05, 0x80, 0x29, 0x00,
+    0x15, 0x1b, 0x1a, 0x80, 0x24, 0x00, 0x16, 0x07, 0x80, 0x2a, 0x00, 0x16, 0x1a, 0x19, 0x80, 0x24,
+    0x00, 0x16, 0x09, 0x80, 0x2b, 0x00, 0x16, 0x19, 0x18, 0x80, 0x23, 0x00, 0x17, 0x0b, 0x80, 0x2b,
+    0x00, 0x17, 0x18, 0x17, 0x80, 0x23, 0x00, 0x17, 0x0d, 0x80, 0x2c, 0x00, 0x17, 0x17, 0x16, 0x80,
+    0x22, 0x00, 0x18, 0x0f, 0x80, 0x2d, 0x00, 0x18, 0x16, 0x15, 0x80, 0x21, 0x00, 0x18, 0x11, 0x80,
+    0x2d, 0x00, 0x18, 0x15, 0x15, 0x80, 0x21, 0x00, 0x19, 0x11, 0x80, 0x2d, 0x00, 0x19, 0x15, 0x16,
+    0x80, 0x22, 0x00, 0x19, 0x0f, 0x80, 0x2d, 0x00, 0x19, 0x16, 0x17, 0x80, 0x23, 0x00, 0x19, 0x0d,
+    0x80, 0x2c, 0x00, 0x19, 0x17, 0x18, 0x80, 0x23, 0x00, 0x1a, 0x0b, 0x80, 0x2b, 0x00, 0x1a, 0x18,
+    0x19, 0x80, 0x24, 0x00, 0x1a, 0x09, 0x80, 0x2b, 0x00, 0x1a, 0x19, 0x1a, 0x80, 0x24, 0x00, 0x1b,
+    0x07, 0x80, 0x2a, 0x00, 0x1b, 0x1a, 0x1b, 0x80, 0x25, 0x00, 0x1b, 0x05, 0x80, 0x29, 0x00, 0x1b,
+    0x1b, 0x1c, 0x80, 0x26, 0x00, 0x1c, 0x03, 0x80, 0x29, 0x00, 0x1c, 0x1c, 0x1d, 0x80, 0x26, 0x00,
+    0x1c, 0x01, 0x80, 0x28, 0x00, 0x1c, 0x1d, 0x1e, 0x81, 0x27, 0x00, 0x1d, 0x28, 0x00, 0x1d, 0x1e,
+    0xca, 0x27, 0x82, 0x2d, 0x00, 0x22, 0x2d, 0x00, 0x22, 0x2e, 0x00, 0x22, 0x14, 0x16, 0x42, 0xff,
+    0xff, 0x3f, 0x42, 0xd7, 0xd7, 0x35, 0x05, 0x81, 0x5f, 0x5f, 0x17, 0x5f, 0x5f, 0x17, 0x42, 0x37,
+    0x37, 0x0d, 0x82, 0x2d, 0x00, 0x23, 0x2d, 0x00, 0x23, 0x2e, 0x00, 0x23, 0x14, 0x16, 0x42, 0xff,
+    0xff, 0x3f, 0x42, 0xd7, 0xd7, 0x35, 0x42, 0xaf, 0xaf, 0x2b, 0x42, 0x87, 0x87, 0x21, 0x81, 0x5f,
+    0x5f, 0x17, 0x5f, 0x5f, 0x17, 0x42, 0x37, 0x37, 0x0d, 0x82, 0x2d, 0x00, 0x23, 0x2d, 0x00, 0x23,
+    0x2e, 0x00, 0x23, 0x14, 0x16, 0x42, 0xff, 0xff, 0x3f, 0x42, 0xd7, 0xd7, 0x35, 0x42, 0xaf, 0xaf,
+    0x2b, 0x42, 0x87, 0x87, 0x21, 0x81, 0x5f, 0x5f, 0x17, 0x5f, 0x5f, 0x17, 0x42, 0x37, 0x37, 0x0d,
+    0x17, 0x1c, 0x42, 0xaf, 0xaf, 0x2b, 0x42, 0x87, 0x87, 0x21, 0x1c, 0xc5, 0xd6, 0x1e, 0x81, 0x27,
+    0x00, 0x14, 0x28, 0x00, 0x14, 0x1e, 0x1d, 0x80, 0x26, 0x00, 0x15, 0x01, 0x80, 0x28, 0x00, 0x15,
+    0x1d, 0x1c, 0x80, 0x26, 0x00, 0x15, 0x03, 0x80, 0x29, 0x00, 0x15, 0x1c, 0x1b, 0x80, 0x25, 0x00,
+    0x16, 0x05, 0x80, 0x29, 0x00, 0x16, 0x1b, 0x1a, 0x80, 0x24, 0x00, 0x16, 0x07, 0x80, 0x2a, 0x00,
+    0x16, 0x1a, 0x19, 0x80, 0x24, 0x00, 0x17, 0x09, 0x80, 0x2b, 0x00, 0x17, 0x19, 0x18, 0x80, 0x23,
+    0x00, 0x17, 0x0b, 0x80, 0x2b, 0x00, 0x17, 0x18, 0x17, 0x80, 0x23, 0x00, 0x18, 0x0d, 0x80, 0x2c,
+    0x00, 0x18, 0x17, 0x16, 0x80, 0x22, 0x00, 0x18, 0x0f, 0x80, 0x2d, 0x00, 0x18, 0x16, 0x16, 0x80,
+    0x22, 0x00, 0x19, 0x0f, 0x80, 0x2d, 0x00, 0x19, 0x16, 0x17, 0x80, 0x23, 0x00, 0x19, 0x0d, 0x80,
+    0x2c, 0x00, 0x19, 0x17, 0x18, 0x80, 0x23, 0x00, 0x19, 0x0b, 0x80, 0x2b, 0x00, 0x19, 0x18, 0x19,
+    0x80, 0x24, 0x00, 0x1a, 0x09, 0x80, 0x2b, 0x00, 0x1a, 0x19, 0x1a, 0x80, 0x24, 0x00, 0x1a, 0x07,
+    0x80, 0x2a, 0x00, 0x1a, 0x1a, 0x1b, 0x80, 0x25, 0x00, 0x1b, 0x05, 0x80, 0x29, 0x00, 0x1b, 0x1b,
+    0x1c, 0x80, 0x26, 0x00, 0x1b, 0x03, 0x80, 0x29, 0x00, 0x1b, 0x1c, 0x1d, 0x80, 0x26, 0x00, 0x1c,
+    0x01, 0x80, 0x28, 0x00, 0x1c, 0x1d, 0x1e, 0x81, 0x27, 0x00, 0x1c, 0x28, 0x00, 0x1c, 0x1e, 0xcb,
+    0x13, 0x42, 0xff, 0xff, 0x3f, 0x28, 0x13, 0x42, 0xff, 0xff, 0x3f, 0x42, 0xd7, 0xd7, 0x35, 0x42,
+    0xaf, 0xaf, 0x2b, 0x05, 0x84, 0x29, 0x00, 0x23, 0x2a, 0x00, 0x23, 0x2b, 0x00, 0x23, 0x2b, 0x00,
+    0x23, 0x2c, 0x00, 0x23, 0x17, 0x13, 0x42, 0xff, 0xff, 0x3f, 0x42, 0xd7, 0xd7, 0x35, 0x42, 0xaf,
+    0xaf, 0x2b, 0x81, 0x87, 0x87, 0x21, 0x87, 0x87, 0x21, 0x42, 0x5f, 0x5f, 0x17, 0x42, 0x37, 0x37,
+    0x0d, 0x82, 0x2b, 0x00, 0x23, 0x2b, 0x00, 0x23, 0x2c, 0x00, 0x23, 0x17, 0x16, 0x42, 0xd7, 0xd7,
+    0x35, 0x42, 0xaf, 0xaf, 0x2b, 0x81, 0x87, 0x87, 0x21, 0x87, 0x87, 0x21, 0x42, 0x5f, 0x5f, 0x17,
+    0x42, 0x37, 0x37, 0x0d, 0x82, 0x2b, 0x00, 0x24, 0x2b, 0x00, 0x24, 0x2c, 0x00, 0x24, 0x17, 0x1c,
+    0x81, 0x87, 0x87, 0x21, 0x87, 0x87, 0x21, 0x42, 0x5f, 0x5f, 0x17, 0x42, 0x37, 0x37, 0x0d, 0x1a,
+    0xc5, 0xf2, 0x10, 0x42, 0xff, 0xff, 0x3f, 0x2b, 0x10, 0x42, 0xff, 0xff, 0x3f, 0x42, 0xd7, 0xd7,
+    0x35, 0x28, 0x10, 0x42, 0xff, 0xff, 0x3f, 0x42, 0xd7, 0xd7, 0x35, 0x28, 0x13, 0x42, 0xd7, 0xd7,
+    0x35, 0x42, 0xaf, 0xaf, 0x2b, 0x42, 0x87, 0x87, 0x21, 0x22, 0x13, 0x82, 0x20, 0x00, 0x23, 0x21,
+    0x00, 0x23, 0x21, 0x00, 0x23, 0x42, 0xaf, 0xaf, 0x2b, 0x81, 0x87, 0x87, 0x21, 0x87, 0x87, 0x21,
+    0x42, 0x5f, 0x5f, 0x17, 0x42, 0x37, 0x37, 0x0d, 0x82, 0x29, 0x00, 0x23, 0x29, 0x00, 0x23, 0x2a,
+    0x00, 0x23, 0x1a, 0x16, 0x42, 0xaf, 0xaf, 0x2b, 0x81, 0x87, 0x87, 0x21, 0x87, 0x87, 0x21, 0x42,
+    0x5f, 0x5f, 0x17, 0x42, 0x37, 0x37, 0x0d, 0x82, 0x29, 0x00, 0x24, 0x29, 0x00, 0x24, 0x2a, 0x00,
+    0x24, 0x1a, 0x1b, 0x42, 0x5f, 0x5f, 0x17, 0x42, 0x37, 0x37, 0x0d, 0x82, 0x29, 0x00, 0x24, 0x29,
+    0x00, 0x24, 0x2a, 0x00, 0x24, 0x1a, 0xc5, 0xd7, 0x1e, 0x81, 0x27, 0x00, 0x15, 0x28, 0x00, 0x15,
+    0x1e, 0x1d, 0x80, 0x26, 0x00, 0x15, 0x01, 0x80, 0x28, 0x00, 0x15, 0x1d, 0x1c, 0x80, 0x26, 0x00,
+    0x16, 0x03, 0x80, 0x29, 0x00, 0x16, 0x1c, 0x1b, 0x80, 0x25, 0x00, 0x16, 0x05, 0x80, 0x29, 0x00,
+    0x16, 0x1b, 0x1a, 0x80, 0x24, 0x00, 0x17, 0x07, 0x80, 0x2a, 0x00, 0x17, 0x1a, 0x19, 0x80, 0x24,
+    0x00, 0x17, 0x09, 0x80, 0x2b, 0x00, 0x17, 0x19, 0x18, 0x80, 0x23, 0x00, 0x18, 0x0b, 0x80, 0x2b,
+    0x00, 0x18, 0x18, 0x17, 0x80, 0x23, 0x00, 0x18, 0x0d, 0x80, 0x2c, 0x00, 0x18, 0x17, 0x17, 0x80,
+    0x23, 0x00, 0x19, 0x0d, 0x80, 0x2c, 0x00, 0x19, 0x17, 0x18, 0x80, 0x23, 0x00, 0x19, 0x0b, 0x80,
+    0x2b, 0x00, 0x19, 0x18, 0x19, 0x80, 0x24, 0x00, 0x19, 0x09, 0x80, 0x2b, 0x00, 0x19, 0x19, 0x1a,
+    0x80, 0x24, 0x00, 0x1a, 0x07, 0x80, 0x2a, 0x00, 0x1a, 0x1a, 0x1b, 0x80, 0x25, 0x00, 0x1a, 0x05,
+    0x80, 0x29, 0x00, 0x1a, 0x1b, 0x1c, 0x80, 0x26, 0x00, 0x1b, 0x03, 0x80, 0x29, 0x00, 0x1b, 0x1c,
+    0x1d, 0x80, 0x26, 0x00, 0x1b, 0x01, 0x80, 0x28, 0x00, 0x1b, 0x1d, 0x1e, 0x81, 0x27, 0x00, 0x1c,
+    0x28, 0x00, 0x1c, 0x1e, 0xc8, 0x0e, 0x42, 0xff, 0xff, 0x3f, 0x2d, 0x0e, 0x42, 0xff, 0xff, 0x3f,
+    0x2d, 0x0e, 0x81, 0xff, 0xff, 0x3f, 0xff, 0xff, 0x3f, 0x42, 0xd7, 0xd7, 0x35, 0x2b, 0x10, 0x42,
+    0xd7, 0xd7, 0x35, 0x42, 0xaf, 0xaf, 0x2b, 0x28, 0x10, 0x42, 0xd7, 0xd7, 0x35, 0x42, 0xaf, 0xaf,
+    0x2b, 0x42, 0x87, 0x87, 0x21, 0x25, 0x13, 0x42, 0xaf, 0xaf, 0x2b, 0x81, 0x87, 0x87, 0x21, 0x87,
+    0x87, 0x21, 0x42, 0x5f, 0x5f, 0x17, 0x80, 0x25, 0x00, 0x23, 0x22, 0x16, 0x81, 0x87, 0x87, 0x21,
+    0x87, 0x87, 0x21, 0x42, 0x5f, 0x5f, 0x17, 0x42, 0x37, 0x37, 0x0d, 0x82, 0x27, 0x00, 0x23, 0x28,
+    0x00, 0x23, 0x28, 0x00, 0x23, 0x1d, 0x16, 0x81, 0x22, 0x00, 0x24, 0x23, 0x00, 0x24, 0x42, 0x5f,
+    0x5f, 0x17, 0x42, 0x37, 0x37, 0x0d, 0x82, 0x27, 0x00, 0x24, 0x28, 0x00, 0x24, 0x28, 0x00, 0x24,
+    0x1d, 0x1b, 0x42, 0x37, 0x37, 0x0d, 0x82, 0x27, 0x00, 0x24, 0x28, 0x00, 0x24, 0x28, 0x00, 0x24,
+    0x1d, 0xc5, 0xee, 0x0c, 0x42, 0xff, 0xff, 0x3f, 0x2f, 0x0c, 0x42, 0xff, 0xff, 0x3f, 0x2f, 0x0c,
+    0x81, 0xff, 0xff, 0x3f, 0xff, 0xff, 0x3f, 0x42, 0xd7, 0xd7, 0x35, 0x2d, 0x0e, 0x42, 0xd7, 0xd7,
+    0x35, 0x2d, 0x0e, 0x81, 0xd7, 0xd7, 0x35, 0xd7, 0xd7, 0x35, 0x42, 0xaf, 0xaf, 0x2b, 0x2b, 0x10,
+    0x42, 0xaf, 0xaf, 0x2b, 0x42, 0x87, 0x87, 0x21, 0x28, 0x10, 0x42, 0xaf, 0xaf, 0x2b, 0x81, 0x87,
+    0x87, 0x21, 0x87, 0x87, 0x21, 0x42, 0x5f, 0x5f, 0x17, 0x80, 0x23, 0x00, 0x22, 0x25, 0x13, 0x81,
+    0x87, 0x87, 0x21, 0x87, 0x87, 0x21, 0x42, 0x5f, 0x5f, 0x17, 0x42, 0x37, 0x37, 0x0d, 0x23, 0x15,
+    0x42, 0x5f, 0x5f, 0x17, 0x42, 0x37, 0x37, 0x0d, 0x82, 0x25, 0x00, 0x23, 0x26, 0x00, 0x23, 0x26,
+    0x00, 0x23, 0x20, 0x18, 0x42, 0x37, 0x37, 0x0d, 0x82, 0x25, 0x00, 0x24, 0x26, 0x00, 0x24, 0x26,
+    0x00, 0x24, 0x20, 0x1b, 0x82, 0x25, 0x00, 0x24, 0x26, 0x00, 0x24, 0x26, 0x00, 0x24, 0x20, 0xc5,
+    0xec, 0x0a, 0x42, 0xff, 0xff, 0x3f, 0x31, 0x0a, 0x42, 0xff, 0xff, 0x3f, 0x31, 0x0a, 0x81, 0xff,
+    0xff, 0x3f, 0xff, 0xff, 0x3f, 0x42, 0xd7, 0xd7, 0x35, 0x2f, 0x0c, 0x42, 0xd7, 0xd7, 0x35, 0x2f,
+    0x0c, 0x81, 0xd7, 0xd7, 0x35, 0xd7, 0xd7, 0x35, 0x42, 0xaf, 0xaf, 0x2b, 0x2d, 0x0e, 0x42, 0xaf,
+    0xaf, 0x2b, 0x2d, 0x0e, 0x81, 0xaf, 0xaf, 0x2b, 0xaf, 0xaf, 0x2b, 0x42, 0x87, 0x87, 0x21, 0x2b,
+    0x10, 0x42, 0x87, 0x87, 0x21, 0x42, 0x5f, 0x5f, 0x17, 0x28, 0x10, 0x42, 0x87, 0x87, 0x21, 0x81,
+    0x5f, 0x5f, 0x17, 0x5f, 0x5f, 0x17, 0x42, 0x37, 0x37, 0x0d, 0x26, 0x13, 0x81, 0x5f, 0x5f, 0x17,
+    0x5f, 0x5f, 0x17, 0x42, 0x37, 0x37, 0x0d, 0x82, 0x23, 0x00, 0x23, 0x24, 0x00, 0x23, 0x24, 0x00,
+    0x23, 0x23, 0x15, 0x42, 0x37, 0x37, 0x0d, 0x82, 0x23, 0x00, 0x23, 0x24, 0x00, 0x23, 0x24, 0x00,
+    0x23, 0x23, 0x18, 0x82, 0x23, 0x00, 0x24, 0x24, 0x00, 0x24, 0x24, 0x00, 0x24, 0x23, 0xc6, 0xd7,
+    0x1e, 0x81, 0x00, 0xa0, 0xff, 0x00, 0xa0, 0xff, 0x1e, 0x1d, 0x43, 0x00, 0xa0, 0xff, 0x1d, 0x1c,
+    0x45, 0x00, 0xa0, 0xff, 0x1c, 0x1b, 0x47, 0x00, 0xa0, 0xff, 0x1b, 0x1a, 0x49, 0x00, 0xa0, 0xff,
+    0x1a, 0x19, 0x4b, 0x00, 0xa0, 0xff, 0x19, 0x18, 0x4d, 0x00, 0xa0, 0xff, 0x18, 0x17, 0x4f, 0x00,
+    0xa0, 0xff, 0x17, 0x17, 0x4f, 0x00, 0xa0, 0xff, 0x17, 0x18, 0x4d, 0x00, 0xa0, 0xff, 0x18, 0x19,
+    0x4b, 0x00, 0xa0, 0xff, 0x19, 0x1a, 0x49, 0x00, 0xa0, 0xff, 0x1a, 0x1b, 0x47, 0x00, 0xa0, 0xff,
+    0x1b, 0x1c, 0x45, 0x00, 0xa0, 0xff, 0x1c, 0x1d, 0x43, 0x00, 0xa0, 0xff, 0x1d, 0x1e, 0x81, 0x00,
+    0xa0, 0xff, 0x00, 0xa0, 0xff, 0x1e, 0xc1, 0x08, 0x42, 0xff, 0xff, 0x3f, 0x33, 0x08, 0x42, 0xff,
+    0xff, 0x3f, 0x33, 0x08, 0x42, 0xff, 0xff, 0x3f, 0x33, 0x0a, 0x42, 0xd7, 0xd7, 0x35, 0x31, 0x0a,
+    0x42, 0xd7, 0xd7, 0x35, 0x31, 0x0a, 0x81, 0xd7, 0xd7, 0x35, 0xd7, 0xd7, 0x35, 0x42, 0xaf, 0xaf,
+    0x2b, 0x2f, 0x0c, 0x42, 0xaf, 0xaf, 0x2b, 0x2f, 0x0c, 0x81, 0xaf, 0xaf, 0x2b, 0xaf, 0xaf, 0x2b,
+    0x42, 0x87, 0x87, 0x21, 0x2d, 0x0e, 0x42, 0x87, 0x87, 0x21, 0x2d, 0x0e, 0x81, 0x87, 0x87, 0x21,
+    0x87, 0x87, 0x21, 0x42, 0x5f, 0x5f, 0x17, 0x2b, 0x10, 0x42, 0x5f, 0x5f, 0x17, 0x42, 0x37, 0x37,
+    0x0d, 0x28, 0x10, 0x42, 0x5f, 0x5f, 0x17, 0x42, 0x37, 0x37, 0x0d, 0x81, 0x22, 0x00, 0x22, 0x23,
+    0x00, 0x22, 0x26, 0x13, 0x42, 0x37, 0x37, 0x0d, 0x81, 0x22, 0x00, 0x23, 0x23, 0x00, 0x23, 0x26,
+    0x15, 0x82, 0x21, 0x00, 0x23, 0x22, 0x00, 0x23, 0x23, 0x00, 0x23, 0x26, 0xc7, 0xe6, 0x07, 0x42,
+    0xff, 0xff, 0x3f, 0x34, 0x07, 0x42, 0xff, 0xff, 0x3f, 0x34, 0x07, 0x42, 0xff, 0xff, 0x3f, 0x34,
+    0x08, 0x42, 0xd7, 0xd7, 0x35, 0x33, 0x08, 0x42, 0xd7, 0xd7, 0x35, 0x33, 0x08, 0x42, 0xd7, 0xd7,
+    0x35, 0x33, 0x0a, 0x42, 0xaf, 0xaf, 0x2b, 0x31, 0x0a, 0x42, 0xaf, 0xaf, 0x2b, 0x31, 0x0a, 0x80,
+    0xaf, 0xaf, 0x2b, 0x42, 0x87, 0x87, 0x21, 0x80, 0x1d, 0x00, 0x20, 0x2f, 0x0b, 0x42, 0x87, 0x87,
+    0x21, 0x80, 0x1d, 0x00, 0x20, 0x2f, 0x0b, 0x42, 0x87, 0x87, 0x21, 0x42, 0x5f, 0x5f, 0x17, 0x2d,
+    0x0e, 0x42, 0x5f, 0x5f, 0x17, 0x2d, 0x0e, 0x81, 0x5f, 0x5f, 0x17, 0x5f, 0x5f, 0x17, 0x42, 0x37,
+    0x37, 0x0d, 0x2b, 0x10, 0x42, 0x37, 0x37, 0x0d, 0x82, 0x20, 0x00, 0x22, 0x21, 0x00, 0x22, 0x21,
+    0x00, 0x22, 0x28, 0x10, 0x42, 0x37, 0x37, 0x0d, 0x82, 0x20, 0x00, 0x22, 0x21, 0x00, 0x22, 0x21,
+    0x00, 0x22, 0x28, 0x13, 0x82, 0x20, 0x00, 0x23, 0x21, 0x00, 0x23, 0x21, 0x00, 0x23, 0x28, 0xc8,
+    0xd6, 0x1e, 0x81, 0x00, 0xa0, 0xff, 0x00, 0xa0, 0xff, 0x1e, 0x1d, 0x43, 0x00, 0xa0, 0xff, 0x1d,
+    0x1c, 0x45, 0x00, 0xa0, 0xff, 0x1c, 0x1b, 0x47, 0x00, 0xa0, 0xff, 0x1b, 0x1a, 0x49, 0x00, 0xa0,
+    0xff, 0x1a, 0x19, 0x4b, 0x00, 0xa0, 0xff, 0x19, 0x18, 0x4d, 0x00, 0xa0, 0xff, 0x18, 0x17, 0x4f,
+    0x00, 0xa0, 0xff, 0x17, 0x16, 0x51, 0x00, 0xa0, 0xff, 0x16, 0x16, 0x51, 0x00, 0xa0, 0xff, 0x16,
+    0x17, 0x4f, 0x00, 0xa0, 0xff, 0x17, 0x18, 0x4d, 0x00, 0xa0, 0xff, 0x18, 0x19, 0x4b, 0x00, 0xa0,
+    0xff, 0x19, 0x1a, 0x49, 0x00, 0xa0, 0xff, 0x1a, 0x06, 0x42, 0xff, 0xff, 0x3f, 0x11, 0x47, 0x00,
+    0xa0, 0xff, 0x1b, 0x06, 0x42, 0xff, 0xff, 0x3f, 0x12, 0x45, 0x00, 0xa0, 0xff, 0x1c, 0x06, 0x80,
+    0xff, 0xff, 0x3f, 0x42, 0xd7, 0xd7, 0x35, 0x12, 0x43, 0x00, 0xa0, 0xff, 0x1d, 0x07, 0x42, 0xd7,
+    0xd7, 0x35, 0x13, 0x81, 0x00, 0xa0, 0xff, 0x00, 0xa0, 0xff, 0x1e, 0x07, 0x42, 0xd7, 0xd7, 0x35,
+    0x34, 0x08, 0x42, 0xaf, 0xaf, 0x2b, 0x33, 0x08, 0x42, 0xaf, 0xaf, 0x2b, 0x33, 0x08, 0x81, 0xaf,
+    0xaf, 0x2b, 0xaf, 0xaf, 0x2b, 0x42, 0x87, 0x87, 0x21, 0x31, 0x0a, 0x42, 0x87, 0x87, 0x21, 0x31,
+    0x0a, 0x42, 0x87, 0x87, 0x21, 0x31, 0x0a, 0x80, 0x1a, 0x00, 0x20, 0x42, 0x5f, 0x5f, 0x17, 0x30,
+    0x0b, 0x42, 0x5f, 0x5f, 0x17, 0x30, 0x0b, 0x81, 0x5f, 0x5f, 0x17, 0x5f, 0x5f, 0x17, 0x42, 0x37,
+    0x37, 0x0d, 0x80, 0x1e, 0x00, 0x20, 0x2d, 0x0d, 0x42, 0x37, 0x37, 0x0d, 0x80, 0x1e, 0x00, 0x21,
+    0x2d, 0x0d, 0x42, 0x37, 0x37, 0x0d, 0x82, 0x1e, 0x00, 0x21, 0x1f, 0x00, 0x21, 0x1f, 0x00, 0x21,
+    0x2b, 0x10, 0x82, 0x1e, 0x00, 0x22, 0x1f, 0x00, 0x22, 0x1f, 0x00, 0x22, 0x2b, 0x10, 0x82, 0x1e,
+    0x00, 0x22, 0x1f, 0x00, 0x22, 0x1f, 0x00, 0x22, 0x2b, 0xc9, 0xd5, 0x1e, 0x81, 0x00, 0xa0, 0xff,
+    0x00, 0xa0, 0xff, 0x1e, 0x1d, 0x43, 0x00, 0xa0, 0xff, 0x1d, 0x1c, 0x45, 0x00, 0xa0, 0xff, 0x1c,
+    0x1b, 0x47, 0x00, 0xa0, 0xff, 0x1b, 0x1a, 0x49, 0x00, 0xa0, 0xff, 0x1a, 0x19, 0x4b, 0x00, 0xa0,
+    0xff, 0x19, 0x18, 0x4d, 0x00, 0xa0, 0xff, 0x18, 0x17, 0x4f, 0x00, 0xa0, 0xff, 0x17, 0x16, 0x51,
+    0x00, 0xa0, 0xff, 0x16, 0x15, 0x53, 0x00, 0xa0, 0xff, 0x15, 0x15, 0x53, 0x00, 0xa0, 0xff, 0x15,
+    0x16, 0x51, 0x00, 0xa0, 0xff, 0x16, 0x05, 0x42, 0xff, 0xff, 0x3f, 0x0e, 0x4f, 0x00, 0xa0, 0xff,
+    0x17, 0x05, 0x42, 0xff, 0xff, 0x3f, 0x0f, 0x4d, 0x00, 0xa0, 0xff, 0x18, 0x05, 0x80, 0xff, 0xff,
+    0x3f, 0x42, 0xd7, 0xd7, 0x35, 0x0f, 0x4b, 0x00, 0xa0, 0xff, 0x19, 0x06, 0x42, 0xd7, 0xd7, 0x35,
+    0x10, 0x49, 0x00, 0xa0, 0xff, 0x1a, 0x06, 0x42, 0xd7, 0xd7, 0x35, 0x11, 0x47, 0x00, 0xa0, 0xff,
+    0x1b, 0x06, 0x80, 0x18, 0x00, 0x1c, 0x42, 0xaf, 0xaf, 0x2b, 0x11, 0x45, 0x00, 0xa0, 0xff, 0x1c,
+    0x07, 0x42, 0xaf, 0xaf, 0x2b, 0x12, 0x43, 0x00, 0xa0, 0xff, 0x1d, 0x07, 0x42, 0xaf, 0xaf, 0x2b,
+    0x13, 0x81, 0x00, 0xa0, 0xff, 0x00, 0xa0, 0xff, 0x1e, 0x08, 0x42, 0x87, 0x87, 0x21, 0x33, 0x08,
+    0x42, 0x87, 0x87, 0x21, 0x33, 0x08, 0x81, 0x87, 0x87, 0x21, 0x87, 0x87, 0x21, 0x42, 0x5f, 0x5f,
+    0x17, 0x31, 0x0a, 0x42, 0x5f, 0x5f, 0x17, 0x31, 0x0a, 0x42, 0x5f, 0x5f, 0x17, 0x31, 0x0b, 0x42,
+    0x37, 0x37, 0x0d, 0x30, 0x0b, 0x42, 0x37, 0x37, 0x0d, 0x30, 0x0b, 0x42, 0x37, 0x37, 0x0d, 0x81,
+    0x1d, 0x00, 0x20, 0x1e, 0x00, 0x20, 0x2e, 0x0d, 0x82, 0x1c, 0x00, 0x21, 0x1d, 0x00, 0x21, 0x1e,
+    0x00, 0x21, 0x2e, 0x0d, 0x82, 0x1c, 0x00, 0x21, 0x1d, 0x00, 0x21, 0x1e, 0x00, 0x21, 0x2e, 0xcb,
+    0xd4, 0x1e, 0x81, 0x00, 0xa0, 0xff, 0x00, 0xa0, 0xff, 0x1e, 0x1d, 0x43, 0x00, 0xa0, 0xff, 0x1d,
+    0x1c, 0x45, 0x00, 0xa0, 0xff, 0x1c, 0x1b, 0x47, 0x00, 0xa0, 0xff, 0x1b, 0x1a, 0x49, 0x00, 0xa0,
+    0xff, 0x1a, 0x19, 0x4b, 0x00, 0xa0, 0xff, 0x19, 0x18, 0x4d, 0x00, 0xa0, 0xff, 0x18, 0x17, 0x4f,
+    0x00, 0xa0, 0xff, 0x17, 0x16, 0x51, 0x00, 0xa0, 0xff, 0x16, 0x15, 0x53, 0x00, 0xa0, 0xff, 0x15,
+    0x05, 0x42, 0xff, 0xff, 0x3f, 0x0b, 0x55, 0x00, 0xa0, 0xff, 0x14, 0x05, 0x42, 0xff, 0xff, 0x3f,
+    0x0b, 0x55, 0x00, 0xa0, 0xff, 0x14, 0x05, 0x42, 0xd7, 0xd7, 0x35, 0x0c, 0x53, 0x00, 0xa0, 0xff,
+    0x15, 0x05, 0x42, 0xd7, 0xd7, 0x35, 0x0d, 0x51, 0x00, 0xa0, 0xff, 0x16, 0x05, 0x42, 0xd7, 0xd7,
+    0x35, 0x0e, 0x4f, 0x00, 0xa0, 0xff, 0x17, 0x05, 0x80, 0x17, 0x00, 0x1a, 0x42, 0xaf, 0xaf, 0x2b,
+    0x0e, 0x4d, 0x00, 0xa0, 0xff, 0x18, 0x06, 0x42, 0xaf, 0xaf, 0x2b, 0x0f, 0x4b, 0x00, 0xa0, 0xff,
+    0x19, 0x06, 0x42, 0xaf, 0xaf, 0x2b, 0x10, 0x49, 0x00, 0xa0, 0xff, 0x1a, 0x07, 0x42, 0x87, 0x87,
+    0x21, 0x10, 0x47, 0x00, 0xa0, 0xff, 0x1b, 0x07, 0x42, 0x87, 0x87, 0x21, 0x11, 0x45, 0x00, 0xa0,
+    0xff, 0x1c, 0x07, 0x42, 0x87, 0x87, 0x21, 0x12, 0x43, 0x00, 0xa0, 0xff, 0x1d, 0x08, 0x42, 0x5f,
+    0x5f, 0x17, 0x12, 0x81, 0x00, 0xa0, 0xff, 0x00, 0xa0, 0xff, 0x1e, 0x08, 0x42, 0x5f, 0x5f, 0x17,
+    0x33, 0x08, 0x80, 0x5f, 0x5f, 0x17, 0x42, 0x37, 0x37, 0x0d, 0x80, 0x1c, 0x00, 0x1e, 0x31, 0x09,
+    0x42, 0x37, 0x37, 0x0d, 0x80, 0x1c, 0x00, 0x1f, 0x31, 0x09, 0x42, 0x37, 0x37, 0x0d, 0x80, 0x1c,
+    0x00, 0x1f, 0x31, 0x0b, 0x82, 0x1b, 0x00, 0x20, 0x1c, 0x00, 0x20, 0x1c, 0x00, 0x20, 0x30, 0x0b,
+    0x82, 0x1b, 0x00, 0x20, 0x1c, 0x00, 0x20, 0x1c, 0x00, 0x20, 0x30, 0x0b, 0x82, 0x1b, 0x00, 0x20,
+    0x1c, 0x00, 0x20, 0x1c, 0x00, 0x20, 0x30, 0xcd, 0xd3, 0x1e, 0x81, 0x00, 0xa0, 0xff, 0x00, 0xa0,
+    0xff, 0x1e, 0x1d, 0x43, 0x00, 0xa0, 0xff, 0x1d, 0x1c, 0x45, 0x00, 0xa0, 0xff, 0x1c, 0x1b, 0x47,
+    0x00, 0xa0, 0xff, 0x1b, 0x1a, 0x49, 0x00, 0xa0, 0xff, 0x1a, 0x19, 0x4b, 0x00, 0xa0, 0xff, 0x19,
+    0x18, 0x4d, 0x00, 0xa0, 0xff, 0x18, 0x05, 0x42, 0xff, 0xff, 0x3f, 0x0e, 0x4f, 0x00, 0xa0, 0xff,
+    0x17, 0x05, 0x42, 0xff, 0xff, 0x3f, 0x0d, 0x51, 0x00, 0xa0, 0xff, 0x16, 0x05, 0x42, 0xff, 0xff,
+    0x3f, 0x0c, 0x53, 0x00, 0xa0, 0xff, 0x15, 0x05, 0x42, 0xd7, 0xd7, 0x35, 0x0b, 0x55, 0x00, 0xa0,
+    0xff, 0x14, 0x05, 0x42, 0xd7, 0xd7, 0x35, 0x0a, 0x57, 0x00, 0xa0, 0xff, 0x13, 0x05, 0x42, 0xd7,
+    0xd7, 0x35, 0x0a, 0x57, 0x00, 0xa0, 0xff, 0x13, 0x05, 0x42, 0xaf, 0xaf, 0x2b, 0x0b, 0x55, 0x00,
+    0xa0, 0xff, 0x14, 0x05, 0x42, 0xaf, 0xaf, 0x2b, 0x0c, 0x53, 0x00, 0xa0, 0xff, 0x15, 0x05, 0x42,
+    0xaf, 0xaf, 0x2b, 0x0d, 0x51, 0x00, 0xa0, 0xff, 0x16, 0x06, 0x42, 0x87, 0x87, 0x21, 0x0d, 0x4f,
+    0x00, 0xa0, 0xff, 0x17, 0x06, 0x42, 0x87, 0x87, 0x21, 0x0e, 0x4d, 0x00, 0xa0, 0xff, 0x18, 0x06,
+    0x42, 0x87, 0x87, 0x21, 0x0f, 0x4b, 0x00, 0xa0, 0xff, 0x19, 0x07, 0x42, 0x5f, 0x5f, 0x17, 0x0f,
+    0x49, 0x00, 0xa0, 0xff, 0x1a, 0x07, 0x42, 0x5f, 0x5f, 0x17, 0x10, 0x47, 0x00, 0xa0, 0xff, 0x1b,
+    0x07, 0x42, 0x5f, 0x5f, 0x17, 0x11, 0x45, 0x00, 0xa0, 0xff, 0x1c, 0x08, 0x42, 0x37, 0x37, 0x0d,
+    0x11, 0x43, 0x00, 0xa0, 0xff, 0x1d, 0x08, 0x42, 0x37, 0x37, 0x0d, 0x12, 0x81, 0x00, 0xa0, 0xff,
+    0x00, 0xa0, 0xff, 0x1e, 0x08, 0x42, 0x37, 0x37, 0x0d, 0x80, 0x1b, 0x00, 0x1e, 0x32, 0x09, 0x82,
+    0x1a, 0x00, 0x1f, 0x1a, 0x00, 0x1f, 0x1b, 0x00, 0x1f, 0x32, 0x09, 0x82, 0x1a, 0x00, 0x1f, 0x1a,
+    0x00, 0x1f, 0x1b, 0x00, 0x1f, 0x32, 0xd0, 0xd2, 0x1e, 0x81, 0x00, 0xa0, 0xff, 0x00, 0xa0, 0xff,
+    0x1e, 0x1d, 0x43, 0x00, 0xa0, 0xff, 0x1d, 0x1c, 0x45, 0x00, 0xa0, 0xff, 0x1c, 0x1b, 0x47, 0x00,
+    0xa0, 0xff, 0x1b, 0x1a, 0x49, 0x00, 0xa0, 0xff, 0x1a, 0x06, 0x42, 0xff, 0xff, 0x3f, 0x0f, 0x4b,
+    0x00, 0xa0, 0xff, 0x19, 0x06, 0x42, 0xff, 0xff, 0x3f, 0x0e, 0x4d, 0x00, 0xa0, 0xff, 0x18, 0x06,
+    0x42, 0xff, 0xff, 0x3f, 0x0d, 0x4f, 0x00, 0xa0, 0xff, 0x17, 0x05, 0x42, 0xd7, 0xd7, 0x35, 0x0d,
+    0x51, 0x00, 0xa0, 0xff, 0x16, 0x05, 0x42, 0xd7, 0xd7, 0x35, 0x0c, 0x53, 0x00, 0xa0, 0xff, 0x15,
+    0x05, 0x42, 0xd7, 0xd7, 0x35, 0x0b, 0x55, 0x00, 0xa0, 0xff, 0x14, 0x05, 0x42, 0xaf, 0xaf, 0x2b,
+    0x0a, 0x57, 0x00, 0xa0, 0xff, 0x13, 0x05, 0x42, 0xaf, 0xaf, 0x2b, 0x09, 0x59, 0x00, 0xa0, 0xff,
+    0x12, 0x05, 0x42, 0xaf, 0xaf, 0x2b, 0x09, 0x59, 0x00, 0xa0, 0xff, 0x12, 0x05, 0x42, 0x87, 0x87,
+    0x21, 0x0a, 0x57, 0x00, 0xa0, 0xff, 0x13, 0x05, 0x42, 0x87, 0x87, 0x21, 0x0b, 0x55, 0x00, 0xa0,
+    0xff, 0x14, 0x05, 0x42, 0x87, 0x87, 0x21, 0x0c, 0x53, 0x00, 0xa0, 0xff, 0x15, 0x06, 0x42, 0x5f,
+    0x5f, 0x17, 0x0c, 0x51, 0x00, 0xa0, 0xff, 0x16, 0x06, 0x42, 0x5f, 0x5f, 0x17, 0x0d, 0x4f, 0x00,
+    0xa0, 0xff, 0x17, 0x06, 0x42, 0x5f, 0x5f, 0x17, 0x0e, 0x4d, 0x00, 0xa0, 0xff, 0x18, 0x07, 0x42,
+    0x37, 0x37, 0x0d, 0x0e, 0x4b, 0x00, 0xa0, 0xff, 0x19, 0x07, 0x42, 0x37, 0x37, 0x0d, 0x0f, 0x49,
+    0x00, 0xa0, 0xff, 0x1a, 0x07, 0x42, 0x37, 0x37, 0x0d, 0x10, 0x47, 0x00, 0xa0, 0xff, 0x1b, 0x08,
+    0x82, 0x19, 0x00, 0x1d, 0x1a, 0x00, 0x1d, 0x1a, 0x00, 0x1d, 0x10, 0x45, 0x00, 0xa0, 0xff, 0x1c,
+    0x08, 0x82, 0x19, 0x00, 0x1e, 0x1a, 0x00, 0x1e, 0x1a, 0x00, 0x1e, 0x11, 0x43, 0x00, 0xa0, 0xff,
+    0x1d, 0x08, 0x82, 0x19, 0x00, 0x1e, 0x1a, 0x00, 0x1e, 0x1a, 0x00, 0x1e, 0x12, 0x81, 0x00, 0xa0,
+    0xff, 0x00, 0xa0, 0xff, 0x1e, 0xd2, 0xd1, 0x1e, 0x81, 0x00, 0xa0, 0xff, 0x00, 0xa0, 0xff, 0x1e,
+    0x1d, 0x43, 0x00, 0xa0, 0xff, 0x1d, 0x1c, 0x45, 0x00, 0xa0, 0xff, 0x1c, 0x1b, 0x47, 0x00, 0xa0,
+    0xff, 0x1b, 0x07, 0x42, 0xff, 0xff, 0x3f, 0x0f, 0x49, 0x00, 0xa0, 0xff, 0x1a, 0x07, 0x42, 0xff,
+    0xff, 0x3f, 0x0e, 0x4b, 0x00, 0xa0, 0xff, 0x19, 0x06, 0x42, 0xd7, 0xd7, 0x35, 0x80, 0xff, 0xff,
+    0x3f, 0x0d, 0x4d, 0x00, 0xa0, 0xff, 0x18, 0x06, 0x42, 0xd7, 0xd7, 0x35, 0x0d, 0x4f, 0x00, 0xa0,
+    0xff, 0x17, 0x06, 0x42, 0xd7, 0xd7, 0x35, 0x0c, 0x51, 0x00, 0xa0, 0xff, 0x16, 0x05, 0x42, 0xaf,
+    0xaf, 0x2b, 0x0c, 0x53, 0x00, 0xa0, 0xff, 0x15, 0x05, 0x42, 0xaf, 0xaf, 0x2b, 0x0b, 0x55, 0x00,
+    0xa0, 0xff, 0x14, 0x05, 0x42, 0xaf, 0xaf, 0x2b, 0x0a, 0x57, 0x00, 0xa0, 0xff, 0x13, 0x05, 0x42,
+    0x87, 0x87, 0x21, 0x09, 0x59, 0x00, 0xa0, 0xff, 0x12, 0x05, 0x42, 0x87, 0x87, 0x21, 0x08, 0x5b,
+    0x00, 0xa0, 0xff, 0x11, 0x05, 0x42, 0x87, 0x87, 0x21, 0x08, 0x5b, 0x00, 0xa0, 0xff, 0x11, 0x05,
+    0x42, 0x5f, 0x5f, 0x17, 0x09, 0x59, 0x00, 0xa0, 0xff, 0x12, 0x05, 0x42, 0x5f, 0x5f, 0x17, 0x0a,
+    0x57, 0x00, 0xa0, 0xff, 0x13, 0x05, 0x42, 0x5f, 0x5f, 0x17, 0x0b, 0x55, 0x00, 0xa0, 0xff, 0x14,
+    0x06, 0x42, 0x37, 0x37, 0x0d, 0x0b, 0x53, 0x00, 0xa0, 0xff, 0x15, 0x06, 0x42, 0x37, 0x37, 0x0d,
+    0x0c, 0x51, 0x00, 0xa0, 0xff, 0x16, 0x06, 0x42, 0x37, 0x37, 0x0d, 0x0d, 0x4f, 0x00, 0xa0, 0xff,
+    0x17, 0x07, 0x82, 0x19, 0x00, 0x1c, 0x19, 0x00, 0x1c, 0x1a, 0x00, 0x1c, 0x0d, 0x4d, 0x00, 0xa0,
+    0xff, 0x18, 0x07, 0x82, 0x19, 0x00, 0x1c, 0x19, 0x00, 0x1c, 0x1a, 0x00, 0x1c, 0x0e, 0x4b, 0x00,
+    0xa0, 0xff, 0x19, 0x07, 0x82, 0x19, 0x00, 0x1d, 0x19, 0x00, 0x1d, 0x1a, 0x00, 0x1d, 0x0f, 0x49,
+    0x00, 0xa0, 0xff, 0x1a, 0x1b, 0x47, 0x00, 0xa0, 0xff, 0x1b, 0x1c, 0x45, 0x00, 0xa0, 0xff, 0x1c,
+    0x1d, 0x43, 0x00, 0xa0, 0xff, 0x1d, 0x1e, 0x81, 0x00, 0xa0, 0xff, 0x00, 0xa0, 0xff, 0x1e, 0xd1,
+    0xd2, 0x08, 0x42, 0xff, 0xff, 0x3f, 0x33, 0x08, 0x42, 0xff, 0xff, 0x3f, 0x33, 0x07, 0x42, 0xd7,
+    0xd7, 0x35, 0x80, 0xff, 0xff, 0x3f, 0x33, 0x07, 0x42, 0xd7, 0xd7, 0x35, 0x34, 0x07, 0x42, 0xd7,
+    0xd7, 0x35, 0x34, 0x06, 0x42, 0xaf, 0xaf, 0x2b, 0x80, 0x1a, 0x00, 0x15, 0x34, 0x06, 0x42, 0xaf,
+    0xaf, 0x2b, 0x35, 0x06, 0x42, 0xaf, 0xaf, 0x2b, 0x35, 0x05, 0x42, 0x87, 0x87, 0x21, 0x36, 0x05,
+    0x42, 0x87, 0x87, 0x21, 0x36, 0x05, 0x42, 0x87, 0x87, 0x21, 0x36, 0x05, 0x42, 0x5f, 0x5f, 0x17,
+    0x36, 0x05, 0x42, 0x5f, 0x5f, 0x17, 0x36, 0x05, 0x42, 0x5f, 0x5f, 0x17, 0x36, 0x05, 0x42, 0x37,
+    0x37, 0x0d, 0x36, 0x05, 0x42, 0x37, 0x37, 0x0d, 0x36, 0x05, 0x42, 0x37, 0x37, 0x0d, 0x36, 0x06,
+    0x82, 0x18, 0x00, 0x1a, 0x19, 0x00, 0x1a, 0x19, 0x00, 0x1a, 0x35, 0x06, 0x82, 0x18, 0x00, 0x1b,
+    0x19, 0x00, 0x1b, 0x19, 0x00, 0x1b, 0x35, 0x06, 0x82, 0x18, 0x00, 0x1b, 0x19, 0x00, 0x1b, 0x19,
+    0x00, 0x1b, 0x35, 0xd8, 0xcf, 0x0a, 0x42, 0xff, 0xff, 0x3f, 0x31, 0x0a, 0x42, 0xff, 0xff, 0x3f,
+    0x10, 0x81, 0x00, 0xa0, 0xff, 0x00, 0xa0, 0xff, 0x1e, 0x0a, 0x42, 0xff, 0xff, 0x3f, 0x0f, 0x43,
+    0x00, 0xa0, 0xff, 0x1d, 0x08, 0x42, 0xd7, 0xd7, 0x35, 0x10, 0x45, 0x00, 0xa0, 0xff, 0x1c, 0x08,
+    0x42, 0xd7, 0xd7, 0x35, 0x0f, 0x47, 0x00, 0xa0, 0xff, 0x1b, 0x07, 0x42, 0xaf, 0xaf, 0x2b, 0x80,
+    0xd7, 0xd7, 0x35, 0x0e, 0x49, 0x00, 0xa0, 0xff, 0x1a, 0x07, 0x42, 0xaf, 0xaf, 0x2b, 0x0e, 0x4b,
+    0x00, 0xa0, 0xff, 0x19, 0x07, 0x42, 0xaf, 0xaf, 0x2b, 0x0d, 0x4d, 0x00, 0xa0, 0xff, 0x18, 0x06,
+    0x42, 0x87, 0x87, 0x21, 0x0d, 0x4f, 0x00, 0xa0, 0xff, 0x17, 0x06, 0x42, 0x87, 0x87, 0x21, 0x0c,
+    0x51, 0x00, 0xa0, 0xff, 0x16, 0x06, 0x42, 0x87, 0x87, 0x21, 0x0b, 0x53, 0x00, 0xa0, 0xff, 0x15,
+    0x05, 0x42, 0x5f, 0x5f, 0x17, 0x0b, 0x55, 0x00, 0xa0, 0xff, 0x14, 0x05, 0x42, 0x5f, 0x5f, 0x17,
+    0x0a, 0x57, 0x00, 0xa0, 0xff, 0x13, 0x05, 0x42, 0x5f, 0x5f, 0x17, 0x09, 0x59, 0x00, 0xa0, 0xff,
+    0x12, 0x05, 0x42, 0x37, 0x37, 0x0d, 0x08, 0x5b, 0x00, 0xa0, 0xff, 0x11, 0x05, 0x42, 0x37, 0x37,
+    0x0d, 0x07, 0x5d, 0x00, 0xa0, 0xff, 0x10, 0x05, 0x42, 0x37, 0x37, 0x0d, 0x07, 0x5d, 0x00, 0xa0,
+    0xff, 0x10, 0x05, 0x82, 0x17, 0x00, 0x19, 0x18, 0x00, 0x19, 0x19, 0x00, 0x19, 0x08, 0x5b, 0x00,
+    0xa0, 0xff, 0x11, 0x05, 0x82, 0x17, 0x00, 0x19, 0x18, 0x00, 0x19, 0x19, 0x00, 0x19, 0x09, 0x59,
+    0x00, 0xa0, 0xff, 0x12, 0x05, 0x82, 0x17, 0x00, 0x1a, 0x18, 0x00, 0x1a, 0x19, 0x00, 0x1a, 0x0a,
+    0x57, 0x00, 0xa0, 0xff, 0x13, 0x14, 0x55, 0x00, 0xa0, 0xff, 0x14, 0x15, 0x53, 0x00, 0xa0, 0xff,
+    0x15, 0x16, 0x51, 0x00, 0xa0, 0xff, 0x16, 0x17, 0x4f, 0x00, 0xa0, 0xff, 0x17, 0x18, 0x4d, 0x00,
+    0xa0, 0xff, 0x18, 0x19, 0x4b, 0x00, 0xa0, 0xff, 0x19, 0x1a, 0x49, 0x00, 0xa0, 0xff, 0x1a, 0x1b,
+    0x47, 0x00, 0xa0, 0xff, 0x1b, 0x1c, 0x45, 0x00, 0xa0, 0xff, 0x1c, 0x1d, 0x43, 0x00, 0xa0, 0xff,
+    0x1d, 0x1e, 0x81, 0x00, 0xa0, 0xff, 0x00, 0xa0, 0xff, 0x1e, 0xd0, 0xcd, 0x0c, 0x42, 0xff, 0xff,
+    0x3f, 0x2f, 0x0c, 0x42, 0xff, 0xff, 0x3f, 0x2f, 0x0a, 0x42, 0xd7, 0xd7, 0x35, 0x81, 0xff, 0xff,
+    0x3f, 0xff, 0xff, 0x3f, 0x2f, 0x0a, 0x42, 0xd7, 0xd7, 0x35, 0x31, 0x0a, 0x42, 0xd7, 0xd7, 0x35,
+    0x31, 0x08, 0x42, 0xaf, 0xaf, 0x2b, 0x33, 0x08, 0x42, 0xaf, 0xaf, 0x2b, 0x33, 0x07, 0x42, 0x87,
+    0x87, 0x21, 0x80, 0xaf, 0xaf, 0x2b, 0x33, 0x07, 0x42, 0x87, 0x87, 0x21, 0x34, 0x07, 0x42, 0x87,
+    0x87, 0x21, 0x34, 0x06, 0x42, 0x5f, 0x5f, 0x17, 0x35, 0x06, 0x42, 0x5f, 0x5f, 0x17, 0x35, 0x06,
+    0x42, 0x5f, 0x5f, 0x17, 0x35, 0x05, 0x42, 0x37, 0x37, 0x0d, 0x36, 0x05, 0x42, 0x37, 0x37, 0x0d,
+    0x36, 0x05, 0x42, 0x37, 0x37, 0x0d, 0x36, 0x05, 0x82, 0x17, 0x00, 0x18, 0x18, 0x00, 0x18, 0x19,
+    0x00, 0x18, 0x36, 0x05, 0x82, 0x17, 0x00, 0x18, 0x18, 0x00, 0x18, 0x19, 0x00, 0x18, 0x36, 0x05,
+    0x82, 0x17, 0x00, 0x19, 0x18, 0x00, 0x19, 0x19, 0x00, 0x19, 0x36, 0xde, 0xcb, 0x0e, 0x42, 0xff,
+    0xff, 0x3f, 0x2d, 0x0e, 0x42, 0xff, 0xff, 0x3f, 0x2d, 0x0c, 0x42, 0xd7, 0xd7, 0x35, 0x81, 0xff,
+    0xff, 0x3f, 0xff, 0xff, 0x3f, 0x2d, 0x0c, 0x42, 0xd7, 0xd7, 0x35, 0x2f, 0x0a, 0x42, 0xaf, 0xaf,
+    0x2b, 0x81, 0xd7, 0xd7, 0x35, 0xd7, 0xd7, 0x35, 0x2f, 0x0a, 0x42, 0xaf, 0xaf, 0x2b, 0x31, 0x08,
+    0x42, 0x87, 0x87, 0x21, 0x81, 0xaf, 0xaf, 0x2b, 0xaf, 0xaf, 0x2b, 0x31, 0x08, 0x42, 0x87, 0x87,
+    0x21, 0x33, 0x08, 0x42, 0x87, 0x87, 0x21, 0x33, 0x07, 0x42, 0x5f, 0x5f, 0x17, 0x80, 0x1a, 0x00,
+    0x13, 0x33, 0x07, 0x42, 0x5f, 0x5f, 0x17, 0x34, 0x07, 0x42, 0x5f, 0x5f, 0x17, 0x34, 0x06, 0x42,
+    0x37, 0x37, 0x0d, 0x35, 0x06, 0x42, 0x37, 0x37, 0x0d, 0x35, 0x06, 0x42, 0x37, 0x37, 0x0d, 0x35,
+    0x05, 0x82, 0x17, 0x00, 0x16, 0x18, 0x00, 0x16, 0x19, 0x00, 0x16, 0x36, 0x05, 0x82, 0x17, 0x00,
+    0x17, 0x18, 0x00, 0x17, 0x19, 0x00, 0x17, 0x36, 0x05, 0x82, 0x17, 0x00, 0x17, 0x18, 0x00, 0x17,
+    0x19, 0x00, 0x17, 0x36, 0xe1, 0xc9, 0x10, 0x42, 0xff, 0xff, 0x3f, 0x2b, 0x10, 0x42, 0xff, 0xff,
+    0x3f, 0x2b, 0x0e, 0x42, 0xd7, 0xd7, 0x35, 0x81, 0xff, 0xff, 0x3f, 0xff, 0xff, 0x3f, 0x2b, 0x0e,
+    0x42, 0xd7, 0xd7, 0x35, 0x2d, 0x0c, 0x42, 0xaf, 0xaf, 0x2b, 0x81, 0xd7, 0xd7, 0x35, 0xd7, 0xd7,
+    0x35, 0x2d, 0x0c, 0x42, 0xaf, 0xaf, 0x2b, 0x2f, 0x0a, 0x42, 0x87, 0x87, 0x21, 0x81, 0xaf, 0xaf,
+    0x2b, 0xaf, 0xaf, 0x2b, 0x2f, 0x0a, 0x42, 0x87, 0x87, 0x21, 0x10, 0x81, 0x27, 0x00, 0x11, 0x28,
+    0x00, 0x11, 0x1e, 0x08, 0x42, 0x5f, 0x5f, 0x17, 0x81, 0x87, 0x87, 0x21, 0x87, 0x87, 0x21, 0x0f,
+    0x80, 0x26, 0x00, 0x12, 0x01, 0x80, 0x28, 0x00, 0x12, 0x1d, 0x08, 0x42, 0x5f, 0x5f, 0x17, 0x10,
+    0x80, 0x26, 0x00, 0x12, 0x03, 0x80, 0x29, 0x00, 0x12, 0x1c, 0x08, 0x42, 0x5f, 0x5f, 0x17, 0x0f,
+    0x80, 0x25, 0x00, 0x13, 0x05, 0x80, 0x29, 0x00, 0x13, 0x1b, 0x07, 0x42, 0x37, 0x37, 0x0d, 0x0f,
+    0x80, 0x24, 0x00, 0x13, 0x07, 0x80, 0x2a, 0x00, 0x13, 0x1a, 0x07, 0x42, 0x37, 0x37, 0x0d, 0x0e,
+    0x80, 0x24, 0x00, 0x14, 0x09, 0x80, 0x2b, 0x00, 0x14, 0x19, 0x07, 0x42, 0x37, 0x37, 0x0d, 0x0d,
+    0x80, 0x23, 0x00, 0x14, 0x0b, 0x80, 0x2b, 0x00, 0x14, 0x18, 0x06, 0x82, 0x18, 0x00, 0x15, 0x19,
+    0x00, 0x15, 0x19, 0x00, 0x15, 0x0d, 0x80, 0x23, 0x00, 0x15, 0x0d, 0x80, 0x2c, 0x00, 0x15, 0x17,
+    0x06, 0x82, 0x18, 0x00, 0x15, 0x19, 0x00, 0x15, 0x19, 0x00, 0x15, 0x0c, 0x80, 0x22, 0x00, 0x15,
+    0x0f, 0x80, 0x2d, 0x00, 0x15, 0x16, 0x06, 0x82, 0x18, 0x00, 0x16, 0x19, 0x00, 0x16, 0x19, 0x00,
+    0x16, 0x0b, 0x80, 0x21, 0x00, 0x16, 0x11, 0x80, 0x2d, 0x00, 0x16, 0x15, 0x14, 0x80, 0x21, 0x00,
+    0x16, 0x13, 0x80, 0x2e, 0x00, 0x16, 0x14, 0x13, 0x80, 0x20, 0x00, 0x17, 0x15, 0x80, 0x2e, 0x00,
+    0x17, 0x13, 0x12, 0x80, 0x1f, 0x00, 0x17, 0x17, 0x80, 0x2f, 0x00, 0x17, 0x12, 0x11, 0x80, 0x1f,
+    0x00, 0x18, 0x19, 0x80, 0x30, 0x00, 0x18, 0x11, 0x10, 0x80, 0x1e, 0x00, 0x18, 0x1b, 0x80, 0x30,
+    0x00, 0x18, 0x10, 0x10, 0x80, 0x1e, 0x00, 0x19, 0x1b, 0x80, 0x30, 0x00, 0x19, 0x10, 0x11, 0x80,
+    0x1f, 0x00, 0x19, 0x19, 0x80, 0x30, 0x00, 0x19, 0x11, 0x12, 0x80, 0x1f, 0x00, 0x19, 0x17, 0x80,
+    0x2f, 0x00, 0x19, 0x12, 0x13, 0x80, 0x20, 0x00, 0x1a, 0x15, 0x80, 0x2e, 0x00, 0x1a, 0x13, 0x14,
+    0x80, 0x21, 0x00, 0x1a, 0x13, 0x80, 0x2e, 0x00, 0x1a, 0x14, 0x15, 0x80, 0x21, 0x00, 0x1b, 0x11,
+    0x80, 0x2d, 0x00, 0x1b, 0x15, 0x16, 0x80, 0x22, 0x00, 0x1b, 0x0f, 0x80, 0x2d, 0x00, 0x1b, 0x16,
+    0x17, 0x80, 0x23, 0x00, 0x1c, 0x0d, 0x80, 0x2c, 0x00, 0x1c, 0x17, 0x18, 0x80, 0x23, 0x00, 0x1c,
+    0x0b, 0x80, 0x2b, 0x00, 0x1c, 0x18, 0x19, 0x80, 0x24, 0x00, 0x1d, 0x09, 0x80, 0x2b, 0x00, 0x1d,
+    0x19, 0x1a, 0x80, 0x24, 0x00, 0x1d, 0x07, 0x80, 0x2a, 0x00, 0x1d, 0x1a, 0x1b, 0x80, 0x25, 0x00,
+    0x1e, 0x05, 0x80, 0x29, 0x00, 0x1e, 0x1b, 0x1c, 0x80, 0x26, 0x00, 0x1e, 0x03, 0x80, 0x29, 0x00,
+    0x1e, 0x1c, 0x1d, 0x80, 0x26, 0x00, 0x1f, 0x01, 0x80, 0x28, 0x00, 0x1f, 0x1d, 0x1e, 0x81, 0x27,
+    0x00, 0x1f, 0x28, 0x00, 0x1f, 0x1e, 0xd0, 0xc7, 0x13, 0x42, 0xff, 0xff, 0x3f, 0x28, 0x13, 0x42,
+    0xff, 0xff, 0x3f, 0x28, 0x10, 0x80, 0x1e, 0x00, 0x0e, 0x42, 0xd7, 0xd7, 0x35, 0x81, 0xff, 0xff,
+    0x3f, 0xff, 0xff, 0x3f, 0x28, 0x10, 0x80, 0x1e, 0x00, 0x0f, 0x42, 0xd7, 0xd7, 0x35, 0x2a, 0x0e,
+    0x42, 0xaf, 0xaf, 0x2b, 0x42, 0xd7, 0xd7, 0x35, 0x2a, 0x0e, 0x42, 0xaf, 0xaf, 0x2b, 0x2d, 0x0c,
+    0x42, 0x87, 0x87, 0x21, 0x81, 0xaf, 0xaf, 0x2b, 0xaf, 0xaf, 0x2b, 0x2d, 0x0c, 0x42, 0x87, 0x87,
+    0x21, 0x2f, 0x0a, 0x42, 0x5f, 0x5f, 0x17, 0x81, 0x87, 0x87, 0x21, 0x87, 0x87, 0x21, 0x2f, 0x0a,
+    0x42, 0x5f, 0x5f, 0x17, 0x31, 0x08, 0x80, 0x19, 0x00, 0x12, 0x42, 0x37, 0x37, 0x0d, 0x80, 0x5f,
+    0x5f, 0x17, 0x31, 0x08, 0x80, 0x19, 0x00, 0x12, 0x42, 0x37, 0x37, 0x0d, 0x32, 0x08, 0x80, 0x19,
+    0x00, 0x13, 0x42, 0x37, 0x37, 0x0d, 0x32, 0x07, 0x82, 0x19, 0x00, 0x13, 0x19, 0x00, 0x13, 0x1a,
+    0x00, 0x13, 0x34, 0x07, 0x82, 0x19, 0x00, 0x14, 0x19, 0x00, 0x14, 0x1a, 0x00, 0x14, 0x34, 0x07,
+    0x82, 0x19, 0x00, 0x14, 0x19, 0x00, 0x14, 0x1a, 0x00, 0x14, 0x34, 0xe7, 0xc6, 0x16, 0x42, 0xff,
+    0xff, 0x3f, 0x25, 0x13, 0x42, 0xd7, 0xd7, 0x35, 0x42, 0xff, 0xff, 0x3f, 0x25, 0x13, 0x42, 0xd7,
+    0xd7, 0x35, 0x42, 0xff, 0xff, 0x3f, 0x25, 0x11, 0x42, 0xaf, 0xaf, 0x2b, 0x81, 0xd7, 0xd7, 0x35,
+    0xd7, 0xd7, 0x35, 0x28, 0x11, 0x42, 0xaf, 0xaf, 0x2b, 0x2a, 0x0e, 0x42, 0x87, 0x87, 0x21, 0x42,
+    0xaf, 0xaf, 0x2b, 0x2a, 0x0c, 0x42, 0x5f, 0x5f, 0x17, 0x81, 0x87, 0x87, 0x21, 0x87, 0x87, 0x21,
+    0x2d, 0x0c, 0x42, 0x5f, 0x5f, 0x17, 0x81, 0x87, 0x87, 0x21, 0x87, 0x87, 0x21, 0x2d, 0x0c, 0x42,
+    0x5f, 0x5f, 0x17, 0x2f, 0x0a, 0x42, 0x37, 0x37, 0x0d, 0x81, 0x1c, 0x00, 0x11, 0x1d, 0x00, 0x11,
+    0x2f, 0x0a, 0x42, 0x37, 0x37, 0x0d, 0x31, 0x09, 0x80, 0x1a, 0x00, 0x12, 0x01, 0x80, 0x37, 0x37,
+    0x0d, 0x10, 0x81, 0x27, 0x00, 0x12, 0x28, 0x00, 0x12, 0x1e, 0x09, 0x82, 0x1a, 0x00, 0x12, 0x1a,
+    0x00, 0x12, 0x1b, 0x00, 0x12, 0x10, 0x80, 0x26, 0x00, 0x12, 0x01, 0x80, 0x28, 0x00, 0x12, 0x1d,
+    0x09, 0x82, 0x1a, 0x00, 0x13, 0x1a, 0x00, 0x13, 0x1b, 0x00, 0x13, 0x0f, 0x80, 0x26, 0x00, 0x13,
+    0x03, 0x80, 0x29, 0x00, 0x13, 0x1c, 0x1b, 0x80, 0x25, 0x00, 0x13, 0x05, 0x80, 0x29, 0x00, 0x13,
+    0x1b, 0x1a, 0x80, 0x24, 0x00, 0x14, 0x07, 0x80, 0x2a, 0x00, 0x14, 0x1a, 0x19, 0x80, 0x24, 0x00,
+    0x14, 0x09, 0x80, 0x2b, 0x00, 0x14, 0x19, 0x18, 0x80, 0x23, 0x00, 0x15, 0x0b, 0x80, 0x2b, 0x00,
+    0x15, 0x18, 0x17, 0x80, 0x23, 0x00, 0x15, 0x0d, 0x80, 0x2c, 0x00, 0x15, 0x17, 0x16, 0x80, 0x22,
+    0x00, 0x16, 0x0f, 0x80, 0x2d, 0x00, 0x16, 0x16, 0x15, 0x80, 0x21, 0x00, 0x16, 0x11, 0x80, 0x2d,
+    0x00, 0x16, 0x15, 0x14, 0x80, 0x21, 0x00, 0x17, 0x13, 0x80, 0x2e, 0x00, 0x17, 0x14, 0x13, 0x80,
+    0x20, 0x00, 0x17, 0x15, 0x80, 0x2e, 0x00, 0x17, 0x13, 0x12, 0x80, 0x1f, 0x00, 0x18, 0x17, 0x80,
+    0x2f, 0x00, 0x18, 0x12, 0x11, 0x80, 0x1f, 0x00, 0x18, 0x19, 0x80, 0x30, 0x00, 0x18, 0x11, 0x11,
+    0x80, 0x1f, 0x00, 0x19, 0x19, 0x80, 0x30, 0x00, 0x19, 0x11, 0x12, 0x80, 0x1f, 0x00, 0x19, 0x17,
+    0x80, 0x2f, 0x00, 0x19, 0x12, 0x13, 0x80, 0x20, 0x00, 0x19, 0x15, 0x80, 0x2e, 0x00, 0x19, 0x13,
+    0x14, 0x80, 0x21, 0x00, 0x1a, 0x13, 0x80, 0x2e, 0x00, 0x1a, 0x14, 0x15, 0x80, 0x21, 0x00, 0x1a,
+    0x11, 0x80, 0x2d, 0x00, 0x1a, 0x15, 0x16, 0x80, 0x22, 0x00, 0x1b, 0x0f, 0x80, 0x2d, 0x00, 0x1b,
+    0x16, 0x17, 0x80, 0x23, 0x00, 0x1b, 0x0d, 0x80, 0x2c, 0x00, 0x1b, 0x17, 0x18, 0x80, 0x23, 0x00,
+    0x1c, 0x0b, 0x80, 0x2b, 0x00, 0x1c, 0x18, 0x19, 0x80, 0x24, 0x00, 0x1c, 0x09, 0x80, 0x2b, 0x00,
+    0x1c, 0x19, 0x1a, 0x80, 0x24, 0x00, 0x1d, 0x07, 0x80, 0x2a, 0x00, 0x1d, 0x1a, 0x1b, 0x80, 0x25,
+    0x00, 0x1d, 0x05, 0x80, 0x29, 0x00, 0x1d, 0x1b, 0x1c, 0x80, 0x26, 0x00, 0x1e, 0x03, 0x80, 0x29,
+    0x00, 0x1e, 0x1c, 0x1d, 0x80, 0x26, 0x00, 0x1e, 0x01, 0x80, 0x28, 0x00, 0x1e, 0x1d, 0x1e, 0x81,
+    0x27, 0x00, 0x1f, 0x28, 0x00, 0x1f, 0x1e, 0xd1, 0xc6, 0x16, 0x42, 0xd7, 0xd7, 0x35, 0x42, 0xff,
+    0xff, 0x3f, 0x22, 0x13, 0x42, 0xaf, 0xaf, 0x2b, 0x42, 0xd7, 0xd7, 0x35, 0x42, 0xff, 0xff, 0x3f,
+    0x22, 0x13, 0x42, 0xaf, 0xaf, 0x2b, 0x42, 0xd7, 0xd7, 0x35, 0x42, 0xff, 0xff, 0x3f, 0x22, 0x11,
+    0x42, 0x87, 0x87, 0x21, 0x81, 0xaf, 0xaf, 0x2b, 0xaf, 0xaf, 0x2b, 0x28, 0x0e, 0x42, 0x5f, 0x5f,
+    0x17, 0x42, 0x87, 0x87, 0x21, 0x2a, 0x0e, 0x42, 0x5f, 0x5f, 0x17, 0x42, 0x87, 0x87, 0x21, 0x2a,
+    0x0c, 0x42, 0x37, 0x37, 0x0d, 0x81, 0x5f, 0x5f, 0x17, 0x5f, 0x5f, 0x17, 0x2d, 0x0c, 0x42, 0x37,
+    0x37, 0x0d, 0x81, 0x1e, 0x00, 0x10, 0x1e, 0x00, 0x10, 0x2d, 0x0c, 0x42, 0x37, 0x37, 0x0d, 0x2f,
+    0x0a, 0x82, 0x1a, 0x00, 0x11, 0x1b, 0x00, 0x11, 0x1c, 0x00, 0x11, 0x31, 0x0a, 0x82, 0x1a, 0x00,
+    0x11, 0x1b, 0x00, 0x11, 0x1c, 0x00, 0x11, 0x31, 0x0a, 0x82, 0x1a, 0x00, 0x12, 0x1b, 0x00, 0x12,
+    0x1c, 0x00, 0x12, 0x31, 0x1e, 0x81, 0x27, 0x00, 0x12, 0x28, 0x00, 0x12, 0x1e, 0x1d, 0x80, 0x26,
+    0x00, 0x13, 0x01, 0x80, 0x28, 0x00, 0x13, 0x1d, 0x1c, 0x80, 0x26, 0x00, 0x13, 0x03, 0x80, 0x29,
+    0x00, 0x13, 0x1c, 0x1b, 0x80, 0x25, 0x00, 0x14, 0x05, 0x80, 0x29, 0x00, 0x14, 0x1b, 0x1a, 0x80,
+    0x24, 0x00, 0x14, 0x07, 0x80, 0x2a, 0x00, 0x14, 0x1a, 0x19, 0x80, 0x24, 0x00, 0x15, 0x09, 0x80,
+    0x2b, 0x00, 0x15, 0x19, 0x18, 0x80, 0x23, 0x00, 0x15, 0x0b, 0x80, 0x2b, 0x00, 0x15, 0x18, 0x17,
+    0x80, 0x23, 0x00, 0x16, 0x0d, 0x80, 0x2c, 0x00, 0x16, 0x17, 0x16, 0x80, 0x22, 0x00, 0x16, 0x0f,
+    0x80, 0x2d, 0x00, 0x16, 0x16, 0x15, 0x80, 0x21, 0x00, 0x17, 0x11, 0x80, 0x2d, 0x00, 0x17, 0x15,
+    0x14, 0x80, 0x21, 0x00, 0x17, 0x13, 0x80, 0x2e, 0x00, 0x17, 0x14, 0x13, 0x80, 0x20, 0x00, 0x18,
+    0x15, 0x80, 0x2e, 0x00, 0x18, 0x13, 0x12, 0x80, 0x1f, 0x00, 0x18, 0x17, 0x80, 0x2f, 0x00, 0x18,
+    0x12, 0x12, 0x80, 0x1f, 0x00, 0x19, 0x17, 0x80, 0x2f, 0x00, 0x19, 0x12, 0x13, 0x80, 0x20, 0x00,
+    0x19, 0x15, 0x80, 0x2e, 0x00, 0x19, 0x13, 0x14, 0x80, 0x21, 0x00, 0x19, 0x13, 0x80, 0x2e, 0x00,
+    0x19, 0x14, 0x15, 0x80, 0x21, 0x00, 0x1a, 0x11, 0x80, 0x2d, 0x00, 0x1a, 0x15, 0x16, 0x80, 0x22,
+    0x00, 0x1a, 0x0f, 0x80, 0x2d, 0x00, 0x1a, 0x16, 0x17, 0x80, 0x23, 0x00, 0x1b, 0x0d, 0x80, 0x2c,
+    0x00, 0x1b, 0x17, 0x18, 0x80, 0x23, 0x00, 0x1b, 0x0b, 0x80, 0x2b, 0x00, 0x1b, 0x18, 0x19, 0x80,
+    0x24, 0x00, 0x1c, 0x09, 0x80, 0x2b, 0x00, 0x1c, 0x19, 0x1a, 0x80, 0x24, 0x00, 0x1c, 0x07, 0x80,
+    0x2a, 0x00, 0x1c, 0x1a, 0x1b, 0x80, 0x25, 0x00, 0x1d, 0x05, 0x80, 0x29, 0x00, 0x1d, 0x1b, 0x1c,
+    0x80, 0x26, 0x00, 0x1d, 0x03, 0x80, 0x29, 0x00, 0x1d, 0x1c, 0x1d, 0x80, 0x26, 0x00, 0x1e, 0x01,
+    0x80, 0x28, 0x00, 0x1e, 0x1d, 0x1e, 0x81, 0x27, 0x00, 0x1e, 0x28, 0x00, 0x1e, 0x1e, 0xd2, 0xc5,
+    0x1c, 0x42, 0xff, 0xff, 0x3f, 0x1f, 0x16, 0x42, 0xaf, 0xaf, 0x2b, 0x42, 0xd7, 0xd7, 0x35, 0x42,
+    0xff, 0xff, 0x3f, 0x1f, 0x13, 0x80, 0x20, 0x00, 0x0d, 0x42, 0x87, 0x87, 0x21, 0x81, 0xaf, 0xaf,
+    0x2b, 0xaf, 0xaf, 0x2b, 0x42, 0xd7, 0xd7, 0x35, 0x42, 0xff, 0xff, 0x3f, 0x1f, 0x13, 0x80, 0x20,
+    0x00, 0x0e, 0x42, 0x87, 0x87, 0x21, 0x81, 0xaf, 0xaf, 0x2b, 0xaf, 0xaf, 0x2b, 0x42, 0xd7, 0xd7,
+    0x35, 0x22, 0x11, 0x42, 0x5f, 0x5f, 0x17, 0x42, 0x87, 0x87, 0x21, 0x27, 0x0e, 0x80, 0x1d, 0x00,
+    0x0f, 0x42, 0x37, 0x37, 0x0d, 0x81, 0x5f, 0x5f, 0x17, 0x5f, 0x5f, 0x17, 0x2a, 0x0e, 0x80, 0x1d,
+    0x00, 0x0f, 0x42, 0x37, 0x37, 0x0d, 0x81, 0x5f, 0x5f, 0x17, 0x5f, 0x5f, 0x17, 0x2a, 0x0c, 0x82,
+    0x1c, 0x00, 0x10, 0x1c, 0x00, 0x10, 0x1d, 0x00, 0x10, 0x42, 0x37, 0x37, 0x0d, 0x2c, 0x0c, 0x82,
+    0x1c, 0x00, 0x10, 0x1c, 0x00, 0x10, 0x1d, 0x00, 0x10, 0x2f, 0x0c, 0x82, 0x1c, 0x00, 0x11, 0x1c,
+    0x00, 0x11, 0x1d, 0x00, 0x11, 0x2f, 0xef, 0xc5, 0x1c, 0x42, 0xd7, 0xd7, 0x35, 0x42, 0xff, 0xff,
+    0x3f, 0x1c, 0x16, 0x42, 0x87, 0x87, 0x21, 0x42, 0xaf, 0xaf, 0x2b, 0x42, 0xd7, 0xd7, 0x35, 0x42,
+    0xff, 0xff, 0x3f, 0x1c, 0x14, 0x42, 0x5f, 0x5f, 0x17, 0x81, 0x87, 0x87, 0x21, 0x87, 0x87, 0x21,
+    0x42, 0xaf, 0xaf, 0x2b, 0x42, 0xd7, 0xd7, 0x35, 0x42, 0xff, 0xff, 0x3f, 0x1c, 0x14, 0x42, 0x5f,
+    0x5f, 0x17, 0x81, 0x87, 0x87, 0x21, 0x87, 0x87, 0x21, 0x42, 0xaf, 0xaf, 0x2b, 0x22, 0x11, 0x42,
+    0x37, 0x37, 0x0d, 0x42, 0x5f, 0x5f, 0x17, 0x27, 0x0f, 0x81, 0x1e, 0x00, 0x0f, 0x1e, 0x00, 0x0f,
+    0x00, 0x81, 0x37, 0x37, 0x0d, 0x37, 0x37, 0x0d, 0x2a, 0x0f, 0x81, 0x1e, 0x00, 0x0f, 0x1e, 0x00,
+    0x0f, 0x00, 0x81, 0x37, 0x37, 0x0d, 0x37, 0x37, 0x0d, 0x2a, 0x0f, 0x82, 0x1e, 0x00, 0x10, 0x1e,
+    0x00, 0x10, 0x1f, 0x00, 0x10, 0x2c, 0xc5, 0x1e, 0x81, 0x27, 0x00, 0x13, 0x28, 0x00, 0x13, 0x1e,
+    0x1d, 0x80, 0x26, 0x00, 0x13, 0x01, 0x80, 0x28, 0x00, 0x13, 0x1d, 0x1c, 0x80, 0x26, 0x00, 0x14,
+    0x03, 0x80, 0x29, 0x00, 0x14, 0x1c, 0x1b, 0x80, 0x25, 0x00, 0x14, 0x05, 0x80, 0x29, 0x00, 0x14,
+    0x1b, 0x1a, 0x80, 0x24, 0x00, 0x15, 0x07, 0x80, 0x2a, 0x00, 0x15, 0x1a, 0x19, 0x80, 0x24, 0x00,
+    0x15, 0x09, 0x80, 0x2b, 0x00, 0x15, 0x19, 0x18, 0x80, 0x23, 0x00, 0x16, 0x0b, 0x80, 0x2b, 0x00,
+    0x16, 0x18, 0x17, 0x80, 0x23, 0x00, 0x16, 0x0d, 0x80, 0x2c, 0x00, 0x16, 0x17, 0x16, 0x80, 0x22,
+    0x00, 0x17, 0x0f, 0x80, 0x2d, 0x00, 0x17, 0x16, 0x15, 0x80, 0x21, 0x00, 0x17, 0x11, 0x80, 0x2d,
+    0x00, 0x17, 0x15, 0x14, 0x80, 0x21, 0x00, 0x18, 0x13, 0x80, 0x2e, 0x00, 0x18, 0x14, 0x13, 0x80,
+    0x20, 0x00, 0x18, 0x15, 0x80, 0x2e, 0x00, 0x18, 0x13, 0x13, 0x80, 0x20, 0x00, 0x19, 0x15, 0x80,
+    0x2e, 0x00, 0x19, 0x13, 0x14, 0x80, 0x21, 0x00, 0x19, 0x13, 0x80, 0x2e, 0x00, 0x19, 0x14, 0x15,
+    0x80, 0x21, 0x00, 0x19, 0x11, 0x80, 0x2d, 0x00, 0x19, 0x15, 0x16, 0x80, 0x22, 0x00, 0x1a, 0x0f,
+    0x80, 0x2d, 0x00, 0x1a, 0x16, 0x17, 0x80, 0x23, 0x00, 0x1a, 0x0d, 0x80, 0x2c, 0x00, 0x1a, 0x17,
+    0x18, 0x80, 0x23, 0x00, 0x1b, 0x0b, 0x80, 0x2b, 0x00, 0x1b, 0x18, 0x19, 0x80, 0x24, 0x00, 0x1b,
+    0x09, 0x80, 0x2b, 0x00, 0x1b, 0x19, 0x1a, 0x80, 0x24, 0x00, 0x1c, 0x07, 0x80, 0x2a, 0x00, 0x1c,
+    0x1a, 0x1b, 0x80, 0x25, 0x00, 0x1c, 0x05, 0x80, 0x29, 0x00, 0x1c, 0x1b, 0x1c, 0x80, 0x26, 0x00,
+    0x1d, 0x03, 0x80, 0x29, 0x00, 0x1d, 0x1c, 0x1d, 0x80, 0x26, 0x00, 0x1d, 0x01, 0x80, 0x28, 0x00,
+    0x1d, 0x1d, 0x1e, 0x81, 0x27, 0x00, 0x1e, 0x28, 0x00, 0x1e, 0x1e, 0xd3, 0xc5, 0x1c, 0x42, 0xaf,
+    0xaf, 0x2b, 0x42, 0xd7, 0xd7, 0x35, 0x1c, 0x16, 0x80, 0x22, 0x00, 0x0d, 0x42, 0x5f, 0x5f, 0x17,
+    0x81, 0x87, 0x87, 0x21, 0x87, 0x87, 0x21, 0x42, 0xaf, 0xaf, 0x2b, 0x42, 0xd7, 0xd7, 0x35, 0x42,
+    0xff, 0xff, 0x3f, 0x19, 0x14, 0x42, 0x37, 0x37, 0x0d, 0x42, 0x5f, 0x5f, 0x17, 0x81, 0x87, 0x87,
+    0x21, 0x87, 0x87, 0x21, 0x42, 0xaf, 0xaf, 0x2b, 0x42, 0xd7, 0xd7, 0x35, 0x42, 0xff, 0xff, 0x3f,
+    0x19, 0x14, 0x42, 0x37, 0x37, 0x0d, 0x42, 0x5f, 0x5f, 0x17, 0x81, 0x87, 0x87, 0x21, 0x87, 0x87,
+    0x21, 0x05, 0x42, 0xff, 0xff, 0x3f, 0x19, 0x11, 0x82, 0x1f, 0x00, 0x0e, 0x1f, 0x00, 0x0e, 0x20,
+    0x00, 0x0e, 0x42, 0x37, 0x37, 0x0d, 0x27, 0x11, 0x82, 0x1f, 0x00, 0x0f, 0x1f, 0x00, 0x0f, 0x20,
+    0x00, 0x0f, 0x2a, 0x11, 0x82, 0x1f, 0x00, 0x0f, 0x1f, 0x00, 0x0f, 0x20, 0x00, 0x0f, 0x2a, 0xc7,
+    0x1e, 0x81, 0x27, 0x00, 0x13, 0x28, 0x00, 0x13, 0x1e, 0x1d, 0x80, 0x26, 0x00, 0x14, 0x01, 0x80,
+    0x28, 0x00, 0x14, 0x1d, 0x1c, 0x80, 0x26, 0x00, 0x14, 0x03, 0x80, 0x29, 0x00, 0x14, 0x1c, 0x1b,
+    0x80, 0x25, 0x00, 0x15, 0x05, 0x80, 0x29, 0x00, 0x15, 0x1b, 0x1a, 0x80, 0x24, 0x00, 0x15, 0x07,
+    0x80, 0x2a, 0x00, 0x15, 0x1a, 0x19, 0x80, 0x24, 0x00, 0x16, 0x09, 0x80, 0x2b, 0x00, 0x16, 0x19,
+    0x18, 0x80, 0x23, 0x00, 0x16, 0x0b, 0x80, 0x2b, 0x00, 0x16, 0x18, 0x17, 0x80, 0x23, 0x00, 0x17,
+    0x0d, 0x80, 0x2c, 0x00, 0x17, 0x17, 0x16, 0x80, 0x22, 0x00, 0x17, 0x0f, 0x80, 0x2d, 0x00, 0x17,
+    0x16, 0x15, 0x80, 0x21, 0x00, 0x18, 0x11, 0x80, 0x2d, 0x00, 0x18, 0x15, 0x14, 0x80, 0x21, 0x00,
+    0x18, 0x13, 0x80, 0x2e, 0x00, 0x18, 0x14, 0x14, 0x80, 0x21, 0x00, 0x19, 0x13, 0x80, 0x2e, 0x00,
+    0x19, 0x14, 0x15, 0x80, 0x21, 0x00, 0x19, 0x11, 0x80, 0x2d, 0x00, 0x19, 0x15, 0x16, 0x80, 0x22,
+    0x00, 0x19, 0x0f, 0x80, 0x2d, 0x00, 0x19, 0x16, 0x17, 0x80, 0x23, 0x00, 0x1a, 0x0d, 0x80, 0x2c,
+    0x00, 0x1a, 0x17, 0x18, 0x80, 0x23, 0x00, 0x1a, 0x0b, 0x80, 0x2b, 0x00, 0x1a, 0x18, 0x19, 0x80,
+    0x24, 0x00, 0x1b, 0x09, 0x80, 0x2b, 0x00, 0x1b, 0x19, 0x1a, 0x80, 0x24, 0x00, 0x1b, 0x07, 0x80,
+    0x2a, 0x00, 0x1b, 0x1a, 0x1b, 0x80, 0x25, 0x00, 0x1c, 0x05, 0x80, 0x29, 0x00, 0x1c, 0x1b, 0x1c,
+    0x80, 0x26, 0x00, 0x1c, 0x03, 0x80, 0x29, 0x00, 0x1c, 0x1c, 0x1d, 0x80, 0x26, 0x00, 0x1d, 0x01,
+    0x80, 0x28, 0x00, 0x1d, 0x1d, 0x1e, 0x81, 0x27, 0x00, 0x1d, 0x28, 0x00, 0x1d, 0x1e, 0xd4, 0xc5,
+    0x1c, 0x42, 0x87, 0x87, 0x21, 0x42, 0xaf, 0xaf, 0x2b, 0x1c, 0x17, 0x42, 0x37, 0x37, 0x0d, 0x81,
+    0x5f, 0x5f, 0x17, 0x5f, 0x5f, 0x17, 0x42, 0x87, 0x87, 0x21, 0x42, 0xaf, 0xaf, 0x2b, 0x42, 0xd7,
+    0xd7, 0x35, 0x42, 0xff, 0xff, 0x3f, 0x16, 0x14, 0x82, 0x21, 0x00, 0x0d, 0x21, 0x00, 0x0d, 0x22,
+    0x00, 0x0d, 0x42, 0x37, 0x37, 0x0d, 0x81, 0x5f, 0x5f, 0x17, 0x5f, 0x5f, 0x17, 0x42, 0x87, 0x87,
+    0x21, 0x42, 0xaf, 0xaf, 0x2b, 0x42, 0xd7, 0xd7, 0x35, 0x42, 0xff, 0xff, 0x3f, 0x16, 0x14, 0x82,
+    0x21, 0x00, 0x0e, 0x21, 0x00, 0x0e, 0x22, 0x00, 0x0e, 0x42, 0x37, 0x37, 0x0d, 0x81, 0x5f, 0x5f,
+    0x17, 0x5f, 0x5f, 0x17, 0x05, 0x42, 0xd7, 0xd7, 0x35, 0x42, 0xff, 0xff, 0x3f, 0x16, 0x14, 0x82,
+    0x21, 0x00, 0x0e, 0x21, 0x00, 0x0e, 0x22, 0x00, 0x0e, 0x27, 0xca, 0x1e, 0x81, 0x27, 0x00, 0x14,
+    0x28, 0x00, 0x14, 0x1e, 0x1d, 0x80, 0x26, 0x00, 0x14, 0x01, 0x80, 0x28, 0x00, 0x14, 0x1d, 0x1c,
+    0x80, 0x26, 0x00, 0x15, 0x03, 0x80, 0x29, 0x00, 0x15, 0x1c, 0x1b, 0x80, 0x25, 0x00, 0x15, 0x05,
+    0x80, 0x29, 0x00, 0x15, 0x1b, 0x1a, 0x80, 0x24, 0x00, 0x16, 0x07, 0x80, 0x2a, 0x00, 0x16, 0x1a,
+    0x19, 0x80, 0x24, 0x00, 0x16, 0x09, 0x80, 0x2b, 0x00, 0x16, 0x19, 0x18, 0x80, 0x23, 0x00, 0x17,
+    0x0b, 0x80, 0x2b, 0x00, 0x17, 0x18, 0x17, 0x80, 0x23, 0x00, 0x17, 0x0d, 0x80, 0x2c, 0x00, 0x17,
+    0x17, 0x16, 0x80, 0x22, 0x00, 0x18, 0x0f, 0x80, 0x2d, 0x00, 0x18, 0x16, 0x15, 0x80, 0x21, 0x00,
+    0x18, 0x11, 0x80, 0x2d, 0x00, 0x18, 0x15, 0x15, 0x80, 0x21, 0x00, 0x19, 0x11, 0x80, 0x2d, 0x00,
+    0x19, 0x15, 0x16, 0x80, 0x22, 0x00, 0x19, 0x0f, 0x80, 0x2d, 0x00, 0x19, 0x16, 0x17, 0x80, 0x23,
+    0x00, 0x19, 0x0d, 0x80, 0x2c, 0x00, 0x19, 0x17, 0x18, 0x80, 0x23, 0x00, 0x1a, 0x0b, 0x80, 0x2b,
+    0x00, 0x1a, 0x18, 0x19, 0x80, 0x24, 0x00, 0x1a, 0x09, 0x80, 0x2b, 0x00, 0x1a, 0x19, 0x1a, 0x80,
+    0x24, 0x00, 0x1b, 0x07, 0x80, 0x2a, 0x00, 0x1b, 0x1a, 0x1b, 0x80, 0x25, 0x00, 0x1b, 0x05, 0x80,
+    0x29, 0x00, 0x1b, 0x1b, 0x1c, 0x80, 0x26, 0x00, 0x1c, 0x03, 0x80, 0x29, 0x00, 0x1c, 0x1c, 0x1d,
+    0x80, 0x26, 0x00, 0x1c, 0x01, 0x80, 0x28, 0x00, 0x1c, 0x1d, 0x1e, 0x81, 0x27, 0x00, 0x1d, 0x28,
+    0x00, 0x1d, 0x1e, 0xd5, 0xc5, 0x1a, 0x42, 0x37, 0x37, 0x0d, 0x42, 0x5f, 0x5f, 0x17, 0x81, 0x87,
+    0x87, 0x21, 0x87, 0x87, 0x21, 0x1c, 0x17, 0x82, 0x23, 0x00, 0x0d, 0x23, 0x00, 0x0d, 0x24, 0x00,
+    0x0d, 0x42, 0x37, 0x37, 0x0d, 0x42, 0x5f, 0x5f, 0x17, 0x81, 0x87, 0x87, 0x21, 0x87, 0x87, 0x21,
+    0x42, 0xaf, 0xaf, 0x2b, 0x42, 0xd7, 0xd7, 0x35, 0x16, 0x17, 0x82, 0x23, 0x00, 0x0d, 0x23, 0x00,
+    0x0d, 0x24, 0x00, 0x0d, 0x42, 0x37, 0x37, 0x0d, 0x42, 0x5f, 0x5f, 0x17, 0x81, 0x87, 0x87, 0x21,
+    0x87, 0x87, 0x21, 0x42, 0xaf, 0xaf, 0x2b, 0x42, 0xd7, 0xd7, 0x35, 0x42, 0xff, 0xff, 0x3f, 0x13,
+    0x17, 0x84, 0x23, 0x00, 0x0e, 0x23, 0x00, 0x0e, 0x24, 0x00, 0x0e, 0x24, 0x00, 0x0e, 0x25, 0x00,
+    0x0e, 0x05, 0x42, 0xaf, 0xaf, 0x2b, 0x42, 0xd7, 0xd7, 0x35, 0x42, 0xff, 0xff, 0x3f, 0x13, 0x28,
+    0x42, 0xff, 0xff, 0x3f, 0x13, 0xcb, 0x1e, 0x81, 0x27, 0x00, 0x14, 0x28, 0x00, 0x14, 0x1e, 0x1d,
+    0x80, 0x26, 0x00, 0x15, 0x01, 0x80, 0x28, 0x00, 0x15, 0x1d, 0x1c, 0x80, 0x26, 0x00, 0x15, 0x03,
+    0x80, 0x29, 0x00, 0x15, 0x1c, 0x1b, 0x80, 0x25, 0x00, 0x16, 0x05, 0x80, 0x29, 0x00, 0x16, 0x1b,
+    0x1a, 0x80, 0x24, 0x00, 0x16, 0x07, 0x80, 0x2a, 0x00, 0x16, 0x1a, 0x19, 0x80, 0x24, 0x00, 0x17,
+    0x09, 0x80, 0x2b, 0x00, 0x17, 0x19, 0x18, 0x80, 0x23, 0x00, 0x17, 0x0b, 0x80, 0x2b, 0x00, 0x17,
+    0x18, 0x17, 0x80, 0x23, 0x00, 0x18, 0x0d, 0x80, 0x2c, 0x00, 0x18, 0x17, 0x16, 0x80, 0x22, 0x00,
+    0x18, 0x0f, 0x80, 0x2d, 0x00, 0x18, 0x16, 0x16, 0x80, 0x22, 0x00, 0x19, 0x0f, 0x80, 0x2d, 0x00,
+    0x19, 0x16, 0x17, 0x80, 0x23, 0x00, 0x19, 0x0d, 0x80, 0x2c, 0x00, 0x19, 0x17, 0x18, 0x80, 0x23,
+    0x00, 0x19, 0x0b, 0x80, 0x2b, 0x00, 0x19, 0x18, 0x19, 0x80, 0x24, 0x00, 0x1a, 0x09, 0x80, 0x2b,
+    0x00, 0x1a, 0x19, 0x1a, 0x80, 0x24, 0x00, 0x1a, 0x07, 0x80, 0x2a, 0x00, 0x1a, 0x1a, 0x1b, 0x80,
+    0x25, 0x00, 0x1b, 0x05, 0x80, 0x29, 0x00, 0x1b, 0x1b, 0x1c, 0x80, 0x26, 0x00, 0x1b, 0x03, 0x80,
+    0x29, 0x00, 0x1b, 0x1c, 0x1d, 0x80, 0x26, 0x00, 0x1c, 0x01, 0x80, 0x28, 0x00, 0x1c, 0x1d, 0x1e,
+    0x81, 0x27, 0x00, 0x1c, 0x28, 0x00, 0x1c, 0x1e, 0xd6, 0xc5, 0x1a, 0x82, 0x24, 0x00, 0x0c, 0x25,
+    0x00, 0x0c, 0x26, 0x00, 0x0c, 0x42, 0x37, 0x37, 0x0d, 0x42, 0x5f, 0x5f, 0x17, 0x1b, 0x1a, 0x82,
+    0x24, 0x00, 0x0d, 0x25, 0x00, 0x0d, 0x26, 0x00, 0x0d, 0x42, 0x37, 0x37, 0x0d, 0x42, 0x5f, 0x5f,
+    0x17, 0x81, 0x87, 0x87, 0x21, 0x87, 0x87, 0x21, 0x42, 0xaf, 0xaf, 0x2b, 0x16, 0x1a, 0x82, 0x24,
+    0x00, 0x0d, 0x25, 0x00, 0x0d, 0x26, 0x00, 0x0d, 0x42, 0x37, 0x37, 0x0d, 0x42, 0x5f, 0x5f, 0x17,
+    0x81, 0x87, 0x87, 0x21, 0x87, 0x87, 0x21, 0x42, 0xaf, 0xaf, 0x2b, 0x82, 0x2d, 0x00, 0x0d, 0x2e,
+    0x00, 0x0d, 0x2e, 0x00, 0x0d, 0x13, 0x22, 0x42, 0x87, 0x87, 0x21, 0x42, 0xaf, 0xaf, 0x2b, 0x42,
+    0xd7, 0xd7, 0x35, 0x13, 0x28, 0x42, 0xd7, 0xd7, 0x35, 0x42, 0xff, 0xff, 0x3f, 0x10, 0x28, 0x42,
+    0xd7, 0xd7, 0x35, 0x42, 0xff, 0xff, 0x3f, 0x10, 0x2b, 0x42, 0xff, 0xff, 0x3f, 0x10, 0xf2, 0xc5,
+    0x1d, 0x82, 0x26, 0x00, 0x0c, 0x27, 0x00, 0x0c, 0x28, 0x00, 0x0c, 0x42, 0x37, 0x37, 0x0d, 0x1b,
+    0x1d, 0x82, 0x26, 0x00, 0x0d, 0x27, 0x00, 0x0d, 0x28, 0x00, 0x0d, 0x42, 0x37, 0x37, 0x0d, 0x42,
+    0x5f, 0x5f, 0x17, 0x81, 0x2c, 0x00, 0x0d, 0x2d, 0x00, 0x0d, 0x16, 0x1d, 0x82, 0x26, 0x00, 0x0d,
+    0x27, 0x00, 0x0d, 0x28, 0x00, 0x0d, 0x42, 0x37, 0x37, 0x0d, 0x42, 0x5f, 0x5f, 0x17, 0x81, 0x87,
+    0x87, 0x21, 0x87, 0x87, 0x21, 0x16, 0x22, 0x80, 0x29, 0x00, 0x0e, 0x42, 0x5f, 0x5f, 0x17, 0x81,
+    0x87, 0x87, 0x21, 0x87, 0x87, 0x21, 0x42, 0xaf, 0xaf, 0x2b, 0x13, 0x25, 0x42, 0x87, 0x87, 0x21,
+    0x42, 0xaf, 0xaf, 0x2b, 0x42, 0xd7, 0xd7, 0x35, 0x10, 0x28, 0x42, 0xaf, 0xaf, 0x2b, 0x42, 0xd7,
+    0xd7, 0x35, 0x10, 0x2b, 0x42, 0xd7, 0xd7, 0x35, 0x81, 0xff, 0xff, 0x3f, 0xff, 0xff, 0x3f, 0x0e,
+    0x2d, 0x42, 0xff, 0xff, 0x3f, 0x0e, 0x2d, 0x42, 0xff, 0xff, 0x3f, 0x0e, 0xc8, 0x1e, 0x81, 0x27,
+    0x00, 0x15, 0x28, 0x00, 0x15, 0x1e, 0x1d, 0x80, 0x26, 0x00, 0x15, 0x01, 0x80, 0x28, 0x00, 0x15,
+    0x1d, 0x1c, 0x80, 0x26, 0x00, 0x16, 0x03, 0x80, 0x29, 0x00, 0x16, 0x1c, 0x1b, 0x80, 0x25, 0x00,
+    0x16, 0x05, 0x80, 0x29, 0x00, 0x16, 0x1b, 0x1a, 0x80, 0x24, 0x00, 0x17, 0x07, 0x80, 0x2a, 0x00,
+    0x17, 0x1a, 0x19, 0x80, 0x24, 0x00, 0x17, 0x09, 0x80, 0x2b, 0x00, 0x17, 0x19, 0x18, 0x80, 0x23,
+    0x00, 0x18, 0x0b, 0x80, 0x2b, 0x00, 0x18, 0x18, 0x17, 0x80, 0x23, 0x00, 0x18, 0x0d, 0x80, 0x2c,
+    0x00, 0x18, 0x17, 0x17, 0x80, 0x23, 0x00, 0x19, 0x0d, 0x80, 0x2c, 0x00, 0x19, 0x17, 0x18, 0x80,
+    0x23, 0x00, 0x19, 0x0b, 0x80, 0x2b, 0x00, 0x19, 0x18, 0x19, 0x80, 0x24, 0x00, 0x19, 0x09, 0x80,
+    0x2b, 0x00, 0x19, 0x19, 0x1a, 0x80, 0x24, 0x00, 0x1a, 0x07, 0x80, 0x2a, 0x00, 0x1a, 0x1a, 0x1b,
+    0x80, 0x25, 0x00, 0x1a, 0x05, 0x80, 0x29, 0x00, 0x1a, 0x1b, 0x1c, 0x80, 0x26, 0x00, 0x1b, 0x03,
+    0x80, 0x29, 0x00, 0x1b, 0x1c, 0x1d, 0x80, 0x26, 0x00, 0x1b, 0x01, 0x80, 0x28, 0x00, 0x1b, 0x1d,
+    0x1e, 0x81, 0x27, 0x00, 0x1c, 0x28, 0x00, 0x1c, 0x1e, 0xd7, 0xc5, 0x20, 0x82, 0x28, 0x00, 0x0c,
+    0x29, 0x00, 0x0c, 0x29, 0x00, 0x0c, 0x1b, 0x20, 0x82, 0x28, 0x00, 0x0d, 0x29, 0x00, 0x0d, 0x29,
+    0x00, 0x0d, 0x42, 0x37, 0x37, 0x0d, 0x18, 0x20, 0x82, 0x28, 0x00, 0x0d, 0x29, 0x00, 0x0d, 0x29,
+    0x00, 0x0d, 0x42, 0x37, 0x37, 0x0d, 0x42, 0x5f, 0x5f, 0x17, 0x15, 0x23, 0x42, 0x37, 0x37, 0x0d,
+    0x42, 0x5f, 0x5f, 0x17, 0x81, 0x87, 0x87, 0x21, 0x87, 0x87, 0x21, 0x13, 0x25, 0x80, 0x2b, 0x00,
+    0x0e, 0x42, 0x5f, 0x5f, 0x17, 0x81, 0x87, 0x87, 0x21, 0x87, 0x87, 0x21, 0x42, 0xaf, 0xaf, 0x2b,
+    0x10, 0x28, 0x42, 0x87, 0x87, 0x21, 0x42, 0xaf, 0xaf, 0x2b, 0x10, 0x2b, 0x42, 0xaf, 0xaf, 0x2b,
+    0x81, 0xd7, 0xd7, 0x35, 0xd7, 0xd7, 0x35, 0x0e, 0x2d, 0x42, 0xd7, 0xd7, 0x35, 0x0e, 0x2d, 0x42,
+    0xd7, 0xd7, 0x35, 0x81, 0xff, 0xff, 0x3f, 0xff, 0xff, 0x3f, 0x0c, 0x2f, 0x42, 0xff, 0xff, 0x3f,
+    0x0c, 0x2f, 0x42, 0xff, 0xff, 0x3f, 0x0c, 0xee, 0xc6, 0x23, 0x82, 0x2a, 0x00, 0x0d, 0x2b, 0x00,
+    0x0d, 0x2b, 0x00, 0x0d, 0x18, 0x23, 0x82, 0x2a, 0x00, 0x0d, 0x2b, 0x00, 0x0d, 0x2b, 0x00, 0x0d,
+    0x42, 0x37, 0x37, 0x0d, 0x15, 0x23, 0x82, 0x2a, 0x00, 0x0e, 0x2b, 0x00, 0x0e, 0x2b, 0x00, 0x0e,
+    0x42, 0x37, 0x37, 0x0d, 0x81, 0x5f, 0x5f, 0x17, 0x5f, 0x5f, 0x17, 0x13, 0x26, 0x42, 0x37, 0x37,
+    0x0d, 0x81, 0x5f, 0x5f, 0x17, 0x5f, 0x5f, 0x17, 0x42, 0x87, 0x87, 0x21, 0x10, 0x28, 0x42, 0x5f,
+    0x5f, 0x17, 0x42, 0x87, 0x87, 0x21, 0x10, 0x2b, 0x42, 0x87, 0x87, 0x21, 0x81, 0xaf, 0xaf, 0x2b,
+    0xaf, 0xaf, 0x2b, 0x0e, 0x2d, 0x42, 0xaf, 0xaf, 0x2b, 0x0e, 0x2d, 0x42, 0xaf, 0xaf, 0x2b, 0x81,
+    0xd7, 0xd7, 0x35, 0xd7, 0xd7, 0x35, 0x0c, 0x2f, 0x42, 0xd7, 0xd7, 0x35, 0x0c, 0x2f, 0x42, 0xd7,
+    0xd7, 0x35, 0x81, 0xff, 0xff, 0x3f, 0xff, 0xff, 0x3f, 0x0a, 0x31, 0x42, 0xff, 0xff, 0x3f, 0x0a,
+    0x31, 0x42, 0xff, 0xff, 0x3f, 0x0a, 0xec, 0xc7, 0x26, 0x82, 0x2c, 0x00, 0x0d, 0x2d, 0x00, 0x0d,
+    0x2d, 0x00, 0x0d, 0x15, 0x26, 0x81, 0x2c, 0x00, 0x0e, 0x2d, 0x00, 0x0e, 0x00, 0x81, 0x37, 0x37,
+    0x0d, 0x37, 0x37, 0x0d, 0x13, 0x26, 0x81, 0x2c, 0x00, 0x0e, 0x2d, 0x00, 0x0e, 0x00, 0x81, 0x37,
+    0x37, 0x0d, 0x37, 0x37, 0x0d, 0x42, 0x5f, 0x5f, 0x17, 0x10, 0x28, 0x42, 0x37, 0x37, 0x0d, 0x42,
+    0x5f, 0x5f, 0x17, 0x10, 0x2b, 0x42, 0x5f, 0x5f, 0x17, 0x81, 0x87, 0x87, 0x21, 0x87, 0x87, 0x21,
+    0x0e, 0x2d, 0x42, 0x87, 0x87, 0x21, 0x0e, 0x2d, 0x42, 0x87, 0x87, 0x21, 0x81, 0xaf, 0xaf, 0x2b,
+    0xaf, 0xaf, 0x2b, 0x0c, 0x2f, 0x42, 0xaf, 0xaf, 0x2b, 0x0c, 0x2f, 0x42, 0xaf, 0xaf, 0x2b, 0x81,
+    0xd7, 0xd7, 0x35, 0xd7, 0xd7, 0x35, 0x0a, 0x31, 0x42, 0xd7, 0xd7, 0x35, 0x0a, 0x31, 0x42, 0xd7,
+    0xd7, 0x35, 0x0a, 0x33, 0x42, 0xff, 0xff, 0x3f, 0x08, 0x33, 0x42, 0xff, 0xff, 0x3f, 0x08, 0x33,
+    0x42, 0xff, 0xff, 0x3f, 0x08, 0xc1, 0x1e, 0x81, 0x00, 0xa0, 0xff, 0x00, 0xa0, 0xff, 0x1e, 0x1d,
+    0x43, 0x00, 0xa0, 0xff, 0x1d, 0x1c, 0x45, 0x00, 0xa0, 0xff, 0x1c, 0x1b, 0x47, 0x00, 0xa0, 0xff,
+    0x1b, 0x1a, 0x49, 0x00, 0xa0, 0xff, 0x1a, 0x19, 0x4b, 0x00, 0xa0, 0xff, 0x19, 0x18, 0x4d, 0x00,
+    0xa0, 0xff, 0x18, 0x17, 0x4f, 0x00, 0xa0, 0xff, 0x17, 0x17, 0x4f, 0x00, 0xa0, 0xff, 0x17, 0x18,
+    0x4d, 0x00, 0xa0, 0xff, 0x18, 0x19, 0x4b, 0x00, 0xa0, 0xff, 0x19, 0x1a, 0x49, 0x00, 0xa0, 0xff,
+    0x1a, 0x1b, 0x47, 0x00, 0xa0, 0xff, 0x1b, 0x1c, 0x45, 0x00, 0xa0, 0xff, 0x1c, 0x1d, 0x43, 0x00,
+    0xa0, 0xff, 0x1d, 0x1e, 0x81, 0x00, 0xa0, 0xff, 0x00, 0xa0, 0xff, 0x1e, 0xd7, 0xc8, 0x28, 0x82,
+    0x2d, 0x00, 0x0e, 0x2e, 0x00, 0x0e, 0x2e, 0x00, 0x0e, 0x13, 0x28, 0x82, 0x2d, 0x00, 0x0e, 0x2e,
+    0x00, 0x0e, 0x2e, 0x00, 0x0e, 0x42, 0x37, 0x37, 0x0d, 0x10, 0x28, 0x82, 0x2d, 0x00, 0x0f, 0x2e,
+    0x00, 0x0f, 0x2e, 0x00, 0x0f, 0x42, 0x37, 0x37, 0x0d, 0x10, 0x2b, 0x42, 0x37, 0x37, 0x0d, 0x81,
+    0x5f, 0x5f, 0x17, 0x5f, 0x5f, 0x17, 0x0e, 0x2d, 0x42, 0x5f, 0x5f, 0x17, 0x0e, 0x2d, 0x42, 0x5f,
+    0x5f, 0x17, 0x42, 0x87, 0x87, 0x21, 0x0b, 0x2f, 0x80, 0x32, 0x00, 0x11, 0x42, 0x87, 0x87, 0x21,
+    0x0b, 0x2f, 0x80, 0x32, 0x00, 0x11, 0x42, 0x87, 0x87, 0x21, 0x80, 0xaf, 0xaf, 0x2b, 0x0a, 0x31,
+    0x42, 0xaf, 0xaf, 0x2b, 0x0a, 0x31, 0x42, 0xaf, 0xaf, 0x2b, 0x0a, 0x33, 0x42, 0xd7, 0xd7, 0x35,
+    0x08, 0x33, 0x42, 0xd7, 0xd7, 0x35, 0x08, 0x33, 0x42, 0xd7, 0xd7, 0x35, 0x08, 0x34, 0x42, 0xff,
+    0xff, 0x3f, 0x07, 0x34, 0x42, 0xff, 0xff, 0x3f, 0x07, 0x34, 0x42, 0xff, 0xff, 0x3f, 0x07, 0xe6,
+    0xc9, 0x2b, 0x82, 0x2f, 0x00, 0x0e, 0x30, 0x00, 0x0e, 0x30, 0x00, 0x0e, 0x10, 0x2b, 0x82, 0x2f,
+    0x00, 0x0f, 0x30, 0x00, 0x0f, 0x30, 0x00, 0x0f, 0x10, 0x2b, 0x82, 0x2f, 0x00, 0x0f, 0x30, 0x00,
+    0x0f, 0x30, 0x00, 0x0f, 0x42, 0x37, 0x37, 0x0d, 0x0d, 0x2d, 0x80, 0x30, 0x00, 0x10, 0x42, 0x37,
+    0x37, 0x0d, 0x0d, 0x2d, 0x80, 0x30, 0x00, 0x10, 0x42, 0x37, 0x37, 0x0d, 0x81, 0x5f, 0x5f, 0x17,
+    0x5f, 0x5f, 0x17, 0x0b, 0x30, 0x42, 0x5f, 0x5f, 0x17, 0x0b, 0x30, 0x42, 0x5f, 0x5f, 0x17, 0x80,
+    0x34, 0x00, 0x11, 0x0a, 0x31, 0x42, 0x87, 0x87, 0x21, 0x0a, 0x31, 0x42, 0x87, 0x87, 0x21, 0x0a,
+    0x31, 0x42, 0x87, 0x87, 0x21, 0x81, 0xaf, 0xaf, 0x2b, 0xaf, 0xaf, 0x2b, 0x08, 0x33, 0x42, 0xaf,
+    0xaf, 0x2b, 0x08, 0x33, 0x42, 0xaf, 0xaf, 0x2b, 0x08, 0x34, 0x42, 0xd7, 0xd7, 0x35, 0x07, 0x1e,
+    0x81, 0x00, 0xa0, 0xff, 0x00, 0xa0, 0xff, 0x13, 0x42, 0xd7, 0xd7, 0x35, 0x07, 0x1d, 0x43, 0x00,
+    0xa0, 0xff, 0x12, 0x42, 0xd7, 0xd7, 0x35, 0x80, 0xff, 0xff, 0x3f, 0x06, 0x1c, 0x45, 0x00, 0xa0,
+    0xff, 0x12, 0x42, 0xff, 0xff, 0x3f, 0x06, 0x1b, 0x47, 0x00, 0xa0, 0xff, 0x11, 0x42, 0xff, 0xff,
+    0x3f, 0x06, 0x1a, 0x49, 0x00, 0xa0, 0xff, 0x1a, 0x19, 0x4b, 0x00, 0xa0, 0xff, 0x19, 0x18, 0x4d,
+    0x00, 0xa0, 0xff, 0x18, 0x17, 0x4f, 0x00, 0xa0, 0xff, 0x17, 0x16, 0x51, 0x00, 0xa0, 0xff, 0x16,
+    0x16, 0x51, 0x00, 0xa0, 0xff, 0x16, 0x17, 0x4f, 0x00, 0xa0, 0xff, 0x17, 0x18, 0x4d, 0x00, 0xa0,
+    0xff, 0x18, 0x19, 0x4b, 0x00, 0xa0, 0xff, 0x19, 0x1a, 0x49, 0x00, 0xa0, 0xff, 0x1a, 0x1b, 0x47,
+    0x00, 0xa0, 0xff, 0x1b, 0x1c, 0x45, 0x00, 0xa0, 0xff, 0x1c, 0x1d, 0x43, 0x00, 0xa0, 0xff, 0x1d,
+    0x1e, 0x81, 0x00, 0xa0, 0xff, 0x00, 0xa0, 0xff, 0x1e, 0xd6, 0xcb, 0x2e, 0x82, 0x31, 0x00, 0x0f,
+    0x32, 0x00, 0x0f, 0x32, 0x00, 0x0f, 0x0d, 0x2e, 0x82, 0x31, 0x00, 0x10, 0x32, 0x00, 0x10, 0x32,
+    0x00, 0x10, 0x0d, 0x2e, 0x81, 0x31, 0x00, 0x10, 0x32, 0x00, 0x10, 0x00, 0x81, 0x37, 0x37, 0x0d,
+    0x37, 0x37, 0x0d, 0x0b, 0x30, 0x42, 0x37, 0x37, 0x0d, 0x0b, 0x30, 0x42, 0x37, 0x37, 0x0d, 0x0b,
+    0x31, 0x42, 0x5f, 0x5f, 0x17, 0x0a, 0x31, 0x42, 0x5f, 0x5f, 0x17, 0x0a, 0x31, 0x42, 0x5f, 0x5f,
+    0x17, 0x81, 0x87, 0x87, 0x21, 0x87, 0x87, 0x21, 0x08, 0x33, 0x42, 0x87, 0x87, 0x21, 0x08, 0x33,
+    0x42, 0x87, 0x87, 0x21, 0x08, 0x1e, 0x81, 0x00, 0xa0, 0xff, 0x00, 0xa0, 0xff, 0x13, 0x42, 0xaf,
+    0xaf, 0x2b, 0x07, 0x1d, 0x43, 0x00, 0xa0, 0xff, 0x12, 0x42, 0xaf, 0xaf, 0x2b, 0x07, 0x1c, 0x45,
+    0x00, 0xa0, 0xff, 0x11, 0x42, 0xaf, 0xaf, 0x2b, 0x80, 0x37, 0x00, 0x15, 0x06, 0x1b, 0x47, 0x00,
+    0xa0, 0xff, 0x11, 0x42, 0xd7, 0xd7, 0x35, 0x06, 0x1a, 0x49, 0x00, 0xa0, 0xff, 0x10, 0x42, 0xd7,
+    0xd7, 0x35, 0x06, 0x19, 0x4b, 0x00, 0xa0, 0xff, 0x0f, 0x42, 0xd7, 0xd7, 0x35, 0x80, 0xff, 0xff,
+    0x3f, 0x05, 0x18, 0x4d, 0x00, 0xa0, 0xff, 0x0f, 0x42, 0xff, 0xff, 0x3f, 0x05, 0x17, 0x4f, 0x00,
+    0xa0, 0xff, 0x0e, 0x42, 0xff, 0xff, 0x3f, 0x05, 0x16, 0x51, 0x00, 0xa0, 0xff, 0x16, 0x15, 0x53,
+    0x00, 0xa0, 0xff, 0x15, 0x15, 0x53, 0x00, 0xa0, 0xff, 0x15, 0x16, 0x51, 0x00, 0xa0, 0xff, 0x16,
+    0x17, 0x4f, 0x00, 0xa0, 0xff, 0x17, 0x18, 0x4d, 0x00, 0xa0, 0xff, 0x18, 0x19, 0x4b, 0x00, 0xa0,
+    0xff, 0x19, 0x1a, 0x49, 0x00, 0xa0, 0xff, 0x1a, 0x1b, 0x47, 0x00, 0xa0, 0xff, 0x1b, 0x1c, 0x45,
+    0x00, 0xa0, 0xff, 0x1c, 0x1d, 0x43, 0x00, 0xa0, 0xff, 0x1d, 0x1e, 0x81, 0x00, 0xa0, 0xff, 0x00,
+    0xa0, 0xff, 0x1e, 0xd5,
+};
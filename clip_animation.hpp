@@ -0,0 +1,115 @@
+#include <cstdio>
+
+#include "pico/stdlib.h"
+
+#include "lvgl/src/misc/lv_types.h"
+#include "lvgl/src/tick/lv_tick.h"
+#include "lvgl/src/widgets/canvas/lv_canvas.h"
+
+#include "clip_decoder.hpp"
+#include "scene.hpp"
+
+#define BYTES_PER_PIXEL (LV_COLOR_FORMAT_GET_SIZE(LV_COLOR_FORMAT_RGB888))
+
+/**
+ * @brief Plays a delta/RLE compressed clip from flash (see tools/hub75_clip.py).
+ *
+ * Only the canvas buffer lives in RAM. Each frame is decoded row by row from flash straight
+ * into the canvas buffer, unchanged rows and pixels are not touched. The clip loops.
+ */
+class ClipAnimation : public Scene
+{
+private:
+    const uint8_t *clip;
+    size_t clip_size;
+    ClipDecoder decoder;
+
+    uint width, height;
+    lv_obj_t *canvas = nullptr;
+    lv_draw_buf_t draw_buf;
+    uint8_t *data_buf = nullptr;
+
+    uint32_t frame = 0;
+    uint32_t frame_start_ms = 0;
+
+public:
+    ClipAnimation(const uint8_t *clip, size_t clip_size, uint width = 64, uint height = 64)
+        : clip(clip), clip_size(clip_size), width(width), height(height)
+    {
+    }
+
+    const char *name() const override
+    {
+        return "clip";
+    }
+
+    bool create(SceneArena::Region &memory) override
+    {
+        if (!decoder.open(clip, clip_size) || decoder.width() > width || decoder.height() > height)
+        {
+            printf("Invalid clip\n");
+            return false;
+        }
+
+        uint stride = decoder.width() * BYTES_PER_PIXEL;
+        data_buf = memory.allocate<uint8_t>(stride * decoder.height());
+        if (data_buf == nullptr)
+        {
+            printf("Failed to allocate data_buf\n");
+            return false;
+        }
+
+        lv_result_t res = lv_draw_buf_init(&draw_buf, decoder.width(), decoder.height(), LV_COLOR_FORMAT_RGB888, stride, data_buf, stride * decoder.height());
+        if (res != LV_RESULT_OK)
+        {
+            printf("lv_draw_buf_init failed %d\n", res);
+            return false;
+        }
+
+        screen = lv_obj_create(NULL);
+        lv_obj_set_style_bg_color(screen, lv_color_black(), 0);
+        canvas = lv_canvas_create(screen);
+        lv_canvas_set_draw_buf(canvas, &draw_buf);
+        lv_obj_center(canvas);
+
+        frame = 0;
+        decoder.decode(frame, data_buf, stride); // Key frame
+        frame_start_ms = lv_tick_get();
+        return true;
+    }
+
+    void update() override
+    {
+        if (lv_tick_elaps(frame_start_ms) < decoder.frame_ms())
+        {
+            return;
+        }
+        frame_start_ms += decoder.frame_ms();
+        if (lv_tick_elaps(frame_start_ms) >= decoder.frame_ms())
+        {
+            frame_start_ms = lv_tick_get(); // Fell behind - do not try to catch up
+        }
+
+        if (++frame == decoder.frame_count())
+        {
+            frame = 0;
+        }
+        if (!decoder.decode(frame, data_buf, decoder.width() * BYTES_PER_PIXEL))
+        {
+            printf("clip frame %lu corrupt\n", (unsigned long)frame);
+        }
+        lv_obj_invalidate(canvas);
+    }
+
+    void show() override
+    {
+        lv_screen_load_anim(screen, LV_SCR_LOAD_ANIM_FADE_IN, 1000, 0, false);
+    }
+
+    void destroy() override
+    {
+        Scene::destroy();
+        canvas = nullptr;
+        data_buf = nullptr; // Memory is returned with the arena region
+    }
+};
@@ -0,0 +1,144 @@
+#include <cstring>
+
+#include "clip_decoder.hpp"
+
+static inline uint16_t read_le16(const uint8_t *p)
+{
+    return static_cast<uint16_t>(p[0] | p[1] << 8);
+}
+
+static inline uint32_t read_le32(const uint8_t *p)
+{
+    return p[0] | static_cast<uint32_t>(p[1]) << 8 | static_cast<uint32_t>(p[2]) << 16 | static_cast<uint32_t>(p[3]) << 24;
+}
+
+bool ClipDecoder::open(const uint8_t *data, size_t size)
+{
+    clip = nullptr;
+    if (size < CLIP_HEADER_SIZE || read_le32(data) != CLIP_MAGIC)
+    {
+        return false;
+    }
+
+    uint16_t w = read_le16(data + 4);
+    uint16_t h = read_le16(data + 6);
+    uint16_t n = read_le16(data + 8);
+    if (w == 0 || h == 0 || n == 0 || size < CLIP_HEADER_SIZE + n * sizeof(uint32_t))
+    {
+        return false;
+    }
+
+    // Offsets have to be ascending and inside the clip, so decode() only needs to check against the next one
+    uint32_t previous = CLIP_HEADER_SIZE + n * sizeof(uint32_t);
+    for (uint32_t i = 0; i < n; i++)
+    {
+        uint32_t offset = read_le32(data + CLIP_HEADER_SIZE + i * sizeof(uint32_t));
+        if (offset < previous || offset > size)
+        {
+            return false;
+        }
+        previous = offset;
+    }
+
+    clip = data;
+    clip_size = size;
+    clip_width = w;
+    clip_height = h;
+    count = n;
+    delay_ms = read_le16(data + 10);
+    return true;
+}
+
+uint32_t ClipDecoder::frame_offset(uint32_t index) const
+{
+    return index < count ? read_le32(clip + CLIP_HEADER_SIZE + index * sizeof(uint32_t)) : clip_size;
+}
+
+/**
+ * @brief Decodes the operations of one row.
+ *
+ * @param p Read position, advanced past the row.
+ * @param end End of the frame data.
+ * @param row Destination row.
+ * @return false if the data is corrupt.
+ */
+bool ClipDecoder::decode_row(const uint8_t *&p, const uint8_t *end, uint8_t *row) const
+{
+    uint32_t x = 0;
+    while (x < clip_width)
+    {
+        if (p >= end)
+        {
+            return false;
+        }
+        uint8_t op = *p & CLIP_OP_MASK;
+        uint32_t n = (*p++ & CLIP_COUNT_MASK) + 1;
+        if (x + n > clip_width)
+        {
+            return false;
+        }
+
+        uint8_t *dst = row + x * CLIP_BYTES_PER_PIXEL;
+        switch (op)
+        {
+        case CLIP_OP_SKIP:
+            break;
+        case CLIP_OP_FILL:
+            if (end - p < CLIP_BYTES_PER_PIXEL)
+            {
+                return false;
+            }
+            for (uint32_t i = 0; i < n; i++, dst += CLIP_BYTES_PER_PIXEL)
+            {
+                dst[0] = p[0];
+                dst[1] = p[1];
+                dst[2] = p[2];
+            }
+            p += CLIP_BYTES_PER_PIXEL;
+            break;
+        case CLIP_OP_COPY:
+            if (static_cast<size_t>(end - p) < n * CLIP_BYTES_PER_PIXEL)
+            {
+                return false;
+            }
+            memcpy(dst, p, n * CLIP_BYTES_PER_PIXEL);
+            p += n * CLIP_BYTES_PER_PIXEL;
+            break;
+        default:
+            return false; // Row skips are only valid at the start of a row
+        }
+        x += n;
+    }
+    return true;
+}
+
+bool ClipDecoder::decode(uint32_t index, uint8_t *dst, uint32_t stride) const
+{
+    if (clip == nullptr || index >= count)
+    {
+        return false;
+    }
+
+    const uint8_t *p = clip + frame_offset(index);
+    const uint8_t *end = clip + frame_offset(index + 1);
+
+    uint32_t y = 0;
+    while (y < clip_height)
+    {
+        if (p >= end)
+        {
+            return false;
+        }
+        if ((*p & CLIP_OP_MASK) == CLIP_OP_SKIP_ROWS)
+        {
+            y += (*p++ & CLIP_COUNT_MASK) + 1;
+            continue;
+        }
+        if (!decode_row(p, end, dst + y * stride))
+        {
+            return false;
+        }
+        y++;
+    }
+    return y == clip_height;
+}
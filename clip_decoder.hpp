@@ -0,0 +1,90 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Decoder for delta/RLE compressed animations stored in flash ("clips", see tools/hub75_clip.py).
+//
+// Layout (little endian):
+//   ClipHeader
+//   uint32_t frame_offset[frame_count]   byte offset of every frame from the start of the clip
+//   frame data
+//
+// A frame is a sequence of row operations. The upper two bits of an op byte select the
+// operation, the lower six bits hold count - 1 (1 to 64):
+//   CLIP_OP_SKIP       keep count pixels of the previous frame
+//   CLIP_OP_FILL       one pixel follows, repeated count times
+//   CLIP_OP_COPY       count pixels follow
+//   CLIP_OP_SKIP_ROWS  keep count whole rows of the previous frame (only at the start of a row)
+// Pixels are 3 bytes in LVGL's RGB888 memory order (B, G, R), so literals are copied unchanged.
+// The first frame is a key frame without skips, so the clip can loop.
+
+#define CLIP_MAGIC 0x41353748u ///< "H75A" as little endian 32-bit word
+#define CLIP_HEADER_SIZE 12
+#define CLIP_BYTES_PER_PIXEL 3
+
+#define CLIP_OP_MASK 0xc0
+#define CLIP_COUNT_MASK 0x3f
+#define CLIP_OP_SKIP 0x00
+#define CLIP_OP_FILL 0x40
+#define CLIP_OP_COPY 0x80
+#define CLIP_OP_SKIP_ROWS 0xc0
+
+/**
+ * @brief Decodes the frames of a clip row by row into a caller-provided RGB888 buffer.
+ *
+ * Delta frames only touch the pixels that changed, so the destination has to hold the
+ * previously decoded frame. The decoder keeps no state besides the clip pointer.
+ */
+class ClipDecoder
+{
+private:
+    const uint8_t *clip = nullptr;
+    size_t clip_size = 0;
+    uint16_t clip_width = 0;
+    uint16_t clip_height = 0;
+    uint16_t count = 0;
+    uint16_t delay_ms = 0;
+
+    uint32_t frame_offset(uint32_t index) const;
+    bool decode_row(const uint8_t *&p, const uint8_t *end, uint8_t *row) const;
+
+public:
+    /**
+     * @brief Validates the clip header and offset table.
+     *
+     * @return false if the data is not a valid clip.
+     */
+    bool open(const uint8_t *data, size_t size);
+
+    /**
+     * @brief Decodes a frame.
+     *
+     * @param index Frame index.
+     * @param dst Destination holding the previous frame, at least height rows of stride bytes.
+     * @param stride Bytes per destination row.
+     * @return false if the frame data is corrupt. The destination may be partially updated then.
+     */
+    bool decode(uint32_t index, uint8_t *dst, uint32_t stride) const;
+
+    uint16_t width() const
+    {
+        return clip_width;
+    }
+
+    uint16_t height() const
+    {
+        return clip_height;
+    }
+
+    uint16_t frame_count() const
+    {
+        return count;
+    }
+
+    /// @brief Display time of one frame in milliseconds.
+    uint16_t frame_ms() const
+    {
+        return delay_ms;
+    }
+};
@@ -10,11 +10,12 @@
 
 #include "colour_squares.h"
 
+#include "scene.hpp"
+
 #define BYTES_PER_PIXEL (LV_COLOR_FORMAT_GET_SIZE(LV_COLOR_FORMAT_RGB888))
-class ColourCheck
+class ColourCheck : public Scene
 {
 private:
-    lv_obj_t *screen = nullptr;
     lv_obj_t *colour_squares = nullptr;
     lv_image_header_t header;
     lv_image_dsc_t img_desc;
@@ -24,6 +25,15 @@ private:
 
 public:
     explicit ColourCheck(uint width = 64, uint height = 64) : width(width), height(height)
+    {
+    }
+
+    const char *name() const override
+    {
+        return "colour";
+    }
+
+    bool create(SceneArena::Region &) override
     {
         screen = lv_obj_create(NULL);
 
@@ -47,11 +57,18 @@ public:
         lv_image_set_antialias(colour_squares, true);
         lv_image_set_pivot(colour_squares, 256 / 2, 180 / 2);
         lv_obj_align(colour_squares, LV_ALIGN_CENTER, 0, 0);
+
+        return true;
     }
 
     void colour_test();
 
-    void show()
+    void update() override
+    {
+        colour_test();
+    }
+
+    void show() override
     {
         if (screen)
         {
@@ -59,15 +76,10 @@ public:
         }
     }
 
-    ~ColourCheck()
+    void destroy() override
     {
-        if (screen)
-            lv_obj_clean(screen);
-
-        if (colour_squares)
-        {
-            lv_obj_delete_async(colour_squares);
-            colour_squares = nullptr;
-        }
+        Scene::destroy();
+        colour_squares = nullptr;
+        lv_image_cache_drop(&img_desc); // Releases the scaled copy held by the transformed image cache
     }
 };
@@ -0,0 +1,67 @@
+#include <cmath>
+
+#include "colour_lut.hpp"
+
+// Pimoroni's 10-bit table (https://github.com/pimoroni/pimoroni-pico/tree/main/drivers/hub75), the
+// output of the curve with default_colour_calibration. The driver's default tables are built from it
+// by the compiler, so no curve has to be computed before the splash frame.
+static constexpr uint16_t pimoroni_lut[256] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 82, 84, 87, 89, 91, 94, 96, 98, 101, 103, 106, 109, 111, 114, 117,
+    119, 122, 125, 128, 130, 133, 136, 139, 142, 145, 148, 151, 155, 158, 161, 164,
+    167, 171, 174, 177, 181, 184, 188, 191, 195, 198, 202, 206, 209, 213, 217, 221,
+    225, 228, 232, 236, 240, 244, 248, 252, 257, 261, 265, 269, 274, 278, 282, 287,
+    291, 295, 300, 304, 309, 314, 318, 323, 328, 333, 337, 342, 347, 352, 357, 362,
+    367, 372, 377, 382, 387, 393, 398, 403, 408, 414, 419, 425, 430, 436, 441, 447,
+    452, 458, 464, 470, 475, 481, 487, 493, 499, 505, 511, 517, 523, 529, 535, 542,
+    548, 554, 561, 567, 573, 580, 586, 593, 599, 606, 613, 619, 626, 633, 640, 647,
+    653, 660, 667, 674, 681, 689, 696, 703, 710, 717, 725, 732, 739, 747, 754, 762,
+    769, 777, 784, 792, 800, 807, 815, 823, 831, 839, 847, 855, 863, 871, 879, 887,
+    895, 903, 912, 920, 928, 937, 945, 954, 962, 971, 979, 988, 997, 1005, 1014, 1023};
+
+static constexpr ColourLut builtin_tables()
+{
+    ColourLut lut = {};
+    for (unsigned int i = 0; i < 256; i++)
+    {
+        lut.r[i] = static_cast<uint32_t>(pimoroni_lut[i]) << COLOUR_LUT_SHIFT_R;
+        lut.g[i] = static_cast<uint32_t>(pimoroni_lut[i]) << COLOUR_LUT_SHIFT_G;
+        lut.b[i] = static_cast<uint32_t>(pimoroni_lut[i]) << COLOUR_LUT_SHIFT_B;
+    }
+    return lut;
+}
+
+constexpr ColourLut builtin_colour_lut = builtin_tables();
+
+uint32_t colour_curve(const ColourCalibration &calibration, ColourChannel channel, uint8_t value, unsigned int bits)
+{
+    float full_scale = static_cast<float>((1u << bits) - 1);
+    float curve = full_scale * powf(value / 255.0f, calibration.gamma[channel]);
+    float linear = static_cast<float>(value);
+    float gain = calibration.gain[channel];
+    if (gain < 0.0f)
+    {
+        gain = 0.0f;
+    }
+    else if (gain > 1.0f)
+    {
+        gain = 1.0f;
+    }
+
+    float out = gain * (curve > linear ? curve : linear) + 0.5f;
+    return out > full_scale ? static_cast<uint32_t>(full_scale) : static_cast<uint32_t>(out);
+}
+
+void build_colour_lut(ColourLut &lut, const ColourCalibration &calibration)
+{
+    for (unsigned int i = 0; i < 256; i++)
+    {
+        lut.r[i] = colour_curve(calibration, COLOUR_RED, i, 10) << COLOUR_LUT_SHIFT_R;
+        lut.g[i] = colour_curve(calibration, COLOUR_GREEN, i, 10) << COLOUR_LUT_SHIFT_G;
+        lut.b[i] = colour_curve(calibration, COLOUR_BLUE, i, 10) << COLOUR_LUT_SHIFT_B;
+    }
+}
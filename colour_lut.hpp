@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstdint>
+
+// Generator of the colour look-up tables which convert 8-bit source channels into the driver's
+// RGB101010 pixel words.
+//
+// The curve is the one of Pimoroni's HUB75 driver (https://github.com/pimoroni/pimoroni-pico/tree/main/drivers/hub75),
+// generalised per channel: value = round(gain * max(i, full_scale * (i / 255)^gamma)).
+// The linear toe keeps every dark input value distinct, the default gamma of 2.2 and gain of 1
+// reproduce Pimoroni's 10-bit table exactly.
+
+#define COLOUR_LUT_SHIFT_R 0  ///< Position of the red channel in a pixel word
+#define COLOUR_LUT_SHIFT_G 10 ///< Position of the green channel in a pixel word
+#define COLOUR_LUT_SHIFT_B 20 ///< Position of the blue channel in a pixel word
+
+#define COLOUR_DEFAULT_GAMMA 2.2f
+
+/// @brief Colour channels in the order of the calibration arrays
+enum ColourChannel
+{
+    COLOUR_RED,
+    COLOUR_GREEN,
+    COLOUR_BLUE
+};
+
+/**
+ * @brief Calibration of a panel (batch).
+ *
+ * The gains set the white point: LEDs of one batch often differ in efficiency, e.g. a bluish
+ * white is corrected by a blue gain below 1.
+ */
+struct ColourCalibration
+{
+    float gamma[3]; ///< Gamma exponent per channel
+    float gain[3];  ///< Scale of the full-scale output per channel, 0...1
+};
+
+/// @brief Calibration of the built-in table: gamma 2.2 and full scale for all channels
+static constexpr ColourCalibration default_colour_calibration = {
+    {COLOUR_DEFAULT_GAMMA, COLOUR_DEFAULT_GAMMA, COLOUR_DEFAULT_GAMMA},
+    {1.0f, 1.0f, 1.0f}};
+
+/**
+ * @brief Per-channel look-up tables, pre-shifted to the channel's position in the pixel word.
+ *
+ * A pixel word is r[R] | g[G] | b[B] - three loads and two ORs.
+ */
+struct ColourLut
+{
+    uint32_t r[256];
+    uint32_t g[256];
+    uint32_t b[256];
+};
+
+/// @brief Tables of default_colour_calibration, generated at compile time
+extern const ColourLut builtin_colour_lut;
+
+/**
+ * @brief Calibrated output of one channel.
+ *
+ * @param calibration The calibration.
+ * @param channel The channel.
+ * @param value 8-bit input value.
+ * @param bits Output resolution, e.g. 10 for the bit planes or 12 for temporal dithering.
+ * @return Output value, 0 ... 2^bits - 1.
+ */
+uint32_t colour_curve(const ColourCalibration &calibration, ColourChannel channel, uint8_t value, unsigned int bits);
+
+/**
+ * @brief Builds the three pre-shifted 10-bit tables.
+ */
+void build_colour_lut(ColourLut &lut, const ColourCalibration &calibration);
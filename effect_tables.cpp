@@ -0,0 +1,44 @@
+#include "effect_tables.hpp"
+
+const int8_t effect_sine_table[256] = {
+       0,    3,    6,    9,   12,   16,   19,   22,   25,   28,   31,   34,   37,   40,   43,   46,
+      49,   51,   54,   57,   60,   63,   65,   68,   71,   73,   76,   78,   81,   83,   85,   88,
+      90,   92,   94,   96,   98,  100,  102,  104,  106,  107,  109,  111,  112,  113,  115,  116,
+     117,  118,  120,  121,  122,  122,  123,  124,  125,  125,  126,  126,  126,  127,  127,  127,
+     127,  127,  127,  127,  126,  126,  126,  125,  125,  124,  123,  122,  122,  121,  120,  118,
+     117,  116,  115,  113,  112,  111,  109,  107,  106,  104,  102,  100,   98,   96,   94,   92,
+      90,   88,   85,   83,   81,   78,   76,   73,   71,   68,   65,   63,   60,   57,   54,   51,
+      49,   46,   43,   40,   37,   34,   31,   28,   25,   22,   19,   16,   12,    9,    6,    3,
+       0,   -3,   -6,   -9,  -12,  -16,  -19,  -22,  -25,  -28,  -31,  -34,  -37,  -40,  -43,  -46,
+     -49,  -51,  -54,  -57,  -60,  -63,  -65,  -68,  -71,  -73,  -76,  -78,  -81,  -83,  -85,  -88,
+     -90,  -92,  -94,  -96,  -98, -100, -102, -104, -106, -107, -109, -111, -112, -113, -115, -116,
+    -117, -118, -120, -121, -122, -122, -123, -124, -125, -125, -126, -126, -126, -127, -127, -127,
+    -127, -127, -127, -127, -126, -126, -126, -125, -125, -124, -123, -122, -122, -121, -120, -118,
+    -117, -116, -115, -113, -112, -111, -109, -107, -106, -104, -102, -100,  -98,  -96,  -94,  -92,
+     -90,  -88,  -85,  -83,  -81,  -78,  -76,  -73,  -71,  -68,  -65,  -63,  -60,  -57,  -54,  -51,
+     -49,  -46,  -43,  -40,  -37,  -34,  -31,  -28,  -25,  -22,  -19,  -16,  -12,   -9,   -6,   -3,
+};
+
+void gradient_palette(const GradientStop *stops, uint32_t count, lv_color_t *palette)
+{
+    uint32_t stop = 0;
+    for (uint32_t i = 0; i < 256; i++)
+    {
+        while (stop + 2 < count && i > stops[stop + 1].index)
+        {
+            stop++;
+        }
+        const GradientStop &a = stops[stop];
+        const GradientStop &b = stops[stop + 1];
+        int32_t span = b.index - a.index;
+        int32_t t = span > 0 ? (static_cast<int32_t>(i) - a.index) * 256 / span : 256;
+        t = t < 0 ? 0 : (t > 256 ? 256 : t);
+        auto channel = [t](uint32_t from, uint32_t to, int shift) -> uint8_t
+        {
+            int32_t c0 = (from >> shift) & 0xFF;
+            int32_t c1 = (to >> shift) & 0xFF;
+            return static_cast<uint8_t>(c0 + (((c1 - c0) * t) >> 8));
+        };
+        palette[i] = lv_color_make(channel(a.color, b.color, 16), channel(a.color, b.color, 8), channel(a.color, b.color, 0));
+    }
+}
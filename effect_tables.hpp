@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstdint>
+
+#include "lvgl/src/misc/lv_color.h"
+
+// Sine table and gradient palettes shared by the procedural effects and the particle system.
+
+extern const int8_t effect_sine_table[256]; ///< round(127 * sin(2 pi i / 256))
+
+/// @brief Sine of a 256-step angle, -127..127
+static inline int32_t effect_sin(uint32_t angle)
+{
+    return effect_sine_table[angle & 0xFF];
+}
+
+/// @brief Cosine of a 256-step angle, -127..127
+static inline int32_t effect_cos(uint32_t angle)
+{
+    return effect_sine_table[(angle + 64) & 0xFF];
+}
+
+/// @brief Point of a palette gradient
+struct GradientStop
+{
+    uint8_t index;  ///< Palette index, increasing along the gradient
+    uint32_t color; ///< 0xRRGGBB
+};
+
+/**
+ * @brief Fills a 256-entry palette by linear interpolation between gradient stops.
+ *
+ * @param stops At least 2 stops, the first at index 0, the last at 255.
+ * @param count Number of stops.
+ * @param palette 256 entries.
+ */
+void gradient_palette(const GradientStop *stops, uint32_t count, lv_color_t *palette);
+
+/// @brief Stores a colour as an RGB888 (3) or XRGB8888 (4) pixel
+template <uint32_t PIXEL_SIZE>
+static inline void effect_put_pixel(uint8_t *p, const lv_color_t &c)
+{
+    p[0] = c.blue;
+    p[1] = c.green;
+    p[2] = c.red;
+    if (PIXEL_SIZE == 4)
+    {
+        p[3] = 0xFF;
+    }
+}
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+/**
+ * @brief Bounded lock-free multi-producer / single-consumer queue.
+ *
+ * Producers may run in interrupt context (e.g. repeating timer callbacks) or on
+ * the other core, the consumer is the main loop. Every cell carries a sequence
+ * number telling whether it is free for the producer which reserved it or holds
+ * data for the consumer (D. Vyukov's bounded queue). A producer interrupted between
+ * reserving and publishing a cell never blocks another producer; the consumer just
+ * sees that cell as not yet ready.
+ *
+ * `post()` never waits - it returns false if the queue is full, so it is safe in IRQ handlers.
+ *
+ * Requires lock-free 32-bit atomics (Cortex-M33 on the RP2350).
+ *
+ * @tparam T Type of the queued events (trivially copyable).
+ * @tparam N Capacity, must be a power of two.
+ */
+template <typename T, uint32_t N>
+class EventQueue
+{
+private:
+    static_assert(N >= 2 && (N & (N - 1)) == 0, "EventQueue capacity must be a power of two");
+    static_assert(std::atomic<uint32_t>::is_always_lock_free, "EventQueue requires lock-free atomics");
+
+    struct Cell
+    {
+        std::atomic<uint32_t> seq;
+        T data;
+    };
+
+    Cell cells[N];
+    std::atomic<uint32_t> head{0}; ///< Next position to read (consumer only)
+    std::atomic<uint32_t> tail{0}; ///< Next position to reserve (producers)
+
+public:
+    EventQueue()
+    {
+        for (uint32_t i = 0; i < N; i++)
+        {
+            cells[i].seq.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    EventQueue(const EventQueue &) = delete;
+    EventQueue &operator=(const EventQueue &) = delete;
+
+    /**
+     * @brief Appends an event. Safe to call from any core and from interrupt context.
+     *
+     * @param event Event to append.
+     * @return false if the queue is full and the event has been dropped.
+     */
+    bool post(const T &event)
+    {
+        uint32_t pos = tail.load(std::memory_order_relaxed);
+        Cell *cell;
+        while (true)
+        {
+            cell = &cells[pos & (N - 1)];
+            int32_t diff = static_cast<int32_t>(cell->seq.load(std::memory_order_acquire) - pos);
+            if (diff == 0)
+            {
+                if (tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (diff < 0)
+            {
+                return false; // full
+            }
+            else
+            {
+                pos = tail.load(std::memory_order_relaxed);
+            }
+        }
+        cell->data = event;
+        cell->seq.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Removes the oldest event. Must only be called by the single consumer.
+     *
+     * @param event Receives the event.
+     * @return false if no event is available.
+     */
+    bool poll(T &event)
+    {
+        uint32_t pos = head.load(std::memory_order_relaxed);
+        Cell &cell = cells[pos & (N - 1)];
+        if (static_cast<int32_t>(cell.seq.load(std::memory_order_acquire) - (pos + 1)) < 0)
+        {
+            return false; // empty, or the oldest event is not yet published
+        }
+        event = cell.data;
+        cell.seq.store(pos + N, std::memory_order_release);
+        head.store(pos + 1, std::memory_order_relaxed);
+        return true;
+    }
+};
@@ -1,7 +1,6 @@
 // Example derived from https://github.com/pimoroni/pimoroni-pico/blob/main/examples/interstate75/interstate75_fire_effect.cpp
 #include "fire_effect.hpp"
-
-#include <cstdlib>
+#include "scene_random.hpp"
 
 // Display size in pixels
 // Should be either 64x64 or 32x32 but perhaps 64x32 an other sizes will work.
@@ -42,14 +41,14 @@ void FireEffect::burn()
     // clear the bottom row and then add a new fire seed to it
     for (int x = 0; x < width; x++)
     {
-        set(x, height - 1, (rand() % 200) / 1000.0f);
+        set(x, height - 1, scene_random_below(200) / 1000.0f);
     }
 
     // add a new random heat source
     int source_count = landscape ? 7 : 1;
     for (int c = 0; c < source_count; c++)
     {
-        int px = (rand() % (width - 4)) + 2;
+        int px = scene_random_below(width - 4) + 2;
         set(px, height - 2, 1.0f);
         set(px + 1, height - 2, 1.0f);
         set(px - 1, height - 2, 1.0f);
@@ -7,54 +7,65 @@
 #include "lvgl/src/misc/lv_color.h"
 #include "lvgl/src/widgets/canvas/lv_canvas.h"
 
+#include "scene.hpp"
+
 #define BYTES_PER_PIXEL (LV_COLOR_FORMAT_GET_SIZE(LV_COLOR_FORMAT_RGB888))
 
-class FireEffect
+class FireEffect : public Scene
 {
 private:
-    float *heat; // Pointer to dynamically allocated memory
+    float *heat; // Heat map, allocated from the scene arena
 
     uint width, height;
     bool landscape = true;
-    lv_obj_t *screen;
     lv_obj_t *canvas;
-    lv_draw_buf_t *draw_buf;
+    lv_draw_buf_t draw_buf;
     lv_layer_t layer;
     uint8_t *data_buf;
 
 public:
     explicit FireEffect(uint width = 64, uint height = 64) : width(width), height(height)
     {
-        heat = new float[width * height](); // Allocate memory and zero-initialize
+    }
+
+    const char *name() const override
+    {
+        return "fire";
+    }
+
+    bool create(SceneArena::Region &memory) override
+    {
+        heat = memory.allocate<float>(width * height); // Zero-initialised
 
-        data_buf = new uint8_t[width * height * BYTES_PER_PIXEL]();
-        if (data_buf == nullptr)
+        data_buf = memory.allocate<uint8_t>(width * height * BYTES_PER_PIXEL);
+        if (heat == nullptr || data_buf == nullptr)
         {
             printf("Failed to allocate data_buf\n");
-            return;
+            return false;
         }
 
-        /*Create a buffer for the canvas*/
-        draw_buf = lv_draw_buf_create(width, height, LV_COLOR_FORMAT_RGB888, LV_STRIDE_AUTO);
-        lv_result_t res = lv_draw_buf_init(draw_buf, width, height, LV_COLOR_FORMAT_RGB888, LV_STRIDE_AUTO, data_buf, width * height * BYTES_PER_PIXEL);
+        /*Initialise the canvas buffer descriptor with the arena memory*/
+        lv_result_t res = lv_draw_buf_init(&draw_buf, width, height, LV_COLOR_FORMAT_RGB888, LV_STRIDE_AUTO, data_buf, width * height * BYTES_PER_PIXEL);
         if (res != LV_RESULT_OK)
         {
             printf("lv_draw_buf_init failed %d\n", res);
+            return false;
         }
 
         screen = lv_obj_create(NULL);
         canvas = lv_canvas_create(screen);
-        lv_canvas_set_buffer(canvas, data_buf, width, height, LV_COLOR_FORMAT_RGB888);
-        lv_canvas_set_draw_buf(canvas, draw_buf);
+        lv_canvas_set_draw_buf(canvas, &draw_buf);
         lv_obj_center(canvas);
         lv_canvas_fill_bg(canvas, lv_color_make(200, 120, 70), LV_OPA_COVER);
+
+        return true;
     }
 
-    ~FireEffect()
+    void destroy() override
     {
-        lv_draw_buf_destroy(draw_buf); // Free the draw buffer
-
-        delete[] heat; // Properly deallocate memory
+        Scene::destroy();
+        heat = nullptr; // Memory is returned with the arena region
+        data_buf = nullptr;
     }
 
     void set(int x, int y, float v)
@@ -81,7 +92,12 @@ public:
 
     void burn();
 
-    void show()
+    void update() override
+    {
+        burn();
+    }
+
+    void show() override
     {
         lv_screen_load_anim(screen, LV_SCR_LOAD_ANIM_MOVE_TOP, 1000, 0, false);
     }
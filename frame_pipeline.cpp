@@ -0,0 +1,34 @@
+#include "pico/multicore.h"
+#include "pico/stdlib.h"
+
+#include "frame_pipeline.hpp"
+
+void FramePipeline::hand_over(uint32_t number)
+{
+    handed_over.fetch_add(1, std::memory_order_relaxed);
+    multicore_fifo_push_blocking(number);
+}
+
+uint32_t FramePipeline::take(bool &convert)
+{
+    uint32_t number = multicore_fifo_pop_blocking();
+    // Read after the pop: a claim() which has already seen this buffer as pending waits for done()
+    convert = !claimed.load(std::memory_order_seq_cst);
+    return number;
+}
+
+void FramePipeline::drain()
+{
+    uint32_t pending = handed_over.load(std::memory_order_relaxed);
+    while (finished.load(std::memory_order_acquire) != pending)
+    {
+        tight_loop_contents();
+    }
+}
+
+void FramePipeline::claim()
+{
+    // Published before the pending count is read, so core 1 either sees the claim or is waited for
+    claimed.store(true, std::memory_order_seq_cst);
+    drain();
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+/**
+ * @brief Hand-over of rendered frames from core 0 to the converter on core 1.
+ *
+ * Core 0 passes buffers by number through the multicore FIFO, core 1 converts them and reports
+ * every buffer it has finished with. The converter (update(), update_bgr(), update_row(),
+ * load_row(), invalidate_frame()) is not reentrant, so core 0 claims it before using it itself
+ * (USB or network stream): `claim()` waits until core 1 has finished every buffer handed over,
+ * and core 1 leaves the buffers handed over afterwards unconverted until `release()`.
+ *
+ * Core 0 calls hand_over(), claim(), release() and drain(), core 1 calls take() and done().
+ */
+class FramePipeline
+{
+private:
+    std::atomic<uint32_t> handed_over{0}; ///< Buffers pushed by core 0
+    std::atomic<uint32_t> finished{0};    ///< Buffers core 1 has finished with
+    std::atomic<bool> claimed{false};     ///< Core 0 uses the converter itself
+
+public:
+    /**
+     * @brief Passes a buffer to core 1, blocks while the FIFO is full.
+     *
+     * @param number Buffer number, a FIFO word cannot hold a 64-bit host pointer.
+     */
+    void hand_over(uint32_t number);
+
+    /**
+     * @brief Waits for the next buffer on core 1.
+     *
+     * @param convert Set to false if core 0 has claimed the converter and the buffer must not be converted.
+     * @return Number of the buffer.
+     */
+    uint32_t take(bool &convert);
+
+    /// @brief Core 1 has finished with the buffer taken last, its conversion results are visible to core 0.
+    void done()
+    {
+        finished.fetch_add(1, std::memory_order_release);
+    }
+
+    /// @brief Waits until core 1 has finished every buffer handed over.
+    void drain();
+
+    /// @brief Takes the converter over for core 0, returns once core 1 has let go of it.
+    void claim();
+
+    /// @brief Hands the converter back to core 1 for the buffers handed over from now on.
+    void release()
+    {
+        claimed.store(false, std::memory_order_release);
+    }
+
+    /// @brief true while core 0 has claimed the converter
+    bool is_claimed() const
+    {
+        return claimed.load(std::memory_order_relaxed);
+    }
+};
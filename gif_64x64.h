@@ -0,0 +1,886 @@
+// Generated by tools/hub75_gif.py - 64x64, 24 frames, 14049 bytes
+#pragma once
+
+#include <cstdint>
+
+static const uint8_t gif_64x64[14049] = {
+    0x47, 0x49, 0x46, 0x38, 0x39, 0x61, 0x40, 0x00, 0x40, 0x00, 0xf7, 0x00, 0x00, 0xfe, 0x3f, 0x3f,
+    0xf9, 0x5e, 0x25, 0xec, 0x7f, 0x11, 0xd8, 0x9f, 0x04, 0xbe, 0xbe, 0x00, 0x9f, 0xd8, 0x04, 0x7f,
+    0xec, 0x11, 0x5e, 0xf9, 0x25, 0x3f, 0xfe, 0x3f, 0x25, 0xf9, 0x5e, 0x11, 0xec, 0x7f, 0x04, 0xd8,
+    0x9f, 0x00, 0xbe, 0xbe, 0x04, 0x9f, 0xd8, 0x11, 0x7e, 0xec, 0x25, 0x5e, 0xf9, 0x3f, 0x3f, 0xfe,
+    0x5e, 0x25, 0xf9, 0x7e, 0x11, 0xec, 0x9f, 0x04, 0xd8, 0xbe, 0x00, 0xbe, 0xd8, 0x04, 0x9f, 0xec,
+    0x11, 0x7f, 0xf9, 0x25, 0x5e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0xff, 0x0b,
+    0x4e, 0x45, 0x54, 0x53, 0x43, 0x41, 0x50, 0x45, 0x32, 0x2e, 0x30, 0x03, 0x01, 0x00, 0x00, 0x00,
+    0x21, 0xf9, 0x04, 0x04, 0x05, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40,
+    0x00, 0x00, 0x08, 0xff, 0x00, 0xff, 0x09, 0x1c, 0x48, 0xb0, 0xa0, 0xc1, 0x82, 0x0f, 0x12, 0x2a,
+    0x94, 0xc0, 0xb0, 0xe1, 0xc1, 0x87, 0x10, 0x23, 0x4a, 0x1c, 0xa8, 0xb0, 0xe2, 0xc2, 0x86, 0x18,
+    0x19, 0x4e, 0xdc, 0xc8, 0x91, 0xa2, 0xc5, 0x8f, 0x19, 0x43, 0x4a, 0xe8, 0x48, 0xd2, 0xe0, 0xc7,
+    0x93, 0x09, 0x45, 0xaa, 0x2c, 0x49, 0x12, 0x25, 0x4a, 0x95, 0x2b, 0x59, 0x4a, 0x74, 0xe9, 0x12,
+    0x26, 0x4c, 0x99, 0x0f, 0x69, 0xd6, 0xb4, 0x19, 0x13, 0xa7, 0x40, 0x9d, 0x34, 0x79, 0xda, 0xf4,
+    0x09, 0x34, 0xa8, 0xd0, 0x9b, 0x2c, 0x8b, 0x1a, 0x3d, 0x2a, 0xb2, 0x42, 0x49, 0x06, 0x0c, 0x94,
+    0xbe, 0x64, 0x1a, 0xb2, 0x82, 0xd5, 0x8e, 0x50, 0xa1, 0x4a, 0x05, 0x49, 0x15, 0xa3, 0xd5, 0xaf,
+    0x1c, 0xb3, 0x6a, 0xdd, 0x7a, 0xb1, 0xab, 0x84, 0xaf, 0x60, 0x27, 0x8a, 0xcd, 0x4a, 0x36, 0xa5,
+    0x59, 0xb4, 0x68, 0x25, 0xae, 0x15, 0xdb, 0xf6, 0x2d, 0xdc, 0xb8, 0x10, 0xe7, 0xd2, 0xdd, 0xda,
+    0xf5, 0x2e, 0xdc, 0xbc, 0x7a, 0xf7, 0x2a, 0xa5, 0xea, 0xf7, 0xee, 0xc1, 0xc0, 0x73, 0xa5, 0x32,
+    0x2d, 0xec, 0xd7, 0x20, 0xe2, 0xc4, 0x45, 0x8f, 0x32, 0x6e, 0x5c, 0xf0, 0x31, 0x64, 0x9d, 0x42,
+    0x27, 0x53, 0x1e, 0x68, 0x59, 0x2f, 0x50, 0x9e, 0x9a, 0x0b, 0x13, 0xec, 0xec, 0x79, 0x69, 0xd3,
+    0xd0, 0x9b, 0x49, 0x07, 0x36, 0x9d, 0x11, 0x35, 0x63, 0x81, 0xaa, 0x57, 0x4f, 0xad, 0xea, 0x5a,
+    0xf4, 0xbf, 0xd8, 0xb2, 0xb9, 0xb6, 0xae, 0x6d, 0x1b, 0x77, 0xee, 0x8a, 0xb4, 0x79, 0x37, 0xf6,
+    0x8d, 0x58, 0x37, 0x43, 0xe1, 0x93, 0x89, 0x17, 0x07, 0xde, 0x10, 0x79, 0x72, 0xe5, 0xbf, 0x9b,
+    0x3b, 0x67, 0x0c, 0x7d, 0xf9, 0x83, 0xe3, 0xd3, 0xa9, 0x57, 0x97, 0x7d, 0x36, 0xbb, 0xf6, 0xed,
+    0x9e, 0xbd, 0x4f, 0xff, 0x4e, 0x40, 0xbe, 0xbc, 0xf9, 0xf3, 0xe8, 0xd3, 0x9b, 0x1f, 0x00, 0xa0,
+    0xbd, 0xfb, 0xf7, 0xf0, 0xe3, 0xcb, 0x77, 0xaf, 0xbe, 0xbe, 0x7d, 0xf3, 0x06, 0x06, 0xb0, 0x9f,
+    0xcf, 0xbf, 0x7f, 0xfb, 0xfb, 0x00, 0xa6, 0x67, 0x40, 0x7e, 0xfa, 0xf9, 0x67, 0x60, 0x7c, 0x01,
+    0x26, 0x48, 0xde, 0x80, 0x04, 0x16, 0x78, 0xe0, 0x83, 0x0a, 0x06, 0xc8, 0x60, 0x83, 0x0e, 0x3e,
+    0xe8, 0x5f, 0x84, 0xf7, 0x4d, 0x48, 0x61, 0x85, 0x16, 0xce, 0xf7, 0x0f, 0x86, 0xea, 0x69, 0xb8,
+    0x21, 0x87, 0x1d, 0xbe, 0x27, 0x10, 0x88, 0xe8, 0x89, 0x38, 0x22, 0x89, 0x25, 0x02, 0x70, 0x22,
+    0x8a, 0xe5, 0xa9, 0xb8, 0x22, 0x8b, 0x1d, 0xbe, 0x08, 0xa3, 0x8c, 0x33, 0xd2, 0xf8, 0xe0, 0x40,
+    0x37, 0xe2, 0xa8, 0xdf, 0x8f, 0x40, 0xea, 0xe8, 0x1f, 0x41, 0x28, 0xe2, 0x38, 0x60, 0x90, 0x48,
+    0xee, 0x57, 0x23, 0x91, 0x11, 0x1a, 0x79, 0x64, 0x92, 0x41, 0x2e, 0xc9, 0x64, 0x82, 0x4e, 0x3e,
+    0x09, 0x25, 0x90, 0x16, 0x1a, 0xa4, 0x60, 0x95, 0x56, 0x5e, 0xf9, 0xe3, 0x8e, 0x5a, 0x02, 0xc8,
+    0x65, 0x97, 0x5e, 0x0a, 0xe9, 0x1e, 0x44, 0x19, 0x8e, 0x99, 0x23, 0x94, 0xfd, 0x45, 0x64, 0x9f,
+    0x9a, 0x64, 0x96, 0x29, 0xa4, 0x44, 0x21, 0xc2, 0xb9, 0xe6, 0x95, 0xf2, 0x6d, 0x94, 0xa2, 0x9d,
+    0x77, 0xe2, 0x69, 0xa2, 0x9e, 0xf8, 0xf1, 0xd9, 0xa7, 0x9f, 0xed, 0x75, 0x14, 0xa3, 0xa0, 0x83,
+    0xfa, 0x59, 0x52, 0x02, 0x88, 0xc6, 0x29, 0x67, 0x90, 0x32, 0x35, 0x9a, 0x28, 0x94, 0x3e, 0x35,
+    0xfa, 0x28, 0xa5, 0x3e, 0x09, 0x24, 0xe8, 0xa5, 0x90, 0x66, 0x4a, 0x10, 0x9f, 0x9c, 0xfe, 0xe8,
+    0xe9, 0x41, 0x70, 0x86, 0x3a, 0x2a, 0x44, 0x6a, 0x72, 0x7a, 0xea, 0x44, 0x55, 0xca, 0xb9, 0x2a,
+    0x49, 0x46, 0x7a, 0x08, 0xf9, 0x6a, 0xa5, 0x1a, 0x22, 0xb9, 0x6a, 0x40, 0x00, 0x21, 0xf9, 0x04,
+    0x04, 0x05, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x08,
+    0xff, 0x00, 0xff, 0x09, 0x1c, 0x48, 0xb0, 0xa0, 0xc1, 0x82, 0x12, 0x12, 0x2a, 0x5c, 0x98, 0xf0,
+    0xa0, 0xc3, 0x87, 0x10, 0x23, 0x0e, 0x7c, 0xf0, 0x80, 0xa1, 0xc5, 0x8b, 0x12, 0x33, 0x6a, 0x9c,
+    0x48, 0xb1, 0xe2, 0xc5, 0x8f, 0x0b, 0x37, 0x8a, 0x34, 0xd8, 0xb1, 0x24, 0xc8, 0x93, 0x21, 0x47,
+    0x6e, 0x2c, 0xc9, 0x12, 0xa5, 0x4b, 0x95, 0x12, 0x59, 0xca, 0x74, 0x79, 0xb2, 0x82, 0x4d, 0x98,
+    0x0e, 0x65, 0xce, 0xa4, 0xf9, 0xd1, 0xe6, 0x4d, 0x9c, 0x1c, 0x75, 0xb6, 0xe4, 0x69, 0xd1, 0xa7,
+    0x51, 0xa0, 0x42, 0x85, 0x12, 0x65, 0x68, 0xf4, 0xa8, 0xca, 0xa4, 0x4a, 0x97, 0x26, 0x6c, 0xda,
+    0x74, 0x24, 0xd4, 0xa8, 0x4b, 0xa9, 0x52, 0x5d, 0x79, 0x15, 0x2b, 0x4f, 0xad, 0x5b, 0x33, 0x76,
+    0xf5, 0xea, 0x12, 0x6c, 0xd8, 0x88, 0x63, 0xc9, 0xa2, 0x34, 0x7b, 0x36, 0x67, 0x5a, 0x9d, 0x44,
+    0xd9, 0x6a, 0x85, 0xf8, 0x56, 0x6d, 0x4f, 0xb9, 0x55, 0x1d, 0x32, 0xa8, 0x0b, 0xb7, 0x2c, 0xde,
+    0xb6, 0x03, 0x19, 0x08, 0xde, 0xcb, 0xb7, 0xa3, 0xdf, 0xbf, 0x80, 0xff, 0x0d, 0x1e, 0x5c, 0xd8,
+    0x63, 0x4d, 0xc4, 0x89, 0x17, 0x33, 0x2e, 0xfc, 0x18, 0x72, 0xde, 0xc0, 0x92, 0x17, 0xf3, 0xad,
+    0x6c, 0xd9, 0xa9, 0xc0, 0xcc, 0x99, 0xdf, 0x82, 0xec, 0x3c, 0xf7, 0x33, 0x68, 0xd0, 0x63, 0xef,
+    0x92, 0x0e, 0x7b, 0xfa, 0x74, 0xea, 0xa2, 0xab, 0x59, 0xb7, 0x76, 0x0d, 0x15, 0x76, 0x6c, 0x9b,
+    0x00, 0x72, 0x9b, 0x9e, 0x4d, 0xbb, 0xef, 0xc2, 0xd8, 0xb9, 0x83, 0xeb, 0xe6, 0xcd, 0x3b, 0xe9,
+    0xef, 0xce, 0xc2, 0x93, 0xe7, 0x26, 0x4e, 0xdc, 0xb7, 0x04, 0xc4, 0xca, 0xa3, 0x2f, 0x67, 0xde,
+    0xdc, 0xe4, 0x54, 0xb6, 0xd2, 0xb3, 0x4f, 0xa7, 0x5e, 0xdd, 0x23, 0x58, 0xed, 0xe0, 0xb7, 0x73,
+    0xff, 0x2f, 0x4e, 0xf1, 0xb9, 0xd1, 0xf0, 0xe8, 0x01, 0x8c, 0xe7, 0xfe, 0x00, 0x77, 0xfa, 0xf7,
+    0xeb, 0x99, 0x27, 0x48, 0x30, 0xe0, 0xbd, 0xfd, 0xf8, 0xa7, 0xe7, 0xeb, 0x37, 0x30, 0xa0, 0xbf,
+    0x7d, 0xf4, 0xf8, 0x2d, 0xa6, 0xdf, 0x80, 0x09, 0x18, 0xc0, 0x9f, 0x7f, 0xff, 0x69, 0x87, 0x1f,
+    0x81, 0x0c, 0x1a, 0x78, 0x60, 0x7f, 0xf5, 0x25, 0x18, 0x1d, 0x77, 0x0c, 0x56, 0x58, 0xa0, 0x83,
+    0x10, 0x66, 0x28, 0x61, 0x72, 0xbc, 0x59, 0xe8, 0xe1, 0x85, 0x06, 0x66, 0x28, 0xe2, 0x86, 0xc3,
+    0x65, 0xf6, 0xe1, 0x87, 0x0e, 0x62, 0x28, 0x22, 0x84, 0x1b, 0xee, 0x76, 0xe2, 0x8b, 0x20, 0xaa,
+    0xb8, 0x22, 0x8b, 0xff, 0x09, 0x04, 0x23, 0x8c, 0x29, 0xca, 0x38, 0x23, 0x8d, 0xe9, 0xd9, 0x78,
+    0xe3, 0x89, 0x39, 0xea, 0xb8, 0x63, 0x84, 0xe8, 0x0d, 0xf4, 0xa3, 0x87, 0x41, 0x0a, 0x39, 0x24,
+    0x91, 0xd9, 0x11, 0x74, 0x64, 0x85, 0x49, 0x2a, 0xb9, 0x24, 0x93, 0xca, 0x15, 0xf4, 0x24, 0x81,
+    0x51, 0x86, 0x38, 0xe5, 0x8c, 0xd1, 0x19, 0x74, 0xe5, 0x7e, 0x59, 0x6a, 0xb9, 0xe5, 0x88, 0xc9,
+    0x79, 0xf9, 0x65, 0x8c, 0x51, 0x8e, 0xb9, 0xa3, 0x70, 0x07, 0x7d, 0x19, 0xa6, 0x94, 0x6a, 0xfa,
+    0xf7, 0xd0, 0x93, 0x6f, 0xc2, 0x19, 0x27, 0x44, 0x74, 0xd6, 0x29, 0x66, 0x9c, 0x19, 0x46, 0xf4,
+    0xa3, 0x9e, 0x76, 0x6e, 0x99, 0xd1, 0x8d, 0x80, 0xee, 0xc9, 0xa7, 0x46, 0x38, 0x16, 0xfa, 0x20,
+    0x9f, 0x03, 0x6c, 0xf4, 0xa2, 0xa2, 0x86, 0x8e, 0x39, 0x12, 0x8a, 0x90, 0x2e, 0x2a, 0xa9, 0x4a,
+    0x16, 0x56, 0x1a, 0xe9, 0x92, 0x40, 0x41, 0xa9, 0xa9, 0xa5, 0x43, 0x02, 0x65, 0x24, 0x98, 0x9f,
+    0x0a, 0x2a, 0xaa, 0x93, 0xf3, 0x7d, 0xba, 0x69, 0x9f, 0xa7, 0x1a, 0xa4, 0xea, 0xaa, 0x8d, 0xb6,
+    0x16, 0xea, 0xd0, 0xab, 0xa0, 0xc6, 0x2a, 0x2b, 0x44, 0xa5, 0x42, 0x78, 0xab, 0x48, 0x95, 0xf6,
+    0xb7, 0x2b, 0x50, 0x75, 0xde, 0x1a, 0x10, 0x00, 0x21, 0xf9, 0x04, 0x04, 0x05, 0x00, 0x00, 0x00,
+    0x2c, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x08, 0xff, 0x00, 0xff, 0x09, 0x1c,
+    0x48, 0xb0, 0xa0, 0xc1, 0x82, 0x12, 0x12, 0x2a, 0x5c, 0x98, 0xf0, 0xa0, 0xc3, 0x87, 0x10, 0x23,
+    0x0e, 0x64, 0x48, 0xb1, 0x62, 0x85, 0x0a, 0x12, 0x33, 0x6a, 0x9c, 0x58, 0xb1, 0xe3, 0xc2, 0x8b,
+    0x17, 0x37, 0x8a, 0x34, 0xe8, 0xb1, 0xe4, 0x47, 0x90, 0x20, 0x47, 0x8a, 0x34, 0xc9, 0x12, 0xa5,
+    0x4b, 0x95, 0x12, 0x1f, 0xc8, 0x64, 0x59, 0xd2, 0xa5, 0x4d, 0x98, 0x0e, 0x65, 0xce, 0xa4, 0xd9,
+    0xd1, 0xe6, 0x4d, 0x9c, 0x03, 0x75, 0x0a, 0xe5, 0x69, 0xd1, 0xe7, 0x4f, 0x98, 0x42, 0x87, 0x12,
+    0x3d, 0x69, 0xf4, 0xa8, 0xc8, 0xa4, 0x49, 0x97, 0x2a, 0x6c, 0x6a, 0x74, 0x24, 0x54, 0xa8, 0x52,
+    0x25, 0x50, 0xad, 0xaa, 0xf1, 0x2a, 0xd6, 0xa5, 0x5b, 0x9b, 0x76, 0xf5, 0x1a, 0x95, 0x68, 0x58,
+    0xae, 0x11, 0xc9, 0x7e, 0xe5, 0x79, 0x16, 0x6d, 0x4e, 0xb5, 0x6b, 0x5b, 0xb6, 0xf5, 0x09, 0x11,
+    0x6e, 0xdc, 0x9a, 0x73, 0xe9, 0xbe, 0xb5, 0x5b, 0xd6, 0x64, 0x5e, 0x9f, 0x00, 0x0e, 0xf2, 0xf5,
+    0x2a, 0xf7, 0xef, 0x45, 0x00, 0x88, 0x03, 0x17, 0x1c, 0x7c, 0xb5, 0x70, 0xde, 0xc4, 0x89, 0x0d,
+    0x32, 0x6e, 0xec, 0xd1, 0x70, 0x05, 0xc8, 0x91, 0x09, 0x4e, 0xa6, 0xdc, 0xf3, 0x31, 0x66, 0xc8,
+    0x9a, 0x37, 0xdf, 0x65, 0x1a, 0xf6, 0xf3, 0xe7, 0xa0, 0xa2, 0x39, 0x33, 0x3c, 0x6b, 0xba, 0xb5,
+    0xc0, 0xd4, 0xaa, 0xa7, 0x96, 0x6e, 0x6d, 0x5a, 0x20, 0x83, 0xdb, 0xb0, 0x95, 0x92, 0x06, 0x4c,
+    0xdb, 0xf5, 0xbf, 0xdb, 0xc0, 0x71, 0xa7, 0xa6, 0xd8, 0xb4, 0x77, 0xef, 0xdf, 0xc1, 0x93, 0x33,
+    0x10, 0xbd, 0x1b, 0xa5, 0x71, 0xe3, 0xca, 0xa3, 0x0b, 0xb7, 0xdb, 0xfc, 0xf2, 0x73, 0xe8, 0xd2,
+    0xb3, 0x2f, 0x57, 0x2b, 0x1b, 0xe4, 0xf5, 0xeb, 0xda, 0xc3, 0x4f, 0xff, 0x2f, 0xeb, 0xfd, 0x3b,
+    0x78, 0xf1, 0xe8, 0xa3, 0x96, 0x37, 0xff, 0x1c, 0xbd, 0x7b, 0xe0, 0x32, 0xad, 0xb3, 0x3f, 0xff,
+    0xde, 0x7d, 0x82, 0x01, 0x03, 0xe6, 0xd3, 0xaf, 0xaf, 0x3d, 0x81, 0x7f, 0x03, 0xf8, 0x05, 0xa8,
+    0x5f, 0x6b, 0xfc, 0x85, 0xe7, 0x5f, 0x02, 0x06, 0x00, 0x18, 0xe0, 0x82, 0x03, 0x42, 0x56, 0xa0,
+    0x74, 0x07, 0xfe, 0x97, 0xe0, 0x82, 0x14, 0xe2, 0x37, 0xe0, 0x83, 0xc9, 0x45, 0x78, 0x60, 0x82,
+    0x13, 0x56, 0xe8, 0xa1, 0x79, 0x18, 0xde, 0xa6, 0x61, 0x84, 0x1c, 0x2a, 0xe8, 0xe1, 0x89, 0xf9,
+    0x1d, 0x87, 0xe1, 0x88, 0x1b, 0x96, 0x68, 0x22, 0x8a, 0x27, 0xd6, 0x86, 0x5c, 0x7d, 0x2c, 0x92,
+    0xe8, 0x22, 0x8c, 0x38, 0x0a, 0x88, 0x98, 0x6d, 0xef, 0xd5, 0xa8, 0xa1, 0x8b, 0x1d, 0xe6, 0x98,
+    0x23, 0x8f, 0xe8, 0xf9, 0x68, 0x23, 0x90, 0x42, 0x0a, 0x39, 0x90, 0x78, 0x46, 0xfe, 0x08, 0x64,
+    0x90, 0x49, 0x7a, 0x48, 0x50, 0x7f, 0x4d, 0x3a, 0xf9, 0xe4, 0x8b, 0x51, 0x2e, 0x58, 0x50, 0x74,
+    0x55, 0xb2, 0x78, 0x25, 0x94, 0x59, 0xe2, 0x67, 0x90, 0x72, 0x5d, 0x8e, 0xf8, 0x25, 0x87, 0x61,
+    0x6a, 0xb9, 0x25, 0x70, 0x65, 0x7a, 0x79, 0x26, 0x96, 0x59, 0x1e, 0xc4, 0x40, 0x9b, 0x35, 0xbe,
+    0x09, 0x66, 0x92, 0x0f, 0xd1, 0xe9, 0xa6, 0x9d, 0x61, 0x42, 0xa4, 0xa7, 0x95, 0x7c, 0xc6, 0xe9,
+    0xe7, 0x9f, 0x12, 0xda, 0x79, 0x27, 0x8a, 0x19, 0x11, 0x8a, 0xa0, 0xa1, 0x87, 0x4a, 0x99, 0x28,
+    0xa1, 0x8c, 0xa2, 0x39, 0xa4, 0x46, 0x7f, 0x46, 0x2a, 0x29, 0x8c, 0x23, 0xe9, 0x69, 0xe9, 0xa5,
+    0x8e, 0x66, 0xda, 0xe6, 0xa6, 0x9c, 0xaa, 0x09, 0x53, 0x99, 0xa0, 0x86, 0x2a, 0x26, 0x50, 0x02,
+    0x55, 0x59, 0x2a, 0xa7, 0xa8, 0x16, 0xd4, 0xe4, 0xaa, 0x41, 0xb6, 0x1b, 0x7a, 0x90, 0x8f, 0xb0,
+    0x26, 0x28, 0x6b, 0x9e, 0x66, 0xd6, 0x7a, 0xab, 0x44, 0x47, 0x6e, 0xba, 0xab, 0x48, 0x85, 0x46,
+    0xfa, 0x2b, 0x50, 0x76, 0xee, 0x1a, 0x10, 0x00, 0x21, 0xf9, 0x04, 0x04, 0x05, 0x00, 0x00, 0x00,
+    0x2c, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x08, 0xff, 0x00, 0xff, 0x09, 0x1c,
+    0x48, 0xb0, 0xa0, 0xc1, 0x82, 0x12, 0x12, 0x2a, 0xac, 0xc0, 0xb0, 0xe1, 0xc1, 0x87, 0x10, 0x23,
+    0x4a, 0x1c, 0xa8, 0xb0, 0xe2, 0xc2, 0x86, 0x18, 0x19, 0x4e, 0xdc, 0xc8, 0x91, 0xa2, 0xc5, 0x8f,
+    0x19, 0x43, 0x56, 0xe8, 0x48, 0xd2, 0xe0, 0xc7, 0x93, 0x09, 0x45, 0xaa, 0x2c, 0x49, 0x12, 0x25,
+    0x4a, 0x95, 0x2b, 0x59, 0x4a, 0x74, 0xe9, 0x12, 0x26, 0x4c, 0x99, 0x0f, 0x69, 0xd6, 0xb4, 0x19,
+    0x13, 0xa7, 0x40, 0x9d, 0x34, 0x79, 0xda, 0xf4, 0x09, 0x34, 0xa8, 0xd0, 0x9b, 0x2c, 0x8b, 0x1a,
+    0x3d, 0x2a, 0x12, 0x40, 0xc9, 0x07, 0x0f, 0x94, 0xbe, 0x64, 0x1a, 0x12, 0x80, 0xd5, 0x8e, 0x50,
+    0xa1, 0x4a, 0x05, 0x49, 0x15, 0xa3, 0xd5, 0xaf, 0x1c, 0xb3, 0x6a, 0xdd, 0x7a, 0xb1, 0x6b, 0x85,
+    0xaf, 0x60, 0x27, 0x8a, 0xcd, 0x4a, 0x36, 0xa5, 0x59, 0xb4, 0x68, 0x25, 0xae, 0x15, 0xdb, 0xf6,
+    0x2d, 0xdc, 0xb8, 0x10, 0xe7, 0xd2, 0xdd, 0xda, 0xf5, 0x2e, 0xdc, 0xbc, 0x7a, 0xf7, 0x2a, 0xa5,
+    0xea, 0xf7, 0xee, 0xc1, 0xc0, 0x73, 0xa5, 0x32, 0x2d, 0xec, 0xd7, 0x20, 0xe2, 0xc4, 0x45, 0x8f,
+    0x32, 0x6e, 0x5c, 0xf0, 0x31, 0x64, 0x9d, 0x42, 0x27, 0x53, 0x1e, 0x68, 0x59, 0x2f, 0x50, 0x9e,
+    0x9a, 0x0b, 0x13, 0xec, 0xec, 0x79, 0x69, 0xd3, 0xd0, 0x9b, 0x49, 0x07, 0x36, 0x9d, 0x11, 0x35,
+    0x63, 0x81, 0xaa, 0x57, 0x4f, 0xad, 0xea, 0x5a, 0xf4, 0xbf, 0xd8, 0xb2, 0xb9, 0xb6, 0xae, 0x6d,
+    0x1b, 0x77, 0xee, 0x8a, 0xb4, 0x79, 0x37, 0xf6, 0x8d, 0x58, 0x37, 0x43, 0xe1, 0x93, 0x89, 0x17,
+    0x07, 0xde, 0x10, 0x79, 0x72, 0xe5, 0xbf, 0x9b, 0x3b, 0x67, 0x0c, 0x7d, 0xb9, 0x84, 0xe3, 0xd3,
+    0xa9, 0x57, 0x97, 0x7d, 0x36, 0xbb, 0xf6, 0xed, 0x9e, 0xbd, 0x4f, 0xff, 0x66, 0x40, 0xbe, 0xbc,
+    0xf9, 0xf3, 0xe8, 0xd3, 0x9b, 0x37, 0x30, 0xa0, 0xbd, 0xfb, 0xf7, 0xf0, 0xe3, 0xcb, 0x77, 0xaf,
+    0xbe, 0xbe, 0x7d, 0xf3, 0x09, 0x0c, 0xb0, 0x9f, 0xcf, 0xbf, 0x7f, 0xfb, 0xfb, 0x00, 0xa6, 0x97,
+    0x40, 0x7e, 0xfa, 0xf9, 0x67, 0x60, 0x7c, 0x01, 0x26, 0x48, 0xde, 0x80, 0x04, 0x16, 0x78, 0xe0,
+    0x83, 0x0a, 0x06, 0xc8, 0x60, 0x83, 0x0e, 0x3e, 0xe8, 0x5f, 0x84, 0xf7, 0x4d, 0x48, 0x61, 0x85,
+    0x16, 0xce, 0xf7, 0x0f, 0x86, 0xea, 0x69, 0xb8, 0x21, 0x87, 0x1d, 0xbe, 0x27, 0x10, 0x88, 0xe8,
+    0x89, 0x38, 0x22, 0x89, 0x25, 0x0e, 0x70, 0x22, 0x8a, 0xe5, 0xa9, 0xb8, 0x22, 0x8b, 0x1d, 0xbe,
+    0x08, 0xa3, 0x8c, 0x33, 0xd2, 0xf8, 0xe0, 0x40, 0x37, 0xe2, 0xa8, 0xdf, 0x8f, 0x40, 0xea, 0xe8,
+    0x1f, 0x41, 0x28, 0xe2, 0x38, 0x60, 0x90, 0x48, 0xee, 0x57, 0x23, 0x91, 0x11, 0x1a, 0x79, 0x64,
+    0x92, 0x41, 0x2e, 0xc9, 0x64, 0x82, 0x4e, 0x3e, 0x09, 0x25, 0x90, 0x16, 0x1a, 0xa4, 0x60, 0x95,
+    0x56, 0x5e, 0xf9, 0xe3, 0x8e, 0x5a, 0x02, 0xc8, 0x65, 0x97, 0x5e, 0x0a, 0xe9, 0x1e, 0x44, 0x19,
+    0x8e, 0x99, 0x23, 0x94, 0xfd, 0x45, 0x64, 0x9f, 0x9a, 0x64, 0x96, 0x29, 0xa4, 0x44, 0x21, 0xc2,
+    0xb9, 0xe6, 0x95, 0xf2, 0x6d, 0x94, 0xa2, 0x9d, 0x77, 0xe2, 0x69, 0xa2, 0x9e, 0xf8, 0xf1, 0xd9,
+    0xa7, 0x9f, 0xed, 0x75, 0x14, 0xa3, 0xa0, 0x83, 0xfa, 0x59, 0x12, 0x03, 0x88, 0xc6, 0x29, 0x67,
+    0x90, 0x32, 0x35, 0x9a, 0x28, 0x94, 0x3e, 0x35, 0xfa, 0x28, 0xa5, 0x3e, 0x09, 0x24, 0xe8, 0xa5,
+    0x90, 0x66, 0x4a, 0x10, 0x9f, 0x9c, 0xfe, 0xe8, 0xe9, 0x41, 0x70, 0x86, 0x3a, 0x2a, 0x44, 0x6a,
+    0x72, 0x7a, 0xea, 0x44, 0x55, 0xca, 0xb9, 0x2a, 0x49, 0x46, 0x7a, 0x08, 0xf9, 0x6a, 0xa5, 0x1a,
+    0x22, 0xb9, 0x6a, 0x40, 0x00, 0x21, 0xf9, 0x04, 0x04, 0x05, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00,
+    0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x08, 0xff, 0x00, 0xff, 0x09, 0x1c, 0x48, 0xb0, 0xa0,
+    0xc1, 0x82, 0x15, 0x12, 0x2a, 0x5c, 0x98, 0xf0, 0xa0, 0xc3, 0x87, 0x10, 0x23, 0x0e, 0x94, 0x20,
+    0x81, 0xa1, 0xc5, 0x8b, 0x12, 0x33, 0x6a, 0x9c, 0x48, 0xb1, 0xe2, 0xc5, 0x8f, 0x0b, 0x37, 0x8a,
+    0x34, 0xd8, 0xb1, 0x24, 0xc8, 0x93, 0x21, 0x47, 0x6e, 0x2c, 0xc9, 0x12, 0xa5, 0x4b, 0x95, 0x12,
+    0x59, 0xca, 0x74, 0x79, 0x12, 0x80, 0x4d, 0x98, 0x0e, 0x65, 0xce, 0xa4, 0xf9, 0xd1, 0xe6, 0x4d,
+    0x9c, 0x1c, 0x75, 0xb6, 0xe4, 0x69, 0xd1, 0xa7, 0x51, 0xa0, 0x42, 0x85, 0x12, 0x65, 0x68, 0xf4,
+    0xa8, 0xca, 0xa4, 0x4a, 0x97, 0x26, 0x6c, 0xda, 0x74, 0x24, 0xd4, 0xa8, 0x4b, 0xa9, 0x52, 0x5d,
+    0x79, 0x15, 0x2b, 0x4f, 0xad, 0x5b, 0x33, 0x76, 0xf5, 0xea, 0x12, 0x6c, 0xd8, 0x88, 0x63, 0xc9,
+    0xa2, 0x34, 0x7b, 0x36, 0x67, 0x5a, 0x9d, 0x44, 0xd9, 0x6a, 0x85, 0xf8, 0x56, 0x6d, 0x4f, 0xb9,
+    0x55, 0x1d, 0x3e, 0xa8, 0x0b, 0xb7, 0x2c, 0xde, 0xb6, 0x03, 0x1f, 0x08, 0xde, 0xcb, 0xb7, 0xa3,
+    0xdf, 0xbf, 0x80, 0xff, 0x0d, 0x1e, 0x5c, 0xd8, 0x63, 0x4d, 0xc4, 0x89, 0x17, 0x33, 0x2e, 0xfc,
+    0x18, 0x72, 0xde, 0xc0, 0x92, 0x17, 0xf3, 0xad, 0x6c, 0xd9, 0xa9, 0xc0, 0xcc, 0x99, 0xdf, 0x82,
+    0xec, 0x3c, 0xf7, 0x33, 0x68, 0xd0, 0x63, 0xef, 0x92, 0x0e, 0x7b, 0xfa, 0x74, 0xea, 0xa2, 0xab,
+    0x59, 0xb7, 0x76, 0x0d, 0x15, 0x76, 0x6c, 0x9b, 0x03, 0x72, 0x9b, 0x9e, 0x4d, 0xbb, 0xef, 0xc2,
+    0xd8, 0xb9, 0x83, 0xeb, 0xe6, 0xcd, 0x3b, 0xe9, 0xef, 0xce, 0xc2, 0x93, 0xe7, 0x26, 0x4e, 0xdc,
+    0x77, 0x05, 0xc4, 0xca, 0xa3, 0x2f, 0x67, 0xde, 0xdc, 0xe4, 0x54, 0xb6, 0xd2, 0xb3, 0x4f, 0xa7,
+    0x5e, 0xdd, 0x23, 0x58, 0xed, 0xe0, 0xb7, 0x73, 0xff, 0x2f, 0x4e, 0xf1, 0xb9, 0xd1, 0xf0, 0xe8,
+    0x07, 0x8c, 0xe7, 0x2e, 0x01, 0x77, 0xfa, 0xf7, 0xeb, 0x99, 0x33, 0x60, 0x60, 0xe0, 0xbd, 0xfd,
+    0xf8, 0xa7, 0xe7, 0xeb, 0x4f, 0x60, 0xa0, 0xbf, 0x7d, 0xf4, 0xf8, 0x2d, 0xa6, 0xdf, 0x80, 0x0c,
+    0x24, 0xc0, 0x9f, 0x7f, 0xff, 0x69, 0x87, 0x1f, 0x81, 0x0c, 0x1a, 0x78, 0x60, 0x7f, 0xf5, 0x25,
+    0x18, 0x1d, 0x77, 0x0c, 0x56, 0x58, 0xa0, 0x83, 0x10, 0x66, 0x28, 0x61, 0x72, 0xbc, 0x59, 0xe8,
+    0xe1, 0x85, 0x06, 0x66, 0x28, 0xe2, 0x86, 0xc3, 0x65, 0xf6, 0xe1, 0x87, 0x0e, 0x62, 0x28, 0x22,
+    0x84, 0x1b, 0xee, 0x76, 0xe2, 0x8b, 0x20, 0xaa, 0xb8, 0x22, 0x8b, 0xff, 0x09, 0x04, 0x23, 0x8c,
+    0x29, 0xca, 0x38, 0x23, 0x8d, 0xe9, 0xd9, 0x78, 0xe3, 0x89, 0x39, 0xea, 0xb8, 0x63, 0x84, 0xe8,
+    0x0d, 0xf4, 0xa3, 0x87, 0x41, 0x0a, 0x39, 0x24, 0x91, 0xd9, 0x11, 0x74, 0x64, 0x85, 0x49, 0x2a,
+    0xb9, 0x24, 0x93, 0xca, 0x15, 0xf4, 0x24, 0x81, 0x51, 0x86, 0x38, 0xe5, 0x8c, 0xd1, 0x19, 0x74,
+    0xe5, 0x7e, 0x59, 0x6a, 0xb9, 0xe5, 0x88, 0xc9, 0x79, 0xf9, 0x65, 0x8c, 0x51, 0x8e, 0xb9, 0xa3,
+    0x70, 0x07, 0x7d, 0x19, 0xa6, 0x94, 0x6a, 0xfa, 0xf7, 0xd0, 0x93, 0x6f, 0xc2, 0x19, 0x27, 0x44,
+    0x74, 0xd6, 0x29, 0x66, 0x9c, 0x19, 0x46, 0xf4, 0xa3, 0x9e, 0x76, 0x6e, 0x99, 0xd1, 0x8d, 0x80,
+    0xee, 0xc9, 0xa7, 0x46, 0x38, 0x16, 0xfa, 0x20, 0x9f, 0x06, 0x6c, 0xf4, 0xa2, 0xa2, 0x86, 0x8e,
+    0x39, 0x12, 0x8a, 0x90, 0x2e, 0x2a, 0xa9, 0x4a, 0x16, 0x56, 0x1a, 0xe9, 0x92, 0x40, 0x41, 0xa9,
+    0xa9, 0xa5, 0x43, 0x02, 0x65, 0x24, 0x98, 0x9f, 0x0a, 0x2a, 0xaa, 0x93, 0xf3, 0x7d, 0xba, 0x69,
+    0x9f, 0xa7, 0x1a, 0xa4, 0xea, 0xaa, 0x8d, 0xb6, 0x16, 0xea, 0xd0, 0xab, 0xa0, 0xc6, 0x2a, 0x2b,
+    0x44, 0xa5, 0x42, 0x78, 0xab, 0x48, 0x95, 0xf6, 0xb7, 0x2b, 0x50, 0x75, 0xde, 0x1a, 0x10, 0x00,
+    0x21, 0xf9, 0x04, 0x04, 0x05, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40,
+    0x00, 0x00, 0x08, 0xff, 0x00, 0xff, 0x09, 0x1c, 0x48, 0xb0, 0xa0, 0xc1, 0x82, 0x15, 0x12, 0x2a,
+    0x5c, 0x98, 0xf0, 0xa0, 0xc3, 0x87, 0x10, 0x23, 0x0e, 0x64, 0x48, 0xb1, 0x22, 0x00, 0x00, 0x12,
+    0x33, 0x6a, 0x9c, 0x58, 0xb1, 0xe3, 0xc2, 0x8b, 0x17, 0x37, 0x8a, 0x34, 0xe8, 0xb1, 0xe4, 0x47,
+    0x90, 0x20, 0x47, 0x8a, 0x34, 0xc9, 0x12, 0xa5, 0x4b, 0x95, 0x12, 0x25, 0xc8, 0x64, 0x59, 0xd2,
+    0xa5, 0x4d, 0x98, 0x0e, 0x65, 0xce, 0xa4, 0xd9, 0xd1, 0xe6, 0x4d, 0x9c, 0x03, 0x75, 0x0a, 0xe5,
+    0x69, 0xd1, 0xe7, 0x4f, 0x98, 0x42, 0x87, 0x12, 0x3d, 0x69, 0xf4, 0xa8, 0xc8, 0xa4, 0x49, 0x97,
+    0x2a, 0x6c, 0x6a, 0x74, 0x24, 0x54, 0xa8, 0x52, 0x2b, 0x50, 0xad, 0xaa, 0xf1, 0x2a, 0xd6, 0xa5,
+    0x5b, 0x9b, 0x76, 0xf5, 0x1a, 0x95, 0x68, 0x58, 0xae, 0x11, 0xc9, 0x7e, 0xe5, 0x79, 0x16, 0x6d,
+    0x4e, 0xb5, 0x6b, 0x5b, 0xb6, 0xf5, 0x09, 0x11, 0x6e, 0xdc, 0x9a, 0x73, 0xe9, 0xbe, 0xb5, 0x5b,
+    0xd6, 0x64, 0x5e, 0x9f, 0x03, 0x0e, 0xf2, 0xf5, 0x2a, 0xf7, 0xef, 0xc5, 0x01, 0x88, 0x03, 0x17,
+    0x1c, 0x7c, 0xb5, 0x70, 0xde, 0xc4, 0x89, 0x0d, 0x32, 0x6e, 0xec, 0xd1, 0x30, 0x00, 0xc8, 0x91,
+    0x09, 0x4e, 0xa6, 0xdc, 0xf3, 0x31, 0x66, 0xc8, 0x9a, 0x37, 0xdf, 0x65, 0x1a, 0xf6, 0xf3, 0xe7,
+    0xa0, 0xa2, 0x39, 0x33, 0x3c, 0x6b, 0xba, 0xb5, 0xc0, 0xd4, 0xaa, 0xa7, 0x96, 0x6e, 0x6d, 0x5a,
+    0xe0, 0x83, 0xdb, 0xb0, 0x95, 0x92, 0x06, 0x4c, 0xdb, 0xf5, 0xbf, 0xdb, 0xc0, 0x71, 0xa7, 0xa6,
+    0xd8, 0xb4, 0x77, 0xef, 0xdf, 0xc1, 0x93, 0x3f, 0x10, 0xbd, 0x1b, 0xa5, 0x71, 0xe3, 0xca, 0xa3,
+    0x0b, 0xb7, 0xdb, 0xfc, 0xf2, 0x73, 0xe8, 0xd2, 0xb3, 0x2f, 0x57, 0x2b, 0x1b, 0xe4, 0xf5, 0xeb,
+    0xda, 0xc3, 0x4f, 0xff, 0x2f, 0xeb, 0xfd, 0x3b, 0x78, 0xf1, 0xe8, 0xa3, 0x96, 0x37, 0xff, 0x1c,
+    0xbd, 0x7b, 0xe0, 0x32, 0xad, 0xb3, 0x3f, 0xff, 0xde, 0x3d, 0x03, 0x03, 0x06, 0xe6, 0xd3, 0xaf,
+    0xaf, 0x9d, 0x81, 0xff, 0x04, 0xf8, 0x05, 0xa8, 0x5f, 0x6b, 0xfc, 0x85, 0xe7, 0x1f, 0x03, 0x09,
+    0x00, 0x18, 0xe0, 0x82, 0x03, 0x42, 0x56, 0xa0, 0x74, 0x07, 0xfe, 0x97, 0xe0, 0x82, 0x14, 0xe2,
+    0x37, 0xe0, 0x83, 0xc9, 0x45, 0x78, 0x60, 0x82, 0x13, 0x56, 0xe8, 0xa1, 0x79, 0x18, 0xde, 0xa6,
+    0x61, 0x84, 0x1c, 0x2a, 0xe8, 0xe1, 0x89, 0xf9, 0x1d, 0x87, 0xe1, 0x88, 0x1b, 0x96, 0x68, 0x22,
+    0x8a, 0x27, 0xd6, 0x86, 0x5c, 0x7d, 0x2c, 0x92, 0xe8, 0x22, 0x8c, 0x38, 0x0a, 0x88, 0x98, 0x6d,
+    0xef, 0xd5, 0xa8, 0xa1, 0x8b, 0x1d, 0xe6, 0x98, 0x23, 0x8f, 0xe8, 0xf9, 0x68, 0x23, 0x90, 0x42,
+    0x0a, 0x39, 0x90, 0x78, 0x46, 0xfe, 0x08, 0x64, 0x90, 0x49, 0x7a, 0x48, 0x50, 0x7f, 0x4d, 0x3a,
+    0xf9, 0xe4, 0x8b, 0x51, 0x2e, 0x58, 0x50, 0x74, 0x55, 0xb2, 0x78, 0x25, 0x94, 0x59, 0xe2, 0x67,
+    0x90, 0x72, 0x5d, 0x8e, 0xf8, 0x25, 0x87, 0x61, 0x6a, 0xb9, 0x25, 0x70, 0x65, 0x7a, 0x79, 0x26,
+    0x96, 0x59, 0x1e, 0xf4, 0x40, 0x9b, 0x35, 0xbe, 0x09, 0x66, 0x92, 0x0f, 0xd1, 0xe9, 0xa6, 0x9d,
+    0x61, 0x42, 0xa4, 0xa7, 0x95, 0x7c, 0xc6, 0xe9, 0xe7, 0x9f, 0x12, 0xda, 0x79, 0x27, 0x8a, 0x19,
+    0x11, 0x8a, 0xa0, 0xa1, 0x87, 0x4a, 0x99, 0x28, 0xa1, 0x8c, 0xa2, 0x39, 0xa4, 0x46, 0x7f, 0x46,
+    0x2a, 0x29, 0x8c, 0x23, 0xe9, 0x69, 0xe9, 0xa5, 0x8e, 0x66, 0xda, 0xe6, 0xa6, 0x9c, 0xaa, 0x09,
+    0x53, 0x99, 0xa0, 0x86, 0x2a, 0x26, 0x50, 0x02, 0x55, 0x59, 0x2a, 0xa7, 0xa8, 0x16, 0xd4, 0xe4,
+    0xaa, 0x41, 0xb6, 0x1b, 0x7a, 0x90, 0x8f, 0xb0, 0x26, 0x28, 0x6b, 0x9e, 0x66, 0xd6, 0x7a, 0xab,
+    0x44, 0x47, 0x6e, 0xba, 0xab, 0x48, 0x85, 0x46, 0xfa, 0x2b, 0x50, 0x76, 0xee, 0x1a, 0x10, 0x00,
+    0x21, 0xf9, 0x04, 0x04, 0x05, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40,
+    0x00, 0x00, 0x08, 0xff, 0x00, 0xff, 0x09, 0x1c, 0x48, 0xb0, 0xa0, 0xc1, 0x82, 0x15, 0x12, 0x2a,
+    0x04, 0xc0, 0xb0, 0xe1, 0xc1, 0x87, 0x10, 0x23, 0x4a, 0x1c, 0xa8, 0xb0, 0xe2, 0xc2, 0x86, 0x18,
+    0x19, 0x4e, 0xdc, 0xc8, 0x91, 0xa2, 0xc5, 0x8f, 0x19, 0x43, 0x02, 0xe8, 0x48, 0xd2, 0xe0, 0xc7,
+    0x93, 0x09, 0x45, 0xaa, 0x2c, 0x49, 0x12, 0x25, 0x4a, 0x95, 0x2b, 0x59, 0x4a, 0x74, 0xe9, 0x12,
+    0x26, 0x4c, 0x99, 0x0f, 0x69, 0xd6, 0xb4, 0x19, 0x13, 0xa7, 0x40, 0x9d, 0x34, 0x79, 0xda, 0xf4,
+    0x09, 0x34, 0xa8, 0xd0, 0x9b, 0x2c, 0x8b, 0x1a, 0x3d, 0x2a, 0x72, 0x40, 0x49, 0x09, 0x12, 0x94,
+    0xbe, 0x64, 0x1a, 0x72, 0x80, 0xd5, 0x8e, 0x50, 0xa1, 0x4a, 0x05, 0x49, 0x15, 0xa3, 0xd5, 0xaf,
+    0x1c, 0xb3, 0x6a, 0xdd, 0x7a, 0xb1, 0x2b, 0x80, 0xaf, 0x60, 0x27, 0x8a, 0xcd, 0x4a, 0x36, 0xa5,
+    0x59, 0xb4, 0x68, 0x25, 0xae, 0x15, 0xdb, 0xf6, 0x2d, 0xdc, 0xb8, 0x10, 0xe7, 0xd2, 0xdd, 0xda,
+    0xf5, 0x2e, 0xdc, 0xbc, 0x7a, 0xf7, 0x2a, 0xa5, 0xea, 0xf7, 0xee, 0xc1, 0xc0, 0x73, 0xa5, 0x32,
+    0x2d, 0xec, 0xd7, 0x20, 0xe2, 0xc4, 0x45, 0x8f, 0x32, 0x6e, 0x5c, 0xf0, 0x31, 0x64, 0x9d, 0x42,
+    0x27, 0x53, 0x1e, 0x68, 0x59, 0x2f, 0x50, 0x9e, 0x9a, 0x0b, 0x13, 0xec, 0xec, 0x79, 0x69, 0xd3,
+    0xd0, 0x9b, 0x49, 0x07, 0x36, 0x9d, 0x11, 0x35, 0x63, 0x81, 0xaa, 0x57, 0x4f, 0xad, 0xea, 0x5a,
+    0xf4, 0xbf, 0xd8, 0xb2, 0xb9, 0xb6, 0xae, 0x6d, 0x1b, 0x77, 0xee, 0x8a, 0xb4, 0x79, 0x37, 0xf6,
+    0x8d, 0x58, 0x37, 0x43, 0xe1, 0x93, 0x89, 0x17, 0x07, 0xde, 0x10, 0x79, 0x72, 0xe5, 0xbf, 0x9b,
+    0x3b, 0x67, 0x0c, 0x7d, 0x79, 0x85, 0xe3, 0xd3, 0xa9, 0x57, 0x97, 0x7d, 0x36, 0xbb, 0xf6, 0xed,
+    0x9e, 0xbd, 0x4f, 0xff, 0x7e, 0x40, 0xbe, 0xbc, 0xf9, 0xf3, 0xe8, 0xd3, 0x9b, 0x4f, 0x60, 0xa0,
+    0xbd, 0xfb, 0xf7, 0xf0, 0xe3, 0xcb, 0x77, 0xaf, 0xbe, 0xbe, 0x7d, 0xf3, 0x0c, 0x12, 0xb0, 0x9f,
+    0xcf, 0xbf, 0x7f, 0xfb, 0xfb, 0x00, 0xa6, 0xc7, 0x40, 0x7e, 0xfa, 0xf9, 0x67, 0x60, 0x7c, 0x01,
+    0x26, 0x48, 0xde, 0x80, 0x04, 0x16, 0x78, 0xe0, 0x83, 0x0a, 0x06, 0xc8, 0x60, 0x83, 0x0e, 0x3e,
+    0xe8, 0x5f, 0x84, 0xf7, 0x4d, 0x48, 0x61, 0x85, 0x16, 0xce, 0xf7, 0x0f, 0x86, 0xea, 0x69, 0xb8,
+    0x21, 0x87, 0x1d, 0xbe, 0x27, 0x10, 0x88, 0xe8, 0x89, 0x38, 0x22, 0x89, 0x25, 0x1a, 0x70, 0x22,
+    0x8a, 0xe5, 0xa9, 0xb8, 0x22, 0x8b, 0x1d, 0xbe, 0x08, 0xa3, 0x8c, 0x33, 0xd2, 0xf8, 0xe0, 0x40,
+    0x37, 0xe2, 0xa8, 0xdf, 0x8f, 0x40, 0xea, 0xe8, 0x1f, 0x41, 0x28, 0xe2, 0x38, 0x60, 0x90, 0x48,
+    0xee, 0x57, 0x23, 0x91, 0x11, 0x1a, 0x79, 0x64, 0x92, 0x41, 0x2e, 0xc9, 0x64, 0x82, 0x4e, 0x3e,
+    0x09, 0x25, 0x90, 0x16, 0x1a, 0xa4, 0x60, 0x95, 0x56, 0x5e, 0xf9, 0xe3, 0x8e, 0x5a, 0x02, 0xc8,
+    0x65, 0x97, 0x5e, 0x0a, 0xe9, 0x1e, 0x44, 0x19, 0x8e, 0x99, 0x23, 0x94, 0xfd, 0x45, 0x64, 0x9f,
+    0x9a, 0x64, 0x96, 0x29, 0xa4, 0x44, 0x21, 0xc2, 0xb9, 0xe6, 0x95, 0xf2, 0x6d, 0x94, 0xa2, 0x9d,
+    0x77, 0xe2, 0x69, 0xa2, 0x9e, 0xf8, 0xf1, 0xd9, 0xa7, 0x9f, 0xed, 0x75, 0x14, 0xa3, 0xa0, 0x83,
+    0xfa, 0x59, 0xd2, 0x03, 0x88, 0xc6, 0x29, 0x67, 0x90, 0x32, 0x35, 0x9a, 0x28, 0x94, 0x3e, 0x35,
+    0xfa, 0x28, 0xa5, 0x3e, 0x09, 0x24, 0xe8, 0xa5, 0x90, 0x66, 0x4a, 0x10, 0x9f, 0x9c, 0xfe, 0xe8,
+    0xe9, 0x41, 0x70, 0x86, 0x3a, 0x2a, 0x44, 0x6a, 0x72, 0x7a, 0xea, 0x44, 0x55, 0xca, 0xb9, 0x2a,
+    0x49, 0x46, 0x7a, 0x08, 0xf9, 0x6a, 0xa5, 0x1a, 0x22, 0xb9, 0x6a, 0x40, 0x00, 0x21, 0xf9, 0x04,
+    0x04, 0x05, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x08,
+    0xff, 0x00, 0xff, 0x09, 0x1c, 0x48, 0xb0, 0xa0, 0xc1, 0x82, 0x00, 0x12, 0x2a, 0x5c, 0x98, 0xf0,
+    0xa0, 0xc3, 0x87, 0x10, 0x23, 0x0e, 0xac, 0x50, 0x81, 0xa1, 0xc5, 0x8b, 0x12, 0x33, 0x6a, 0x9c,
+    0x48, 0xb1, 0xe2, 0xc5, 0x8f, 0x0b, 0x37, 0x8a, 0x34, 0xd8, 0xb1, 0x24, 0xc8, 0x93, 0x21, 0x47,
+    0x6e, 0x2c, 0xc9, 0x12, 0xa5, 0x4b, 0x95, 0x12, 0x59, 0xca, 0x74, 0x79, 0x72, 0x80, 0x4d, 0x98,
+    0x0e, 0x65, 0xce, 0xa4, 0xf9, 0xd1, 0xe6, 0x4d, 0x9c, 0x1c, 0x75, 0xb6, 0xe4, 0x69, 0xd1, 0xa7,
+    0x51, 0xa0, 0x42, 0x85, 0x12, 0x65, 0x68, 0xf4, 0xa8, 0xca, 0xa4, 0x4a, 0x97, 0x26, 0x6c, 0xda,
+    0x74, 0x24, 0xd4, 0xa8, 0x4b, 0xa9, 0x52, 0x5d, 0x79, 0x15, 0x2b, 0x4f, 0xad, 0x5b, 0x33, 0x76,
+    0xf5, 0xea, 0x12, 0x6c, 0xd8, 0x88, 0x63, 0xc9, 0xa2, 0x34, 0x7b, 0x36, 0x67, 0x5a, 0x9d, 0x44,
+    0xd9, 0x6a, 0x85, 0xf8, 0x56, 0x6d, 0x4f, 0xb9, 0x55, 0x1d, 0x4a, 0xa8, 0x0b, 0xb7, 0x2c, 0xde,
+    0xb6, 0x03, 0x25, 0x08, 0xde, 0xcb, 0xb7, 0xa3, 0xdf, 0xbf, 0x80, 0xff, 0x0d, 0x1e, 0x5c, 0xd8,
+    0x63, 0x4d, 0xc4, 0x89, 0x17, 0x33, 0x2e, 0xfc, 0x18, 0x72, 0xde, 0xc0, 0x92, 0x17, 0xf3, 0xad,
+    0x6c, 0xd9, 0xa9, 0xc0, 0xcc, 0x99, 0xdf, 0x82, 0xec, 0x3c, 0xf7, 0x33, 0x68, 0xd0, 0x63, 0xef,
+    0x92, 0x0e, 0x7b, 0xfa, 0x74, 0xea, 0xa2, 0xab, 0x59, 0xb7, 0x76, 0x0d, 0x15, 0x76, 0x6c, 0x9b,
+    0x06, 0x72, 0x9b, 0x9e, 0x4d, 0xbb, 0xef, 0xc2, 0xd8, 0xb9, 0x83, 0xeb, 0xe6, 0xcd, 0x3b, 0xe9,
+    0xef, 0xce, 0xc2, 0x93, 0xe7, 0x26, 0x4e, 0xdc, 0x37, 0x00, 0xc4, 0xca, 0xa3, 0x2f, 0x67, 0xde,
+    0xdc, 0xe4, 0x54, 0xb6, 0xd2, 0xb3, 0x4f, 0xa7, 0x5e, 0xdd, 0x23, 0x58, 0xed, 0xe0, 0xb7, 0x73,
+    0xff, 0x2f, 0x4e, 0xf1, 0xb9, 0xd1, 0xf0, 0xe8, 0x0d, 0x8c, 0xe7, 0x5e, 0x01, 0x77, 0xfa, 0xf7,
+    0xeb, 0x99, 0x3f, 0x78, 0x90, 0xe0, 0xbd, 0xfd, 0xf8, 0xa7, 0xe7, 0xeb, 0x67, 0x90, 0xa0, 0xbf,
+    0x7d, 0xf4, 0xf8, 0x2d, 0xa6, 0xdf, 0x80, 0x0f, 0x30, 0xc0, 0x9f, 0x7f, 0xff, 0x69, 0x87, 0x1f,
+    0x81, 0x0c, 0x1a, 0x78, 0x60, 0x7f, 0xf5, 0x25, 0x18, 0x1d, 0x77, 0x0c, 0x56, 0x58, 0xa0, 0x83,
+    0x10, 0x66, 0x28, 0x61, 0x72, 0xbc, 0x59, 0xe8, 0xe1, 0x85, 0x06, 0x66, 0x28, 0xe2, 0x86, 0xc3,
+    0x65, 0xf6, 0xe1, 0x87, 0x0e, 0x62, 0x28, 0x22, 0x84, 0x1b, 0xee, 0x76, 0xe2, 0x8b, 0x20, 0xaa,
+    0xb8, 0x22, 0x8b, 0xff, 0x09, 0x04, 0x23, 0x8c, 0x29, 0xca, 0x38, 0x23, 0x8d, 0xe9, 0xd9, 0x78,
+    0xe3, 0x89, 0x39, 0xea, 0xb8, 0x63, 0x84, 0xe8, 0x0d, 0xf4, 0xa3, 0x87, 0x41, 0x0a, 0x39, 0x24,
+    0x91, 0xd9, 0x11, 0x74, 0x64, 0x85, 0x49, 0x2a, 0xb9, 0x24, 0x93, 0xca, 0x15, 0xf4, 0x24, 0x81,
+    0x51, 0x86, 0x38, 0xe5, 0x8c, 0xd1, 0x19, 0x74, 0xe5, 0x7e, 0x59, 0x6a, 0xb9, 0xe5, 0x88, 0xc9,
+    0x79, 0xf9, 0x65, 0x8c, 0x51, 0x8e, 0xb9, 0xa3, 0x70, 0x07, 0x7d, 0x19, 0xa6, 0x94, 0x6a, 0xfa,
+    0xf7, 0xd0, 0x93, 0x6f, 0xc2, 0x19, 0x27, 0x44, 0x74, 0xd6, 0x29, 0x66, 0x9c, 0x19, 0x46, 0xf4,
+    0xa3, 0x9e, 0x76, 0x6e, 0x99, 0xd1, 0x8d, 0x80, 0xee, 0xc9, 0xa7, 0x46, 0x38, 0x16, 0xfa, 0x20,
+    0x9f, 0x09, 0x6c, 0xf4, 0xa2, 0xa2, 0x86, 0x8e, 0x39, 0x12, 0x8a, 0x90, 0x2e, 0x2a, 0xa9, 0x4a,
+    0x16, 0x56, 0x1a, 0xe9, 0x92, 0x40, 0x41, 0xa9, 0xa9, 0xa5, 0x43, 0x02, 0x65, 0x24, 0x98, 0x9f,
+    0x0a, 0x2a, 0xaa, 0x93, 0xf3, 0x7d, 0xba, 0x69, 0x9f, 0xa7, 0x1a, 0xa4, 0xea, 0xaa, 0x8d, 0xb6,
+    0x16, 0xea, 0xd0, 0xab, 0xa0, 0xc6, 0x2a, 0x2b, 0x44, 0xa5, 0x42, 0x78, 0xab, 0x48, 0x95, 0xf6,
+    0xb7, 0x2b, 0x50, 0x75, 0xde, 0x1a, 0x10, 0x00, 0x21, 0xf9, 0x04, 0x04, 0x05, 0x00, 0x00, 0x00,
+    0x2c, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x08, 0xff, 0x00, 0xff, 0x09, 0x1c,
+    0x48, 0xb0, 0xa0, 0xc1, 0x82, 0x00, 0x12, 0x2a, 0x5c, 0x98, 0xf0, 0xa0, 0xc3, 0x87, 0x10, 0x23,
+    0x0e, 0x64, 0x48, 0xb1, 0xe2, 0x80, 0x01, 0x12, 0x33, 0x6a, 0x9c, 0x58, 0xb1, 0xe3, 0xc2, 0x8b,
+    0x17, 0x37, 0x8a, 0x34, 0xe8, 0xb1, 0xe4, 0x47, 0x90, 0x20, 0x47, 0x8a, 0x34, 0xc9, 0x12, 0xa5,
+    0x4b, 0x95, 0x12, 0x2b, 0xc8, 0x64, 0x59, 0xd2, 0xa5, 0x4d, 0x98, 0x0e, 0x65, 0xce, 0xa4, 0xd9,
+    0xd1, 0xe6, 0x4d, 0x9c, 0x03, 0x75, 0x0a, 0xe5, 0x69, 0xd1, 0xe7, 0x4f, 0x98, 0x42, 0x87, 0x12,
+    0x3d, 0x69, 0xf4, 0xa8, 0xc8, 0xa4, 0x49, 0x97, 0x2a, 0x6c, 0x6a, 0x74, 0x24, 0x54, 0xa8, 0x52,
+    0x01, 0x50, 0xad, 0xaa, 0xf1, 0x2a, 0xd6, 0xa5, 0x5b, 0x9b, 0x76, 0xf5, 0x1a, 0x95, 0x68, 0x58,
+    0xae, 0x11, 0xc9, 0x7e, 0xe5, 0x79, 0x16, 0x6d, 0x4e, 0xb5, 0x6b, 0x5b, 0xb6, 0xf5, 0x09, 0x11,
+    0x6e, 0xdc, 0x9a, 0x73, 0xe9, 0xbe, 0xb5, 0x5b, 0xd6, 0x64, 0x5e, 0x9f, 0x06, 0x0e, 0xf2, 0xf5,
+    0x2a, 0xf7, 0xef, 0x45, 0x03, 0x88, 0x03, 0x17, 0x1c, 0x7c, 0xb5, 0x70, 0xde, 0xc4, 0x89, 0x0d,
+    0x32, 0x6e, 0xec, 0xd1, 0xf0, 0x00, 0xc8, 0x91, 0x09, 0x4e, 0xa6, 0xdc, 0xf3, 0x31, 0x66, 0xc8,
+    0x9a, 0x37, 0xdf, 0x65, 0x1a, 0xf6, 0xf3, 0xe7, 0xa0, 0xa2, 0x39, 0x33, 0x3c, 0x6b, 0xba, 0xb5,
+    0xc0, 0xd4, 0xaa, 0xa7, 0x96, 0x6e, 0x6d, 0x5a, 0xa0, 0x84, 0xdb, 0xb0, 0x95, 0x92, 0x06, 0x4c,
+    0xdb, 0xf5, 0xbf, 0xdb, 0xc0, 0x71, 0xa7, 0xa6, 0xd8, 0xb4, 0x77, 0xef, 0xdf, 0xc1, 0x93, 0x4b,
+    0x10, 0xbd, 0x1b, 0xa5, 0x71, 0xe3, 0xca, 0xa3, 0x0b, 0xb7, 0xdb, 0xfc, 0xf2, 0x73, 0xe8, 0xd2,
+    0xb3, 0x2f, 0x57, 0x2b, 0x1b, 0xe4, 0xf5, 0xeb, 0xda, 0xc3, 0x4f, 0xff, 0x2f, 0xeb, 0xfd, 0x3b,
+    0x78, 0xf1, 0xe8, 0xa3, 0x96, 0x37, 0xff, 0x1c, 0xbd, 0x7b, 0xe0, 0x32, 0xad, 0xb3, 0x3f, 0xff,
+    0xde, 0xfd, 0x83, 0x04, 0x09, 0xe6, 0xd3, 0xaf, 0xaf, 0xfd, 0x81, 0x7f, 0x06, 0xf8, 0x05, 0xa8,
+    0x5f, 0x6b, 0xfc, 0x85, 0xe7, 0xdf, 0x03, 0x0c, 0x00, 0x18, 0xe0, 0x82, 0x03, 0x42, 0x56, 0xa0,
+    0x74, 0x07, 0xfe, 0x97, 0xe0, 0x82, 0x14, 0xe2, 0x37, 0xe0, 0x83, 0xc9, 0x45, 0x78, 0x60, 0x82,
+    0x13, 0x56, 0xe8, 0xa1, 0x79, 0x18, 0xde, 0xa6, 0x61, 0x84, 0x1c, 0x2a, 0xe8, 0xe1, 0x89, 0xf9,
+    0x1d, 0x87, 0xe1, 0x88, 0x1b, 0x96, 0x68, 0x22, 0x8a, 0x27, 0xd6, 0x86, 0x5c, 0x7d, 0x2c, 0x92,
+    0xe8, 0x22, 0x8c, 0x38, 0x0a, 0x88, 0x98, 0x6d, 0xef, 0xd5, 0xa8, 0xa1, 0x8b, 0x1d, 0xe6, 0x98,
+    0x23, 0x8f, 0xe8, 0xf9, 0x68, 0x23, 0x90, 0x42, 0x0a, 0x39, 0x90, 0x78, 0x46, 0xfe, 0x08, 0x64,
+    0x90, 0x49, 0x7a, 0x48, 0x50, 0x7f, 0x4d, 0x3a, 0xf9, 0xe4, 0x8b, 0x51, 0x2e, 0x58, 0x50, 0x74,
+    0x55, 0xb2, 0x78, 0x25, 0x94, 0x59, 0xe2, 0x67, 0x90, 0x72, 0x5d, 0x8e, 0xf8, 0x25, 0x87, 0x61,
+    0x6a, 0xb9, 0x25, 0x70, 0x65, 0x7a, 0x79, 0x26, 0x96, 0x59, 0x1e, 0x24, 0x41, 0x9b, 0x35, 0xbe,
+    0x09, 0x66, 0x92, 0x0f, 0xd1, 0xe9, 0xa6, 0x9d, 0x61, 0x42, 0xa4, 0xa7, 0x95, 0x7c, 0xc6, 0xe9,
+    0xe7, 0x9f, 0x12, 0xda, 0x79, 0x27, 0x8a, 0x19, 0x11, 0x8a, 0xa0, 0xa1, 0x87, 0x4a, 0x99, 0x28,
+    0xa1, 0x8c, 0xa2, 0x39, 0xa4, 0x46, 0x7f, 0x46, 0x2a, 0x29, 0x8c, 0x23, 0xe9, 0x69, 0xe9, 0xa5,
+    0x8e, 0x66, 0xda, 0xe6, 0xa6, 0x9c, 0xaa, 0x09, 0x53, 0x99, 0xa0, 0x86, 0x2a, 0x26, 0x50, 0x02,
+    0x55, 0x59, 0x2a, 0xa7, 0xa8, 0x16, 0xd4, 0xe4, 0xaa, 0x41, 0xb6, 0x1b, 0x7a, 0x90, 0x8f, 0xb0,
+    0x26, 0x28, 0x6b, 0x9e, 0x66, 0xd6, 0x7a, 0xab, 0x44, 0x47, 0x6e, 0xba, 0xab, 0x48, 0x85, 0x46,
+    0xfa, 0x2b, 0x50, 0x76, 0xee, 0x1a, 0x10, 0x00, 0x21, 0xf9, 0x04, 0x04, 0x05, 0x00, 0x00, 0x00,
+    0x2c, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x08, 0xff, 0x00, 0xff, 0x09, 0x1c,
+    0x48, 0xb0, 0xa0, 0xc1, 0x82, 0x00, 0x12, 0x2a, 0x1c, 0xc0, 0xb0, 0xe1, 0xc1, 0x87, 0x10, 0x23,
+    0x4a, 0x1c, 0xa8, 0xb0, 0xe2, 0xc2, 0x86, 0x18, 0x19, 0x4e, 0xdc, 0xc8, 0x91, 0xa2, 0xc5, 0x8f,
+    0x19, 0x43, 0x0e, 0xe8, 0x48, 0xd2, 0xe0, 0xc7, 0x93, 0x09, 0x45, 0xaa, 0x2c, 0x49, 0x12, 0x25,
+    0x4a, 0x95, 0x2b, 0x59, 0x4a, 0x74, 0xe9, 0x12, 0x26, 0x4c, 0x99, 0x0f, 0x69, 0xd6, 0xb4, 0x19,
+    0x13, 0xa7, 0x40, 0x9d, 0x34, 0x79, 0xda, 0xf4, 0x09, 0x34, 0xa8, 0xd0, 0x9b, 0x2c, 0x8b, 0x1a,
+    0x3d, 0x2a, 0xd2, 0x40, 0xc9, 0x0a, 0x15, 0x94, 0xbe, 0x64, 0x1a, 0xd2, 0x80, 0xd5, 0x8e, 0x50,
+    0xa1, 0x4a, 0x05, 0x49, 0x15, 0xa3, 0xd5, 0xaf, 0x1c, 0xb3, 0x6a, 0xdd, 0x7a, 0xb1, 0xeb, 0x80,
+    0xaf, 0x60, 0x27, 0x8a, 0xcd, 0x4a, 0x36, 0xa5, 0x59, 0xb4, 0x68, 0x25, 0xae, 0x15, 0xdb, 0xf6,
+    0x2d, 0xdc, 0xb8, 0x10, 0xe7, 0xd2, 0xdd, 0xda, 0xf5, 0x2e, 0xdc, 0xbc, 0x7a, 0xf7, 0x2a, 0xa5,
+    0xea, 0xf7, 0xee, 0xc1, 0xc0, 0x73, 0xa5, 0x32, 0x2d, 0xec, 0xd7, 0x20, 0xe2, 0xc4, 0x45, 0x8f,
+    0x32, 0x6e, 0x5c, 0xf0, 0x31, 0x64, 0x9d, 0x42, 0x27, 0x53, 0x1e, 0x68, 0x59, 0x2f, 0x50, 0x9e,
+    0x9a, 0x0b, 0x13, 0xec, 0xec, 0x79, 0x69, 0xd3, 0xd0, 0x9b, 0x49, 0x07, 0x36, 0x9d, 0x11, 0x35,
+    0x63, 0x81, 0xaa, 0x57, 0x4f, 0xad, 0xea, 0x5a, 0xf4, 0xbf, 0xd8, 0xb2, 0xb9, 0xb6, 0xae, 0x6d,
+    0x1b, 0x77, 0xee, 0x8a, 0xb4, 0x79, 0x37, 0xf6, 0x8d, 0x58, 0x37, 0x43, 0xe1, 0x93, 0x89, 0x17,
+    0x07, 0xde, 0x10, 0x79, 0x72, 0xe5, 0xbf, 0x9b, 0x3b, 0x67, 0x0c, 0x7d, 0x39, 0x80, 0xe3, 0xd3,
+    0xa9, 0x57, 0x97, 0x7d, 0x36, 0xbb, 0xf6, 0xed, 0x9e, 0xbd, 0x4f, 0xff, 0x96, 0x40, 0xbe, 0xbc,
+    0xf9, 0xf3, 0xe8, 0xd3, 0x9b, 0x67, 0x90, 0xa0, 0xbd, 0xfb, 0xf7, 0xf0, 0xe3, 0xcb, 0x77, 0xaf,
+    0xbe, 0xbe, 0x7d, 0xf3, 0x0f, 0x18, 0xb0, 0x9f, 0xcf, 0xbf, 0x7f, 0xfb, 0xfb, 0x00, 0xa6, 0xf7,
+    0x40, 0x7e, 0xfa, 0xf9, 0x67, 0x60, 0x7c, 0x01, 0x26, 0x48, 0xde, 0x80, 0x04, 0x16, 0x78, 0xe0,
+    0x83, 0x0a, 0x06, 0xc8, 0x60, 0x83, 0x0e, 0x3e, 0xe8, 0x5f, 0x84, 0xf7, 0x4d, 0x48, 0x61, 0x85,
+    0x16, 0xce, 0xf7, 0x0f, 0x86, 0xea, 0x69, 0xb8, 0x21, 0x87, 0x1d, 0xbe, 0x27, 0x10, 0x88, 0xe8,
+    0x89, 0x38, 0x22, 0x89, 0x25, 0x26, 0x70, 0x22, 0x8a, 0xe5, 0xa9, 0xb8, 0x22, 0x8b, 0x1d, 0xbe,
+    0x08, 0xa3, 0x8c, 0x33, 0xd2, 0xf8, 0xe0, 0x40, 0x37, 0xe2, 0xa8, 0xdf, 0x8f, 0x40, 0xea, 0xe8,
+    0x1f, 0x41, 0x28, 0xe2, 0x38, 0x60, 0x90, 0x48, 0xee, 0x57, 0x23, 0x91, 0x11, 0x1a, 0x79, 0x64,
+    0x92, 0x41, 0x2e, 0xc9, 0x64, 0x82, 0x4e, 0x3e, 0x09, 0x25, 0x90, 0x16, 0x1a, 0xa4, 0x60, 0x95,
+    0x56, 0x5e, 0xf9, 0xe3, 0x8e, 0x5a, 0x02, 0xc8, 0x65, 0x97, 0x5e, 0x0a, 0xe9, 0x1e, 0x44, 0x19,
+    0x8e, 0x99, 0x23, 0x94, 0xfd, 0x45, 0x64, 0x9f, 0x9a, 0x64, 0x96, 0x29, 0xa4, 0x44, 0x21, 0xc2,
+    0xb9, 0xe6, 0x95, 0xf2, 0x6d, 0x94, 0xa2, 0x9d, 0x77, 0xe2, 0x69, 0xa2, 0x9e, 0xf8, 0xf1, 0xd9,
+    0xa7, 0x9f, 0xed, 0x75, 0x14, 0xa3, 0xa0, 0x83, 0xfa, 0x59, 0x92, 0x04, 0x88, 0xc6, 0x29, 0x67,
+    0x90, 0x32, 0x35, 0x9a, 0x28, 0x94, 0x3e, 0x35, 0xfa, 0x28, 0xa5, 0x3e, 0x09, 0x24, 0xe8, 0xa5,
+    0x90, 0x66, 0x4a, 0x10, 0x9f, 0x9c, 0xfe, 0xe8, 0xe9, 0x41, 0x70, 0x86, 0x3a, 0x2a, 0x44, 0x6a,
+    0x72, 0x7a, 0xea, 0x44, 0x55, 0xca, 0xb9, 0x2a, 0x49, 0x46, 0x7a, 0x08, 0xf9, 0x6a, 0xa5, 0x1a,
+    0x22, 0xb9, 0x6a, 0x40, 0x00, 0x21, 0xf9, 0x04, 0x04, 0x05, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00,
+    0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x08, 0xff, 0x00, 0xff, 0x09, 0x1c, 0x48, 0xb0, 0xa0,
+    0xc1, 0x82, 0x03, 0x12, 0x2a, 0x5c, 0x98, 0xf0, 0xa0, 0xc3, 0x87, 0x10, 0x23, 0x0e, 0x04, 0x00,
+    0x80, 0xa1, 0xc5, 0x8b, 0x12, 0x33, 0x6a, 0x9c, 0x48, 0xb1, 0xe2, 0xc5, 0x8f, 0x0b, 0x37, 0x8a,
+    0x34, 0xd8, 0xb1, 0x24, 0xc8, 0x93, 0x21, 0x47, 0x6e, 0x2c, 0xc9, 0x12, 0xa5, 0x4b, 0x95, 0x12,
+    0x59, 0xca, 0x74, 0x79, 0xd2, 0x80, 0x4d, 0x98, 0x0e, 0x65, 0xce, 0xa4, 0xf9, 0xd1, 0xe6, 0x4d,
+    0x9c, 0x1c, 0x75, 0xb6, 0xe4, 0x69, 0xd1, 0xa7, 0x51, 0xa0, 0x42, 0x85, 0x12, 0x65, 0x68, 0xf4,
+    0xa8, 0xca, 0xa4, 0x4a, 0x97, 0x26, 0x6c, 0xda, 0x74, 0x24, 0xd4, 0xa8, 0x4b, 0xa9, 0x52, 0x5d,
+    0x79, 0x15, 0x2b, 0x4f, 0xad, 0x5b, 0x33, 0x76, 0xf5, 0xea, 0x12, 0x6c, 0xd8, 0x88, 0x63, 0xc9,
+    0xa2, 0x34, 0x7b, 0x36, 0x67, 0x5a, 0x9d, 0x44, 0xd9, 0x6a, 0x85, 0xf8, 0x56, 0x6d, 0x4f, 0xb9,
+    0x55, 0x1d, 0x56, 0xa8, 0x0b, 0xb7, 0x2c, 0xde, 0xb6, 0x03, 0x2b, 0x08, 0xde, 0xcb, 0xb7, 0xa3,
+    0xdf, 0xbf, 0x80, 0xff, 0x0d, 0x1e, 0x5c, 0xd8, 0x63, 0x4d, 0xc4, 0x89, 0x17, 0x33, 0x2e, 0xfc,
+    0x18, 0x72, 0xde, 0xc0, 0x92, 0x17, 0xf3, 0xad, 0x6c, 0xd9, 0xa9, 0xc0, 0xcc, 0x99, 0xdf, 0x82,
+    0xec, 0x3c, 0xf7, 0x33, 0x68, 0xd0, 0x63, 0xef, 0x92, 0x0e, 0x7b, 0xfa, 0x74, 0xea, 0xa2, 0xab,
+    0x59, 0xb7, 0x76, 0x0d, 0x15, 0x76, 0x6c, 0x9b, 0x09, 0x72, 0x9b, 0x9e, 0x4d, 0xbb, 0xef, 0xc2,
+    0xd8, 0xb9, 0x83, 0xeb, 0xe6, 0xcd, 0x3b, 0xe9, 0xef, 0xce, 0xc2, 0x93, 0xe7, 0x26, 0x4e, 0xdc,
+    0xf7, 0x00, 0xc4, 0xca, 0xa3, 0x2f, 0x67, 0xde, 0xdc, 0xe4, 0x54, 0xb6, 0xd2, 0xb3, 0x4f, 0xa7,
+    0x5e, 0xdd, 0x23, 0x58, 0xed, 0xe0, 0xb7, 0x73, 0xff, 0x2f, 0x4e, 0xf1, 0xb9, 0xd1, 0xf0, 0xe8,
+    0x13, 0x8c, 0xe7, 0x0e, 0x00, 0x77, 0xfa, 0xf7, 0xeb, 0x99, 0x4b, 0x90, 0xc0, 0xe0, 0xbd, 0xfd,
+    0xf8, 0xa7, 0xe7, 0xeb, 0x7f, 0xc0, 0xa0, 0xbf, 0x7d, 0xf4, 0xf8, 0x2d, 0xa6, 0xdf, 0x80, 0x12,
+    0x3c, 0xc0, 0x9f, 0x7f, 0xff, 0x69, 0x87, 0x1f, 0x81, 0x0c, 0x1a, 0x78, 0x60, 0x7f, 0xf5, 0x25,
+    0x18, 0x1d, 0x77, 0x0c, 0x56, 0x58, 0xa0, 0x83, 0x10, 0x66, 0x28, 0x61, 0x72, 0xbc, 0x59, 0xe8,
+    0xe1, 0x85, 0x06, 0x66, 0x28, 0xe2, 0x86, 0xc3, 0x65, 0xf6, 0xe1, 0x87, 0x0e, 0x62, 0x28, 0x22,
+    0x84, 0x1b, 0xee, 0x76, 0xe2, 0x8b, 0x20, 0xaa, 0xb8, 0x22, 0x8b, 0xff, 0x09, 0x04, 0x23, 0x8c,
+    0x29, 0xca, 0x38, 0x23, 0x8d, 0xe9, 0xd9, 0x78, 0xe3, 0x89, 0x39, 0xea, 0xb8, 0x63, 0x84, 0xe8,
+    0x0d, 0xf4, 0xa3, 0x87, 0x41, 0x0a, 0x39, 0x24, 0x91, 0xd9, 0x11, 0x74, 0x64, 0x85, 0x49, 0x2a,
+    0xb9, 0x24, 0x93, 0xca, 0x15, 0xf4, 0x24, 0x81, 0x51, 0x86, 0x38, 0xe5, 0x8c, 0xd1, 0x19, 0x74,
+    0xe5, 0x7e, 0x59, 0x6a, 0xb9, 0xe5, 0x88, 0xc9, 0x79, 0xf9, 0x65, 0x8c, 0x51, 0x8e, 0xb9, 0xa3,
+    0x70, 0x07, 0x7d, 0x19, 0xa6, 0x94, 0x6a, 0xfa, 0xf7, 0xd0, 0x93, 0x6f, 0xc2, 0x19, 0x27, 0x44,
+    0x74, 0xd6, 0x29, 0x66, 0x9c, 0x19, 0x46, 0xf4, 0xa3, 0x9e, 0x76, 0x6e, 0x99, 0xd1, 0x8d, 0x80,
+    0xee, 0xc9, 0xa7, 0x46, 0x38, 0x16, 0xfa, 0x20, 0x9f, 0x0c, 0x6c, 0xf4, 0xa2, 0xa2, 0x86, 0x8e,
+    0x39, 0x12, 0x8a, 0x90, 0x2e, 0x2a, 0xa9, 0x4a, 0x16, 0x56, 0x1a, 0xe9, 0x92, 0x40, 0x41, 0xa9,
+    0xa9, 0xa5, 0x43, 0x02, 0x65, 0x24, 0x98, 0x9f, 0x0a, 0x2a, 0xaa, 0x93, 0xf3, 0x7d, 0xba, 0x69,
+    0x9f, 0xa7, 0x1a, 0xa4, 0xea, 0xaa, 0x8d, 0xb6, 0x16, 0xea, 0xd0, 0xab, 0xa0, 0xc6, 0x2a, 0x2b,
+    0x44, 0xa5, 0x42, 0x78, 0xab, 0x48, 0x95, 0xf6, 0xb7, 0x2b, 0x50, 0x75, 0xde, 0x1a, 0x10, 0x00,
+    0x21, 0xf9, 0x04, 0x04, 0x05, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40,
+    0x00, 0x00, 0x08, 0xff, 0x00, 0xff, 0x09, 0x1c, 0x48, 0xb0, 0xa0, 0xc1, 0x82, 0x03, 0x12, 0x2a,
+    0x5c, 0x98, 0xf0, 0xa0, 0xc3, 0x87, 0x10, 0x23, 0x0e, 0x64, 0x48, 0xb1, 0xa2, 0x01, 0x03, 0x12,
+    0x33, 0x6a, 0x9c, 0x58, 0xb1, 0xe3, 0xc2, 0x8b, 0x17, 0x37, 0x8a, 0x34, 0xe8, 0xb1, 0xe4, 0x47,
+    0x90, 0x20, 0x47, 0x8a, 0x34, 0xc9, 0x12, 0xa5, 0x4b, 0x95, 0x12, 0x01, 0xc8, 0x64, 0x59, 0xd2,
+    0xa5, 0x4d, 0x98, 0x0e, 0x65, 0xce, 0xa4, 0xd9, 0xd1, 0xe6, 0x4d, 0x9c, 0x03, 0x75, 0x0a, 0xe5,
+    0x69, 0xd1, 0xe7, 0x4f, 0x98, 0x42, 0x87, 0x12, 0x3d, 0x69, 0xf4, 0xa8, 0xc8, 0xa4, 0x49, 0x97,
+    0x2a, 0x6c, 0x6a, 0x74, 0x24, 0x54, 0xa8, 0x52, 0x07, 0x50, 0xad, 0xaa, 0xf1, 0x2a, 0xd6, 0xa5,
+    0x5b, 0x9b, 0x76, 0xf5, 0x1a, 0x95, 0x68, 0x58, 0xae, 0x11, 0xc9, 0x7e, 0xe5, 0x79, 0x16, 0x6d,
+    0x4e, 0xb5, 0x6b, 0x5b, 0xb6, 0xf5, 0x09, 0x11, 0x6e, 0xdc, 0x9a, 0x73, 0xe9, 0xbe, 0xb5, 0x5b,
+    0xd6, 0x64, 0x5e, 0x9f, 0x09, 0x0e, 0xf2, 0xf5, 0x2a, 0xf7, 0xef, 0xc5, 0x04, 0x88, 0x03, 0x17,
+    0x1c, 0x7c, 0xb5, 0x70, 0xde, 0xc4, 0x89, 0x0d, 0x32, 0x6e, 0xec, 0xd1, 0xb0, 0x01, 0xc8, 0x91,
+    0x09, 0x4e, 0xa6, 0xdc, 0xf3, 0x31, 0x66, 0xc8, 0x9a, 0x37, 0xdf, 0x65, 0x1a, 0xf6, 0xf3, 0xe7,
+    0xa0, 0xa2, 0x39, 0x33, 0x3c, 0x6b, 0xba, 0xb5, 0xc0, 0xd4, 0xaa, 0xa7, 0x96, 0x6e, 0x6d, 0x5a,
+    0x60, 0x85, 0xdb, 0xb0, 0x95, 0x92, 0x06, 0x4c, 0xdb, 0xf5, 0xbf, 0xdb, 0xc0, 0x71, 0xa7, 0xa6,
+    0xd8, 0xb4, 0x77, 0xef, 0xdf, 0xc1, 0x93, 0x57, 0x10, 0xbd, 0x1b, 0xa5, 0x71, 0xe3, 0xca, 0xa3,
+    0x0b, 0xb7, 0xdb, 0xfc, 0xf2, 0x73, 0xe8, 0xd2, 0xb3, 0x2f, 0x57, 0x2b, 0x1b, 0xe4, 0xf5, 0xeb,
+    0xda, 0xc3, 0x4f, 0xff, 0x2f, 0xeb, 0xfd, 0x3b, 0x78, 0xf1, 0xe8, 0xa3, 0x96, 0x37, 0xff, 0x1c,
+    0xbd, 0x7b, 0xe0, 0x32, 0xad, 0xb3, 0x3f, 0xff, 0xde, 0xbd, 0x04, 0x06, 0x0c, 0xe6, 0xd3, 0xaf,
+    0xaf, 0x5d, 0x82, 0xff, 0x07, 0xf8, 0x05, 0xa8, 0x5f, 0x6b, 0xfc, 0x85, 0xe7, 0x9f, 0x04, 0x0f,
+    0x00, 0x18, 0xe0, 0x82, 0x03, 0x42, 0x56, 0xa0, 0x74, 0x07, 0xfe, 0x97, 0xe0, 0x82, 0x14, 0xe2,
+    0x37, 0xe0, 0x83, 0xc9, 0x45, 0x78, 0x60, 0x82, 0x13, 0x56, 0xe8, 0xa1, 0x79, 0x18, 0xde, 0xa6,
+    0x61, 0x84, 0x1c, 0x2a, 0xe8, 0xe1, 0x89, 0xf9, 0x1d, 0x87, 0xe1, 0x88, 0x1b, 0x96, 0x68, 0x22,
+    0x8a, 0x27, 0xd6, 0x86, 0x5c, 0x7d, 0x2c, 0x92, 0xe8, 0x22, 0x8c, 0x38, 0x0a, 0x88, 0x98, 0x6d,
+    0xef, 0xd5, 0xa8, 0xa1, 0x8b, 0x1d, 0xe6, 0x98, 0x23, 0x8f, 0xe8, 0xf9, 0x68, 0x23, 0x90, 0x42,
+    0x0a, 0x39, 0x90, 0x78, 0x46, 0xfe, 0x08, 0x64, 0x90, 0x49, 0x7a, 0x48, 0x50, 0x7f, 0x4d, 0x3a,
+    0xf9, 0xe4, 0x8b, 0x51, 0x2e, 0x58, 0x50, 0x74, 0x55, 0xb2, 0x78, 0x25, 0x94, 0x59, 0xe2, 0x67,
+    0x90, 0x72, 0x5d, 0x8e, 0xf8, 0x25, 0x87, 0x61, 0x6a, 0xb9, 0x25, 0x70, 0x65, 0x7a, 0x79, 0x26,
+    0x96, 0x59, 0x1e, 0x54, 0x41, 0x9b, 0x35, 0xbe, 0x09, 0x66, 0x92, 0x0f, 0xd1, 0xe9, 0xa6, 0x9d,
+    0x61, 0x42, 0xa4, 0xa7, 0x95, 0x7c, 0xc6, 0xe9, 0xe7, 0x9f, 0x12, 0xda, 0x79, 0x27, 0x8a, 0x19,
+    0x11, 0x8a, 0xa0, 0xa1, 0x87, 0x4a, 0x99, 0x28, 0xa1, 0x8c, 0xa2, 0x39, 0xa4, 0x46, 0x7f, 0x46,
+    0x2a, 0x29, 0x8c, 0x23, 0xe9, 0x69, 0xe9, 0xa5, 0x8e, 0x66, 0xda, 0xe6, 0xa6, 0x9c, 0xaa, 0x09,
+    0x53, 0x99, 0xa0, 0x86, 0x2a, 0x26, 0x50, 0x02, 0x55, 0x59, 0x2a, 0xa7, 0xa8, 0x16, 0xd4, 0xe4,
+    0xaa, 0x41, 0xb6, 0x1b, 0x7a, 0x90, 0x8f, 0xb0, 0x26, 0x28, 0x6b, 0x9e, 0x66, 0xd6, 0x7a, 0xab,
+    0x44, 0x47, 0x6e, 0xba, 0xab, 0x48, 0x85, 0x46, 0xfa, 0x2b, 0x50, 0x76, 0xee, 0x1a, 0x10, 0x00,
+    0x21, 0xf9, 0x04, 0x04, 0x05, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40,
+    0x00, 0x00, 0x08, 0xff, 0x00, 0xff, 0x09, 0x1c, 0x48, 0xb0, 0xa0, 0xc1, 0x82, 0x03, 0x12, 0x2a,
+    0x34, 0xc0, 0xb0, 0xe1, 0xc1, 0x87, 0x10, 0x23, 0x4a, 0x1c, 0xa8, 0xb0, 0xe2, 0xc2, 0x86, 0x18,
+    0x19, 0x4e, 0xdc, 0xc8, 0x91, 0xa2, 0xc5, 0x8f, 0x19, 0x43, 0x1a, 0xe8, 0x48, 0xd2, 0xe0, 0xc7,
+    0x93, 0x09, 0x45, 0xaa, 0x2c, 0x49, 0x12, 0x25, 0x4a, 0x95, 0x2b, 0x59, 0x4a, 0x74, 0xe9, 0x12,
+    0x26, 0x4c, 0x99, 0x0f, 0x69, 0xd6, 0xb4, 0x19, 0x13, 0xa7, 0x40, 0x9d, 0x34, 0x79, 0xda, 0xf4,
+    0x09, 0x34, 0xa8, 0xd0, 0x9b, 0x2c, 0x8b, 0x1a, 0x3d, 0x2a, 0x32, 0x41, 0x49, 0x00, 0x00, 0x94,
+    0xbe, 0x64, 0x1a, 0x32, 0x81, 0xd5, 0x8e, 0x50, 0xa1, 0x4a, 0x05, 0x49, 0x15, 0xa3, 0xd5, 0xaf,
+    0x1c, 0xb3, 0x6a, 0xdd, 0x7a, 0xb1, 0xab, 0x81, 0xaf, 0x60, 0x27, 0x8a, 0xcd, 0x4a, 0x36, 0xa5,
+    0x59, 0xb4, 0x68, 0x25, 0xae, 0x15, 0xdb, 0xf6, 0x2d, 0xdc, 0xb8, 0x10, 0xe7, 0xd2, 0xdd, 0xda,
+    0xf5, 0x2e, 0xdc, 0xbc, 0x7a, 0xf7, 0x2a, 0xa5, 0xea, 0xf7, 0xee, 0xc1, 0xc0, 0x73, 0xa5, 0x32,
+    0x2d, 0xec, 0xd7, 0x20, 0xe2, 0xc4, 0x45, 0x8f, 0x32, 0x6e, 0x5c, 0xf0, 0x31, 0x64, 0x9d, 0x42,
+    0x27, 0x53, 0x1e, 0x68, 0x59, 0x2f, 0x50, 0x9e, 0x9a, 0x0b, 0x13, 0xec, 0xec, 0x79, 0x69, 0xd3,
+    0xd0, 0x9b, 0x49, 0x07, 0x36, 0x9d, 0x11, 0x35, 0x63, 0x81, 0xaa, 0x57, 0x4f, 0xad, 0xea, 0x5a,
+    0xf4, 0xbf, 0xd8, 0xb2, 0xb9, 0xb6, 0xae, 0x6d, 0x1b, 0x77, 0xee, 0x8a, 0xb4, 0x79, 0x37, 0xf6,
+    0x8d, 0x58, 0x37, 0x43, 0xe1, 0x93, 0x89, 0x17, 0x07, 0xde, 0x10, 0x79, 0x72, 0xe5, 0xbf, 0x9b,
+    0x3b, 0x67, 0x0c, 0x7d, 0xf9, 0x80, 0xe3, 0xd3, 0xa9, 0x57, 0x97, 0x7d, 0x36, 0xbb, 0xf6, 0xed,
+    0x9e, 0xbd, 0x4f, 0xff, 0xae, 0x40, 0xbe, 0xbc, 0xf9, 0xf3, 0xe8, 0xd3, 0x9b, 0x7f, 0xc0, 0xa0,
+    0xbd, 0xfb, 0xf7, 0xf0, 0xe3, 0xcb, 0x77, 0xaf, 0xbe, 0xbe, 0x7d, 0xf3, 0x12, 0x1e, 0xb0, 0x9f,
+    0xcf, 0xbf, 0x7f, 0xfb, 0xfb, 0x00, 0xa6, 0x27, 0x41, 0x7e, 0xfa, 0xf9, 0x67, 0x60, 0x7c, 0x01,
+    0x26, 0x48, 0xde, 0x80, 0x04, 0x16, 0x78, 0xe0, 0x83, 0x0a, 0x06, 0xc8, 0x60, 0x83, 0x0e, 0x3e,
+    0xe8, 0x5f, 0x84, 0xf7, 0x4d, 0x48, 0x61, 0x85, 0x16, 0xce, 0xf7, 0x0f, 0x86, 0xea, 0x69, 0xb8,
+    0x21, 0x87, 0x1d, 0xbe, 0x27, 0x10, 0x88, 0xe8, 0x89, 0x38, 0x22, 0x89, 0x25, 0x32, 0x70, 0x22,
+    0x8a, 0xe5, 0xa9, 0xb8, 0x22, 0x8b, 0x1d, 0xbe, 0x08, 0xa3, 0x8c, 0x33, 0xd2, 0xf8, 0xe0, 0x40,
+    0x37, 0xe2, 0xa8, 0xdf, 0x8f, 0x40, 0xea, 0xe8, 0x1f, 0x41, 0x28, 0xe2, 0x38, 0x60, 0x90, 0x48,
+    0xee, 0x57, 0x23, 0x91, 0x11, 0x1a, 0x79, 0x64, 0x92, 0x41, 0x2e, 0xc9, 0x64, 0x82, 0x4e, 0x3e,
+    0x09, 0x25, 0x90, 0x16, 0x1a, 0xa4, 0x60, 0x95, 0x56, 0x5e, 0xf9, 0xe3, 0x8e, 0x5a, 0x02, 0xc8,
+    0x65, 0x97, 0x5e, 0x0a, 0xe9, 0x1e, 0x44, 0x19, 0x8e, 0x99, 0x23, 0x94, 0xfd, 0x45, 0x64, 0x9f,
+    0x9a, 0x64, 0x96, 0x29, 0xa4, 0x44, 0x21, 0xc2, 0xb9, 0xe6, 0x95, 0xf2, 0x6d, 0x94, 0xa2, 0x9d,
+    0x77, 0xe2, 0x69, 0xa2, 0x9e, 0xf8, 0xf1, 0xd9, 0xa7, 0x9f, 0xed, 0x75, 0x14, 0xa3, 0xa0, 0x83,
+    0xfa, 0x59, 0x52, 0x05, 0x88, 0xc6, 0x29, 0x67, 0x90, 0x32, 0x35, 0x9a, 0x28, 0x94, 0x3e, 0x35,
+    0xfa, 0x28, 0xa5, 0x3e, 0x09, 0x24, 0xe8, 0xa5, 0x90, 0x66, 0x4a, 0x10, 0x9f, 0x9c, 0xfe, 0xe8,
+    0xe9, 0x41, 0x70, 0x86, 0x3a, 0x2a, 0x44, 0x6a, 0x72, 0x7a, 0xea, 0x44, 0x55, 0xca, 0xb9, 0x2a,
+    0x49, 0x46, 0x7a, 0x08, 0xf9, 0x6a, 0xa5, 0x1a, 0x22, 0xb9, 0x6a, 0x40, 0x00, 0x21, 0xf9, 0x04,
+    0x04, 0x05, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x08,
+    0xff, 0x00, 0xff, 0x09, 0x1c, 0x48, 0xb0, 0xa0, 0xc1, 0x82, 0x06, 0x12, 0x2a, 0x5c, 0x98, 0xf0,
+    0xa0, 0xc3, 0x87, 0x10, 0x23, 0x0e, 0x1c, 0x30, 0x80, 0xa1, 0xc5, 0x8b, 0x12, 0x33, 0x6a, 0x9c,
+    0x48, 0xb1, 0xe2, 0xc5, 0x8f, 0x0b, 0x37, 0x8a, 0x34, 0xd8, 0xb1, 0x24, 0xc8, 0x93, 0x21, 0x47,
+    0x6e, 0x2c, 0xc9, 0x12, 0xa5, 0x4b, 0x95, 0x12, 0x59, 0xca, 0x74, 0x79, 0x32, 0x81, 0x4d, 0x98,
+    0x0e, 0x65, 0xce, 0xa4, 0xf9, 0xd1, 0xe6, 0x4d, 0x9c, 0x1c, 0x75, 0xb6, 0xe4, 0x69, 0xd1, 0xa7,
+    0x51, 0xa0, 0x42, 0x85, 0x12, 0x65, 0x68, 0xf4, 0xa8, 0xca, 0xa4, 0x4a, 0x97, 0x26, 0x6c, 0xda,
+    0x74, 0x24, 0xd4, 0xa8, 0x4b, 0xa9, 0x52, 0x5d, 0x79, 0x15, 0x2b, 0x4f, 0xad, 0x5b, 0x33, 0x76,
+    0xf5, 0xea, 0x12, 0x6c, 0xd8, 0x88, 0x63, 0xc9, 0xa2, 0x34, 0x7b, 0x36, 0x67, 0x5a, 0x9d, 0x44,
+    0xd9, 0x6a, 0x85, 0xf8, 0x56, 0x6d, 0x4f, 0xb9, 0x55, 0x1d, 0x02, 0xa8, 0x0b, 0xb7, 0x2c, 0xde,
+    0xb6, 0x03, 0x01, 0x08, 0xde, 0xcb, 0xb7, 0xa3, 0xdf, 0xbf, 0x80, 0xff, 0x0d, 0x1e, 0x5c, 0xd8,
+    0x63, 0x4d, 0xc4, 0x89, 0x17, 0x33, 0x2e, 0xfc, 0x18, 0x72, 0xde, 0xc0, 0x92, 0x17, 0xf3, 0xad,
+    0x6c, 0xd9, 0xa9, 0xc0, 0xcc, 0x99, 0xdf, 0x82, 0xec, 0x3c, 0xf7, 0x33, 0x68, 0xd0, 0x63, 0xef,
+    0x92, 0x0e, 0x7b, 0xfa, 0x74, 0xea, 0xa2, 0xab, 0x59, 0xb7, 0x76, 0x0d, 0x15, 0x76, 0x6c, 0x9b,
+    0x0c, 0x72, 0x9b, 0x9e, 0x4d, 0xbb, 0xef, 0xc2, 0xd8, 0xb9, 0x83, 0xeb, 0xe6, 0xcd, 0x3b, 0xe9,
+    0xef, 0xce, 0xc2, 0x93, 0xe7, 0x26, 0x4e, 0xdc, 0xb7, 0x01, 0xc4, 0xca, 0xa3, 0x2f, 0x67, 0xde,
+    0xdc, 0xe4, 0x54, 0xb6, 0xd2, 0xb3, 0x4f, 0xa7, 0x5e, 0xdd, 0x23, 0x58, 0xed, 0xe0, 0xb7, 0x73,
+    0xff, 0x2f, 0x4e, 0xf1, 0xb9, 0xd1, 0xf0, 0xe8, 0x19, 0x8c, 0xe7, 0x3e, 0x00, 0x77, 0xfa, 0xf7,
+    0xeb, 0x99, 0x57, 0xa8, 0xf0, 0xe0, 0xbd, 0xfd, 0xf8, 0xa7, 0xe7, 0xeb, 0x97, 0xf0, 0xa0, 0xbf,
+    0x7d, 0xf4, 0xf8, 0x2d, 0xa6, 0xdf, 0x80, 0x15, 0x48, 0xc0, 0x9f, 0x7f, 0xff, 0x69, 0x87, 0x1f,
+    0x81, 0x0c, 0x1a, 0x78, 0x60, 0x7f, 0xf5, 0x25, 0x18, 0x1d, 0x77, 0x0c, 0x56, 0x58, 0xa0, 0x83,
+    0x10, 0x66, 0x28, 0x61, 0x72, 0xbc, 0x59, 0xe8, 0xe1, 0x85, 0x06, 0x66, 0x28, 0xe2, 0x86, 0xc3,
+    0x65, 0xf6, 0xe1, 0x87, 0x0e, 0x62, 0x28, 0x22, 0x84, 0x1b, 0xee, 0x76, 0xe2, 0x8b, 0x20, 0xaa,
+    0xb8, 0x22, 0x8b, 0xff, 0x09, 0x04, 0x23, 0x8c, 0x29, 0xca, 0x38, 0x23, 0x8d, 0xe9, 0xd9, 0x78,
+    0xe3, 0x89, 0x39, 0xea, 0xb8, 0x63, 0x84, 0xe8, 0x0d, 0xf4, 0xa3, 0x87, 0x41, 0x0a, 0x39, 0x24,
+    0x91, 0xd9, 0x11, 0x74, 0x64, 0x85, 0x49, 0x2a, 0xb9, 0x24, 0x93, 0xca, 0x15, 0xf4, 0x24, 0x81,
+    0x51, 0x86, 0x38, 0xe5, 0x8c, 0xd1, 0x19, 0x74, 0xe5, 0x7e, 0x59, 0x6a, 0xb9, 0xe5, 0x88, 0xc9,
+    0x79, 0xf9, 0x65, 0x8c, 0x51, 0x8e, 0xb9, 0xa3, 0x70, 0x07, 0x7d, 0x19, 0xa6, 0x94, 0x6a, 0xfa,
+    0xf7, 0xd0, 0x93, 0x6f, 0xc2, 0x19, 0x27, 0x44, 0x74, 0xd6, 0x29, 0x66, 0x9c, 0x19, 0x46, 0xf4,
+    0xa3, 0x9e, 0x76, 0x6e, 0x99, 0xd1, 0x8d, 0x80, 0xee, 0xc9, 0xa7, 0x46, 0x38, 0x16, 0xfa, 0x20,
+    0x9f, 0x0f, 0x6c, 0xf4, 0xa2, 0xa2, 0x86, 0x8e, 0x39, 0x12, 0x8a, 0x90, 0x2e, 0x2a, 0xa9, 0x4a,
+    0x16, 0x56, 0x1a, 0xe9, 0x92, 0x40, 0x41, 0xa9, 0xa9, 0xa5, 0x43, 0x02, 0x65, 0x24, 0x98, 0x9f,
+    0x0a, 0x2a, 0xaa, 0x93, 0xf3, 0x7d, 0xba, 0x69, 0x9f, 0xa7, 0x1a, 0xa4, 0xea, 0xaa, 0x8d, 0xb6,
+    0x16, 0xea, 0xd0, 0xab, 0xa0, 0xc6, 0x2a, 0x2b, 0x44, 0xa5, 0x42, 0x78, 0xab, 0x48, 0x95, 0xf6,
+    0xb7, 0x2b, 0x50, 0x75, 0xde, 0x1a, 0x10, 0x00, 0x21, 0xf9, 0x04, 0x04, 0x05, 0x00, 0x00, 0x00,
+    0x2c, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x08, 0xff, 0x00, 0xff, 0x09, 0x1c,
+    0x48, 0xb0, 0xa0, 0xc1, 0x82, 0x06, 0x12, 0x2a, 0x5c, 0x98, 0xf0, 0xa0, 0xc3, 0x87, 0x10, 0x23,
+    0x0e, 0x64, 0x48, 0xb1, 0x62, 0x82, 0x04, 0x12, 0x33, 0x6a, 0x9c, 0x58, 0xb1, 0xe3, 0xc2, 0x8b,
+    0x17, 0x37, 0x8a, 0x34, 0xe8, 0xb1, 0xe4, 0x47, 0x90, 0x20, 0x47, 0x8a, 0x34, 0xc9, 0x12, 0xa5,
+    0x4b, 0x95, 0x12, 0x07, 0xc8, 0x64, 0x59, 0xd2, 0xa5, 0x4d, 0x98, 0x0e, 0x65, 0xce, 0xa4, 0xd9,
+    0xd1, 0xe6, 0x4d, 0x9c, 0x03, 0x75, 0x0a, 0xe5, 0x69, 0xd1, 0xe7, 0x4f, 0x98, 0x42, 0x87, 0x12,
+    0x3d, 0x69, 0xf4, 0xa8, 0xc8, 0xa4, 0x49, 0x97, 0x2a, 0x6c, 0x6a, 0x74, 0x24, 0x54, 0xa8, 0x52,
+    0x0d, 0x50, 0xad, 0xaa, 0xf1, 0x2a, 0xd6, 0xa5, 0x5b, 0x9b, 0x76, 0xf5, 0x1a, 0x95, 0x68, 0x58,
+    0xae, 0x11, 0xc9, 0x7e, 0xe5, 0x79, 0x16, 0x6d, 0x4e, 0xb5, 0x6b, 0x5b, 0xb6, 0xf5, 0x09, 0x11,
+    0x6e, 0xdc, 0x9a, 0x73, 0xe9, 0xbe, 0xb5, 0x5b, 0xd6, 0x64, 0x5e, 0x9f, 0x0c, 0x0e, 0xf2, 0xf5,
+    0x2a, 0xf7, 0xef, 0x45, 0x06, 0x88, 0x03, 0x17, 0x1c, 0x7c, 0xb5, 0x70, 0xde, 0xc4, 0x89, 0x0d,
+    0x32, 0x6e, 0xec, 0xd1, 0x70, 0x02, 0xc8, 0x91, 0x09, 0x4e, 0xa6, 0xdc, 0xf3, 0x31, 0x66, 0xc8,
+    0x9a, 0x37, 0xdf, 0x65, 0x1a, 0xf6, 0xf3, 0xe7, 0xa0, 0xa2, 0x39, 0x33, 0x3c, 0x6b, 0xba, 0xb5,
+    0xc0, 0xd4, 0xaa, 0xa7, 0x96, 0x6e, 0x6d, 0x5a, 0x20, 0x80, 0xdb, 0xb0, 0x95, 0x92, 0x06, 0x4c,
+    0xdb, 0xf5, 0xbf, 0xdb, 0xc0, 0x71, 0xa7, 0xa6, 0xd8, 0xb4, 0x77, 0xef, 0xdf, 0xc1, 0x93, 0x03,
+    0x10, 0xbd, 0x1b, 0xa5, 0x71, 0xe3, 0xca, 0xa3, 0x0b, 0xb7, 0xdb, 0xfc, 0xf2, 0x73, 0xe8, 0xd2,
+    0xb3, 0x2f, 0x57, 0x2b, 0x1b, 0xe4, 0xf5, 0xeb, 0xda, 0xc3, 0x4f, 0xff, 0x2f, 0xeb, 0xfd, 0x3b,
+    0x78, 0xf1, 0xe8, 0xa3, 0x96, 0x37, 0xff, 0x1c, 0xbd, 0x7b, 0xe0, 0x32, 0xad, 0xb3, 0x3f, 0xff,
+    0xde, 0x7d, 0x85, 0x07, 0x0f, 0xe6, 0xd3, 0xaf, 0xaf, 0xbd, 0x82, 0x7f, 0x09, 0xf8, 0x05, 0xa8,
+    0x5f, 0x6b, 0xfc, 0x85, 0xe7, 0x5f, 0x05, 0x12, 0x00, 0x18, 0xe0, 0x82, 0x03, 0x42, 0x56, 0xa0,
+    0x74, 0x07, 0xfe, 0x97, 0xe0, 0x82, 0x14, 0xe2, 0x37, 0xe0, 0x83, 0xc9, 0x45, 0x78, 0x60, 0x82,
+    0x13, 0x56, 0xe8, 0xa1, 0x79, 0x18, 0xde, 0xa6, 0x61, 0x84, 0x1c, 0x2a, 0xe8, 0xe1, 0x89, 0xf9,
+    0x1d, 0x87, 0xe1, 0x88, 0x1b, 0x96, 0x68, 0x22, 0x8a, 0x27, 0xd6, 0x86, 0x5c, 0x7d, 0x2c, 0x92,
+    0xe8, 0x22, 0x8c, 0x38, 0x0a, 0x88, 0x98, 0x6d, 0xef, 0xd5, 0xa8, 0xa1, 0x8b, 0x1d, 0xe6, 0x98,
+    0x23, 0x8f, 0xe8, 0xf9, 0x68, 0x23, 0x90, 0x42, 0x0a, 0x39, 0x90, 0x78, 0x46, 0xfe, 0x08, 0x64,
+    0x90, 0x49, 0x7a, 0x48, 0x50, 0x7f, 0x4d, 0x3a, 0xf9, 0xe4, 0x8b, 0x51, 0x2e, 0x58, 0x50, 0x74,
+    0x55, 0xb2, 0x78, 0x25, 0x94, 0x59, 0xe2, 0x67, 0x90, 0x72, 0x5d, 0x8e, 0xf8, 0x25, 0x87, 0x61,
+    0x6a, 0xb9, 0x25, 0x70, 0x65, 0x7a, 0x79, 0x26, 0x96, 0x59, 0x1e, 0x04, 0x40, 0x9b, 0x35, 0xbe,
+    0x09, 0x66, 0x92, 0x0f, 0xd1, 0xe9, 0xa6, 0x9d, 0x61, 0x42, 0xa4, 0xa7, 0x95, 0x7c, 0xc6, 0xe9,
+    0xe7, 0x9f, 0x12, 0xda, 0x79, 0x27, 0x8a, 0x19, 0x11, 0x8a, 0xa0, 0xa1, 0x87, 0x4a, 0x99, 0x28,
+    0xa1, 0x8c, 0xa2, 0x39, 0xa4, 0x46, 0x7f, 0x46, 0x2a, 0x29, 0x8c, 0x23, 0xe9, 0x69, 0xe9, 0xa5,
+    0x8e, 0x66, 0xda, 0xe6, 0xa6, 0x9c, 0xaa, 0x09, 0x53, 0x99, 0xa0, 0x86, 0x2a, 0x26, 0x50, 0x02,
+    0x55, 0x59, 0x2a, 0xa7, 0xa8, 0x16, 0xd4, 0xe4, 0xaa, 0x41, 0xb6, 0x1b, 0x7a, 0x90, 0x8f, 0xb0,
+    0x26, 0x28, 0x6b, 0x9e, 0x66, 0xd6, 0x7a, 0xab, 0x44, 0x47, 0x6e, 0xba, 0xab, 0x48, 0x85, 0x46,
+    0xfa, 0x2b, 0x50, 0x76, 0xee, 0x1a, 0x10, 0x00, 0x21, 0xf9, 0x04, 0x04, 0x05, 0x00, 0x00, 0x00,
+    0x2c, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x08, 0xff, 0x00, 0xff, 0x09, 0x1c,
+    0x48, 0xb0, 0xa0, 0xc1, 0x82, 0x06, 0x12, 0x2a, 0x4c, 0xc0, 0xb0, 0xe1, 0xc1, 0x87, 0x10, 0x23,
+    0x4a, 0x1c, 0xa8, 0xb0, 0xe2, 0xc2, 0x86, 0x18, 0x19, 0x4e, 0xdc, 0xc8, 0x91, 0xa2, 0xc5, 0x8f,
+    0x19, 0x43, 0x26, 0xe8, 0x48, 0xd2, 0xe0, 0xc7, 0x93, 0x09, 0x45, 0xaa, 0x2c, 0x49, 0x12, 0x25,
+    0x4a, 0x95, 0x2b, 0x59, 0x4a, 0x74, 0xe9, 0x12, 0x26, 0x4c, 0x99, 0x0f, 0x69, 0xd6, 0xb4, 0x19,
+    0x13, 0xa7, 0x40, 0x9d, 0x34, 0x79, 0xda, 0xf4, 0x09, 0x34, 0xa8, 0xd0, 0x9b, 0x2c, 0x8b, 0x1a,
+    0x3d, 0x2a, 0x92, 0x41, 0xc9, 0x01, 0x03, 0x94, 0xbe, 0x64, 0x1a, 0x92, 0x81, 0xd5, 0x8e, 0x50,
+    0xa1, 0x4a, 0x05, 0x49, 0x15, 0xa3, 0xd5, 0xaf, 0x1c, 0xb3, 0x6a, 0xdd, 0x7a, 0xb1, 0x6b, 0x82,
+    0xaf, 0x60, 0x27, 0x8a, 0xcd, 0x4a, 0x36, 0xa5, 0x59, 0xb4, 0x68, 0x25, 0xae, 0x15, 0xdb, 0xf6,
+    0x2d, 0xdc, 0xb8, 0x10, 0xe7, 0xd2, 0xdd, 0xda, 0xf5, 0x2e, 0xdc, 0xbc, 0x7a, 0xf7, 0x2a, 0xa5,
+    0xea, 0xf7, 0xee, 0xc1, 0xc0, 0x73, 0xa5, 0x32, 0x2d, 0xec, 0xd7, 0x20, 0xe2, 0xc4, 0x45, 0x8f,
+    0x32, 0x6e, 0x5c, 0xf0, 0x31, 0x64, 0x9d, 0x42, 0x27, 0x53, 0x1e, 0x68, 0x59, 0x2f, 0x50, 0x9e,
+    0x9a, 0x0b, 0x13, 0xec, 0xec, 0x79, 0x69, 0xd3, 0xd0, 0x9b, 0x49, 0x07, 0x36, 0x9d, 0x11, 0x35,
+    0x63, 0x81, 0xaa, 0x57, 0x4f, 0xad, 0xea, 0x5a, 0xf4, 0xbf, 0xd8, 0xb2, 0xb9, 0xb6, 0xae, 0x6d,
+    0x1b, 0x77, 0xee, 0x8a, 0xb4, 0x79, 0x37, 0xf6, 0x8d, 0x58, 0x37, 0x43, 0xe1, 0x93, 0x89, 0x17,
+    0x07, 0xde, 0x10, 0x79, 0x72, 0xe5, 0xbf, 0x9b, 0x3b, 0x67, 0x0c, 0x7d, 0xb9, 0x81, 0xe3, 0xd3,
+    0xa9, 0x57, 0x97, 0x7d, 0x36, 0xbb, 0xf6, 0xed, 0x9e, 0xbd, 0x4f, 0xff, 0x06, 0x40, 0xbe, 0xbc,
+    0xf9, 0xf3, 0xe8, 0xd3, 0x9b, 0x97, 0xf0, 0xa0, 0xbd, 0xfb, 0xf7, 0xf0, 0xe3, 0xcb, 0x77, 0xaf,
+    0xbe, 0xbe, 0x7d, 0xf3, 0x15, 0x24, 0xb0, 0x9f, 0xcf, 0xbf, 0x7f, 0xfb, 0xfb, 0x00, 0xa6, 0x57,
+    0x41, 0x7e, 0xfa, 0xf9, 0x67, 0x60, 0x7c, 0x01, 0x26, 0x48, 0xde, 0x80, 0x04, 0x16, 0x78, 0xe0,
+    0x83, 0x0a, 0x06, 0xc8, 0x60, 0x83, 0x0e, 0x3e, 0xe8, 0x5f, 0x84, 0xf7, 0x4d, 0x48, 0x61, 0x85,
+    0x16, 0xce, 0xf7, 0x0f, 0x86, 0xea, 0x69, 0xb8, 0x21, 0x87, 0x1d, 0xbe, 0x27, 0x10, 0x88, 0xe8,
+    0x89, 0x38, 0x22, 0x89, 0x25, 0x3e, 0x70, 0x22, 0x8a, 0xe5, 0xa9, 0xb8, 0x22, 0x8b, 0x1d, 0xbe,
+    0x08, 0xa3, 0x8c, 0x33, 0xd2, 0xf8, 0xe0, 0x40, 0x37, 0xe2, 0xa8, 0xdf, 0x8f, 0x40, 0xea, 0xe8,
+    0x1f, 0x41, 0x28, 0xe2, 0x38, 0x60, 0x90, 0x48, 0xee, 0x57, 0x23, 0x91, 0x11, 0x1a, 0x79, 0x64,
+    0x92, 0x41, 0x2e, 0xc9, 0x64, 0x82, 0x4e, 0x3e, 0x09, 0x25, 0x90, 0x16, 0x1a, 0xa4, 0x60, 0x95,
+    0x56, 0x5e, 0xf9, 0xe3, 0x8e, 0x5a, 0x02, 0xc8, 0x65, 0x97, 0x5e, 0x0a, 0xe9, 0x1e, 0x44, 0x19,
+    0x8e, 0x99, 0x23, 0x94, 0xfd, 0x45, 0x64, 0x9f, 0x9a, 0x64, 0x96, 0x29, 0xa4, 0x44, 0x21, 0xc2,
+    0xb9, 0xe6, 0x95, 0xf2, 0x6d, 0x94, 0xa2, 0x9d, 0x77, 0xe2, 0x69, 0xa2, 0x9e, 0xf8, 0xf1, 0xd9,
+    0xa7, 0x9f, 0xed, 0x75, 0x14, 0xa3, 0xa0, 0x83, 0xfa, 0x59, 0x12, 0x00, 0x88, 0xc6, 0x29, 0x67,
+    0x90, 0x32, 0x35, 0x9a, 0x28, 0x94, 0x3e, 0x35, 0xfa, 0x28, 0xa5, 0x3e, 0x09, 0x24, 0xe8, 0xa5,
+    0x90, 0x66, 0x4a, 0x10, 0x9f, 0x9c, 0xfe, 0xe8, 0xe9, 0x41, 0x70, 0x86, 0x3a, 0x2a, 0x44, 0x6a,
+    0x72, 0x7a, 0xea, 0x44, 0x55, 0xca, 0xb9, 0x2a, 0x49, 0x46, 0x7a, 0x08, 0xf9, 0x6a, 0xa5, 0x1a,
+    0x22, 0xb9, 0x6a, 0x40, 0x00, 0x21, 0xf9, 0x04, 0x04, 0x05, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00,
+    0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x08, 0xff, 0x00, 0xff, 0x09, 0x1c, 0x48, 0xb0, 0xa0,
+    0xc1, 0x82, 0x09, 0x12, 0x2a, 0x5c, 0x98, 0xf0, 0xa0, 0xc3, 0x87, 0x10, 0x23, 0x0e, 0x34, 0x60,
+    0x80, 0xa1, 0xc5, 0x8b, 0x12, 0x33, 0x6a, 0x9c, 0x48, 0xb1, 0xe2, 0xc5, 0x8f, 0x0b, 0x37, 0x8a,
+    0x34, 0xd8, 0xb1, 0x24, 0xc8, 0x93, 0x21, 0x47, 0x6e, 0x2c, 0xc9, 0x12, 0xa5, 0x4b, 0x95, 0x12,
+    0x59, 0xca, 0x74, 0x79, 0x92, 0x81, 0x4d, 0x98, 0x0e, 0x65, 0xce, 0xa4, 0xf9, 0xd1, 0xe6, 0x4d,
+    0x9c, 0x1c, 0x75, 0xb6, 0xe4, 0x69, 0xd1, 0xa7, 0x51, 0xa0, 0x42, 0x85, 0x12, 0x65, 0x68, 0xf4,
+    0xa8, 0xca, 0xa4, 0x4a, 0x97, 0x26, 0x6c, 0xda, 0x74, 0x24, 0xd4, 0xa8, 0x4b, 0xa9, 0x52, 0x5d,
+    0x79, 0x15, 0x2b, 0x4f, 0xad, 0x5b, 0x33, 0x76, 0xf5, 0xea, 0x12, 0x6c, 0xd8, 0x88, 0x63, 0xc9,
+    0xa2, 0x34, 0x7b, 0x36, 0x67, 0x5a, 0x9d, 0x44, 0xd9, 0x6a, 0x85, 0xf8, 0x56, 0x6d, 0x4f, 0xb9,
+    0x55, 0x1d, 0x0e, 0xa8, 0x0b, 0xb7, 0x2c, 0xde, 0xb6, 0x03, 0x07, 0x08, 0xde, 0xcb, 0xb7, 0xa3,
+    0xdf, 0xbf, 0x80, 0xff, 0x0d, 0x1e, 0x5c, 0xd8, 0x63, 0x4d, 0xc4, 0x89, 0x17, 0x33, 0x2e, 0xfc,
+    0x18, 0x72, 0xde, 0xc0, 0x92, 0x17, 0xf3, 0xad, 0x6c, 0xd9, 0xa9, 0xc0, 0xcc, 0x99, 0xdf, 0x82,
+    0xec, 0x3c, 0xf7, 0x33, 0x68, 0xd0, 0x63, 0xef, 0x92, 0x0e, 0x7b, 0xfa, 0x74, 0xea, 0xa2, 0xab,
+    0x59, 0xb7, 0x76, 0x0d, 0x15, 0x76, 0x6c, 0x9b, 0x0f, 0x72, 0x9b, 0x9e, 0x4d, 0xbb, 0xef, 0xc2,
+    0xd8, 0xb9, 0x83, 0xeb, 0xe6, 0xcd, 0x3b, 0xe9, 0xef, 0xce, 0xc2, 0x93, 0xe7, 0x26, 0x4e, 0xdc,
+    0x77, 0x02, 0xc4, 0xca, 0xa3, 0x2f, 0x67, 0xde, 0xdc, 0xe4, 0x54, 0xb6, 0xd2, 0xb3, 0x4f, 0xa7,
+    0x5e, 0xdd, 0x23, 0x58, 0xed, 0xe0, 0xb7, 0x73, 0xff, 0x2f, 0x4e, 0xf1, 0xb9, 0xd1, 0xf0, 0xe8,
+    0x1f, 0x8c, 0xe7, 0x6e, 0x00, 0x77, 0xfa, 0xf7, 0xeb, 0x99, 0x03, 0x00, 0x20, 0xe1, 0xbd, 0xfd,
+    0xf8, 0xa7, 0xe7, 0xeb, 0xaf, 0x20, 0xa1, 0xbf, 0x7d, 0xf4, 0xf8, 0x2d, 0xa6, 0xdf, 0x80, 0x00,
+    0x54, 0xc0, 0x9f, 0x7f, 0xff, 0x69, 0x87, 0x1f, 0x81, 0x0c, 0x1a, 0x78, 0x60, 0x7f, 0xf5, 0x25,
+    0x18, 0x1d, 0x77, 0x0c, 0x56, 0x58, 0xa0, 0x83, 0x10, 0x66, 0x28, 0x61, 0x72, 0xbc, 0x59, 0xe8,
+    0xe1, 0x85, 0x06, 0x66, 0x28, 0xe2, 0x86, 0xc3, 0x65, 0xf6, 0xe1, 0x87, 0x0e, 0x62, 0x28, 0x22,
+    0x84, 0x1b, 0xee, 0x76, 0xe2, 0x8b, 0x20, 0xaa, 0xb8, 0x22, 0x8b, 0xff, 0x09, 0x04, 0x23, 0x8c,
+    0x29, 0xca, 0x38, 0x23, 0x8d, 0xe9, 0xd9, 0x78, 0xe3, 0x89, 0x39, 0xea, 0xb8, 0x63, 0x84, 0xe8,
+    0x0d, 0xf4, 0xa3, 0x87, 0x41, 0x0a, 0x39, 0x24, 0x91, 0xd9, 0x11, 0x74, 0x64, 0x85, 0x49, 0x2a,
+    0xb9, 0x24, 0x93, 0xca, 0x15, 0xf4, 0x24, 0x81, 0x51, 0x86, 0x38, 0xe5, 0x8c, 0xd1, 0x19, 0x74,
+    0xe5, 0x7e, 0x59, 0x6a, 0xb9, 0xe5, 0x88, 0xc9, 0x79, 0xf9, 0x65, 0x8c, 0x51, 0x8e, 0xb9, 0xa3,
+    0x70, 0x07, 0x7d, 0x19, 0xa6, 0x94, 0x6a, 0xfa, 0xf7, 0xd0, 0x93, 0x6f, 0xc2, 0x19, 0x27, 0x44,
+    0x74, 0xd6, 0x29, 0x66, 0x9c, 0x19, 0x46, 0xf4, 0xa3, 0x9e, 0x76, 0x6e, 0x99, 0xd1, 0x8d, 0x80,
+    0xee, 0xc9, 0xa7, 0x46, 0x38, 0x16, 0xfa, 0x20, 0x9f, 0x12, 0x6c, 0xf4, 0xa2, 0xa2, 0x86, 0x8e,
+    0x39, 0x12, 0x8a, 0x90, 0x2e, 0x2a, 0xa9, 0x4a, 0x16, 0x56, 0x1a, 0xe9, 0x92, 0x40, 0x41, 0xa9,
+    0xa9, 0xa5, 0x43, 0x02, 0x65, 0x24, 0x98, 0x9f, 0x0a, 0x2a, 0xaa, 0x93, 0xf3, 0x7d, 0xba, 0x69,
+    0x9f, 0xa7, 0x1a, 0xa4, 0xea, 0xaa, 0x8d, 0xb6, 0x16, 0xea, 0xd0, 0xab, 0xa0, 0xc6, 0x2a, 0x2b,
+    0x44, 0xa5, 0x42, 0x78, 0xab, 0x48, 0x95, 0xf6, 0xb7, 0x2b, 0x50, 0x75, 0xde, 0x1a, 0x10, 0x00,
+    0x21, 0xf9, 0x04, 0x04, 0x05, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40,
+    0x00, 0x00, 0x08, 0xff, 0x00, 0xff, 0x09, 0x1c, 0x48, 0xb0, 0xa0, 0xc1, 0x82, 0x09, 0x12, 0x2a,
+    0x5c, 0x98, 0xf0, 0xa0, 0xc3, 0x87, 0x10, 0x23, 0x0e, 0x64, 0x48, 0xb1, 0x22, 0x03, 0x06, 0x12,
+    0x33, 0x6a, 0x9c, 0x58, 0xb1, 0xe3, 0xc2, 0x8b, 0x17, 0x37, 0x8a, 0x34, 0xe8, 0xb1, 0xe4, 0x47,
+    0x90, 0x20, 0x47, 0x8a, 0x34, 0xc9, 0x12, 0xa5, 0x4b, 0x95, 0x12, 0x0d, 0xc8, 0x64, 0x59, 0xd2,
+    0xa5, 0x4d, 0x98, 0x0e, 0x65, 0xce, 0xa4, 0xd9, 0xd1, 0xe6, 0x4d, 0x9c, 0x03, 0x75, 0x0a, 0xe5,
+    0x69, 0xd1, 0xe7, 0x4f, 0x98, 0x42, 0x87, 0x12, 0x3d, 0x69, 0xf4, 0xa8, 0xc8, 0xa4, 0x49, 0x97,
+    0x2a, 0x6c, 0x6a, 0x74, 0x24, 0x54, 0xa8, 0x52, 0x13, 0x50, 0xad, 0xaa, 0xf1, 0x2a, 0xd6, 0xa5,
+    0x5b, 0x9b, 0x76, 0xf5, 0x1a, 0x95, 0x68, 0x58, 0xae, 0x11, 0xc9, 0x7e, 0xe5, 0x79, 0x16, 0x6d,
+    0x4e, 0xb5, 0x6b, 0x5b, 0xb6, 0xf5, 0x09, 0x11, 0x6e, 0xdc, 0x9a, 0x73, 0xe9, 0xbe, 0xb5, 0x5b,
+    0xd6, 0x64, 0x5e, 0x9f, 0x0f, 0x0e, 0xf2, 0xf5, 0x2a, 0xf7, 0xef, 0xc5, 0x07, 0x88, 0x03, 0x17,
+    0x1c, 0x7c, 0xb5, 0x70, 0xde, 0xc4, 0x89, 0x0d, 0x32, 0x6e, 0xec, 0xd1, 0x30, 0x03, 0xc8, 0x91,
+    0x09, 0x4e, 0xa6, 0xdc, 0xf3, 0x31, 0x66, 0xc8, 0x9a, 0x37, 0xdf, 0x65, 0x1a, 0xf6, 0xf3, 0xe7,
+    0xa0, 0xa2, 0x39, 0x33, 0x3c, 0x6b, 0xba, 0xb5, 0xc0, 0xd4, 0xaa, 0xa7, 0x96, 0x6e, 0x6d, 0x5a,
+    0xe0, 0x80, 0xdb, 0xb0, 0x95, 0x92, 0x06, 0x4c, 0xdb, 0xf5, 0xbf, 0xdb, 0xc0, 0x71, 0xa7, 0xa6,
+    0xd8, 0xb4, 0x77, 0xef, 0xdf, 0xc1, 0x93, 0x0f, 0x10, 0xbd, 0x1b, 0xa5, 0x71, 0xe3, 0xca, 0xa3,
+    0x0b, 0xb7, 0xdb, 0xfc, 0xf2, 0x73, 0xe8, 0xd2, 0xb3, 0x2f, 0x57, 0x2b, 0x1b, 0xe4, 0xf5, 0xeb,
+    0xda, 0xc3, 0x4f, 0xff, 0x2f, 0xeb, 0xfd, 0x3b, 0x78, 0xf1, 0xe8, 0xa3, 0x96, 0x37, 0xff, 0x1c,
+    0xbd, 0x7b, 0xe0, 0x32, 0xad, 0xb3, 0x3f, 0xff, 0xde, 0x3d, 0x00, 0x09, 0x12, 0xe6, 0xd3, 0xaf,
+    0xaf, 0x1d, 0x80, 0xff, 0x0a, 0xf8, 0x05, 0xa8, 0x5f, 0x6b, 0xfc, 0x85, 0xe7, 0x1f, 0x00, 0x15,
+    0x00, 0x18, 0xe0, 0x82, 0x03, 0x42, 0x56, 0xa0, 0x74, 0x07, 0xfe, 0x97, 0xe0, 0x82, 0x14, 0xe2,
+    0x37, 0xe0, 0x83, 0xc9, 0x45, 0x78, 0x60, 0x82, 0x13, 0x56, 0xe8, 0xa1, 0x79, 0x18, 0xde, 0xa6,
+    0x61, 0x84, 0x1c, 0x2a, 0xe8, 0xe1, 0x89, 0xf9, 0x1d, 0x87, 0xe1, 0x88, 0x1b, 0x96, 0x68, 0x22,
+    0x8a, 0x27, 0xd6, 0x86, 0x5c, 0x7d, 0x2c, 0x92, 0xe8, 0x22, 0x8c, 0x38, 0x0a, 0x88, 0x98, 0x6d,
+    0xef, 0xd5, 0xa8, 0xa1, 0x8b, 0x1d, 0xe6, 0x98, 0x23, 0x8f, 0xe8, 0xf9, 0x68, 0x23, 0x90, 0x42,
+    0x0a, 0x39, 0x90, 0x78, 0x46, 0xfe, 0x08, 0x64, 0x90, 0x49, 0x7a, 0x48, 0x50, 0x7f, 0x4d, 0x3a,
+    0xf9, 0xe4, 0x8b, 0x51, 0x2e, 0x58, 0x50, 0x74, 0x55, 0xb2, 0x78, 0x25, 0x94, 0x59, 0xe2, 0x67,
+    0x90, 0x72, 0x5d, 0x8e, 0xf8, 0x25, 0x87, 0x61, 0x6a, 0xb9, 0x25, 0x70, 0x65, 0x7a, 0x79, 0x26,
+    0x96, 0x59, 0x1e, 0x34, 0x40, 0x9b, 0x35, 0xbe, 0x09, 0x66, 0x92, 0x0f, 0xd1, 0xe9, 0xa6, 0x9d,
+    0x61, 0x42, 0xa4, 0xa7, 0x95, 0x7c, 0xc6, 0xe9, 0xe7, 0x9f, 0x12, 0xda, 0x79, 0x27, 0x8a, 0x19,
+    0x11, 0x8a, 0xa0, 0xa1, 0x87, 0x4a, 0x99, 0x28, 0xa1, 0x8c, 0xa2, 0x39, 0xa4, 0x46, 0x7f, 0x46,
+    0x2a, 0x29, 0x8c, 0x23, 0xe9, 0x69, 0xe9, 0xa5, 0x8e, 0x66, 0xda, 0xe6, 0xa6, 0x9c, 0xaa, 0x09,
+    0x53, 0x99, 0xa0, 0x86, 0x2a, 0x26, 0x50, 0x02, 0x55, 0x59, 0x2a, 0xa7, 0xa8, 0x16, 0xd4, 0xe4,
+    0xaa, 0x41, 0xb6, 0x1b, 0x7a, 0x90, 0x8f, 0xb0, 0x26, 0x28, 0x6b, 0x9e, 0x66, 0xd6, 0x7a, 0xab,
+    0x44, 0x47, 0x6e, 0xba, 0xab, 0x48, 0x85, 0x46, 0xfa, 0x2b, 0x50, 0x76, 0xee, 0x1a, 0x10, 0x00,
+    0x21, 0xf9, 0x04, 0x04, 0x05, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40,
+    0x00, 0x00, 0x08, 0xff, 0x00, 0xff, 0x09, 0x1c, 0x48, 0xb0, 0xa0, 0xc1, 0x82, 0x09, 0x12, 0x2a,
+    0x64, 0xc0, 0xb0, 0xe1, 0xc1, 0x87, 0x10, 0x23, 0x4a, 0x1c, 0xa8, 0xb0, 0xe2, 0xc2, 0x86, 0x18,
+    0x19, 0x4e, 0xdc, 0xc8, 0x91, 0xa2, 0xc5, 0x8f, 0x19, 0x43, 0x32, 0xe8, 0x48, 0xd2, 0xe0, 0xc7,
+    0x93, 0x09, 0x45, 0xaa, 0x2c, 0x49, 0x12, 0x25, 0x4a, 0x95, 0x2b, 0x59, 0x4a, 0x74, 0xe9, 0x12,
+    0x26, 0x4c, 0x99, 0x0f, 0x69, 0xd6, 0xb4, 0x19, 0x13, 0xa7, 0x40, 0x9d, 0x34, 0x79, 0xda, 0xf4,
+    0x09, 0x34, 0xa8, 0xd0, 0x9b, 0x2c, 0x8b, 0x1a, 0x3d, 0x2a, 0xf2, 0x41, 0x49, 0x03, 0x06, 0x94,
+    0xbe, 0x64, 0x1a, 0xf2, 0x81, 0xd5, 0x8e, 0x50, 0xa1, 0x4a, 0x05, 0x49, 0x15, 0xa3, 0xd5, 0xaf,
+    0x1c, 0xb3, 0x6a, 0xdd, 0x7a, 0xb1, 0x2b, 0x83, 0xaf, 0x60, 0x27, 0x8a, 0xcd, 0x4a, 0x36, 0xa5,
+    0x59, 0xb4, 0x68, 0x25, 0xae, 0x15, 0xdb, 0xf6, 0x2d, 0xdc, 0xb8, 0x10, 0xe7, 0xd2, 0xdd, 0xda,
+    0xf5, 0x2e, 0xdc, 0xbc, 0x7a, 0xf7, 0x2a, 0xa5, 0xea, 0xf7, 0xee, 0xc1, 0xc0, 0x73, 0xa5, 0x32,
+    0x2d, 0xec, 0xd7, 0x20, 0xe2, 0xc4, 0x45, 0x8f, 0x32, 0x6e, 0x5c, 0xf0, 0x31, 0x64, 0x9d, 0x42,
+    0x27, 0x53, 0x1e, 0x68, 0x59, 0x2f, 0x50, 0x9e, 0x9a, 0x0b, 0x13, 0xec, 0xec, 0x79, 0x69, 0xd3,
+    0xd0, 0x9b, 0x49, 0x07, 0x36, 0x9d, 0x11, 0x35, 0x63, 0x81, 0xaa, 0x57, 0x4f, 0xad, 0xea, 0x5a,
+    0xf4, 0xbf, 0xd8, 0xb2, 0xb9, 0xb6, 0xae, 0x6d, 0x1b, 0x77, 0xee, 0x8a, 0xb4, 0x79, 0x37, 0xf6,
+    0x8d, 0x58, 0x37, 0x43, 0xe1, 0x93, 0x89, 0x17, 0x07, 0xde, 0x10, 0x79, 0x72, 0xe5, 0xbf, 0x9b,
+    0x3b, 0x67, 0x0c, 0x7d, 0x79, 0x82, 0xe3, 0xd3, 0xa9, 0x57, 0x97, 0x7d, 0x36, 0xbb, 0xf6, 0xed,
+    0x9e, 0xbd, 0x4f, 0xff, 0x1e, 0x40, 0xbe, 0xbc, 0xf9, 0xf3, 0xe8, 0xd3, 0x9b, 0xaf, 0x20, 0xa1,
+    0xbd, 0xfb, 0xf7, 0xf0, 0xe3, 0xcb, 0x77, 0xaf, 0xbe, 0xbe, 0x7d, 0xf3, 0x00, 0x2a, 0xb0, 0x9f,
+    0xcf, 0xbf, 0x7f, 0xfb, 0xfb, 0x00, 0xa6, 0x07, 0x40, 0x7e, 0xfa, 0xf9, 0x67, 0x60, 0x7c, 0x01,
+    0x26, 0x48, 0xde, 0x80, 0x04, 0x16, 0x78, 0xe0, 0x83, 0x0a, 0x06, 0xc8, 0x60, 0x83, 0x0e, 0x3e,
+    0xe8, 0x5f, 0x84, 0xf7, 0x4d, 0x48, 0x61, 0x85, 0x16, 0xce, 0xf7, 0x0f, 0x86, 0xea, 0x69, 0xb8,
+    0x21, 0x87, 0x1d, 0xbe, 0x27, 0x10, 0x88, 0xe8, 0x89, 0x38, 0x22, 0x89, 0x25, 0x4a, 0x70, 0x22,
+    0x8a, 0xe5, 0xa9, 0xb8, 0x22, 0x8b, 0x1d, 0xbe, 0x08, 0xa3, 0x8c, 0x33, 0xd2, 0xf8, 0xe0, 0x40,
+    0x37, 0xe2, 0xa8, 0xdf, 0x8f, 0x40, 0xea, 0xe8, 0x1f, 0x41, 0x28, 0xe2, 0x38, 0x60, 0x90, 0x48,
+    0xee, 0x57, 0x23, 0x91, 0x11, 0x1a, 0x79, 0x64, 0x92, 0x41, 0x2e, 0xc9, 0x64, 0x82, 0x4e, 0x3e,
+    0x09, 0x25, 0x90, 0x16, 0x1a, 0xa4, 0x60, 0x95, 0x56, 0x5e, 0xf9, 0xe3, 0x8e, 0x5a, 0x02, 0xc8,
+    0x65, 0x97, 0x5e, 0x0a, 0xe9, 0x1e, 0x44, 0x19, 0x8e, 0x99, 0x23, 0x94, 0xfd, 0x45, 0x64, 0x9f,
+    0x9a, 0x64, 0x96, 0x29, 0xa4, 0x44, 0x21, 0xc2, 0xb9, 0xe6, 0x95, 0xf2, 0x6d, 0x94, 0xa2, 0x9d,
+    0x77, 0xe2, 0x69, 0xa2, 0x9e, 0xf8, 0xf1, 0xd9, 0xa7, 0x9f, 0xed, 0x75, 0x14, 0xa3, 0xa0, 0x83,
+    0xfa, 0x59, 0xd2, 0x00, 0x88, 0xc6, 0x29, 0x67, 0x90, 0x32, 0x35, 0x9a, 0x28, 0x94, 0x3e, 0x35,
+    0xfa, 0x28, 0xa5, 0x3e, 0x09, 0x24, 0xe8, 0xa5, 0x90, 0x66, 0x4a, 0x10, 0x9f, 0x9c, 0xfe, 0xe8,
+    0xe9, 0x41, 0x70, 0x86, 0x3a, 0x2a, 0x44, 0x6a, 0x72, 0x7a, 0xea, 0x44, 0x55, 0xca, 0xb9, 0x2a,
+    0x49, 0x46, 0x7a, 0x08, 0xf9, 0x6a, 0xa5, 0x1a, 0x22, 0xb9, 0x6a, 0x40, 0x00, 0x21, 0xf9, 0x04,
+    0x04, 0x05, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x08,
+    0xff, 0x00, 0xff, 0x09, 0x1c, 0x48, 0xb0, 0xa0, 0xc1, 0x82, 0x0c, 0x12, 0x2a, 0x5c, 0x98, 0xf0,
+    0xa0, 0xc3, 0x87, 0x10, 0x23, 0x0e, 0x4c, 0x90, 0x80, 0xa1, 0xc5, 0x8b, 0x12, 0x33, 0x6a, 0x9c,
+    0x48, 0xb1, 0xe2, 0xc5, 0x8f, 0x0b, 0x37, 0x8a, 0x34, 0xd8, 0xb1, 0x24, 0xc8, 0x93, 0x21, 0x47,
+    0x6e, 0x2c, 0xc9, 0x12, 0xa5, 0x4b, 0x95, 0x12, 0x59, 0xca, 0x74, 0x79, 0xf2, 0x81, 0x4d, 0x98,
+    0x0e, 0x65, 0xce, 0xa4, 0xf9, 0xd1, 0xe6, 0x4d, 0x9c, 0x1c, 0x75, 0xb6, 0xe4, 0x69, 0xd1, 0xa7,
+    0x51, 0xa0, 0x42, 0x85, 0x12, 0x65, 0x68, 0xf4, 0xa8, 0xca, 0xa4, 0x4a, 0x97, 0x26, 0x6c, 0xda,
+    0x74, 0x24, 0xd4, 0xa8, 0x4b, 0xa9, 0x52, 0x5d, 0x79, 0x15, 0x2b, 0x4f, 0xad, 0x5b, 0x33, 0x76,
+    0xf5, 0xea, 0x12, 0x6c, 0xd8, 0x88, 0x63, 0xc9, 0xa2, 0x34, 0x7b, 0x36, 0x67, 0x5a, 0x9d, 0x44,
+    0xd9, 0x6a, 0x85, 0xf8, 0x56, 0x6d, 0x4f, 0xb9, 0x55, 0x1d, 0x1a, 0xa8, 0x0b, 0xb7, 0x2c, 0xde,
+    0xb6, 0x03, 0x0d, 0x08, 0xde, 0xcb, 0xb7, 0xa3, 0xdf, 0xbf, 0x80, 0xff, 0x0d, 0x1e, 0x5c, 0xd8,
+    0x63, 0x4d, 0xc4, 0x89, 0x17, 0x33, 0x2e, 0xfc, 0x18, 0x72, 0xde, 0xc0, 0x92, 0x17, 0xf3, 0xad,
+    0x6c, 0xd9, 0xa9, 0xc0, 0xcc, 0x99, 0xdf, 0x82, 0xec, 0x3c, 0xf7, 0x33, 0x68, 0xd0, 0x63, 0xef,
+    0x92, 0x0e, 0x7b, 0xfa, 0x74, 0xea, 0xa2, 0xab, 0x59, 0xb7, 0x76, 0x0d, 0x15, 0x76, 0x6c, 0x9b,
+    0x12, 0x72, 0x9b, 0x9e, 0x4d, 0xbb, 0xef, 0xc2, 0xd8, 0xb9, 0x83, 0xeb, 0xe6, 0xcd, 0x3b, 0xe9,
+    0xef, 0xce, 0xc2, 0x93, 0xe7, 0x26, 0x4e, 0xdc, 0x37, 0x03, 0xc4, 0xca, 0xa3, 0x2f, 0x67, 0xde,
+    0xdc, 0xe4, 0x54, 0xb6, 0xd2, 0xb3, 0x4f, 0xa7, 0x5e, 0xdd, 0x23, 0x58, 0xed, 0xe0, 0xb7, 0x73,
+    0xff, 0x2f, 0x4e, 0xf1, 0xb9, 0xd1, 0xf0, 0xe8, 0x25, 0x8c, 0xe7, 0x9e, 0x00, 0x77, 0xfa, 0xf7,
+    0xeb, 0x99, 0x0f, 0x18, 0x50, 0xe1, 0xbd, 0xfd, 0xf8, 0xa7, 0xe7, 0xeb, 0x07, 0x50, 0xa1, 0xbf,
+    0x7d, 0xf4, 0xf8, 0x2d, 0xa6, 0xdf, 0x80, 0x03, 0x00, 0xc0, 0x9f, 0x7f, 0xff, 0x69, 0x87, 0x1f,
+    0x81, 0x0c, 0x1a, 0x78, 0x60, 0x7f, 0xf5, 0x25, 0x18, 0x1d, 0x77, 0x0c, 0x56, 0x58, 0xa0, 0x83,
+    0x10, 0x66, 0x28, 0x61, 0x72, 0xbc, 0x59, 0xe8, 0xe1, 0x85, 0x06, 0x66, 0x28, 0xe2, 0x86, 0xc3,
+    0x65, 0xf6, 0xe1, 0x87, 0x0e, 0x62, 0x28, 0x22, 0x84, 0x1b, 0xee, 0x76, 0xe2, 0x8b, 0x20, 0xaa,
+    0xb8, 0x22, 0x8b, 0xff, 0x09, 0x04, 0x23, 0x8c, 0x29, 0xca, 0x38, 0x23, 0x8d, 0xe9, 0xd9, 0x78,
+    0xe3, 0x89, 0x39, 0xea, 0xb8, 0x63, 0x84, 0xe8, 0x0d, 0xf4, 0xa3, 0x87, 0x41, 0x0a, 0x39, 0x24,
+    0x91, 0xd9, 0x11, 0x74, 0x64, 0x85, 0x49, 0x2a, 0xb9, 0x24, 0x93, 0xca, 0x15, 0xf4, 0x24, 0x81,
+    0x51, 0x86, 0x38, 0xe5, 0x8c, 0xd1, 0x19, 0x74, 0xe5, 0x7e, 0x59, 0x6a, 0xb9, 0xe5, 0x88, 0xc9,
+    0x79, 0xf9, 0x65, 0x8c, 0x51, 0x8e, 0xb9, 0xa3, 0x70, 0x07, 0x7d, 0x19, 0xa6, 0x94, 0x6a, 0xfa,
+    0xf7, 0xd0, 0x93, 0x6f, 0xc2, 0x19, 0x27, 0x44, 0x74, 0xd6, 0x29, 0x66, 0x9c, 0x19, 0x46, 0xf4,
+    0xa3, 0x9e, 0x76, 0x6e, 0x99, 0xd1, 0x8d, 0x80, 0xee, 0xc9, 0xa7, 0x46, 0x38, 0x16, 0xfa, 0x20,
+    0x9f, 0x15, 0x6c, 0xf4, 0xa2, 0xa2, 0x86, 0x8e, 0x39, 0x12, 0x8a, 0x90, 0x2e, 0x2a, 0xa9, 0x4a,
+    0x16, 0x56, 0x1a, 0xe9, 0x92, 0x40, 0x41, 0xa9, 0xa9, 0xa5, 0x43, 0x02, 0x65, 0x24, 0x98, 0x9f,
+    0x0a, 0x2a, 0xaa, 0x93, 0xf3, 0x7d, 0xba, 0x69, 0x9f, 0xa7, 0x1a, 0xa4, 0xea, 0xaa, 0x8d, 0xb6,
+    0x16, 0xea, 0xd0, 0xab, 0xa0, 0xc6, 0x2a, 0x2b, 0x44, 0xa5, 0x42, 0x78, 0xab, 0x48, 0x95, 0xf6,
+    0xb7, 0x2b, 0x50, 0x75, 0xde, 0x1a, 0x10, 0x00, 0x21, 0xf9, 0x04, 0x04, 0x05, 0x00, 0x00, 0x00,
+    0x2c, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x08, 0xff, 0x00, 0xff, 0x09, 0x1c,
+    0x48, 0xb0, 0xa0, 0xc1, 0x82, 0x0c, 0x12, 0x2a, 0x5c, 0x98, 0xf0, 0xa0, 0xc3, 0x87, 0x10, 0x23,
+    0x0e, 0x64, 0x48, 0xb1, 0xe2, 0x83, 0x07, 0x12, 0x33, 0x6a, 0x9c, 0x58, 0xb1, 0xe3, 0xc2, 0x8b,
+    0x17, 0x37, 0x8a, 0x34, 0xe8, 0xb1, 0xe4, 0x47, 0x90, 0x20, 0x47, 0x8a, 0x34, 0xc9, 0x12, 0xa5,
+    0x4b, 0x95, 0x12, 0x13, 0xc8, 0x64, 0x59, 0xd2, 0xa5, 0x4d, 0x98, 0x0e, 0x65, 0xce, 0xa4, 0xd9,
+    0xd1, 0xe6, 0x4d, 0x9c, 0x03, 0x75, 0x0a, 0xe5, 0x69, 0xd1, 0xe7, 0x4f, 0x98, 0x42, 0x87, 0x12,
+    0x3d, 0x69, 0xf4, 0xa8, 0xc8, 0xa4, 0x49, 0x97, 0x2a, 0x6c, 0x6a, 0x74, 0x24, 0x54, 0xa8, 0x52,
+    0x19, 0x50, 0xad, 0xaa, 0xf1, 0x2a, 0xd6, 0xa5, 0x5b, 0x9b, 0x76, 0xf5, 0x1a, 0x95, 0x68, 0x58,
+    0xae, 0x11, 0xc9, 0x7e, 0xe5, 0x79, 0x16, 0x6d, 0x4e, 0xb5, 0x6b, 0x5b, 0xb6, 0xf5, 0x09, 0x11,
+    0x6e, 0xdc, 0x9a, 0x73, 0xe9, 0xbe, 0xb5, 0x5b, 0xd6, 0x64, 0x5e, 0x9f, 0x12, 0x0e, 0xf2, 0xf5,
+    0x2a, 0xf7, 0xef, 0x45, 0x09, 0x88, 0x03, 0x17, 0x1c, 0x7c, 0xb5, 0x70, 0xde, 0xc4, 0x89, 0x0d,
+    0x32, 0x6e, 0xec, 0xd1, 0xf0, 0x03, 0xc8, 0x91, 0x09, 0x4e, 0xa6, 0xdc, 0xf3, 0x31, 0x66, 0xc8,
+    0x9a, 0x37, 0xdf, 0x65, 0x1a, 0xf6, 0xf3, 0xe7, 0xa0, 0xa2, 0x39, 0x33, 0x3c, 0x6b, 0xba, 0xb5,
+    0xc0, 0xd4, 0xaa, 0xa7, 0x96, 0x6e, 0x6d, 0x5a, 0xa0, 0x81, 0xdb, 0xb0, 0x95, 0x92, 0x06, 0x4c,
+    0xdb, 0xf5, 0xbf, 0xdb, 0xc0, 0x71, 0xa7, 0xa6, 0xd8, 0xb4, 0x77, 0xef, 0xdf, 0xc1, 0x93, 0x1b,
+    0x10, 0xbd, 0x1b, 0xa5, 0x71, 0xe3, 0xca, 0xa3, 0x0b, 0xb7, 0xdb, 0xfc, 0xf2, 0x73, 0xe8, 0xd2,
+    0xb3, 0x2f, 0x57, 0x2b, 0x1b, 0xe4, 0xf5, 0xeb, 0xda, 0xc3, 0x4f, 0xff, 0x2f, 0xeb, 0xfd, 0x3b,
+    0x78, 0xf1, 0xe8, 0xa3, 0x96, 0x37, 0xff, 0x1c, 0xbd, 0x7b, 0xe0, 0x32, 0xad, 0xb3, 0x3f, 0xff,
+    0xde, 0xfd, 0x80, 0x0a, 0x15, 0xe6, 0xd3, 0xaf, 0xaf, 0x7d, 0x80, 0x7f, 0x00, 0xf8, 0x05, 0xa8,
+    0x5f, 0x6b, 0xfc, 0x85, 0xe7, 0xdf, 0x00, 0x00, 0x00, 0x18, 0xe0, 0x82, 0x03, 0x42, 0x56, 0xa0,
+    0x74, 0x07, 0xfe, 0x97, 0xe0, 0x82, 0x14, 0xe2, 0x37, 0xe0, 0x83, 0xc9, 0x45, 0x78, 0x60, 0x82,
+    0x13, 0x56, 0xe8, 0xa1, 0x79, 0x18, 0xde, 0xa6, 0x61, 0x84, 0x1c, 0x2a, 0xe8, 0xe1, 0x89, 0xf9,
+    0x1d, 0x87, 0xe1, 0x88, 0x1b, 0x96, 0x68, 0x22, 0x8a, 0x27, 0xd6, 0x86, 0x5c, 0x7d, 0x2c, 0x92,
+    0xe8, 0x22, 0x8c, 0x38, 0x0a, 0x88, 0x98, 0x6d, 0xef, 0xd5, 0xa8, 0xa1, 0x8b, 0x1d, 0xe6, 0x98,
+    0x23, 0x8f, 0xe8, 0xf9, 0x68, 0x23, 0x90, 0x42, 0x0a, 0x39, 0x90, 0x78, 0x46, 0xfe, 0x08, 0x64,
+    0x90, 0x49, 0x7a, 0x48, 0x50, 0x7f, 0x4d, 0x3a, 0xf9, 0xe4, 0x8b, 0x51, 0x2e, 0x58, 0x50, 0x74,
+    0x55, 0xb2, 0x78, 0x25, 0x94, 0x59, 0xe2, 0x67, 0x90, 0x72, 0x5d, 0x8e, 0xf8, 0x25, 0x87, 0x61,
+    0x6a, 0xb9, 0x25, 0x70, 0x65, 0x7a, 0x79, 0x26, 0x96, 0x59, 0x1e, 0x64, 0x40, 0x9b, 0x35, 0xbe,
+    0x09, 0x66, 0x92, 0x0f, 0xd1, 0xe9, 0xa6, 0x9d, 0x61, 0x42, 0xa4, 0xa7, 0x95, 0x7c, 0xc6, 0xe9,
+    0xe7, 0x9f, 0x12, 0xda, 0x79, 0x27, 0x8a, 0x19, 0x11, 0x8a, 0xa0, 0xa1, 0x87, 0x4a, 0x99, 0x28,
+    0xa1, 0x8c, 0xa2, 0x39, 0xa4, 0x46, 0x7f, 0x46, 0x2a, 0x29, 0x8c, 0x23, 0xe9, 0x69, 0xe9, 0xa5,
+    0x8e, 0x66, 0xda, 0xe6, 0xa6, 0x9c, 0xaa, 0x09, 0x53, 0x99, 0xa0, 0x86, 0x2a, 0x26, 0x50, 0x02,
+    0x55, 0x59, 0x2a, 0xa7, 0xa8, 0x16, 0xd4, 0xe4, 0xaa, 0x41, 0xb6, 0x1b, 0x7a, 0x90, 0x8f, 0xb0,
+    0x26, 0x28, 0x6b, 0x9e, 0x66, 0xd6, 0x7a, 0xab, 0x44, 0x47, 0x6e, 0xba, 0xab, 0x48, 0x85, 0x46,
+    0xfa, 0x2b, 0x50, 0x76, 0xee, 0x1a, 0x10, 0x00, 0x21, 0xf9, 0x04, 0x04, 0x05, 0x00, 0x00, 0x00,
+    0x2c, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x08, 0xff, 0x00, 0xff, 0x09, 0x1c,
+    0x48, 0xb0, 0xa0, 0xc1, 0x82, 0x0c, 0x12, 0x2a, 0x7c, 0xc0, 0xb0, 0xe1, 0xc1, 0x87, 0x10, 0x23,
+    0x4a, 0x1c, 0xa8, 0xb0, 0xe2, 0xc2, 0x86, 0x18, 0x19, 0x4e, 0xdc, 0xc8, 0x91, 0xa2, 0xc5, 0x8f,
+    0x19, 0x43, 0x3e, 0xe8, 0x48, 0xd2, 0xe0, 0xc7, 0x93, 0x09, 0x45, 0xaa, 0x2c, 0x49, 0x12, 0x25,
+    0x4a, 0x95, 0x2b, 0x59, 0x4a, 0x74, 0xe9, 0x12, 0x26, 0x4c, 0x99, 0x0f, 0x69, 0xd6, 0xb4, 0x19,
+    0x13, 0xa7, 0x40, 0x9d, 0x34, 0x79, 0xda, 0xf4, 0x09, 0x34, 0xa8, 0xd0, 0x9b, 0x2c, 0x8b, 0x1a,
+    0x3d, 0x2a, 0x52, 0x42, 0xc9, 0x04, 0x09, 0x94, 0xbe, 0x64, 0x1a, 0x52, 0x82, 0xd5, 0x8e, 0x50,
+    0xa1, 0x4a, 0x05, 0x49, 0x15, 0xa3, 0xd5, 0xaf, 0x1c, 0xb3, 0x6a, 0xdd, 0x7a, 0xb1, 0xeb, 0x83,
+    0xaf, 0x60, 0x27, 0x8a, 0xcd, 0x4a, 0x36, 0xa5, 0x59, 0xb4, 0x68, 0x25, 0xae, 0x15, 0xdb, 0xf6,
+    0x2d, 0xdc, 0xb8, 0x10, 0xe7, 0xd2, 0xdd, 0xda, 0xf5, 0x2e, 0xdc, 0xbc, 0x7a, 0xf7, 0x2a, 0xa5,
+    0xea, 0xf7, 0xee, 0xc1, 0xc0, 0x73, 0xa5, 0x32, 0x2d, 0xec, 0xd7, 0x20, 0xe2, 0xc4, 0x45, 0x8f,
+    0x32, 0x6e, 0x5c, 0xf0, 0x31, 0x64, 0x9d, 0x42, 0x27, 0x53, 0x1e, 0x68, 0x59, 0x2f, 0x50, 0x9e,
+    0x9a, 0x0b, 0x13, 0xec, 0xec, 0x79, 0x69, 0xd3, 0xd0, 0x9b, 0x49, 0x07, 0x36, 0x9d, 0x11, 0x35,
+    0x63, 0x81, 0xaa, 0x57, 0x4f, 0xad, 0xea, 0x5a, 0xf4, 0xbf, 0xd8, 0xb2, 0xb9, 0xb6, 0xae, 0x6d,
+    0x1b, 0x77, 0xee, 0x8a, 0xb4, 0x79, 0x37, 0xf6, 0x8d, 0x58, 0x37, 0x43, 0xe1, 0x93, 0x89, 0x17,
+    0x07, 0xde, 0x10, 0x79, 0x72, 0xe5, 0xbf, 0x9b, 0x3b, 0x67, 0x0c, 0x7d, 0x39, 0x83, 0xe3, 0xd3,
+    0xa9, 0x57, 0x97, 0x7d, 0x36, 0xbb, 0xf6, 0xed, 0x9e, 0xbd, 0x4f, 0xff, 0x36, 0x40, 0xbe, 0xbc,
+    0xf9, 0xf3, 0xe8, 0xd3, 0x9b, 0x07, 0x50, 0xa1, 0xbd, 0xfb, 0xf7, 0xf0, 0xe3, 0xcb, 0x77, 0xaf,
+    0xbe, 0xbe, 0x7d, 0xf3, 0x03, 0x00, 0xb0, 0x9f, 0xcf, 0xbf, 0x7f, 0xfb, 0xfb, 0x00, 0xa6, 0x37,
+    0x40, 0x7e, 0xfa, 0xf9, 0x67, 0x60, 0x7c, 0x01, 0x26, 0x48, 0xde, 0x80, 0x04, 0x16, 0x78, 0xe0,
+    0x83, 0x0a, 0x06, 0xc8, 0x60, 0x83, 0x0e, 0x3e, 0xe8, 0x5f, 0x84, 0xf7, 0x4d, 0x48, 0x61, 0x85,
+    0x16, 0xce, 0xf7, 0x0f, 0x86, 0xea, 0x69, 0xb8, 0x21, 0x87, 0x1d, 0xbe, 0x27, 0x10, 0x88, 0xe8,
+    0x89, 0x38, 0x22, 0x89, 0x25, 0x56, 0x70, 0x22, 0x8a, 0xe5, 0xa9, 0xb8, 0x22, 0x8b, 0x1d, 0xbe,
+    0x08, 0xa3, 0x8c, 0x33, 0xd2, 0xf8, 0xe0, 0x40, 0x37, 0xe2, 0xa8, 0xdf, 0x8f, 0x40, 0xea, 0xe8,
+    0x1f, 0x41, 0x28, 0xe2, 0x38, 0x60, 0x90, 0x48, 0xee, 0x57, 0x23, 0x91, 0x11, 0x1a, 0x79, 0x64,
+    0x92, 0x41, 0x2e, 0xc9, 0x64, 0x82, 0x4e, 0x3e, 0x09, 0x25, 0x90, 0x16, 0x1a, 0xa4, 0x60, 0x95,
+    0x56, 0x5e, 0xf9, 0xe3, 0x8e, 0x5a, 0x02, 0xc8, 0x65, 0x97, 0x5e, 0x0a, 0xe9, 0x1e, 0x44, 0x19,
+    0x8e, 0x99, 0x23, 0x94, 0xfd, 0x45, 0x64, 0x9f, 0x9a, 0x64, 0x96, 0x29, 0xa4, 0x44, 0x21, 0xc2,
+    0xb9, 0xe6, 0x95, 0xf2, 0x6d, 0x94, 0xa2, 0x9d, 0x77, 0xe2, 0x69, 0xa2, 0x9e, 0xf8, 0xf1, 0xd9,
+    0xa7, 0x9f, 0xed, 0x75, 0x14, 0xa3, 0xa0, 0x83, 0xfa, 0x59, 0x92, 0x01, 0x88, 0xc6, 0x29, 0x67,
+    0x90, 0x32, 0x35, 0x9a, 0x28, 0x94, 0x3e, 0x35, 0xfa, 0x28, 0xa5, 0x3e, 0x09, 0x24, 0xe8, 0xa5,
+    0x90, 0x66, 0x4a, 0x10, 0x9f, 0x9c, 0xfe, 0xe8, 0xe9, 0x41, 0x70, 0x86, 0x3a, 0x2a, 0x44, 0x6a,
+    0x72, 0x7a, 0xea, 0x44, 0x55, 0xca, 0xb9, 0x2a, 0x49, 0x46, 0x7a, 0x08, 0xf9, 0x6a, 0xa5, 0x1a,
+    0x22, 0xb9, 0x6a, 0x40, 0x00, 0x21, 0xf9, 0x04, 0x04, 0x05, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00,
+    0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x08, 0xff, 0x00, 0xff, 0x09, 0x1c, 0x48, 0xb0, 0xa0,
+    0xc1, 0x82, 0x0f, 0x12, 0x2a, 0x5c, 0x98, 0xf0, 0xa0, 0xc3, 0x87, 0x10, 0x23, 0x0e, 0x64, 0xc0,
+    0x80, 0xa1, 0xc5, 0x8b, 0x12, 0x33, 0x6a, 0x9c, 0x48, 0xb1, 0xe2, 0xc5, 0x8f, 0x0b, 0x37, 0x8a,
+    0x34, 0xd8, 0xb1, 0x24, 0xc8, 0x93, 0x21, 0x47, 0x6e, 0x2c, 0xc9, 0x12, 0xa5, 0x4b, 0x95, 0x12,
+    0x59, 0xca, 0x74, 0x79, 0x52, 0x82, 0x4d, 0x98, 0x0e, 0x65, 0xce, 0xa4, 0xf9, 0xd1, 0xe6, 0x4d,
+    0x9c, 0x1c, 0x75, 0xb6, 0xe4, 0x69, 0xd1, 0xa7, 0x51, 0xa0, 0x42, 0x85, 0x12, 0x65, 0x68, 0xf4,
+    0xa8, 0xca, 0xa4, 0x4a, 0x97, 0x26, 0x6c, 0xda, 0x74, 0x24, 0xd4, 0xa8, 0x4b, 0xa9, 0x52, 0x5d,
+    0x79, 0x15, 0x2b, 0x4f, 0xad, 0x5b, 0x33, 0x76, 0xf5, 0xea, 0x12, 0x6c, 0xd8, 0x88, 0x63, 0xc9,
+    0xa2, 0x34, 0x7b, 0x36, 0x67, 0x5a, 0x9d, 0x44, 0xd9, 0x6a, 0x85, 0xf8, 0x56, 0x6d, 0x4f, 0xb9,
+    0x55, 0x1d, 0x26, 0xa8, 0x0b, 0xb7, 0x2c, 0xde, 0xb6, 0x03, 0x13, 0x08, 0xde, 0xcb, 0xb7, 0xa3,
+    0xdf, 0xbf, 0x80, 0xff, 0x0d, 0x1e, 0x5c, 0xd8, 0x63, 0x4d, 0xc4, 0x89, 0x17, 0x33, 0x2e, 0xfc,
+    0x18, 0x72, 0xde, 0xc0, 0x92, 0x17, 0xf3, 0xad, 0x6c, 0xd9, 0xa9, 0xc0, 0xcc, 0x99, 0xdf, 0x82,
+    0xec, 0x3c, 0xf7, 0x33, 0x68, 0xd0, 0x63, 0xef, 0x92, 0x0e, 0x7b, 0xfa, 0x74, 0xea, 0xa2, 0xab,
+    0x59, 0xb7, 0x76, 0x0d, 0x15, 0x76, 0x6c, 0x9b, 0x15, 0x72, 0x9b, 0x9e, 0x4d, 0xbb, 0xef, 0xc2,
+    0xd8, 0xb9, 0x83, 0xeb, 0xe6, 0xcd, 0x3b, 0xe9, 0xef, 0xce, 0xc2, 0x93, 0xe7, 0x26, 0x4e, 0xdc,
+    0xf7, 0x03, 0xc4, 0xca, 0xa3, 0x2f, 0x67, 0xde, 0xdc, 0xe4, 0x54, 0xb6, 0xd2, 0xb3, 0x4f, 0xa7,
+    0x5e, 0xdd, 0x23, 0x58, 0xed, 0xe0, 0xb7, 0x73, 0xff, 0x2f, 0x4e, 0xf1, 0xb9, 0xd1, 0xf0, 0xe8,
+    0x2b, 0x8c, 0xe7, 0xce, 0x00, 0x77, 0xfa, 0xf7, 0xeb, 0x99, 0x1b, 0x30, 0x00, 0xe0, 0xbd, 0xfd,
+    0xf8, 0xa7, 0xe7, 0xeb, 0x1f, 0x00, 0xa0, 0xbf, 0x7d, 0xf4, 0xf8, 0x2d, 0xa6, 0xdf, 0x80, 0x06,
+    0x0c, 0xc0, 0x9f, 0x7f, 0xff, 0x69, 0x87, 0x1f, 0x81, 0x0c, 0x1a, 0x78, 0x60, 0x7f, 0xf5, 0x25,
+    0x18, 0x1d, 0x77, 0x0c, 0x56, 0x58, 0xa0, 0x83, 0x10, 0x66, 0x28, 0x61, 0x72, 0xbc, 0x59, 0xe8,
+    0xe1, 0x85, 0x06, 0x66, 0x28, 0xe2, 0x86, 0xc3, 0x65, 0xf6, 0xe1, 0x87, 0x0e, 0x62, 0x28, 0x22,
+    0x84, 0x1b, 0xee, 0x76, 0xe2, 0x8b, 0x20, 0xaa, 0xb8, 0x22, 0x8b, 0xff, 0x09, 0x04, 0x23, 0x8c,
+    0x29, 0xca, 0x38, 0x23, 0x8d, 0xe9, 0xd9, 0x78, 0xe3, 0x89, 0x39, 0xea, 0xb8, 0x63, 0x84, 0xe8,
+    0x0d, 0xf4, 0xa3, 0x87, 0x41, 0x0a, 0x39, 0x24, 0x91, 0xd9, 0x11, 0x74, 0x64, 0x85, 0x49, 0x2a,
+    0xb9, 0x24, 0x93, 0xca, 0x15, 0xf4, 0x24, 0x81, 0x51, 0x86, 0x38, 0xe5, 0x8c, 0xd1, 0x19, 0x74,
+    0xe5, 0x7e, 0x59, 0x6a, 0xb9, 0xe5, 0x88, 0xc9, 0x79, 0xf9, 0x65, 0x8c, 0x51, 0x8e, 0xb9, 0xa3,
+    0x70, 0x07, 0x7d, 0x19, 0xa6, 0x94, 0x6a, 0xfa, 0xf7, 0xd0, 0x93, 0x6f, 0xc2, 0x19, 0x27, 0x44,
+    0x74, 0xd6, 0x29, 0x66, 0x9c, 0x19, 0x46, 0xf4, 0xa3, 0x9e, 0x76, 0x6e, 0x99, 0xd1, 0x8d, 0x80,
+    0xee, 0xc9, 0xa7, 0x46, 0x38, 0x16, 0xfa, 0x20, 0x9f, 0x00, 0x6c, 0xf4, 0xa2, 0xa2, 0x86, 0x8e,
+    0x39, 0x12, 0x8a, 0x90, 0x2e, 0x2a, 0xa9, 0x4a, 0x16, 0x56, 0x1a, 0xe9, 0x92, 0x40, 0x41, 0xa9,
+    0xa9, 0xa5, 0x43, 0x02, 0x65, 0x24, 0x98, 0x9f, 0x0a, 0x2a, 0xaa, 0x93, 0xf3, 0x7d, 0xba, 0x69,
+    0x9f, 0xa7, 0x1a, 0xa4, 0xea, 0xaa, 0x8d, 0xb6, 0x16, 0xea, 0xd0, 0xab, 0xa0, 0xc6, 0x2a, 0x2b,
+    0x44, 0xa5, 0x42, 0x78, 0xab, 0x48, 0x95, 0xf6, 0xb7, 0x2b, 0x50, 0x75, 0xde, 0x1a, 0x10, 0x00,
+    0x21, 0xf9, 0x04, 0x04, 0x05, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40,
+    0x00, 0x00, 0x08, 0xff, 0x00, 0xff, 0x09, 0x1c, 0x48, 0xb0, 0xa0, 0xc1, 0x82, 0x0f, 0x12, 0x2a,
+    0x5c, 0x98, 0xf0, 0xa0, 0xc3, 0x87, 0x10, 0x23, 0x0e, 0x64, 0x48, 0xb1, 0xa2, 0x04, 0x09, 0x12,
+    0x33, 0x6a, 0x9c, 0x58, 0xb1, 0xe3, 0xc2, 0x8b, 0x17, 0x37, 0x8a, 0x34, 0xe8, 0xb1, 0xe4, 0x47,
+    0x90, 0x20, 0x47, 0x8a, 0x34, 0xc9, 0x12, 0xa5, 0x4b, 0x95, 0x12, 0x19, 0xc8, 0x64, 0x59, 0xd2,
+    0xa5, 0x4d, 0x98, 0x0e, 0x65, 0xce, 0xa4, 0xd9, 0xd1, 0xe6, 0x4d, 0x9c, 0x03, 0x75, 0x0a, 0xe5,
+    0x69, 0xd1, 0xe7, 0x4f, 0x98, 0x42, 0x87, 0x12, 0x3d, 0x69, 0xf4, 0xa8, 0xc8, 0xa4, 0x49, 0x97,
+    0x2a, 0x6c, 0x6a, 0x74, 0x24, 0x54, 0xa8, 0x52, 0x1f, 0x50, 0xad, 0xaa, 0xf1, 0x2a, 0xd6, 0xa5,
+    0x5b, 0x9b, 0x76, 0xf5, 0x1a, 0x95, 0x68, 0x58, 0xae, 0x11, 0xc9, 0x7e, 0xe5, 0x79, 0x16, 0x6d,
+    0x4e, 0xb5, 0x6b, 0x5b, 0xb6, 0xf5, 0x09, 0x11, 0x6e, 0xdc, 0x9a, 0x73, 0xe9, 0xbe, 0xb5, 0x5b,
+    0xd6, 0x64, 0x5e, 0x9f, 0x15, 0x0e, 0xf2, 0xf5, 0x2a, 0xf7, 0xef, 0xc5, 0x0a, 0x88, 0x03, 0x17,
+    0x1c, 0x7c, 0xb5, 0x70, 0xde, 0xc4, 0x89, 0x0d, 0x32, 0x6e, 0xec, 0xd1, 0xb0, 0x04, 0xc8, 0x91,
+    0x09, 0x4e, 0xa6, 0xdc, 0xf3, 0x31, 0x66, 0xc8, 0x9a, 0x37, 0xdf, 0x65, 0x1a, 0xf6, 0xf3, 0xe7,
+    0xa0, 0xa2, 0x39, 0x33, 0x3c, 0x6b, 0xba, 0xb5, 0xc0, 0xd4, 0xaa, 0xa7, 0x96, 0x6e, 0x6d, 0x5a,
+    0x60, 0x82, 0xdb, 0xb0, 0x95, 0x92, 0x06, 0x4c, 0xdb, 0xf5, 0xbf, 0xdb, 0xc0, 0x71, 0xa7, 0xa6,
+    0xd8, 0xb4, 0x77, 0xef, 0xdf, 0xc1, 0x93, 0x27, 0x10, 0xbd, 0x1b, 0xa5, 0x71, 0xe3, 0xca, 0xa3,
+    0x0b, 0xb7, 0xdb, 0xfc, 0xf2, 0x73, 0xe8, 0xd2, 0xb3, 0x2f, 0x57, 0x2b, 0x1b, 0xe4, 0xf5, 0xeb,
+    0xda, 0xc3, 0x4f, 0xff, 0x2f, 0xeb, 0xfd, 0x3b, 0x78, 0xf1, 0xe8, 0xa3, 0x96, 0x37, 0xff, 0x1c,
+    0xbd, 0x7b, 0xe0, 0x32, 0xad, 0xb3, 0x3f, 0xff, 0xde, 0xbd, 0x01, 0x00, 0x00, 0xe6, 0xd3, 0xaf,
+    0xaf, 0xdd, 0x80, 0xff, 0x01, 0xf8, 0x05, 0xa8, 0x5f, 0x6b, 0xfc, 0x85, 0xe7, 0x9f, 0x01, 0x03,
+    0x00, 0x18, 0xe0, 0x82, 0x03, 0x42, 0x56, 0xa0, 0x74, 0x07, 0xfe, 0x97, 0xe0, 0x82, 0x14, 0xe2,
+    0x37, 0xe0, 0x83, 0xc9, 0x45, 0x78, 0x60, 0x82, 0x13, 0x56, 0xe8, 0xa1, 0x79, 0x18, 0xde, 0xa6,
+    0x61, 0x84, 0x1c, 0x2a, 0xe8, 0xe1, 0x89, 0xf9, 0x1d, 0x87, 0xe1, 0x88, 0x1b, 0x96, 0x68, 0x22,
+    0x8a, 0x27, 0xd6, 0x86, 0x5c, 0x7d, 0x2c, 0x92, 0xe8, 0x22, 0x8c, 0x38, 0x0a, 0x88, 0x98, 0x6d,
+    0xef, 0xd5, 0xa8, 0xa1, 0x8b, 0x1d, 0xe6, 0x98, 0x23, 0x8f, 0xe8, 0xf9, 0x68, 0x23, 0x90, 0x42,
+    0x0a, 0x39, 0x90, 0x78, 0x46, 0xfe, 0x08, 0x64, 0x90, 0x49, 0x7a, 0x48, 0x50, 0x7f, 0x4d, 0x3a,
+    0xf9, 0xe4, 0x8b, 0x51, 0x2e, 0x58, 0x50, 0x74, 0x55, 0xb2, 0x78, 0x25, 0x94, 0x59, 0xe2, 0x67,
+    0x90, 0x72, 0x5d, 0x8e, 0xf8, 0x25, 0x87, 0x61, 0x6a, 0xb9, 0x25, 0x70, 0x65, 0x7a, 0x79, 0x26,
+    0x96, 0x59, 0x1e, 0x94, 0x40, 0x9b, 0x35, 0xbe, 0x09, 0x66, 0x92, 0x0f, 0xd1, 0xe9, 0xa6, 0x9d,
+    0x61, 0x42, 0xa4, 0xa7, 0x95, 0x7c, 0xc6, 0xe9, 0xe7, 0x9f, 0x12, 0xda, 0x79, 0x27, 0x8a, 0x19,
+    0x11, 0x8a, 0xa0, 0xa1, 0x87, 0x4a, 0x99, 0x28, 0xa1, 0x8c, 0xa2, 0x39, 0xa4, 0x46, 0x7f, 0x46,
+    0x2a, 0x29, 0x8c, 0x23, 0xe9, 0x69, 0xe9, 0xa5, 0x8e, 0x66, 0xda, 0xe6, 0xa6, 0x9c, 0xaa, 0x09,
+    0x53, 0x99, 0xa0, 0x86, 0x2a, 0x26, 0x50, 0x02, 0x55, 0x59, 0x2a, 0xa7, 0xa8, 0x16, 0xd4, 0xe4,
+    0xaa, 0x41, 0xb6, 0x1b, 0x7a, 0x90, 0x8f, 0xb0, 0x26, 0x28, 0x6b, 0x9e, 0x66, 0xd6, 0x7a, 0xab,
+    0x44, 0x47, 0x6e, 0xba, 0xab, 0x48, 0x85, 0x46, 0xfa, 0x2b, 0x50, 0x76, 0xee, 0x1a, 0x10, 0x00,
+    0x3b,
+};
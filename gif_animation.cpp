@@ -0,0 +1,166 @@
+#include <cstring>
+
+#include "gif_animation.hpp"
+
+bool GifAnimation::create(SceneArena::Region &memory)
+{
+    if (!decoder.open(gif_data, gif_size))
+    {
+        printf("Invalid GIF\n");
+        return false;
+    }
+
+    frame_size = decoder.width() * decoder.height() * 4;
+    display_buf = memory.allocate<uint8_t>(frame_size);
+    decoder_memory = memory.allocate<uint8_t>(decoder.memory_size());
+    if (display_buf == nullptr || decoder_memory == nullptr)
+    {
+        printf("Failed to allocate the GIF buffers\n");
+        return false;
+    }
+    decoder.start(decoder_memory);
+
+    img_desc.header.magic = LV_IMAGE_HEADER_MAGIC;
+    img_desc.header.w = decoder.width();
+    img_desc.header.h = decoder.height();
+    img_desc.header.cf = LV_COLOR_FORMAT_ARGB8888; // The decoder's canvas layout
+    img_desc.header.stride = decoder.width() * 4;
+    img_desc.header.flags = LV_IMAGE_FLAGS_MODIFIABLE;
+    img_desc.header.reserved_2 = 0;
+    img_desc.data_size = frame_size;
+    img_desc.data = display_buf;
+
+    screen = lv_obj_create(NULL);
+    lv_obj_set_style_bg_color(screen, lv_color_black(), 0);
+    image = lv_image_create(screen);
+    lv_image_set_src(image, &img_desc);
+    lv_obj_center(image);
+
+    frames_shown = 0;
+    frames_decoded = 0;
+    frames_late = 0;
+    max_late_ms = 0;
+    decode_us_total = 0;
+    decode_us_max = 0;
+    decode_us_frame = 0;
+    step_us_max = 0;
+
+    if (decode_step(decoder.height()) != GIF_FRAME_READY)
+    {
+        printf("gif frame 0 corrupt\n");
+        return false;
+    }
+    step_us_max = 0; // The first frame is decoded in one go
+    shown_ms = lv_tick_get();
+    shown_delay_ms = 0;
+    show_ready(); // First frame, not counted as late
+    return true;
+}
+
+/**
+ * @brief Decodes up to max_rows rows of the next frame into the decoder's canvas.
+ *
+ * The GIF restarts at its end.
+ */
+GifStatus GifAnimation::decode_step(uint32_t max_rows)
+{
+    uint64_t start = time_us_64();
+    GifStatus status = decoder.decode(max_rows);
+    uint32_t us = static_cast<uint32_t>(time_us_64() - start);
+
+    decode_us_frame += us;
+    if (us > step_us_max)
+    {
+        step_us_max = us;
+    }
+    if (status == GIF_FRAME_READY)
+    {
+        decode_us_total += decode_us_frame;
+        frames_decoded++;
+        if (decode_us_frame > decode_us_max)
+        {
+            decode_us_max = decode_us_frame;
+        }
+        decode_us_frame = 0;
+        ready_delay_ms = decoder.delay_ms();
+        ready = true;
+    }
+    return status;
+}
+
+/**
+ * @brief Copies the ready frame to the displayed image.
+ */
+void GifAnimation::show_ready()
+{
+    uint32_t late = lv_tick_elaps(shown_ms) - shown_delay_ms;
+    if (frames_shown != 0)
+    {
+        if (late > max_late_ms)
+        {
+            max_late_ms = late;
+        }
+        if (late >= ready_delay_ms)
+        {
+            frames_late++;
+        }
+    }
+
+    // Keep the GIF's rhythm, unless a whole frame has been missed
+    shown_ms = late < ready_delay_ms ? shown_ms + shown_delay_ms : lv_tick_get();
+    shown_delay_ms = ready_delay_ms;
+
+    memcpy(display_buf, decoder.canvas(), frame_size);
+    lv_obj_invalidate(image);
+    frames_shown++;
+    ready = false;
+}
+
+void GifAnimation::update()
+{
+    if (!ready)
+    {
+        // Decode right after a frame has been shown, well before the next one is due
+        if (decode_step(GIF_DECODE_ROWS) == GIF_ERROR)
+        {
+            printf("gif frame %lu corrupt\n", (unsigned long)frames_shown);
+            decoder.start(decoder_memory);
+            decode_us_frame = 0;
+        }
+        return;
+    }
+
+    if (lv_tick_elaps(shown_ms) >= shown_delay_ms)
+    {
+        show_ready();
+    }
+}
+
+/**
+ * @brief No sleep while a frame is being decoded, otherwise until the ready frame is due.
+ */
+uint32_t GifAnimation::next_update_ms() const
+{
+    if (!ready)
+    {
+        return 0;
+    }
+    uint32_t elapsed = lv_tick_elaps(shown_ms);
+    return elapsed >= shown_delay_ms ? 0 : shown_delay_ms - elapsed;
+}
+
+void GifAnimation::destroy()
+{
+    if (frames_shown > 1)
+    {
+        printf("gif: %lu frames, decode avg %lu us, max %lu us, longest update() %lu us, %lu frames late, max %lu ms behind the GIF delays\n",
+               (unsigned long)frames_shown, (unsigned long)(decode_us_total / frames_decoded), (unsigned long)decode_us_max,
+               (unsigned long)step_us_max, (unsigned long)frames_late, (unsigned long)max_late_ms);
+    }
+
+    Scene::destroy();
+    image = nullptr;
+    display_buf = nullptr; // Memory is returned with the arena region
+    decoder_memory = nullptr;
+    ready = false;
+}
@@ -0,0 +1,82 @@
+#include <cstdio>
+
+#include "pico/stdlib.h"
+
+#include "lvgl/src/misc/lv_types.h"
+#include "lvgl/src/tick/lv_tick.h"
+#include "lvgl/src/widgets/image/lv_image.h"
+
+#include "gif_decoder.hpp"
+#include "scene.hpp"
+
+#define GIF_DECODE_ROWS 16 ///< Rows decoded per update(), bounds the time one update() takes
+
+/**
+ * @brief Plays an animated GIF from flash with the next frame decoded ahead of time.
+ *
+ * LVGL's gif widget decodes a whole frame inside lv_timer_handler() when it is due, so a slow
+ * frame delays the render. Here update() decodes the next frame into the decoder's canvas
+ * (the ready buffer) GIF_DECODE_ROWS rows at a time, starting right after the previous frame
+ * has been shown. When the frame is due, showing it is a copy of the ready buffer into the
+ * displayed image - decoding never happens between a frame becoming due and its render.
+ * The canvas, the LZW tables and the displayed image come from the scene arena, nothing
+ * from the LVGL heap besides the objects.
+ *
+ * Decode time and frames shown later than the GIF delays allow are reported when the
+ * scene is destroyed.
+ */
+class GifAnimation : public Scene
+{
+private:
+    const uint8_t *gif_data;
+    size_t gif_size;
+    GifDecoder decoder;
+    uint8_t *decoder_memory = nullptr;
+
+    uint width, height;
+    lv_obj_t *image = nullptr;
+    lv_image_dsc_t img_desc;
+    uint8_t *display_buf = nullptr; ///< Displayed ARGB8888 frame, the decoder's canvas is the ready buffer
+    size_t frame_size = 0;
+
+    bool ready = false;            ///< The next frame has been decoded
+    uint32_t ready_delay_ms = 0;   ///< Delay of the decoded frame
+    uint32_t shown_delay_ms = 0;   ///< Delay of the displayed frame
+    uint32_t shown_ms = 0;         ///< Time the displayed frame became due
+
+    uint32_t frames_shown = 0;
+    uint32_t frames_decoded = 0;
+    uint32_t frames_late = 0;      ///< Frames shown after the following frame would have been due
+    uint32_t max_late_ms = 0;
+    uint64_t decode_us_total = 0;
+    uint32_t decode_us_max = 0;   ///< Longest frame, summed over its update() calls
+    uint32_t decode_us_frame = 0; ///< Decode time of the frame being decoded so far
+    uint32_t step_us_max = 0;     ///< Longest single update() of decoding
+
+    GifStatus decode_step(uint32_t max_rows);
+    void show_ready();
+
+public:
+    GifAnimation(const uint8_t *gif_data, size_t gif_size, uint width = 64, uint height = 64)
+        : gif_data(gif_data), gif_size(gif_size), width(width), height(height)
+    {
+    }
+
+    const char *name() const override
+    {
+        return "gif";
+    }
+
+    bool create(SceneArena::Region &memory) override;
+
+    void update() override;
+
+    uint32_t next_update_ms() const override;
+
+    void show() override
+    {
+        lv_screen_load_anim(screen, LV_SCR_LOAD_ANIM_MOVE_LEFT, 1000, 0, false);
+    }
+
+    void destroy() override;
+};
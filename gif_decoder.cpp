@@ -0,0 +1,415 @@
+#include <cstring>
+
+#include "gif_decoder.hpp"
+
+static uint16_t read_u16(const uint8_t *p)
+{
+    return static_cast<uint16_t>(p[0] | (p[1] << 8));
+}
+
+bool GifDecoder::open(const uint8_t *gif, size_t size)
+{
+    canvas_buf = nullptr;
+    if (size < 13 || memcmp(gif, "GIF89a", 6) != 0)
+    {
+        return false;
+    }
+    uint8_t flags = gif[10];
+    if ((flags & 0x80) == 0) // No global colour table
+    {
+        return false;
+    }
+    gif_width = read_u16(gif + 6);
+    gif_height = read_u16(gif + 8);
+    size_t palette_bytes = 3u * (2u << (flags & 0x07));
+    if (gif_width == 0 || gif_height == 0 || 13 + palette_bytes > size)
+    {
+        return false;
+    }
+    end = gif + size;
+    global_palette = gif + 13;
+    global_palette_entries = 2u << (flags & 0x07);
+    background_index = gif[11];
+    anim_start = global_palette + palette_bytes;
+    return true;
+}
+
+size_t GifDecoder::memory_size() const
+{
+    return gif_width * gif_height * 4u + GIF_LZW_CODES * (sizeof(uint16_t) + 2) + gif_width;
+}
+
+void GifDecoder::start(uint8_t *memory)
+{
+    canvas_buf = memory;
+    prefix = reinterpret_cast<uint16_t *>(memory + gif_width * gif_height * 4u);
+    suffix = reinterpret_cast<uint8_t *>(prefix + GIF_LZW_CODES);
+    stack = suffix + GIF_LZW_CODES;
+    row = stack + GIF_LZW_CODES;
+
+    const uint8_t *background = background_index < global_palette_entries ? &global_palette[background_index * 3] : global_palette;
+    for (uint32_t i = 0; i < gif_width * gif_height; i++)
+    {
+        canvas_buf[i * 4 + 0] = background[2];
+        canvas_buf[i * 4 + 1] = background[1];
+        canvas_buf[i * 4 + 2] = background[0];
+        canvas_buf[i * 4 + 3] = 0xff;
+    }
+
+    p = anim_start;
+    disposal = 0;
+    transparency = false;
+    transparent_index = 0;
+    delay_cs = 0;
+    in_frame = false;
+    frame_decoded = false;
+    frames_in_loop = false;
+    palette = global_palette;
+    palette_entries = global_palette_entries;
+    fx = fy = fw = fh = 0;
+}
+
+/**
+ * @brief Skips data sub-blocks up to and including the block terminator.
+ *
+ * @return false if the data ends first.
+ */
+bool GifDecoder::skip_sub_blocks()
+{
+    while (p < end)
+    {
+        uint8_t size = *p++;
+        if (size == 0)
+        {
+            return true;
+        }
+        if (size > end - p)
+        {
+            return false;
+        }
+        p += size;
+    }
+    return false;
+}
+
+/**
+ * @brief Applies the disposal method of the previous frame, as gifdec does.
+ *
+ * The frame is already in the canvas, so only restoring the background changes anything.
+ * gifdec does not implement restoring the previous frame either.
+ */
+void GifDecoder::dispose()
+{
+    if (disposal != 2)
+    {
+        return;
+    }
+    const uint8_t *background = background_index < palette_entries ? &palette[background_index * 3] : palette;
+    uint8_t alpha = transparency ? 0x00 : 0xff;
+    for (uint32_t y = fy; y < static_cast<uint32_t>(fy + fh); y++)
+    {
+        uint8_t *dst = &canvas_buf[(y * gif_width + fx) * 4];
+        for (uint32_t x = 0; x < fw; x++, dst += 4)
+        {
+            dst[0] = background[2];
+            dst[1] = background[1];
+            dst[2] = background[0];
+            dst[3] = alpha;
+        }
+    }
+}
+
+/**
+ * @brief Reads the blocks up to the next image and sets up the LZW decoder for it.
+ *
+ * At the trailer the GIF starts over.
+ *
+ * @return GIF_FRAME_PENDING when the image data is next, GIF_FRAME_READY for an empty image.
+ */
+GifStatus GifDecoder::start_frame()
+{
+    if (frame_decoded)
+    {
+        dispose();
+        frame_decoded = false;
+    }
+
+    for (;;)
+    {
+        if (p >= end)
+        {
+            return GIF_ERROR;
+        }
+        uint8_t separator = *p++;
+        if (separator == ',')
+        {
+            break;
+        }
+        if (separator == ';')
+        {
+            if (!frames_in_loop) // No image at all
+            {
+                return GIF_ERROR;
+            }
+            frames_in_loop = false;
+            p = anim_start;
+            continue;
+        }
+        if (separator != '!' || p >= end)
+        {
+            return GIF_ERROR;
+        }
+        uint8_t label = *p++;
+        if (label == 0xf9 && end - p >= 6 && p[0] == 4) // Graphic control extension
+        {
+            disposal = (p[1] >> 2) & 0x03;
+            transparency = p[1] & 0x01;
+            delay_cs = read_u16(p + 2);
+            transparent_index = p[4];
+            p += 5;
+        }
+        if (!skip_sub_blocks())
+        {
+            return GIF_ERROR;
+        }
+    }
+
+    // Image descriptor
+    if (end - p < 10)
+    {
+        return GIF_ERROR;
+    }
+    fx = read_u16(p);
+    fy = read_u16(p + 2);
+    fw = read_u16(p + 4);
+    fh = read_u16(p + 6);
+    uint8_t flags = p[8];
+    p += 9;
+    if (fx + fw > gif_width || fy + fh > gif_height)
+    {
+        return GIF_ERROR;
+    }
+    palette = global_palette;
+    palette_entries = global_palette_entries;
+    if (flags & 0x80) // Local colour table
+    {
+        palette = p;
+        palette_entries = 2u << (flags & 0x07);
+        if (palette_entries * 3 >= static_cast<size_t>(end - p))
+        {
+            return GIF_ERROR;
+        }
+        p += palette_entries * 3;
+    }
+    interlaced = flags & 0x40;
+
+    min_code_size = *p++;
+    if (min_code_size < 1 || min_code_size > 11)
+    {
+        return GIF_ERROR;
+    }
+    clear_code = 1u << min_code_size;
+    code_size = min_code_size + 1;
+    next_code = clear_code + 2;
+    top_code = 1u << code_size;
+    previous_code = -1;
+    first_index = 0;
+    sub_block_left = 0;
+    data_ended = false;
+    bits = 0;
+    bit_count = 0;
+    stack_size = 0;
+    row_x = 0;
+    row_y = 0;
+    pass = 0;
+    rows_done = 0;
+    in_frame = true;
+    frames_in_loop = true;
+    return fw == 0 || fh == 0 ? end_frame() : GIF_FRAME_PENDING;
+}
+
+/**
+ * @brief Reads the next LZW code from the data sub-blocks, least significant bit first.
+ *
+ * @return The code, -1 at the block terminator, -2 if the data ends first.
+ */
+int32_t GifDecoder::read_code()
+{
+    while (bit_count < code_size)
+    {
+        if (sub_block_left == 0)
+        {
+            if (p >= end)
+            {
+                return -2;
+            }
+            sub_block_left = *p++;
+            if (sub_block_left == 0)
+            {
+                data_ended = true;
+                return -1;
+            }
+        }
+        if (p >= end)
+        {
+            return -2;
+        }
+        bits |= static_cast<uint32_t>(*p++) << bit_count;
+        bit_count += 8;
+        sub_block_left--;
+    }
+    int32_t code = bits & ((1u << code_size) - 1);
+    bits >>= code_size;
+    bit_count -= code_size;
+    return code;
+}
+
+/**
+ * @brief Renders the decoded row into the canvas and moves on to the next row.
+ */
+void GifDecoder::finish_row()
+{
+    uint8_t *dst = &canvas_buf[((fy + row_y) * gif_width + fx) * 4];
+    for (uint32_t x = 0; x < fw; x++, dst += 4)
+    {
+        uint8_t index = row[x];
+        if ((!transparency || index != transparent_index) && index < palette_entries)
+        {
+            const uint8_t *colour = &palette[index * 3];
+            dst[0] = colour[2];
+            dst[1] = colour[1];
+            dst[2] = colour[0];
+            dst[3] = 0xff;
+        }
+    }
+
+    row_x = 0;
+    rows_done++;
+    if (!interlaced)
+    {
+        row_y++;
+        return;
+    }
+    // Interlaced rows come in four passes: every 8th from 0, every 8th from 4, every 4th from 2, every 2nd from 1
+    row_y += pass < 2 ? 8 : pass == 2 ? 4 : 2;
+    while (row_y >= fh && pass < 3)
+    {
+        pass++;
+        row_y = 4 >> (pass - 1);
+    }
+}
+
+/**
+ * @brief Skips the rest of the image data.
+ */
+GifStatus GifDecoder::end_frame()
+{
+    in_frame = false;
+    frame_decoded = true;
+    if (!data_ended)
+    {
+        if (sub_block_left > end - p)
+        {
+            return GIF_ERROR;
+        }
+        p += sub_block_left;
+        sub_block_left = 0;
+        if (!skip_sub_blocks())
+        {
+            return GIF_ERROR;
+        }
+    }
+    return GIF_FRAME_READY;
+}
+
+GifStatus GifDecoder::decode(uint32_t max_rows)
+{
+    if (canvas_buf == nullptr)
+    {
+        return GIF_ERROR;
+    }
+    if (!in_frame)
+    {
+        GifStatus status = start_frame();
+        if (status != GIF_FRAME_PENDING)
+        {
+            return status;
+        }
+    }
+
+    uint32_t last_row = rows_done + (max_rows ? max_rows : 1);
+    for (;;)
+    {
+        // Output the current string, pausing at the end of a row when the budget is used up
+        while (stack_size != 0)
+        {
+            row[row_x++] = stack[--stack_size];
+            if (row_x == fw)
+            {
+                finish_row();
+                if (rows_done == fh)
+                {
+                    return end_frame(); // Surplus indices are dropped
+                }
+                if (rows_done >= last_row)
+                {
+                    return GIF_FRAME_PENDING;
+                }
+            }
+        }
+
+        int32_t code = read_code();
+        if (code == -2)
+        {
+            return GIF_ERROR;
+        }
+        if (code == -1 || code == clear_code + 1) // Data or stop code before the last row: the rest keeps the previous frame
+        {
+            return end_frame();
+        }
+        if (code == clear_code)
+        {
+            code_size = min_code_size + 1;
+            next_code = clear_code + 2;
+            top_code = 1u << code_size;
+            previous_code = -1;
+            continue;
+        }
+
+        uint32_t current = code;
+        if (code >= next_code)
+        {
+            // The string of the previous code plus its own first index, the code being added now
+            if (code != next_code || previous_code < 0)
+            {
+                return GIF_ERROR;
+            }
+            stack[stack_size++] = first_index;
+            current = previous_code;
+        }
+        while (current > clear_code + 1u)
+        {
+            if (stack_size >= GIF_LZW_CODES - 1)
+            {
+                return GIF_ERROR;
+            }
+            stack[stack_size++] = suffix[current];
+            current = prefix[current];
+        }
+        stack[stack_size++] = current;
+
+        if (previous_code >= 0 && next_code < GIF_LZW_CODES)
+        {
+            prefix[next_code] = previous_code;
+            suffix[next_code] = current;
+            next_code++;
+            if (next_code >= top_code && code_size < 12)
+            {
+                code_size++;
+                top_code <<= 1;
+            }
+        }
+        first_index = current;
+        previous_code = code;
+    }
+}
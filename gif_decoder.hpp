@@ -0,0 +1,133 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Incremental GIF decoder for animations stored in flash (see tools/hub75_gif.py).
+//
+// A frame is decoded a bounded number of rows at a time, so a caller can spread one frame over
+// several main loop iterations. All memory comes from the caller: the ARGB8888 canvas, one row of
+// colour indices and the LZW tables. The result is the same canvas gifdec (LV_USE_GIF) renders:
+// transparent pixels keep the previous frame, disposal 2 restores the background colour.
+
+#define GIF_LZW_CODES 4096 ///< 12-bit LZW codes
+#define GIF_DEFAULT_DELAY_MS 100 ///< Used for frames with a delay of 0, like web browsers do
+
+/// @brief Result of GifDecoder::decode()
+enum GifStatus
+{
+    GIF_FRAME_PENDING, ///< The row budget is used up, the frame is not complete yet
+    GIF_FRAME_READY,   ///< A frame is complete in the canvas
+    GIF_ERROR          ///< The GIF data is corrupt
+};
+
+/**
+ * @brief Decodes the frames of a GIF89a into a caller-provided canvas, a few rows per call.
+ *
+ * The GIF loops forever, whatever its NETSCAPE extension says.
+ */
+class GifDecoder
+{
+private:
+    const uint8_t *end = nullptr;
+    const uint8_t *anim_start = nullptr; ///< First block after the global colour table
+    const uint8_t *p = nullptr;          ///< Next byte to read
+    uint16_t gif_width = 0;
+    uint16_t gif_height = 0;
+    const uint8_t *global_palette = nullptr;
+    uint32_t global_palette_entries = 0;
+    uint8_t background_index = 0;
+
+    uint8_t *canvas_buf = nullptr; ///< ARGB8888 in LVGL's memory order (B, G, R, A)
+    uint8_t *row = nullptr;        ///< Colour indices of the row being decoded
+    uint16_t *prefix = nullptr;    ///< LZW table: code of the string without its last index
+    uint8_t *suffix = nullptr;     ///< LZW table: last index of the string
+    uint8_t *stack = nullptr;      ///< Indices of the current string, last one first
+    uint32_t stack_size = 0;
+
+    // Graphic control extension, kept until the next one like gifdec does
+    uint8_t disposal = 0;
+    bool transparency = false;
+    uint8_t transparent_index = 0;
+    uint16_t delay_cs = 0;
+
+    // Current frame
+    bool in_frame = false;
+    bool frame_decoded = false; ///< A frame has been decoded, its disposal is due before the next
+    bool frames_in_loop = false;
+    uint16_t fx = 0, fy = 0, fw = 0, fh = 0;
+    const uint8_t *palette = nullptr;
+    uint32_t palette_entries = 0;
+    bool interlaced = false;
+    uint8_t pass = 0;
+    uint16_t row_y = 0;   ///< Frame row the decoded row belongs to
+    uint16_t row_x = 0;   ///< Indices in row
+    uint16_t rows_done = 0;
+
+    // LZW state
+    uint16_t clear_code = 0;
+    uint16_t next_code = 0;
+    uint16_t top_code = 0;
+    uint8_t min_code_size = 0;
+    uint8_t code_size = 0;
+    int32_t previous_code = -1;
+    uint8_t first_index = 0;
+    uint8_t sub_block_left = 0;
+    bool data_ended = false; ///< The block terminator of the image data has been read
+    uint32_t bits = 0;
+    uint8_t bit_count = 0;
+
+    bool skip_sub_blocks();
+    GifStatus start_frame();
+    GifStatus end_frame();
+    int32_t read_code();
+    void finish_row();
+    void dispose();
+
+public:
+    /**
+     * @brief Validates the GIF header.
+     *
+     * @return false if the data is not a GIF89a with a global colour table.
+     */
+    bool open(const uint8_t *data, size_t size);
+
+    /// @brief Bytes start() needs for the canvas, the row and the LZW tables.
+    size_t memory_size() const;
+
+    /**
+     * @brief Fills the canvas with the background colour and rewinds to the first frame.
+     *
+     * @param memory memory_size() bytes, 2-byte aligned, owned by the caller until the decoder is no longer used.
+     */
+    void start(uint8_t *memory);
+
+    /**
+     * @brief Continues decoding the current frame, starting the next one if there is none.
+     *
+     * @param max_rows Rows to decode at most before returning.
+     */
+    GifStatus decode(uint32_t max_rows);
+
+    /// @brief Canvas of width() * height() ARGB8888 pixels, complete after GIF_FRAME_READY.
+    const uint8_t *canvas() const
+    {
+        return canvas_buf;
+    }
+
+    uint16_t width() const
+    {
+        return gif_width;
+    }
+
+    uint16_t height() const
+    {
+        return gif_height;
+    }
+
+    /// @brief Display time of the last frame completed.
+    uint32_t delay_ms() const
+    {
+        return delay_cs ? delay_cs * 10u : GIF_DEFAULT_DELAY_MS;
+    }
+};
@@ -0,0 +1,339 @@
+#include <cstdio>
+#include <cstring>
+
+#include "lvgl/src/stdlib/lv_mem.h"
+#include "lvgl/src/tick/lv_tick.h"
+
+#include "heap_stats.hpp"
+
+static_assert(HEAP_STATS_SITES >= 2 && HEAP_STATS_SITES <= 64 && (HEAP_STATS_SITES & (HEAP_STATS_SITES - 1)) == 0, "site table is a power of two, picked sites are tracked in a 64-bit mask");
+
+static HeapSite sites[HEAP_STATS_SITES]; ///< Open addressing table, keyed by caller
+static HeapSummary counters;             ///< Only the counter fields are kept up to date, the heap state is filled in on request
+static uint32_t frame_allocs = 0;        ///< Allocations in the current frame
+
+static_assert((HEAP_STATS_BLOCKS & (HEAP_STATS_BLOCKS - 1)) == 0, "block table is a power of two");
+
+/// @brief Live block and the index of its allocating site, in an open addressing table with linear probing
+struct HeapBlock
+{
+    uintptr_t block; ///< 0: empty slot
+    uint8_t site;
+};
+static HeapBlock blocks[HEAP_STATS_BLOCKS];
+
+static HeapSample history[HEAP_STATS_HISTORY];
+static uint32_t history_count = 0; ///< Samples taken, the ring holds the last HEAP_STATS_HISTORY
+static uint32_t sample_frames = 0; ///< Frames since the previous sample
+static uint32_t sample_allocs = 0; ///< Allocations since the previous sample
+static uint32_t last_sample_ms = 0;
+
+/**
+ * @brief Finds or inserts the table entry of a call site.
+ *
+ * @return nullptr if the table is full.
+ */
+static HeapSite *find_site(void *caller)
+{
+    uintptr_t key = reinterpret_cast<uintptr_t>(caller);
+    // Fibonacci hashing on the top bits, code addresses are at least 2-byte aligned
+    uint32_t slot = static_cast<uint32_t>(key >> 1) * 2654435761u >> (32 - __builtin_ctz(HEAP_STATS_SITES));
+    for (uint32_t probe = 0; probe < HEAP_STATS_SITES; probe++)
+    {
+        HeapSite &site = sites[(slot + probe) & (HEAP_STATS_SITES - 1)];
+        if (site.caller == key)
+        {
+            return &site;
+        }
+        if (site.caller == 0)
+        {
+            site.caller = key;
+            return &site;
+        }
+    }
+    return nullptr;
+}
+
+static uint32_t block_slot(uintptr_t key)
+{
+    // Heap blocks are at least 4-byte aligned
+    return static_cast<uint32_t>(key >> 2) * 2654435761u >> (32 - __builtin_ctz(HEAP_STATS_BLOCKS));
+}
+
+/**
+ * @brief Remembers the allocating site of a block, if the table has room.
+ */
+static void insert_block(void *p, const HeapSite *site)
+{
+    uintptr_t key = reinterpret_cast<uintptr_t>(p);
+    uint32_t slot = block_slot(key);
+    for (uint32_t probe = 0; probe < HEAP_STATS_BLOCKS; probe++)
+    {
+        HeapBlock &entry = blocks[(slot + probe) & (HEAP_STATS_BLOCKS - 1)];
+        if (entry.block == 0 || entry.block == key)
+        {
+            entry.block = key;
+            entry.site = static_cast<uint8_t>(site - sites);
+            return;
+        }
+    }
+}
+
+/**
+ * @brief Removes a block from the table.
+ *
+ * Entries behind it in its probe sequence move up, so lookups need no tombstones.
+ *
+ * @return The site which allocated the block, nullptr if it is not in the table.
+ */
+static HeapSite *remove_block(void *p)
+{
+    uintptr_t key = reinterpret_cast<uintptr_t>(p);
+    uint32_t mask = HEAP_STATS_BLOCKS - 1;
+    uint32_t hole = block_slot(key);
+    for (uint32_t probe = 0;; probe++, hole = (hole + 1) & mask)
+    {
+        if (probe == HEAP_STATS_BLOCKS || blocks[hole].block == 0)
+        {
+            return nullptr;
+        }
+        if (blocks[hole].block == key)
+        {
+            break;
+        }
+    }
+    HeapSite *site = &sites[blocks[hole].site];
+
+    for (uint32_t next = (hole + 1) & mask; blocks[next].block != 0; next = (next + 1) & mask)
+    {
+        // An entry may fill the hole if its home slot is not cyclically in (hole, next]
+        uint32_t home = block_slot(blocks[next].block);
+        if (((next - home) & mask) >= ((next - hole) & mask))
+        {
+            blocks[hole] = blocks[next];
+            hole = next;
+        }
+    }
+    blocks[hole].block = 0;
+    return site;
+}
+
+/**
+ * @brief Credits the free of a block to the site which allocated it.
+ */
+static void count_free(void *p)
+{
+    HeapSite *site = remove_block(p);
+    if (site != nullptr)
+    {
+        site->frees++;
+    }
+    else
+    {
+        counters.untracked_frees++;
+    }
+}
+
+#if LV_USE_MEM_HOOK
+/**
+ * @brief LVGL allocation hook.
+ *
+ * Runs inside lv_malloc() and friends, so it must not allocate or print.
+ */
+static void on_heap_operation(lv_mem_hook_op_t op, void *p, void *old_p, size_t size, void *caller)
+{
+    if (op != LV_MEM_HOOK_FREE && p == nullptr)
+    {
+        counters.failures++;
+        return;
+    }
+
+    switch (op)
+    {
+    case LV_MEM_HOOK_ALLOC:
+    case LV_MEM_HOOK_REALLOC:
+    {
+        (op == LV_MEM_HOOK_ALLOC ? counters.allocs : counters.reallocs)++;
+        frame_allocs++;
+        // A reallocation frees the old block - credited to its own site - and allocates a new one here
+        if (old_p != nullptr)
+        {
+            count_free(old_p);
+        }
+        HeapSite *site = find_site(caller);
+        if (site == nullptr)
+        {
+            counters.other_allocs++;
+            return;
+        }
+        site->allocs++;
+        site->bytes += size;
+        insert_block(p, site);
+        break;
+    }
+    case LV_MEM_HOOK_FREE:
+        if (p != nullptr)
+        {
+            counters.frees++;
+            count_free(p);
+        }
+        break;
+    }
+}
+#endif
+
+/// @brief Records the current heap state in the sample ring.
+static void take_sample(uint32_t now_ms)
+{
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+
+    HeapSample &sample = history[history_count++ % HEAP_STATS_HISTORY];
+    sample.time_ms = now_ms;
+    sample.used = mon.total_size - mon.free_size;
+    sample.biggest_free = mon.free_biggest_size;
+    sample.frag_pct = mon.frag_pct;
+    sample.allocs_per_frame = sample_frames ? (sample_allocs + sample_frames / 2) / sample_frames : 0;
+
+    if (history_count == 1 || sample.biggest_free < counters.biggest_free_min)
+    {
+        counters.biggest_free_min = sample.biggest_free;
+    }
+    if (sample.frag_pct > counters.frag_pct_max)
+    {
+        counters.frag_pct_max = sample.frag_pct;
+    }
+
+    sample_frames = 0;
+    sample_allocs = 0;
+    last_sample_ms = now_ms;
+}
+
+void heap_stats_start()
+{
+    heap_stats_reset();
+#if LV_USE_MEM_HOOK
+    lv_mem_set_hook(on_heap_operation);
+#endif
+}
+
+void heap_stats_frame()
+{
+    counters.frames++;
+    counters.frame_allocs = frame_allocs;
+    if (frame_allocs > counters.frame_allocs_max)
+    {
+        counters.frame_allocs_max = frame_allocs;
+    }
+    sample_frames++;
+    sample_allocs += frame_allocs;
+    frame_allocs = 0;
+
+    uint32_t now_ms = lv_tick_get();
+    if (history_count == 0 || now_ms - last_sample_ms >= HEAP_STATS_SAMPLE_MS)
+    {
+        take_sample(now_ms);
+    }
+}
+
+void heap_stats_reset()
+{
+    memset(sites, 0, sizeof(sites));
+    memset(blocks, 0, sizeof(blocks));
+    memset(&counters, 0, sizeof(counters));
+    frame_allocs = 0;
+    history_count = 0;
+    sample_frames = 0;
+    sample_allocs = 0;
+}
+
+void heap_stats_summary(HeapSummary &summary)
+{
+    summary = counters;
+
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    summary.total = mon.total_size;
+    summary.used = mon.total_size - mon.free_size;
+    summary.peak = mon.max_used;
+    summary.biggest_free = mon.free_biggest_size;
+    summary.frag_pct = mon.frag_pct;
+    if (history_count == 0 || summary.biggest_free < summary.biggest_free_min)
+    {
+        summary.biggest_free_min = summary.biggest_free;
+    }
+    if (summary.frag_pct > summary.frag_pct_max)
+    {
+        summary.frag_pct_max = summary.frag_pct;
+    }
+}
+
+size_t heap_stats_sites(HeapSite *out, size_t max)
+{
+    uint64_t picked = 0;
+    size_t count = 0;
+    while (count < max)
+    {
+        int best = -1;
+        for (int i = 0; i < HEAP_STATS_SITES; i++)
+        {
+            if (sites[i].caller != 0 && !(picked >> i & 1) && (best < 0 || sites[i].allocs > sites[best].allocs))
+            {
+                best = i;
+            }
+        }
+        if (best < 0)
+        {
+            break;
+        }
+        picked |= 1ull << best;
+        out[count++] = sites[best];
+    }
+    return count;
+}
+
+size_t heap_stats_history(HeapSample *out, size_t max)
+{
+    uint32_t available = history_count < HEAP_STATS_HISTORY ? history_count : HEAP_STATS_HISTORY;
+    size_t count = available < max ? available : max;
+    for (size_t i = 0; i < count; i++)
+    {
+        out[i] = history[(history_count - count + i) % HEAP_STATS_HISTORY];
+    }
+    return count;
+}
+
+void heap_stats_print()
+{
+    HeapSummary summary;
+    heap_stats_summary(summary);
+    printf("heap %lu bytes: used %lu, peak %lu, biggest free %lu (min %lu), fragmentation %d%% (max %d%%)\n",
+           (unsigned long)summary.total, (unsigned long)summary.used, (unsigned long)summary.peak,
+           (unsigned long)summary.biggest_free, (unsigned long)summary.biggest_free_min, summary.frag_pct, summary.frag_pct_max);
+    printf("heap calls: %lu allocs, %lu reallocs, %lu frees, %lu failed; per frame %lu last, %lu max, %.1f avg over %lu frames\n",
+           (unsigned long)summary.allocs, (unsigned long)summary.reallocs, (unsigned long)summary.frees, (unsigned long)summary.failures,
+           (unsigned long)summary.frame_allocs, (unsigned long)summary.frame_allocs_max,
+           summary.frames ? static_cast<double>(summary.allocs + summary.reallocs) / summary.frames : 0.0, (unsigned long)summary.frames);
+
+    HeapSite top[HEAP_STATS_PRINT_SITES];
+    size_t site_count = heap_stats_sites(top, HEAP_STATS_PRINT_SITES);
+    for (size_t i = 0; i < site_count; i++)
+    {
+        printf("heap site 0x%08lx: %8lu allocs %8lu freed %6lu live %10llu bytes\n", (unsigned long)top[i].caller,
+               (unsigned long)top[i].allocs, (unsigned long)top[i].frees, (unsigned long)(top[i].allocs - top[i].frees),
+               (unsigned long long)top[i].bytes);
+    }
+    if (summary.other_allocs != 0 || summary.untracked_frees != 0)
+    {
+        printf("heap site other:      %8lu allocs, %lu frees of untracked blocks\n", (unsigned long)summary.other_allocs,
+               (unsigned long)summary.untracked_frees);
+    }
+
+    HeapSample samples[HEAP_STATS_HISTORY];
+    size_t sample_count = heap_stats_history(samples, HEAP_STATS_HISTORY);
+    for (size_t i = 0; i < sample_count; i++)
+    {
+        printf("heap at %8lu ms: used %6lu, biggest free %6lu, fragmentation %3d%%, %4lu allocs/frame\n", (unsigned long)samples[i].time_ms,
+               (unsigned long)samples[i].used, (unsigned long)samples[i].biggest_free, samples[i].frag_pct, (unsigned long)samples[i].allocs_per_frame);
+    }
+}
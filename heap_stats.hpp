@@ -0,0 +1,96 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Instrumentation of the LVGL heap through the LV_USE_MEM_HOOK allocation hook. The hook runs on the
+// core calling LVGL (core 0) and takes no locks.
+
+#define HEAP_STATS_SITES 64         ///< Distinct call sites counted, allocations from further sites are summed up as "other"
+#define HEAP_STATS_HISTORY 16       ///< Heap samples kept, the oldest is overwritten
+#define HEAP_STATS_SAMPLE_MS 1000   ///< Interval between two heap samples
+#define HEAP_STATS_PRINT_SITES 16   ///< Call sites listed by heap_stats_print()
+#define HEAP_STATS_BLOCKS 1024      ///< Live blocks whose site is remembered, further blocks are freed untracked
+
+/// @brief Allocation counters of one call site
+struct HeapSite
+{
+    uintptr_t caller; ///< Return address into the calling function, resolve with addr2line
+    uint32_t allocs;  ///< Allocations and reallocations made from this site
+    uint32_t frees;   ///< Blocks allocated by this site which have been freed or reallocated, by any caller
+    uint64_t bytes;   ///< Total bytes requested by the allocations
+};
+
+/// @brief State of the heap at one point in time
+struct HeapSample
+{
+    uint32_t time_ms;
+    uint32_t used;             ///< Bytes in use
+    uint32_t biggest_free;     ///< Largest free block in bytes
+    uint8_t frag_pct;          ///< Fragmentation of the free memory in percent
+    uint32_t allocs_per_frame; ///< Average allocations per frame since the previous sample
+};
+
+/// @brief Totals since heap_stats_start() or the last heap_stats_reset()
+struct HeapSummary
+{
+    uint32_t allocs;   ///< Successful allocations
+    uint32_t reallocs; ///< Successful reallocations
+    uint32_t frees;
+    uint32_t failures;     ///< Allocations and reallocations which returned NULL
+    uint32_t other_allocs; ///< Allocations from sites which did not fit into the site table
+    uint32_t untracked_frees; ///< Frees of blocks allocated before counting started or not in the block table
+
+    uint32_t frames;           ///< Frames marked with heap_stats_frame()
+    uint32_t frame_allocs;     ///< Allocations in the last complete frame
+    uint32_t frame_allocs_max; ///< Most allocations in a single frame
+
+    uint32_t total;            ///< Size of the heap in bytes
+    uint32_t used;             ///< Bytes in use now
+    uint32_t peak;             ///< Highest use since the heap was created (builtin allocator only)
+    uint32_t biggest_free;     ///< Largest free block now
+    uint32_t biggest_free_min; ///< Smallest of the sampled largest free blocks
+    uint8_t frag_pct;          ///< Fragmentation now
+    uint8_t frag_pct_max;      ///< Highest sampled fragmentation
+};
+
+/**
+ * @brief Registers the allocation hook with LVGL and starts counting.
+ *
+ * Call after lv_init(). Without LV_USE_MEM_HOOK only the heap samples are taken.
+ */
+void heap_stats_start();
+
+/**
+ * @brief Marks the end of a frame.
+ *
+ * Closes the per-frame allocation count and takes a heap sample every HEAP_STATS_SAMPLE_MS.
+ */
+void heap_stats_frame();
+
+/// @brief Clears all counters and samples, e.g. before measuring a single scene.
+void heap_stats_reset();
+
+/// @brief Fills in the totals and the current heap state.
+void heap_stats_summary(HeapSummary &summary);
+
+/**
+ * @brief Copies the call sites with the most allocations.
+ *
+ * @param sites Destination, sorted by allocations, most first.
+ * @param max Capacity of the destination.
+ * @return Number of sites copied.
+ */
+size_t heap_stats_sites(HeapSite *sites, size_t max);
+
+/**
+ * @brief Copies the recorded heap samples.
+ *
+ * @param samples Destination, oldest sample first.
+ * @param max Capacity of the destination.
+ * @return Number of samples copied.
+ */
+size_t heap_stats_history(HeapSample *samples, size_t max);
+
+/// @brief Prints the summary, the busiest call sites and the sample history.
+void heap_stats_print();
@@ -0,0 +1,392 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "pico/stdlib.h"
+
+#include "hub75.hpp"
+#include "lvgl/src/lv_init.h"
+#include "lvgl/src/core/lv_refr.h"
+#include "lvgl/src/display/lv_display.h"
+#include "lvgl/src/misc/lv_timer.h"
+#include "lvgl/src/tick/lv_tick.h"
+
+#include "bouncing_balls.hpp"
+#include "fire_effect.hpp"
+#include "image_animation.hpp"
+#include "colour_check.hpp"
+#include "procedural_effect.hpp"
+#include "procedural_scene.hpp"
+#include "scene_manager.hpp"
+#include "scene_random.hpp"
+
+// Scene benchmark for the host build. Every scene runs for a fixed number of frames at several panel
+// sizes, the transition into it is measured as a case of its own. LVGL's tick is a frame counter and
+// the scenes' random numbers have a fixed seed, so every run renders the same frames at the same
+// animation times. Per frame the render time (scene update and LVGL drawing), the conversion time
+// (update_bgr()) and their sum are recorded.
+//
+//   hub75_bench [--frames N] [--size WxH]... [--baseline FILE] [--margin PERCENT] [--write-baseline FILE]
+//
+// With --baseline the median total time of every case is compared with the file, the exit code is 1
+// if a case is slower than the baseline by more than the margin. The procedural effects are also
+// timed alone in ns per pixel, and the exit code is 1 if their scenes at 128x64 take longer than
+// the frame time of BENCH_EFFECT_FPS in the 99th percentile.
+
+#define BENCH_FRAMES 300            ///< Frames per scene if --frames is not given
+#define BENCH_FRAME_MS 16           ///< Tick advance per frame, LVGL's refresh period
+#define BENCH_MARGIN_PERCENT 25     ///< Allowed slow-down against the baseline if --margin is not given
+#define BENCH_MIN_REGRESSION_US 2.0 ///< Smaller differences are noise, whatever the percentage
+#define BENCH_ARENA_SIZE (2048 * 1024)
+#define BENCH_RANDOM_SEED 1         ///< Seed of the scenes' random numbers
+#define BENCH_EFFECT_FPS 120        ///< Frame rate the procedural effect scenes have to reach at 128x64
+#define BENCH_EFFECT_ARENA_SIZE (512 * 1024)
+
+/// @brief Panel size and the chains it needs, the row select supports up to 1/32 scan
+struct BenchSize
+{
+    uint width;
+    uint height;
+    uint chains;
+};
+
+/// @brief Times of one case in microseconds, one entry per frame
+struct BenchCase
+{
+    std::string name;
+    std::vector<double> render_us;
+    std::vector<double> convert_us;
+    std::vector<double> total_us;
+};
+
+static uint32_t bench_ms = 0;   ///< LVGL tick, advanced by BENCH_FRAME_MS per frame
+static double flush_convert_us; ///< Conversion time of the frame being rendered
+
+static uint32_t bench_tick()
+{
+    return bench_ms;
+}
+
+static double elapsed_us(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+}
+
+static void bench_flush_cb(lv_display_t *display, const lv_area_t *, uint8_t *px_map)
+{
+    auto start = std::chrono::steady_clock::now();
+    update_bgr(px_map);
+    flush_convert_us += elapsed_us(start);
+    lv_display_flush_ready(display);
+}
+
+/**
+ * @brief Renders one frame and records its times.
+ *
+ * The screen is invalidated first, so static scenes are redrawn like animated ones and every
+ * frame is a full frame, as in LV_DISPLAY_RENDER_MODE_FULL on the device.
+ */
+static void run_frame(SceneManager &sceneManager, BenchCase &result)
+{
+    bench_ms += BENCH_FRAME_MS;
+    flush_convert_us = 0;
+    auto start = std::chrono::steady_clock::now();
+    sceneManager.update();
+    lv_obj_invalidate(lv_screen_active());
+    lv_timer_handler();
+    double total = elapsed_us(start);
+    result.render_us.push_back(total - flush_convert_us);
+    result.convert_us.push_back(flush_convert_us);
+    result.total_us.push_back(total);
+}
+
+/// @brief Nearest-rank percentile, sorts the samples
+static double percentile(std::vector<double> &samples, double p)
+{
+    if (samples.empty())
+    {
+        return 0;
+    }
+    std::sort(samples.begin(), samples.end());
+    size_t rank = static_cast<size_t>(p / 100.0 * samples.size() + 0.5);
+    return samples[rank == 0 ? 0 : std::min(rank, samples.size()) - 1];
+}
+
+/**
+ * @brief Runs all scenes and the transitions between them at one panel size.
+ *
+ * @param size Panel size.
+ * @param frames Frames per scene.
+ * @param results Cases are appended, named <width>x<height>/<scene> and <width>x<height>/<from>-><to>.
+ */
+static void run_size(const BenchSize &size, uint frames, std::vector<BenchCase> &results)
+{
+    static uint8_t *arena_memory = new uint8_t[BENCH_ARENA_SIZE];
+    scene_random_seed(BENCH_RANDOM_SEED);
+
+    create_hub75_driver(size.width, size.height, 0, MULTIPLEX_LINEAR, size.chains);
+    size_t buffer_size = size.width * size.height * 3;
+    uint8_t *buffer = new uint8_t[buffer_size];
+    lv_display_t *display = lv_display_create(size.width, size.height);
+    lv_display_set_buffers_with_stride(display, buffer, NULL, buffer_size, size.width * 3, LV_DISPLAY_RENDER_MODE_FULL);
+    lv_display_set_flush_cb(display, bench_flush_cb);
+
+    BouncingBalls bouncingBalls(15, size.width, size.height);
+    FireEffect fireEffect(size.width, size.height);
+    ImageAnimation imageAnimation(size.width, size.height);
+    ColourCheck colourCheck(size.width, size.height);
+    PlasmaEffect plasma;
+    TunnelEffect tunnel;
+    StarfieldEffect starfield;
+    ProceduralScene plasmaScene(plasma, size.width, size.height);
+    ProceduralScene tunnelScene(tunnel, size.width, size.height);
+    ProceduralScene starfieldScene(starfield, size.width, size.height);
+    Scene *scenes[] = {&bouncingBalls, &fireEffect, &imageAnimation, &colourCheck, &plasmaScene, &tunnelScene, &starfieldScene};
+    const size_t count = sizeof(scenes) / sizeof(scenes[0]);
+    SceneManager sceneManager(scenes, count, arena_memory, BENCH_ARENA_SIZE);
+
+    std::string prefix = std::to_string(size.width) + "x" + std::to_string(size.height) + "/";
+    for (size_t i = 0; i <= count; i++)
+    {
+        // The first scene again at the end, for the transition from the last one
+        size_t index = i % count;
+        if (!sceneManager.load(index))
+        {
+            fprintf(stderr, "%sfailed to create %s\n", prefix.c_str(), scenes[index]->name());
+            exit(EXIT_FAILURE);
+        }
+        if (i > 0)
+        {
+            BenchCase transition{prefix + scenes[i - 1]->name() + "->" + scenes[index]->name(), {}, {}, {}};
+            while (sceneManager.in_transition())
+            {
+                run_frame(sceneManager, transition);
+            }
+            results.push_back(transition);
+        }
+        if (i == count)
+        {
+            break;
+        }
+        BenchCase scene{prefix + scenes[index]->name(), {}, {}, {}};
+        for (uint f = 0; f < frames; f++)
+        {
+            run_frame(sceneManager, scene);
+        }
+        results.push_back(scene);
+    }
+
+    // Back to an empty screen, so the scenes can be destroyed
+    lv_obj_t *blank = lv_obj_create(NULL);
+    lv_screen_load(blank);
+    sceneManager.update();
+    scenes[0]->destroy();
+    lv_display_delete(display);
+    delete[] buffer;
+}
+
+/**
+ * @brief Times render() of every procedural effect alone and prints ns per pixel.
+ */
+static void run_effects(const BenchSize &size, uint frames)
+{
+    static uint8_t *arena_memory = new uint8_t[BENCH_EFFECT_ARENA_SIZE];
+    PlasmaEffect plasma;
+    TunnelEffect tunnel;
+    StarfieldEffect starfield;
+    std::vector<uint8_t> pixels(size.width * size.height * 4);
+    for (ProceduralEffect *effect : std::initializer_list<ProceduralEffect *>{&plasma, &tunnel, &starfield})
+    {
+        std::string name = std::to_string(size.width) + "x" + std::to_string(size.height) + "/" + effect->name();
+        printf("%-26s", name.c_str());
+        for (uint32_t bytes_per_pixel : {3u, 4u})
+        {
+            SceneArena arena(arena_memory, BENCH_EFFECT_ARENA_SIZE);
+            if (!effect->create(size.width, size.height, arena.region(0)))
+            {
+                fprintf(stderr, "failed to create %s\n", effect->name());
+                exit(EXIT_FAILURE);
+            }
+            std::vector<double> render_us;
+            for (uint f = 0; f < frames; f++)
+            {
+                auto start = std::chrono::steady_clock::now();
+                effect->render(pixels.data(), size.width * bytes_per_pixel, bytes_per_pixel, f * BENCH_FRAME_MS);
+                render_us.push_back(elapsed_us(start));
+            }
+            printf(" %18.2f", percentile(render_us, 50) * 1000 / (size.width * size.height));
+        }
+        printf("\n");
+    }
+}
+
+/// @brief Reads "<case> <median total us>" lines, # starts a comment
+static std::map<std::string, double> read_baseline(const char *path)
+{
+    std::map<std::string, double> baseline;
+    FILE *file = fopen(path, "r");
+    if (file == nullptr)
+    {
+        fprintf(stderr, "Cannot read baseline %s\n", path);
+        exit(EXIT_FAILURE);
+    }
+    char line[256];
+    while (fgets(line, sizeof(line), file))
+    {
+        char name[128];
+        double total;
+        if (line[0] != '#' && sscanf(line, "%127s %lf", name, &total) == 2)
+        {
+            baseline[name] = total;
+        }
+    }
+    fclose(file);
+    return baseline;
+}
+
+static void write_baseline(const char *path, const std::vector<BenchCase> &results, const std::vector<double> &medians)
+{
+    FILE *file = fopen(path, "w");
+    if (file == nullptr)
+    {
+        fprintf(stderr, "Cannot write baseline %s\n", path);
+        exit(EXIT_FAILURE);
+    }
+    fprintf(file, "# hub75_bench baseline: case, median total time per frame [us]\n");
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        fprintf(file, "%s %.1f\n", results[i].name.c_str(), medians[i]);
+    }
+    fclose(file);
+}
+
+static void usage()
+{
+    fprintf(stderr, "usage: hub75_bench [--frames N] [--size WxH]... [--baseline FILE] [--margin PERCENT] [--write-baseline FILE]\n");
+    exit(EXIT_FAILURE);
+}
+
+int main(int argc, char **argv)
+{
+    uint frames = BENCH_FRAMES;
+    double margin = BENCH_MARGIN_PERCENT;
+    const char *baseline_path = nullptr;
+    const char *write_path = nullptr;
+    std::vector<BenchSize> sizes;
+    for (int i = 1; i < argc; i++)
+    {
+        const char *value = i + 1 < argc ? argv[i + 1] : nullptr;
+        uint w, h;
+        if (value == nullptr)
+        {
+            usage();
+        }
+        else if (strcmp(argv[i], "--frames") == 0)
+        {
+            frames = static_cast<uint>(strtoul(value, nullptr, 10));
+        }
+        else if (strcmp(argv[i], "--size") == 0 && sscanf(value, "%ux%u", &w, &h) == 2)
+        {
+            sizes.push_back({w, h, h > 64 ? 2u : 1u});
+        }
+        else if (strcmp(argv[i], "--baseline") == 0)
+        {
+            baseline_path = value;
+        }
+        else if (strcmp(argv[i], "--margin") == 0)
+        {
+            margin = strtod(value, nullptr);
+        }
+        else if (strcmp(argv[i], "--write-baseline") == 0)
+        {
+            write_path = value;
+        }
+        else
+        {
+            usage();
+        }
+        i++;
+    }
+    if (sizes.empty())
+    {
+        sizes = {{64, 64, 1}, {128, 64, 1}, {256, 128, 2}};
+    }
+
+    lv_init();
+    lv_tick_set_cb(bench_tick);
+
+    std::vector<BenchCase> results;
+    for (const BenchSize &size : sizes)
+    {
+        run_size(size, frames, results);
+    }
+
+    std::map<std::string, double> baseline;
+    if (baseline_path)
+    {
+        baseline = read_baseline(baseline_path);
+    }
+
+    printf("%-26s %6s  %-35s %-35s %-35s\n", "case [us per frame]", "frames", "render p50/p90/p99/max", "convert p50/p90/p99/max",
+           "total p50/p90/p99/max");
+    std::vector<double> medians;
+    uint regressions = 0;
+    for (BenchCase &c : results)
+    {
+        printf("%-26s %6u ", c.name.c_str(), (unsigned)c.total_us.size());
+        for (std::vector<double> *samples : {&c.render_us, &c.convert_us, &c.total_us})
+        {
+            printf(" %8.1f %8.1f %8.1f %8.1f", percentile(*samples, 50), percentile(*samples, 90), percentile(*samples, 99),
+                   percentile(*samples, 100));
+        }
+        double median = percentile(c.total_us, 50);
+        medians.push_back(median);
+
+        auto base = baseline.find(c.name);
+        if (base != baseline.end())
+        {
+            bool regressed = median > base->second * (1 + margin / 100) && median - base->second > BENCH_MIN_REGRESSION_US;
+            printf("  %+5.0f%%%s", (median / base->second - 1) * 100, regressed ? " REGRESSION" : "");
+            regressions += regressed;
+        }
+        printf("\n");
+    }
+
+    printf("\n%-26s %18s %18s\n", "effect alone", "RGB888 ns/pixel", "XRGB8888 ns/pixel");
+    for (const BenchSize &size : sizes)
+    {
+        run_effects(size, frames);
+    }
+
+    // Every effect scene has to keep up with the frame rate at 128x64, LVGL and the conversion included
+    const double budget_us = 1e6 / BENCH_EFFECT_FPS;
+    uint over_budget = 0;
+    for (BenchCase &c : results)
+    {
+        for (const char *effect : {"plasma", "tunnel", "starfield"})
+        {
+            if (c.name == std::string("128x64/") + effect)
+            {
+                double p99 = percentile(c.total_us, 99);
+                printf("%s: p99 %.1f us, %.1f%% of the %u fps budget%s\n", c.name.c_str(), p99, p99 / budget_us * 100, BENCH_EFFECT_FPS,
+                       p99 > budget_us ? " OVER BUDGET" : "");
+                over_budget += p99 > budget_us;
+            }
+        }
+    }
+
+    if (write_path)
+    {
+        write_baseline(write_path, results, medians);
+    }
+    if (baseline_path)
+    {
+        printf("%u of %u cases slower than the baseline by more than %.0f%%\n", regressions, (unsigned)results.size(), margin);
+    }
+    return regressions || over_budget ? 1 : 0;
+}
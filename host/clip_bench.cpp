@@ -0,0 +1,142 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "clip_decoder.hpp"
+#include "hub75.hpp"
+
+#include "clip_encoder.hpp"
+
+// Benchmark of ClipDecoder::decode() at each panel size, alone and followed by update_bgr() like
+// ClipAnimation's frame on the panel, on two clips:
+//   demo     the demo animation of clip_64x64.h, mostly skipped pixels and rows
+//   noise    every pixel changes every frame, so every pixel is a literal: the worst case for the decoder
+//
+// The sizes include two chained panels (128x64 on one chain) and two chains (128x128, 256x128),
+// whose conversion splits every row between the chains. Per size and clip:
+//   decode   time per frame and throughput in MB/s of decoded RGB888 and of clip data read
+//   + conv   decode and update_bgr() together
+//   fps      the frame rate decode and conversion allow, 1e6 / (+ conv)
+//
+//   hub75_clip_bench [--frames N]
+
+#define CLIP_BENCH_FRAMES 2000     ///< Timed frames per size if --frames is not given
+#define CLIP_BENCH_CLIP_FRAMES 50  ///< Frames of the demo clip, as in clip_64x64.h
+#define CLIP_BENCH_WARM_UP 50      ///< Untimed frames before each case
+
+/// @brief Panel size and the chains it needs
+struct ClipSize
+{
+    uint16_t width;
+    uint16_t height;
+    uint chains;
+};
+
+static double elapsed_us(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+}
+
+/**
+ * @brief Frames of random pixels.
+ */
+static std::vector<std::vector<uint8_t>> noise_frames(uint16_t width, uint16_t height, uint32_t count)
+{
+    std::vector<std::vector<uint8_t>> frames(count, std::vector<uint8_t>(width * height * 3));
+    uint32_t random = 1;
+    for (std::vector<uint8_t> &frame : frames)
+    {
+        for (uint8_t &byte : frame)
+        {
+            random ^= random << 13;
+            random ^= random >> 17;
+            random ^= random << 5;
+            byte = static_cast<uint8_t>(random);
+        }
+    }
+    return frames;
+}
+
+static double median(std::vector<double> &times)
+{
+    std::sort(times.begin(), times.end());
+    return times[times.size() / 2];
+}
+
+/**
+ * @brief Times one clip at one size and prints its line.
+ */
+static bool run_case(const ClipSize &size, const char *content, const std::vector<uint8_t> &clip, uint frames)
+{
+    ClipDecoder decoder;
+    if (!decoder.open(clip.data(), clip.size()))
+    {
+        fprintf(stderr, "%ux%u %s: clip does not open\n", size.width, size.height, content);
+        return false;
+    }
+    create_hub75_driver(size.width, size.height, 0, MULTIPLEX_LINEAR, size.chains);
+    uint32_t frame_size = size.width * size.height * 3;
+    std::vector<uint8_t> canvas(frame_size);
+
+    std::vector<double> decode_times;
+    std::vector<double> total_times;
+    for (int convert = 0; convert < 2; convert++)
+    {
+        invalidate_frame();
+        for (uint t = 0; t < CLIP_BENCH_WARM_UP + frames; t++)
+        {
+            auto start = std::chrono::steady_clock::now();
+            decoder.decode(t % decoder.frame_count(), canvas.data(), size.width * 3);
+            if (convert)
+            {
+                update_bgr(canvas.data());
+            }
+            if (t >= CLIP_BENCH_WARM_UP)
+            {
+                (convert ? total_times : decode_times).push_back(elapsed_us(start));
+            }
+        }
+    }
+
+    double decode = median(decode_times);
+    double raw = static_cast<double>(frame_size) * decoder.frame_count();
+    char name[16];
+    snprintf(name, sizeof(name), "%ux%u", size.width, size.height);
+    double total = median(total_times);
+    printf("%-8s %6u %-6s %6.1f:1 %12.2f %11.1f %11.1f %12.2f %8.0f\n", name, size.chains, content, raw / clip.size(), decode,
+           frame_size / decode, clip.size() / (decoder.frame_count() * decode), total, 1e6 / total);
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    uint frames = CLIP_BENCH_FRAMES;
+    if (argc == 3 && strcmp(argv[1], "--frames") == 0)
+    {
+        frames = static_cast<uint>(strtoul(argv[2], nullptr, 10));
+    }
+    else if (argc != 1)
+    {
+        fprintf(stderr, "usage: hub75_clip_bench [--frames N]\n");
+        return EXIT_FAILURE;
+    }
+
+    const ClipSize sizes[] = {{64, 64, 1}, {128, 64, 1}, {128, 128, 2}, {256, 128, 2}};
+    printf("%-8s %6s %-6s %8s %12s %11s %11s %12s %8s\n", "size", "chains", "clip", "ratio", "decode [us]", "out [MB/s]", "in [MB/s]",
+           "+ conv [us]", "fps");
+    for (const ClipSize &size : sizes)
+    {
+        std::vector<uint8_t> demo = encode_clip(demo_clip_frames(size.width, size.height, CLIP_BENCH_CLIP_FRAMES), size.width,
+                                                size.height, 40);
+        std::vector<uint8_t> noise = encode_clip(noise_frames(size.width, size.height, CLIP_BENCH_CLIP_FRAMES), size.width,
+                                                 size.height, 40);
+        if (!run_case(size, "demo", demo, frames) || !run_case(size, "noise", noise, frames))
+        {
+            return EXIT_FAILURE;
+        }
+    }
+    return 0;
+}
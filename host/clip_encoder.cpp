@@ -0,0 +1,195 @@
+#include <cmath>
+#include <cstring>
+
+#include "clip_decoder.hpp"
+
+#include "clip_encoder.hpp"
+
+#define CLIP_MAX_COUNT 64 ///< Longest run of one op
+
+static void put_le16(std::vector<uint8_t> &out, uint16_t value)
+{
+    out.push_back(value & 0xFF);
+    out.push_back(value >> 8);
+}
+
+static void put_le32(std::vector<uint8_t> &out, uint32_t value)
+{
+    put_le16(out, value & 0xFFFF);
+    put_le16(out, value >> 16);
+}
+
+/**
+ * @brief Encodes one row like encode_row() of tools/hub75_clip.py.
+ *
+ * @param prev Row of the previous frame, nullptr for a key frame.
+ */
+static void encode_row(std::vector<uint8_t> &out, const uint8_t *row, const uint8_t *prev, uint32_t width)
+{
+    auto same = [&](uint32_t i) { return prev && memcmp(row + i * 3, prev + i * 3, 3) == 0; };
+    auto fill_length = [&](uint32_t i) {
+        uint32_t n = 1;
+        while (i + n < width && n < CLIP_MAX_COUNT && memcmp(row + (i + n) * 3, row + i * 3, 3) == 0)
+        {
+            n++;
+        }
+        return n;
+    };
+
+    uint32_t x = 0;
+    while (x < width)
+    {
+        uint32_t n = 1;
+        if (same(x))
+        {
+            while (x + n < width && n < CLIP_MAX_COUNT && same(x + n))
+            {
+                n++;
+            }
+            out.push_back(CLIP_OP_SKIP | (n - 1));
+        }
+        else if (fill_length(x) >= 3)
+        {
+            n = fill_length(x);
+            out.push_back(CLIP_OP_FILL | (n - 1));
+            out.insert(out.end(), row + x * 3, row + x * 3 + 3);
+        }
+        else
+        {
+            // Literal run until a skip of two pixels or a fill of three pixels starts
+            while (x + n < width && n < CLIP_MAX_COUNT)
+            {
+                uint32_t i = x + n;
+                if ((same(i) && i + 1 < width && same(i + 1)) || fill_length(i) >= 3)
+                {
+                    break;
+                }
+                n++;
+            }
+            out.push_back(CLIP_OP_COPY | (n - 1));
+            out.insert(out.end(), row + x * 3, row + (x + n) * 3);
+        }
+        x += n;
+    }
+}
+
+static void encode_frame(std::vector<uint8_t> &out, const uint8_t *frame, const uint8_t *prev, uint32_t width, uint32_t height)
+{
+    uint32_t stride = width * 3;
+    uint32_t skipped = 0;
+    for (uint32_t y = 0; y < height; y++)
+    {
+        const uint8_t *row = frame + y * stride;
+        const uint8_t *prev_row = prev ? prev + y * stride : nullptr;
+        if (prev_row && memcmp(row, prev_row, stride) == 0)
+        {
+            if (++skipped == CLIP_MAX_COUNT)
+            {
+                out.push_back(CLIP_OP_SKIP_ROWS | (skipped - 1));
+                skipped = 0;
+            }
+            continue;
+        }
+        if (skipped)
+        {
+            out.push_back(CLIP_OP_SKIP_ROWS | (skipped - 1));
+            skipped = 0;
+        }
+        encode_row(out, row, prev_row, width);
+    }
+    if (skipped)
+    {
+        out.push_back(CLIP_OP_SKIP_ROWS | (skipped - 1));
+    }
+}
+
+std::vector<uint8_t> encode_clip(const std::vector<std::vector<uint8_t>> &frames, uint16_t width, uint16_t height, uint16_t frame_ms)
+{
+    std::vector<uint8_t> clip;
+    if (frames.empty())
+    {
+        return clip;
+    }
+
+    std::vector<std::vector<uint8_t>> encoded(frames.size());
+    for (size_t i = 0; i < frames.size(); i++)
+    {
+        encode_frame(encoded[i], frames[i].data(), i ? frames[i - 1].data() : nullptr, width, height);
+    }
+
+    put_le32(clip, CLIP_MAGIC);
+    put_le16(clip, width);
+    put_le16(clip, height);
+    put_le16(clip, static_cast<uint16_t>(frames.size()));
+    put_le16(clip, frame_ms);
+    uint32_t offset = CLIP_HEADER_SIZE + frames.size() * sizeof(uint32_t);
+    for (const std::vector<uint8_t> &data : encoded)
+    {
+        put_le32(clip, offset);
+        offset += data.size();
+    }
+    for (const std::vector<uint8_t> &data : encoded)
+    {
+        clip.insert(clip.end(), data.begin(), data.end());
+    }
+    return clip;
+}
+
+std::vector<std::vector<uint8_t>> demo_clip_frames(uint16_t width, uint16_t height, uint32_t count)
+{
+    // The script builds R, G, B and swaps to B, G, R - here the pixels are stored swapped right away
+    auto put = [width](std::vector<uint8_t> &frame, int x, int y, uint8_t r, uint8_t g, uint8_t b) {
+        uint8_t *p = &frame[(y * width + x) * 3];
+        p[0] = b;
+        p[1] = g;
+        p[2] = r;
+    };
+
+    std::vector<uint8_t> background(width * height * 3);
+    for (int y = 0; y < height; y++)
+    {
+        for (int x = 0; x < width; x++)
+        {
+            put(background, x, y, 10 + 30 * y / height, 0, 20 + 40 * x / width);
+        }
+    }
+
+    std::vector<std::vector<uint8_t>> frames;
+    double cx = width / 2.0, cy = height / 2.0;
+    for (uint32_t t = 0; t < count; t++)
+    {
+        std::vector<uint8_t> frame = background;
+        double phase = 2 * M_PI * t / count;
+        double radius = (width < height ? width : height) * (0.18 + 0.06 * sin(2 * phase));
+        for (int y = 0; y < height; y++)
+        {
+            for (int x = 0; x < width; x++)
+            {
+                if (fabs(x + 0.5 - cx) + fabs(y + 0.5 - cy) < radius)
+                {
+                    put(frame, x, y, 255, 160, 0);
+                }
+            }
+        }
+        for (int k = 0; k < 6; k++)
+        {
+            double a = phase - k * 0.12;
+            int px = static_cast<int>(cx + cos(a) * width * 0.38);
+            int py = static_cast<int>(cy + sin(a) * height * 0.38);
+            int level = 255 - k * 40;
+            for (int dy = -1; dy <= 1; dy++)
+            {
+                for (int dx = -1; dx <= 1; dx++)
+                {
+                    int x = px + dx, y = py + dy;
+                    if (x >= 0 && x < width && y >= 0 && y < height)
+                    {
+                        put(frame, x, y, level / 4, level, level);
+                    }
+                }
+            }
+        }
+        frames.push_back(frame);
+    }
+    return frames;
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+// Encoder of delta/RLE clips, a port of tools/hub75_clip.py for the host tests and benchmarks.
+// Produces the same byte stream as the script, see clip_decoder.hpp for the format.
+
+/**
+ * @brief Encodes frames into a clip.
+ *
+ * @param frames Frames in LVGL's RGB888 memory order (B, G, R), width * height * 3 bytes each.
+ * @param width Width in pixels.
+ * @param height Height in pixels.
+ * @param frame_ms Display time of one frame.
+ * @return The clip, empty if there are no frames.
+ */
+std::vector<uint8_t> encode_clip(const std::vector<std::vector<uint8_t>> &frames, uint16_t width, uint16_t height, uint16_t frame_ms);
+
+/**
+ * @brief Frames of the demo clip of tools/hub75_clip.py: a pulsing diamond with an orbiting comet
+ *        over a static gradient, in LVGL's RGB888 memory order.
+ */
+std::vector<std::vector<uint8_t>> demo_clip_frames(uint16_t width, uint16_t height, uint32_t count);
@@ -0,0 +1,125 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "hub75.hpp"
+
+// Benchmark of update_bgr() on synthetic content, which shows what the row skipping saves and costs:
+//   static  the same frame every time, no row is converted
+//   slow    an 8x8 block moves one pixel per frame, 8 rows change
+//   full    a gradient scrolls one pixel per frame, every row changes - the hashing is bypassed
+//   hashed  as full, but the frame is invalidated before every call, so every frame is hashed
+//           and converted completely: the cost of full change without the bypass
+//
+//   hub75_convert_bench [--frames N]
+
+#define CONVERT_BENCH_FRAMES 1000 ///< Timed frames per case if --frames is not given
+#define CONVERT_BENCH_WARM_UP 50  ///< Untimed frames before each case, the bypass needs a few to engage
+
+/// @brief Panel size and the chains it needs
+struct ConvertSize
+{
+    uint width;
+    uint height;
+    uint chains;
+};
+
+enum ConvertCase
+{
+    CASE_STATIC,
+    CASE_SLOW,
+    CASE_FULL,
+    CASE_HASHED,
+    CASE_COUNT
+};
+
+static const char *case_names[CASE_COUNT] = {"static", "slow", "full", "hashed"};
+
+/**
+ * @brief Draws frame number t of a case.
+ */
+static void draw(std::vector<uint8_t> &frame, const ConvertSize &size, ConvertCase c, uint t)
+{
+    for (uint y = 0; y < size.height; y++)
+    {
+        for (uint x = 0; x < size.width; x++)
+        {
+            uint shift = c == CASE_FULL || c == CASE_HASHED ? t : 0;
+            uint8_t *p = &frame[(y * size.width + x) * 3];
+            p[0] = static_cast<uint8_t>((x + shift) * 4);
+            p[1] = static_cast<uint8_t>(y * 4 + shift);
+            p[2] = static_cast<uint8_t>((x + y) * 2);
+        }
+    }
+    if (c == CASE_SLOW)
+    {
+        uint bx = t % (size.width - 8);
+        for (uint y = 8; y < 16; y++)
+        {
+            memset(&frame[(y * size.width + bx) * 3], 0xFF, 8 * 3);
+        }
+    }
+}
+
+static double elapsed_us(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char **argv)
+{
+    uint frames = CONVERT_BENCH_FRAMES;
+    if (argc == 3 && strcmp(argv[1], "--frames") == 0)
+    {
+        frames = static_cast<uint>(strtoul(argv[2], nullptr, 10));
+    }
+    else if (argc != 1)
+    {
+        fprintf(stderr, "usage: hub75_convert_bench [--frames N]\n");
+        return EXIT_FAILURE;
+    }
+
+    const ConvertSize sizes[] = {{64, 64, 1}, {128, 64, 1}, {256, 128, 2}};
+    printf("%-8s %-7s %10s %10s %10s\n", "size", "case", "p50 [us]", "avg [us]", "ns/pixel");
+    for (const ConvertSize &size : sizes)
+    {
+        create_hub75_driver(size.width, size.height, 0, MULTIPLEX_LINEAR, size.chains);
+        std::vector<uint8_t> frame(size.width * size.height * 3);
+        for (int c = 0; c < CASE_COUNT; c++)
+        {
+            ConvertCase kind = static_cast<ConvertCase>(c);
+            std::vector<double> times;
+            invalidate_frame();
+            for (uint t = 0; t < CONVERT_BENCH_WARM_UP + frames; t++)
+            {
+                draw(frame, size, kind, t);
+                if (kind == CASE_HASHED)
+                {
+                    invalidate_frame();
+                }
+                auto start = std::chrono::steady_clock::now();
+                update_bgr(frame.data());
+                if (t >= CONVERT_BENCH_WARM_UP)
+                {
+                    times.push_back(elapsed_us(start));
+                }
+            }
+
+            double sum = 0;
+            for (double us : times)
+            {
+                sum += us;
+            }
+            std::sort(times.begin(), times.end());
+            double average = sum / times.size();
+            char name[16];
+            snprintf(name, sizeof(name), "%ux%u", size.width, size.height);
+            printf("%-8s %-7s %10.2f %10.2f %10.2f\n", name, case_names[c], times[times.size() / 2], average,
+                   average * 1000 / (size.width * size.height));
+        }
+    }
+    return 0;
+}
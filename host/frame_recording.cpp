@@ -0,0 +1,155 @@
+#include <algorithm>
+#include <cstring>
+
+#include "frame_recording.hpp"
+
+static const char recording_magic[4] = {'H', '7', '5', 'R'};
+
+/// @brief File header, 16 bytes
+struct RecordingHeader
+{
+    char magic[4];
+    uint16_t version;
+    uint16_t width;
+    uint16_t height;
+    uint8_t scan;
+    uint8_t multiplex;
+    uint8_t chains;
+    uint8_t padding;
+    uint16_t panel_width;
+};
+static_assert(sizeof(RecordingHeader) == 16, "RecordingHeader must not be padded");
+
+bool FrameRecorder::open(const char *path, const RecordingFormat &format)
+{
+    close();
+    file = fopen(path, "wb");
+    if (file == nullptr)
+    {
+        return false;
+    }
+
+    this->format = format;
+    RecordingHeader header = {};
+    memcpy(header.magic, recording_magic, sizeof(header.magic));
+    header.version = RECORDING_VERSION;
+    header.width = format.width;
+    header.height = format.height;
+    header.scan = format.scan;
+    header.multiplex = format.multiplex;
+    header.chains = format.chains;
+    header.panel_width = format.panel_width;
+    fwrite(&header, sizeof(header), 1, file);
+    bytes = sizeof(header);
+    frames = 0;
+
+    // The first frame is compared with an impossible previous frame, so every row is written
+    rgb.clear();
+    converted.clear();
+    changed.assign((format.height + 7) / 8, 0);
+    return true;
+}
+
+/**
+ * @brief Writes the bitmap of changed blocks and the changed blocks, then remembers the new content.
+ *
+ * @param file Output file.
+ * @param previous Previous content, empty for the first frame.
+ * @param current Current content, blocks * block_size bytes.
+ * @param blocks Number of blocks.
+ * @param block_size Bytes per block.
+ * @param changed Bitmap buffer, (blocks + 7) / 8 bytes.
+ * @return Bytes written.
+ */
+static uint64_t write_changes(FILE *file, std::vector<uint8_t> &previous, const uint8_t *current, uint32_t blocks, uint32_t block_size,
+                              std::vector<uint8_t> &changed)
+{
+    bool first = previous.empty();
+    std::fill(changed.begin(), changed.end(), 0);
+    for (uint32_t b = 0; b < blocks; b++)
+    {
+        if (first || memcmp(&previous[b * block_size], current + b * block_size, block_size) != 0)
+        {
+            changed[b >> 3] |= 1 << (b & 7);
+        }
+    }
+    uint64_t written = fwrite(changed.data(), 1, changed.size(), file);
+    for (uint32_t b = 0; b < blocks; b++)
+    {
+        if (changed[b >> 3] & (1 << (b & 7)))
+        {
+            written += fwrite(current + b * block_size, 1, block_size, file);
+        }
+    }
+    previous.assign(current, current + blocks * block_size);
+    return written;
+}
+
+void FrameRecorder::add(const uint8_t *src, const volatile uint32_t *frame_buffer)
+{
+    if (file == nullptr)
+    {
+        return;
+    }
+    const uint8_t *words = reinterpret_cast<const uint8_t *>(const_cast<const uint32_t *>(frame_buffer));
+    bytes += write_changes(file, rgb, src, format.height, format.width * 3, changed);
+    bytes += write_changes(file, converted, words, format.height, format.width * 4, changed);
+    frames++;
+}
+
+void FrameRecorder::close()
+{
+    if (file)
+    {
+        fclose(file);
+        file = nullptr;
+    }
+}
+
+bool FrameReader::open(const char *path)
+{
+    file = fopen(path, "rb");
+    RecordingHeader header;
+    if (file == nullptr || fread(&header, sizeof(header), 1, file) != 1 || memcmp(header.magic, recording_magic, sizeof(header.magic)) != 0 ||
+        header.version != RECORDING_VERSION)
+    {
+        return false;
+    }
+    format = {header.width, header.height, header.scan, header.multiplex, header.chains, header.panel_width};
+    rgb.assign(static_cast<size_t>(format.width) * format.height * 3, 0);
+    converted.assign(static_cast<size_t>(format.width) * format.height, 0);
+    changed.assign((format.height + 7) / 8, 0);
+    return true;
+}
+
+void FrameReader::rewind()
+{
+    fseek(file, sizeof(RecordingHeader), SEEK_SET);
+}
+
+/**
+ * @brief Reads a bitmap and the blocks it marks as changed into the current content.
+ *
+ * @return false if the file ends early.
+ */
+static bool read_changes(FILE *file, uint8_t *current, uint32_t blocks, uint32_t block_size, std::vector<uint8_t> &changed)
+{
+    if (fread(changed.data(), 1, changed.size(), file) != changed.size())
+    {
+        return false;
+    }
+    for (uint32_t b = 0; b < blocks; b++)
+    {
+        if ((changed[b >> 3] & (1 << (b & 7))) && fread(current + b * block_size, 1, block_size, file) != block_size)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool FrameReader::next()
+{
+    return file && read_changes(file, rgb.data(), format.height, format.width * 3, changed) &&
+           read_changes(file, reinterpret_cast<uint8_t *>(converted.data()), format.height, format.width * 4, changed);
+}
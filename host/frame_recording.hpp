@@ -0,0 +1,122 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+// Recording of the frames handed to the driver: per frame the RGB888 input of update_bgr() and
+// the converted frame_buffer. Written by the host build (HUB75_RECORD), replayed by hub75_replay.
+//
+// File layout, little endian:
+//   header: "H75R", version (uint16), width, height (uint16), scan, multiplex, chains (uint8), 1 byte padding,
+//           panel width (uint16, 0 for one panel per chain)
+//   per frame: bitmap of changed input rows, the changed rows (width * 3 bytes each),
+//              bitmap of changed frame buffer blocks, the changed blocks (width words each)
+// A bitmap has one bit per row or block, (height + 7) / 8 bytes, LSB first. Rows and blocks equal
+// to the previous frame are left out, so static content costs 2 * (height + 7) / 8 bytes per frame.
+
+#define RECORDING_VERSION 1
+
+/// @brief Panel geometry of a recording, the replayer creates the driver with it
+struct RecordingFormat
+{
+    uint16_t width;
+    uint16_t height;
+    uint8_t scan;
+    uint8_t multiplex; ///< Multiplex
+    uint8_t chains;
+    uint16_t panel_width; ///< 0 for one panel per chain
+};
+
+/**
+ * @brief Writes a recording.
+ */
+class FrameRecorder
+{
+private:
+    FILE *file = nullptr;
+    RecordingFormat format = {};
+    std::vector<uint8_t> rgb;         ///< Previous input frame
+    std::vector<uint8_t> converted;   ///< Previous frame buffer, as bytes
+    std::vector<uint8_t> changed;     ///< Bitmap of the frame being written
+    uint32_t frames = 0;
+    uint64_t bytes = 0;
+
+public:
+    ~FrameRecorder()
+    {
+        close();
+    }
+
+    /// @return false if the file could not be created.
+    bool open(const char *path, const RecordingFormat &format);
+
+    /**
+     * @brief Appends a frame.
+     *
+     * @param src RGB888 input of the conversion, width * 3 bytes per row.
+     * @param frame_buffer Frame buffer after the conversion, width * height words.
+     */
+    void add(const uint8_t *src, const volatile uint32_t *frame_buffer);
+
+    void close();
+
+    uint32_t frame_count() const
+    {
+        return frames;
+    }
+
+    /// @brief Bytes written, including the header.
+    uint64_t size() const
+    {
+        return bytes;
+    }
+};
+
+/**
+ * @brief Reads a recording frame by frame.
+ */
+class FrameReader
+{
+private:
+    FILE *file = nullptr;
+    RecordingFormat format = {};
+    std::vector<uint8_t> rgb;
+    std::vector<uint32_t> converted;
+    std::vector<uint8_t> changed;
+
+public:
+    ~FrameReader()
+    {
+        if (file)
+        {
+            fclose(file);
+        }
+    }
+
+    /// @return false if the file cannot be read or is not a recording.
+    bool open(const char *path);
+
+    /// @brief Starts again with the first frame.
+    void rewind();
+
+    /// @return false at the end of the recording.
+    bool next();
+
+    const RecordingFormat &get_format() const
+    {
+        return format;
+    }
+
+    /// @brief RGB888 input of the current frame.
+    const uint8_t *input() const
+    {
+        return rgb.data();
+    }
+
+    /// @brief Frame buffer after converting the current frame.
+    const uint32_t *output() const
+    {
+        return converted.data();
+    }
+};
@@ -0,0 +1,136 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "lvgl/src/libs/gif/gifdec.h"
+#include "lvgl/src/lv_init.h"
+#include "lvgl/src/stdlib/lv_mem.h"
+
+#include "gif_animation.hpp"
+#include "gif_decoder.hpp"
+#include "gif_64x64.h"
+
+// Benchmark of GIF decoding on the demo GIF (gif_64x64.h), time per frame:
+//   gifdec       LVGL's decoder as the gif widget uses it, one frame per call, state on the LVGL heap
+//   GifDecoder   a whole frame per call
+//   + rows       GIF_DECODE_ROWS rows per call like GifAnimation::update(), the 99th percentile of
+//                the calls is what one main loop iteration waits for
+// The memory column is what the decoder needs besides the GIF: LVGL heap for gifdec (its largest
+// use during the run), memory_size() from the scene arena for GifDecoder.
+//
+//   hub75_gif_bench [--frames N]
+
+#define GIF_BENCH_FRAMES 2400 ///< Decoded frames per case if --frames is not given
+
+static double elapsed_us(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+}
+
+static double percentile(std::vector<double> &times, uint percent)
+{
+    std::sort(times.begin(), times.end());
+    return times[(times.size() - 1) * percent / 100];
+}
+
+static void print_case(const char *name, std::vector<double> &frame_us, std::vector<double> &call_us, size_t memory)
+{
+    double sum = 0;
+    for (double us : frame_us)
+    {
+        sum += us;
+    }
+    printf("%-22s %10.2f %10.2f %10.2f %12.2f %10u\n", name, percentile(frame_us, 50), sum / frame_us.size(), percentile(frame_us, 99),
+           percentile(call_us, 99), (unsigned)memory);
+}
+
+int main(int argc, char **argv)
+{
+    uint frames = GIF_BENCH_FRAMES;
+    if (argc == 3 && strcmp(argv[1], "--frames") == 0)
+    {
+        frames = static_cast<uint>(strtoul(argv[2], nullptr, 10));
+    }
+    else if (argc != 1 || frames == 0)
+    {
+        fprintf(stderr, "usage: hub75_gif_bench [--frames N]\n");
+        return EXIT_FAILURE;
+    }
+    lv_init();
+
+    printf("%-22s %10s %10s %10s %12s %10s\n", "decoder", "p50 [us]", "avg [us]", "p99 [us]", "call p99", "memory [B]");
+
+    // gifdec
+    {
+        lv_mem_monitor_t before;
+        lv_mem_monitor(&before);
+        gd_GIF *gif = gd_open_gif_data(gif_64x64);
+        if (gif == nullptr)
+        {
+            fprintf(stderr, "gifdec cannot open the GIF\n");
+            return EXIT_FAILURE;
+        }
+        std::vector<double> times;
+        size_t peak = 0;
+        for (uint i = 0; i < frames; i++)
+        {
+            auto start = std::chrono::steady_clock::now();
+            int res = gd_get_frame(gif);
+            if (res == 0)
+            {
+                res = gd_get_frame(gif);
+            }
+            gd_render_frame(gif, gif->canvas);
+            times.push_back(elapsed_us(start));
+            lv_mem_monitor_t now;
+            lv_mem_monitor(&now);
+            peak = std::max(peak, static_cast<size_t>(before.free_size - now.free_size));
+            if (res != 1)
+            {
+                fprintf(stderr, "gifdec: frame %u corrupt\n", i);
+                return EXIT_FAILURE;
+            }
+        }
+        gd_close_gif(gif);
+        std::vector<double> calls = times;
+        print_case("gifdec", times, calls, peak);
+    }
+
+    // GifDecoder, whole frames and GIF_DECODE_ROWS rows per call
+    const uint32_t row_budgets[] = {64, GIF_DECODE_ROWS};
+    for (uint32_t rows : row_budgets)
+    {
+        GifDecoder decoder;
+        decoder.open(gif_64x64, sizeof(gif_64x64));
+        std::vector<uint8_t> memory(decoder.memory_size());
+        decoder.start(memory.data());
+        std::vector<double> times;
+        std::vector<double> calls;
+        for (uint i = 0; i < frames; i++)
+        {
+            double frame = 0;
+            GifStatus status;
+            do
+            {
+                auto start = std::chrono::steady_clock::now();
+                status = decoder.decode(rows);
+                double us = elapsed_us(start);
+                frame += us;
+                calls.push_back(us);
+            } while (status == GIF_FRAME_PENDING);
+            if (status != GIF_FRAME_READY)
+            {
+                fprintf(stderr, "GifDecoder: frame %u corrupt\n", i);
+                return EXIT_FAILURE;
+            }
+            times.push_back(frame);
+        }
+        char name[32];
+        snprintf(name, sizeof(name), "GifDecoder, %u rows", rows);
+        print_case(name, times, calls, memory.size());
+    }
+    return 0;
+}
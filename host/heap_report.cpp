@@ -0,0 +1,179 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <dlfcn.h>
+#include <string>
+
+#include "pico/stdlib.h"
+
+#include "hub75.hpp"
+#include "lvgl/src/lv_init.h"
+#include "lvgl/src/core/lv_refr.h"
+#include "lvgl/src/display/lv_display.h"
+#include "lvgl/src/misc/lv_timer.h"
+#include "lvgl/src/tick/lv_tick.h"
+
+#include "bouncing_balls.hpp"
+#include "colour_check.hpp"
+#include "fire_effect.hpp"
+#include "heap_stats.hpp"
+#include "image_animation.hpp"
+#include "scene_manager.hpp"
+#include "scene_random.hpp"
+
+// Heap report of every scene for the baseline in host/heap_baseline.txt: a 64x64 display in full
+// render mode, every scene runs twice for the given number of frames at the 120 Hz frame period and
+// is measured on the second pass. Per scene the heap_stats summary and the busiest call sites, named
+// with addr2line, so the report can be compared across builds:
+//
+//   hub75_heap_report [--frames N] > host/heap_baseline.txt
+//
+// A site's frees are the frees of the blocks it allocated, by whichever caller, so allocs - frees
+// is what the site holds at the end of the pass.
+
+#define HEAP_REPORT_FRAMES 1800 ///< Frames per pass if --frames is not given: 15 s at 120 Hz
+#define HEAP_REPORT_FRAME_MS 8  ///< Tick advance per frame
+#define HEAP_REPORT_WIDTH 64
+#define HEAP_REPORT_HEIGHT 64
+#define HEAP_REPORT_ARENA_SIZE (256 * 1024)
+#define HEAP_REPORT_SITES 8 ///< Call sites listed per scene
+
+static uint32_t report_ms = 0;
+
+static uint32_t report_tick()
+{
+    return report_ms;
+}
+
+static void report_flush_cb(lv_display_t *display, const lv_area_t *, uint8_t *px_map)
+{
+    update_bgr(px_map);
+    lv_display_flush_ready(display);
+}
+
+static void run_frame(SceneManager &sceneManager)
+{
+    report_ms += HEAP_REPORT_FRAME_MS;
+    sceneManager.update();
+    lv_timer_handler();
+    heap_stats_frame();
+}
+
+/**
+ * @brief Names the function of a return address, with the offset into the executable if addr2line fails.
+ */
+static std::string function_name(uintptr_t address)
+{
+    Dl_info info;
+    if (dladdr(reinterpret_cast<void *>(address), &info) == 0 || info.dli_fname == nullptr)
+    {
+        return "?";
+    }
+    // The call instruction is just before the return address
+    uintptr_t offset = address - reinterpret_cast<uintptr_t>(info.dli_fbase) - 1;
+    std::string command = std::string("addr2line -f -e '") + info.dli_fname + "' 0x" + [&] {
+        char hex[24];
+        snprintf(hex, sizeof(hex), "%lx", static_cast<unsigned long>(offset));
+        return std::string(hex);
+    }();
+    std::string name;
+    FILE *pipe = popen(command.c_str(), "r");
+    if (pipe != nullptr)
+    {
+        char line[256];
+        if (fgets(line, sizeof(line), pipe) != nullptr)
+        {
+            name = line;
+            name.erase(name.find_last_not_of("\r\n") + 1);
+        }
+        pclose(pipe);
+    }
+    if (name.empty() || name == "??")
+    {
+        char fallback[32];
+        snprintf(fallback, sizeof(fallback), "+0x%lx", static_cast<unsigned long>(offset));
+        name = fallback;
+    }
+    return name;
+}
+
+static void print_scene(const char *scene)
+{
+    HeapSummary summary;
+    heap_stats_summary(summary);
+    printf("%s: %.1f allocs/frame (max %lu), used %lu bytes, largest free min %lu bytes, fragmentation max %u%%\n", scene,
+           summary.frames ? static_cast<double>(summary.allocs + summary.reallocs) / summary.frames : 0.0,
+           (unsigned long)summary.frame_allocs_max, (unsigned long)summary.used, (unsigned long)summary.biggest_free_min,
+           summary.frag_pct_max);
+
+    HeapSite top[HEAP_REPORT_SITES];
+    size_t count = heap_stats_sites(top, HEAP_REPORT_SITES);
+    for (size_t i = 0; i < count; i++)
+    {
+        printf("  %-36s %8lu allocs %8lu freed %5lu live %10llu bytes\n", function_name(top[i].caller).c_str(), (unsigned long)top[i].allocs,
+               (unsigned long)top[i].frees, (unsigned long)(top[i].allocs - top[i].frees), (unsigned long long)top[i].bytes);
+    }
+    if (summary.other_allocs != 0 || summary.untracked_frees != 0)
+    {
+        printf("  %-36s %8lu allocs, %lu frees of blocks allocated before the pass\n", "other", (unsigned long)summary.other_allocs,
+               (unsigned long)summary.untracked_frees);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    uint frames = HEAP_REPORT_FRAMES;
+    if (argc == 3 && strcmp(argv[1], "--frames") == 0)
+    {
+        frames = static_cast<uint>(strtoul(argv[2], nullptr, 10));
+    }
+    else if (argc != 1)
+    {
+        fprintf(stderr, "usage: hub75_heap_report [--frames N]\n");
+        return EXIT_FAILURE;
+    }
+
+    lv_init();
+    lv_tick_set_cb(report_tick);
+    heap_stats_start();
+    scene_random_seed(1);
+
+    static uint8_t arena_memory[HEAP_REPORT_ARENA_SIZE];
+    create_hub75_driver(HEAP_REPORT_WIDTH, HEAP_REPORT_HEIGHT, 0, MULTIPLEX_LINEAR, 1);
+    size_t buffer_size = HEAP_REPORT_WIDTH * HEAP_REPORT_HEIGHT * 3;
+    uint8_t *buffer = new uint8_t[buffer_size];
+    lv_display_t *display = lv_display_create(HEAP_REPORT_WIDTH, HEAP_REPORT_HEIGHT);
+    lv_display_set_buffers_with_stride(display, buffer, NULL, buffer_size, HEAP_REPORT_WIDTH * 3, LV_DISPLAY_RENDER_MODE_FULL);
+    lv_display_set_flush_cb(display, report_flush_cb);
+
+    BouncingBalls bouncingBalls(15, HEAP_REPORT_WIDTH, HEAP_REPORT_HEIGHT);
+    FireEffect fireEffect(HEAP_REPORT_WIDTH, HEAP_REPORT_HEIGHT);
+    ImageAnimation imageAnimation(HEAP_REPORT_WIDTH, HEAP_REPORT_HEIGHT);
+    ColourCheck colourCheck(HEAP_REPORT_WIDTH, HEAP_REPORT_HEIGHT);
+    Scene *scenes[] = {&bouncingBalls, &fireEffect, &imageAnimation, &colourCheck};
+    const size_t count = sizeof(scenes) / sizeof(scenes[0]);
+    SceneManager sceneManager(scenes, count, arena_memory, HEAP_REPORT_ARENA_SIZE);
+
+    printf("# hub75_heap_report: 64x64, %u frames per scene at %u ms, second pass\n", frames, HEAP_REPORT_FRAME_MS);
+    for (uint pass = 0; pass < 2; pass++)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            if (!sceneManager.load(i))
+            {
+                fprintf(stderr, "failed to create %s\n", scenes[i]->name());
+                return EXIT_FAILURE;
+            }
+            heap_stats_reset();
+            for (uint f = 0; f < frames; f++)
+            {
+                run_frame(sceneManager);
+            }
+            if (pass == 1)
+            {
+                print_scene(scenes[i]->name());
+            }
+        }
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,65 @@
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+
+#include "hub75.hpp"
+
+#include "host_run.hpp"
+
+static FrameRecorder *recorder = nullptr; ///< Open recording, if any
+static std::mutex recorder_lock;          ///< Frames are added by core 1 and the recording is closed by core 0
+
+bool host_run_finished(uint32_t frames)
+{
+    static uint32_t limit = 0;
+    if (limit == 0)
+    {
+        const char *value = getenv("HUB75_FRAMES");
+        limit = value ? static_cast<uint32_t>(strtoul(value, nullptr, 10)) : 0;
+        limit = limit ? limit : HOST_RUN_DEFAULT_FRAMES;
+    }
+    return frames >= limit;
+}
+
+uint32_t host_random_seed(uint32_t fallback)
+{
+    const char *value = getenv("HUB75_SEED");
+    return value ? static_cast<uint32_t>(strtoul(value, nullptr, 0)) : fallback;
+}
+
+void host_record_start(const RecordingFormat &format)
+{
+    const char *path = getenv("HUB75_RECORD");
+    if (path == nullptr)
+    {
+        return;
+    }
+    std::lock_guard<std::mutex> guard(recorder_lock);
+    recorder = new FrameRecorder;
+    if (!recorder->open(path, format))
+    {
+        fprintf(stderr, "Cannot create recording %s\n", path);
+        delete recorder;
+        recorder = nullptr;
+    }
+}
+
+void host_record_frame(const uint8_t *src)
+{
+    std::lock_guard<std::mutex> guard(recorder_lock);
+    if (recorder)
+    {
+        recorder->add(src, frame_buffer);
+    }
+}
+
+void host_record_stop()
+{
+    std::lock_guard<std::mutex> guard(recorder_lock);
+    if (recorder)
+    {
+        printf("recorded %lu frames, %llu bytes\n", (unsigned long)recorder->frame_count(), (unsigned long long)recorder->size());
+        delete recorder;
+        recorder = nullptr;
+    }
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstdint>
+
+#include "frame_recording.hpp"
+
+// Run control of the host build, implemented in host/host_run.cpp. Set by environment variables:
+//   HUB75_FRAMES  frames to run
+//   HUB75_SEED    seed of the scenes' random numbers, also makes the clock and the pipeline reproducible
+//   HUB75_RECORD  file to record the converted frames to, see frame_recording.hpp
+
+#define HOST_RUN_DEFAULT_FRAMES 8000 ///< Frames if HUB75_FRAMES is not set, about one pass through all demos
+
+/**
+ * @brief Tells the main loop when to stop.
+ *
+ * @param frames Frames flushed so far.
+ * @return true once the number of frames in the environment variable HUB75_FRAMES has been reached.
+ */
+bool host_run_finished(uint32_t frames);
+
+/**
+ * @brief Seed for scene_random_seed().
+ *
+ * @param fallback Seed if HUB75_SEED is not set.
+ */
+uint32_t host_random_seed(uint32_t fallback);
+
+/**
+ * @brief Opens the recording if HUB75_RECORD is set.
+ *
+ * @param format Geometry of the panel.
+ */
+void host_record_start(const RecordingFormat &format);
+
+/**
+ * @brief Records a frame right after update_bgr() has converted it, called on the converting core.
+ *
+ * @param src The RGB888 input of update_bgr().
+ */
+void host_record_frame(const uint8_t *src);
+
+/// @brief Closes the recording and prints its size.
+void host_record_stop();
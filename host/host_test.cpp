@@ -0,0 +1,72 @@
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "lvgl/src/lv_init.h"
+#include "lvgl/src/core/lv_refr.h"
+#include "lvgl/src/tick/lv_tick.h"
+
+#include "host_test.hpp"
+
+static int failures = 0;
+static uint32_t tick_ms = 0;
+static std::vector<uint8_t> draw_buffer;
+static std::vector<uint8_t> flushed;
+
+bool host_check(bool passed, const char *condition, const char *file, int line)
+{
+    if (!passed)
+    {
+        printf("%s:%d: check failed: %s\n", file, line, condition);
+        failures++;
+    }
+    return passed;
+}
+
+int host_test_result()
+{
+    printf("%s, %d failed checks\n", failures ? "FAILED" : "passed", failures);
+    return failures ? 1 : 0;
+}
+
+static uint32_t test_tick()
+{
+    return tick_ms;
+}
+
+static void test_flush_cb(lv_display_t *display, const lv_area_t *, uint8_t *px_map)
+{
+    memcpy(flushed.data(), px_map, flushed.size());
+    lv_display_flush_ready(display);
+}
+
+lv_display_t *host_test_display(uint32_t width, uint32_t height)
+{
+    if (!lv_is_initialized())
+    {
+        lv_init();
+        lv_tick_set_cb(test_tick);
+    }
+    draw_buffer.assign(width * height * 3, 0);
+    flushed.assign(width * height * 3, 0);
+    lv_display_t *display = lv_display_create(width, height);
+    lv_display_set_buffers_with_stride(display, draw_buffer.data(), NULL, draw_buffer.size(), width * 3, LV_DISPLAY_RENDER_MODE_FULL);
+    lv_display_set_flush_cb(display, test_flush_cb);
+    return display;
+}
+
+void host_test_advance(uint32_t ms)
+{
+    tick_ms += ms;
+}
+
+void host_test_render()
+{
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+}
+
+const uint8_t *host_test_frame()
+{
+    return flushed.data();
+}
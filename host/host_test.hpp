@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstdint>
+
+#include "lvgl/src/display/lv_display.h"
+
+// Support of the host tests, run by ctest (see host/CMakeLists.txt). A failed CHECK() prints the
+// condition and its location and the test goes on, so one run reports every failure.
+// main() returns host_test_result().
+
+#define CHECK(condition) host_check((condition), #condition, __FILE__, __LINE__)
+
+/**
+ * @brief Records the outcome of a check and prints it if it has failed.
+ *
+ * @return passed, so a failed check can print more context.
+ */
+bool host_check(bool passed, const char *condition, const char *file, int line);
+
+/// @brief Exit code of the test: 0 if all checks have passed.
+int host_test_result();
+
+/**
+ * @brief Initialises LVGL with a fake tick and creates a full-frame RGB888 display.
+ *
+ * Nothing is converted for a panel: every flush is copied to a frame which host_test_frame() returns.
+ */
+lv_display_t *host_test_display(uint32_t width, uint32_t height);
+
+/// @brief Advances LVGL's tick.
+void host_test_advance(uint32_t ms);
+
+/// @brief Invalidates the active screen and renders it at once.
+void host_test_render();
+
+/// @brief RGB888 content of the last flush, width * 3 bytes per row.
+const uint8_t *host_test_frame();
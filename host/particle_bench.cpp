@@ -0,0 +1,92 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "particle_effect.hpp"
+#include "particle_system.hpp"
+
+// Benchmark of the ParticleSystem presets of the particles scene (particle_presets in
+// particle_effect.cpp): every preset runs with the scene's capacity of 6144 particles and a fixed
+// seed at 64x64 and 128x64. The frames after a warm-up, in which the particle count settles, are
+// timed. Per preset and size: the peak and mean particle count, the median step and resolve time
+// per frame, and the throughput of the step in particles per millisecond.
+//
+//   hub75_particle_bench [--frames N]
+
+#define PARTICLE_BENCH_FRAMES 1000  ///< Timed frames per case if --frames is not given
+#define PARTICLE_BENCH_WARM_UP 120  ///< Untimed frames before each case, longer than the longest lifetime
+#define PARTICLE_BENCH_CAPACITY 6144
+#define PARTICLE_BENCH_SEED 1
+#define PARTICLE_BENCH_ARENA_SIZE (256 * 1024)
+
+static double median(std::vector<double> &us)
+{
+    std::sort(us.begin(), us.end());
+    return us[us.size() / 2];
+}
+
+static void run_case(const ParticleConfig &config, uint16_t width, uint16_t height, uint frames)
+{
+    static uint8_t arena_memory[PARTICLE_BENCH_ARENA_SIZE];
+    static uint8_t pixels[128 * 64 * 3];
+    SceneArena arena(arena_memory, sizeof(arena_memory));
+    ParticleSystem particles;
+    if (!particles.create(width, height, PARTICLE_BENCH_CAPACITY, arena.region(0)))
+    {
+        fprintf(stderr, "no arena memory for %ux%u\n", width, height);
+        exit(EXIT_FAILURE);
+    }
+    particles.seed(PARTICLE_BENCH_SEED);
+    particles.configure(config);
+    for (uint f = 0; f < PARTICLE_BENCH_WARM_UP; f++)
+    {
+        particles.step();
+    }
+
+    std::vector<double> step_us;
+    std::vector<double> resolve_us;
+    uint64_t particle_frames = 0;
+    uint32_t peak = 0;
+    double step_total_us = 0;
+    for (uint f = 0; f < frames; f++)
+    {
+        auto start = std::chrono::steady_clock::now();
+        particles.step();
+        auto stepped = std::chrono::steady_clock::now();
+        particles.resolve(pixels, width * 3, 3);
+        auto resolved = std::chrono::steady_clock::now();
+        step_us.push_back(std::chrono::duration<double, std::micro>(stepped - start).count());
+        resolve_us.push_back(std::chrono::duration<double, std::micro>(resolved - stepped).count());
+        step_total_us += step_us.back();
+        particle_frames += particles.size();
+        peak = std::max(peak, particles.size());
+    }
+
+    printf("%-10s %3ux%-3u %6lu %8.0f %9.1f %11.1f %14.0f\n", config.name, width, height, (unsigned long)peak,
+           static_cast<double>(particle_frames) / frames, median(step_us), median(resolve_us), particle_frames / (step_total_us / 1000));
+}
+
+int main(int argc, char **argv)
+{
+    uint frames = PARTICLE_BENCH_FRAMES;
+    if (argc == 3 && strcmp(argv[1], "--frames") == 0)
+    {
+        frames = std::max(1ul, strtoul(argv[2], nullptr, 10));
+    }
+    else if (argc != 1)
+    {
+        fprintf(stderr, "usage: hub75_particle_bench [--frames N]\n");
+        return EXIT_FAILURE;
+    }
+
+    printf("%-10s %7s %6s %8s %9s %11s %14s\n", "preset", "size", "peak", "mean", "step us", "resolve us", "particles/ms");
+    for (const ParticleConfig &config : particle_presets)
+    {
+        run_case(config, 64, 64, frames);
+        run_case(config, 128, 64, frames);
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,461 @@
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <deque>
+#include <mutex>
+#include <poll.h>
+#include <random>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+#include "pico/stdlib.h"
+#include "pico/stdio.h"
+#include "pico/multicore.h"
+#include "pico/rand.h"
+#include "hardware/clocks.h"
+#include "hardware/dma.h"
+#include "hardware/pio.h"
+#include "hardware/sync.h"
+
+// Pico SDK functions for the host build. Time is the real monotonic clock plus the time skipped by
+// sleeps: a sleep advances the clock instead of waiting, so frames are produced as fast as the host
+// renders them while the scenes see the same timing as on the device. Core 1 is a thread.
+//
+// If the environment variable HUB75_SEED is set, the run is made reproducible: the clock only
+// advances by the sleeps, and a FIFO word pushed by core 0 is only returned from once core 1 has
+// processed it and waits for the next one. The frames then no longer depend on the host's speed.
+
+#define FIFO_DEPTH 4 ///< Words per direction of the inter-core FIFO, as on the RP2350
+
+//--------------------------------------------------------------------------------
+// Time and timers
+//--------------------------------------------------------------------------------
+
+static const std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+static std::atomic<uint64_t> skipped_us{0}; ///< Sum of all sleeps
+
+/// @brief A repeating timer, called from the sleeps of core 0
+struct HostTimer
+{
+    repeating_timer *timer;
+    repeating_timer_callback_t callback;
+    uint64_t period_us;
+    uint64_t due_us;
+};
+
+static std::vector<HostTimer> timers; ///< Only used by core 0
+
+static thread_local uint core_num = 0;
+
+/// @brief true if the run has to be reproducible
+static bool deterministic()
+{
+    static const bool enabled = getenv("HUB75_SEED") != nullptr;
+    return enabled;
+}
+
+uint64_t time_us_64(void)
+{
+    if (deterministic())
+    {
+        return skipped_us;
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start_time;
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count()) + skipped_us;
+}
+
+uint32_t time_us_32(void)
+{
+    return static_cast<uint32_t>(time_us_64());
+}
+
+absolute_time_t get_absolute_time(void)
+{
+    return time_us_64();
+}
+
+/**
+ * @brief Calls the timers which are due, like the timer IRQ would have done during the sleep.
+ */
+static void run_due_timers()
+{
+    uint64_t now = time_us_64();
+    for (size_t i = 0; i < timers.size();)
+    {
+        HostTimer &t = timers[i];
+        if (t.due_us > now)
+        {
+            i++;
+            continue;
+        }
+        t.due_us += t.period_us;
+        if (!t.callback(t.timer))
+        {
+            timers.erase(timers.begin() + i);
+            continue;
+        }
+        i++;
+    }
+}
+
+void sleep_us(uint64_t us)
+{
+    skipped_us += us;
+    if (core_num == 0)
+    {
+        run_due_timers();
+    }
+}
+
+void sleep_ms(uint32_t ms)
+{
+    sleep_us(static_cast<uint64_t>(ms) * 1000);
+}
+
+bool add_repeating_timer_us(int64_t delay_us, repeating_timer_callback_t callback, void *user_data, repeating_timer *out)
+{
+    uint64_t period = static_cast<uint64_t>(delay_us < 0 ? -delay_us : delay_us);
+    out->delay_us = delay_us;
+    out->user_data = user_data;
+    timers.push_back({out, callback, period, time_us_64() + period});
+    return true;
+}
+
+bool add_repeating_timer_ms(int32_t delay_ms, repeating_timer_callback_t callback, void *user_data, repeating_timer *out)
+{
+    return add_repeating_timer_us(static_cast<int64_t>(delay_ms) * 1000, callback, user_data, out);
+}
+
+bool cancel_repeating_timer(repeating_timer *timer)
+{
+    for (size_t i = 0; i < timers.size(); i++)
+    {
+        if (timers[i].timer == timer)
+        {
+            timers.erase(timers.begin() + i);
+            return true;
+        }
+    }
+    return false;
+}
+
+//--------------------------------------------------------------------------------
+// Clocks, stdio, critical sections, random numbers
+//--------------------------------------------------------------------------------
+
+static uint32_t sys_clock_hz = 150000000;
+
+bool set_sys_clock_khz(uint32_t freq_khz, bool)
+{
+    sys_clock_hz = freq_khz * 1000;
+    return true;
+}
+
+uint32_t clock_get_hz(enum clock_index)
+{
+    return sys_clock_hz;
+}
+
+bool stdio_init_all(void)
+{
+    return true;
+}
+
+static std::deque<uint8_t> stdio_input; ///< Bytes queued by host_stdio_feed(), read by core 0 only
+static int stdio_fd = -1;               ///< Set by host_stdio_connect(), replaces the queue
+
+void host_stdio_feed(const void *data, size_t size)
+{
+    const uint8_t *bytes = static_cast<const uint8_t *>(data);
+    stdio_input.insert(stdio_input.end(), bytes, bytes + size);
+}
+
+void host_stdio_connect(int fd)
+{
+    stdio_fd = fd;
+}
+
+/// @brief Reads what is available from the connected descriptor without waiting, like the USB CDC buffer
+static int stdio_read_fd(char *buf, int len)
+{
+    pollfd ready = {stdio_fd, POLLIN, 0};
+    if (poll(&ready, 1, 0) <= 0)
+    {
+        return PICO_ERROR_TIMEOUT;
+    }
+    ssize_t n = read(stdio_fd, buf, len);
+    return n > 0 ? static_cast<int>(n) : PICO_ERROR_TIMEOUT;
+}
+
+int getchar_timeout_us(uint32_t)
+{
+    if (stdio_fd >= 0)
+    {
+        char c;
+        return stdio_read_fd(&c, 1) == 1 ? static_cast<uint8_t>(c) : PICO_ERROR_TIMEOUT;
+    }
+    if (stdio_input.empty())
+    {
+        return PICO_ERROR_TIMEOUT; // Nothing is streamed to the host build
+    }
+    int c = stdio_input.front();
+    stdio_input.pop_front();
+    return c;
+}
+
+int stdio_get_until(char *buf, int len, absolute_time_t)
+{
+    if (stdio_fd >= 0)
+    {
+        return stdio_read_fd(buf, len);
+    }
+    if (stdio_input.empty())
+    {
+        return PICO_ERROR_TIMEOUT;
+    }
+    int n = 0;
+    while (n < len && !stdio_input.empty())
+    {
+        buf[n++] = static_cast<char>(stdio_input.front());
+        stdio_input.pop_front();
+    }
+    return n;
+}
+
+uint get_core_num(void)
+{
+    return core_num;
+}
+
+static std::recursive_mutex &interrupt_lock = *new std::recursive_mutex; // Never destroyed, core 1 may still hold it at exit
+
+void critical_section_init(critical_section_t *)
+{
+}
+
+void critical_section_enter_blocking(critical_section_t *)
+{
+    interrupt_lock.lock();
+}
+
+void critical_section_exit(critical_section_t *)
+{
+    interrupt_lock.unlock();
+}
+
+uint32_t save_and_disable_interrupts(void)
+{
+    return 0;
+}
+
+void restore_interrupts(uint32_t)
+{
+}
+
+uint32_t get_rand_32(void)
+{
+    if (deterministic())
+    {
+        return static_cast<uint32_t>(time_us_64() * 2654435761u); // Reproducible like the clock
+    }
+    static std::random_device device;
+    return device();
+}
+
+//--------------------------------------------------------------------------------
+// Multicore
+//--------------------------------------------------------------------------------
+
+/// @brief One direction of the inter-core FIFO
+struct HostFifo
+{
+    std::mutex lock;
+    std::condition_variable changed;
+    std::deque<uint32_t> words;
+    bool receiver_waiting = false; ///< The receiving core has taken all words and waits for the next
+};
+
+static HostFifo *fifos = new HostFifo[2]; ///< Indexed by the receiving core, never destroyed as core 1 waits on it at exit
+
+void multicore_reset_core1(void)
+{
+}
+
+void multicore_launch_core1(void (*entry)(void))
+{
+    std::thread([entry] {
+        core_num = 1;
+        entry();
+    }).detach();
+}
+
+void multicore_fifo_push_blocking(uint32_t data)
+{
+    HostFifo &fifo = fifos[core_num ^ 1];
+    std::unique_lock<std::mutex> guard(fifo.lock);
+    fifo.changed.wait(guard, [&fifo] { return fifo.words.size() < FIFO_DEPTH; });
+    fifo.words.push_back(data);
+    fifo.receiver_waiting = false;
+    fifo.changed.notify_all();
+    if (deterministic() && core_num == 0)
+    {
+        // Lockstep: core 1 has finished with the word when it waits for the next one
+        fifo.changed.wait(guard, [&fifo] { return fifo.receiver_waiting; });
+    }
+}
+
+uint32_t multicore_fifo_pop_blocking(void)
+{
+    HostFifo &fifo = fifos[core_num];
+    std::unique_lock<std::mutex> guard(fifo.lock);
+    if (fifo.words.empty())
+    {
+        fifo.receiver_waiting = true;
+        fifo.changed.notify_all();
+    }
+    fifo.changed.wait(guard, [&fifo] { return !fifo.words.empty(); });
+    uint32_t data = fifo.words.front();
+    fifo.words.pop_front();
+    fifo.changed.notify_all();
+    return data;
+}
+
+bool multicore_fifo_pop_timeout_us(uint64_t timeout_us, uint32_t *out)
+{
+    HostFifo &fifo = fifos[core_num];
+    std::unique_lock<std::mutex> guard(fifo.lock);
+    if (!fifo.changed.wait_for(guard, std::chrono::microseconds(timeout_us), [&fifo] { return !fifo.words.empty(); }))
+    {
+        return false;
+    }
+    *out = fifo.words.front();
+    fifo.words.pop_front();
+    fifo.changed.notify_all();
+    return true;
+}
+
+bool multicore_fifo_rvalid(void)
+{
+    HostFifo &fifo = fifos[core_num];
+    std::lock_guard<std::mutex> guard(fifo.lock);
+    return !fifo.words.empty();
+}
+
+bool multicore_fifo_wready(void)
+{
+    HostFifo &fifo = fifos[core_num ^ 1];
+    std::lock_guard<std::mutex> guard(fifo.lock);
+    return fifo.words.size() < FIFO_DEPTH;
+}
+
+void multicore_fifo_drain(void)
+{
+    HostFifo &fifo = fifos[core_num];
+    std::lock_guard<std::mutex> guard(fifo.lock);
+    fifo.words.clear();
+    fifo.changed.notify_all();
+}
+
+//--------------------------------------------------------------------------------
+// PIO, DMA and IRQ: configuration is accepted, nothing is transferred. Claims always succeed
+// and wrap around, so the benchmark can create the driver once per panel size.
+//--------------------------------------------------------------------------------
+
+static pio_hw_t pio_blocks[2];
+static uint next_sm[2];
+static dma_hw_t dma_block;
+dma_hw_t *dma_hw = &dma_block;
+static int next_dma_channel = 0;
+
+bool pio_claim_free_sm_and_add_program(const pio_program_t *, PIO *pio, uint *sm, uint *offset)
+{
+    uint block = next_sm[0] < 4 ? 0 : 1;
+    if (next_sm[1] >= 4)
+    {
+        next_sm[0] = next_sm[1] = 0;
+        block = 0;
+    }
+    *pio = &pio_blocks[block];
+    *sm = next_sm[block]++;
+    *offset = 0;
+    return true;
+}
+
+int pio_claim_unused_sm(PIO pio, bool)
+{
+    uint &sm = next_sm[pio == &pio_blocks[0] ? 0 : 1];
+    return static_cast<int>(sm++ % 4);
+}
+
+uint pio_get_dreq(PIO, uint sm, bool is_tx)
+{
+    return sm + (is_tx ? 0 : 4);
+}
+
+void pio_sm_set_clkdiv_int_frac(PIO, uint, uint16_t, uint8_t)
+{
+}
+
+void pio_clkdiv_restart_sm_mask(PIO, uint32_t)
+{
+}
+
+int dma_claim_unused_channel(bool)
+{
+    return next_dma_channel++ % 16;
+}
+
+dma_channel_config dma_channel_get_default_config(uint)
+{
+    return {0};
+}
+
+void channel_config_set_transfer_data_size(dma_channel_config *, enum dma_channel_transfer_size)
+{
+}
+
+void channel_config_set_read_increment(dma_channel_config *, bool)
+{
+}
+
+void channel_config_set_write_increment(dma_channel_config *, bool)
+{
+}
+
+void channel_config_set_dreq(dma_channel_config *, uint)
+{
+}
+
+void channel_config_set_chain_to(dma_channel_config *, uint)
+{
+}
+
+void dma_channel_configure(uint, const dma_channel_config *, volatile void *, const volatile void *, uint, bool)
+{
+}
+
+void dma_channel_set_read_addr(uint, const volatile void *, bool)
+{
+}
+
+void dma_channel_set_write_addr(uint, volatile void *, bool)
+{
+}
+
+void dma_channel_set_irq0_enabled(uint, bool)
+{
+}
+
+void dma_start_channel_mask(uint32_t)
+{
+}
+
+void irq_set_exclusive_handler(uint, irq_handler_t)
+{
+}
+
+void irq_set_enabled(uint, bool)
+{
+}
@@ -0,0 +1,164 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "pico/stdlib.h"
+
+#include "hub75.hpp"
+#include "lvgl/src/lv_init.h"
+#include "lvgl/src/core/lv_refr.h"
+#include "lvgl/src/display/lv_display.h"
+#include "lvgl/src/draw/lv_draw.h"
+#include "lvgl/src/misc/lv_timer.h"
+#include "lvgl/src/tick/lv_tick.h"
+
+#include "bouncing_balls.hpp"
+#include "colour_check.hpp"
+#include "fire_effect.hpp"
+#include "heap_stats.hpp"
+#include "image_animation.hpp"
+#include "scene_manager.hpp"
+#include "scene_random.hpp"
+
+// Benchmark of the draw task pool (LV_DRAW_TASK_POOL_SIZE in lv_conf.h): every scene renders at 64x64
+// with the pool and with lv_draw_set_task_pool_size(0), which allocates every draw task and layer,
+// alternating over several rounds so that drift of the host's speed hits both alike. The LVGL allocator
+// calls are counted by heap_stats through the allocation hook. Per case: allocations and frees per frame,
+// the median over the rounds of the median render time per frame, the spread of the rounds' medians,
+// and the fragmentation at the end.
+//
+//   hub75_pool_bench [--frames N]
+
+#define POOL_BENCH_FRAMES 1000    ///< Timed frames per case if --frames is not given
+#define POOL_BENCH_WARM_UP 10     ///< Untimed frames before each case, they fill the pool
+#define POOL_BENCH_ROUNDS 5       ///< Alternating runs with and without the pool per scene
+#define POOL_BENCH_FRAME_MS 16    ///< Tick advance per frame
+#define POOL_BENCH_WIDTH 64
+#define POOL_BENCH_HEIGHT 64
+#define POOL_BENCH_ARENA_SIZE (256 * 1024)
+
+static uint32_t bench_ms = 0;
+
+static uint32_t bench_tick()
+{
+    return bench_ms;
+}
+
+static void bench_flush_cb(lv_display_t *display, const lv_area_t *, uint8_t *px_map)
+{
+    update_bgr(px_map);
+    lv_display_flush_ready(display);
+}
+
+/**
+ * @brief Renders one full frame and closes its allocation count.
+ */
+static void run_frame(SceneManager &sceneManager)
+{
+    bench_ms += POOL_BENCH_FRAME_MS;
+    sceneManager.update();
+    lv_obj_invalidate(lv_screen_active());
+    lv_timer_handler();
+    heap_stats_frame();
+}
+
+/// @brief Outcome of the rounds of one case
+struct PoolCase
+{
+    std::vector<double> render_us; ///< Median render time of every round
+    HeapSummary summary;           ///< Of the last round
+};
+
+/**
+ * @brief Renders the frames of the loaded scene with the given pool limit and adds the round to the case.
+ */
+static void run_round(SceneManager &sceneManager, uint32_t pool_size, uint frames, PoolCase &result)
+{
+    lv_draw_set_task_pool_size(pool_size);
+    for (uint f = 0; f < POOL_BENCH_WARM_UP; f++)
+    {
+        run_frame(sceneManager);
+    }
+    heap_stats_reset();
+
+    std::vector<double> render_us;
+    for (uint f = 0; f < frames; f++)
+    {
+        auto start = std::chrono::steady_clock::now();
+        run_frame(sceneManager);
+        render_us.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count());
+    }
+    std::sort(render_us.begin(), render_us.end());
+    result.render_us.push_back(render_us[render_us.size() / 2]);
+    heap_stats_summary(result.summary);
+}
+
+static void print_case(const char *scene, bool pool, uint frames, PoolCase &result)
+{
+    std::sort(result.render_us.begin(), result.render_us.end());
+    const HeapSummary &summary = result.summary;
+    printf("%-14s %-5s %8.1f %8.1f %10.1f %6.1f..%-6.1f %6u%%\n", scene, pool ? "on" : "off", (summary.allocs + summary.reallocs) / double(frames),
+           summary.frees / double(frames), result.render_us[result.render_us.size() / 2], result.render_us.front(), result.render_us.back(),
+           summary.frag_pct);
+}
+
+int main(int argc, char **argv)
+{
+    uint frames = POOL_BENCH_FRAMES;
+    if (argc == 3 && strcmp(argv[1], "--frames") == 0)
+    {
+        frames = std::max(1ul, strtoul(argv[2], nullptr, 10));
+    }
+    else if (argc != 1)
+    {
+        fprintf(stderr, "usage: hub75_pool_bench [--frames N]\n");
+        return EXIT_FAILURE;
+    }
+
+    lv_init();
+    lv_tick_set_cb(bench_tick);
+    heap_stats_start();
+    scene_random_seed(1);
+
+    static uint8_t arena_memory[POOL_BENCH_ARENA_SIZE];
+    create_hub75_driver(POOL_BENCH_WIDTH, POOL_BENCH_HEIGHT, 0, MULTIPLEX_LINEAR, 1);
+    size_t buffer_size = POOL_BENCH_WIDTH * POOL_BENCH_HEIGHT * 3;
+    uint8_t *buffer = new uint8_t[buffer_size];
+    lv_display_t *display = lv_display_create(POOL_BENCH_WIDTH, POOL_BENCH_HEIGHT);
+    lv_display_set_buffers_with_stride(display, buffer, NULL, buffer_size, POOL_BENCH_WIDTH * 3, LV_DISPLAY_RENDER_MODE_FULL);
+    lv_display_set_flush_cb(display, bench_flush_cb);
+
+    BouncingBalls bouncingBalls(15, POOL_BENCH_WIDTH, POOL_BENCH_HEIGHT);
+    FireEffect fireEffect(POOL_BENCH_WIDTH, POOL_BENCH_HEIGHT);
+    ImageAnimation imageAnimation(POOL_BENCH_WIDTH, POOL_BENCH_HEIGHT);
+    ColourCheck colourCheck(POOL_BENCH_WIDTH, POOL_BENCH_HEIGHT);
+    Scene *scenes[] = {&bouncingBalls, &fireEffect, &imageAnimation, &colourCheck};
+    const size_t count = sizeof(scenes) / sizeof(scenes[0]);
+    SceneManager sceneManager(scenes, count, arena_memory, POOL_BENCH_ARENA_SIZE);
+
+    printf("%-14s %-5s %8s %8s %10s %14s %7s\n", "scene", "pool", "allocs", "frees", "render us", "rounds us", "frag");
+    for (size_t i = 0; i < count; i++)
+    {
+        if (!sceneManager.load(i))
+        {
+            fprintf(stderr, "failed to create %s\n", scenes[i]->name());
+            return EXIT_FAILURE;
+        }
+        while (sceneManager.in_transition())
+        {
+            run_frame(sceneManager);
+        }
+        PoolCase with_pool, without_pool;
+        for (uint round = 0; round < POOL_BENCH_ROUNDS; round++)
+        {
+            run_round(sceneManager, LV_DRAW_TASK_POOL_SIZE, frames, with_pool);
+            run_round(sceneManager, 0, frames, without_pool);
+        }
+        print_case(scenes[i]->name(), true, frames, with_pool);
+        print_case(scenes[i]->name(), false, frames, without_pool);
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,143 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "hub75.hpp"
+
+#include "frame_recording.hpp"
+
+// Replays a recording of the host build through the converter: every recorded RGB888 frame is passed
+// to update_bgr() and the frame buffer is compared bit-exactly with the recorded one. A changed
+// converter is checked against the recording of the unchanged one, and its speed is measured on
+// real scene content instead of synthetic patterns.
+//
+//   hub75_replay FILE [--full] [--dither] [--repeat N]
+//
+// --full invalidates the frame before every conversion, so unchanged rows are converted as well.
+// --dither enables temporal dithering. The recording holds undithered frame buffers, so each frame is
+// compared with a complete dithered conversion of the same input instead.
+// --repeat converts the recording N times for more stable timings. The exit code is 1 on a mismatch.
+
+static void usage()
+{
+    fprintf(stderr, "usage: hub75_replay FILE [--full] [--dither] [--repeat N]\n");
+    exit(EXIT_FAILURE);
+}
+
+int main(int argc, char **argv)
+{
+    const char *path = nullptr;
+    bool full = false;
+    bool dither = false;
+    uint repeat = 1;
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--full") == 0)
+        {
+            full = true;
+        }
+        else if (strcmp(argv[i], "--dither") == 0)
+        {
+            dither = true;
+        }
+        else if (strcmp(argv[i], "--repeat") == 0 && i + 1 < argc)
+        {
+            repeat = std::max(1ul, strtoul(argv[++i], nullptr, 10));
+        }
+        else if (path == nullptr && argv[i][0] != '-')
+        {
+            path = argv[i];
+        }
+        else
+        {
+            usage();
+        }
+    }
+    if (path == nullptr)
+    {
+        usage();
+    }
+
+    FrameReader reader;
+    if (!reader.open(path))
+    {
+        fprintf(stderr, "Cannot read recording %s\n", path);
+        return EXIT_FAILURE;
+    }
+    const RecordingFormat &format = reader.get_format();
+    create_hub75_driver(format.width, format.height, format.scan, static_cast<Multiplex>(format.multiplex), format.chains, format.panel_width);
+    if (dither)
+    {
+        enable_hub75_dithering();
+    }
+    const size_t words = static_cast<size_t>(format.width) * format.height;
+    std::vector<uint8_t> input(words * 3); // update_bgr() takes a non-const buffer
+    std::vector<uint32_t> converted(words);
+
+    std::vector<double> convert_us;
+    uint32_t frames = 0;
+    uint32_t mismatches = 0;
+    for (uint pass = 0; pass < repeat; pass++)
+    {
+        reader.rewind();
+        invalidate_frame(); // The recording starts with the driver's first conversion
+        for (uint32_t frame = 0; reader.next(); frame++)
+        {
+            memcpy(input.data(), reader.input(), input.size());
+            if (full)
+            {
+                invalidate_frame();
+            }
+            auto start = std::chrono::steady_clock::now();
+            update_bgr(input.data());
+            convert_us.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count());
+            frames++;
+
+            const uint32_t *expected = reader.output();
+            const uint32_t *got = const_cast<const uint32_t *>(frame_buffer);
+            if (dither)
+            {
+                // Converting again leaves the row fingerprints as they were
+                converted.assign(got, got + words);
+                invalidate_frame();
+                update_bgr(input.data());
+                expected = got;
+                got = converted.data();
+            }
+            if (memcmp(expected, got, words * sizeof(uint32_t)) != 0)
+            {
+                size_t index = 0;
+                while (expected[index] == got[index])
+                {
+                    index++;
+                }
+                if (mismatches == 0)
+                {
+                    printf("frame %u differs first at word %zu (row %zu, column %zu): expected %08x, got %08x\n", frame, index,
+                           index / format.width, index % format.width, expected[index], got[index]);
+                }
+                mismatches++;
+            }
+        }
+    }
+    if (frames == 0)
+    {
+        fprintf(stderr, "%s holds no frames\n", path);
+        return EXIT_FAILURE;
+    }
+
+    double sum = 0;
+    for (double us : convert_us)
+    {
+        sum += us;
+    }
+    std::sort(convert_us.begin(), convert_us.end());
+    double average = sum / convert_us.size();
+    printf("%ux%u, %u frames%s%s: update_bgr() p50 %.1f us, avg %.1f us, max %.1f us, %.2f ns per pixel\n", format.width, format.height,
+           frames, full ? " (full)" : "", dither ? " (dithered)" : "", convert_us[convert_us.size() / 2], average, convert_us.back(), average * 1000 / words);
+    printf("%u of %u frames differ from %s\n", mismatches, frames, dither ? "a complete conversion" : "the recording");
+    return mismatches ? 1 : 0;
+}
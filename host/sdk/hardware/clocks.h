@@ -0,0 +1,11 @@
+#pragma once
+
+#include "pico.h"
+
+enum clock_index
+{
+    clk_sys = 5
+};
+
+/// @brief Returns the frequency set by set_sys_clock_khz(), the driver derives its timing from it.
+uint32_t clock_get_hz(enum clock_index clk_index);
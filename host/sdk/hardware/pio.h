@@ -0,0 +1,31 @@
+#pragma once
+
+#include "pico.h"
+
+// PIO blocks are plain memory: FIFO writes are stored and never shifted out
+
+typedef struct
+{
+    volatile uint32_t txf[4];
+    volatile uint32_t rxf[4];
+    volatile uint16_t instr_mem[32];
+} pio_hw_t;
+typedef pio_hw_t *PIO;
+
+typedef struct
+{
+    uint32_t unused;
+} pio_sm_config;
+
+typedef struct
+{
+    const uint16_t *instructions;
+    uint8_t length;
+    int8_t origin;
+} pio_program_t;
+
+bool pio_claim_free_sm_and_add_program(const pio_program_t *program, PIO *pio, uint *sm, uint *offset);
+int pio_claim_unused_sm(PIO pio, bool required);
+uint pio_get_dreq(PIO pio, uint sm, bool is_tx);
+void pio_sm_set_clkdiv_int_frac(PIO pio, uint sm, uint16_t div_int, uint8_t div_frac);
+void pio_clkdiv_restart_sm_mask(PIO pio, uint32_t mask);
@@ -0,0 +1,6 @@
+#pragma once
+
+#include "pico.h"
+
+uint32_t save_and_disable_interrupts(void);
+void restore_interrupts(uint32_t status);
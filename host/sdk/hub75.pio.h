@@ -0,0 +1,13 @@
+#pragma once
+
+// Host replacement for the header pioasm generates from hub75.pio: the programs are empty and
+// their helpers do nothing, no pixels are shifted out.
+
+#include "hardware/pio.h"
+
+static const pio_program_t hub75_row_program = {nullptr, 0, -1};
+static const pio_program_t hub75_data_rgb888_program = {nullptr, 0, -1};
+
+static inline void hub75_row_program_init(PIO, uint, uint, uint, uint, uint) {}
+static inline void hub75_data_rgb888_program_init(PIO, uint, uint, uint, uint) {}
+static inline void hub75_data_rgb888_set_shift(PIO, uint, uint, uint) {}
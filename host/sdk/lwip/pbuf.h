@@ -0,0 +1,16 @@
+#pragma once
+
+// Types used in network_receiver.hpp, the receiver itself is not part of the host build
+
+#include <stdint.h>
+
+typedef uint8_t u8_t;
+typedef uint16_t u16_t;
+
+struct pbuf
+{
+    struct pbuf *next;
+    void *payload;
+    u16_t tot_len;
+    u16_t len;
+};
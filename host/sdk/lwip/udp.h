@@ -0,0 +1,11 @@
+#pragma once
+
+#include "lwip/pbuf.h"
+
+typedef struct ip4_addr
+{
+    uint32_t addr;
+} ip4_addr_t;
+typedef ip4_addr_t ip_addr_t;
+
+struct udp_pcb;
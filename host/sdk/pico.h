@@ -0,0 +1,23 @@
+#pragma once
+
+// Host stand-in for the Pico SDK: only the declarations used by this project. The functions are
+// implemented in host/pico_host.cpp, hardware blocks (PIO, DMA, IRQ) are accepted and ignored.
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+typedef unsigned int uint;
+
+#define __unused __attribute__((unused))
+#define __not_in_flash_func(f) f
+#define __time_critical_func(f) f
+#define __scratch_x(n)
+#define __scratch_y(n)
+#define __in_flash(n)
+
+static inline void tight_loop_contents(void) {}
+static inline void __wfe(void) {}
+static inline void __sev(void) {}
+static inline void __dmb(void) { __atomic_thread_fence(__ATOMIC_SEQ_CST); }
+static inline void __compiler_memory_barrier(void) { __asm__ volatile("" ::: "memory"); }
@@ -0,0 +1,14 @@
+#pragma once
+
+#include "pico.h"
+
+// Core 1 is a thread, each direction of the inter-core FIFO a blocking queue of 4 words
+
+void multicore_reset_core1(void);
+void multicore_launch_core1(void (*entry)(void));
+void multicore_fifo_push_blocking(uint32_t data);
+uint32_t multicore_fifo_pop_blocking(void);
+bool multicore_fifo_pop_timeout_us(uint64_t timeout_us, uint32_t *out);
+bool multicore_fifo_rvalid(void);
+bool multicore_fifo_wready(void);
+void multicore_fifo_drain(void);
@@ -0,0 +1,7 @@
+#pragma once
+
+#include "pico.h"
+
+// pico_rand: the host's random device instead of the ring oscillator and the other entropy sources
+
+uint32_t get_rand_32(void);
@@ -0,0 +1,17 @@
+#pragma once
+
+#include "pico/stdlib.h"
+
+#include <cstddef>
+
+/**
+ * @brief Host build only: queues bytes for stdio_get_until() and getchar_timeout_us(), as if a host
+ * had sent them over USB CDC. Without queued bytes both time out as before.
+ */
+void host_stdio_feed(const void *data, size_t size);
+
+/**
+ * @brief Host build only: stdio_get_until() and getchar_timeout_us() read what is available from fd,
+ * e.g. one end of a pty, instead of the queue. -1 goes back to the queue.
+ */
+void host_stdio_connect(int fd);
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <stdio.h>
+
+#include "pico.h"
+
+#define PICO_ERROR_TIMEOUT -1
+
+typedef uint64_t absolute_time_t; ///< Microseconds since boot
+
+absolute_time_t get_absolute_time(void);
+static inline uint32_t to_ms_since_boot(absolute_time_t t) { return (uint32_t)(t / 1000); }
+static inline uint64_t to_us_since_boot(absolute_time_t t) { return t; }
+
+/// @brief Time since start in microseconds. Sleeps advance it without waiting, see host/pico_host.cpp.
+uint64_t time_us_64(void);
+uint32_t time_us_32(void);
+void sleep_ms(uint32_t ms);
+void sleep_us(uint64_t us);
+
+bool set_sys_clock_khz(uint32_t freq_khz, bool required);
+bool stdio_init_all(void);
+int getchar_timeout_us(uint32_t timeout_us);
+int stdio_get_until(char *buf, int len, absolute_time_t until);
+uint get_core_num(void);
+
+typedef struct
+{
+    int unused;
+} critical_section_t;
+void critical_section_init(critical_section_t *crit_sec);
+void critical_section_enter_blocking(critical_section_t *crit_sec);
+void critical_section_exit(critical_section_t *crit_sec);
+
+struct repeating_timer
+{
+    int64_t delay_us;
+    void *user_data;
+};
+typedef bool (*repeating_timer_callback_t)(struct repeating_timer *rt);
+
+/// @brief Repeating timers are called from sleep_ms() / sleep_us() of core 0 once they are due.
+bool add_repeating_timer_ms(int32_t delay_ms, repeating_timer_callback_t callback, void *user_data, struct repeating_timer *out);
+bool add_repeating_timer_us(int64_t delay_us, repeating_timer_callback_t callback, void *user_data, struct repeating_timer *out);
+bool cancel_repeating_timer(struct repeating_timer *timer);
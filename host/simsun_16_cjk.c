@@ -0,0 +1,7 @@
+/* SimSun 16 CJK for the text strip test and benchmark. The firmware disables it in lv_conf.h to save
+ * flash, so LVGL does not build it and the host targets compile it here. */
+#include "lvgl/lvgl.h"
+
+#undef LV_FONT_SIMSUN_16_CJK
+#define LV_FONT_SIMSUN_16_CJK 1
+#include "lvgl/src/font/lv_font_simsun_16_cjk.c"
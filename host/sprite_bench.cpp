@@ -0,0 +1,316 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "lvgl/src/lv_init.h"
+#include "lvgl/src/core/lv_obj.h"
+#include "lvgl/src/core/lv_refr.h"
+#include "lvgl/src/display/lv_display.h"
+#include "lvgl/src/misc/lv_timer.h"
+#include "lvgl/src/stdlib/lv_mem.h"
+#include "lvgl/src/tick/lv_tick.h"
+#include "lvgl/src/widgets/image/lv_image.h"
+
+#include "heap_stats.hpp"
+#include "sprite_layer.hpp"
+
+// Benchmark of SpriteLayer against one lv_image object per sprite: a 128x64 display in full render
+// mode without conversion for the panel, 7x7 ARGB8888 balls with an antialiased rim, every eighth
+// one half transparent, all moving on every frame. The objects are created only while the LVGL heap
+// has room for them and for their draw tasks. Per sprite count: the median render time per frame
+// and the LVGL allocations per frame of both, and the largest difference of a colour channel between
+// them, compared after every frame. The exit code is 1 if the difference exceeds
+// SPRITE_BENCH_MAX_DIFF or the layer misses the 60 fps frame budget with SPRITE_BENCH_TARGET sprites.
+//
+//   hub75_sprite_bench [--frames N]
+
+#define SPRITE_BENCH_FRAMES 300     ///< Timed frames per case if --frames is not given
+#define SPRITE_BENCH_FRAME_MS 16    ///< Tick advance per frame
+#define SPRITE_BENCH_WIDTH 128
+#define SPRITE_BENCH_HEIGHT 64
+#define SPRITE_BENCH_BALL 7         ///< Ball width and height in pixels
+#define SPRITE_BENCH_MAX_DIFF 2     ///< Largest allowed difference per channel between layer and objects, from rounding
+#define SPRITE_BENCH_TARGET 1000    ///< Sprites the layer has to draw within the frame budget
+#define SPRITE_BENCH_BUDGET_US (1000000.0 / 60)
+#define SPRITE_BENCH_HEAP_PER_OBJECT 256 ///< LVGL heap kept free per object for its draw task while rendering
+#define SPRITE_BENCH_ARENA_SIZE (128 * 1024)
+
+/// @brief Position and velocity of a sprite in 1/16 pixel
+struct Mover
+{
+    int32_t x, y, vx, vy;
+};
+
+static uint32_t bench_ms = 0;
+static uint8_t *buffer = nullptr;
+static lv_color32_t ball[SPRITE_BENCH_BALL * SPRITE_BENCH_BALL];
+
+static uint32_t bench_tick()
+{
+    return bench_ms;
+}
+
+static void bench_flush_cb(lv_display_t *display, const lv_area_t *, uint8_t *)
+{
+    lv_display_flush_ready(display);
+}
+
+/**
+ * @brief Draws a shaded ball with a half transparent rim.
+ */
+static void create_ball()
+{
+    const int32_t r = SPRITE_BENCH_BALL / 2;
+    for (int32_t y = 0; y < SPRITE_BENCH_BALL; y++)
+    {
+        for (int32_t x = 0; x < SPRITE_BENCH_BALL; x++)
+        {
+            int32_t d = (x - r) * (x - r) + (y - r) * (y - r);
+            uint8_t shade = static_cast<uint8_t>(255 - 20 * (x + y));
+            lv_color32_t &c = ball[y * SPRITE_BENCH_BALL + x];
+            c = {static_cast<uint8_t>(shade / 4), static_cast<uint8_t>(shade / 2), shade, 255};
+            c.alpha = d <= (r - 1) * (r - 1) + 1 ? 255 : d <= r * r + 1 ? 128 : 0;
+        }
+    }
+}
+
+/**
+ * @brief The same start positions and velocities for every run of a sprite count.
+ */
+static std::vector<Mover> create_movers(uint32_t count)
+{
+    uint32_t state = 12345;
+    auto next = [&](uint32_t n) {
+        state = state * 1103515245u + 12345u;
+        return (state >> 8) % n;
+    };
+    std::vector<Mover> movers(count);
+    for (Mover &m : movers)
+    {
+        m.x = next((SPRITE_BENCH_WIDTH - SPRITE_BENCH_BALL) << 4);
+        m.y = next((SPRITE_BENCH_HEIGHT - SPRITE_BENCH_BALL) << 4);
+        m.vx = static_cast<int32_t>(next(31)) - 15;
+        m.vy = static_cast<int32_t>(next(31)) - 15;
+    }
+    return movers;
+}
+
+static void move(std::vector<Mover> &movers)
+{
+    for (Mover &m : movers)
+    {
+        m.x += m.vx;
+        m.y += m.vy;
+        if (m.x < 0 || m.x > (SPRITE_BENCH_WIDTH - SPRITE_BENCH_BALL) << 4)
+        {
+            m.vx = -m.vx;
+            m.x += 2 * m.vx;
+        }
+        if (m.y < 0 || m.y > (SPRITE_BENCH_HEIGHT - SPRITE_BENCH_BALL) << 4)
+        {
+            m.vy = -m.vy;
+            m.y += 2 * m.vy;
+        }
+    }
+}
+
+static lv_opa_t opacity(uint32_t i)
+{
+    return i % 8 == 0 ? LV_OPA_50 : LV_OPA_COVER;
+}
+
+/**
+ * @brief Renders one frame and returns its render time.
+ */
+static double render(bool invalidate_screen)
+{
+    auto start = std::chrono::steady_clock::now();
+    bench_ms += SPRITE_BENCH_FRAME_MS;
+    if (invalidate_screen)
+    {
+        lv_obj_invalidate(lv_screen_active());
+    }
+    lv_timer_handler();
+    double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    heap_stats_frame();
+    return us;
+}
+
+static double median(std::vector<double> &us)
+{
+    std::sort(us.begin(), us.end());
+    return us[us.size() / 2];
+}
+
+static double allocs_per_frame(uint frames)
+{
+    HeapSummary summary;
+    heap_stats_summary(summary);
+    return (summary.allocs + summary.reallocs) / double(frames);
+}
+
+/**
+ * @brief Renders the frames with lv_image objects and keeps every frame for the comparison.
+ *
+ * @return false if the LVGL heap has no room for the objects.
+ */
+static bool run_objects(uint32_t count, uint frames, double &us, double &allocs, std::vector<uint8_t> &frames_out)
+{
+    static const lv_image_dsc_t ball_dsc = [] {
+        lv_image_dsc_t dsc = {};
+        dsc.header.magic = LV_IMAGE_HEADER_MAGIC;
+        dsc.header.cf = LV_COLOR_FORMAT_ARGB8888;
+        dsc.header.w = SPRITE_BENCH_BALL;
+        dsc.header.h = SPRITE_BENCH_BALL;
+        dsc.header.stride = SPRITE_BENCH_BALL * 4;
+        dsc.data_size = sizeof(ball);
+        dsc.data = reinterpret_cast<const uint8_t *>(ball);
+        return dsc;
+    }();
+
+    lv_obj_t *screen = lv_screen_active();
+    std::vector<lv_obj_t *> images;
+    for (uint32_t i = 0; i < count; i++)
+    {
+        lv_mem_monitor_t monitor;
+        lv_mem_monitor(&monitor);
+        if (monitor.free_biggest_size < (count - i + 4) * SPRITE_BENCH_HEAP_PER_OBJECT)
+        {
+            lv_obj_clean(screen);
+            return false;
+        }
+        lv_obj_t *image = lv_image_create(screen);
+        lv_image_set_src(image, &ball_dsc);
+        lv_obj_set_style_image_opa(image, opacity(i), LV_PART_MAIN);
+        images.push_back(image);
+    }
+
+    std::vector<Mover> movers = create_movers(count);
+    std::vector<double> render_us;
+    heap_stats_reset();
+    for (uint f = 0; f < frames; f++)
+    {
+        move(movers);
+        for (uint32_t i = 0; i < count; i++)
+        {
+            lv_obj_set_pos(images[i], movers[i].x >> 4, movers[i].y >> 4);
+        }
+        render_us.push_back(render(f == 0));
+        frames_out.insert(frames_out.end(), buffer, buffer + SPRITE_BENCH_WIDTH * SPRITE_BENCH_HEIGHT * 3);
+    }
+    us = median(render_us);
+    allocs = allocs_per_frame(frames);
+    lv_obj_clean(screen);
+    return true;
+}
+
+/**
+ * @brief Renders the frames with a sprite layer and returns the largest channel difference to the objects' frames.
+ */
+static uint32_t run_layer(uint32_t count, uint frames, double &us, double &allocs, const std::vector<uint8_t> &expected)
+{
+    static uint8_t arena_memory[SPRITE_BENCH_ARENA_SIZE];
+    SceneArena arena(arena_memory, sizeof(arena_memory));
+    SpriteImage image = {reinterpret_cast<const uint8_t *>(ball), nullptr, SPRITE_BENCH_BALL, SPRITE_BENCH_BALL, SPRITE_FORMAT_ARGB8888};
+    SpriteLayer layer;
+    if (!layer.create(lv_screen_active(), SPRITE_BENCH_WIDTH, SPRITE_BENCH_HEIGHT, count, arena.region(0)))
+    {
+        fprintf(stderr, "no arena memory for %u sprites\n", count);
+        exit(EXIT_FAILURE);
+    }
+    for (uint32_t i = 0; i < count; i++)
+    {
+        layer.set_image(i, &image);
+        layer.set_opa(i, opacity(i));
+    }
+
+    std::vector<Mover> movers = create_movers(count);
+    std::vector<double> render_us;
+    uint32_t max_diff = 0;
+    const size_t frame_size = SPRITE_BENCH_WIDTH * SPRITE_BENCH_HEIGHT * 3;
+    heap_stats_reset();
+    for (uint f = 0; f < frames; f++)
+    {
+        move(movers);
+        for (uint32_t i = 0; i < count; i++)
+        {
+            layer.set_position(i, movers[i].x >> 4, movers[i].y >> 4);
+        }
+        layer.invalidate();
+        render_us.push_back(render(f == 0));
+        if (!expected.empty())
+        {
+            const uint8_t *e = expected.data() + f * frame_size;
+            for (size_t p = 0; p < frame_size; p++)
+            {
+                max_diff = std::max<uint32_t>(max_diff, abs(buffer[p] - e[p]));
+            }
+        }
+    }
+    us = median(render_us);
+    allocs = allocs_per_frame(frames);
+    lv_obj_clean(lv_screen_active());
+    return max_diff;
+}
+
+int main(int argc, char **argv)
+{
+    uint frames = SPRITE_BENCH_FRAMES;
+    if (argc == 3 && strcmp(argv[1], "--frames") == 0)
+    {
+        frames = std::max(1ul, strtoul(argv[2], nullptr, 10));
+    }
+    else if (argc != 1)
+    {
+        fprintf(stderr, "usage: hub75_sprite_bench [--frames N]\n");
+        return EXIT_FAILURE;
+    }
+
+    lv_init();
+    lv_tick_set_cb(bench_tick);
+    heap_stats_start();
+    create_ball();
+
+    size_t buffer_size = SPRITE_BENCH_WIDTH * SPRITE_BENCH_HEIGHT * 3;
+    buffer = new uint8_t[buffer_size];
+    lv_display_t *display = lv_display_create(SPRITE_BENCH_WIDTH, SPRITE_BENCH_HEIGHT);
+    lv_display_set_buffers_with_stride(display, buffer, NULL, buffer_size, SPRITE_BENCH_WIDTH * 3, LV_DISPLAY_RENDER_MODE_FULL);
+    lv_display_set_flush_cb(display, bench_flush_cb);
+    lv_obj_t *screen = lv_screen_active();
+    lv_obj_set_style_bg_color(screen, lv_color_make(0, 0, 40), LV_PART_MAIN);
+    lv_obj_set_style_pad_all(screen, 0, LV_PART_MAIN);
+    lv_obj_remove_flag(screen, LV_OBJ_FLAG_SCROLLABLE);
+    render(true);
+
+    bool failed = false;
+    printf("%8s %12s %12s %14s %14s %9s\n", "sprites", "objects us", "layer us", "objects allocs", "layer allocs", "max diff");
+    for (uint32_t count : {60u, 100u, 1000u, 2000u})
+    {
+        double objects_us = 0, objects_allocs = 0, layer_us = 0, layer_allocs = 0;
+        std::vector<uint8_t> objects_frames;
+        bool objects = run_objects(count, frames, objects_us, objects_allocs, objects_frames);
+        uint32_t diff = run_layer(count, frames, layer_us, layer_allocs, objects_frames);
+        if (objects)
+        {
+            printf("%8u %12.1f %12.1f %14.1f %14.1f %9u\n", count, objects_us, layer_us, objects_allocs, layer_allocs, diff);
+        }
+        else
+        {
+            printf("%8u %12s %12.1f %14s %14.1f %9s\n", count, "-", layer_us, "-", layer_allocs, "-");
+        }
+        if (diff > SPRITE_BENCH_MAX_DIFF)
+        {
+            printf("%u sprites: the layer differs from the objects by %u\n", count, diff);
+            failed = true;
+        }
+        if (count == SPRITE_BENCH_TARGET && layer_us > SPRITE_BENCH_BUDGET_US)
+        {
+            printf("%u sprites: %.1f us per frame misses the 60 fps budget of %.1f us\n", count, layer_us, SPRITE_BENCH_BUDGET_US);
+            failed = true;
+        }
+    }
+    return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,90 @@
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "clip_decoder.hpp"
+#include "clip_64x64.h"
+
+#include "clip_encoder.hpp"
+#include "host_test.hpp"
+
+// ClipDecoder: the encoder port reproduces the checked-in clip of tools/hub75_clip.py, every frame
+// decodes to the encoded one (including a loop back to the key frame), and corrupt data is rejected.
+
+/**
+ * @brief Encodes frames, decodes them all and compares.
+ */
+static void check_round_trip(uint16_t width, uint16_t height, const std::vector<std::vector<uint8_t>> &frames)
+{
+    std::vector<uint8_t> clip = encode_clip(frames, width, height, 40);
+    ClipDecoder decoder;
+    if (!CHECK(decoder.open(clip.data(), clip.size())))
+    {
+        return;
+    }
+    CHECK(decoder.width() == width && decoder.height() == height && decoder.frame_count() == frames.size());
+
+    std::vector<uint8_t> canvas(width * height * 3, 0x55);
+    for (uint32_t pass = 0; pass < 2; pass++)
+    {
+        for (uint32_t i = 0; i < frames.size(); i++)
+        {
+            bool decoded = decoder.decode(i, canvas.data(), width * 3);
+            if (!CHECK(decoded && canvas == frames[i]))
+            {
+                printf("  %ux%u frame %u of pass %u\n", width, height, i, pass);
+                return;
+            }
+        }
+    }
+}
+
+int main()
+{
+    std::vector<std::vector<uint8_t>> demo = demo_clip_frames(64, 64, 50);
+    std::vector<uint8_t> clip = encode_clip(demo, 64, 64, 40);
+    CHECK(clip.size() == sizeof(clip_64x64) && memcmp(clip.data(), clip_64x64, clip.size()) == 0);
+
+    check_round_trip(64, 64, demo);
+    check_round_trip(100, 30, demo_clip_frames(100, 30, 12));
+    check_round_trip(128, 64, demo_clip_frames(128, 64, 12));  // Two chained panels
+    check_round_trip(256, 128, demo_clip_frames(256, 128, 12)); // Two chains
+
+    // Noise with long fills and unchanged rows, so every op and the 64-pixel run limit occur
+    std::vector<std::vector<uint8_t>> mixed;
+    uint32_t random = 1;
+    for (uint32_t f = 0; f < 8; f++)
+    {
+        std::vector<uint8_t> frame = f ? mixed.back() : std::vector<uint8_t>(160 * 96 * 3);
+        for (uint32_t y = f % 3; y < 96; y += 3)
+        {
+            for (uint32_t x = 0; x < 160; x++)
+            {
+                random ^= random << 13;
+                random ^= random >> 17;
+                random ^= random << 5;
+                uint8_t *p = &frame[(y * 160 + x) * 3];
+                if (x < 70 || (random & 3) == 0)
+                {
+                    p[0] = x < 70 ? f * 20 : random >> 8;
+                    p[1] = x < 70 ? 0 : random >> 16;
+                    p[2] = x < 70 ? 255 : random >> 24;
+                }
+            }
+        }
+        mixed.push_back(frame);
+    }
+    check_round_trip(160, 96, mixed);
+
+    // Corrupt clips
+    ClipDecoder decoder;
+    CHECK(!decoder.open(clip_64x64, CLIP_HEADER_SIZE - 1));
+    std::vector<uint8_t> bad(clip_64x64, clip_64x64 + sizeof(clip_64x64));
+    bad[0] ^= 1;
+    CHECK(!decoder.open(bad.data(), bad.size()));
+    CHECK(decoder.open(clip_64x64, sizeof(clip_64x64) - 10)); // Offsets still inside
+    std::vector<uint8_t> canvas(64 * 64 * 3);
+    CHECK(!decoder.decode(decoder.frame_count() - 1, canvas.data(), 64 * 3));
+    CHECK(!decoder.decode(decoder.frame_count(), canvas.data(), 64 * 3));
+    return host_test_result();
+}
@@ -0,0 +1,89 @@
+#include <cstdio>
+
+#include "colour_lut.hpp"
+
+#include "host_test.hpp"
+
+// Colour tables: the compile-time default tables, the generator with the default calibration and
+// the 12-bit dithering curve equal the literal tables the driver used before, entry for entry.
+// Gains below 1 scale the full-scale output, a gamma of 1 is a straight line.
+
+// The former gamma_lut and gamma_lut_12 of hub75.cpp
+static const uint16_t old_lut[256] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 82, 84, 87, 89, 91, 94, 96, 98, 101, 103, 106, 109, 111, 114, 117,
+    119, 122, 125, 128, 130, 133, 136, 139, 142, 145, 148, 151, 155, 158, 161, 164,
+    167, 171, 174, 177, 181, 184, 188, 191, 195, 198, 202, 206, 209, 213, 217, 221,
+    225, 228, 232, 236, 240, 244, 248, 252, 257, 261, 265, 269, 274, 278, 282, 287,
+    291, 295, 300, 304, 309, 314, 318, 323, 328, 333, 337, 342, 347, 352, 357, 362,
+    367, 372, 377, 382, 387, 393, 398, 403, 408, 414, 419, 425, 430, 436, 441, 447,
+    452, 458, 464, 470, 475, 481, 487, 493, 499, 505, 511, 517, 523, 529, 535, 542,
+    548, 554, 561, 567, 573, 580, 586, 593, 599, 606, 613, 619, 626, 633, 640, 647,
+    653, 660, 667, 674, 681, 689, 696, 703, 710, 717, 725, 732, 739, 747, 754, 762,
+    769, 777, 784, 792, 800, 807, 815, 823, 831, 839, 847, 855, 863, 871, 879, 887,
+    895, 903, 912, 920, 928, 937, 945, 954, 962, 971, 979, 988, 997, 1005, 1014, 1023};
+
+static const uint16_t old_lut_12[256] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 27, 29, 32, 34, 37, 40,
+    43, 46, 49, 52, 55, 59, 62, 66, 70, 73, 77, 82, 86, 90, 95, 99,
+    104, 109, 114, 119, 124, 129, 135, 140, 146, 152, 158, 164, 170, 176, 182, 189,
+    196, 202, 209, 216, 224, 231, 238, 246, 254, 261, 269, 277, 286, 294, 302, 311,
+    320, 328, 337, 347, 356, 365, 375, 384, 394, 404, 414, 424, 435, 445, 456, 467,
+    477, 488, 500, 511, 522, 534, 545, 557, 569, 581, 594, 606, 619, 631, 644, 657,
+    670, 683, 697, 710, 724, 738, 752, 766, 780, 794, 809, 823, 838, 853, 868, 884,
+    899, 914, 930, 946, 962, 978, 994, 1011, 1027, 1044, 1061, 1078, 1095, 1112, 1130, 1147,
+    1165, 1183, 1201, 1219, 1237, 1256, 1274, 1293, 1312, 1331, 1350, 1370, 1389, 1409, 1429, 1449,
+    1469, 1489, 1509, 1530, 1551, 1572, 1593, 1614, 1635, 1657, 1678, 1700, 1722, 1744, 1766, 1789,
+    1811, 1834, 1857, 1880, 1903, 1926, 1950, 1974, 1997, 2021, 2045, 2070, 2094, 2119, 2143, 2168,
+    2193, 2219, 2244, 2270, 2295, 2321, 2347, 2373, 2400, 2426, 2453, 2479, 2506, 2534, 2561, 2588,
+    2616, 2644, 2671, 2700, 2728, 2756, 2785, 2813, 2842, 2871, 2900, 2930, 2959, 2989, 3019, 3049,
+    3079, 3109, 3140, 3170, 3201, 3232, 3263, 3295, 3326, 3358, 3390, 3421, 3454, 3486, 3518, 3551,
+    3584, 3617, 3650, 3683, 3716, 3750, 3784, 3818, 3852, 3886, 3920, 3955, 3990, 4025, 4060, 4095};
+
+static bool equals_old(const ColourLut &lut)
+{
+    for (unsigned int i = 0; i < 256; i++)
+    {
+        if (!CHECK(lut.r[i] == static_cast<uint32_t>(old_lut[i]) << COLOUR_LUT_SHIFT_R &&
+                   lut.g[i] == static_cast<uint32_t>(old_lut[i]) << COLOUR_LUT_SHIFT_G &&
+                   lut.b[i] == static_cast<uint32_t>(old_lut[i]) << COLOUR_LUT_SHIFT_B))
+        {
+            printf("  input %u: %08x %08x %08x\n", i, lut.r[i], lut.g[i], lut.b[i]);
+            return false;
+        }
+    }
+    return true;
+}
+
+int main()
+{
+    equals_old(builtin_colour_lut);
+
+    static ColourLut generated;
+    build_colour_lut(generated, default_colour_calibration);
+    equals_old(generated);
+
+    for (unsigned int i = 0; i < 256; i++)
+    {
+        for (unsigned int channel = COLOUR_RED; channel <= COLOUR_BLUE; channel++)
+        {
+            uint32_t value = colour_curve(default_colour_calibration, static_cast<ColourChannel>(channel), i, 12);
+            if (!CHECK(value == old_lut_12[i]))
+            {
+                printf("  12 bits, input %u: %u instead of %u\n", i, value, old_lut_12[i]);
+                break;
+            }
+        }
+    }
+
+    ColourCalibration calibration = {{1.0f, 2.2f, 2.2f}, {1.0f, 1.0f, 0.5f}};
+    CHECK(colour_curve(calibration, COLOUR_RED, 255, 10) == 1023 && colour_curve(calibration, COLOUR_RED, 128, 10) == 514);
+    CHECK(colour_curve(calibration, COLOUR_BLUE, 255, 10) == 512 && colour_curve(calibration, COLOUR_GREEN, 255, 10) == 1023);
+
+    return host_test_result();
+}
@@ -0,0 +1,70 @@
+#include <cstdio>
+#include <vector>
+
+#include "hub75.hpp"
+
+#include "host_test.hpp"
+
+// Temporal dithering: the first refresh's frame buffer rounds every channel of a flat colour
+// up in one checkerboard cell and according to the 2x2 thresholds in the other, and update()
+// and update_bgr() agree.
+
+#define WIDTH 64
+#define HEIGHT 64
+
+int main()
+{
+    create_hub75_driver(WIDTH, HEIGHT);
+    enable_hub75_dithering();
+
+    std::vector<uint8_t> frame(WIDTH * HEIGHT * 3);
+    for (uint32_t v = 0; v < 256; v++)
+    {
+        uint32_t value = colour_curve(default_colour_calibration, COLOUR_RED, v, 12);
+        uint32_t cell0 = (value >> 2) + ((value & 3) > 0); // Thresholds of the first refresh
+        uint32_t cell1 = (value >> 2) + ((value & 3) > 3);
+        cell0 = cell0 > 1023 ? 1023 : cell0;
+        cell1 = cell1 > 1023 ? 1023 : cell1;
+
+        for (size_t i = 0; i < frame.size(); i++)
+        {
+            frame[i] = v;
+        }
+        update_bgr(frame.data());
+
+        uint32_t in_cell0 = 0, in_cell1 = 0;
+        for (uint32_t i = 0; i < WIDTH * HEIGHT; i++)
+        {
+            uint32_t word = frame_buffer[i];
+            uint32_t r = word >> COLOUR_LUT_SHIFT_R & 0x3FF;
+            CHECK(r == (word >> COLOUR_LUT_SHIFT_G & 0x3FF) && r == (word >> COLOUR_LUT_SHIFT_B & 0x3FF));
+            in_cell0 += r == cell0;
+            in_cell1 += r == cell1;
+        }
+        // Half of the pixels in each cell, unless both round the same way
+        bool split = cell0 == cell1 ? in_cell0 == WIDTH * HEIGHT : in_cell0 == WIDTH * HEIGHT / 2 && in_cell1 == WIDTH * HEIGHT / 2;
+        if (!CHECK(split))
+        {
+            printf("  value %u: %u pixels at %u, %u at %u\n", v, in_cell0, cell0, in_cell1, cell1);
+        }
+    }
+
+    // A gradient through both converters: RGB order with update(), swapped with update_bgr()
+    std::vector<uint8_t> swapped(frame.size());
+    for (uint32_t i = 0; i < WIDTH * HEIGHT; i++)
+    {
+        frame[i * 3] = i & 0xFF;
+        frame[i * 3 + 1] = (i >> 4) & 0xFF;
+        frame[i * 3 + 2] = 255 - (i & 0xFF);
+        swapped[i * 3] = frame[i * 3 + 2];
+        swapped[i * 3 + 1] = frame[i * 3 + 1];
+        swapped[i * 3 + 2] = frame[i * 3];
+    }
+    update(frame.data());
+    std::vector<uint32_t> rgb(frame_buffer, frame_buffer + WIDTH * HEIGHT);
+    invalidate_frame();
+    update_bgr(swapped.data());
+    CHECK(std::vector<uint32_t>(frame_buffer, frame_buffer + WIDTH * HEIGHT) == rgb);
+    CHECK(!update_bgr(swapped.data())); // Unchanged rows are skipped
+    return host_test_result();
+}
@@ -0,0 +1,93 @@
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+#include "event_queue.hpp"
+
+#include "host_test.hpp"
+
+// EventQueue under concurrent producers: four threads post while the main thread polls.
+// Every event arrives exactly once, in the order of its producer, and a full queue refuses
+// events instead of overwriting them.
+
+#define PRODUCERS 4
+#define EVENTS_PER_PRODUCER 200000
+
+struct TestEvent
+{
+    uint32_t producer;
+    uint32_t sequence;
+};
+
+int main()
+{
+    EventQueue<TestEvent, 16> queue;
+
+    // Single-threaded: capacity and order
+    uint32_t accepted = 0;
+    for (uint32_t i = 0; i < 20; i++)
+    {
+        accepted += queue.post({0, i});
+    }
+    CHECK(accepted == 16);
+    TestEvent event;
+    for (uint32_t i = 0; i < 16; i++)
+    {
+        CHECK(queue.poll(event) && event.sequence == i);
+    }
+    CHECK(!queue.poll(event));
+
+    // Concurrent producers, which retry while the queue is full
+    std::vector<std::thread> producers;
+    uint32_t refused[PRODUCERS] = {};
+    for (uint32_t p = 0; p < PRODUCERS; p++)
+    {
+        producers.emplace_back([&queue, &refused, p] {
+            for (uint32_t i = 0; i < EVENTS_PER_PRODUCER; i++)
+            {
+                while (!queue.post({p, i}))
+                {
+                    refused[p]++;
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    uint32_t next[PRODUCERS] = {};
+    uint32_t received = 0, out_of_order = 0, unknown = 0;
+    while (received < PRODUCERS * EVENTS_PER_PRODUCER)
+    {
+        if (!queue.poll(event))
+        {
+            std::this_thread::yield();
+            continue;
+        }
+        received++;
+        if (event.producer >= PRODUCERS)
+        {
+            unknown++;
+            continue;
+        }
+        out_of_order += event.sequence != next[event.producer];
+        next[event.producer] = event.sequence + 1;
+    }
+    for (std::thread &producer : producers)
+    {
+        producer.join();
+    }
+
+    CHECK(unknown == 0);
+    if (!CHECK(out_of_order == 0))
+    {
+        printf("  %u events out of order or duplicated\n", out_of_order);
+    }
+    for (uint32_t p = 0; p < PRODUCERS; p++)
+    {
+        CHECK(next[p] == EVENTS_PER_PRODUCER);
+    }
+    CHECK(!queue.poll(event));
+    printf("%u events received, %u posts refused by the full queue\n", received,
+           refused[0] + refused[1] + refused[2] + refused[3]);
+    return host_test_result();
+}
@@ -0,0 +1,117 @@
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+#include "pico/multicore.h"
+
+#include "frame_pipeline.hpp"
+#include "hub75.hpp"
+
+#include "host_test.hpp"
+
+// Hand-over between the cores: a thread as core 1 converts the buffers handed over, like core1_entry()
+// in hub75_lvgl.cpp, while core 0 repeatedly claims the converter for a stream frame right after
+// core 1 has started converting a buffer. Core 1 dawdles before the conversion, so a claim which
+// does not wait lets the conversion overwrite the stream frame. Every claim has to wait for the conversion in progress, the stream frame
+// must survive the buffers handed over while claimed, and LVGL frames are converted again after
+// the release.
+
+#define WIDTH 128
+#define HEIGHT 64
+#define ROUNDS 200
+
+static FramePipeline pipeline;
+static std::vector<uint8_t> lvgl_frames[2]; ///< Buffers 1 and 2
+static std::atomic<uint32_t> started{0};    ///< Conversions begun by core 1
+
+static void core1_entry()
+{
+    while (true)
+    {
+        bool convert;
+        uint32_t number = pipeline.take(convert);
+        if (convert)
+        {
+            started.fetch_add(1);
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+            update_bgr(lvgl_frames[number - 1].data());
+        }
+        pipeline.done();
+    }
+}
+
+static std::vector<uint8_t> pattern(uint seed)
+{
+    std::vector<uint8_t> frame(WIDTH * HEIGHT * 3);
+    for (size_t i = 0; i < frame.size(); i++)
+    {
+        frame[i] = static_cast<uint8_t>(i * seed + seed * 31);
+    }
+    return frame;
+}
+
+static std::vector<uint32_t> converted()
+{
+    return std::vector<uint32_t>(frame_buffer, frame_buffer + WIDTH * HEIGHT);
+}
+
+int main()
+{
+    create_hub75_driver(WIDTH, HEIGHT);
+    lvgl_frames[0] = pattern(3);
+    lvgl_frames[1] = pattern(5);
+    std::vector<uint8_t> stream_frame = pattern(7);
+
+    std::vector<uint32_t> expected[3];
+    for (int i = 0; i < 2; i++)
+    {
+        invalidate_frame();
+        update_bgr(lvgl_frames[i].data());
+        expected[i] = converted();
+    }
+    invalidate_frame();
+    update(stream_frame.data());
+    expected[2] = converted();
+
+    multicore_launch_core1(core1_entry);
+
+    uint stream_wrong = 0, stream_overwritten = 0, lvgl_wrong = 0;
+    for (uint round = 0; round < ROUNDS; round++)
+    {
+        uint number = 1 + (round & 1);
+        uint32_t begun = started.load();
+        pipeline.hand_over(number);
+        while (started.load() == begun)
+        {
+        }
+        pipeline.claim(); // Core 1 is converting the buffer just handed over
+        update(stream_frame.data());
+        stream_wrong += converted() != expected[2];
+
+        pipeline.hand_over(1); // Not converted while claimed
+        pipeline.hand_over(2);
+        pipeline.drain();
+        stream_overwritten += converted() != expected[2];
+
+        invalidate_frame();
+        pipeline.release();
+        pipeline.hand_over(number);
+        pipeline.drain();
+        lvgl_wrong += converted() != expected[number - 1];
+    }
+    if (!CHECK(stream_wrong == 0))
+    {
+        printf("  %u stream frames mixed with a conversion on core 1\n", stream_wrong);
+    }
+    if (!CHECK(stream_overwritten == 0))
+    {
+        printf("  %u stream frames overwritten while claimed\n", stream_overwritten);
+    }
+    if (!CHECK(lvgl_wrong == 0))
+    {
+        printf("  %u LVGL frames wrong after the release\n", lvgl_wrong);
+    }
+    return host_test_result();
+}
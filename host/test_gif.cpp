@@ -0,0 +1,279 @@
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "lvgl/src/core/lv_obj.h"
+#include "lvgl/src/libs/gif/gifdec.h"
+#include "lvgl/src/stdlib/lv_mem.h"
+
+#include "gif_animation.hpp"
+#include "gif_64x64.h"
+
+#include "host_test.hpp"
+
+// GIF decoding: GifDecoder renders the same canvas as LVGL's gifdec for every frame of two loops,
+// whatever the row budget per call, on the demo GIF and on a GIF with a local colour table,
+// interlacing, transparency, sub-rectangle frames and disposal to the background. The scene
+// shows the frames on time, takes nothing from the LVGL heap for decoding and returns all of
+// its memory.
+
+#define GIF_FRAMES 24 ///< Frames of gif_64x64.h
+#define ARENA_SIZE (64 * 1024)
+
+/**
+ * @brief Decodes frames with gifdec, every rendered frame is appended. The GIFs loop forever.
+ */
+static void decode_frames(gd_GIF *gif, uint32_t count, std::vector<std::vector<uint8_t>> &frames)
+{
+    size_t size = gif->width * gif->height * 4;
+    for (uint32_t i = 0; i < count; i++)
+    {
+        int res = gd_get_frame(gif);
+        if (res == 0)
+        {
+            res = gd_get_frame(gif); // Trailer of a GIF without a loop count, gifdec has rewound
+        }
+        if (!CHECK(res == 1))
+        {
+            return;
+        }
+        gd_render_frame(gif, gif->canvas);
+        frames.emplace_back(gif->canvas, gif->canvas + size);
+    }
+}
+
+/**
+ * @brief Decodes frames with GifDecoder, max_rows rows per call, and compares them with gifdec's.
+ */
+static void check_decoder(const uint8_t *gif, size_t size, uint32_t max_rows, const std::vector<std::vector<uint8_t>> &expected)
+{
+    GifDecoder decoder;
+    if (!CHECK(decoder.open(gif, size)))
+    {
+        return;
+    }
+    std::vector<uint8_t> memory(decoder.memory_size());
+    decoder.start(memory.data());
+    for (size_t i = 0; i < expected.size(); i++)
+    {
+        uint32_t calls = 0;
+        GifStatus status;
+        while ((status = decoder.decode(max_rows)) == GIF_FRAME_PENDING)
+        {
+            calls++;
+        }
+        bool same = status == GIF_FRAME_READY && memcmp(decoder.canvas(), expected[i].data(), expected[i].size()) == 0;
+        if (!CHECK(same && calls <= (decoder.height() + max_rows - 1) / max_rows))
+        {
+            printf("  frame %u, %u rows per call: status %d after %u calls\n", (unsigned)i, max_rows, status, calls);
+            return;
+        }
+    }
+}
+
+static void put_u16(std::vector<uint8_t> &gif, uint16_t value)
+{
+    gif.push_back(value & 0xff);
+    gif.push_back(value >> 8);
+}
+
+/**
+ * @brief Appends one frame, its indices coded as literals with a clear code before the code size would grow.
+ */
+static void add_frame(std::vector<uint8_t> &gif, uint8_t gce_flags, uint8_t transparent, uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                      bool interlaced, bool local_palette, uint32_t seed)
+{
+    const uint8_t gce[] = {0x21, 0xf9, 0x04, gce_flags, 3, 0, transparent, 0};
+    gif.insert(gif.end(), gce, gce + sizeof(gce));
+    gif.push_back(',');
+    put_u16(gif, x);
+    put_u16(gif, y);
+    put_u16(gif, w);
+    put_u16(gif, h);
+    gif.push_back((interlaced ? 0x40 : 0) | (local_palette ? 0x82 : 0)); // 8 local colours
+    if (local_palette)
+    {
+        for (uint32_t i = 0; i < 8 * 3; i++)
+        {
+            gif.push_back(static_cast<uint8_t>(i * 37 + seed));
+        }
+    }
+
+    const uint32_t min_code_size = 3;
+    std::vector<uint8_t> codes;
+    uint32_t bits = 0, count = 0, literals = 0;
+    auto emit = [&](uint32_t code) {
+        bits |= code << count;
+        count += min_code_size + 1;
+        while (count >= 8)
+        {
+            codes.push_back(bits & 0xff);
+            bits >>= 8;
+            count -= 8;
+        }
+    };
+    emit(1 << min_code_size);
+    for (uint32_t i = 0; i < w * h; i++)
+    {
+        if (++literals == 6) // Before the table reaches 16 entries
+        {
+            emit(1 << min_code_size);
+            literals = 1;
+        }
+        emit((i * 5 + i / w + seed) % 8);
+    }
+    emit((1 << min_code_size) + 1);
+    if (count)
+    {
+        codes.push_back(bits & 0xff);
+    }
+    gif.push_back(min_code_size);
+    for (size_t i = 0; i < codes.size(); i += 100)
+    {
+        size_t n = codes.size() - i < 100 ? codes.size() - i : 100;
+        gif.push_back(static_cast<uint8_t>(n));
+        gif.insert(gif.end(), codes.begin() + i, codes.begin() + i + n);
+    }
+    gif.push_back(0);
+}
+
+/**
+ * @brief A 40x30 GIF exercising what the demo GIF does not.
+ */
+static std::vector<uint8_t> feature_gif()
+{
+    std::vector<uint8_t> gif = {'G', 'I', 'F', '8', '9', 'a'};
+    put_u16(gif, 40);
+    put_u16(gif, 30);
+    gif.push_back(0xf2); // Global colour table with 8 entries
+    gif.push_back(5);    // Background colour
+    gif.push_back(0);
+    for (uint32_t i = 0; i < 8 * 3; i++)
+    {
+        gif.push_back(static_cast<uint8_t>(i * 11));
+    }
+    const uint8_t comment[] = {0x21, 0xfe, 3, 'h', 'i', '!', 0};
+    gif.insert(gif.end(), comment, comment + sizeof(comment));
+    add_frame(gif, 0x00, 0, 0, 0, 40, 30, false, false, 0);   // Full frame
+    add_frame(gif, 0x09, 2, 5, 3, 20, 17, true, false, 1);    // Interlaced, transparent, restore to background
+    add_frame(gif, 0x04, 0, 10, 10, 13, 9, false, true, 2);   // Local colour table
+    add_frame(gif, 0x05, 4, 0, 20, 40, 10, true, true, 3);    // Interlaced, local colours, transparent
+    add_frame(gif, 0x08, 0, 30, 0, 10, 30, false, false, 4);  // Restore to background
+    add_frame(gif, 0x00, 0, 1, 1, 3, 2, false, false, 5);
+    gif.push_back(';');
+    return gif;
+}
+
+/**
+ * @brief Shows the scene for two loops of its 50 ms frames at a 5 ms tick, then deletes it.
+ *
+ * @param blank Screen shown before and after.
+ */
+static void run_scene(lv_obj_t *blank)
+{
+    static uint8_t arena_memory[ARENA_SIZE];
+    SceneArena arena(arena_memory, sizeof(arena_memory));
+    GifAnimation scene(gif_64x64, sizeof(gif_64x64));
+    lv_mem_monitor_t before;
+    lv_mem_monitor(&before);
+    if (!CHECK(scene.create(arena.region(0))))
+    {
+        return;
+    }
+    lv_mem_monitor_t after;
+    lv_mem_monitor(&after);
+    if (!CHECK(before.free_size - after.free_size < 2048)) // The screen and image objects only
+    {
+        printf("  create() took %lu bytes of the LVGL heap\n", (unsigned long)(before.free_size - after.free_size));
+    }
+    lv_screen_load(scene.get_screen());
+    std::vector<uint8_t> shown;
+    uint32_t changes = 0;
+    for (uint32_t t = 0; t < 2 * GIF_FRAMES * 50; t += 5)
+    {
+        scene.update();
+        host_test_render();
+        const uint8_t *frame = host_test_frame();
+        if (shown.empty() || memcmp(shown.data(), frame, shown.size()) != 0)
+        {
+            changes++;
+            shown.assign(frame, frame + 64 * 64 * 3);
+        }
+        host_test_advance(5);
+    }
+    if (!CHECK(changes >= 2 * GIF_FRAMES - 1))
+    {
+        printf("  %u frames shown\n", changes);
+    }
+    lv_screen_load(blank);
+    scene.destroy();
+}
+
+int main()
+{
+    host_test_display(64, 64);
+
+    gd_GIF *gif = gd_open_gif_data(gif_64x64);
+    if (!CHECK(gif != nullptr))
+    {
+        return host_test_result();
+    }
+    CHECK(gif->width == 64 && gif->height == 64);
+    std::vector<std::vector<uint8_t>> first, second;
+    decode_frames(gif, GIF_FRAMES, first);
+    decode_frames(gif, GIF_FRAMES, second);
+    CHECK(first == second);
+    uint32_t distinct = 0;
+    for (size_t i = 1; i < first.size(); i++)
+    {
+        distinct += first[i] != first[i - 1];
+    }
+    CHECK(distinct == first.size() - 1);
+    gd_close_gif(gif);
+
+    for (uint32_t rows : {1u, 5u, 16u, 64u})
+    {
+        check_decoder(gif_64x64, sizeof(gif_64x64), rows, first);
+    }
+
+    std::vector<uint8_t> features = feature_gif();
+    std::vector<std::vector<uint8_t>> reference;
+    gif = gd_open_gif_data(features.data());
+    if (CHECK(gif != nullptr))
+    {
+        decode_frames(gif, 12, reference); // Two loops
+        gd_close_gif(gif);
+        for (uint32_t rows : {1u, 3u, 30u})
+        {
+            check_decoder(features.data(), features.size(), rows, reference);
+        }
+    }
+
+    GifDecoder decoder;
+    CHECK(!decoder.open(gif_64x64, 12));
+    std::vector<uint8_t> truncated(gif_64x64, gif_64x64 + 2000);
+    CHECK(decoder.open(truncated.data(), truncated.size()));
+    std::vector<uint8_t> memory(decoder.memory_size());
+    decoder.start(memory.data());
+    GifStatus status;
+    while ((status = decoder.decode(64)) == GIF_FRAME_READY)
+    {
+    }
+    CHECK(status == GIF_ERROR);
+
+    // The scene, twice: the first run leaves LVGL's caches and pools filled, the second has to
+    // return every byte it takes
+    lv_obj_t *blank = lv_obj_create(NULL);
+    lv_screen_load(blank);
+    run_scene(blank);
+    lv_mem_monitor_t before;
+    lv_mem_monitor(&before);
+    run_scene(blank);
+    lv_mem_monitor_t after;
+    lv_mem_monitor(&after);
+    if (!CHECK(after.free_size == before.free_size))
+    {
+        printf("  heap free before %lu, after %lu bytes\n", (unsigned long)before.free_size, (unsigned long)after.free_size);
+    }
+    return host_test_result();
+}
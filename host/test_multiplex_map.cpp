@@ -0,0 +1,199 @@
+#include <cstdio>
+#include <vector>
+
+#include "hub75.hpp"
+
+#include "host_test.hpp"
+
+// Multiplex patterns: build_pixel_index() matches the multiplex mappers of hzeller's
+// rpi-rgb-led-matrix for one panel and for two and three panels in a chain, every table is a
+// permutation of the frame buffer, and the driver places pixels of two chained panels on both
+// chains where the reference puts them.
+
+/**
+ * @brief The mappers of rpi-rgb-led-matrix (lib/multiplex-mappers.cc): MultiplexMapperBase
+ *        splits the chain into panels and maps every panel with MapSinglePanel().
+ */
+struct ReferenceMapper
+{
+    Multiplex multiplex;
+    int panel_cols;
+    int panel_rows;
+
+    int stretch() const
+    {
+        return multiplex == MULTIPLEX_LINEAR ? 1 : 2;
+    }
+
+    void map_single_panel(int x, int y, int *matrix_x, int *matrix_y) const
+    {
+        const bool is_top = (y % (panel_rows / 2)) < panel_rows / 4;
+        const int stripe_y = (y / (panel_rows / 2)) * (panel_rows / 4) + y % (panel_rows / 4);
+        switch (multiplex)
+        {
+        case MULTIPLEX_STRIPE:
+            *matrix_x = is_top ? x + panel_cols : x;
+            *matrix_y = stripe_y;
+            break;
+        case MULTIPLEX_CHECKERED:
+        {
+            const bool is_left_check = x < panel_cols / 2;
+            if (is_top)
+            {
+                *matrix_x = is_left_check ? x + panel_cols / 2 : x + panel_cols;
+            }
+            else
+            {
+                *matrix_x = is_left_check ? x : x + panel_cols / 2;
+            }
+            *matrix_y = stripe_y;
+            break;
+        }
+        case MULTIPLEX_SPIRAL:
+        {
+            const int panel_quarter = panel_cols / 4;
+            const int quarter = x / panel_quarter;
+            const int offset = x % panel_quarter;
+            *matrix_x = 2 * quarter * panel_quarter + (is_top ? panel_quarter - 1 - offset : panel_quarter + offset);
+            *matrix_y = stripe_y;
+            break;
+        }
+        case MULTIPLEX_ZSTRIPE:
+        case MULTIPLEX_ZNMIRROR_ZSTRIPE:
+        {
+            const int tile_width = 8;
+            const int tile_height = 4;
+            const int even_vblock_offset = multiplex == MULTIPLEX_ZSTRIPE ? 0 : 4;
+            const int odd_vblock_offset = multiplex == MULTIPLEX_ZSTRIPE ? 8 : 4;
+            const int vert_block_is_odd = (y / tile_height) % 2;
+            const int even_vblock_shift = (1 - vert_block_is_odd) * even_vblock_offset;
+            const int odd_vblock_shift = vert_block_is_odd * odd_vblock_offset;
+            *matrix_x = x + ((x + even_vblock_shift) / tile_width) * tile_width + odd_vblock_shift;
+            *matrix_y = (y % tile_height) + tile_height * (y / (tile_height * 2));
+            break;
+        }
+        default:
+            *matrix_x = x;
+            *matrix_y = y;
+            break;
+        }
+    }
+
+    void map_visible_to_matrix(int visible_x, int visible_y, int *matrix_x, int *matrix_y) const
+    {
+        const int chained_panel = visible_x / panel_cols;
+        const int parallel_panel = visible_y / panel_rows;
+        int new_x, new_y;
+        map_single_panel(visible_x % panel_cols, visible_y % panel_rows, &new_x, &new_y);
+        *matrix_x = chained_panel * stretch() * panel_cols + new_x;
+        *matrix_y = parallel_panel * panel_rows / stretch() + new_y;
+    }
+};
+
+/**
+ * @brief Frame buffer index of a hardware matrix position: upper half on the even entries, lower half on the odd ones.
+ */
+static uint reference_index(int matrix_x, int matrix_y, uint matrix_width, uint scan)
+{
+    uint y = static_cast<uint>(matrix_y);
+    return y < scan ? (y * matrix_width + matrix_x) * 2 : ((y - scan) * matrix_width + matrix_x) * 2 + 1;
+}
+
+static void check_chain(Multiplex multiplex, uint panel_width, uint height, uint panels)
+{
+    ReferenceMapper reference = {multiplex, static_cast<int>(panel_width), static_cast<int>(height)};
+    const uint width = panel_width * panels;
+    const uint scan = height / (2 * reference.stretch());
+    std::vector<uint16_t> index(width * height);
+    if (!CHECK(build_pixel_index(index.data(), width, height, scan, multiplex, panels > 1 ? panel_width : 0)))
+    {
+        printf("  multiplex %d, %u panels of %ux%u rejected\n", multiplex, panels, panel_width, height);
+        return;
+    }
+
+    std::vector<bool> used(width * height, false);
+    uint wrong = 0;
+    for (uint y = 0; y < height; y++)
+    {
+        for (uint x = 0; x < width; x++)
+        {
+            int mx, my;
+            reference.map_visible_to_matrix(x, y, &mx, &my);
+            uint expected = reference_index(mx, my, width * reference.stretch(), scan);
+            uint got = index[y * width + x];
+            wrong += got != expected;
+            if (got < used.size())
+            {
+                wrong += used[got];
+                used[got] = true;
+            }
+        }
+    }
+    if (!CHECK(wrong == 0))
+    {
+        printf("  multiplex %d, %u panels of %ux%u: %u pixels differ from the reference\n", multiplex, panels, panel_width, height, wrong);
+    }
+}
+
+/**
+ * @brief Converts single pixels on two chains of two panels each and finds them in the frame buffer.
+ */
+static void check_driver(Multiplex multiplex)
+{
+    const uint panel_width = 32, panel_height = 16, panels = 2, chains = 2;
+    const uint width = panel_width * panels, height = panel_height * chains;
+    ReferenceMapper reference = {multiplex, static_cast<int>(panel_width), static_cast<int>(panel_height)};
+    const uint scan = panel_height / (2 * reference.stretch());
+    create_hub75_driver(width, height, scan, multiplex, chains, panel_width);
+
+    std::vector<uint8_t> frame(width * height * 3);
+    uint wrong = 0;
+    for (uint y = 0; y < height; y += 3)
+    {
+        for (uint x = 0; x < width; x += 5)
+        {
+            std::fill(frame.begin(), frame.end(), 0);
+            frame[(y * width + x) * 3] = 0xff;
+            invalidate_frame();
+            update_bgr(frame.data());
+
+            int mx, my;
+            reference.map_visible_to_matrix(x, y % panel_height, &mx, &my);
+            uint expected = (y / panel_height) * width * panel_height + reference_index(mx, my, width * reference.stretch(), scan);
+            uint lit = 0;
+            for (uint i = 0; i < width * height; i++)
+            {
+                if (frame_buffer[i] != 0)
+                {
+                    lit++;
+                    wrong += i != expected;
+                }
+            }
+            wrong += lit != 1;
+        }
+    }
+    if (!CHECK(wrong == 0))
+    {
+        printf("  multiplex %d, %u chains of %u panels: %u pixels misplaced\n", multiplex, chains, panels, wrong);
+    }
+}
+
+int main()
+{
+    for (int m = 0; m < MULTIPLEX_COUNT; m++)
+    {
+        Multiplex multiplex = static_cast<Multiplex>(m);
+        for (uint panels = 1; panels <= 3; panels++)
+        {
+            check_chain(multiplex, 32, 16, panels);
+            check_chain(multiplex, 64, 32, panels);
+        }
+        check_driver(multiplex);
+    }
+
+    // Panels narrower than a ZStripe tile and chains which are not a whole number of panels are refused
+    std::vector<uint16_t> index(100 * 16);
+    CHECK(!build_pixel_index(index.data(), 100, 16, 4, MULTIPLEX_STRIPE, 32));
+    CHECK(!build_pixel_index(index.data(), 12, 16, 4, MULTIPLEX_ZSTRIPE, 4));
+    return host_test_result();
+}
@@ -0,0 +1,76 @@
+#include <cstdio>
+#include <vector>
+
+#include "particle_system.hpp"
+
+#include "host_test.hpp"
+
+// ParticleSystem: the counters add up, the capacity holds, the arena size of memory_needed() is
+// enough, and a seed reproduces the same frames.
+
+#define WIDTH 64
+#define HEIGHT 64
+#define CAPACITY 2048
+
+static const ParticleEmitter test_emitters[] = {
+    {128, 255, 200, 0, 0, -48, 24, 32, 170, 20, 45, 24, 30},
+    {64, 64, 8, 8, 0, -80, 256, 192, 40, 30, 70, 40, 25},
+};
+static const GradientStop test_gradient[] = {{0, 0x000000}, {128, 0xFF8000}, {255, 0xFFFFFF}};
+static const ParticleConfig test_config = {"test", test_emitters, 2, {0, 2, 5, 8}, test_gradient, 3, 0, 1, true};
+
+/**
+ * @brief Runs the system for a number of frames and returns the last frame.
+ */
+static std::vector<uint8_t> run(uint32_t seed, uint32_t frames)
+{
+    size_t size = ParticleSystem::memory_needed(WIDTH, HEIGHT, CAPACITY);
+    std::vector<uint8_t> memory(size + 8);
+    SceneArena arena(memory.data(), size);
+    ParticleSystem particles;
+    CHECK(particles.create(WIDTH, HEIGHT, CAPACITY, arena.region(0)));
+    CHECK(arena.region(0).used() == size);
+
+    particles.seed(seed);
+    particles.configure(test_config);
+    uint32_t alive = 0;
+    uint32_t limited = 0;
+    for (uint32_t f = 0; f < frames; f++)
+    {
+        particles.step();
+        const ParticleStats &stats = particles.info();
+        CHECK(stats.alive == particles.size());
+        CHECK(stats.alive == alive + stats.spawned - stats.died);
+        CHECK(stats.alive <= CAPACITY);
+        limited += stats.spawned < 210;
+        alive = stats.alive;
+    }
+    CHECK(limited > 0); // 210 new particles per frame outgrow the capacity
+
+    std::vector<uint8_t> frame(WIDTH * HEIGHT * 4);
+    particles.resolve(frame.data(), WIDTH * 4, 4);
+    uint32_t lit = 0;
+    for (uint32_t i = 0; i < WIDTH * HEIGHT; i++)
+    {
+        lit += frame[i * 4] || frame[i * 4 + 1] || frame[i * 4 + 2];
+        CHECK(frame[i * 4 + 3] == 0xFF);
+    }
+    CHECK(lit > WIDTH * HEIGHT / 20);
+
+    // RGB888 resolves to the same colours
+    std::vector<uint8_t> packed(WIDTH * HEIGHT * 3);
+    particles.resolve(packed.data(), WIDTH * 3, 3);
+    for (uint32_t i = 0; i < WIDTH * HEIGHT; i++)
+    {
+        CHECK(packed[i * 3] == frame[i * 4] && packed[i * 3 + 1] == frame[i * 4 + 1] && packed[i * 3 + 2] == frame[i * 4 + 2]);
+    }
+    return frame;
+}
+
+int main()
+{
+    std::vector<uint8_t> first = run(7, 200);
+    CHECK(run(7, 200) == first);
+    CHECK(run(8, 200) != first);
+    return host_test_result();
+}
@@ -0,0 +1,262 @@
+#include <arpa/inet.h>
+#include <cstdio>
+#include <cstring>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+#include <vector>
+
+#include "pixel_protocol.hpp"
+
+#include "host_test.hpp"
+
+// DDP and E1.31 over UDP on the loopback interface, received with POSIX sockets in place of lwIP
+// and handed to the FrameAssembler like network_receiver.cpp does. Checked: whole and partial DDP
+// frames, unsynchronised and synchronised E1.31 frames, late E1.31 packets of an older frame which
+// must neither tear the next frame nor complete it early, and that a presentation copies only the
+// bytes received for the frame.
+
+#define WIDTH 128
+#define HEIGHT 64
+#define FRAME_SIZE (WIDTH * HEIGHT * 3)
+#define UNIVERSES ((FRAME_SIZE + E131_CHANNELS_PER_UNIVERSE - 1) / E131_CHANNELS_PER_UNIVERSE)
+#define SYNC_UNIVERSE 999
+
+typedef std::vector<uint8_t> Packet;
+
+/// @brief Both ends of the loopback connection
+struct Loopback
+{
+    int sender = -1;
+    int receiver = -1;
+    sockaddr_in address = {};
+};
+
+static bool open_loopback(Loopback &loopback)
+{
+    loopback.receiver = socket(AF_INET, SOCK_DGRAM, 0);
+    loopback.sender = socket(AF_INET, SOCK_DGRAM, 0);
+    if (loopback.receiver < 0 || loopback.sender < 0)
+    {
+        return false;
+    }
+    int buffer = 4 * 1024 * 1024;
+    setsockopt(loopback.receiver, SOL_SOCKET, SO_RCVBUF, &buffer, sizeof(buffer));
+    timeval timeout = {1, 0};
+    setsockopt(loopback.receiver, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+    loopback.address.sin_family = AF_INET;
+    loopback.address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    loopback.address.sin_port = 0; // Any free port instead of DDP_PORT / E131_PORT
+    socklen_t length = sizeof(loopback.address);
+    return bind(loopback.receiver, reinterpret_cast<sockaddr *>(&loopback.address), sizeof(loopback.address)) == 0 &&
+           getsockname(loopback.receiver, reinterpret_cast<sockaddr *>(&loopback.address), &length) == 0;
+}
+
+/**
+ * @brief Sends the packets in their order and hands every datagram received to the assembler.
+ */
+static bool transfer(Loopback &loopback, const std::vector<Packet> &packets, FrameAssembler &assembler, bool ddp)
+{
+    for (const Packet &packet : packets)
+    {
+        if (sendto(loopback.sender, packet.data(), packet.size(), 0, reinterpret_cast<sockaddr *>(&loopback.address), sizeof(loopback.address)) !=
+            static_cast<ssize_t>(packet.size()))
+        {
+            return false;
+        }
+    }
+    uint8_t datagram[1500];
+    for (size_t i = 0; i < packets.size(); i++)
+    {
+        ssize_t n = recv(loopback.receiver, datagram, sizeof(datagram), 0);
+        if (n <= 0)
+        {
+            return false;
+        }
+        if (ddp)
+        {
+            assembler.on_ddp(datagram, n);
+        }
+        else
+        {
+            assembler.on_e131(datagram, n);
+        }
+    }
+    return true;
+}
+
+static void put_be16(Packet &p, size_t at, uint16_t v)
+{
+    p[at] = v >> 8;
+    p[at + 1] = v & 0xff;
+}
+
+static void put_be32(Packet &p, size_t at, uint32_t v)
+{
+    put_be16(p, at, v >> 16);
+    put_be16(p, at + 2, v & 0xffff);
+}
+
+static Packet ddp_packet(const std::vector<uint8_t> &frame, uint32_t offset, uint16_t length, bool push)
+{
+    Packet p(DDP_HEADER_SIZE + length);
+    p[0] = DDP_VERSION_1 | (push ? DDP_FLAG_PUSH : 0);
+    put_be32(p, 4, offset);
+    put_be16(p, 8, length);
+    memcpy(&p[DDP_HEADER_SIZE], &frame[offset], length);
+    return p;
+}
+
+static void e131_root(Packet &p, uint32_t root_vector, uint32_t framing_vector)
+{
+    put_be16(p, 0, 0x0010);
+    const char id[12] = {'A', 'S', 'C', '-', 'E', '1', '.', '1', '7', 0, 0, 0};
+    memcpy(&p[4], id, sizeof(id));
+    put_be32(p, 18, root_vector);
+    put_be32(p, 40, framing_vector);
+}
+
+static Packet e131_data(const std::vector<uint8_t> &frame, uint16_t universe, uint8_t sequence, uint16_t sync_address)
+{
+    uint32_t offset = (universe - 1) * E131_CHANNELS_PER_UNIVERSE;
+    uint16_t length = FRAME_SIZE - offset < E131_CHANNELS_PER_UNIVERSE ? FRAME_SIZE - offset : E131_CHANNELS_PER_UNIVERSE;
+    Packet p(126 + length);
+    e131_root(p, 0x00000004, 0x00000002);
+    put_be16(p, 109, sync_address);
+    p[111] = sequence;
+    put_be16(p, 113, universe);
+    p[117] = 0x02;
+    put_be16(p, 123, length + 1);
+    memcpy(&p[126], &frame[offset], length);
+    return p;
+}
+
+static Packet e131_sync(uint8_t sequence)
+{
+    Packet p(49);
+    e131_root(p, 0x00000008, 0x00000001);
+    p[44] = sequence;
+    put_be16(p, 45, SYNC_UNIVERSE);
+    return p;
+}
+
+static std::vector<uint8_t> pattern(uint seed)
+{
+    std::vector<uint8_t> frame(FRAME_SIZE);
+    for (size_t i = 0; i < frame.size(); i++)
+    {
+        frame[i] = static_cast<uint8_t>(i * seed + seed);
+    }
+    return frame;
+}
+
+static bool shows(FrameAssembler &assembler, const std::vector<uint8_t> &expected)
+{
+    const uint8_t *frame = assembler.take_frame();
+    return frame != nullptr && memcmp(frame, expected.data(), FRAME_SIZE) == 0;
+}
+
+static void check_ddp(Loopback &loopback)
+{
+    FrameAssembler assembler(FRAME_SIZE, nullptr, 0);
+    std::vector<uint8_t> frame = pattern(3);
+    std::vector<Packet> packets;
+    for (uint32_t offset = 0; offset < FRAME_SIZE; offset += 1440)
+    {
+        uint16_t length = FRAME_SIZE - offset < 1440 ? FRAME_SIZE - offset : 1440;
+        packets.push_back(ddp_packet(frame, offset, length, offset + length == FRAME_SIZE));
+    }
+    CHECK(transfer(loopback, packets, assembler, true));
+    CHECK(shows(assembler, frame));
+
+    // Partial updates keep the rest of the frame, and only the updated part is copied
+    for (uint round = 0; round < 20; round++)
+    {
+        std::vector<uint8_t> update = pattern(round + 5);
+        uint32_t offset = (round * 2111) % (FRAME_SIZE - 600);
+        memcpy(&frame[offset], &update[offset], 600);
+        uint64_t copied = assembler.copied();
+        CHECK(transfer(loopback, {ddp_packet(update, offset, 600, true)}, assembler, true));
+        if (!CHECK(shows(assembler, frame)))
+        {
+            printf("  partial DDP update %u\n", round);
+        }
+        CHECK(assembler.copied() - copied <= 600 + 2 * FRAME_BLOCK_SIZE);
+    }
+    CHECK(assembler.rejected() == 0);
+}
+
+static void check_e131(Loopback &loopback)
+{
+    UniverseMapping mapping[UNIVERSES];
+    for (uint i = 0; i < UNIVERSES; i++)
+    {
+        mapping[i] = {static_cast<uint16_t>(1 + i), i * E131_CHANNELS_PER_UNIVERSE};
+    }
+    FrameAssembler assembler(FRAME_SIZE, mapping, UNIVERSES);
+
+    // Unsynchronised: complete once every universe has arrived
+    std::vector<uint8_t> first = pattern(7);
+    std::vector<Packet> packets;
+    for (uint u = 1; u <= UNIVERSES; u++)
+    {
+        packets.push_back(e131_data(first, u, 10, 0));
+    }
+    CHECK(transfer(loopback, packets, assembler, false));
+    CHECK(shows(assembler, first));
+
+    // The next frame, with the first universe's packet of the previous frame arriving late
+    std::vector<uint8_t> second = pattern(9);
+    packets.clear();
+    for (uint u = 2; u <= UNIVERSES; u++)
+    {
+        packets.push_back(e131_data(second, u, 11, 0));
+    }
+    packets.push_back(e131_data(first, 1, 10, 0));
+    CHECK(transfer(loopback, packets, assembler, false));
+    CHECK(assembler.take_frame() == nullptr); // Not completed by the late packet
+    CHECK(transfer(loopback, {e131_data(second, 1, 11, 0)}, assembler, false));
+    CHECK(shows(assembler, second));
+    CHECK(assembler.out_of_order() == 1);
+
+    // Synchronised: shown on the sync packet, a late sync packet is ignored
+    std::vector<uint8_t> third = pattern(11);
+    packets.clear();
+    for (uint u = 1; u <= UNIVERSES; u++)
+    {
+        packets.push_back(e131_data(third, u, 12, SYNC_UNIVERSE));
+    }
+    CHECK(transfer(loopback, packets, assembler, false));
+    CHECK(assembler.take_frame() == nullptr);
+    CHECK(transfer(loopback, {e131_sync(50)}, assembler, false));
+    CHECK(shows(assembler, third));
+    CHECK(transfer(loopback, {e131_data(first, 1, 13, SYNC_UNIVERSE), e131_sync(49)}, assembler, false));
+    CHECK(assembler.take_frame() == nullptr);
+    CHECK(assembler.out_of_order() == 2);
+
+    // A restarted sender counts from 0 again, far behind the last number, and is accepted
+    packets.clear();
+    for (uint u = 1; u <= UNIVERSES; u++)
+    {
+        packets.push_back(e131_data(first, u, 200, 0));
+    }
+    CHECK(transfer(loopback, packets, assembler, false));
+    CHECK(shows(assembler, first));
+    CHECK(assembler.rejected() == 0);
+}
+
+int main()
+{
+    Loopback loopback;
+    if (!CHECK(open_loopback(loopback)))
+    {
+        return host_test_result();
+    }
+    check_ddp(loopback);
+    check_e131(loopback);
+    close(loopback.sender);
+    close(loopback.receiver);
+    return host_test_result();
+}
@@ -0,0 +1,63 @@
+#include <cstdio>
+#include <vector>
+
+#include "procedural_effect.hpp"
+
+#include "host_test.hpp"
+
+// Procedural effects: plasma and tunnel only depend on the time, every effect writes the same
+// colours as RGB888 and XRGB8888, and the frames move.
+
+#define ARENA_SIZE (128 * 1024)
+
+/**
+ * @brief Renders a frame into a fresh instance of the effect.
+ */
+template <typename Effect>
+static std::vector<uint8_t> render(uint16_t width, uint16_t height, uint32_t bytes_per_pixel, const std::vector<uint32_t> &times)
+{
+    static std::vector<uint8_t> memory(ARENA_SIZE);
+    SceneArena arena(memory.data(), memory.size());
+    Effect effect;
+    CHECK(effect.create(width, height, arena.region(0)));
+    std::vector<uint8_t> frame(width * height * bytes_per_pixel);
+    for (uint32_t t : times)
+    {
+        effect.render(frame.data(), width * bytes_per_pixel, bytes_per_pixel, t);
+    }
+    return frame;
+}
+
+template <typename Effect>
+static void check_effect(uint16_t width, uint16_t height, bool stateless)
+{
+    std::vector<uint8_t> packed = render<Effect>(width, height, 3, {0, 16, 32, 48});
+    std::vector<uint8_t> padded = render<Effect>(width, height, 4, {0, 16, 32, 48});
+    bool same = true;
+    for (uint32_t i = 0; i < width * height; i++)
+    {
+        same &= packed[i * 3] == padded[i * 4] && packed[i * 3 + 1] == padded[i * 4 + 1] && packed[i * 3 + 2] == padded[i * 4 + 2] &&
+                padded[i * 4 + 3] == 0xFF;
+    }
+    if (!CHECK(same))
+    {
+        printf("  %s %ux%u: RGB888 and XRGB8888 differ\n", Effect().name(), width, height);
+    }
+
+    if (stateless)
+    {
+        CHECK(render<Effect>(width, height, 3, {48}) == packed);
+    }
+    CHECK(render<Effect>(width, height, 3, {0, 16, 32, 48, 1000}) != packed);
+}
+
+int main()
+{
+    for (uint16_t width : {64, 128})
+    {
+        check_effect<PlasmaEffect>(width, 64, true);
+        check_effect<TunnelEffect>(width, 64, true);
+        check_effect<StarfieldEffect>(width, 64, false);
+    }
+    return host_test_result();
+}
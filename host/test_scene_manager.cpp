@@ -0,0 +1,139 @@
+#include <cstdio>
+
+#include "lvgl/src/core/lv_obj.h"
+#include "lvgl/src/display/lv_display.h"
+#include "lvgl/src/misc/lv_timer.h"
+#include "lvgl/src/stdlib/lv_mem.h"
+
+#include "bouncing_balls.hpp"
+#include "fire_effect.hpp"
+#include "image_animation.hpp"
+#include "colour_check.hpp"
+#include "clip_animation.hpp"
+#include "gif_animation.hpp"
+#include "sprite_swarm.hpp"
+#include "particle_effect.hpp"
+#include "procedural_scene.hpp"
+#include "scene_manager.hpp"
+#include "scene_random.hpp"
+#include "clip_64x64.h"
+#include "gif_64x64.h"
+
+#include "host_test.hpp"
+
+// Scene loading and unloading: 1000 scene changes through all demo scenes, each shown until its
+// transition has finished and the previous scene is destroyed. With all scenes unloaded, free LVGL
+// heap and the largest free block must be back at their values after the warm-up, so nothing leaks
+// and the heap does not fragment. While a scene is shown, its content (random balls, label texts)
+// holds a few bytes more or less, but its largest free block must be the same every time.
+// The arena is the one of hub75_lvgl.cpp.
+
+#define SCENE_ARENA_SIZE (104 * 1024)
+#define CYCLES 1000
+#define FRAME_MS 200 ///< Large ticks, so the transitions of 1 to 2 s end after a few frames
+
+/// @brief Free LVGL heap
+struct HeapState
+{
+    size_t free;
+    size_t biggest;
+};
+
+static HeapState heap_state()
+{
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    return {mon.free_size, mon.free_biggest_size};
+}
+
+/**
+ * @brief Loads a scene and renders until the transition has finished.
+ */
+static bool show(SceneManager &sceneManager, size_t index)
+{
+    if (!sceneManager.load(index))
+    {
+        return false;
+    }
+    for (uint frame = 0; frame < 50 && sceneManager.in_transition(); frame++)
+    {
+        host_test_advance(FRAME_MS);
+        sceneManager.update();
+        lv_timer_handler();
+    }
+    return !sceneManager.in_transition();
+}
+
+int main()
+{
+    host_test_display(64, 64);
+    scene_random_seed(1);
+    static uint8_t arena_memory[SCENE_ARENA_SIZE] __attribute__((aligned(8)));
+
+    BouncingBalls bouncingBalls(15);
+    FireEffect fireEffect;
+    ImageAnimation imageAnimation;
+    ColourCheck colourCheck;
+    ClipAnimation clipAnimation(clip_64x64, sizeof(clip_64x64));
+    GifAnimation gifAnimation(gif_64x64, sizeof(gif_64x64));
+    SpriteSwarm spriteSwarm(256);
+    ParticleEffect particleEffect(6144);
+    PlasmaEffect plasma;
+    TunnelEffect tunnel;
+    StarfieldEffect starfield;
+    ProceduralScene plasmaScene(plasma);
+    ProceduralScene tunnelScene(tunnel);
+    ProceduralScene starfieldScene(starfield);
+    Scene *scenes[] = {&bouncingBalls, &fireEffect, &imageAnimation, &colourCheck, &clipAnimation, &gifAnimation, &spriteSwarm, &particleEffect,
+                       &plasmaScene, &tunnelScene, &starfieldScene};
+    const size_t count = sizeof(scenes) / sizeof(scenes[0]);
+    SceneManager sceneManager(scenes, count, arena_memory, sizeof(arena_memory));
+
+    lv_obj_t *blank = lv_screen_active();
+
+    // Two rounds fill LVGL's caches and pools, the third records the largest free block of every scene
+    size_t biggest[count];
+    for (size_t i = 0; i < 3 * count; i++)
+    {
+        if (!CHECK(show(sceneManager, i % count)))
+        {
+            printf("  scene %s\n", scenes[i % count]->name());
+        }
+        biggest[i % count] = heap_state().biggest;
+    }
+    lv_screen_load(blank);
+    sceneManager.unload();
+    HeapState baseline = heap_state();
+
+    uint fragmented = 0, failed = 0;
+    for (size_t cycle = 0; cycle < CYCLES; cycle++)
+    {
+        size_t index = cycle % count;
+        failed += !show(sceneManager, index);
+        size_t state = heap_state().biggest;
+        if (state != biggest[index] && fragmented++ == 0)
+        {
+            printf("  after %zu changes %s: largest free block %zu bytes, %zu after the warm-up\n", cycle + 1, scenes[index]->name(), state,
+                   biggest[index]);
+        }
+    }
+    CHECK(failed == 0);
+    CHECK(fragmented == 0);
+
+    lv_screen_load(blank);
+    sceneManager.unload();
+    HeapState state = heap_state();
+    if (!CHECK(state.free == baseline.free && state.biggest == baseline.biggest))
+    {
+        printf("  %zu bytes free, largest block %zu after %u changes, %zu and %zu after the warm-up\n", state.free, state.biggest, CYCLES, baseline.free,
+               baseline.biggest);
+    }
+
+    for (size_t i = 0; i < count; i++)
+    {
+        const SceneManager::SceneStats &stats = sceneManager.get_stats(i);
+        CHECK(stats.activations > 3);
+        CHECK(stats.arena_peak <= SCENE_ARENA_SIZE);
+    }
+    return host_test_result();
+}
@@ -0,0 +1,172 @@
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "lvgl/src/core/lv_obj.h"
+#include "lvgl/src/display/lv_display.h"
+#include "lvgl/src/misc/lv_anim.h"
+#include "lvgl/src/misc/lv_text_private.h"
+#include "lvgl/src/widgets/label/lv_label.h"
+
+#include "text_strip.hpp"
+
+#include "host_test.hpp"
+
+// Text strips: a static strip shown with create_label() and a ticker from create_ticker() render the
+// same pixels as an lv_label with the same text, font and colour, for Montserrat 14 with kerning pairs
+// and for SimSun 16 CJK, opaque and at LV_OPA_30. The ticker is compared at every scroll
+// offset of a cycle, and it scrolls as far and as fast as the label.
+// A second strip of known letters is served from the glyph atlas.
+
+#define WIDTH 64
+#define HEIGHT 64
+#define ARENA_SIZE (16 * 1024)
+#define TICKER_SPEED 40   ///< Pixels per second, as in the bouncing balls scene
+
+LV_FONT_DECLARE(lv_font_simsun_16_cjk)
+
+static uint8_t arena_memory[ARENA_SIZE];
+
+static const char *const montserrat_text = "AVA Tory\nWave LT";
+static const char *const montserrat_ticker = "AVATAR: Yes, To Wyoming. ";
+static const char *const simsun_text = "你好世界\n中文字体";
+static const char *const simsun_ticker = "今天天气很好，我去学校。";
+
+static lv_obj_t *prepare_screen()
+{
+    lv_obj_t *screen = lv_screen_active();
+    lv_obj_clean(screen);
+    lv_obj_set_style_bg_color(screen, lv_color_make(0, 40, 90), LV_PART_MAIN);
+    lv_obj_set_style_bg_opa(screen, LV_OPA_COVER, LV_PART_MAIN);
+    lv_obj_set_style_pad_all(screen, 0, LV_PART_MAIN);
+    return screen;
+}
+
+static std::vector<uint8_t> frame()
+{
+    host_test_render();
+    return std::vector<uint8_t>(host_test_frame(), host_test_frame() + WIDTH * HEIGHT * 3);
+}
+
+static bool all_letters(const char *text, const lv_font_t *font)
+{
+    uint32_t i = 0;
+    for (uint32_t letter = lv_text_encoded_next(text, &i); letter != 0; letter = lv_text_encoded_next(text, &i))
+    {
+        lv_font_glyph_dsc_t dsc;
+        if (letter != '\n' && !lv_font_get_glyph_dsc(font, &dsc, letter, 0))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void check_static(const char *text, const lv_font_t *font, lv_opa_t opa)
+{
+    CHECK(all_letters(text, font));
+    lv_color_t color = lv_color_make(250, 200, 120);
+
+    lv_obj_t *label = lv_label_create(prepare_screen());
+    lv_label_set_text(label, text);
+    lv_obj_set_style_text_font(label, font, LV_PART_MAIN);
+    lv_obj_set_style_text_color(label, color, LV_PART_MAIN);
+    lv_obj_set_style_text_opa(label, opa, LV_PART_MAIN);
+    lv_obj_set_pos(label, 3, 5);
+    std::vector<uint8_t> expected = frame();
+
+    SceneArena arena(arena_memory, sizeof(arena_memory));
+    TextStrip strip;
+    CHECK(strip.render(text, font, arena.region(0)));
+    lv_obj_t *image = strip.create_label(prepare_screen(), color, opa);
+    lv_obj_set_pos(image, 3, 5);
+    if (!CHECK(frame() == expected))
+    {
+        printf("  static \"%s\" at opacity %u differs from the label\n", text, opa);
+    }
+    lv_obj_clean(lv_screen_active());
+    strip.release();
+}
+
+/**
+ * @brief Renders a ticker at every scroll offset of one cycle, set through its animation.
+ */
+static std::vector<std::vector<uint8_t>> ticker_frames(lv_obj_t *ticker, const lv_anim_t &anim)
+{
+    lv_obj_set_pos(ticker, 0, 20);
+    std::vector<std::vector<uint8_t>> result;
+    for (int32_t x = anim.start_value; x >= anim.end_value; x--)
+    {
+        anim.exec_cb(ticker, x);
+        result.push_back(frame());
+    }
+    return result;
+}
+
+static void check_ticker(const char *text, const lv_font_t *font)
+{
+    CHECK(all_letters(text, font));
+    lv_color_t color = lv_color_make(200, 100, 120);
+
+    lv_obj_t *label = lv_label_create(prepare_screen());
+    lv_label_set_long_mode(label, LV_LABEL_LONG_MODE_SCROLL_CIRCULAR);
+    lv_obj_set_width(label, WIDTH);
+    lv_obj_set_style_text_font(label, font, LV_PART_MAIN);
+    lv_obj_set_style_text_color(label, color, LV_PART_MAIN);
+    lv_obj_set_style_anim_duration(label, lv_anim_speed(TICKER_SPEED), LV_PART_MAIN);
+    lv_label_set_text(label, text);
+    lv_anim_t label_anim = *lv_anim_get(label, NULL);
+    lv_anim_delete(label, NULL);
+    std::vector<std::vector<uint8_t>> expected = ticker_frames(label, label_anim);
+
+    SceneArena arena(arena_memory, sizeof(arena_memory));
+    TextStrip strip;
+    CHECK(strip.render(text, font, arena.region(0), TEXT_STRIP_TICKER_GAP));
+    lv_obj_t *ticker = strip.create_ticker(prepare_screen(), WIDTH, color, TICKER_SPEED);
+    lv_anim_t ticker_anim = *lv_anim_get(ticker, NULL);
+    lv_anim_delete(ticker, NULL);
+    // The same scroll distance at the same speed
+    CHECK(ticker_anim.start_value == label_anim.start_value && ticker_anim.end_value == label_anim.end_value);
+    CHECK(lv_anim_resolve_speed(ticker_anim.duration, ticker_anim.start_value, ticker_anim.end_value) ==
+          lv_anim_resolve_speed(label_anim.duration, label_anim.start_value, label_anim.end_value));
+    std::vector<std::vector<uint8_t>> actual = ticker_frames(ticker, ticker_anim);
+
+    uint32_t differing = 0;
+    for (size_t f = 0; f < expected.size() && f < actual.size(); f++)
+    {
+        differing += actual[f] != expected[f];
+    }
+    if (!CHECK(actual.size() == expected.size() && differing == 0))
+    {
+        printf("  ticker \"%s\": %u of %zu offsets differ from the label\n", text, differing, expected.size());
+    }
+    lv_obj_clean(lv_screen_active());
+    strip.release();
+}
+
+int main()
+{
+    host_test_display(WIDTH, HEIGHT);
+    glyph_atlas_clear();
+
+    for (lv_opa_t opa : {LV_OPA_COVER, LV_OPA_30})
+    {
+        check_static(montserrat_text, &lv_font_montserrat_14, opa);
+        check_static(simsun_text, &lv_font_simsun_16_cjk, opa);
+    }
+    check_ticker(montserrat_ticker, &lv_font_montserrat_14);
+    check_ticker(simsun_ticker, &lv_font_simsun_16_cjk);
+
+    // The second strip of the same text finds every letter in the atlas
+    SceneArena arena(arena_memory, sizeof(arena_memory));
+    TextStrip strip;
+    CHECK(strip.render(montserrat_text, &lv_font_montserrat_14, arena.region(0)));
+    GlyphAtlasInfo before;
+    glyph_atlas_info(before);
+    CHECK(strip.render(montserrat_text, &lv_font_montserrat_14, arena.region(0)));
+    GlyphAtlasInfo after;
+    glyph_atlas_info(after);
+    CHECK(after.misses == before.misses && after.hits > before.hits);
+
+    return host_test_result();
+}
@@ -0,0 +1,112 @@
+#include <cstdio>
+
+#include "hub75_timing.hpp"
+
+#include "host_test.hpp"
+
+// Timing calculator: for 64, 128 and 256 columns at 1/16 and 1/32 scan, a reachable refresh
+// target is met or exceeded by less than one OEn base step and the pixel clock stays at or below
+// its target; an unreachable one reports target_met false, falls back to HUB75_OEN_BASE_FALLBACK and
+// reports the refresh rate that gives. A very low target is limited by HUB75_OEN_BASE_MAX.
+// The expected rates are counted independently from the cycle budget in hub75_timing.hpp.
+
+#define SYS_HZ 150000000
+#define PIXEL_CLOCK_HZ 16000000
+#define BIT_DEPTH 10
+
+static Hub75TimingConfig config(uint32_t columns, uint32_t scan, uint32_t refresh_hz)
+{
+    Hub75TimingConfig c = {};
+    c.sys_hz = SYS_HZ;
+    c.pixel_clock_hz = PIXEL_CLOCK_HZ;
+    c.refresh_hz = refresh_hz;
+    c.columns = columns;
+    c.scan = scan;
+    c.bit_depth = BIT_DEPTH;
+    return c;
+}
+
+/**
+ * @brief Refresh rate of a frame, adding up every row address and bit plane.
+ */
+static double expected_refresh(const Hub75TimingConfig &c, const Hub75Timing &t, uint32_t oen_base)
+{
+    double shift = (c.columns + HUB75_DUMMY_COLUMNS) * HUB75_CYCLES_PER_COLUMN * (t.clkdiv_int + t.clkdiv_frac / 256.0);
+    double cycles = 0;
+    for (uint32_t row = 0; row < c.scan; row++)
+    {
+        for (uint32_t plane = 0; plane < c.bit_depth; plane++)
+        {
+            cycles += shift + HUB75_ROW_CYCLES + HUB75_IRQ_CYCLES + static_cast<double>(static_cast<uint64_t>(oen_base) << plane) + 1;
+        }
+    }
+    return SYS_HZ / cycles;
+}
+
+static bool close(double a, double b)
+{
+    return a > b * 0.999 && a < b * 1.001;
+}
+
+static void check_reachable(uint32_t columns, uint32_t scan, uint32_t refresh_hz)
+{
+    Hub75TimingConfig c = config(columns, scan, refresh_hz);
+    Hub75Timing t = hub75_compute_timing(c);
+    if (!CHECK(t.target_met && t.oen_base >= 1 && t.pixel_clock_hz <= PIXEL_CLOCK_HZ) ||
+        !CHECK(close(t.refresh_hz, expected_refresh(c, t, t.oen_base))) ||
+        !CHECK(t.refresh_hz >= refresh_hz && expected_refresh(c, t, t.oen_base + 1) < refresh_hz) ||
+        !CHECK(t.max_refresh_hz >= t.refresh_hz && t.duty > 0 && t.duty < 1))
+    {
+        printf("  %lu columns, 1/%lu scan, %lu Hz: OEn base %lu, %.1f Hz\n", (unsigned long)columns, (unsigned long)scan,
+               (unsigned long)refresh_hz, (unsigned long)t.oen_base, t.refresh_hz);
+    }
+}
+
+static void check_unreachable(uint32_t columns, uint32_t scan, uint32_t refresh_hz)
+{
+    Hub75TimingConfig c = config(columns, scan, refresh_hz);
+    Hub75Timing t = hub75_compute_timing(c);
+    if (!CHECK(!t.target_met && t.oen_base == HUB75_OEN_BASE_FALLBACK) ||
+        !CHECK(close(t.refresh_hz, expected_refresh(c, t, HUB75_OEN_BASE_FALLBACK))) ||
+        !CHECK(close(t.max_refresh_hz, expected_refresh(c, t, 1)) && t.max_refresh_hz < refresh_hz))
+    {
+        printf("  %lu columns, 1/%lu scan, %lu Hz: OEn base %lu, %.1f Hz, max %.1f Hz\n", (unsigned long)columns, (unsigned long)scan,
+               (unsigned long)refresh_hz, (unsigned long)t.oen_base, t.refresh_hz, t.max_refresh_hz);
+    }
+}
+
+int main()
+{
+    // 150 MHz limits the pixel clock to 150 / 16 MHz
+    Hub75Timing t = hub75_compute_timing(config(64, 32, 120));
+    CHECK(t.clkdiv_int == 1 && t.clkdiv_frac == 0 && t.pixel_clock_hz == SYS_HZ / HUB75_CYCLES_PER_COLUMN);
+
+    static const uint32_t columns[] = {64, 128, 256};
+    static const uint32_t scans[] = {16, 32};
+    for (uint32_t cols : columns)
+    {
+        for (uint32_t scan : scans)
+        {
+            check_reachable(cols, scan, 60);
+            check_reachable(cols, scan, 90);
+            check_unreachable(cols, scan, 1000);
+        }
+    }
+    // Between the fallback's and the shortest pulses' refresh rate: met with pulses shorter than the fallback
+    check_reachable(256, 32, 100);
+    CHECK(hub75_compute_timing(config(256, 32, 100)).oen_base < HUB75_OEN_BASE_FALLBACK);
+    // A slower pixel clock leaves less time for the pulses
+    Hub75TimingConfig slow = config(64, 32, 120);
+    slow.pixel_clock_hz = 4000000;
+    Hub75Timing slow_timing = hub75_compute_timing(slow);
+    CHECK(slow_timing.pixel_clock_hz <= 4000000 && slow_timing.target_met && slow_timing.oen_base < t.oen_base);
+
+    // The pulse of the highest bit plane has to fit the 27-bit count of the row program
+    Hub75TimingConfig low_config = config(64, 16, 1);
+    low_config.sys_hz = 4000000000u;
+    Hub75Timing low = hub75_compute_timing(low_config);
+    CHECK(low.target_met && low.oen_base == HUB75_OEN_BASE_MAX);
+    CHECK((static_cast<uint64_t>(low.oen_base) << (BIT_DEPTH - 1)) < (1u << 27));
+
+    return host_test_result();
+}
@@ -0,0 +1,352 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <poll.h>
+#include <pty.h>
+#include <string>
+#include <termios.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+#include "pico/stdio.h"
+
+#include "hub75.hpp"
+#include "usb_stream.hpp"
+
+#include "host_test.hpp"
+
+// USB stream receiver, fed through the stand-in stdio: full frames and dirty rectangles end up in
+// the frame buffer as a complete conversion would put them there, late frames are dropped, and a
+// new session after the timeout may start its sequence numbers anew. Then a pty loopback at 64x64 and
+// 256x128 (two chains): the receiver reads one end as its stdio and prints its acknowledgements there,
+// a sender on the other end follows tools/hub75_stream.py and waits for every "ACK <sequence>".
+// It reports the sustained fps and the round trip from the header to the acknowledgement.
+
+#define MEASURED_FRAMES 200 ///< Acknowledged frames per loopback run
+
+typedef std::vector<uint8_t> Frame;
+
+static int saved_stdout = -1;
+
+/// @brief The receiver acknowledges every frame on stdout, which would drown the results
+static void mute_stdout()
+{
+    fflush(stdout);
+    saved_stdout = dup(1);
+    FILE *null = fopen("/dev/null", "w");
+    dup2(fileno(null), 1);
+    fclose(null);
+}
+
+static void restore_stdout()
+{
+    fflush(stdout);
+    dup2(saved_stdout, 1);
+    close(saved_stdout);
+}
+
+static Frame pattern(uint width, uint height, uint seed)
+{
+    Frame frame(width * height * 3);
+    for (size_t i = 0; i < frame.size(); i++)
+    {
+        frame[i] = static_cast<uint8_t>(i * 7 + seed * 29 + (i / (width * 3)) * seed);
+    }
+    return frame;
+}
+
+/**
+ * @brief Queues a header and the pixels of a rectangle of frame.
+ */
+static void send(const Frame &frame, uint width, uint32_t sequence, uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool dirty_rect)
+{
+    StreamHeader header = {STREAM_MAGIC, sequence, STREAM_FORMAT_RGB888, static_cast<uint8_t>(dirty_rect ? STREAM_FLAG_DIRTY_RECT : 0), x, y, w, h, 0};
+    host_stdio_feed(&header, sizeof(header));
+    for (uint row = y; row < static_cast<uint>(y + h); row++)
+    {
+        host_stdio_feed(&frame[(row * width + x) * 3], w * 3);
+    }
+}
+
+static std::vector<uint32_t> converted(uint width, uint height)
+{
+    return std::vector<uint32_t>(frame_buffer, frame_buffer + width * height);
+}
+
+/// @brief The frame buffer of a complete conversion of frame
+static std::vector<uint32_t> reference(const Frame &frame, uint width, uint height)
+{
+    std::vector<uint32_t> saved = converted(width, height);
+    invalidate_frame();
+    update(const_cast<uint8_t *>(frame.data()));
+    std::vector<uint32_t> result = converted(width, height);
+    for (uint i = 0; i < width * height; i++)
+    {
+        frame_buffer[i] = saved[i];
+    }
+    invalidate_frame();
+    return result;
+}
+
+static void check_protocol()
+{
+    const uint width = 64, height = 64;
+    create_hub75_driver(width, height);
+    UsbStreamReceiver receiver(width, height);
+    uint32_t now = 1000;
+
+    mute_stdout();
+    Frame a = pattern(width, height, 1);
+    send(a, width, 10, 0, 0, width, height, false);
+    bool full_shown = receiver.poll(now);
+    bool full_ok = converted(width, height) == reference(a, width, height);
+
+    // A dirty rectangle of the next frame
+    Frame b = pattern(width, height, 2);
+    Frame composite = a;
+    for (uint y = 7; y < 17; y++)
+    {
+        for (uint x = 5; x < 25; x++)
+        {
+            for (uint c = 0; c < 3; c++)
+            {
+                composite[(y * width + x) * 3 + c] = b[(y * width + x) * 3 + c];
+            }
+        }
+    }
+    send(b, width, 11, 5, 7, 20, 10, true);
+    bool rect_shown = receiver.poll(now += 16);
+    bool rect_ok = converted(width, height) == reference(composite, width, height);
+
+    // A late frame is read but not shown
+    send(pattern(width, height, 3), width, 9, 0, 0, width, height, false);
+    bool late_shown = receiver.poll(now += 16);
+    bool late_ok = converted(width, height) == reference(composite, width, height);
+    bool active = receiver.active(now);
+
+    // The host tool restarts after the timeout and counts from 1 again
+    now += STREAM_TIMEOUT_MS + 100;
+    bool timed_out = !receiver.active(now);
+    Frame c = pattern(width, height, 4);
+    send(c, width, 1, 0, 0, width, height, false);
+    bool restart_shown = receiver.poll(now);
+    bool restart_ok = converted(width, height) == reference(c, width, height);
+    send(a, width, 1, 0, 0, width, height, false);
+    bool repeat_shown = receiver.poll(now += 16);
+    restore_stdout();
+
+    CHECK(full_shown && full_ok);
+    CHECK(rect_shown && rect_ok);
+    CHECK(!late_shown && late_ok);
+    CHECK(active && timed_out);
+    CHECK(restart_shown && restart_ok);
+    CHECK(!repeat_shown);
+    CHECK(receiver.shown() == 3 && receiver.dropped() == 2);
+}
+
+/**
+ * @brief Bounding box of the pixels in which frame differs from previous, as tools/hub75_stream.py sends it.
+ *
+ * An unchanged frame still sends its top-left pixel, so the panel keeps the stream alive.
+ */
+static void dirty_rect(const Frame &previous, const Frame &frame, uint width, uint height, uint16_t rect[4])
+{
+    uint left = width, right = 0, top = height, bottom = 0;
+    for (uint y = 0; y < height; y++)
+    {
+        for (uint x = 0; x < width; x++)
+        {
+            if (memcmp(&previous[(y * width + x) * 3], &frame[(y * width + x) * 3], 3) != 0)
+            {
+                left = std::min(left, x);
+                right = std::max(right, x);
+                top = std::min(top, y);
+                bottom = y;
+            }
+        }
+    }
+    if (top == height)
+    {
+        left = right = top = bottom = 0;
+    }
+    rect[0] = left;
+    rect[1] = top;
+    rect[2] = right - left + 1;
+    rect[3] = bottom - top + 1;
+}
+
+static void write_all(int fd, const void *data, size_t size)
+{
+    const uint8_t *bytes = static_cast<const uint8_t *>(data);
+    while (size != 0)
+    {
+        ssize_t n = write(fd, bytes, size);
+        if (n <= 0)
+        {
+            return;
+        }
+        bytes += n;
+        size -= n;
+    }
+}
+
+/**
+ * @brief Reads lines from fd until "ACK <sequence>" arrives. Other lines are the firmware's log output.
+ */
+static bool wait_ack(int fd, uint32_t sequence, std::string &pending)
+{
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+    while (std::chrono::steady_clock::now() < deadline)
+    {
+        size_t end;
+        while ((end = pending.find('\n')) != std::string::npos)
+        {
+            std::string line = pending.substr(0, end);
+            pending.erase(0, end + 1);
+            if (line.compare(0, 4, "ACK ") == 0 && strtoul(line.c_str() + 4, nullptr, 10) == sequence)
+            {
+                return true;
+            }
+        }
+        pollfd ready = {fd, POLLIN, 0};
+        char buf[64];
+        ssize_t n = poll(&ready, 1, 10) > 0 ? read(fd, buf, sizeof(buf)) : 0;
+        if (n > 0)
+        {
+            pending.append(buf, n);
+        }
+    }
+    return false;
+}
+
+/// @brief Outcome of a loopback run on the sender's side
+struct LoopbackResult
+{
+    uint32_t acknowledged = 0;
+    uint32_t lost = 0;
+    double seconds = 0;
+    uint64_t payload_bytes = 0;
+    std::vector<double> latency_ms;
+    Frame last; ///< Last acknowledged frame
+};
+
+/**
+ * @brief The sender of tools/hub75_stream.py without the rate limit: the moving test pattern, a dirty
+ * rectangle against the last acknowledged frame, and the next frame only after the acknowledgement.
+ */
+static void send_frames(int fd, uint width, uint height, uint frames, LoopbackResult &result)
+{
+    std::string pending;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t sequence = 1; result.acknowledged < frames && result.lost < 3; sequence++)
+    {
+        Frame frame(width * height * 3);
+        for (uint y = 0, i = 0; y < height; y++)
+        {
+            for (uint x = 0; x < width; x++, i += 3)
+            {
+                uint8_t v = static_cast<uint8_t>(x + y + sequence);
+                frame[i] = v;
+                frame[i + 1] = static_cast<uint8_t>(v * 2 + 85);
+                frame[i + 2] = 255 - v;
+            }
+        }
+        uint16_t rect[4] = {0, 0, static_cast<uint16_t>(width), static_cast<uint16_t>(height)};
+        if (!result.last.empty())
+        {
+            dirty_rect(result.last, frame, width, height, rect);
+        }
+        uint8_t flags = result.last.empty() ? 0 : STREAM_FLAG_DIRTY_RECT;
+        StreamHeader header = {STREAM_MAGIC, sequence, STREAM_FORMAT_RGB888, flags, rect[0], rect[1], rect[2], rect[3], 0};
+
+        auto sent = std::chrono::steady_clock::now();
+        write_all(fd, &header, sizeof(header));
+        for (uint row = rect[1]; row < static_cast<uint>(rect[1] + rect[3]); row++)
+        {
+            write_all(fd, &frame[(row * width + rect[0]) * 3], rect[2] * 3);
+        }
+        if (!wait_ack(fd, sequence, pending))
+        {
+            result.lost++;
+            result.last.clear(); // The panel content is unknown, the next frame is sent whole
+            continue;
+        }
+        result.latency_ms.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - sent).count());
+        result.payload_bytes += rect[2] * rect[3] * 3;
+        result.acknowledged++;
+        result.last = frame;
+    }
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/**
+ * @brief Streams frames through a pty: the receiver reads the slave as its stdio and acknowledges on it,
+ * the sender on the master waits for every acknowledgement. Reports sustained fps and the round trip.
+ */
+static void loopback(uint width, uint height, uint chains)
+{
+    create_hub75_driver(width, height, 0, MULTIPLEX_LINEAR, chains);
+    UsbStreamReceiver receiver(width, height);
+
+    int master, slave;
+    if (!CHECK(openpty(&master, &slave, nullptr, nullptr, nullptr) == 0))
+    {
+        return;
+    }
+    termios raw;
+    tcgetattr(slave, &raw);
+    cfmakeraw(&raw); // Binary payload: no echo, no line discipline
+    tcsetattr(slave, TCSANOW, &raw);
+
+    fflush(stdout);
+    saved_stdout = dup(1);
+    dup2(slave, 1); // The acknowledgements are printed, as on the device
+    host_stdio_connect(slave);
+
+    LoopbackResult result;
+    std::atomic<bool> done{false};
+    std::thread sender([&]() {
+        send_frames(master, width, height, MEASURED_FRAMES, result);
+        done = true;
+    });
+    auto start = std::chrono::steady_clock::now();
+    while (!done)
+    {
+        uint32_t now = static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count());
+        receiver.poll(now);
+        fflush(stdout);
+        std::this_thread::yield();
+    }
+    sender.join();
+
+    host_stdio_connect(-1);
+    restore_stdout();
+    close(slave);
+    close(master);
+
+    CHECK(result.acknowledged == MEASURED_FRAMES && result.lost == 0);
+    CHECK(receiver.shown() == result.acknowledged);
+    if (!result.last.empty())
+    {
+        CHECK(converted(width, height) == reference(result.last, width, height));
+    }
+    if (result.latency_ms.empty())
+    {
+        return;
+    }
+    std::sort(result.latency_ms.begin(), result.latency_ms.end());
+    printf("%3ux%-3u %6.1f KB payload per frame: %6.0f fps, ACK round trip median %5.2f ms, p95 %5.2f ms, max %5.2f ms\n", width, height,
+           result.payload_bytes / 1024.0 / result.acknowledged, result.acknowledged / result.seconds, result.latency_ms[result.latency_ms.size() / 2],
+           result.latency_ms[result.latency_ms.size() * 95 / 100], result.latency_ms.back());
+}
+
+int main()
+{
+    check_protocol();
+    loopback(64, 64, 1);
+    loopback(256, 128, 2);
+    return host_test_result();
+}
@@ -0,0 +1,189 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "lvgl/src/lv_init.h"
+#include "lvgl/src/core/lv_obj.h"
+#include "lvgl/src/core/lv_refr.h"
+#include "lvgl/src/display/lv_display.h"
+#include "lvgl/src/misc/lv_timer.h"
+#include "lvgl/src/tick/lv_tick.h"
+#include "lvgl/src/widgets/label/lv_label.h"
+
+#include "text_strip.hpp"
+
+// Benchmark of TextStrip against lv_label: a 64x64 display in full render mode, the whole screen
+// redrawn on every frame, without conversion for the panel. Tickers scroll at 40 pixels per second
+// like in the bouncing balls scene, static texts are two lines. Montserrat 14 with kerning pairs
+// and SimSun 16 CJK, which host/simsun_16_cjk.c compiles in. Per text: the median render time per
+// frame with the label and with the strip, and the median time to rasterise the strip with an empty
+// glyph atlas and with its letters in the atlas. test_text_strip checks that both give the same pixels.
+//
+//   hub75_text_bench [--frames N]
+
+#define TEXT_BENCH_FRAMES 1000  ///< Timed frames per case if --frames is not given
+#define TEXT_BENCH_WARM_UP 10   ///< Untimed frames before each case
+#define TEXT_BENCH_FRAME_MS 16  ///< Tick advance per frame
+#define TEXT_BENCH_RENDERS 200  ///< Timed rasterisations per atlas state
+#define TEXT_BENCH_WIDTH 64
+#define TEXT_BENCH_HEIGHT 64
+#define TEXT_BENCH_ARENA_SIZE (16 * 1024)
+#define TICKER_SPEED 40 ///< Pixels per second
+
+LV_FONT_DECLARE(lv_font_simsun_16_cjk)
+
+/**
+ * @brief One benchmark case: a text, its font and whether it scrolls.
+ */
+struct TextCase
+{
+    const char *name;
+    const char *text;
+    const lv_font_t *font;
+    bool ticker;
+};
+
+static uint32_t bench_ms = 0;
+static uint8_t arena_memory[TEXT_BENCH_ARENA_SIZE];
+
+static uint32_t bench_tick()
+{
+    return bench_ms;
+}
+
+static void bench_flush_cb(lv_display_t *display, const lv_area_t *, uint8_t *)
+{
+    lv_display_flush_ready(display);
+}
+
+static double median(std::vector<double> &us)
+{
+    std::sort(us.begin(), us.end());
+    return us[us.size() / 2];
+}
+
+/**
+ * @brief Renders the frames of the active screen and returns the median render time per frame.
+ */
+static double run_frames(uint frames)
+{
+    std::vector<double> render_us;
+    for (uint f = 0; f < TEXT_BENCH_WARM_UP + frames; f++)
+    {
+        auto start = std::chrono::steady_clock::now();
+        bench_ms += TEXT_BENCH_FRAME_MS;
+        lv_obj_invalidate(lv_screen_active());
+        lv_timer_handler();
+        if (f >= TEXT_BENCH_WARM_UP)
+        {
+            render_us.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count());
+        }
+    }
+    return median(render_us);
+}
+
+/**
+ * @brief Returns the median time to rasterise the text, with an empty atlas or with its letters in the atlas.
+ */
+static double rasterise(const TextCase &c, bool warm)
+{
+    SceneArena arena(arena_memory, sizeof(arena_memory));
+    TextStrip strip;
+    std::vector<double> render_us;
+    for (uint i = 0; i < TEXT_BENCH_RENDERS; i++)
+    {
+        if (!warm)
+        {
+            glyph_atlas_clear();
+        }
+        arena.region(0).release();
+        auto start = std::chrono::steady_clock::now();
+        strip.render(c.text, c.font, arena.region(0), c.ticker ? TEXT_STRIP_TICKER_GAP : 0);
+        render_us.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count());
+    }
+    return median(render_us);
+}
+
+static void run_case(const TextCase &c, uint frames)
+{
+    lv_obj_t *screen = lv_screen_active();
+    lv_color_t color = lv_color_make(200, 100, 120);
+
+    lv_obj_t *label = lv_label_create(screen);
+    lv_obj_set_style_text_font(label, c.font, LV_PART_MAIN);
+    lv_obj_set_style_text_color(label, color, LV_PART_MAIN);
+    if (c.ticker)
+    {
+        lv_label_set_long_mode(label, LV_LABEL_LONG_MODE_SCROLL_CIRCULAR);
+        lv_obj_set_width(label, TEXT_BENCH_WIDTH);
+        lv_obj_set_style_anim_duration(label, lv_anim_speed(TICKER_SPEED), LV_PART_MAIN);
+    }
+    lv_label_set_text(label, c.text);
+    double label_us = run_frames(frames);
+    lv_obj_clean(screen);
+
+    double cold_us = rasterise(c, false);
+    double warm_us = rasterise(c, true);
+
+    SceneArena arena(arena_memory, sizeof(arena_memory));
+    TextStrip strip;
+    if (!strip.render(c.text, c.font, arena.region(0), c.ticker ? TEXT_STRIP_TICKER_GAP : 0))
+    {
+        fprintf(stderr, "failed to rasterise %s\n", c.name);
+        exit(EXIT_FAILURE);
+    }
+    if (c.ticker)
+    {
+        strip.create_ticker(screen, TEXT_BENCH_WIDTH, color, TICKER_SPEED);
+    }
+    else
+    {
+        strip.create_label(screen, color);
+    }
+    double strip_us = run_frames(frames);
+    lv_obj_clean(screen);
+    strip.release();
+
+    printf("%-30s %10.1f %10.1f %10.1f %10.1f\n", c.name, label_us, strip_us, cold_us, warm_us);
+}
+
+int main(int argc, char **argv)
+{
+    uint frames = TEXT_BENCH_FRAMES;
+    if (argc == 3 && strcmp(argv[1], "--frames") == 0)
+    {
+        frames = std::max(1ul, strtoul(argv[2], nullptr, 10));
+    }
+    else if (argc != 1)
+    {
+        fprintf(stderr, "usage: hub75_text_bench [--frames N]\n");
+        return EXIT_FAILURE;
+    }
+
+    lv_init();
+    lv_tick_set_cb(bench_tick);
+
+    size_t buffer_size = TEXT_BENCH_WIDTH * TEXT_BENCH_HEIGHT * 3;
+    uint8_t *buffer = new uint8_t[buffer_size];
+    lv_display_t *display = lv_display_create(TEXT_BENCH_WIDTH, TEXT_BENCH_HEIGHT);
+    lv_display_set_buffers_with_stride(display, buffer, NULL, buffer_size, TEXT_BENCH_WIDTH * 3, LV_DISPLAY_RENDER_MODE_FULL);
+    lv_display_set_flush_cb(display, bench_flush_cb);
+    lv_obj_set_style_bg_color(lv_screen_active(), lv_color_black(), LV_PART_MAIN);
+
+    static const TextCase cases[] = {
+        {"ticker, Montserrat 14", "This is a circulating scrolling text. ", &lv_font_montserrat_14, true},
+        {"ticker, SimSun 16 CJK", "今天天气很好，我和朋友去学校打球吧。", &lv_font_simsun_16_cjk, true},
+        {"static, Montserrat 14", "AVA Tory\nWave LT", &lv_font_montserrat_14, false},
+        {"static, SimSun 16 CJK", "你好世界\n中文字体", &lv_font_simsun_16_cjk, false},
+    };
+
+    printf("%-30s %10s %10s %10s %10s\n", "text", "label us", "strip us", "cold us", "warm us");
+    for (const TextCase &c : cases)
+    {
+        run_case(c, frames);
+    }
+    return EXIT_SUCCESS;
+}
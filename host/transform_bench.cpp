@@ -0,0 +1,186 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "pico/stdlib.h"
+
+#include "hub75.hpp"
+#include "lvgl/src/lv_init.h"
+#include "lvgl/src/core/lv_refr.h"
+#include "lvgl/src/display/lv_display.h"
+#include "lvgl/src/draw/sw/lv_draw_sw.h"
+#include "lvgl/src/misc/lv_timer.h"
+#include "lvgl/src/tick/lv_tick.h"
+#include "lvgl/src/widgets/image/lv_image.h"
+
+#include "colour_squares.h"
+#include "vanessa_mai_64x64.h"
+
+// Benchmark of the transformed image cache (LV_DRAW_SW_TRANSFORM_CACHE_SIZE in lv_conf.h): a 64x64
+// display in full render mode with one transformed image, the 64x64 portrait of ImageAnimation or the
+// 256x180 picture of ColourCheck. Every case renders the same frames with the cache and with the cache
+// dropped before each frame. The cases step the rotation through 1, 2, 4 and 8 angles, rotate by a tenth
+// of a degree per frame like ImageAnimation, rotate the portrait at full size, which does not fit the
+// budget, and scale the picture like ColourCheck. Per case: the render time per frame with and without
+// the cache, and the hit rate and evictions with it.
+//
+//   hub75_transform_bench [--frames N]
+
+#define TRANSFORM_BENCH_FRAMES 1000 ///< Timed frames per case if --frames is not given
+#define TRANSFORM_BENCH_WARM_UP 10  ///< Untimed frames before each case
+#define TRANSFORM_BENCH_FRAME_MS 16 ///< Tick advance per frame
+#define TRANSFORM_BENCH_WIDTH 64
+#define TRANSFORM_BENCH_HEIGHT 64
+#define VANESSA_SIZE 64
+
+/**
+ * @brief One benchmark case: the image, its scale and the rotations it cycles through.
+ */
+struct TransformCase
+{
+    const char *name;
+    const lv_image_dsc_t *image;
+    uint16_t scale_x;
+    uint16_t scale_y;
+    int32_t rotation;      ///< First rotation in 0.1 degree
+    int32_t rotation_step; ///< Added per frame
+    uint32_t angles;       ///< Rotations before the cycle repeats, 0 for never
+};
+
+static uint32_t bench_ms = 0;
+
+static uint32_t bench_tick()
+{
+    return bench_ms;
+}
+
+static void bench_flush_cb(lv_display_t *display, const lv_area_t *, uint8_t *px_map)
+{
+    update_bgr(px_map);
+    lv_display_flush_ready(display);
+}
+
+static lv_image_dsc_t image_dsc(const uint8_t *data, uint32_t size, uint32_t w, uint32_t h)
+{
+    lv_image_dsc_t dsc = {};
+    dsc.header.magic = LV_IMAGE_HEADER_MAGIC;
+    dsc.header.w = w;
+    dsc.header.h = h;
+    dsc.header.cf = LV_COLOR_FORMAT_RGB888;
+    dsc.header.stride = w * 3;
+    dsc.data_size = size;
+    dsc.data = data;
+    return dsc;
+}
+
+/**
+ * @brief Renders one full frame with the rotation of the given frame number.
+ */
+static void run_frame(lv_obj_t *image, const TransformCase &c, uint32_t frame, bool cached)
+{
+    uint32_t step = c.angles ? frame % c.angles : frame;
+    lv_image_set_rotation(image, (c.rotation + static_cast<int32_t>(step) * c.rotation_step) % 3600);
+    if (!cached)
+    {
+        lv_draw_sw_transform_cache_drop(NULL);
+    }
+    bench_ms += TRANSFORM_BENCH_FRAME_MS;
+    lv_obj_invalidate(lv_screen_active());
+    lv_timer_handler();
+}
+
+/**
+ * @brief Renders the frames of a case and returns the median render time per frame.
+ */
+static double run_pass(lv_obj_t *image, const TransformCase &c, bool cached, uint frames)
+{
+    lv_draw_sw_transform_cache_drop(NULL);
+    for (uint32_t f = 0; f < TRANSFORM_BENCH_WARM_UP; f++)
+    {
+        run_frame(image, c, f, cached);
+    }
+    std::vector<double> render_us;
+    for (uint32_t f = 0; f < frames; f++)
+    {
+        auto start = std::chrono::steady_clock::now();
+        run_frame(image, c, TRANSFORM_BENCH_WARM_UP + f, cached);
+        render_us.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count());
+    }
+    std::sort(render_us.begin(), render_us.end());
+    return render_us[render_us.size() / 2];
+}
+
+static void run_case(lv_obj_t *image, const TransformCase &c, uint frames)
+{
+    lv_image_set_src(image, c.image);
+    lv_image_set_scale_x(image, c.scale_x);
+    lv_image_set_scale_y(image, c.scale_y);
+    lv_image_set_pivot(image, c.image->header.w / 2, c.image->header.h / 2);
+    lv_obj_center(image);
+
+    double without_us = run_pass(image, c, false, frames);
+
+    lv_draw_sw_transform_cache_info_t before;
+    lv_draw_sw_transform_cache_get_info(&before);
+    double with_us = run_pass(image, c, true, frames);
+    lv_draw_sw_transform_cache_info_t after;
+    lv_draw_sw_transform_cache_get_info(&after);
+
+    uint32_t hits = after.hits - before.hits;
+    uint32_t lookups = hits + after.misses - before.misses;
+    printf("%-28s %10.1f %10.1f %7.0f%% %9lu\n", c.name, without_us, with_us, lookups ? 100.0 * hits / lookups : 0.0,
+           (unsigned long)(after.evictions - before.evictions));
+}
+
+int main(int argc, char **argv)
+{
+    uint frames = TRANSFORM_BENCH_FRAMES;
+    if (argc == 3 && strcmp(argv[1], "--frames") == 0)
+    {
+        frames = std::max(1ul, strtoul(argv[2], nullptr, 10));
+    }
+    else if (argc != 1)
+    {
+        fprintf(stderr, "usage: hub75_transform_bench [--frames N]\n");
+        return EXIT_FAILURE;
+    }
+
+    lv_init();
+    lv_tick_set_cb(bench_tick);
+
+    create_hub75_driver(TRANSFORM_BENCH_WIDTH, TRANSFORM_BENCH_HEIGHT, 0, MULTIPLEX_LINEAR, 1);
+    size_t buffer_size = TRANSFORM_BENCH_WIDTH * TRANSFORM_BENCH_HEIGHT * 3;
+    uint8_t *buffer = new uint8_t[buffer_size];
+    lv_display_t *display = lv_display_create(TRANSFORM_BENCH_WIDTH, TRANSFORM_BENCH_HEIGHT);
+    lv_display_set_buffers_with_stride(display, buffer, NULL, buffer_size, TRANSFORM_BENCH_WIDTH * 3, LV_DISPLAY_RENDER_MODE_FULL);
+    lv_display_set_flush_cb(display, bench_flush_cb);
+
+    lv_obj_t *screen = lv_screen_active();
+    lv_obj_set_style_bg_color(screen, lv_color_black(), LV_PART_MAIN);
+    lv_obj_t *image = lv_image_create(screen);
+    lv_image_set_antialias(image, true);
+
+    static const lv_image_dsc_t vanessa = image_dsc(vanessa_mai_64x64, sizeof(vanessa_mai_64x64), VANESSA_SIZE, VANESSA_SIZE);
+    static const lv_image_dsc_t squares = image_dsc(colour_squares_map, sizeof(colour_squares_map), 256, 180);
+    // The half size rotated portrait takes up to 8.5 KB as ARGB8888: two fit the budget, of four some are
+    // evicted on every cycle and eight outrun the LV_DRAW_SW_TRANSFORM_CACHE_ENTRIES candidates, so they are never cached
+    static const TransformCase cases[] = {
+        {"portrait 1/2, 1 angle", &vanessa, 128, 128, 450, 0, 1},
+        {"portrait 1/2, 2 angles", &vanessa, 128, 128, 300, 300, 2},
+        {"portrait 1/2, 4 angles", &vanessa, 128, 128, 150, 300, 4},
+        {"portrait 1/2, 8 angles", &vanessa, 128, 128, 0, 450, 8},
+        {"portrait 1/2, rotating", &vanessa, 128, 128, 0, 1, 0},
+        {"portrait, 1 angle", &vanessa, LV_SCALE_NONE, LV_SCALE_NONE, 450, 0, 1},
+        {"picture scaled, 1 angle", &squares, 64, 92, 0, 0, 1},
+    };
+
+    printf("%-28s %10s %10s %8s %9s\n", "case", "without us", "with us", "hits", "evictions");
+    for (const TransformCase &c : cases)
+    {
+        run_case(image, c, frames);
+    }
+    return EXIT_SUCCESS;
+}
@@ -1,10 +1,13 @@
 
+#include <atomic>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 
 #include "hub75.hpp"
 #include "hub75.pio.h"
 
+#include "hardware/clocks.h"
 #include "hardware/dma.h"
 
 // Wiring of the HUB75 matrix
@@ -16,34 +19,40 @@
 #define STROBE_PIN 12
 #define OEN_PIN 13
 
+// Second chain: own data and clock pins, LATCH, OEn and row select are shared with the first chain
+#define DATA_B_BASE_PIN 14
+#define CLK_B_PIN 20
+
+#define MAX_CHAINS 2 ///< Limited by free GPIOs - a third chain would need 7 more pins
+#define MAX_PIXELS 65536 ///< pixel_index holds 16-bit frame buffer indices
+
 #define EXIT_FAILURE 1
 
 #define BIT_DEPTH 10 ///< Number of bit planes
 
-// This gamma table is used to correct 8-bit (0-255) colours up to 10-bit, applying gamma correction without losing dynamic range.
-// The gamma table is from pimeroni's https://github.com/pimoroni/pimoroni-pico/tree/main/drivers/hub75.
-
-static const uint16_t gamma_lut[256] = {
-    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
-    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
-    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
-    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
-    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
-    80, 82, 84, 87, 89, 91, 94, 96, 98, 101, 103, 106, 109, 111, 114, 117,
-    119, 122, 125, 128, 130, 133, 136, 139, 142, 145, 148, 151, 155, 158, 161, 164,
-    167, 171, 174, 177, 181, 184, 188, 191, 195, 198, 202, 206, 209, 213, 217, 221,
-    225, 228, 232, 236, 240, 244, 248, 252, 257, 261, 265, 269, 274, 278, 282, 287,
-    291, 295, 300, 304, 309, 314, 318, 323, 328, 333, 337, 342, 347, 352, 357, 362,
-    367, 372, 377, 382, 387, 393, 398, 403, 408, 414, 419, 425, 430, 436, 441, 447,
-    452, 458, 464, 470, 475, 481, 487, 493, 499, 505, 511, 517, 523, 529, 535, 542,
-    548, 554, 561, 567, 573, 580, 586, 593, 599, 606, 613, 619, 626, 633, 640, 647,
-    653, 660, 667, 674, 681, 689, 696, 703, 710, 717, 725, 732, 739, 747, 754, 762,
-    769, 777, 784, 792, 800, 807, 815, 823, 831, 839, 847, 855, 863, 871, 879, 887,
-    895, 903, 912, 920, 928, 937, 945, 954, 962, 971, 979, 988, 997, 1005, 1014, 1023};
+#define DEFAULT_PIXEL_CLOCK_HZ 16000000 ///< Pixel clock until configure_hub75_timing() is called
+#define DEFAULT_REFRESH_HZ 400          ///< Refresh rate until configure_hub75_timing() is called
+
+// Colour look-up tables: the driver's default (Pimoroni's gamma curve) and the ones in use.
+// Published tables are never written, so swapping the pointer cannot tear a conversion.
+static ColourLut default_colour_lut;
+static std::atomic<const ColourLut *> colour_lut{&default_colour_lut};
+static const ColourLut *converted_lut = nullptr; ///< Table of the last update() / update_bgr() call
 
 // Frame buffer for the HUB75 matrix - memory area where pixel data is stored
 volatile uint32_t *frame_buffer; ///< Interwoven image data for examples;
 
+// Temporal dithering: a second frame buffer with the other rounding of every pixel. The driver
+// shows the two buffers in alternating refreshes.
+static volatile uint32_t *dither_buffer = nullptr;
+static volatile uint32_t *display_buffer; ///< Buffer shown by the current refresh
+static bool dithering = false;
+
+// Per checkerboard cell and colour channel: the channel's bits of the pixel word
+// of the first refresh in the low and of the second refresh in the high half. A pixel is the OR of
+// three look-ups and the dithered conversion needs little more than the plain one besides the second store.
+static uint64_t (*dither_lut)[3][256] = nullptr;
+
 // Utility function to claim a DMA channel and panic() if there are none left
 static int claim_dma_channel(const char *channel_name);
 
@@ -60,12 +69,42 @@ static volatile uint32_t oen_finished_data = 0;
 // Width and height of the HUB75 LED matrix
 static uint width;
 static uint height;
-static uint offset;
-
-// DMA channel numbers
-int pixel_chan;
-int dummy_pixel_chan;
-int oen_chan;
+static uint chains;      ///< Number of chains, each drives a band of height / chains rows
+static uint chain_size;  ///< Frame buffer entries per chain
+static uint scan;        ///< Number of row addresses
+static uint scan_pixels; ///< Frame buffer entries shifted out per row address and chain (both data lines)
+
+static const uint data_base_pins[MAX_CHAINS] = {DATA_BASE_PIN, DATA_B_BASE_PIN};
+static const uint clk_pins[MAX_CHAINS] = {CLK_PIN, CLK_B_PIN};
+
+// Frame buffer index of every display pixel, row-major. Built once from the scan rate and multiplex
+// pattern, so the converters scatter straight into the panel's pixel order.
+static uint16_t *pixel_index;
+
+// Fingerprints of the source rows converted last, one per display row.
+// Unchanged rows are not converted again. Two rows with the same 32-bit hash are taken as equal,
+// so a collision would leave a row stale - one row per frame is therefore converted regardless
+// of its hash, which bounds a stale row to height frames.
+static uint32_t *row_hash;
+static bool row_hash_valid = false;
+static uint refresh_row = 0; ///< Row converted in any case by the next update() / update_bgr()
+
+// Content which changes completely every frame (video, particles, plasma) gains nothing from the
+// hashes. After ROW_HASH_BYPASS_AFTER such frames the hashing is suspended, and only every
+// ROW_HASH_PROBE_INTERVAL-th frame is hashed again to notice when the content calms down.
+#define ROW_HASH_BYPASS_AFTER 4
+#define ROW_HASH_PROBE_INTERVAL 16
+static uint full_change_frames = 0; ///< Consecutive frames in which every row had changed
+static uint bypassed_frames = 0;    ///< Frames converted without hashing since the last probe
+
+// DMA channel numbers, one pixel, dummy pixel and OEn channel per chain
+int pixel_chan[MAX_CHAINS];
+int dummy_pixel_chan[MAX_CHAINS];
+int oen_chan[MAX_CHAINS];
+
+// The row state machine reads a record of one word per chain before it pulses LATCH (see hub75.pio)
+#define ROW_RECORD_WORDS 2
+static_assert(MAX_CHAINS <= ROW_RECORD_WORDS, "Every chain has to send a word of the row record");
 
 // DMA channel that becomes active when output enable (OEn) has finished.
 // This channel's interrupt handler restarts the pixel data DMA channel.
@@ -74,7 +113,7 @@ int oen_finished_chan;
 // PIO configuration structure for state machine numbers and corresponding program offsets
 typedef struct
 {
-    uint sm_data;
+    uint sm_data[MAX_CHAINS]; ///< All data state machines run the same program in data_pio
     PIO data_pio;
     uint data_prog_offs;
     uint sm_row;
@@ -84,11 +123,62 @@ typedef struct
 
 static PioConfig pio_config;
 
+// Timing derived from the system clock, see hub75_timing.hpp
+static Hub75TimingConfig timing_config;
+static Hub75Timing timing;
+static volatile uint32_t oen_base = 6; ///< OEn pulse of the least significant bit plane in system clock cycles
+
+// Global brightness: scale in bits 0-8 (256 = full), minimum pulse width in cycles above.
+// A single word, so any core can change it without locking.
+static std::atomic<uint32_t> brightness_setting{256 | 1 << 9};
+#define MAX_OEN_PULSE (1u << 27)          ///< The row program counts pulse width - 1 in 27 bits
+#define MAX_MIN_PULSE ((1u << 23) - 1)    ///< What fits above the scale in brightness_setting
+
 // Variables for row addressing and bit plane selection
 static volatile uint32_t row_address = 0;
 static volatile uint32_t bit_plane = 0;
 static volatile uint32_t row_in_bit_plane = 0;
 
+/**
+ * @brief Computes the OEn record of the current row and bit plane.
+ *
+ * The pulse width of the bit plane is scaled by the global brightness. The PIO program
+ * lights the LEDs for the recorded value + 1 cycles, at most MAX_OEN_PULSE.
+ */
+static inline void set_row_in_bit_plane()
+{
+    uint32_t setting = brightness_setting.load(std::memory_order_relaxed);
+    uint64_t pulse = (((static_cast<uint64_t>(oen_base) << bit_plane) + 1) * (setting & 0x1ff) + 128) >> 8;
+    uint32_t floor = setting >> 9;
+    if (pulse < floor)
+    {
+        pulse = floor;
+    }
+    else if (pulse > MAX_OEN_PULSE)
+    {
+        pulse = MAX_OEN_PULSE;
+    }
+    row_in_bit_plane = row_address | (static_cast<uint32_t>(pulse - 1) << 5);
+}
+
+/**
+ * @brief Starts the pixel data transfers of the current row on all chains at once.
+ *
+ * The dummy pixel channel of every chain triggers that chain's OEn channel, which sends its
+ * words of the row record. The row state machine pulses LATCH only after the whole record has
+ * arrived, i.e. after the last chain has shifted the row.
+ */
+static inline void start_pixel_transfers()
+{
+    uint32_t mask = 0;
+    for (uint c = 0; c < chains; c++)
+    {
+        dma_channel_set_read_addr(pixel_chan[c], &display_buffer[c * chain_size + row_address * scan_pixels], false);
+        mask |= 1u << pixel_chan[c];
+    }
+    dma_start_channel_mask(mask);
+}
+
 /**
  * @brief Interrupt handler for the Output Enable (OEn) finished event.
  *
@@ -103,25 +193,28 @@ static void oen_finished_handler()
     dma_hw->ints0 = 1u << oen_finished_chan;
 
     // Advance row addressing; reset and increment bit-plane if needed
-    if (++row_address >= (height >> 1))
+    if (++row_address >= scan)
     {
         row_address = 0;
 
         if (++bit_plane >= BIT_DEPTH)
         {
             bit_plane = 0;
+            if (dithering)
+            {
+                display_buffer = display_buffer == frame_buffer ? dither_buffer : frame_buffer;
+            }
         }
         // Patch the PIO program to make it shift to the next bit plane
-        hub75_data_rgb888_set_shift(pio_config.data_pio, pio_config.sm_data, pio_config.data_prog_offs, bit_plane);
+        hub75_data_rgb888_set_shift(pio_config.data_pio, pio_config.sm_data[0], pio_config.data_prog_offs, bit_plane);
     }
 
-    // Compute address and length of OEn pulse for next row
-    row_in_bit_plane = row_address | ((6u << bit_plane) << 5);
-    dma_channel_set_read_addr(oen_chan, &row_in_bit_plane, false);
+    // Compute address and length of OEn pulse for next row, the OEn channels read it without incrementing
+    set_row_in_bit_plane();
 
     // Restart DMA channels for the next row's data transfer
     dma_channel_set_write_addr(oen_finished_chan, &oen_finished_data, true);
-    dma_channel_set_read_addr(pixel_chan, &frame_buffer[row_address * (width << 1)], true);
+    start_pixel_transfers();
 }
 
 /**
@@ -134,7 +227,7 @@ static void oen_finished_handler()
 void start_hub75_driver()
 {
     dma_channel_set_write_addr(oen_finished_chan, &oen_finished_data, true);
-    dma_channel_set_read_addr(pixel_chan, &frame_buffer[row_address * (width << 1)], true);
+    start_pixel_transfers();
 }
 
 /**
@@ -146,16 +239,50 @@ void start_hub75_driver()
  *
  * @param w Width of the HUB75 display in pixels.
  * @param h Height of the HUB75 display in pixels.
+ * @param s Scan rate as number of row addresses, 0 for the standard 1/(rows per chain / 2) scan.
+ * @param multiplex Pixel order of panels with a lower scan rate than 1/(rows per chain / 2).
+ * @param n Number of chains shifted in parallel. Chain c drives rows c * h / n ... (c + 1) * h / n - 1.
+ * @param panel_width Width of one panel if a chain has several side by side, 0 if each chain is one panel.
+ *        The multiplex pattern repeats on every panel.
  */
-void create_hub75_driver(uint w, uint h)
+void create_hub75_driver(uint w, uint h, uint s, Multiplex multiplex, uint n, uint panel_width)
 {
     width = w;
     height = h;
-    offset = width * (height >> 1);
+    chains = n;
+    uint chain_height = height / chains;
+    chain_size = width * chain_height;
+    scan = s ? s : chain_height >> 1;
+    scan_pixels = chain_size / scan;
 
     frame_buffer = new uint32_t[width * height](); // Allocate memory for frame buffer and zero-initialize
+    default_colour_lut = builtin_colour_lut; // A RAM copy keeps the converters' look-ups off the flash cache
+    display_buffer = frame_buffer;
+    pixel_index = new uint16_t[width * height];
+    // All chains share the index table, so every entry (c * chain_size + index) has to fit 16 bits
+    if (chains == 0 || chains > MAX_CHAINS || height % chains != 0 || width * height > MAX_PIXELS ||
+        !build_pixel_index(pixel_index, width, chain_height, scan, multiplex, panel_width))
+    {
+        fprintf(stderr, "Unsupported panel: %ux%u, %u chains, 1/%u scan, multiplex %d, panels %u wide\n", width, height, chains, scan, multiplex,
+                panel_width);
+        exit(EXIT_FAILURE);
+    }
+    // Every chain has its own region in the frame buffer, laid out like a single chain
+    for (uint c = 1; c < chains; c++)
+    {
+        for (uint i = 0; i < chain_size; i++)
+        {
+            pixel_index[c * chain_size + i] = c * chain_size + pixel_index[i];
+        }
+    }
+    row_hash = new uint32_t[height]();
+    row_hash_valid = false;
+    refresh_row = 0;
+    full_change_frames = 0;
+    bypassed_frames = 0;
 
     configure_pio();
+    configure_hub75_timing(DEFAULT_PIXEL_CLOCK_HZ, DEFAULT_REFRESH_HZ);
     configure_dma_channels();
     setup_dma_transfers();
     setup_dma_irq();
@@ -170,30 +297,177 @@ void create_hub75_driver(uint w, uint h)
  */
 static void configure_pio()
 {
-    if (!pio_claim_free_sm_and_add_program(&hub75_data_rgb888_program, &pio_config.data_pio, &pio_config.sm_data, &pio_config.data_prog_offs))
+    if (!pio_claim_free_sm_and_add_program(&hub75_data_rgb888_program, &pio_config.data_pio, &pio_config.sm_data[0], &pio_config.data_prog_offs))
     {
         fprintf(stderr, "Failed to claim PIO state machine for hub75_data_rgb888_program\n");
     }
+    // Further chains share the program - and with it the bit plane patching - in the same PIO block
+    for (uint c = 1; c < chains; c++)
+    {
+        int sm = pio_claim_unused_sm(pio_config.data_pio, false);
+        if (sm < 0)
+        {
+            fprintf(stderr, "Failed to claim PIO state machine for chain %u\n", c);
+            exit(EXIT_FAILURE);
+        }
+        pio_config.sm_data[c] = sm;
+    }
     if (!pio_claim_free_sm_and_add_program(&hub75_row_program, &pio_config.row_pio, &pio_config.sm_row, &pio_config.row_prog_offs))
     {
         fprintf(stderr, "Failed to claim PIO state machine for hub75_row_program\n");
     }
-    hub75_data_rgb888_program_init(pio_config.data_pio, pio_config.sm_data, pio_config.data_prog_offs, DATA_BASE_PIN, CLK_PIN);
+    for (uint c = 0; c < chains; c++)
+    {
+        hub75_data_rgb888_program_init(pio_config.data_pio, pio_config.sm_data[c], pio_config.data_prog_offs, data_base_pins[c], clk_pins[c]);
+    }
     hub75_row_program_init(pio_config.row_pio, pio_config.sm_row, pio_config.row_prog_offs, ROWSEL_BASE_PIN, ROWSEL_N_PINS, STROBE_PIN);
 }
 
+/**
+ * @brief Derives the data state machines' clock divider and the OEn pulse widths from the system clock.
+ *
+ * Call again after the system clock has been changed to keep pixel clock and refresh rate.
+ * The new OEn pulse widths take effect with the next row.
+ *
+ * @param pixel_clock_hz Target CLK frequency - the highest one the panel's shift registers accept.
+ * @param refresh_hz Target refresh rate. A lower target leaves more time for the OEn pulses - a brighter panel.
+ * @return The computed timing, including whether the refresh target can be met.
+ */
+Hub75Timing configure_hub75_timing(uint32_t pixel_clock_hz, uint32_t refresh_hz)
+{
+    timing_config.sys_hz = clock_get_hz(clk_sys);
+    timing_config.pixel_clock_hz = pixel_clock_hz;
+    timing_config.refresh_hz = refresh_hz;
+    timing_config.columns = scan_pixels >> 1;
+    timing_config.scan = scan;
+    timing_config.bit_depth = BIT_DEPTH;
+    timing = hub75_compute_timing(timing_config);
+
+    uint32_t mask = 0;
+    for (uint c = 0; c < chains; c++)
+    {
+        pio_sm_set_clkdiv_int_frac(pio_config.data_pio, pio_config.sm_data[c], timing.clkdiv_int, timing.clkdiv_frac);
+        mask |= 1u << pio_config.sm_data[c];
+    }
+    pio_clkdiv_restart_sm_mask(pio_config.data_pio, mask); // Keep the chains' clock dividers in phase
+    oen_base = timing.oen_base;
+    return timing;
+}
+
+/**
+ * @brief Sets the global brightness by scaling the OEn pulse widths.
+ *
+ * The frame buffer is left untouched, so there is no re-conversion and no loss of colour depth.
+ * The new brightness takes effect with the next row. Safe to call from either core and from
+ * interrupt handlers.
+ *
+ * @param brightness 255 is full brightness, luminance scales linearly with the value.
+ * @param min_pulse Shortest OEn pulse in system clock cycles. At low brightness the pulses of the
+ *                  least significant bit planes get shorter than the LEDs need to light up reliably;
+ *                  a floor of a few cycles keeps dark colours visible at the cost of linearity.
+ *                  The hardware minimum is 1 cycle, so brightness 0 is very dim but not off.
+ *                  Values above MAX_MIN_PULSE are limited to it.
+ */
+void hub75_set_brightness(uint8_t brightness, uint32_t min_pulse)
+{
+    uint32_t scale = brightness + (brightness >> 7); // 255 -> 256
+    if (min_pulse < 1)
+    {
+        min_pulse = 1;
+    }
+    else if (min_pulse > MAX_MIN_PULSE)
+    {
+        min_pulse = MAX_MIN_PULSE;
+    }
+    brightness_setting.store(scale | min_pulse << 9, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Enables temporal dithering for a colour depth of 12 bits on 10 bit planes.
+ *
+ * The source is expanded to 12 bits through the calibrated curve. The two fractional bits are spread
+ * over a 2x2 space-time pattern: a checkerboard in space and two alternating refreshes, each
+ * showing its own frame buffer. Every pixel is rounded up in as many of the four cells as its
+ * fraction says, so the average over neighbouring pixels and refreshes is exact. The pattern
+ * repeats at half the refresh rate, well above what the eye can follow.
+ *
+ * Costs a second frame buffer, and the converters write both. Call before start_hub75_driver().
+ * Dark colours follow the gamma curve more closely than without dithering and appear darker.
+ *
+ * @param calibration Colour calibration, the tables of set_colour_lut() do not apply to dithering.
+ */
+void enable_hub75_dithering(const ColourCalibration &calibration)
+{
+    // Ordered thresholds of the 2x2 pattern, indexed by checkerboard cell and refresh
+    static const uint8_t threshold[2][2] = {{0, 2}, {3, 1}};
+
+    if (!dither_buffer)
+    {
+        dither_buffer = new uint32_t[width * height];
+        dither_lut = new uint64_t[2][3][256];
+    }
+
+    static const uint shift[3] = {COLOUR_LUT_SHIFT_R, COLOUR_LUT_SHIFT_G, COLOUR_LUT_SHIFT_B};
+
+    for (uint channel = COLOUR_RED; channel <= COLOUR_BLUE; channel++)
+    {
+        for (uint i = 0; i < 256; i++)
+        {
+            uint32_t value = colour_curve(calibration, static_cast<ColourChannel>(channel), i, 12);
+            for (uint cell = 0; cell < 2; cell++)
+            {
+                uint64_t first = (value >> 2) + ((value & 3) > threshold[cell][0]);
+                uint64_t second = (value >> 2) + ((value & 3) > threshold[cell][1]);
+                uint64_t both = (first > 1023 ? 1023 : first) | (second > 1023 ? 1023 : second) << 32;
+                dither_lut[cell][channel][i] = both << shift[channel];
+            }
+        }
+    }
+    memcpy(const_cast<uint32_t *>(dither_buffer), const_cast<uint32_t *>(frame_buffer), width * height * sizeof(uint32_t));
+    dithering = true;
+    row_hash_valid = false; // Convert every row into both buffers
+}
+
+/**
+ * @brief Replaces the colour look-up tables of the converters.
+ *
+ * Safe to call from either core: the converters pick up the pointer once per frame, so a frame
+ * is never converted with a mix of two tables. The next update() or update_bgr() converts every row.
+ * The tables must stay valid and unchanged while they are in use - build a new one and swap it in
+ * instead of writing to the published one.
+ *
+ * @param lut Tables from build_colour_lut(), nullptr restores the default.
+ */
+void set_colour_lut(const ColourLut *lut)
+{
+    colour_lut.store(lut ? lut : &default_colour_lut, std::memory_order_release);
+}
+
+/**
+ * @brief Prints the current timing and what is achievable with the panel geometry.
+ */
+void print_hub75_timing()
+{
+    hub75_print_timing(timing_config, timing);
+    uint32_t setting = brightness_setting.load(std::memory_order_relaxed);
+    printf("  brightness %lu/256, shortest OEn pulse %lu cycles\n", (unsigned long)(setting & 0x1ff), (unsigned long)(setting >> 9));
+}
+
 /**
  * @brief Configures and claims DMA channels for HUB75 control.
  *
- * This function assigns DMA channels to handle pixel data transfer,
- * dummy pixel data, output enable signal, and output enable completion.
+ * This function assigns DMA channels to handle pixel data transfer and
+ * dummy pixel data of every chain, output enable signal, and output enable completion.
  * If a DMA channel cannot be claimed, the function prints an error message and exits.
  */
 static void configure_dma_channels()
 {
-    pixel_chan = claim_dma_channel("pixel channel");
-    dummy_pixel_chan = claim_dma_channel("dummy pixel channel");
-    oen_chan = claim_dma_channel("output enable channel");
+    for (uint c = 0; c < chains; c++)
+    {
+        pixel_chan[c] = claim_dma_channel("pixel channel");
+        dummy_pixel_chan[c] = claim_dma_channel("dummy pixel channel");
+        oen_chan[c] = claim_dma_channel("output enable channel");
+    }
     oen_finished_chan = claim_dma_channel("output enable has finished channel");
 }
 
@@ -247,14 +521,18 @@ static void dma_input_channel_setup(uint channel,
  */
 static void setup_dma_transfers()
 {
-    dma_input_channel_setup(pixel_chan, width << 1, DMA_SIZE_32, true, dummy_pixel_chan, pio_config.data_pio, pio_config.sm_data);
-    dma_input_channel_setup(dummy_pixel_chan, 8, DMA_SIZE_32, false, oen_chan, pio_config.data_pio, pio_config.sm_data);
-    dma_input_channel_setup(oen_chan, 1, DMA_SIZE_32, true, oen_chan, pio_config.row_pio, pio_config.sm_row);
-
-    dma_channel_set_read_addr(dummy_pixel_chan, dummy_pixel_data, false);
-
-    row_in_bit_plane = row_address | ((6u << bit_plane) << 5);
-    dma_channel_set_read_addr(oen_chan, &row_in_bit_plane, false);
+    set_row_in_bit_plane();
+    for (uint c = 0; c < chains; c++)
+    {
+        // Each chain sends one word of the row record when it has shifted the row, the first chain
+        // also sends the words of missing chains. Chaining a channel to itself disables chaining.
+        uint record_words = c == 0 ? ROW_RECORD_WORDS - chains + 1 : 1;
+        dma_input_channel_setup(pixel_chan[c], scan_pixels, DMA_SIZE_32, true, dummy_pixel_chan[c], pio_config.data_pio, pio_config.sm_data[c]);
+        dma_input_channel_setup(dummy_pixel_chan[c], 8, DMA_SIZE_32, false, oen_chan[c], pio_config.data_pio, pio_config.sm_data[c]);
+        dma_channel_set_read_addr(dummy_pixel_chan[c], dummy_pixel_data, false);
+        dma_input_channel_setup(oen_chan[c], record_words, DMA_SIZE_32, false, oen_chan[c], pio_config.row_pio, pio_config.sm_row);
+        dma_channel_set_read_addr(oen_chan[c], &row_in_bit_plane, false);
+    }
 
     dma_channel_config oen_finished_config = dma_channel_get_default_config(oen_finished_chan);
     channel_config_set_transfer_data_size(&oen_finished_config, DMA_SIZE_32);
@@ -299,47 +577,286 @@ static inline int claim_dma_channel(const char *channel_name)
 }
 
 /**
- * @brief Updates the frame buffer with pixel data from the source array.
+ * @brief Computes a fingerprint of a row of source pixels.
  *
- * This function takes a source array of pixel data and updates the frame buffer
- * with interleaved pixel values. The pixel values are gamma-corrected to 10 bits using a lookup table.
+ * FNV-1a over 32-bit words - a multiply and an xor per four bytes, which is
+ * a fraction of the cost of converting the same pixels.
  *
- * @param src Pointer to the source pixel data array (RGB888 format).
+ * @param src Pointer to the source row.
+ * @param len Length of a row in bytes.
+ * @return 32-bit hash of the row.
  */
-void update(uint8_t *src)
+static inline uint32_t hash_row(const uint8_t *src, uint len)
 {
-    uint rgb_offset = offset * 3;
-    uint k = 0;
+    uint32_t h = 2166136261u;
+    uint i = 0;
+    for (; i + 4 <= len; i += 4)
+    {
+        uint32_t a;
+        memcpy(&a, src + i, sizeof(a)); // memcpy keeps unaligned source buffers safe
+        h = (h ^ a) * 16777619u;
+    }
+    for (; i < len; i++)
+    {
+        h = (h ^ src[i]) * 16777619u;
+    }
+    return h;
+}
+
+/**
+ * @brief Checks whether a row differs from the one converted last and records its fingerprint.
+ *
+ * @param row Display row.
+ * @param src Pointer to the source row.
+ * @return true if the row has to be converted.
+ */
+static inline bool row_changed(uint row, const uint8_t *src)
+{
+    uint32_t h = hash_row(src, width * 3);
+    if (row_hash_valid && row_hash[row] == h)
+    {
+        return false;
+    }
+    row_hash[row] = h;
+    return true;
+}
+
+/**
+ * @brief Stores a pre-converted pixel in the frame buffer and, with dithering, in the second buffer.
+ */
+static inline void store_pixel(uint i, uint32_t value)
+{
+    frame_buffer[i] = value;
+    if (dithering)
+    {
+        dither_buffer[i] = value;
+    }
+}
+
+/**
+ * @brief Converts an 8-bit pixel and stores it in the frame buffer(s).
+ *
+ * @param i Frame buffer index.
+ * @param cell Checkerboard cell of the display position (0 or 1).
+ * @param r Red channel.
+ * @param g Green channel.
+ * @param b Blue channel.
+ */
+static inline void convert_pixel(uint i, uint cell, uint8_t r, uint8_t g, uint8_t b)
+{
+    if (dithering)
+    {
+        uint64_t v = dither_lut[cell][COLOUR_RED][r] | dither_lut[cell][COLOUR_GREEN][g] | dither_lut[cell][COLOUR_BLUE][b];
+        frame_buffer[i] = static_cast<uint32_t>(v);
+        dither_buffer[i] = static_cast<uint32_t>(v >> 32);
+    }
+    else
+    {
+        const ColourLut *lut = colour_lut.load(std::memory_order_acquire);
+        frame_buffer[i] = lut->r[r] | lut->g[g] | lut->b[b];
+    }
+}
+
+/**
+ * @brief Converts one row of 8-bit pixels with dithering into both frame buffers.
+ *
+ * @param src Source row.
+ * @param index Frame buffer indices of the row's pixels.
+ * @param count Number of pixels.
+ * @param cell Checkerboard cell of the first pixel.
+ * @param r Byte offset of the red channel within a pixel (0 for RGB, 2 for BGR).
+ */
+static inline void convert_row_dithered(const uint8_t *src, const uint16_t *index, uint count, uint cell, uint r)
+{
+    const uint64_t(*even)[256] = dither_lut[cell];
+    const uint64_t(*odd)[256] = dither_lut[cell ^ 1];
+    uint b = 2 - r;
+    for (uint n = 0; n < count; n += 2, src += 6, index += 2) // Panel widths are even
+    {
+        uint64_t v = even[COLOUR_RED][src[r]] | even[COLOUR_GREEN][src[1]] | even[COLOUR_BLUE][src[b]];
+        frame_buffer[index[0]] = static_cast<uint32_t>(v);
+        dither_buffer[index[0]] = static_cast<uint32_t>(v >> 32);
+        v = odd[COLOUR_RED][src[3 + r]] | odd[COLOUR_GREEN][src[4]] | odd[COLOUR_BLUE][src[3 + b]];
+        frame_buffer[index[1]] = static_cast<uint32_t>(v);
+        dither_buffer[index[1]] = static_cast<uint32_t>(v >> 32);
+    }
+}
+
+/**
+ * @brief Forces the next update() or update_bgr() call to convert every row.
+ *
+ * Must be called whenever the frame buffer has been written by other means than the update functions.
+ * The content history is dropped as well, so a hashing bypass from fully changing content ends.
+ */
+void invalidate_frame()
+{
+    row_hash_valid = false;
+    full_change_frames = 0;
+}
+
+/**
+ * @brief Copies a pre-converted frame into the frame buffer.
+ *
+ * The source must already be in the frame buffer's pixel format (gamma corrected RGB101010),
+ * e.g. a splash screen generated offline and kept in flash. Only the panel's pixel order
+ * is applied, no conversion takes place.
+ *
+ * @param src Pointer to width * height pre-converted pixels in display order.
+ */
+void load_frame(const uint32_t *src)
+{
+    for (uint i = 0; i < width * height; i++)
+    {
+        store_pixel(pixel_index[i], src[i]);
+    }
+    row_hash_valid = false;
+}
+
+/**
+ * @brief Converts a run of RGB888 pixels of one display row straight into the frame buffer.
+ *
+ * Used by sources which deliver the image row by row (e.g. a USB stream), so no intermediate
+ * full-frame buffer is needed.
+ *
+ * @param x First column.
+ * @param y Row.
+ * @param src Pixel data in RGB888 byte order (R, G, B).
+ * @param count Number of pixels, clipped to the panel width.
+ */
+void update_row(uint x, uint y, const uint8_t *src, uint count)
+{
+    if (y >= height || x >= width)
+    {
+        return;
+    }
+    if (count > width - x)
+    {
+        count = width - x;
+    }
+    const uint16_t *index = &pixel_index[y * width + x];
+    for (uint i = 0; i < count; i++, src += 3)
+    {
+        convert_pixel(index[i], (x + i + y) & 1, src[0], src[1], src[2]);
+    }
+    row_hash_valid = false;
+}
+
+/**
+ * @brief Copies a run of pre-converted pixels of one display row into the frame buffer.
+ *
+ * @param x First column.
+ * @param y Row.
+ * @param src Pixels in the frame buffer format (gamma corrected RGB101010), not interleaved.
+ * @param count Number of pixels, clipped to the panel width.
+ */
+void load_row(uint x, uint y, const uint32_t *src, uint count)
+{
+    if (y >= height || x >= width)
+    {
+        return;
+    }
+    if (count > width - x)
+    {
+        count = width - x;
+    }
+    const uint16_t *index = &pixel_index[y * width + x];
+    for (uint i = 0; i < count; i++)
+    {
+        store_pixel(index[i], src[i]);
+    }
+    row_hash_valid = false;
+}
+
+/**
+ * @brief Converts a frame into the frame buffer, skipping rows which are unchanged since the previous call.
+ *
+ * @tparam R Byte offset of the red channel within a pixel (0 for RGB, 2 for BGR).
+ * @param src Pointer to the source pixel data array.
+ * @return true if any pixel of the frame buffer has changed.
+ */
+template <uint R>
+static inline bool convert_frame(const uint8_t *src)
+{
+    const uint B = 2 - R;
+    uint row_bytes = width * 3;
+    const ColourLut *lut = colour_lut.load(std::memory_order_acquire);
+    bool hashing = full_change_frames < ROW_HASH_BYPASS_AFTER || ++bypassed_frames >= ROW_HASH_PROBE_INTERVAL;
+    bool hashes_valid = row_hash_valid && lut == converted_lut;
+    uint changed_rows = 0;
+
     // Ramp up color resolution from 8 to 10 bits via gamma table look-up
-    // Interweave pixels as required by Hub75 LED panel matrix
-    for (int j = 0; j < width * height; j += 2)
+    // Scatter the pixels into the order the panel shifts them in (interleave and multiplex pattern)
+    for (uint row = 0; row < height; row++)
     {
-        frame_buffer[j] = gamma_lut[src[k + 2]] << 20 | gamma_lut[src[k + 1]] << 10 | gamma_lut[src[k]];
-        frame_buffer[j + 1] = gamma_lut[src[rgb_offset + k + 2]] << 20 | gamma_lut[src[rgb_offset + k + 1]] << 10 | gamma_lut[src[rgb_offset + k]];
-        k += 3;
+        const uint8_t *src_row = src + row * row_bytes;
+        bool changed_row = !hashing || row_changed(row, src_row) || lut != converted_lut;
+        if (!changed_row && row != refresh_row)
+        {
+            continue;
+        }
+        changed_rows += changed_row;
+
+        const uint16_t *index = &pixel_index[row * width];
+        if (dithering)
+        {
+            convert_row_dithered(src_row, index, width, row & 1, R);
+            continue;
+        }
+        for (uint k = 0; k < row_bytes; k += 3)
+        {
+            frame_buffer[*index++] = lut->r[src_row[k + R]] | lut->g[src_row[k + 1]] | lut->b[src_row[k + B]];
+        }
     }
+    refresh_row = refresh_row + 1 < height ? refresh_row + 1 : 0;
+    converted_lut = lut;
+
+    // Rows converted without hashing leave the hashes behind, the next hashed frame converts every row
+    row_hash_valid = hashing;
+    if (!hashing)
+    {
+        return true;
+    }
+    if (hashes_valid)
+    {
+        full_change_frames = changed_rows == height ? full_change_frames + 1 : 0;
+    }
+    else if (full_change_frames >= ROW_HASH_BYPASS_AFTER)
+    {
+        // Probe: the next frame compares with valid hashes and decides whether the bypass goes on
+        full_change_frames = ROW_HASH_BYPASS_AFTER - 1;
+        bypassed_frames = 0;
+    }
+    return changed_rows != 0;
+}
+
+/**
+ * @brief Updates the frame buffer with pixel data from the source array.
+ *
+ * This function takes a source array of pixel data and updates the frame buffer
+ * in the panel's pixel order. The pixel values are gamma-corrected to 10 bits using the colour look-up tables.
+ * Rows which are unchanged since the previous call are skipped, unless the tables have been replaced.
+ *
+ * @param src Pointer to the source pixel data array (RGB888 format).
+ * @return true if any pixel of the frame buffer has changed.
+ */
+bool update(uint8_t *src)
+{
+    return convert_frame<0>(src);
 }
 
 /**
  * @brief Updates the frame buffer with pixel data from the source array.
  *
  * This function takes a source array of pixel data and updates the frame buffer
- * with interleaved pixel values. The pixel values are gamma-corrected to 10 bits using a lookup table.
+ * in the panel's pixel order. The pixel values are gamma-corrected to 10 bits using the colour look-up tables.
+ * Rows which are unchanged since the previous call are skipped, unless the tables have been replaced.
  *
  * @param src Pointer to the source pixel data array (BGR888 format).
+ * @return true if any pixel of the frame buffer has changed.
  */
-void update_bgr(uint8_t *src)
+bool update_bgr(uint8_t *src)
 {
-    uint rgb_offset = offset * 3;
-    uint k = 0;
-    // Ramp up color resolution from 8 to 10 bits via gamma table look-up
-    // Interweave pixels as required by Hub75 LED panel matrix
-    for (int j = 0; j < width * height; j += 2)
-    {
-        frame_buffer[j] = gamma_lut[src[k]] << 20 | gamma_lut[src[k + 1]] << 10 | gamma_lut[src[k + 2]];
-        frame_buffer[j + 1] = gamma_lut[src[rgb_offset + k]] << 20 | gamma_lut[src[rgb_offset + k + 1]] << 10 | gamma_lut[src[rgb_offset + k + 2]];
-        k += 3;
-    }
+    return convert_frame<2>(src);
 }
 
 /**
@@ -354,6 +871,8 @@ void update_bgr(uint8_t *src)
  */
 void update_area_bgr(const uint8_t *src, const uint32_t x1, const uint32_t y1, const uint32_t x2, const uint32_t y2)
 {
+    row_hash_valid = false;
+
     for (int y = y1; y <= y2; ++y)
     {
         for (int x = x1; x <= x2; x += 2)
@@ -362,22 +881,16 @@ void update_area_bgr(const uint8_t *src, const uint32_t x1, const uint32_t y1, c
             int pixel_idx = (y - y1) * (x2 - x1 + 1) + (x - x1); // index in `src`
             int k = pixel_idx * 3;
 
-            // Calculate the framebuffer offset (adjust for interleaving if needed)
+            // Display order index, the frame buffer index comes from the pixel order table
             int j = y * width + x;
 
             // First pixel (x)
-            frame_buffer[j] =
-                gamma_lut[src[k]] << 20 |     // B -> R channel
-                gamma_lut[src[k + 1]] << 10 | // G
-                gamma_lut[src[k + 2]];        // R -> B channel
+            convert_pixel(pixel_index[j], (x + y) & 1, src[k + 2], src[k + 1], src[k]);
 
             // Second pixel (x+1), make sure we don’t overflow
             if (x + 1 <= x2)
             {
-                frame_buffer[j + 1] =
-                    gamma_lut[src[k + 3]] << 20 |
-                    gamma_lut[src[k + 4]] << 10 |
-                    gamma_lut[src[k + 5]];
+                convert_pixel(pixel_index[j + 1], (x + 1 + y) & 1, src[k + 5], src[k + 4], src[k + 3]);
             }
         }
     }
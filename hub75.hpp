@@ -1,6 +1,21 @@
 #include "pico.h"
 
-void create_hub75_driver(uint width, uint height);
+#include "multiplex_map.hpp"
+#include "hub75_timing.hpp"
+#include "colour_lut.hpp"
+
+void create_hub75_driver(uint width, uint height, uint scan = 0, Multiplex multiplex = MULTIPLEX_LINEAR, uint chains = 1, uint panel_width = 0);
 void start_hub75_driver();
-void update_bgr(uint8_t *src);
-void update(uint8_t *src);
\ No newline at end of file
+Hub75Timing configure_hub75_timing(uint32_t pixel_clock_hz, uint32_t refresh_hz);
+void print_hub75_timing();
+void hub75_set_brightness(uint8_t brightness, uint32_t min_pulse = 1);
+void enable_hub75_dithering(const ColourCalibration &calibration = default_colour_calibration);
+void set_colour_lut(const ColourLut *lut);
+bool update_bgr(uint8_t *src);
+bool update(uint8_t *src);
+void invalidate_frame();
+void load_frame(const uint32_t *src);
+void update_row(uint x, uint y, const uint8_t *src, uint count);
+void load_row(uint x, uint y, const uint32_t *src, uint count);
+
+extern volatile uint32_t *frame_buffer; ///< Converted image data, width * height words, written by update_bgr() and friends
\ No newline at end of file
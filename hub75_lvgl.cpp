@@ -3,17 +3,41 @@
 #include "pico/printf.h"
 #include "pico/multicore.h"
 #include "hardware/clocks.h"
+#include "hardware/sync.h"
 
 #include "hub75.hpp"
+#include "boot_trace.hpp"
+#include "heap_stats.hpp"
+#include "event_queue.hpp"
+#include "frame_pipeline.hpp"
 #include "lvgl/src/lv_init.h"
 #include "lvgl/src/core/lv_refr.h"
 #include "lvgl/src/display/lv_display.h"
 #include "lvgl/src/tick/lv_tick.h"
+#include "lvgl/src/stdlib/lv_mem.h"
+#include "lvgl/src/draw/sw/lv_draw_sw.h"
 
 #include "bouncing_balls.hpp"
 #include "fire_effect.hpp"
 #include "image_animation.hpp"
 #include "colour_check.hpp"
+#include "clip_animation.hpp"
+#include "gif_animation.hpp"
+#include "sprite_swarm.hpp"
+#include "particle_effect.hpp"
+#include "procedural_scene.hpp"
+#include "scene_manager.hpp"
+#include "scene_random.hpp"
+#include "usb_stream.hpp"
+#include "network_receiver.hpp"
+
+#ifdef HUB75_HOST
+#include "host_run.hpp"
+#endif
+
+#include "splash_64x64.h"
+#include "clip_64x64.h"
+#include "gif_64x64.h"
 
 //--------------------------------------------------------------------------------
 // Constants and Globals
@@ -21,10 +45,63 @@
 
 #define RGB_MATRIX_WIDTH 64                               ///< Display width in pixels
 #define RGB_MATRIX_HEIGHT 64                              ///< Display height in pixels
+#define RGB_MATRIX_CHAINS 1                               ///< Chains shifted in parallel, 2 splits the display into an upper and a lower chain
+#define RGB_MATRIX_SCAN (RGB_MATRIX_HEIGHT / RGB_MATRIX_CHAINS / 2) ///< Row addresses: 32 for 1/32 scan, 16 for 1/16 scan, ...
+#define RGB_MATRIX_MULTIPLEX MULTIPLEX_LINEAR             ///< Pixel order of panels with scan < height / 2, see multiplex_map.hpp
+#define RGB_MATRIX_PANEL_WIDTH 0                          ///< Width of one panel if several are chained side by side, 0 for one panel per chain
+#define RGB_MATRIX_PIXEL_CLOCK_HZ 16000000                ///< Highest CLK frequency the panel accepts
+#define RGB_MATRIX_REFRESH_HZ 400                         ///< Target refresh rate, lower values give a brighter panel
+#define RGB_MATRIX_BRIGHTNESS 255                         ///< Global brightness, scales the OEn pulses, can be changed at run time
+#define BRIGHTNESS_BUTTON_PIN -1                          ///< GPIO of a push button to ground which steps through the brightness levels, -1: none
+#define RGB_MATRIX_DITHERING 0                            ///< 1: temporal dithering to 12 bits per channel, costs a second frame buffer
+#define RGB_MATRIX_CALIBRATION 0                          ///< 1: use panel_calibration instead of the built-in gamma curve
+
+#define SYS_CLOCK_KHZ 250000 ///< The driver derives its timing from the actual system clock
 #define OFFSET RGB_MATRIX_WIDTH *(RGB_MATRIX_HEIGHT >> 1) ///< Mid-point index for symmetrical buffers
 
 #define BYTES_PER_PIXEL (LV_COLOR_FORMAT_GET_SIZE(LV_COLOR_FORMAT_RGB888)) ///< RGB888 color depth
 
+// Pipeline mode: flush_cb() hands the rendered buffer to core 1 via the multicore FIFO. Core 1 converts it
+// while core 0 renders the next frame into a second LVGL buffer. Set to 0 to convert on core 0 inside flush_cb().
+#ifndef PIPELINE_MODE
+#define PIPELINE_MODE 1
+#endif
+
+#define STATS_DUMP_INTERVAL_MS 60000 ///< Period of the statistics print-out
+
+// Heap instrumentation for measurement builds: cmake -DHEAP_STATS=ON sets HEAP_STATS and LVGL's LV_USE_MEM_HOOK
+#ifndef HEAP_STATS
+#define HEAP_STATS 0                   ///< Count LVGL heap allocations per call site and per frame
+#endif
+#define HEAP_STATS_DUMP_INTERVAL_MS 0  ///< Period of a separate heap report, 0: the heap report is only part of the statistics print-out
+
+#define USB_STREAM 1 ///< Accept frames streamed by a host over USB CDC (see tools/hub75_stream.py)
+
+#define FRAME_PROFILE 1 ///< Time scene updates, LVGL rendering and conversion, printed per demo with its frame rate
+
+// Network receiver: accept DDP and E1.31 (sACN) frames over WiFi. Only started if WIFI_SSID is set at configure time,
+// e.g. cmake -DWIFI_SSID=myssid -DWIFI_PASSWORD=secret. The host build (host/CMakeLists.txt) sets it to 0.
+#ifndef NETWORK_RECEIVER
+#define NETWORK_RECEIVER 1
+#endif
+#define E131_FIRST_UNIVERSE 1 ///< Universe carrying the first 170 pixels, the following universes continue row by row
+#ifndef WIFI_SSID
+#define WIFI_SSID ""
+#endif
+#ifndef WIFI_PASSWORD
+#define WIFI_PASSWORD ""
+#endif
+
+#define STARTUP_DELAY_MS 0 ///< Optional delay before LVGL starts, e.g. to attach a USB serial terminal
+#define BOOT_FIRST_PIXEL_BUDGET_US 50000  ///< Time-to-first-pixel (splash) checked by check_boot_budget()
+#define BOOT_FIRST_FRAME_BUDGET_US 250000 ///< Time-to-first-LVGL-frame checked by check_boot_budget(), STARTUP_DELAY_MS comes on top
+
+#define SCENE_ARENA_SIZE (104 * 1024) ///< Largest memory need of two consecutive scenes (particles + bouncing balls with its text strips)
+
+#ifndef SCENE_RANDOM_SEED
+#define SCENE_RANDOM_SEED 0 ///< Seed of the scenes' random numbers, 0: from pico_rand, so every boot differs
+#endif
+
 /// @brief Enum for selecting animation demos
 enum DemoIndex
 {
@@ -33,17 +110,78 @@ enum DemoIndex
     DEMO_FIRE,
     DEMO_IMAGE,
     DEMO_COLOUR,
+    DEMO_CLIP,
+    DEMO_GIF,
+    DEMO_SPRITES,
+    DEMO_PARTICLES,
+    DEMO_PLASMA,
+    DEMO_TUNNEL,
+    DEMO_STARFIELD,
     DEMO_COUNT
 };
 
-static critical_section_t crit_sec = {0};                                   ///< Synchronization for safe time reading
+/// @brief Events posted by interrupt handlers and processed by the main loop
+enum EventType : uint8_t
+{
+    EVENT_NEXT_DEMO,  ///< Switch to the next demo
+    EVENT_STATS_DUMP, ///< Print frame and memory statistics
+    EVENT_HEAP_DUMP,  ///< Print the LVGL heap report
+    EVENT_BRIGHTNESS, ///< Set the global brightness to value (0-255)
+};
+
+/// @brief Entry of the event queue
+struct Event
+{
+    EventType type;
+    int32_t value; ///< Event specific argument
+};
+
+static EventQueue<Event, 16> events; ///< Lock-free queue from IRQ-context producers to the main loop
+
 static int frame_index = DEMO_BOUNCE;                                       ///< Current demo index
 static uint8_t buf1[RGB_MATRIX_WIDTH * RGB_MATRIX_WIDTH * BYTES_PER_PIXEL]; ///< Drawing buffer for LVGL
+#if PIPELINE_MODE
+static uint8_t buf2[RGB_MATRIX_WIDTH * RGB_MATRIX_WIDTH * BYTES_PER_PIXEL]; ///< Second drawing buffer, rendered into while core 1 converts buf1 (and vice versa)
+static FramePipeline pipeline; ///< Hands the buffers to core 1, and the converter to core 0 for streams
+#endif
+
+static uint8_t scene_arena_memory[SCENE_ARENA_SIZE] __attribute__((aligned(8))); ///< Backing storage for the scenes' large buffers
 
 static lv_display_t *display1; ///< LVGL display handle
 
 static bool load_anim = true; ///< Flag to trigger animation setup
 
+static volatile bool frame_changed = false;      ///< Set by flush_cb() when a flush has altered the panel content
+static uint32_t frame_count = 0;                 ///< Number of frames handed to the driver, used for the fps report
+static volatile bool first_frame_traced = false; ///< Set once the first LVGL frame has been recorded in the boot trace
+static volatile bool stream_owns_panel = false;  ///< LVGL frames are not converted while a USB or network stream is active
+static bool usb_owns_panel = false;              ///< The USB stream is active
+static bool network_owns_panel = false;          ///< The network receiver is active
+
+#if FRAME_PROFILE
+/// @brief Time spent per phase since boot, report_fps() prints the increase per demo
+struct FrameProfile
+{
+    uint64_t update_us;           ///< Scene manager and scene update() calls
+    uint64_t render_us;           ///< lv_timer_handler(): LVGL rendering, in pipeline mode including the hand-over to core 1
+    uint32_t render_max_us;       ///< Longest lv_timer_handler() call of the current demo
+    volatile uint32_t convert_us; ///< update_bgr() calls, added by core 1 in pipeline mode, wraps after 71 minutes
+};
+static FrameProfile profile;
+#endif
+
+#if RGB_MATRIX_CALIBRATION
+/// @brief Gamma and white point of the panel batch in use, e.g. a bluish white corrected by lower blue gain
+static const ColourCalibration panel_calibration = {{2.2f, 2.2f, 2.2f}, {1.0f, 0.95f, 0.85f}};
+static ColourLut panel_lut; ///< Tables built from panel_calibration
+#endif
+
+#if NETWORK_RECEIVER
+#define E131_UNIVERSE_COUNT ((RGB_MATRIX_WIDTH * RGB_MATRIX_HEIGHT * 3 + E131_CHANNELS_PER_UNIVERSE - 1) / E131_CHANNELS_PER_UNIVERSE)
+static UniverseMapping universe_mapping[E131_UNIVERSE_COUNT]; ///< Consecutive universes fill the frame row by row
+static NetworkReceiver *networkReceiver;                      ///< Created in main()
+#endif
+
 //--------------------------------------------------------------------------------
 // Utility Functions
 //--------------------------------------------------------------------------------
@@ -56,19 +194,15 @@ static bool load_anim = true; ///< Flag to trigger animation setup
  * from within an LVGL tick callback and is designed to provide consistent time
  * values even when used in concurrent or interrupt-driven environments.
  *
- * The access to `get_absolute_time()` is wrapped in a critical section to
- * ensure atomicity and consistency on multicore or preemptive systems like the
- * RP2040. This prevents potential race conditions if `get_absolute_time()` is
- * not atomic.
+ * `time_us_64()` reads the raw timer registers without latching and re-reads the
+ * high word until it is stable, so a consistent 64-bit value is obtained without
+ * a lock. No critical section is needed, and a tick query never blocks.
  *
  * @return The time since boot in milliseconds.
  */
 uint32_t get_milliseconds_since_boot()
 {
-    critical_section_enter_blocking(&crit_sec);
-    uint32_t ms = to_ms_since_boot(get_absolute_time());
-    critical_section_exit(&crit_sec);
-    return ms;
+    return static_cast<uint32_t>(time_us_64() / 1000);
 }
 
 /**
@@ -82,47 +216,323 @@ uint32_t get_milliseconds_since_boot()
  * For the Hub75 driver, we assume that the entire screen is updated each time
  * (full frame flush), and the buffer is passed to `update_bgr()` which converts
  * and writes it to the physical framebuffer or triggers a transfer.
+ * `update_bgr()` skips rows which are identical to the previous frame and
+ * reports whether anything has changed at all, which is recorded in `frame_changed`.
  *
  * After the pixel data is processed, `lv_display_flush_ready()` must be called
  * to inform LVGL that the flush is complete, allowing it to reuse or update the
  * drawing buffer.
  *
+ * In pipeline mode the buffer is only handed over to core 1 through the multicore
+ * FIFO. Core 1 converts it and calls `lv_display_flush_ready()` afterwards, while
+ * LVGL continues rendering into the second buffer.
+ *
  * @param display The LVGL display object.
  * @param area Area being updated (not used here).
  * @param px_map Pointer to pixel buffer.
  */
 void flush_cb(lv_display_t *display, const lv_area_t *area, uint8_t *px_map)
 {
-    update_bgr(px_map);              ///< Transfer buffer to display driver
+    frame_count++;
+#if HEAP_STATS
+    heap_stats_frame();
+#endif
+#if PIPELINE_MODE
+    pipeline.hand_over(px_map == buf1 ? 1 : 2); ///< Hand buffer over to core 1
+#else
+    // Transfer buffer to display driver
+#if FRAME_PROFILE
+    uint32_t convert_start = time_us_32();
+#endif
+    if (!stream_owns_panel && update_bgr(px_map))
+    {
+        frame_changed = true;
+    }
+#if FRAME_PROFILE
+    profile.convert_us += time_us_32() - convert_start;
+#endif
+#ifdef HUB75_HOST
+    if (!stream_owns_panel)
+    {
+        host_record_frame(px_map);
+    }
+#endif
+    if (!first_frame_traced)
+    {
+        first_frame_traced = true;
+        boot_trace("first LVGL frame");
+    }
     lv_display_flush_ready(display); ///< Notify LVGL that flush is complete
+#endif
+}
+
+/**
+ * @brief Prints the frame rate achieved by the demo which has just finished.
+ *
+ * The rate is measured end-to-end from the number of frames flushed to the driver
+ * since the previous call. With FRAME_PROFILE the average time per frame of the
+ * scene update, the LVGL rendering and the conversion on core 1 follow.
+ *
+ * @param index Index of the demo which has just finished.
+ * @param name Name of its scene.
+ */
+void report_fps(int index, const char *name)
+{
+    static bool started = false;
+    static uint32_t last_ms = 0;
+    static uint32_t last_count = 0;
+#if FRAME_PROFILE
+    static FrameProfile last_profile;
+    uint32_t convert_us = profile.convert_us;
+#endif
+
+    uint32_t now = get_milliseconds_since_boot();
+    uint32_t frames = frame_count - last_count;
+    if (started && now > last_ms)
+    {
+        printf("demo %d (%s): %lu frames, %.1f fps\n", index, name, (unsigned long)frames, frames * 1000.0f / (now - last_ms));
+#if FRAME_PROFILE
+        if (frames > 0)
+        {
+            printf("  per frame: update %lu us, render %lu us (max %lu us), convert %lu us\n",
+                   (unsigned long)((profile.update_us - last_profile.update_us) / frames),
+                   (unsigned long)((profile.render_us - last_profile.render_us) / frames), (unsigned long)profile.render_max_us,
+                   (unsigned long)((convert_us - last_profile.convert_us) / frames));
+        }
+#endif
+    }
+    started = true;
+    last_ms = now;
+    last_count = frame_count;
+#if FRAME_PROFILE
+    last_profile.update_us = profile.update_us;
+    last_profile.render_us = profile.render_us;
+    last_profile.convert_us = convert_us;
+    profile.render_max_us = 0;
+#endif
 }
 
 /**
  * @brief Timer callback to cycle to the next demo.
  *
- * Called every 15 seconds to switch to the next animation mode.
+ * Called every 15 seconds in timer IRQ context. It only posts an event, the
+ * switch itself is done by the main loop.
  *
  * @param t Unused timer pointer.
  * @return true (always continue the timer).
  */
 bool skip_to_next_demo(__unused struct repeating_timer *t)
 {
-    printf("skip_to_next_demo %d\n", frame_index);
-    if (frame_index++ >= DEMO_COLOUR)
-        frame_index = DEMO_BOUNCE;
-    load_anim = true;
+    events.post({EVENT_NEXT_DEMO, 0});
+    return true;
+}
+
+/**
+ * @brief Timer callback requesting a statistics print-out.
+ *
+ * @param t Unused timer pointer.
+ * @return true (always continue the timer).
+ */
+bool request_stats_dump(__unused struct repeating_timer *t)
+{
+    events.post({EVENT_STATS_DUMP, 0});
     return true;
 }
 
+#if HEAP_STATS_DUMP_INTERVAL_MS > 0
+/**
+ * @brief Timer callback requesting a heap report.
+ *
+ * @param t Unused timer pointer.
+ * @return true (always continue the timer).
+ */
+bool request_heap_dump(__unused struct repeating_timer *t)
+{
+    events.post({EVENT_HEAP_DUMP, 0});
+    return true;
+}
+#endif
+
+#if BRIGHTNESS_BUTTON_PIN >= 0
+#include "hardware/gpio.h"
+
+static const uint8_t brightness_levels[] = {255, 128, 64, 32, 16}; ///< Levels the button steps through
+static uint brightness_level = 0;                                 ///< Index into brightness_levels, only used by the GPIO IRQ
+static uint32_t brightness_pressed_us = 0;                        ///< Time of the last accepted press, for debouncing
+
+/**
+ * @brief GPIO callback stepping to the next brightness level.
+ *
+ * Called in IRQ context. It only posts the new level, the main loop applies it.
+ *
+ * @param gpio GPIO which triggered the interrupt.
+ * @param event_mask Unused edge mask.
+ */
+void brightness_button_pressed(uint gpio, __unused uint32_t event_mask)
+{
+    uint32_t now = time_us_32();
+    if (gpio != BRIGHTNESS_BUTTON_PIN || now - brightness_pressed_us < 200000)
+    {
+        return; // Contact bounce
+    }
+    brightness_pressed_us = now;
+    brightness_level = (brightness_level + 1) % (sizeof(brightness_levels) / sizeof(brightness_levels[0]));
+    events.post({EVENT_BRIGHTNESS, brightness_levels[brightness_level]});
+}
+#endif
+
+/**
+ * @brief Compares time-to-first-pixel and time-to-first-LVGL-frame with their budgets.
+ *
+ * @param print Print both times with their budgets.
+ * @return true if both phases have been reached within their budgets.
+ */
+bool check_boot_budget(bool print)
+{
+    uint64_t first_pixel = boot_trace_time_us("first pixel (splash)");
+    uint64_t first_frame = boot_trace_time_us("first LVGL frame");
+    uint64_t frame_budget = BOOT_FIRST_FRAME_BUDGET_US + STARTUP_DELAY_MS * 1000ull;
+    bool within = first_pixel <= BOOT_FIRST_PIXEL_BUDGET_US && first_frame <= frame_budget;
+    if (print || !within)
+    {
+        printf("boot budget %s: first pixel %llu us of %llu, first LVGL frame %llu us of %llu\n", within ? "kept" : "EXCEEDED",
+               (unsigned long long)first_pixel, (unsigned long long)BOOT_FIRST_PIXEL_BUDGET_US, (unsigned long long)first_frame,
+               (unsigned long long)frame_budget);
+    }
+    return within;
+}
+
+/**
+ * @brief Prints frame, LVGL heap and per-scene memory statistics and the boot trace.
+ *
+ * @param sceneManager The scene manager.
+ */
+void dump_stats(const SceneManager &sceneManager)
+{
+#if HEAP_STATS
+    printf("frames %lu\n", (unsigned long)frame_count);
+    heap_stats_print();
+#else
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    printf("frames %lu, heap used %lu bytes (%d%%), max used %lu, biggest free %lu, fragmentation %d%%\n",
+           (unsigned long)frame_count, (unsigned long)(mon.total_size - mon.free_size), mon.used_pct,
+           (unsigned long)mon.max_used, (unsigned long)mon.free_biggest_size, mon.frag_pct);
+#endif
+#if LV_DRAW_SW_TRANSFORM_CACHE_SIZE > 0
+    lv_draw_sw_transform_cache_info_t cache;
+    lv_draw_sw_transform_cache_get_info(&cache);
+    uint32_t lookups = cache.hits + cache.misses;
+    printf("transform cache: %lu hits, %lu misses (%lu%% hit rate), %lu evictions, %lu entries, %lu of %lu bytes\n",
+           (unsigned long)cache.hits, (unsigned long)cache.misses, (unsigned long)(lookups ? cache.hits * 100ull / lookups : 0),
+           (unsigned long)cache.evictions, (unsigned long)cache.entry_cnt, (unsigned long)cache.size, (unsigned long)LV_DRAW_SW_TRANSFORM_CACHE_SIZE);
+#endif
+    sceneManager.print_stats();
+    print_hub75_timing();
+#if NETWORK_RECEIVER
+    networkReceiver->print_stats();
+#endif
+    boot_trace_print();
+    check_boot_budget(true);
+}
+
+/**
+ * @brief Processes an event taken from the event queue in the main loop.
+ *
+ * @param event The event.
+ * @param sceneManager The scene manager.
+ */
+void handle_event(const Event &event, const SceneManager &sceneManager)
+{
+    switch (event.type)
+    {
+    case EVENT_NEXT_DEMO:
+        printf("skip_to_next_demo %d\n", frame_index);
+        if (frame_index++ >= DEMO_COUNT - 1)
+            frame_index = DEMO_BOUNCE;
+        load_anim = true;
+        break;
+    case EVENT_STATS_DUMP:
+        dump_stats(sceneManager);
+        break;
+    case EVENT_HEAP_DUMP:
+#if HEAP_STATS
+        heap_stats_print();
+#endif
+        break;
+    case EVENT_BRIGHTNESS:
+        printf("brightness %ld\n", (long)event.value);
+        hub75_set_brightness(static_cast<uint8_t>(event.value));
+        break;
+    }
+}
+
 /**
  * @brief Secondary core entry point.
  *
  * Initializes and starts the HUB75 driver on core 1.
+ * The pre-converted splash frame is copied from flash before the driver starts,
+ * so the very first refresh shows it while core 0 is still initialising LVGL.
+ * In pipeline mode core 1 then converts the frames handed over by `flush_cb()`.
  */
 void core1_entry()
 {
-    create_hub75_driver(RGB_MATRIX_WIDTH, RGB_MATRIX_HEIGHT);
+    create_hub75_driver(RGB_MATRIX_WIDTH, RGB_MATRIX_HEIGHT, RGB_MATRIX_SCAN, RGB_MATRIX_MULTIPLEX, RGB_MATRIX_CHAINS, RGB_MATRIX_PANEL_WIDTH);
+    Hub75Timing timing = configure_hub75_timing(RGB_MATRIX_PIXEL_CLOCK_HZ, RGB_MATRIX_REFRESH_HZ);
+    if (!timing.target_met)
+    {
+        printf("Refresh target %u Hz not reachable, running at %.0f Hz\n", RGB_MATRIX_REFRESH_HZ, timing.refresh_hz);
+    }
+    hub75_set_brightness(RGB_MATRIX_BRIGHTNESS);
+#if RGB_MATRIX_DITHERING && RGB_MATRIX_CALIBRATION
+    enable_hub75_dithering(panel_calibration);
+#elif RGB_MATRIX_DITHERING
+    enable_hub75_dithering();
+#endif
+#if RGB_MATRIX_WIDTH == 64 && RGB_MATRIX_HEIGHT == 64
+    load_frame(splash_64x64);
+#endif
     start_hub75_driver();
+    boot_trace("first pixel (splash)");
+#if RGB_MATRIX_CALIBRATION
+    // The splash is already converted, computing the curves can wait until it is on the panel
+    build_colour_lut(panel_lut, panel_calibration);
+    set_colour_lut(&panel_lut);
+#endif
+
+    multicore_fifo_push_blocking(0); // Tell core 0 that the frame buffer exists
+
+#if PIPELINE_MODE
+    while (true)
+    {
+        bool convert; // false while core 0 has claimed the converter for a stream
+        uint8_t *px_map = pipeline.take(convert) == 1 ? buf1 : buf2;
+#if FRAME_PROFILE
+        uint32_t convert_start = time_us_32();
+#endif
+        if (convert && update_bgr(px_map))
+        {
+            frame_changed = true;
+        }
+#if FRAME_PROFILE
+        profile.convert_us += time_us_32() - convert_start;
+#endif
+#ifdef HUB75_HOST
+        if (convert)
+        {
+            host_record_frame(px_map);
+        }
+#endif
+        if (!first_frame_traced)
+        {
+            first_frame_traced = true;
+            boot_trace("first LVGL frame");
+        }
+        __dmb(); // Make the conversion results visible to core 0 before releasing the buffer
+        pipeline.done();
+        lv_display_flush_ready(display1);
+    }
+#endif
 }
 
 /**
@@ -130,10 +540,10 @@ void core1_entry()
  */
 void initialize()
 {
-    // Set system clock to 250MHz - just to show that it is possible to drive the HUB75 panel with a high clock speed
-    set_sys_clock_khz(250000, true);
+    // Set system clock to 250MHz - just to show that it is possible to drive the HUB75 panel with a high clock speed.
+    // Lower clocks save power, the driver keeps pixel clock and refresh rate as far as possible.
+    set_sys_clock_khz(SYS_CLOCK_KHZ, true);
     stdio_init_all();
-    critical_section_init(&crit_sec);
 
     // led_init(); // Initialize LED - blinking at program start
 
@@ -145,37 +555,24 @@ void initialize()
 /**
  * @brief Sets up the selected animation.
  *
- * This function initializes the animation scene based on the current demo index.
+ * Creates the scene for the current demo index and starts its transition. The
+ * previous scene is released by the scene manager once the transition is over.
  *
  * @param index Current demo index.
- * @param bouncingBalls Bouncing ball animation instance.
- * @param fireEffect Fire effect instance.
- * @param imageAnimation Image animation instance.
- * @param colorCheck display colour squares
+ * @param sceneManager The scene manager.
  * @param timer Reference to the demo-switching timer.
+ * @param timer_held Set to true if the demo-switching timer has been cancelled.
  */
-void setup_demo(int index, BouncingBalls &bouncingBalls, FireEffect &fireEffect, ImageAnimation &imageAnimation, ColourCheck &colourCheck, struct repeating_timer &timer)
+void setup_demo(int index, SceneManager &sceneManager, struct repeating_timer &timer, bool &timer_held)
 {
-    switch (index)
+    if (!sceneManager.load(index))
+    {
+        return;
+    }
+    if (sceneManager.active()->holds_timer())
     {
-    // case DEMO_CLOCK:
-    //     printf("setup_demo DEMO_CLOCK\n");
-    //     flipClock.show();
-    //     break;
-    case DEMO_BOUNCE:
-        bouncingBalls.show();
-        break;
-    case DEMO_FIRE:
-        fireEffect.show();
-        break;
-    case DEMO_IMAGE:
         cancel_repeating_timer(&timer); // prevent premature transition
-        imageAnimation.show();
-        imageAnimation.start();
-        break;
-    case DEMO_COLOUR:
-        colourCheck.show();
-        break;
+        timer_held = true;
     }
 }
 
@@ -184,39 +581,121 @@ void setup_demo(int index, BouncingBalls &bouncingBalls, FireEffect &fireEffect,
  *
  * Handles per-frame logic such as animation updates and polling for completion.
  *
- * @param index Current demo index.
- * @param bouncingBalls Bouncing ball animation instance.
- * @param fireEffect Fire effect instance.
- * @param imageAnimation Image animation instance.
- * @param colorCheck display colour squares
+ * @param sceneManager The scene manager.
  * @param timer Reference to the demo-switching timer.
+ * @param timer_held true while the demo-switching timer is cancelled.
  */
-void update_demo(int index, BouncingBalls &bouncingBalls, FireEffect &fireEffect, ImageAnimation &imageAnimation, ColourCheck &colourCheck, struct repeating_timer &timer)
+void update_demo(SceneManager &sceneManager, struct repeating_timer &timer, bool &timer_held)
 {
-    switch (index)
+    sceneManager.update();
+
+    Scene *scene = sceneManager.active();
+    if (timer_held && scene && !scene->holds_timer())
     {
-    // case DEMO_CLOCK:
-    //     // printf("update_demo DEMO_CLOCK\n");
-    //     flipClock.tick();
-    //     break;
-    case DEMO_BOUNCE:
-        bouncingBalls.bounce();
-        break;
-    case DEMO_FIRE:
-        fireEffect.burn();
-        break;
-    case DEMO_IMAGE:
-        if (imageAnimation.animation_done())
+        timer_held = false;
+        add_repeating_timer_ms(15000, skip_to_next_demo, NULL, &timer);
+    }
+}
+
+/**
+ * @brief Takes the panel from LVGL before a stream writes into the frame buffer.
+ *
+ * In pipeline mode this waits until core 1 has finished the frame it may be converting,
+ * afterwards core 1 leaves LVGL frames unconverted. The first streamed frame converts every row.
+ */
+void claim_panel()
+{
+    if (stream_owns_panel)
+    {
+        return;
+    }
+    stream_owns_panel = true;
+#if PIPELINE_MODE
+    pipeline.claim();
+#endif
+    invalidate_frame(); // The row hashes are of BGR rows from LVGL, streams write RGB
+}
+
+/**
+ * @brief Hands the panel to an external source or back to LVGL.
+ *
+ * When the last external source has stopped, the whole LVGL screen is redrawn.
+ */
+void update_panel_owner()
+{
+    bool external = usb_owns_panel || network_owns_panel;
+    if (external == stream_owns_panel)
+    {
+        return;
+    }
+    if (external)
+    {
+        claim_panel();
+        return;
+    }
+    invalidate_frame(); // Still claimed, core 1 does not touch the converter yet
+    stream_owns_panel = false;
+#if PIPELINE_MODE
+    pipeline.release();
+#endif
+    lv_obj_invalidate(lv_screen_active());
+}
+
+/**
+ * @brief Receives frames streamed over USB and hands the panel back to LVGL when the stream ends.
+ *
+ * While frames keep arriving, LVGL output is not converted, so streamed content is not overwritten.
+ * After the stream has timed out the whole LVGL screen is redrawn.
+ *
+ * @param usbStream The USB stream receiver.
+ */
+void poll_usb_stream(UsbStreamReceiver &usbStream)
+{
+    uint32_t now = get_milliseconds_since_boot();
+    if (usbStream.poll(now))
+    {
+        frame_changed = true;
+    }
+
+    bool streaming = usbStream.active(now);
+    if (streaming != usb_owns_panel)
+    {
+        usb_owns_panel = streaming;
+        printf("usb stream %s (%lu frames shown, %lu dropped)\n", streaming ? "started" : "stopped",
+               (unsigned long)usbStream.shown(), (unsigned long)usbStream.dropped());
+        update_panel_owner();
+    }
+}
+
+#if NETWORK_RECEIVER
+/**
+ * @brief Processes network traffic and shows frames received via DDP or E1.31.
+ *
+ * Like the USB stream, the network receiver owns the panel while frames keep arriving.
+ * A presented frame is converted with the same row-pair skipping as an LVGL frame.
+ */
+void poll_network()
+{
+    uint32_t now = get_milliseconds_since_boot();
+    const uint8_t *frame = networkReceiver->poll(now);
+    if (frame != nullptr)
+    {
+        claim_panel();
+        if (update(const_cast<uint8_t *>(frame)))
         {
-            imageAnimation.animation_init();
-            add_repeating_timer_ms(15000, skip_to_next_demo, NULL, &timer);
+            frame_changed = true;
         }
-        break;
-    case DEMO_COLOUR:
-        colourCheck.colour_test();
-        break;
+    }
+
+    bool receiving = networkReceiver->active(now);
+    if (receiving != network_owns_panel)
+    {
+        network_owns_panel = receiving;
+        printf("network stream %s\n", receiving ? "started" : "stopped");
+        update_panel_owner();
     }
 }
+#endif
 
 //--------------------------------------------------------------------------------
 // Main Entry Point
@@ -232,12 +711,27 @@ void update_demo(int index, BouncingBalls &bouncingBalls, FireEffect &fireEffect
  */
 int main()
 {
+#ifdef HUB75_HOST
+    host_record_start({RGB_MATRIX_WIDTH, RGB_MATRIX_HEIGHT, RGB_MATRIX_SCAN, RGB_MATRIX_MULTIPLEX, RGB_MATRIX_CHAINS, RGB_MATRIX_PANEL_WIDTH});
+#endif
     initialize();
+    boot_trace("clocks, stdio, core 1 launched");
+#ifdef HUB75_HOST
+    scene_random_seed(host_random_seed(SCENE_RANDOM_SEED));
+#else
+    scene_random_seed(SCENE_RANDOM_SEED);
+#endif
 
-    sleep_ms(10000); // Allow screen + hardware to stabilize
+#if STARTUP_DELAY_MS > 0
+    sleep_ms(STARTUP_DELAY_MS); // Time to attach a serial terminal - the splash is already visible
+#endif
 
     lv_init();
     lv_tick_set_cb(get_milliseconds_since_boot);
+#if HEAP_STATS
+    heap_stats_start();
+#endif
+    boot_trace("lv_init");
 
     display1 = lv_display_create(RGB_MATRIX_WIDTH, RGB_MATRIX_HEIGHT);
     if (display1 == NULL)
@@ -246,33 +740,159 @@ int main()
         return -1;
     }
 
+#if PIPELINE_MODE
+    lv_display_set_buffers_with_stride(display1, buf1, buf2, sizeof(buf1), RGB_MATRIX_WIDTH * 3, LV_DISPLAY_RENDER_MODE_FULL);
+#else
     lv_display_set_buffers_with_stride(display1, buf1, NULL, sizeof(buf1), RGB_MATRIX_WIDTH * 3, LV_DISPLAY_RENDER_MODE_FULL);
+#endif
     lv_display_set_flush_cb(display1, flush_cb);
+    boot_trace("display created");
+
+    multicore_fifo_pop_blocking(); // Wait for the driver on core 1 before the first flush
 
     // The Hub75 driver is constantly running on core 1 with a frequency much higher than 200Hz. CPU load on core 1 is low due to DMA and PIO usage.
     // The animated examples are updated at 60Hz.
     const float fps = 120.0f;
     const float frame_delay_ms = 1000.0f / fps;
+    // Upper bound for the idle wait while the panel content does not change
+    uint32_t idle_delay_ms = 100;
 
+    // Scenes only record their parameters here, they are built just before they are shown
     BouncingBalls bouncingBalls(15, RGB_MATRIX_WIDTH, RGB_MATRIX_HEIGHT);
     FireEffect fireEffect(RGB_MATRIX_WIDTH, RGB_MATRIX_HEIGHT);
     ImageAnimation imageAnimation(RGB_MATRIX_WIDTH, RGB_MATRIX_HEIGHT);
     ColourCheck colourCheck(RGB_MATRIX_WIDTH, RGB_MATRIX_HEIGHT);
+    ClipAnimation clipAnimation(clip_64x64, sizeof(clip_64x64), RGB_MATRIX_WIDTH, RGB_MATRIX_HEIGHT);
+    GifAnimation gifAnimation(gif_64x64, sizeof(gif_64x64), RGB_MATRIX_WIDTH, RGB_MATRIX_HEIGHT);
+    SpriteSwarm spriteSwarm(256, RGB_MATRIX_WIDTH, RGB_MATRIX_HEIGHT);
+    ParticleEffect particleEffect(6144, RGB_MATRIX_WIDTH, RGB_MATRIX_HEIGHT);
+    PlasmaEffect plasma;
+    TunnelEffect tunnel;
+    StarfieldEffect starfield;
+    ProceduralScene plasmaScene(plasma, RGB_MATRIX_WIDTH, RGB_MATRIX_HEIGHT);
+    ProceduralScene tunnelScene(tunnel, RGB_MATRIX_WIDTH, RGB_MATRIX_HEIGHT);
+    ProceduralScene starfieldScene(starfield, RGB_MATRIX_WIDTH, RGB_MATRIX_HEIGHT);
+
+    Scene *scenes[DEMO_COUNT] = {&bouncingBalls, &fireEffect, &imageAnimation, &colourCheck, &clipAnimation, &gifAnimation, &spriteSwarm, &particleEffect,
+                                 &plasmaScene, &tunnelScene, &starfieldScene};
+    SceneManager sceneManager(scenes, DEMO_COUNT, scene_arena_memory, sizeof(scene_arena_memory));
+
+#if USB_STREAM
+    UsbStreamReceiver usbStream(RGB_MATRIX_WIDTH, RGB_MATRIX_HEIGHT, claim_panel);
+#endif
+
+#if NETWORK_RECEIVER
+    for (uint i = 0; i < E131_UNIVERSE_COUNT; i++)
+    {
+        universe_mapping[i] = {static_cast<uint16_t>(E131_FIRST_UNIVERSE + i), i * E131_CHANNELS_PER_UNIVERSE};
+    }
+    networkReceiver = new NetworkReceiver(RGB_MATRIX_WIDTH * RGB_MATRIX_HEIGHT * 3, universe_mapping, E131_UNIVERSE_COUNT);
+    bool network_started = WIFI_SSID[0] != '\0' && networkReceiver->start(WIFI_SSID, WIFI_PASSWORD);
+    boot_trace("network receiver started");
+#endif
+
+#if NETWORK_RECEIVER
+    if (network_started)
+    {
+        idle_delay_ms = frame_delay_ms; // lwIP runs in poll mode - packets wait in the radio until polled
+    }
+#endif
 
     struct repeating_timer timer;
+    bool timer_held = false;
     add_repeating_timer_ms(15000, skip_to_next_demo, NULL, &timer);
 
+#if BRIGHTNESS_BUTTON_PIN >= 0
+    gpio_init(BRIGHTNESS_BUTTON_PIN);
+    gpio_pull_up(BRIGHTNESS_BUTTON_PIN);
+    gpio_set_irq_enabled_with_callback(BRIGHTNESS_BUTTON_PIN, GPIO_IRQ_EDGE_FALL, true, brightness_button_pressed);
+#endif
+
+    struct repeating_timer stats_timer;
+    add_repeating_timer_ms(STATS_DUMP_INTERVAL_MS, request_stats_dump, NULL, &stats_timer);
+#if HEAP_STATS && HEAP_STATS_DUMP_INTERVAL_MS > 0
+    struct repeating_timer heap_timer;
+    add_repeating_timer_ms(HEAP_STATS_DUMP_INTERVAL_MS, request_heap_dump, NULL, &heap_timer);
+#endif
+
     while (true)
     {
+        Event event;
+        while (events.poll(event))
+        {
+            handle_event(event, sceneManager);
+        }
+
         if (load_anim)
         {
             load_anim = false;
-            setup_demo(frame_index, bouncingBalls, fireEffect, imageAnimation, colourCheck, timer);
+            int previous = frame_index == DEMO_BOUNCE ? DEMO_COUNT - 1 : frame_index - 1;
+            report_fps(previous, scenes[previous]->name());
+            setup_demo(frame_index, sceneManager, timer, timer_held);
+            if (!first_frame_traced)
+            {
+                boot_trace("first scene created");
+            }
         }
 
-        update_demo(frame_index, bouncingBalls, fireEffect, imageAnimation, colourCheck, timer);
+#if FRAME_PROFILE
+        uint32_t update_start = time_us_32();
+#endif
+        update_demo(sceneManager, timer, timer_held);
+
+#if USB_STREAM
+        poll_usb_stream(usbStream);
+#endif
+#if NETWORK_RECEIVER
+        poll_network();
+#endif
+
+#if FRAME_PROFILE
+        uint32_t render_start = time_us_32();
+        profile.update_us += render_start - update_start;
+#endif
+        uint32_t time_till_next = lv_timer_handler();
+#if FRAME_PROFILE
+        uint32_t render_us = time_us_32() - render_start;
+        profile.render_us += render_us;
+        if (render_us > profile.render_max_us)
+        {
+            profile.render_max_us = render_us;
+        }
+#endif
+
+#ifdef HUB75_HOST
+        if (host_run_finished(frame_count))
+        {
+            report_fps(frame_index, scenes[frame_index]->name());
+            dump_stats(sceneManager);
+            host_record_stop();
+            return check_boot_budget(false) ? 0 : 1; // Exit code of the boot_budget test
+        }
+#endif
 
-        lv_timer_handler();
-        sleep_ms(frame_delay_ms);
+        if (stream_owns_panel)
+        {
+            // Keep draining the USB and network receive buffers - sleeping would throttle the stream
+            frame_changed = false;
+        }
+        else if (frame_changed)
+        {
+            frame_changed = false;
+            sleep_ms(frame_delay_ms);
+        }
+        else
+        {
+            // Nothing has reached the panel - sleep until LVGL has its next timer due or the scene needs its next update
+            uint32_t scene_due_ms = sceneManager.active() ? sceneManager.active()->next_update_ms() : UINT32_MAX;
+            if (scene_due_ms < time_till_next)
+            {
+                time_till_next = scene_due_ms;
+            }
+            if (scene_due_ms != 0)
+            {
+                sleep_ms(time_till_next < frame_delay_ms ? frame_delay_ms : (time_till_next > idle_delay_ms ? idle_delay_ms : time_till_next));
+            }
+        }
     }
 }
@@ -0,0 +1,74 @@
+#include <cstdio>
+
+#include "hub75_timing.hpp"
+
+/**
+ * @brief System clock cycles of a frame.
+ *
+ * @param shift_cycles Cycles to shift one row, at the system clock.
+ */
+static uint64_t frame_cycles(const Hub75TimingConfig &config, uint64_t shift_cycles, uint32_t oen_base)
+{
+    uint64_t planes = (1ull << config.bit_depth) - 1;
+    uint64_t per_plane = shift_cycles + HUB75_ROW_CYCLES + HUB75_IRQ_CYCLES + 1;
+    return config.scan * (config.bit_depth * per_plane + planes * oen_base);
+}
+
+Hub75Timing hub75_compute_timing(const Hub75TimingConfig &config)
+{
+    Hub75Timing timing = {};
+
+    // Clock divider in 1/256 steps, rounded up so the pixel clock does not exceed the target
+    uint64_t per_column = static_cast<uint64_t>(HUB75_CYCLES_PER_COLUMN) * config.pixel_clock_hz;
+    uint64_t div256 = per_column ? (static_cast<uint64_t>(config.sys_hz) * 256 + per_column - 1) / per_column : 256;
+    if (div256 < 256)
+    {
+        div256 = 256;
+    }
+    else if (div256 > 0xffffff)
+    {
+        div256 = 0xffffff;
+    }
+    timing.clkdiv_int = static_cast<uint16_t>(div256 >> 8);
+    timing.clkdiv_frac = static_cast<uint8_t>(div256 & 0xff);
+    timing.pixel_clock_hz = static_cast<uint32_t>(static_cast<uint64_t>(config.sys_hz) * 256 / (HUB75_CYCLES_PER_COLUMN * div256));
+
+    uint64_t shift_cycles = (config.columns + HUB75_DUMMY_COLUMNS) * HUB75_CYCLES_PER_COLUMN * div256 / 256;
+
+    // Spend what is left of the frame time on the OEn pulses
+    uint64_t budget = config.refresh_hz ? config.sys_hz / config.refresh_hz : 0;
+    uint64_t fixed = frame_cycles(config, shift_cycles, 0);
+    uint64_t pulse_units = config.scan * ((1ull << config.bit_depth) - 1);
+    uint64_t oen_base = budget > fixed && pulse_units ? (budget - fixed) / pulse_units : 0;
+
+    timing.target_met = oen_base >= 1;
+    if (oen_base < 1)
+    {
+        oen_base = HUB75_OEN_BASE_FALLBACK;
+    }
+    else if (oen_base > HUB75_OEN_BASE_MAX)
+    {
+        oen_base = HUB75_OEN_BASE_MAX;
+    }
+    timing.oen_base = static_cast<uint32_t>(oen_base);
+
+    uint64_t cycles = frame_cycles(config, shift_cycles, timing.oen_base);
+    timing.refresh_hz = static_cast<float>(config.sys_hz) / cycles;
+    timing.max_refresh_hz = static_cast<float>(config.sys_hz) / frame_cycles(config, shift_cycles, 1);
+    timing.duty = static_cast<float>(pulse_units * timing.oen_base) / cycles;
+    return timing;
+}
+
+void hub75_print_timing(const Hub75TimingConfig &config, const Hub75Timing &timing)
+{
+    printf("hub75 timing: sys %.1f MHz, %lu columns, 1/%lu scan, %lu bit planes\n",
+           config.sys_hz / 1e6f, (unsigned long)config.columns, (unsigned long)config.scan, (unsigned long)config.bit_depth);
+    printf("  pixel clock %.2f MHz (target %.2f, divider %u + %u/256), OEn base %lu cycles\n",
+           timing.pixel_clock_hz / 1e6f, config.pixel_clock_hz / 1e6f, timing.clkdiv_int, timing.clkdiv_frac, (unsigned long)timing.oen_base);
+    printf("  refresh %.0f Hz (target %lu), max %.0f Hz, LEDs lit %.0f%% of the time\n",
+           timing.refresh_hz, (unsigned long)config.refresh_hz, timing.max_refresh_hz, timing.duty * 100.0f);
+    if (!timing.target_met)
+    {
+        printf("  refresh target not reachable, OEn base %u cycles gives %.0f Hz\n", HUB75_OEN_BASE_FALLBACK, timing.refresh_hz);
+    }
+}
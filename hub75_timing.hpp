@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstdint>
+
+// Timing calculator for the HUB75 driver. Derives the PIO clock divider of the data state machines
+// and the BCM pulse widths from the actual system clock, so the panel keeps its pixel clock and
+// refresh rate when the system clock changes.
+//
+// Cycle counts per row address and bit plane, taken from hub75.pio:
+//   shifting     (columns + 4 dummy columns) * 16 data state machine cycles
+//   row overhead 8 (row select) + 2 (record) + 8 (LATCH) + 1 (end of pulse) + 1 row state machine cycles, plus the DMA interrupt
+//   OEn pulse    (oen_base << bit_plane) + 1 row state machine cycles
+// The row state machine runs at the system clock for the finest pulse resolution.
+
+#define HUB75_CYCLES_PER_COLUMN 16 ///< Data state machine cycles per column (upper and lower pixel)
+#define HUB75_DUMMY_COLUMNS 4      ///< 8 dummy pixels at the end of each row
+#define HUB75_ROW_CYCLES 20        ///< Row select, LATCH and end of pulse
+#define HUB75_IRQ_CYCLES 150       ///< Estimated cost of the DMA interrupt which starts the next row
+#define HUB75_OEN_BASE_MAX (1u << 17) ///< The OEn pulse of the highest bit plane must fit into 27 bits
+#define HUB75_OEN_BASE_FALLBACK 6  ///< OEn base if the refresh target cannot be met, the driver's fixed value before the calculator
+
+/// @brief Panel geometry and timing targets
+struct Hub75TimingConfig
+{
+    uint32_t sys_hz;         ///< Actual system clock
+    uint32_t pixel_clock_hz; ///< Target CLK frequency, limited by the panel's shift registers
+    uint32_t refresh_hz;     ///< Target refresh rate of the whole frame
+    uint32_t columns;        ///< Columns shifted per row address and chain
+    uint32_t scan;           ///< Row addresses
+    uint32_t bit_depth;      ///< Number of bit planes
+};
+
+/// @brief Computed timing
+struct Hub75Timing
+{
+    uint16_t clkdiv_int;      ///< Clock divider of the data state machines, integer part
+    uint8_t clkdiv_frac;      ///< Clock divider of the data state machines, 1/256 fractions
+    uint32_t oen_base;        ///< OEn pulse of the least significant bit plane in system clock cycles
+    uint32_t pixel_clock_hz;  ///< Achieved CLK frequency
+    float refresh_hz;         ///< Achieved refresh rate
+    float max_refresh_hz;     ///< Refresh rate with the shortest possible OEn pulses
+    float duty;               ///< Fraction of the frame time the LEDs are lit, i.e. the brightness
+    bool target_met;          ///< false if the refresh target is out of reach for this geometry and clock
+};
+
+/**
+ * @brief Computes clock divider and OEn pulse widths.
+ *
+ * The pixel clock is the fastest one not above the target. The remaining frame time after
+ * shifting is spent on the OEn pulses, so a lower refresh target gives a brighter panel.
+ * If the target cannot be met, target_met is false and the OEn base falls back to
+ * HUB75_OEN_BASE_FALLBACK - pulses of 1 cycle would leave the panel nearly dark for a few Hz more.
+ */
+Hub75Timing hub75_compute_timing(const Hub75TimingConfig &config);
+
+/// @brief Prints the timing and what is achievable.
+void hub75_print_timing(const Hub75TimingConfig &config, const Hub75Timing &timing);
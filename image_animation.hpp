@@ -5,11 +5,15 @@
 #include "lvgl/src/misc/lv_types.h"
 #include "lvgl/src/misc/lv_anim.h"
 #include "lvgl/src/widgets/image/lv_image.h"
+#include "lvgl/src/misc/cache/instance/lv_image_cache.h"
 
 #include "vanessa_mai_64x64.h"
 
+#include "scene.hpp"
+
 #define BYTES_PER_PIXEL (LV_COLOR_FORMAT_GET_SIZE(LV_COLOR_FORMAT_RGB888))
-class ImageAnimation
+#define VANESSA_SIZE 64 ///< Width and height of vanessa_mai_64x64, whatever the panel size
+class ImageAnimation : public Scene
 {
 private:
     static inline void image_animation_cb(void *var, int32_t v)
@@ -28,7 +32,6 @@ private:
         self->done = true;
     }
 
-    lv_obj_t *screen = nullptr;
     lv_obj_t *vanessa = nullptr;
     lv_image_header_t header;
     lv_image_dsc_t img_desc;
@@ -40,16 +43,25 @@ private:
 
 public:
     explicit ImageAnimation(uint width = 64, uint height = 64) : width(width), height(height)
+    {
+    }
+
+    const char *name() const override
+    {
+        return "image";
+    }
+
+    bool create(SceneArena::Region &) override
     {
         screen = lv_obj_create(NULL);
 
         vanessa = lv_image_create(screen);
 
         header.magic = LV_IMAGE_HEADER_MAGIC;
-        header.w = width;
-        header.h = height;
+        header.w = VANESSA_SIZE;
+        header.h = VANESSA_SIZE;
         header.cf = LV_COLOR_FORMAT_RGB888;
-        header.stride = width * BYTES_PER_PIXEL;
+        header.stride = VANESSA_SIZE * BYTES_PER_PIXEL;
         header.flags = 0x0;
         header.reserved_2 = 0;
 
@@ -59,7 +71,7 @@ public:
 
         lv_image_set_src(vanessa, &img_desc);
         lv_image_set_antialias(vanessa, true);
-        lv_image_set_pivot(vanessa, width / 2, height / 2);
+        lv_image_set_pivot(vanessa, VANESSA_SIZE / 2, VANESSA_SIZE / 2);
         lv_obj_align(vanessa, LV_ALIGN_CENTER, 0, 0);
 
         lv_anim_init(&a);
@@ -75,6 +87,8 @@ public:
         lv_anim_set_exec_cb(&a, static_cast<lv_anim_exec_xcb_t>(image_animation_cb));
         lv_anim_set_completed_cb(&a, static_cast<lv_anim_completed_cb_t>(image_animation_completed_cb));
         lv_anim_set_start_cb(&a, static_cast<lv_anim_start_cb_t>(image_animation_started_cb));
+
+        return true;
     }
 
     void start()
@@ -86,11 +100,12 @@ public:
         }
     }
 
-    void show()
+    void show() override
     {
         if (screen)
         {
             lv_screen_load_anim(screen, LV_SCR_LOAD_ANIM_OUT_TOP, 2000, 0, false);
+            start();
         }
     }
 
@@ -104,15 +119,15 @@ public:
         done = false;
     }
 
-    ~ImageAnimation()
+    bool holds_timer() const override
     {
-        if (screen)
-            lv_obj_clean(screen);
+        return !done;
+    }
 
-        if (vanessa)
-        {
-            lv_obj_delete_async(vanessa);
-            vanessa = nullptr;
-        }
+    void destroy() override
+    {
+        Scene::destroy(); // Deleting the image also deletes its running animation
+        vanessa = nullptr;
+        lv_image_cache_drop(&img_desc); // Releases rotated copies held by the transformed image cache
     }
 };
@@ -83,6 +83,10 @@
     #endif
 #endif  /*LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN*/
 
+/** 1: Call a hook registered with `lv_mem_set_hook()` on every allocation, reallocation and free,
+ * with the caller's return address. Used to instrument the heap. */
+#define LV_USE_MEM_HOOK 0
+
 /*====================
    HAL SETTINGS
  *====================*/
@@ -151,6 +155,11 @@
  * Set it to 0 to have no limit. */
 #define LV_DRAW_LAYER_MAX_MEMORY 0  /**< No limit by default [bytes]*/
 
+/** Maximum number of released draw tasks and layers kept in free lists for reuse.
+ * Every drawn object allocates a draw task each frame; reusing them saves the allocator
+ * work and keeps the heap from fragmenting. Set it to 0 to allocate every task. */
+#define LV_DRAW_TASK_POOL_SIZE 0
+
 /** Stack size of drawing thread.
  * NOTE: If FreeType or ThorVG is enabled, it is recommended to set it to 32KB or more.
  */
@@ -208,6 +217,13 @@
         #define LV_DRAW_SW_CIRCLE_CACHE_SIZE 4
     #endif
 
+    /** Cache the results of scaling and rotating images which do not change.
+     *  Repeated draws with the same source, scale, rotation and pivot become plain blits.
+     *  LV_DRAW_SW_TRANSFORM_CACHE_SIZE is the memory budget in bytes (ARGB8888, 4 bytes per transformed pixel).
+     *  An image is cached when it is drawn with the same transformation a second time.
+     *  - 0: disables caching */
+    #define LV_DRAW_SW_TRANSFORM_CACHE_SIZE 0
+
     #define  LV_USE_DRAW_SW_ASM     LV_DRAW_SW_ASM_NONE
 
     #if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_CUSTOM
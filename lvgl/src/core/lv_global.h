@@ -107,6 +107,9 @@ typedef struct _lv_global_t {
     bool layout_update_mutex;
 
     uint32_t memory_zero;
+#if LV_USE_MEM_HOOK
+    lv_mem_hook_cb_t mem_hook_cb;
+#endif
     uint32_t math_rand_seed;
 
     lv_event_t * event_header;
@@ -134,6 +137,9 @@ typedef struct _lv_global_t {
 #if LV_DRAW_SW_COMPLEX
     lv_draw_sw_mask_radius_circle_dsc_arr_t sw_circle_cache;
 #endif
+#if LV_USE_DRAW_SW && LV_DRAW_SW_TRANSFORM_CACHE_SIZE > 0
+    lv_draw_sw_transform_cache_t sw_transform_cache;
+#endif
 
 #if LV_USE_LOG
     lv_log_print_g_cb_t custom_log_print_cb;
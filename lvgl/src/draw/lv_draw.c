@@ -38,6 +38,10 @@ static bool is_independent(lv_layer_t * layer, lv_draw_task_t * t_check);
 static void cleanup_task(lv_draw_task_t * t, lv_display_t * disp);
 static inline size_t get_draw_dsc_size(lv_draw_task_type_t type);
 static lv_draw_task_t * get_first_available_task(lv_layer_t * layer);
+static void * pool_alloc(void ** list, size_t size);
+static void pool_free(void ** list, void * block);
+static void ** get_task_pool(size_t * size);
+static void pool_release(void);
 
 #if LV_LOG_LEVEL <= LV_LOG_LEVEL_INFO
 static inline uint32_t get_layer_size_kb(uint32_t size_byte)
@@ -63,6 +67,9 @@ void lv_draw_init(void)
 #if LV_USE_OS
     lv_thread_sync_init(&_draw_info.sync);
 #endif
+#if LV_DRAW_TASK_POOL_SIZE
+    _draw_info.pool_max = LV_DRAW_TASK_POOL_SIZE;
+#endif
 }
 
 void lv_draw_deinit(void)
@@ -80,7 +87,17 @@ void lv_draw_deinit(void)
         lv_free(cur_unit);
     }
     _draw_info.unit_head = NULL;
+
+    pool_release();
+}
+
+#if LV_DRAW_TASK_POOL_SIZE
+void lv_draw_set_task_pool_size(uint32_t max)
+{
+    _draw_info.pool_max = max;
+    if(_draw_info.pool_cnt > max) pool_release();
 }
+#endif
 
 void * lv_draw_create_unit(size_t size)
 {
@@ -101,7 +118,8 @@ lv_draw_task_t * lv_draw_add_task(lv_layer_t * layer, const lv_area_t * coords,
     LV_PROFILER_DRAW_BEGIN;
     size_t dsc_size = get_draw_dsc_size(type);
     LV_ASSERT_FORMAT_MSG(dsc_size > 0, "Draw task size is 0 for type %d", type);
-    lv_draw_task_t * new_task = lv_malloc_zeroed(LV_ALIGN_UP(sizeof(lv_draw_task_t), 8) + dsc_size);
+    size_t task_size = LV_ALIGN_UP(sizeof(lv_draw_task_t), 8) + dsc_size;
+    lv_draw_task_t * new_task = pool_alloc(get_task_pool(&task_size), task_size);
     LV_ASSERT_MALLOC(new_task);
     new_task->area = *coords;
     new_task->_real_area = *coords;
@@ -404,7 +422,11 @@ void lv_layer_reset(lv_layer_t * layer)
 lv_layer_t * lv_draw_layer_create(lv_layer_t * parent_layer, lv_color_format_t color_format, const lv_area_t * area)
 {
     LV_PROFILER_DRAW_BEGIN;
-    lv_layer_t * new_layer = lv_malloc_zeroed(sizeof(lv_layer_t));
+#if LV_DRAW_TASK_POOL_SIZE
+    lv_layer_t * new_layer = pool_alloc(&_draw_info.layer_pool, sizeof(lv_layer_t));
+#else
+    lv_layer_t * new_layer = pool_alloc(NULL, sizeof(lv_layer_t));
+#endif
     LV_ASSERT_MALLOC(new_layer);
     if(new_layer == NULL) {
         LV_PROFILER_DRAW_END;
@@ -640,7 +662,11 @@ static void cleanup_task(lv_draw_task_t * t, lv_display_t * disp)
                 disp->layer_deinit(disp, layer_drawn);
                 LV_PROFILER_DRAW_END_TAG("layer_deinit");
             }
+#if LV_DRAW_TASK_POOL_SIZE
+            pool_free(&_draw_info.layer_pool, layer_drawn);
+#else
             lv_free(layer_drawn);
+#endif
         }
     }
     lv_draw_label_dsc_t * draw_label_dsc = lv_draw_task_get_label_dsc(t);
@@ -649,10 +675,90 @@ static void cleanup_task(lv_draw_task_t * t, lv_display_t * disp)
         draw_label_dsc->text = NULL;
     }
 
-    lv_free(t);
+    size_t task_size = LV_ALIGN_UP(sizeof(lv_draw_task_t), 8) + get_draw_dsc_size(t->type);
+    pool_free(get_task_pool(&task_size), t);
     LV_PROFILER_DRAW_END;
 }
 
+/**
+ * Get the free list of draw tasks of a given size
+ * @param size      size of the task with its descriptor, rounded up to the size of its class
+ * @return          pointer to the free list or NULL if tasks of this size are not pooled
+ */
+static void ** get_task_pool(size_t * size)
+{
+#if LV_DRAW_TASK_POOL_SIZE
+    size_t cls = (*size - 1) / LV_DRAW_TASK_POOL_GRANULE;
+    if(cls >= LV_DRAW_TASK_POOL_CLASSES) return NULL;
+    *size = (cls + 1) * LV_DRAW_TASK_POOL_GRANULE;
+    return &_draw_info.task_pool[cls];
+#else
+    LV_UNUSED(size);
+    return NULL;
+#endif
+}
+
+/**
+ * Take a zeroed block from a free list or allocate a new one
+ * @param list      free list of blocks of `size` bytes or NULL
+ * @param size      size of the block
+ * @return          the block
+ */
+static void * pool_alloc(void ** list, size_t size)
+{
+#if LV_DRAW_TASK_POOL_SIZE
+    if(list && *list) {
+        void * block = *list;
+        *list = *(void **)block;
+        _draw_info.pool_cnt--;
+        lv_memzero(block, size);
+        return block;
+    }
+#else
+    LV_UNUSED(list);
+#endif
+    return lv_malloc_zeroed(size);
+}
+
+/**
+ * Put a block back to its free list, or free it if the pool is full
+ * @param list      free list of the block or NULL
+ * @param block     the block to release
+ */
+static void pool_free(void ** list, void * block)
+{
+#if LV_DRAW_TASK_POOL_SIZE
+    if(list && _draw_info.pool_cnt < _draw_info.pool_max) {
+        *(void **)block = *list;
+        *list = block;
+        _draw_info.pool_cnt++;
+        return;
+    }
+#else
+    LV_UNUSED(list);
+#endif
+    lv_free(block);
+}
+
+/**
+ * Free all pooled blocks
+ */
+static void pool_release(void)
+{
+#if LV_DRAW_TASK_POOL_SIZE
+    uint32_t i;
+    for(i = 0; i <= LV_DRAW_TASK_POOL_CLASSES; i++) {
+        void ** list = i < LV_DRAW_TASK_POOL_CLASSES ? &_draw_info.task_pool[i] : &_draw_info.layer_pool;
+        while(*list) {
+            void * block = *list;
+            *list = *(void **)block;
+            lv_free(block);
+        }
+    }
+    _draw_info.pool_cnt = 0;
+#endif
+}
+
 static lv_draw_task_t * get_first_available_task(lv_layer_t * layer)
 {
     LV_PROFILER_DRAW_BEGIN;
@@ -158,6 +158,16 @@ void lv_draw_init(void);
  */
 void lv_draw_deinit(void);
 
+#if LV_DRAW_TASK_POOL_SIZE
+/**
+ * Set how many released draw tasks and layers are kept for reuse.
+ * The pooled blocks are freed if the pool holds more than the new limit.
+ * @param max       maximum number of pooled blocks, 0 to allocate every task.
+ *                  `LV_DRAW_TASK_POOL_SIZE` is used until this is called.
+ */
+void lv_draw_set_task_pool_size(uint32_t max);
+#endif
+
 /**
  * Allocate a new draw unit with the given size and appends it to the list of draw units
  * @param size      the size to allocate. E.g. `sizeof(my_draw_unit_t)`,
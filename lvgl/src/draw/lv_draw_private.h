@@ -173,10 +173,22 @@ struct _lv_draw_unit_t {
     int32_t (*delete_cb)(lv_draw_unit_t * draw_unit);
 };
 
+/** Draw tasks are pooled in size classes of this many bytes*/
+#define LV_DRAW_TASK_POOL_GRANULE 32
+
+/** Draw tasks up to `LV_DRAW_TASK_POOL_CLASSES * LV_DRAW_TASK_POOL_GRANULE` bytes are pooled*/
+#define LV_DRAW_TASK_POOL_CLASSES 16
+
 typedef struct {
     lv_draw_unit_t * unit_head;
     uint32_t unit_cnt;
     uint32_t used_memory_for_layers; /* measured as bytes */
+#if LV_DRAW_TASK_POOL_SIZE
+    void * task_pool[LV_DRAW_TASK_POOL_CLASSES];  /* Free lists of released draw tasks, per size class */
+    void * layer_pool;                            /* Free list of released layers */
+    uint32_t pool_cnt;                            /* Number of blocks in the free lists */
+    uint32_t pool_max;                            /* Blocks kept at most, see `lv_draw_set_task_pool_size()` */
+#endif
 #if LV_USE_OS
     lv_thread_sync_t sync;
 #else
@@ -34,6 +34,23 @@ extern "C" {
  *      DEFINES
  *********************/
 
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+#if LV_DRAW_SW_TRANSFORM_CACHE_SIZE > 0
+/**
+ * Statistics of the transformed image cache
+ */
+typedef struct {
+    uint32_t hits;          /**< Transformed draws served from the cache */
+    uint32_t misses;        /**< Transformed draws of cacheable images which had to be computed */
+    uint32_t evictions;     /**< Entries dropped to make room for a new one */
+    uint32_t size;          /**< Bytes in use */
+    uint32_t entry_cnt;     /**< Entries in use */
+} lv_draw_sw_transform_cache_info_t;
+#endif
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -146,6 +163,22 @@ void lv_draw_sw_transform(const lv_area_t * dest_area, const void * src_buf,
                           int32_t src_w, int32_t src_h, int32_t src_stride,
                           const lv_draw_image_dsc_t * draw_dsc, const lv_draw_image_sup_t * sup, lv_color_format_t cf, void * dest_buf);
 
+#if LV_DRAW_SW_TRANSFORM_CACHE_SIZE > 0
+/**
+ * Drop the cached transformations of an image.
+ * Call it after changing the pixels of an image which is drawn scaled or rotated.
+ * `lv_image_cache_drop()` calls it too.
+ * @param src           the image source as passed to `lv_image_set_src()`, NULL to drop everything
+ */
+void lv_draw_sw_transform_cache_drop(const void * src);
+
+/**
+ * Get the hit and miss counters and the memory use of the transformed image cache.
+ * @param info          the statistics are stored here
+ */
+void lv_draw_sw_transform_cache_get_info(lv_draw_sw_transform_cache_info_t * info);
+#endif
+
 #if LV_USE_VECTOR_GRAPHIC && LV_USE_THORVG
 /**
  * Draw vector graphics with SW render.
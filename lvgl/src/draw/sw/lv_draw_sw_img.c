@@ -82,10 +82,19 @@ static void recolor(lv_area_t relative_area, uint8_t * src_buf, uint8_t * dest_b
 
 static bool apply_mask(const lv_draw_image_dsc_t * draw_dsc);
 
+#if LV_DRAW_SW_TRANSFORM_CACHE_SIZE > 0
+static bool transform_cache_draw(lv_draw_task_t * t, const lv_draw_image_dsc_t * draw_dsc,
+                                 const lv_image_decoder_dsc_t * decoder_dsc, lv_draw_image_sup_t * sup,
+                                 const lv_area_t * img_coords, const lv_area_t * clipped_img_area);
+#endif
+
 /**********************
  *  STATIC VARIABLES
  **********************/
 #define _draw_info LV_GLOBAL_DEFAULT()->draw_info
+#if LV_DRAW_SW_TRANSFORM_CACHE_SIZE > 0
+    #define transform_cache LV_GLOBAL_DEFAULT()->sw_transform_cache
+#endif
 
 /**********************
  *      MACROS
@@ -203,10 +212,214 @@ void lv_draw_sw_image(lv_draw_task_t * t, const lv_draw_image_dsc_t * draw_dsc,
     }
 }
 
+#if LV_DRAW_SW_TRANSFORM_CACHE_SIZE > 0
+void lv_draw_sw_transform_cache_drop(const void * src)
+{
+    lv_mutex_lock(&transform_cache.lock);
+    uint32_t i;
+    for(i = 0; i < LV_DRAW_SW_TRANSFORM_CACHE_ENTRIES; i++) {
+        lv_draw_sw_transform_cache_entry_t * entry = &transform_cache.entries[i];
+        if(entry->buf == NULL) continue;
+        if(src != NULL && entry->key.src != src) continue;
+
+        lv_free(entry->buf);
+        transform_cache.info.size -= entry->size;
+        transform_cache.info.entry_cnt--;
+        lv_memzero(entry, sizeof(*entry));
+    }
+    if(src == NULL) {
+        lv_memzero(transform_cache.candidates, sizeof(transform_cache.candidates));
+    }
+    lv_mutex_unlock(&transform_cache.lock);
+}
+
+void lv_draw_sw_transform_cache_get_info(lv_draw_sw_transform_cache_info_t * info)
+{
+    lv_mutex_lock(&transform_cache.lock);
+    *info = transform_cache.info;
+    lv_mutex_unlock(&transform_cache.lock);
+}
+#endif
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
 
+#if LV_DRAW_SW_TRANSFORM_CACHE_SIZE > 0
+static uint32_t transform_key_hash(const lv_draw_sw_transform_key_t * key)
+{
+    /*FNV-1a, 0 marks an unused candidate slot*/
+    const uint8_t * p = (const uint8_t *)key;
+    uint32_t hash = 2166136261u;
+    uint32_t i;
+    for(i = 0; i < sizeof(*key); i++) {
+        hash = (hash ^ p[i]) * 16777619u;
+    }
+    return hash ? hash : 1;
+}
+
+/**
+ * Evict the entry with the lowest priority (GreedyDual-Size-Frequency).
+ * A hit raises the priority of an entry by its value, evicting raises the base of all later priorities,
+ * so entries which are cheap to recompute for their size or not used any more go first.
+ */
+static void transform_cache_evict(void)
+{
+    lv_draw_sw_transform_cache_entry_t * victim = NULL;
+    uint32_t i;
+    for(i = 0; i < LV_DRAW_SW_TRANSFORM_CACHE_ENTRIES; i++) {
+        lv_draw_sw_transform_cache_entry_t * entry = &transform_cache.entries[i];
+        if(entry->buf && (victim == NULL || entry->priority < victim->priority)) victim = entry;
+    }
+    if(victim == NULL) return;
+
+    transform_cache.inflation = victim->priority;
+    lv_free(victim->buf);
+    transform_cache.info.size -= victim->size;
+    transform_cache.info.entry_cnt--;
+    transform_cache.info.evictions++;
+    lv_memzero(victim, sizeof(*victim));
+}
+
+/**
+ * Compute the transformed image into a new cache entry.
+ * @return the new entry or NULL if the image is drawn with these parameters for the first time
+ *         or does not fit into the budget
+ */
+static lv_draw_sw_transform_cache_entry_t * transform_cache_add(const lv_draw_sw_transform_key_t * key,
+                                                                const lv_draw_image_dsc_t * draw_dsc,
+                                                                const lv_image_decoder_dsc_t * decoder_dsc,
+                                                                lv_draw_image_sup_t * sup)
+{
+    const lv_draw_buf_t * decoded = decoder_dsc->decoded;
+    int32_t src_w = decoded->header.w;
+    int32_t src_h = decoded->header.h;
+
+    lv_area_t area;
+    lv_image_buf_get_transformed_area(&area, src_w, src_h, draw_dsc->rotation, draw_dsc->scale_x, draw_dsc->scale_y,
+                                      &draw_dsc->pivot);
+    uint32_t px_cnt = lv_area_get_size(&area);
+    uint32_t size = px_cnt * lv_color_format_get_size(LV_COLOR_FORMAT_ARGB8888);
+    if(px_cnt == 0 || size > LV_DRAW_SW_TRANSFORM_CACHE_SIZE) return NULL;
+
+    /*Animated transformations change on every frame, so only cache what is drawn a second time*/
+    uint32_t hash = transform_key_hash(key);
+    uint32_t i;
+    for(i = 0; i < LV_DRAW_SW_TRANSFORM_CACHE_ENTRIES; i++) {
+        if(transform_cache.candidates[i] == hash) break;
+    }
+    if(i == LV_DRAW_SW_TRANSFORM_CACHE_ENTRIES) {
+        transform_cache.candidates[transform_cache.candidate_idx] = hash;
+        transform_cache.candidate_idx = (transform_cache.candidate_idx + 1) % LV_DRAW_SW_TRANSFORM_CACHE_ENTRIES;
+        return NULL;
+    }
+    transform_cache.candidates[i] = 0;
+
+    lv_draw_sw_transform_cache_entry_t * entry = NULL;
+    while(true) {
+        for(i = 0; i < LV_DRAW_SW_TRANSFORM_CACHE_ENTRIES && entry == NULL; i++) {
+            if(transform_cache.entries[i].buf == NULL) entry = &transform_cache.entries[i];
+        }
+        if(entry && transform_cache.info.size + size <= LV_DRAW_SW_TRANSFORM_CACHE_SIZE) break;
+        entry = NULL;
+        transform_cache_evict();
+    }
+
+    entry->buf = lv_malloc(size);
+    if(entry->buf == NULL) return NULL;
+
+    lv_draw_sw_transform(&area, decoded->data, src_w, src_h, decoded->header.stride, draw_dsc, sup,
+                         decoded->header.cf, entry->buf);
+
+    /*Cost: source pixels read, antialiasing interpolates between 4 of them*/
+    uint32_t cost = px_cnt * (draw_dsc->antialias ? 4 : 1);
+    entry->key = *key;
+    entry->area = area;
+    entry->size = size;
+    entry->value = (uint32_t)(((uint64_t)cost << 8) / size);
+    entry->priority = transform_cache.inflation + entry->value;
+    entry->hits = 0;
+    transform_cache.info.size += size;
+    transform_cache.info.entry_cnt++;
+    return entry;
+}
+
+/**
+ * Draw a scaled or rotated image from the transformed image cache.
+ * @return false if the image has to be transformed as usual
+ */
+static bool transform_cache_draw(lv_draw_task_t * t, const lv_draw_image_dsc_t * draw_dsc,
+                                 const lv_image_decoder_dsc_t * decoder_dsc, lv_draw_image_sup_t * sup,
+                                 const lv_area_t * img_coords, const lv_area_t * clipped_img_area)
+{
+    const lv_draw_buf_t * decoded = decoder_dsc->decoded;
+    lv_color_format_t cf = decoded->header.cf;
+    if(cf != LV_COLOR_FORMAT_RGB888 && cf != LV_COLOR_FORMAT_XRGB8888 && cf != LV_COLOR_FORMAT_ARGB8888) return false;
+
+    /*Only constant images drawn in one piece: pixels of modifiable buffers (canvases, layers) can change
+     *under the same pointer*/
+    if(decoder_dsc->src_type != LV_IMAGE_SRC_VARIABLE) return false;
+    if(decoded->header.flags & LV_IMAGE_FLAGS_MODIFIABLE) return false;
+    if(((const lv_image_dsc_t *)draw_dsc->src)->data != decoded->data) return false;
+    if(lv_area_get_width(img_coords) != decoded->header.w || lv_area_get_height(img_coords) != decoded->header.h) return false;
+
+    lv_draw_sw_transform_key_t key;
+    lv_memzero(&key, sizeof(key));
+    key.src = draw_dsc->src;
+    key.data = decoded->data;
+    key.header = decoded->header;
+    key.rotation = draw_dsc->rotation;
+    key.scale_x = draw_dsc->scale_x;
+    key.scale_y = draw_dsc->scale_y;
+    key.pivot = draw_dsc->pivot;
+    key.antialias = draw_dsc->antialias;
+
+    lv_mutex_lock(&transform_cache.lock);
+
+    lv_draw_sw_transform_cache_entry_t * entry = NULL;
+    uint32_t i;
+    for(i = 0; i < LV_DRAW_SW_TRANSFORM_CACHE_ENTRIES; i++) {
+        lv_draw_sw_transform_cache_entry_t * e = &transform_cache.entries[i];
+        if(e->buf && lv_memcmp(&e->key, &key, sizeof(key)) == 0) {
+            entry = e;
+            break;
+        }
+    }
+
+    if(entry) {
+        transform_cache.info.hits++;
+        entry->hits++;
+        entry->priority = transform_cache.inflation + entry->value * LV_MIN(entry->hits + 1, 256);
+    }
+    else {
+        transform_cache.info.misses++;
+        entry = transform_cache_add(&key, draw_dsc, decoder_dsc, sup);
+    }
+
+    if(entry) {
+        lv_area_t area = entry->area;
+        lv_area_move(&area, img_coords->x1, img_coords->y1);
+        lv_area_t blend_area;
+        if(lv_area_intersect(&blend_area, &area, clipped_img_area)) {
+            lv_draw_sw_blend_dsc_t blend_dsc;
+            lv_memzero(&blend_dsc, sizeof(lv_draw_sw_blend_dsc_t));
+            blend_dsc.opa = draw_dsc->opa;
+            blend_dsc.blend_mode = draw_dsc->blend_mode;
+            blend_dsc.src_buf = entry->buf;
+            blend_dsc.src_area = &area;
+            blend_dsc.src_stride = lv_area_get_width(&area) * lv_color_format_get_size(LV_COLOR_FORMAT_ARGB8888);
+            blend_dsc.src_color_format = LV_COLOR_FORMAT_ARGB8888;
+            blend_dsc.blend_area = &blend_area;
+            lv_draw_sw_blend(t, &blend_dsc);
+        }
+    }
+
+    lv_mutex_unlock(&transform_cache.lock);
+    return entry != NULL;
+}
+#endif
+
+
 static void img_draw_core(lv_draw_task_t * t, const lv_draw_image_dsc_t * draw_dsc,
                           const lv_image_decoder_dsc_t * decoder_dsc, lv_draw_image_sup_t * sup,
                           const lv_area_t * img_coords, const lv_area_t * clipped_img_area)
@@ -283,6 +496,12 @@ static void img_draw_core(lv_draw_task_t * t, const lv_draw_image_dsc_t * draw_d
     else if(!transformed && radius && draw_dsc->recolor_opa <= LV_OPA_MIN) {
         radius_only(t, draw_dsc, decoder_dsc, img_coords,  clipped_img_area);
     }
+#if LV_DRAW_SW_TRANSFORM_CACHE_SIZE > 0
+    /*Scaled or rotated before with the same parameters: blit the cached result*/
+    else if(transformed && !radius && draw_dsc->recolor_opa <= LV_OPA_MIN &&
+            transform_cache_draw(t, draw_dsc, decoder_dsc, sup, img_coords, clipped_img_area)) {
+    }
+#endif
     /* check whether it is possible to accelerate the operation in synchronous mode */
     else if(LV_RESULT_INVALID == LV_DRAW_SW_IMAGE(transformed,      /* whether require transform */
                                                   cf,               /* image format */
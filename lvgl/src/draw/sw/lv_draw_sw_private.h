@@ -58,6 +58,40 @@ typedef struct {
 } lv_draw_sw_shadow_cache_t;
 #endif
 
+#if LV_DRAW_SW_TRANSFORM_CACHE_SIZE > 0
+#define LV_DRAW_SW_TRANSFORM_CACHE_ENTRIES 4
+
+typedef struct {
+    const void * src;       /**< Image source as passed to the image widget */
+    const void * data;      /**< Pixels the transformation was computed from */
+    lv_image_header_t header;
+    int32_t rotation;
+    int32_t scale_x;
+    int32_t scale_y;
+    lv_point_t pivot;
+    int32_t antialias;
+} lv_draw_sw_transform_key_t;
+
+typedef struct {
+    lv_draw_sw_transform_key_t key;
+    lv_area_t area;         /**< Transformed area relative to the top left corner of the image */
+    uint8_t * buf;          /**< ARGB8888 pixels of `area`, NULL if the entry is unused */
+    uint32_t size;          /**< Size of `buf` in bytes */
+    uint32_t value;         /**< Cost of computing the entry per byte it occupies */
+    uint32_t priority;      /**< GreedyDual priority, the entry with the lowest one is evicted first */
+    uint32_t hits;
+} lv_draw_sw_transform_cache_entry_t;
+
+typedef struct {
+    lv_draw_sw_transform_cache_entry_t entries[LV_DRAW_SW_TRANSFORM_CACHE_ENTRIES];
+    uint32_t candidates[LV_DRAW_SW_TRANSFORM_CACHE_ENTRIES]; /**< Hashes of keys drawn once, cached when drawn again */
+    uint32_t candidate_idx;
+    uint32_t inflation;     /**< Priority of the last evicted entry, ages all remaining entries */
+    lv_draw_sw_transform_cache_info_t info;
+    lv_mutex_t lock;
+} lv_draw_sw_transform_cache_t;
+#endif
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
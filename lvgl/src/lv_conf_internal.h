@@ -230,6 +230,16 @@
     #endif
 #endif  /*LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN*/
 
+/** 1: Call a hook registered with `lv_mem_set_hook()` on every allocation, reallocation and free,
+ * with the caller's return address. Used to instrument the heap. */
+#ifndef LV_USE_MEM_HOOK
+    #ifdef CONFIG_LV_USE_MEM_HOOK
+        #define LV_USE_MEM_HOOK CONFIG_LV_USE_MEM_HOOK
+    #else
+        #define LV_USE_MEM_HOOK 0
+    #endif
+#endif
+
 /*====================
    HAL SETTINGS
  *====================*/
@@ -366,6 +376,17 @@
     #endif
 #endif
 
+/** Maximum number of released draw tasks and layers kept in free lists for reuse.
+ * Every drawn object allocates a draw task each frame; reusing them saves the allocator
+ * work and keeps the heap from fragmenting. Set it to 0 to allocate every task. */
+#ifndef LV_DRAW_TASK_POOL_SIZE
+    #ifdef CONFIG_LV_DRAW_TASK_POOL_SIZE
+        #define LV_DRAW_TASK_POOL_SIZE CONFIG_LV_DRAW_TASK_POOL_SIZE
+    #else
+        #define LV_DRAW_TASK_POOL_SIZE 0
+    #endif
+#endif
+
 /** Stack size of drawing thread.
  * NOTE: If FreeType or ThorVG is enabled, it is recommended to set it to 32KB or more.
  */
@@ -589,6 +610,19 @@
         #endif
     #endif
 
+    /** Cache the results of scaling and rotating images which do not change.
+     *  Repeated draws with the same source, scale, rotation and pivot become plain blits.
+     *  LV_DRAW_SW_TRANSFORM_CACHE_SIZE is the memory budget in bytes (ARGB8888, 4 bytes per transformed pixel).
+     *  An image is cached when it is drawn with the same transformation a second time.
+     *  - 0: disables caching */
+    #ifndef LV_DRAW_SW_TRANSFORM_CACHE_SIZE
+        #ifdef CONFIG_LV_DRAW_SW_TRANSFORM_CACHE_SIZE
+            #define LV_DRAW_SW_TRANSFORM_CACHE_SIZE CONFIG_LV_DRAW_SW_TRANSFORM_CACHE_SIZE
+        #else
+            #define LV_DRAW_SW_TRANSFORM_CACHE_SIZE 0
+        #endif
+    #endif
+
     #ifndef LV_USE_DRAW_SW_ASM
         #ifdef CONFIG_LV_USE_DRAW_SW_ASM
             #define LV_USE_DRAW_SW_ASM CONFIG_LV_USE_DRAW_SW_ASM
@@ -82,6 +82,11 @@ void lv_image_cache_drop(const void * src)
     /*If user invalidate image, the header cache should be invalidated too.*/
     lv_image_header_cache_drop(src);
 
+#if LV_USE_DRAW_SW && LV_DRAW_SW_TRANSFORM_CACHE_SIZE > 0
+    /*Scaled and rotated copies of the image are stale too*/
+    lv_draw_sw_transform_cache_drop(src);
+#endif
+
     if(src == NULL) {
         lv_cache_drop_all(img_cache_p, NULL);
         return;
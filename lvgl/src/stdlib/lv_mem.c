@@ -32,6 +32,9 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static void * mem_alloc(size_t size, bool zeroed, void * caller);
+static void * mem_realloc(void * data_p, size_t new_size, void * caller);
+static void mem_free(void * data, void * caller);
 
 /**********************
  *  GLOBAL PROTOTYPES
@@ -55,42 +58,96 @@ lv_result_t lv_mem_test_core(void);
     #define LV_TRACE_MEM(...)
 #endif
 
+#if LV_USE_MEM_HOOK
+    #define mem_hook LV_GLOBAL_DEFAULT()->mem_hook_cb
+    #define MEM_HOOK(op, p, old_p, size, caller) \
+        do { if(mem_hook) mem_hook(op, p, old_p, size, caller); } while(0)
+    #if defined(__GNUC__) || defined(__clang__)
+        #define MEM_CALLER() __builtin_return_address(0)
+    #else
+        #define MEM_CALLER() NULL
+    #endif
+#else
+    #define MEM_HOOK(op, p, old_p, size, caller)
+    #define MEM_CALLER() NULL
+#endif
+
 /**********************
  *   GLOBAL FUNCTIONS
  **********************/
 
 void * lv_malloc(size_t size)
 {
-    LV_TRACE_MEM("allocating %lu bytes", (unsigned long)size);
-    if(size == 0) {
-        LV_TRACE_MEM("using zero_mem");
-        return &zero_mem;
+    return mem_alloc(size, false, MEM_CALLER());
+}
+
+void * lv_malloc_zeroed(size_t size)
+{
+    return mem_alloc(size, true, MEM_CALLER());
+}
+
+void * lv_calloc(size_t num, size_t size)
+{
+    LV_TRACE_MEM("allocating number of %zu each %zu bytes", num, size);
+    return mem_alloc(num * size, true, MEM_CALLER());
+}
+
+void * lv_zalloc(size_t size)
+{
+    return mem_alloc(size, true, MEM_CALLER());
+}
+
+void lv_free(void * data)
+{
+    mem_free(data, MEM_CALLER());
+}
+
+void * lv_reallocf(void * data_p, size_t new_size)
+{
+    void * caller = MEM_CALLER();
+    LV_UNUSED(caller);
+    void * new = mem_realloc(data_p, new_size, caller);
+    if(!new) {
+        mem_free(data_p, caller);
     }
+    return new;
+}
 
-    void * alloc = lv_malloc_core(size);
+void * lv_realloc(void * data_p, size_t new_size)
+{
+    return mem_realloc(data_p, new_size, MEM_CALLER());
+}
 
-    if(alloc == NULL) {
-        LV_LOG_INFO("couldn't allocate memory (%lu bytes)", (unsigned long)size);
-#if LV_LOG_LEVEL <= LV_LOG_LEVEL_INFO
-        lv_mem_monitor_t mon;
-        lv_mem_monitor(&mon);
-        LV_LOG_INFO("used: %zu (%3d %%), frag: %3d %%, biggest free: %zu",
-                    mon.total_size - mon.free_size, mon.used_pct, mon.frag_pct,
-                    mon.free_biggest_size);
-#endif
-        return NULL;
+lv_result_t lv_mem_test(void)
+{
+    if(zero_mem != ZERO_MEM_SENTINEL) {
+        LV_LOG_WARN("zero_mem is written");
+        return LV_RESULT_INVALID;
     }
 
-#if LV_MEM_ADD_JUNK
-    lv_memset(alloc, 0xaa, size);
-#endif
+    return lv_mem_test_core();
+}
 
-    LV_TRACE_MEM("allocated at %p", alloc);
-    return alloc;
+void lv_mem_monitor(lv_mem_monitor_t * mon_p)
+{
+    lv_memzero(mon_p, sizeof(lv_mem_monitor_t));
+    lv_mem_monitor_core(mon_p);
 }
 
-void * lv_malloc_zeroed(size_t size)
+#if LV_USE_MEM_HOOK
+void lv_mem_set_hook(lv_mem_hook_cb_t hook_cb)
 {
+    mem_hook = hook_cb;
+}
+#endif
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void * mem_alloc(size_t size, bool zeroed, void * caller)
+{
+    LV_UNUSED(caller);
     LV_TRACE_MEM("allocating %lu bytes", (unsigned long)size);
     if(size == 0) {
         LV_TRACE_MEM("using zero_mem");
@@ -98,6 +155,8 @@ void * lv_malloc_zeroed(size_t size)
     }
 
     void * alloc = lv_malloc_core(size);
+    MEM_HOOK(LV_MEM_HOOK_ALLOC, alloc, NULL, size, caller);
+
     if(alloc == NULL) {
         LV_LOG_INFO("couldn't allocate memory (%lu bytes)", (unsigned long)size);
 #if LV_LOG_LEVEL <= LV_LOG_LEVEL_INFO
@@ -110,53 +169,33 @@ void * lv_malloc_zeroed(size_t size)
         return NULL;
     }
 
-    lv_memzero(alloc, size);
+    if(zeroed) {
+        lv_memzero(alloc, size);
+    }
+#if LV_MEM_ADD_JUNK
+    else {
+        lv_memset(alloc, 0xaa, size);
+    }
+#endif
 
     LV_TRACE_MEM("allocated at %p", alloc);
     return alloc;
 }
 
-void * lv_calloc(size_t num, size_t size)
-{
-    LV_TRACE_MEM("allocating number of %zu each %zu bytes", num, size);
-    return lv_malloc_zeroed(num * size);
-}
-
-void * lv_zalloc(size_t size)
-{
-    return lv_malloc_zeroed(size);
-}
-
-void lv_free(void * data)
-{
-    LV_TRACE_MEM("freeing %p", data);
-    if(data == &zero_mem) return;
-    if(data == NULL) return;
-
-    lv_free_core(data);
-}
-
-void * lv_reallocf(void * data_p, size_t new_size)
-{
-    void * new = lv_realloc(data_p, new_size);
-    if(!new) {
-        lv_free(data_p);
-    }
-    return new;
-}
-
-void * lv_realloc(void * data_p, size_t new_size)
+static void * mem_realloc(void * data_p, size_t new_size, void * caller)
 {
+    LV_UNUSED(caller);
     LV_TRACE_MEM("reallocating %p with %lu size", data_p, (unsigned long)new_size);
     if(new_size == 0) {
         LV_TRACE_MEM("using zero_mem");
-        lv_free(data_p);
+        mem_free(data_p, caller);
         return &zero_mem;
     }
 
-    if(data_p == &zero_mem) return lv_malloc(new_size);
+    if(data_p == &zero_mem) return mem_alloc(new_size, false, caller);
 
     void * new_p = lv_realloc_core(data_p, new_size);
+    MEM_HOOK(LV_MEM_HOOK_REALLOC, new_p, data_p, new_size, caller);
 
     if(new_p == NULL) {
         LV_LOG_ERROR("couldn't reallocate memory");
@@ -167,22 +206,13 @@ void * lv_realloc(void * data_p, size_t new_size)
     return new_p;
 }
 
-lv_result_t lv_mem_test(void)
+static void mem_free(void * data, void * caller)
 {
-    if(zero_mem != ZERO_MEM_SENTINEL) {
-        LV_LOG_WARN("zero_mem is written");
-        return LV_RESULT_INVALID;
-    }
-
-    return lv_mem_test_core();
-}
+    LV_UNUSED(caller);
+    LV_TRACE_MEM("freeing %p", data);
+    if(data == &zero_mem) return;
+    if(data == NULL) return;
 
-void lv_mem_monitor(lv_mem_monitor_t * mon_p)
-{
-    lv_memzero(mon_p, sizeof(lv_mem_monitor_t));
-    lv_mem_monitor_core(mon_p);
+    MEM_HOOK(LV_MEM_HOOK_FREE, data, NULL, 0, caller);
+    lv_free_core(data);
 }
-
-/**********************
- *   STATIC FUNCTIONS
- **********************/
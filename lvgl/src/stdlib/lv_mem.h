@@ -43,6 +43,27 @@ typedef struct {
     uint8_t frag_pct;   /**< Amount of fragmentation */
 } lv_mem_monitor_t;
 
+#if LV_USE_MEM_HOOK
+/**
+ * Heap operation reported to the memory hook.
+ */
+typedef enum {
+    LV_MEM_HOOK_ALLOC,      /**< `p` was allocated with `size` bytes, NULL on failure */
+    LV_MEM_HOOK_REALLOC,    /**< `old_p` was resized to `size` bytes at `p`, NULL on failure */
+    LV_MEM_HOOK_FREE,       /**< `p` is about to be freed */
+} lv_mem_hook_op_t;
+
+/**
+ * Called on every heap operation.
+ * @param op        the operation
+ * @param p         the new (or freed) memory
+ * @param old_p     the memory before a reallocation, NULL otherwise
+ * @param size      the requested size in bytes, 0 for free
+ * @param caller    return address into the function which called `lv_malloc()` etc., NULL if unknown
+ */
+typedef void (*lv_mem_hook_cb_t)(lv_mem_hook_op_t op, void * p, void * old_p, size_t size, void * caller);
+#endif
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -155,6 +176,15 @@ lv_result_t lv_mem_test(void);
  */
 void lv_mem_monitor(lv_mem_monitor_t * mon_p);
 
+#if LV_USE_MEM_HOOK
+/**
+ * Set a hook which is called on every allocation, reallocation and free.
+ * The hook runs in the context of the caller and must not allocate LVGL memory.
+ * @param hook_cb   the hook or NULL to remove it
+ */
+void lv_mem_set_hook(lv_mem_hook_cb_t hook_cb);
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -0,0 +1,39 @@
+#ifndef _LWIPOPTS_H
+#define _LWIPOPTS_H
+
+// lwIP configuration for pico_cyw43_arch_lwip_poll: no RTOS, the stack runs inside cyw43_arch_poll() on core 0.
+// Only UDP is needed by the network receiver (DDP and E1.31).
+
+#define NO_SYS 1
+#define LWIP_SOCKET 0
+#define LWIP_NETCONN 0
+#define MEM_LIBC_MALLOC 0
+#define MEM_ALIGNMENT 4
+#define MEM_SIZE 8000
+#define MEMP_NUM_UDP_PCB 6
+#define PBUF_POOL_SIZE 24 ///< One frame of E1.31 (25 universes for 64x64) can be in flight between two polls
+
+#define LWIP_ARP 1
+#define LWIP_ETHERNET 1
+#define LWIP_ICMP 1
+#define LWIP_RAW 0
+#define LWIP_UDP 1
+#define LWIP_TCP 0
+#define LWIP_DHCP 1
+#define LWIP_IPV4 1
+#define LWIP_IPV6 0
+#define LWIP_IGMP 1
+#define LWIP_DNS 0
+
+#define LWIP_NETIF_STATUS_CALLBACK 1
+#define LWIP_NETIF_LINK_CALLBACK 1
+#define LWIP_NETIF_HOSTNAME 1
+#define LWIP_NETIF_TX_SINGLE_PBUF 1
+#define DHCP_DOES_ARP_CHECK 0
+#define LWIP_DHCP_DOES_ACD_CHECK 0
+
+#define LWIP_CHKSUM_ALGORITHM 3
+#define LWIP_STATS 0
+#define LWIP_STATS_DISPLAY 0
+
+#endif
@@ -0,0 +1,99 @@
+#include "multiplex_map.hpp"
+
+unsigned int multiplex_stretch(Multiplex multiplex)
+{
+    return multiplex == MULTIPLEX_LINEAR ? 1 : 2;
+}
+
+// The patterns follow the multiplex mappers of https://github.com/hzeller/rpi-rgb-led-matrix
+void multiplex_map(Multiplex multiplex, unsigned int x, unsigned int y, unsigned int panel_width, unsigned int height,
+                   unsigned int &matrix_x, unsigned int &matrix_y)
+{
+    const unsigned int half = height / 2;
+    const unsigned int quarter = height / 4;
+    const bool top_stripe = (y % half) < quarter;
+
+    switch (multiplex)
+    {
+    case MULTIPLEX_STRIPE:
+        matrix_x = top_stripe ? x + panel_width : x;
+        matrix_y = (y / half) * quarter + y % quarter;
+        break;
+
+    case MULTIPLEX_CHECKERED:
+    {
+        const bool left_check = x < panel_width / 2;
+        if (top_stripe)
+        {
+            matrix_x = left_check ? x + panel_width / 2 : x + panel_width;
+        }
+        else
+        {
+            matrix_x = left_check ? x : x + panel_width / 2;
+        }
+        matrix_y = (y / half) * quarter + y % quarter;
+        break;
+    }
+
+    case MULTIPLEX_SPIRAL:
+    {
+        const unsigned int panel_quarter = panel_width / 4;
+        const unsigned int column_quarter = x / panel_quarter;
+        const unsigned int column = x % panel_quarter;
+        matrix_x = 2 * column_quarter * panel_quarter + (top_stripe ? panel_quarter - 1 - column : panel_quarter + column);
+        matrix_y = (y / half) * quarter + y % quarter;
+        break;
+    }
+
+    case MULTIPLEX_ZSTRIPE:
+    case MULTIPLEX_ZNMIRROR_ZSTRIPE:
+    {
+        const unsigned int tile_width = 8;
+        const unsigned int tile_height = 4;
+        const unsigned int even_offset = multiplex == MULTIPLEX_ZSTRIPE ? 0 : 4;
+        const unsigned int odd_offset = multiplex == MULTIPLEX_ZSTRIPE ? 8 : 4;
+        const bool odd_block = (y / tile_height) % 2;
+
+        matrix_x = x + ((x + (odd_block ? 0 : even_offset)) / tile_width) * tile_width + (odd_block ? odd_offset : 0);
+        matrix_y = y % tile_height + tile_height * (y / (tile_height * 2));
+        break;
+    }
+
+    default:
+        matrix_x = x;
+        matrix_y = y;
+        break;
+    }
+}
+
+bool build_pixel_index(uint16_t *index, unsigned int width, unsigned int height, unsigned int scan, Multiplex multiplex,
+                       unsigned int panel_width)
+{
+    if (panel_width == 0)
+    {
+        panel_width = width;
+    }
+    if (multiplex >= MULTIPLEX_COUNT || scan == 0 || width * height > 65536u || width % panel_width != 0)
+    {
+        return false;
+    }
+
+    const unsigned int stretch = multiplex_stretch(multiplex);
+    if (height != 2 * stretch * scan || (stretch > 1 && panel_width % 8 != 0))
+    {
+        return false;
+    }
+
+    const unsigned int matrix_width = width * stretch;
+    for (unsigned int y = 0; y < height; y++)
+    {
+        for (unsigned int x = 0; x < width; x++)
+        {
+            unsigned int mx, my;
+            multiplex_map(multiplex, x % panel_width, y, panel_width, height, mx, my);
+            mx += (x / panel_width) * stretch * panel_width; // Panels further down the chain
+            index[y * width + x] = my < scan ? (my * matrix_width + mx) << 1 : (((my - scan) * matrix_width + mx) << 1) + 1;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Pixel order of HUB75 panels with scan rates below 1/(height / 2) and their multiplex patterns.
+//
+// A panel with scan rate 1/scan has `scan` row addresses. For each address the two data lines
+// R0/G0/B0 and R1/G1/B1 shift in width * height / (2 * scan) pixels. On a standard panel that is
+// one display row each (scan = height / 2). Outdoor panels with lower scan rates shift two display
+// rows per address and route the shift register through them in a panel specific zig-zag.
+//
+// Like in hzeller's rpi-rgb-led-matrix, such a panel is treated as a "hardware" matrix which is
+// twice as wide and half as high as the visible panel, and the multiplex pattern maps visible
+// coordinates onto it. The hardware matrix uses the standard interleave: its upper half is
+// shifted on R0/G0/B0 (even frame buffer entries), its lower half on R1/G1/B1 (odd entries).
+// The pattern repeats on every panel of a chain: each panel occupies stretch * panel width
+// columns of the hardware matrix.
+
+/// @brief Multiplex pattern of a panel
+enum Multiplex : uint8_t
+{
+    MULTIPLEX_LINEAR,           ///< Standard panel, scan = height / 2
+    MULTIPLEX_STRIPE,           ///< Alternating rows in stripes of panel width pixels, scan = height / 4
+    MULTIPLEX_CHECKERED,        ///< Alternating half rows, scan = height / 4
+    MULTIPLEX_SPIRAL,           ///< Quarter rows, every other one reversed, scan = height / 4
+    MULTIPLEX_ZSTRIPE,          ///< Z-shaped 8 pixel stripes, scan = height / 4
+    MULTIPLEX_ZNMIRROR_ZSTRIPE, ///< Z-shaped 8 pixel stripes, shifted by 4 pixels, scan = height / 4
+    MULTIPLEX_COUNT
+};
+
+/**
+ * @brief Number of display rows shifted per row address and data line.
+ *
+ * @return 1 for MULTIPLEX_LINEAR, 2 for the other patterns.
+ */
+unsigned int multiplex_stretch(Multiplex multiplex);
+
+/**
+ * @brief Maps a visible pixel of one panel to the panel's part of the hardware matrix.
+ *
+ * @param x, y Coordinates within the panel.
+ * @param panel_width, height Panel size.
+ * @param matrix_x, matrix_y Coordinates in the hardware matrix of the panel (stretch * panel_width wide, height / stretch high).
+ */
+void multiplex_map(Multiplex multiplex, unsigned int x, unsigned int y, unsigned int panel_width, unsigned int height,
+                   unsigned int &matrix_x, unsigned int &matrix_y);
+
+/**
+ * @brief Builds the frame buffer index of every display pixel of a chain.
+ *
+ * @param index width * height entries, row-major in display order.
+ * @param width, height Size of the chain: panels of panel_width pixels side by side.
+ * @param scan Number of row addresses.
+ * @param panel_width Width of one panel, 0 if the chain is one panel.
+ * @return false if the scan rate does not match the multiplex pattern or the panel size,
+ *         or if the indices do not fit into 16 bits.
+ */
+bool build_pixel_index(uint16_t *index, unsigned int width, unsigned int height, unsigned int scan, Multiplex multiplex,
+                       unsigned int panel_width = 0);
@@ -0,0 +1,118 @@
+#include <cstdio>
+
+#include "pico/cyw43_arch.h"
+#include "lwip/netif.h"
+
+#include "network_receiver.hpp"
+
+bool NetworkReceiver::start(const char *ssid, const char *password)
+{
+    if (cyw43_arch_init())
+    {
+        printf("cyw43_arch_init failed\n");
+        return false;
+    }
+    cyw43_arch_enable_sta_mode();
+
+    if (cyw43_arch_wifi_connect_async(ssid, password, CYW43_AUTH_WPA2_AES_PSK))
+    {
+        printf("Failed to start connecting to %s\n", ssid);
+        return false;
+    }
+
+    ddp_pcb = udp_new();
+    e131_pcb = udp_new();
+    if (ddp_pcb == nullptr || e131_pcb == nullptr)
+    {
+        printf("udp_new failed\n");
+        return false;
+    }
+    udp_bind(ddp_pcb, IP_ADDR_ANY, DDP_PORT);
+    udp_bind(e131_pcb, IP_ADDR_ANY, E131_PORT);
+    udp_recv(ddp_pcb, on_ddp, this);
+    udp_recv(e131_pcb, on_e131, this);
+
+    started = true;
+    return true;
+}
+
+/**
+ * @brief Hands a datagram to the frame assembler.
+ *
+ * Datagrams are normally contained in a single pbuf. A chained pbuf is flattened into a
+ * stack buffer first.
+ */
+void NetworkReceiver::receive(FrameAssembler &assembler, pbuf *p, bool ddp)
+{
+    const uint8_t *data = static_cast<const uint8_t *>(p->payload);
+    uint8_t flat[1500];
+    if (p->next != nullptr)
+    {
+        if (p->tot_len > sizeof(flat))
+        {
+            return;
+        }
+        pbuf_copy_partial(p, flat, p->tot_len, 0);
+        data = flat;
+    }
+
+    if (ddp)
+    {
+        assembler.on_ddp(data, p->tot_len);
+    }
+    else
+    {
+        assembler.on_e131(data, p->tot_len);
+    }
+}
+
+void NetworkReceiver::on_ddp(void *arg, udp_pcb *pcb, pbuf *p, const ip_addr_t *addr, u16_t port)
+{
+    receive(static_cast<NetworkReceiver *>(arg)->assembler, p, true);
+    pbuf_free(p);
+}
+
+void NetworkReceiver::on_e131(void *arg, udp_pcb *pcb, pbuf *p, const ip_addr_t *addr, u16_t port)
+{
+    receive(static_cast<NetworkReceiver *>(arg)->assembler, p, false);
+    pbuf_free(p);
+}
+
+const uint8_t *NetworkReceiver::poll(uint32_t now_ms)
+{
+    if (!started)
+    {
+        return nullptr;
+    }
+
+    uint64_t begin = time_us_64();
+    cyw43_arch_poll(); // Runs the lwIP stack and our receive callbacks
+
+    if (!connected && cyw43_tcpip_link_status(&cyw43_state, CYW43_ITF_STA) == CYW43_LINK_UP)
+    {
+        connected = true;
+        printf("network receiver listening on %s (DDP %d, E1.31 %d)\n", ip4addr_ntoa(netif_ip4_addr(netif_list)), DDP_PORT, E131_PORT);
+    }
+
+    const uint8_t *frame = assembler.take_frame();
+    busy_us += time_us_64() - begin;
+    if (frame != nullptr)
+    {
+        last_frame_ms = now_ms;
+        frames_since++;
+    }
+    return frame;
+}
+
+void NetworkReceiver::print_stats()
+{
+    if (!started)
+    {
+        return;
+    }
+    printf("network %s: %lu frames, %lu packets rejected, %lu out of order, %lu us network processing per frame\n",
+           connected ? "up" : "down", (unsigned long)assembler.presented(), (unsigned long)assembler.rejected(),
+           (unsigned long)assembler.out_of_order(), (unsigned long)(frames_since ? busy_us / frames_since : 0));
+    busy_us = 0;
+    frames_since = 0;
+}
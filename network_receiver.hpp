@@ -0,0 +1,72 @@
+#pragma once
+
+#include "pico/stdlib.h"
+
+#include "lwip/pbuf.h"
+#include "lwip/udp.h"
+
+#include "pixel_protocol.hpp"
+
+#define NETWORK_TIMEOUT_MS 1000 ///< The network source releases the panel after this time without a frame
+
+/**
+ * @brief Receives DDP and E1.31 frames over the pico2_w radio.
+ *
+ * Wraps the platform independent FrameAssembler with lwIP UDP sockets. lwIP runs in poll mode,
+ * so packets are only processed inside poll() on the main loop and need no locking.
+ * The time spent in network processing is accumulated and reported per presented frame.
+ */
+class NetworkReceiver
+{
+private:
+    FrameAssembler assembler;
+    udp_pcb *ddp_pcb = nullptr;
+    udp_pcb *e131_pcb = nullptr;
+    bool started = false;
+    bool connected = false;
+
+    uint32_t last_frame_ms = 0;
+    uint64_t busy_us = 0;     ///< Time spent in network processing since the last report
+    uint32_t frames_since = 0; ///< Frames presented since the last report
+
+    static void on_ddp(void *arg, udp_pcb *pcb, pbuf *p, const ip_addr_t *addr, u16_t port);
+    static void on_e131(void *arg, udp_pcb *pcb, pbuf *p, const ip_addr_t *addr, u16_t port);
+    static void receive(FrameAssembler &assembler, pbuf *p, bool ddp);
+
+public:
+    /**
+     * @param frame_size Size of a frame in bytes (width * height * 3).
+     * @param mapping Universe to frame offset mapping for E1.31, must stay valid.
+     * @param mapping_count Number of mapping entries.
+     */
+    NetworkReceiver(size_t frame_size, const UniverseMapping *mapping, size_t mapping_count)
+        : assembler(frame_size, mapping, mapping_count)
+    {
+    }
+
+    /**
+     * @brief Initialises the radio and starts connecting to the access point.
+     *
+     * Does not wait for the connection, so the boot is not delayed.
+     *
+     * @return false if the radio could not be initialised.
+     */
+    bool start(const char *ssid, const char *password);
+
+    /**
+     * @brief Processes pending network work.
+     *
+     * @param now_ms Current time in milliseconds.
+     * @return Pointer to a newly completed RGB888 frame or nullptr.
+     */
+    const uint8_t *poll(uint32_t now_ms);
+
+    /// @brief true while frames keep arriving - the network source owns the panel then.
+    bool active(uint32_t now_ms) const
+    {
+        return assembler.presented() != 0 && now_ms - last_frame_ms < NETWORK_TIMEOUT_MS;
+    }
+
+    /// @brief Prints frames, rejected packets and the average network processing time per frame.
+    void print_stats();
+};
@@ -0,0 +1,127 @@
+#include "lvgl/src/core/lv_obj.h"
+#include "lvgl/src/display/lv_display.h"
+#include "lvgl/src/tick/lv_tick.h"
+
+#include "particle_effect.hpp"
+#include "scene_random.hpp"
+
+// Emitter fields: x, y, spread x, spread y, velocity x, velocity y, jitter x, jitter y,
+// rate, life min, life max, intensity, fade. Velocities in 1/64 pixel per frame.
+
+// Embers rising from the bottom, buoyancy and turbulence, the heat of overlapping embers adds up
+static const ParticleEmitter fire_emitters[] = {
+    {128, 255, 200, 0, 0, -48, 24, 32, 170, 20, 45, 24, 30},
+};
+static const GradientStop fire_gradient[] = {
+    {0, 0x000000}, {40, 0x600000}, {90, 0xE02000}, {150, 0xFF8000}, {210, 0xFFE040}, {255, 0xFFFFFF},
+};
+
+// Flakes drifting down in the wind, two layers of different size and speed
+static const ParticleEmitter snow_emitters[] = {
+    {128, 0, 255, 0, 10, 12, 8, 6, 4, 200, 255, 90, 0},
+    {128, 0, 255, 0, 10, 24, 8, 8, 3, 160, 255, 160, 0},
+};
+static const GradientStop snow_gradient[] = {
+    {0, 0x000010}, {60, 0x304070}, {150, 0xB0C8FF}, {255, 0xFFFFFF},
+};
+
+// Bursts from two points with gravity and bounces, the buffer decays for trails
+static const ParticleEmitter spark_emitters[] = {
+    {80, 96, 8, 8, 0, -96, 256, 192, 40, 30, 70, 40, 25},
+    {176, 128, 8, 8, 0, -80, 256, 192, 40, 30, 70, 40, 25},
+};
+static const GradientStop spark_gradient[] = {
+    {0, 0x000000}, {30, 0x200800}, {100, 0xFF6000}, {180, 0xFFD080}, {255, 0xFFFFFF},
+};
+
+// Four colours falling from the top. Each emitter's intensity hits its own flat palette band,
+// overlapping pieces saturate towards white
+static const ParticleEmitter confetti_emitters[] = {
+    {128, 0, 255, 0, 0, 14, 24, 12, 2, 255, 255, 40, 0},
+    {128, 0, 255, 0, 0, 14, 24, 12, 2, 255, 255, 100, 0},
+    {128, 0, 255, 0, 0, 14, 24, 12, 2, 255, 255, 160, 0},
+    {128, 0, 255, 0, 0, 14, 24, 12, 2, 255, 255, 220, 0},
+};
+static const GradientStop confetti_gradient[] = {
+    {0, 0x101018}, {39, 0x101018}, {40, 0xFF2040}, {99, 0xFF2040}, {100, 0x20FF40}, {159, 0x20FF40},
+    {160, 0x3060FF}, {219, 0x3060FF}, {220, 0xFFE020}, {254, 0xFFE020}, {255, 0xFFFFFF},
+};
+
+#define COUNT_OF(a) (sizeof(a) / sizeof((a)[0]))
+
+const ParticleConfig particle_presets[PARTICLE_EFFECT_PRESETS] = {
+    {"fire", fire_emitters, COUNT_OF(fire_emitters), {0, -1, 5, 8}, fire_gradient, COUNT_OF(fire_gradient), 0, 1, false},
+    {"snow", snow_emitters, COUNT_OF(snow_emitters), {0, 1, 5, 6}, snow_gradient, COUNT_OF(snow_gradient), 0, 0, false},
+    {"sparks", spark_emitters, COUNT_OF(spark_emitters), {0, 3, 5, 0}, spark_gradient, COUNT_OF(spark_gradient), 1, 2, true},
+    {"confetti", confetti_emitters, COUNT_OF(confetti_emitters), {0, 1, 5, 8}, confetti_gradient, COUNT_OF(confetti_gradient), 0, 0, false},
+};
+
+bool ParticleEffect::create(SceneArena::Region &memory)
+{
+    data_buf = memory.allocate<uint8_t>(width * height * BYTES_PER_PIXEL);
+    if (data_buf == nullptr || !particles.create(width, height, capacity, memory))
+    {
+        printf("Failed to allocate the particle system\n");
+        return false;
+    }
+
+    lv_result_t res = lv_draw_buf_init(&draw_buf, width, height, LV_COLOR_FORMAT_RGB888, LV_STRIDE_AUTO, data_buf, width * height * BYTES_PER_PIXEL);
+    if (res != LV_RESULT_OK)
+    {
+        printf("lv_draw_buf_init failed %d\n", res);
+        return false;
+    }
+
+    screen = lv_obj_create(NULL);
+    canvas = lv_canvas_create(screen);
+    lv_canvas_set_draw_buf(canvas, &draw_buf);
+    lv_obj_center(canvas);
+
+    particles.seed(scene_random());
+    start_preset(0);
+    particles.resolve(data_buf, draw_buf.header.stride, BYTES_PER_PIXEL);
+    return true;
+}
+
+void ParticleEffect::start_preset(uint index)
+{
+    preset = index;
+    preset_start_ms = lv_tick_get();
+    frames = 0;
+    peak = 0;
+    step_us = 0;
+    resolve_us = 0;
+    particles.configure(particle_presets[index]);
+}
+
+void ParticleEffect::report() const
+{
+    if (frames == 0)
+    {
+        return;
+    }
+    printf("particles: %s, peak %lu particles, step avg %lu us, resolve avg %lu us\n", particle_presets[preset].name,
+           (unsigned long)peak, (unsigned long)(step_us / frames), (unsigned long)(resolve_us / frames));
+}
+
+void ParticleEffect::update()
+{
+    if (lv_tick_elaps(preset_start_ms) >= PARTICLE_EFFECT_PRESET_MS)
+    {
+        report();
+        start_preset((preset + 1) % PARTICLE_EFFECT_PRESETS);
+    }
+
+    uint64_t start = time_us_64();
+    particles.step();
+    uint64_t stepped = time_us_64();
+    particles.resolve(data_buf, draw_buf.header.stride, BYTES_PER_PIXEL);
+    resolve_us += time_us_64() - stepped;
+    step_us += stepped - start;
+    frames++;
+    if (particles.size() > peak)
+    {
+        peak = particles.size();
+    }
+    lv_obj_invalidate(canvas);
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstdio>
+
+#include "pico/stdlib.h"
+
+#include "lvgl/src/misc/lv_color.h"
+#include "lvgl/src/widgets/canvas/lv_canvas.h"
+
+#include "scene.hpp"
+#include "particle_system.hpp"
+
+#define PARTICLE_EFFECT_PRESET_MS 3750 ///< Time per preset, the four presets share the scene's 15 s
+#define PARTICLE_EFFECT_PRESETS 4      ///< Fire, snow, sparks and confetti
+
+#define BYTES_PER_PIXEL (LV_COLOR_FORMAT_GET_SIZE(LV_COLOR_FORMAT_RGB888))
+
+/// @brief The presets the scene cycles through, also run by the host benchmark
+extern const ParticleConfig particle_presets[PARTICLE_EFFECT_PRESETS];
+
+/**
+ * @brief Fire, snow, sparks and confetti from one ParticleSystem.
+ *
+ * The presets are ParticleConfig data in particle_effect.cpp. Each frame the system is
+ * stepped and its accumulation buffer resolved into an RGB888 canvas in the scene arena.
+ * Peak particles and the average step and resolve time are printed per preset.
+ */
+class ParticleEffect : public Scene
+{
+private:
+    uint capacity;
+    uint width, height;
+
+    ParticleSystem particles;
+    lv_obj_t *canvas = nullptr;
+    lv_draw_buf_t draw_buf;
+    uint8_t *data_buf = nullptr;
+    uint preset = 0;
+    uint32_t preset_start_ms = 0;
+
+    // Statistics of the current preset
+    uint32_t frames = 0;
+    uint32_t peak = 0;
+    uint64_t step_us = 0;
+    uint64_t resolve_us = 0;
+
+    void start_preset(uint index);
+    void report() const;
+
+public:
+    explicit ParticleEffect(uint capacity = 6144, uint width = 64, uint height = 64) : capacity(capacity), width(width), height(height)
+    {
+    }
+
+    const char *name() const override
+    {
+        return "particles";
+    }
+
+    bool create(SceneArena::Region &memory) override;
+
+    void update() override;
+
+    void show() override
+    {
+        lv_screen_load_anim(screen, LV_SCR_LOAD_ANIM_FADE_IN, 1000, 0, false);
+    }
+
+    void destroy() override
+    {
+        if (screen)
+        {
+            report();
+        }
+        Scene::destroy();
+        data_buf = nullptr; // Memory is returned with the arena region
+    }
+
+    const ParticleSystem &get_particles() const
+    {
+        return particles;
+    }
+};
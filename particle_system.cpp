@@ -0,0 +1,212 @@
+#include <cstring>
+
+#include "particle_system.hpp"
+
+#define SUBPIXEL_ONE (1 << PARTICLE_SUBPIXEL_BITS)
+
+/// @brief Arena allocations are rounded up to 8 bytes
+static size_t rounded(size_t bytes)
+{
+    return (bytes + 7u) & ~static_cast<size_t>(7u);
+}
+
+size_t ParticleSystem::memory_needed(uint16_t width, uint16_t height, uint32_t capacity)
+{
+    return 4 * rounded(capacity * sizeof(int16_t)) + 2 * rounded(capacity) +
+           rounded(PARTICLE_MAX_EMITTERS * 256 * sizeof(uint16_t)) +
+           rounded(static_cast<size_t>(width) * height * sizeof(uint16_t)) + rounded(256 * sizeof(lv_color_t));
+}
+
+bool ParticleSystem::create(uint16_t width, uint16_t height, uint32_t capacity, SceneArena::Region &memory)
+{
+    pos_x = memory.allocate<int16_t>(capacity);
+    pos_y = memory.allocate<int16_t>(capacity);
+    vel_x = memory.allocate<int16_t>(capacity);
+    vel_y = memory.allocate<int16_t>(capacity);
+    life = memory.allocate<uint8_t>(capacity);
+    source = memory.allocate<uint8_t>(capacity);
+    intensity = memory.allocate<uint16_t>(PARTICLE_MAX_EMITTERS * 256);
+    accum = memory.allocate<uint16_t>(static_cast<size_t>(width) * height);
+    palette = memory.allocate<lv_color_t>(256);
+    if (pos_x == nullptr || pos_y == nullptr || vel_x == nullptr || vel_y == nullptr || life == nullptr ||
+        source == nullptr || intensity == nullptr || accum == nullptr || palette == nullptr)
+    {
+        return false;
+    }
+
+    this->width = width;
+    this->height = height;
+    this->capacity = capacity;
+    count = 0;
+    config = nullptr;
+    stats = {};
+    return true;
+}
+
+void ParticleSystem::configure(const ParticleConfig &config)
+{
+    this->config = &config;
+    count = 0;
+    memset(accum, 0, static_cast<size_t>(width) * height * sizeof(uint16_t));
+
+    // Intensity by remaining life, so fading costs one table lookup per particle
+    for (uint32_t e = 0; e < config.emitter_count && e < PARTICLE_MAX_EMITTERS; e++)
+    {
+        const ParticleEmitter &emitter = config.emitters[e];
+        uint16_t *table = intensity + e * 256;
+        for (uint32_t l = 0; l < 256; l++)
+        {
+            table[l] = l < emitter.fade ? static_cast<uint16_t>(emitter.intensity * l / emitter.fade) : emitter.intensity;
+        }
+    }
+
+    gradient_palette(config.gradient, config.gradient_count, palette);
+}
+
+void ParticleSystem::kill(uint32_t index)
+{
+    // Swap with the last particle, the order of particles does not matter for additive blending
+    count--;
+    pos_x[index] = pos_x[count];
+    pos_y[index] = pos_y[count];
+    vel_x[index] = vel_x[count];
+    vel_y[index] = vel_y[count];
+    life[index] = life[count];
+    source[index] = source[count];
+    stats.died++;
+}
+
+void ParticleSystem::spawn()
+{
+    int32_t max_x = width * SUBPIXEL_ONE - 1;
+    int32_t max_y = height * SUBPIXEL_ONE - 1;
+    for (uint32_t e = 0; e < config->emitter_count && e < PARTICLE_MAX_EMITTERS; e++)
+    {
+        const ParticleEmitter &emitter = config->emitters[e];
+        int32_t centre_x = emitter.x * max_x >> 8;
+        int32_t centre_y = emitter.y * max_y >> 8;
+        uint32_t spread_x = emitter.spread_x * max_x >> 8;
+        uint32_t spread_y = emitter.spread_y * max_y >> 8;
+        uint32_t life_range = emitter.life_max >= emitter.life_min ? emitter.life_max - emitter.life_min + 1 : 1;
+        for (uint32_t n = 0; n < emitter.rate && count < capacity; n++)
+        {
+            int32_t x = centre_x + random_spread(spread_x);
+            int32_t y = centre_y + random_spread(spread_y);
+            pos_x[count] = static_cast<int16_t>(x < 0 ? 0 : (x > max_x ? max_x : x));
+            pos_y[count] = static_cast<int16_t>(y < 0 ? 0 : (y > max_y ? max_y : y));
+            vel_x[count] = static_cast<int16_t>(emitter.vel_x + random_spread(emitter.jitter_x));
+            vel_y[count] = static_cast<int16_t>(emitter.vel_y + random_spread(emitter.jitter_y));
+            life[count] = static_cast<uint8_t>(emitter.life_min + random() % life_range);
+            source[count] = static_cast<uint8_t>(e);
+            count++;
+            stats.spawned++;
+        }
+    }
+}
+
+void ParticleSystem::step()
+{
+    stats.spawned = 0;
+    stats.died = 0;
+    if (config == nullptr)
+    {
+        return;
+    }
+    spawn();
+
+    uint32_t pixels = static_cast<uint32_t>(width) * height;
+    if (config->decay_shift == 0)
+    {
+        memset(accum, 0, pixels * sizeof(uint16_t));
+    }
+    else
+    {
+        uint32_t shift = config->decay_shift;
+        for (uint32_t i = 0; i < pixels; i++)
+        {
+            accum[i] = static_cast<uint16_t>(accum[i] - ((accum[i] + (1u << shift) - 1) >> shift)); // Rounded up, so trails reach 0
+        }
+    }
+
+    const ParticleForces forces = config->forces;
+    const int32_t limit_x = width * SUBPIXEL_ONE;
+    const int32_t limit_y = height * SUBPIXEL_ONE;
+    const bool bounce = config->bounce;
+    uint32_t i = 0;
+    while (i < count)
+    {
+        uint32_t l = life[i];
+        if (l <= 1)
+        {
+            kill(i);
+            continue;
+        }
+        l--;
+
+        int32_t vx = vel_x[i] + forces.gravity_x;
+        int32_t vy = vel_y[i] + forces.gravity_y;
+        if (forces.turbulence)
+        {
+            vx += random_spread(forces.turbulence);
+        }
+        if (forces.drag_shift)
+        {
+            vx -= vx >> forces.drag_shift;
+            vy -= vy >> forces.drag_shift;
+        }
+        int32_t x = pos_x[i] + vx;
+        int32_t y = pos_y[i] + vy;
+        if (y >= limit_y && bounce)
+        {
+            y = 2 * (limit_y - 1) - y;
+            vy = -(vy >> 1);
+        }
+        if (static_cast<uint32_t>(x) >= static_cast<uint32_t>(limit_x) || static_cast<uint32_t>(y) >= static_cast<uint32_t>(limit_y))
+        {
+            kill(i);
+            continue;
+        }
+
+        pos_x[i] = static_cast<int16_t>(x);
+        pos_y[i] = static_cast<int16_t>(y);
+        vel_x[i] = static_cast<int16_t>(vx);
+        vel_y[i] = static_cast<int16_t>(vy);
+        life[i] = static_cast<uint8_t>(l);
+
+        // Additive splat, saturating instead of wrapping around
+        uint16_t &pixel = accum[(y >> PARTICLE_SUBPIXEL_BITS) * width + (x >> PARTICLE_SUBPIXEL_BITS)];
+        uint32_t sum = pixel + intensity[source[i] * 256 + l];
+        pixel = static_cast<uint16_t>(sum > 0xFFFF ? 0xFFFF : sum);
+        i++;
+    }
+    stats.alive = count;
+}
+
+template <uint32_t PIXEL_SIZE>
+static void resolve_rows(const uint16_t *accum, const lv_color_t *palette, uint32_t shift, uint8_t *dest, uint32_t stride, uint32_t width, uint32_t height)
+{
+    for (uint32_t y = 0; y < height; y++)
+    {
+        uint8_t *p = dest + y * stride;
+        const uint16_t *row = accum + y * width;
+        for (uint32_t x = 0; x < width; x++)
+        {
+            uint32_t index = row[x] >> shift;
+            effect_put_pixel<PIXEL_SIZE>(p, palette[index > 255 ? 255 : index]);
+            p += PIXEL_SIZE;
+        }
+    }
+}
+
+void ParticleSystem::resolve(uint8_t *dest, uint32_t stride, uint32_t bytes_per_pixel) const
+{
+    uint32_t shift = config ? config->palette_shift : 0;
+    if (bytes_per_pixel == 4)
+    {
+        resolve_rows<4>(accum, palette, shift, dest, stride, width, height);
+    }
+    else
+    {
+        resolve_rows<3>(accum, palette, shift, dest, stride, width, height);
+    }
+}
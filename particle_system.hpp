@@ -0,0 +1,164 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "lvgl/src/misc/lv_color.h"
+
+#include "effect_tables.hpp"
+#include "scene_arena.hpp"
+
+// Fixed-point particle system with particle state as structure of arrays and an additive
+// brightness buffer resolved through a palette.
+
+#define PARTICLE_SUBPIXEL_BITS 6   ///< Positions and velocities in 1/64 pixel, int16 covers panels up to 511 pixels
+#define PARTICLE_MAX_EMITTERS 4    ///< Emitters per configuration
+
+/**
+ * @brief Source of new particles.
+ *
+ * Positions are in 1/256 of the panel size so configurations scale with the panel.
+ * Velocities are in 1/64 pixel per frame.
+ */
+struct ParticleEmitter
+{
+    uint8_t x, y;             ///< Centre, 0..255 across the panel
+    uint8_t spread_x;         ///< Random offset range around the centre, 0..255 of the panel width
+    uint8_t spread_y;         ///< Random offset range around the centre, 0..255 of the panel height
+    int16_t vel_x, vel_y;     ///< Mean start velocity
+    uint16_t jitter_x;        ///< Random start velocity range around the mean
+    uint16_t jitter_y;
+    uint16_t rate;            ///< New particles per frame
+    uint8_t life_min;         ///< Lifetime range in frames, 1..255
+    uint8_t life_max;
+    uint16_t intensity;       ///< Added to the accumulation buffer per particle
+    uint8_t fade;             ///< Frames before death over which the intensity fades to 0, 0 for none
+};
+
+/// @brief Forces applied to all particles once per frame, in 1/64 pixel per frame
+struct ParticleForces
+{
+    int16_t gravity_x;  ///< Constant acceleration, e.g. wind
+    int16_t gravity_y;  ///< Constant acceleration, positive is down
+    uint8_t drag_shift; ///< The velocity loses 1/2^drag_shift per frame, 0 for no drag
+    uint8_t turbulence; ///< Random horizontal acceleration range, 0 for none
+};
+
+/// @brief Complete description of an effect
+struct ParticleConfig
+{
+    const char *name;
+    const ParticleEmitter *emitters;
+    uint8_t emitter_count;     ///< At most PARTICLE_MAX_EMITTERS
+    ParticleForces forces;
+    const GradientStop *gradient; ///< Palette over the accumulated intensity
+    uint8_t gradient_count;    ///< At least 2, the first stop at index 0, the last at 255
+    uint8_t palette_shift;     ///< Palette index = accumulated intensity >> palette_shift, saturated at 255
+    uint8_t decay_shift;       ///< The buffer keeps all but 1/2^decay_shift of the previous frame (trails), 0 clears it
+    bool bounce;               ///< Particles bounce off the bottom edge instead of dying there
+};
+
+/// @brief Counters of the last step
+struct ParticleStats
+{
+    uint32_t alive;   ///< Particles after the step
+    uint32_t spawned; ///< New particles, limited by the capacity
+    uint32_t died;    ///< Particles which reached the end of their life or left the panel
+};
+
+/**
+ * @brief Particle simulation and additive renderer.
+ *
+ * step() moves and splats all particles, resolve() turns the accumulation buffer into pixels.
+ * All memory comes from a scene arena region, nothing is allocated afterwards.
+ */
+class ParticleSystem
+{
+private:
+    int16_t *pos_x = nullptr;   ///< 1/64 pixel
+    int16_t *pos_y = nullptr;
+    int16_t *vel_x = nullptr;   ///< 1/64 pixel per frame
+    int16_t *vel_y = nullptr;
+    uint8_t *life = nullptr;    ///< Remaining frames
+    uint8_t *source = nullptr;  ///< Emitter index, selects the intensity table
+    uint16_t *intensity = nullptr; ///< Per emitter: intensity by remaining life, 256 entries each
+    uint16_t *accum = nullptr;  ///< Accumulated intensity per pixel
+    lv_color_t *palette = nullptr; ///< 256 entries
+    const ParticleConfig *config = nullptr;
+    uint32_t capacity = 0;
+    uint32_t count = 0;
+    uint16_t width = 0, height = 0;
+    uint32_t random_state = 1;
+    ParticleStats stats = {};
+
+    void spawn();
+    void kill(uint32_t index);
+
+    /// @brief xorshift32, much cheaper than rand() in the inner loops
+    uint32_t random()
+    {
+        uint32_t x = random_state;
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        random_state = x;
+        return x;
+    }
+
+    /// @brief Uniform value in [-range / 2, range / 2]
+    int32_t random_spread(uint32_t range)
+    {
+        return range ? static_cast<int32_t>(random() % (range + 1)) - static_cast<int32_t>(range / 2) : 0;
+    }
+
+public:
+    /**
+     * @brief Allocates the particle state and the buffers.
+     *
+     * @param width Width of the simulated area in pixels.
+     * @param height Height of the simulated area in pixels.
+     * @param capacity Maximum number of live particles.
+     * @param memory Arena region, must stay valid while the system is used.
+     * @return false if memory could not be allocated.
+     */
+    bool create(uint16_t width, uint16_t height, uint32_t capacity, SceneArena::Region &memory);
+
+    /**
+     * @brief Switches to another effect.
+     *
+     * Removes all particles, clears the buffer and builds the palette and the intensity tables.
+     */
+    void configure(const ParticleConfig &config);
+
+    /// @brief Spawns new particles, then moves, ages and splats all of them.
+    void step();
+
+    /**
+     * @brief Converts the accumulation buffer to pixels.
+     *
+     * @param dest First pixel of the RGB888 or XRGB8888 destination.
+     * @param stride Bytes per destination row.
+     * @param bytes_per_pixel 3 or 4.
+     */
+    void resolve(uint8_t *dest, uint32_t stride, uint32_t bytes_per_pixel) const;
+
+    void seed(uint32_t value)
+    {
+        random_state = value ? value : 1;
+    }
+
+    uint32_t size() const
+    {
+        return count;
+    }
+
+    const ParticleStats &info() const
+    {
+        return stats;
+    }
+
+    /**
+     * @brief Arena memory needed by create().
+     */
+    static size_t memory_needed(uint16_t width, uint16_t height, uint32_t capacity);
+};
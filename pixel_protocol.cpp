@@ -0,0 +1,282 @@
+#include <cstring>
+
+#include "pixel_protocol.hpp"
+
+static inline uint16_t read_be16(const uint8_t *p)
+{
+    return static_cast<uint16_t>(p[0] << 8 | p[1]);
+}
+
+static inline uint32_t read_be32(const uint8_t *p)
+{
+    return static_cast<uint32_t>(p[0]) << 24 | static_cast<uint32_t>(p[1]) << 16 | static_cast<uint32_t>(p[2]) << 8 | p[3];
+}
+
+bool ddp_parse(const uint8_t *buf, size_t len, DdpPacket &packet)
+{
+    if (len < DDP_HEADER_SIZE || (buf[0] & DDP_VERSION_MASK) != DDP_VERSION_1 || (buf[0] & DDP_FLAG_QUERY))
+    {
+        return false;
+    }
+
+    size_t header = DDP_HEADER_SIZE + (buf[0] & DDP_FLAG_TIMECODE ? 4 : 0);
+    packet.flags = buf[0];
+    packet.sequence = buf[1] & 0x0f;
+    packet.offset = read_be32(buf + 4);
+    packet.length = read_be16(buf + 8);
+    packet.data = buf + header;
+
+    return len >= header + packet.length;
+}
+
+// E1.31 layout (ANSI E1.31-2018), offsets in bytes
+#define E131_ACN_ID 4
+#define E131_ROOT_VECTOR 18
+#define E131_FRAMING_VECTOR 40
+#define E131_DATA_SYNC_ADDRESS 109
+#define E131_DATA_SEQUENCE 111
+#define E131_DATA_OPTIONS 112
+#define E131_DATA_UNIVERSE 113
+#define E131_DMP_VECTOR 117
+#define E131_DMP_COUNT 123
+#define E131_DMP_START_CODE 125
+#define E131_DATA_HEADER_SIZE 126
+#define E131_SYNC_SEQUENCE 44
+#define E131_SYNC_ADDRESS 45
+#define E131_SYNC_SIZE 49
+
+#define VECTOR_ROOT_E131_DATA 0x00000004
+#define VECTOR_ROOT_E131_EXTENDED 0x00000008
+#define VECTOR_E131_DATA_PACKET 0x00000002
+#define VECTOR_E131_EXTENDED_SYNCHRONIZATION 0x00000001
+#define VECTOR_DMP_SET_PROPERTY 0x02
+
+static const uint8_t acn_packet_identifier[12] = {'A', 'S', 'C', '-', 'E', '1', '.', '1', '7', 0, 0, 0};
+
+bool e131_parse(const uint8_t *buf, size_t len, E131Packet &packet)
+{
+    if (len < E131_SYNC_SIZE || memcmp(buf + E131_ACN_ID, acn_packet_identifier, sizeof(acn_packet_identifier)) != 0)
+    {
+        return false;
+    }
+
+    uint32_t root_vector = read_be32(buf + E131_ROOT_VECTOR);
+    uint32_t framing_vector = read_be32(buf + E131_FRAMING_VECTOR);
+
+    if (root_vector == VECTOR_ROOT_E131_EXTENDED && framing_vector == VECTOR_E131_EXTENDED_SYNCHRONIZATION)
+    {
+        packet.sync = true;
+        packet.sequence = buf[E131_SYNC_SEQUENCE];
+        packet.sync_address = read_be16(buf + E131_SYNC_ADDRESS);
+        packet.universe = 0;
+        packet.options = 0;
+        packet.data = nullptr;
+        packet.length = 0;
+        return true;
+    }
+
+    if (root_vector != VECTOR_ROOT_E131_DATA || framing_vector != VECTOR_E131_DATA_PACKET || len < E131_DATA_HEADER_SIZE ||
+        buf[E131_DMP_VECTOR] != VECTOR_DMP_SET_PROPERTY || buf[E131_DMP_START_CODE] != 0)
+    {
+        return false;
+    }
+
+    uint16_t count = read_be16(buf + E131_DMP_COUNT); // Includes the start code
+    if (count == 0 || len < static_cast<size_t>(E131_DMP_START_CODE) + count)
+    {
+        return false;
+    }
+
+    packet.sync = false;
+    packet.sync_address = read_be16(buf + E131_DATA_SYNC_ADDRESS);
+    packet.sequence = buf[E131_DATA_SEQUENCE];
+    packet.options = buf[E131_DATA_OPTIONS];
+    packet.universe = read_be16(buf + E131_DATA_UNIVERSE);
+    packet.data = buf + E131_DATA_HEADER_SIZE;
+    packet.length = count - 1;
+    return true;
+}
+
+FrameAssembler::FrameAssembler(size_t frame_size, const UniverseMapping *mapping, size_t mapping_count)
+    : frame_size(frame_size), mapping(mapping), mapping_count(mapping_count)
+{
+    buffers[0] = new uint8_t[frame_size]();
+    buffers[1] = new uint8_t[frame_size]();
+    back = buffers[0];
+    front = buffers[1];
+    universe_seen = new uint32_t[(mapping_count + 31) / 32]();
+    universe_sequence = new uint8_t[mapping_count]();
+    universe_sequenced = new uint32_t[(mapping_count + 31) / 32]();
+    block_words = ((frame_size + FRAME_BLOCK_SIZE - 1) / FRAME_BLOCK_SIZE + 31) / 32;
+    block_written = new uint32_t[block_words]();
+}
+
+FrameAssembler::~FrameAssembler()
+{
+    delete[] buffers[0];
+    delete[] buffers[1];
+    delete[] universe_seen;
+    delete[] universe_sequence;
+    delete[] universe_sequenced;
+    delete[] block_written;
+}
+
+/**
+ * @brief Checks a sequence number against the last one of its source and records it.
+ *
+ * @return false if the packet is up to E131_SEQUENCE_WINDOW numbers behind and has to be dropped.
+ */
+bool FrameAssembler::in_order(uint8_t sequence, uint8_t &last, bool &valid)
+{
+    int8_t diff = static_cast<int8_t>(sequence - last);
+    if (valid && diff <= 0 && diff > -E131_SEQUENCE_WINDOW)
+    {
+        return false;
+    }
+    last = sequence;
+    valid = true;
+    return true;
+}
+
+void FrameAssembler::write(uint32_t offset, const uint8_t *data, size_t length)
+{
+    if (offset >= frame_size)
+    {
+        packets_rejected++;
+        return;
+    }
+    if (length > frame_size - offset)
+    {
+        length = frame_size - offset;
+    }
+    if (length == 0)
+    {
+        return;
+    }
+    memcpy(back + offset, data, length);
+
+    for (size_t block = offset / FRAME_BLOCK_SIZE; block <= (offset + length - 1) / FRAME_BLOCK_SIZE; block++)
+    {
+        block_written[block >> 5] |= 1u << (block & 31);
+    }
+}
+
+void FrameAssembler::present()
+{
+    uint8_t *done = back;
+    back = front;
+    front = done;
+    frame_ready = true;
+    frames_presented++;
+
+    // Senders may update only parts of a frame - the new back buffer starts from the presented content,
+    // which differs from it in the blocks written for this frame only
+    for (size_t word = 0; word < block_words; word++)
+    {
+        uint32_t bits = block_written[word];
+        while (bits != 0)
+        {
+            size_t offset = (word * 32 + __builtin_ctz(bits)) * FRAME_BLOCK_SIZE;
+            size_t length = frame_size - offset < FRAME_BLOCK_SIZE ? frame_size - offset : FRAME_BLOCK_SIZE;
+            memcpy(back + offset, front + offset, length);
+            bytes_copied += length;
+            bits &= bits - 1;
+        }
+        block_written[word] = 0;
+    }
+
+    memset(universe_seen, 0, ((mapping_count + 31) / 32) * sizeof(uint32_t));
+    universes_seen = 0;
+    pending_sync = 0;
+}
+
+void FrameAssembler::on_ddp(const uint8_t *buf, size_t len)
+{
+    DdpPacket packet;
+    if (!ddp_parse(buf, len, packet))
+    {
+        packets_rejected++;
+        return;
+    }
+    write(packet.offset, packet.data, packet.length);
+    if (packet.flags & DDP_FLAG_PUSH)
+    {
+        present();
+    }
+}
+
+void FrameAssembler::on_e131(const uint8_t *buf, size_t len)
+{
+    E131Packet packet;
+    if (!e131_parse(buf, len, packet))
+    {
+        packets_rejected++;
+        return;
+    }
+
+    if (packet.sync)
+    {
+        if (!in_order(packet.sequence, sync_sequence, sync_sequenced))
+        {
+            packets_out_of_order++;
+            return;
+        }
+        if (pending_sync != 0 && packet.sync_address == pending_sync)
+        {
+            present();
+        }
+        return;
+    }
+
+    if (packet.options & (E131_OPTION_PREVIEW | E131_OPTION_TERMINATED))
+    {
+        return;
+    }
+
+    for (size_t i = 0; i < mapping_count; i++)
+    {
+        if (mapping[i].universe != packet.universe)
+        {
+            continue;
+        }
+
+        uint32_t bit = 1u << (i & 31);
+        bool sequenced = universe_sequenced[i >> 5] & bit;
+        if (!in_order(packet.sequence, universe_sequence[i], sequenced))
+        {
+            packets_out_of_order++; // A late packet of an older frame
+            return;
+        }
+        universe_sequenced[i >> 5] |= bit;
+
+        write(mapping[i].offset, packet.data, packet.length < E131_CHANNELS_PER_UNIVERSE ? packet.length : E131_CHANNELS_PER_UNIVERSE);
+
+        if (packet.sync_address != 0)
+        {
+            pending_sync = packet.sync_address; // The sender will tell when the frame is complete
+            return;
+        }
+
+        if (!(universe_seen[i >> 5] & bit))
+        {
+            universe_seen[i >> 5] |= bit;
+            if (++universes_seen == mapping_count)
+            {
+                present();
+            }
+        }
+        return;
+    }
+
+    packets_rejected++; // Universe not mapped
+}
+
+const uint8_t *FrameAssembler::take_frame()
+{
+    if (!frame_ready)
+    {
+        return nullptr;
+    }
+    frame_ready = false;
+    return front;
+}
@@ -0,0 +1,160 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Parsing of the DDP and E1.31 (sACN) pixel protocols and assembly of multi-packet frames.
+
+#define DDP_PORT 4048
+#define E131_PORT 5568
+
+#define DDP_FLAG_PUSH 0x01
+#define DDP_FLAG_QUERY 0x08
+#define DDP_FLAG_TIMECODE 0x10
+#define DDP_VERSION_MASK 0xc0
+#define DDP_VERSION_1 0x40
+#define DDP_HEADER_SIZE 10
+
+#define E131_CHANNELS_PER_UNIVERSE 510 ///< 170 RGB pixels, the last two DMX channels stay unused
+#define E131_OPTION_PREVIEW 0x80
+#define E131_OPTION_TERMINATED 0x40
+#define E131_SEQUENCE_WINDOW 20 ///< A packet up to this many sequence numbers behind the last one is out of order (E1.31 6.7.2)
+
+#define FRAME_BLOCK_SIZE 256 ///< Granularity in bytes at which written parts of a frame are tracked
+
+/// @brief Pixel data extracted from a DDP packet
+struct DdpPacket
+{
+    uint8_t flags;
+    uint8_t sequence;
+    uint32_t offset; ///< Byte offset into the frame
+    const uint8_t *data;
+    uint16_t length;
+};
+
+/// @brief Pixel data or synchronisation extracted from an E1.31 packet
+struct E131Packet
+{
+    bool sync;             ///< Universe synchronisation packet, no data
+    uint16_t universe;     ///< Universe of a data packet
+    uint16_t sync_address; ///< Data: universe the sender will synchronise on (0 = none), sync: the sync universe
+    uint8_t sequence;
+    uint8_t options;
+    const uint8_t *data; ///< DMX slots after the start code
+    uint16_t length;
+};
+
+/**
+ * @brief Parses a DDP datagram.
+ *
+ * @return false if it is not a valid DDP version 1 data packet.
+ */
+bool ddp_parse(const uint8_t *buf, size_t len, DdpPacket &packet);
+
+/**
+ * @brief Parses an E1.31 data or universe synchronisation datagram.
+ *
+ * @return false if it is neither.
+ */
+bool e131_parse(const uint8_t *buf, size_t len, E131Packet &packet);
+
+/// @brief Byte offset of a universe in the frame
+struct UniverseMapping
+{
+    uint16_t universe;
+    uint32_t offset;
+};
+
+/**
+ * @brief Assembles RGB888 frames from DDP and E1.31 packets and presents them atomically.
+ *
+ * Packets are written into a back buffer. A frame is presented by swapping back and front
+ * buffer when it is complete: on a DDP packet with the push flag, on an E1.31 sync packet
+ * for the announced sync universe, or - for unsynchronised E1.31 - once every mapped
+ * universe has been received. The consumer only ever sees whole frames.
+ *
+ * Senders may update only parts of a frame, so the new back buffer has to start from the
+ * presented content. Only the blocks written since the last presentation differ between the
+ * buffers and are copied, not the whole frame. E1.31 packets arriving out of order (behind the
+ * last sequence number of their universe) are dropped, so a late packet of an older frame
+ * neither overwrites newer data nor completes a frame early.
+ */
+class FrameAssembler
+{
+private:
+    size_t frame_size;
+    uint8_t *buffers[2];
+    uint8_t *back;
+    uint8_t *front;
+    bool frame_ready = false;
+
+    const UniverseMapping *mapping;
+    size_t mapping_count;
+    uint32_t *universe_seen; ///< Bitmap of mapped universes received since the last presentation
+    size_t universes_seen = 0;
+    uint16_t pending_sync = 0;
+    uint8_t *universe_sequence;   ///< Last sequence number per mapped universe
+    uint32_t *universe_sequenced; ///< Bitmap of mapped universes with a sequence number
+    uint8_t sync_sequence = 0;    ///< Last sequence number of a sync packet
+    bool sync_sequenced = false;
+
+    uint32_t *block_written; ///< Bitmap of FRAME_BLOCK_SIZE blocks written into the back buffer since the last presentation
+    size_t block_words;
+
+    uint32_t frames_presented = 0;
+    uint32_t packets_rejected = 0;
+    uint32_t packets_out_of_order = 0;
+    uint64_t bytes_copied = 0; ///< Copied by present() to bring the new back buffer up to date
+
+    static bool in_order(uint8_t sequence, uint8_t &last, bool &valid);
+
+    void write(uint32_t offset, const uint8_t *data, size_t length);
+    void present();
+
+public:
+    /**
+     * @param frame_size Size of a frame in bytes (width * height * 3).
+     * @param mapping Universe to frame offset mapping, must stay valid.
+     * @param mapping_count Number of mapping entries.
+     */
+    FrameAssembler(size_t frame_size, const UniverseMapping *mapping, size_t mapping_count);
+    ~FrameAssembler();
+
+    FrameAssembler(const FrameAssembler &) = delete;
+    FrameAssembler &operator=(const FrameAssembler &) = delete;
+
+    /// @brief Handles a datagram received on the DDP port.
+    void on_ddp(const uint8_t *buf, size_t len);
+
+    /// @brief Handles a datagram received on the E1.31 port.
+    void on_e131(const uint8_t *buf, size_t len);
+
+    /**
+     * @brief Takes the most recently presented frame.
+     *
+     * @return Pointer to the RGB888 frame, valid until the next presentation, or nullptr if there is no new frame.
+     */
+    const uint8_t *take_frame();
+
+    uint32_t presented() const
+    {
+        return frames_presented;
+    }
+
+    uint32_t rejected() const
+    {
+        return packets_rejected;
+    }
+
+    /// @brief E1.31 packets dropped because they arrived behind a newer one
+    uint32_t out_of_order() const
+    {
+        return packets_out_of_order;
+    }
+
+    /// @brief Bytes copied between the buffers at presentations, at most the bytes received
+    uint64_t copied() const
+    {
+        return bytes_copied;
+    }
+};
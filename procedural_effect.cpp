@@ -0,0 +1,282 @@
+#include <cmath>
+
+#include "procedural_effect.hpp"
+
+static const GradientStop plasma_gradient[] = {
+    {0, 0x2000A0}, {48, 0xE00080}, {96, 0xFF8000}, {144, 0xFFF060}, {192, 0x00C0A0}, {255, 0x2000A0},
+};
+
+static const GradientStop tunnel_gradient[] = {
+    {0, 0x102060}, {80, 0x4080FF}, {160, 0xA0F0FF}, {255, 0xFF60C0},
+};
+
+static const GradientStop starfield_gradient[] = {
+    {0, 0x000000}, {64, 0x181830}, {192, 0x9090C0}, {255, 0xFFFFFF},
+};
+
+bool PlasmaEffect::create(uint16_t width, uint16_t height, SceneArena::Region &memory)
+{
+    this->width = width;
+    this->height = height;
+    radius = memory.allocate<uint8_t>(static_cast<size_t>(width) * height);
+    columns = memory.allocate<int16_t>(width);
+    diagonals = memory.allocate<int16_t>(width + height);
+    palette = memory.allocate<lv_color_t>(256);
+    if (radius == nullptr || columns == nullptr || diagonals == nullptr || palette == nullptr)
+    {
+        return false;
+    }
+
+    // About two radial waves across the larger side
+    float scale = 512.0f / (width > height ? width : height);
+    for (uint32_t y = 0; y < height; y++)
+    {
+        for (uint32_t x = 0; x < width; x++)
+        {
+            float dx = x - (width - 1) / 2.0f;
+            float dy = y - (height - 1) / 2.0f;
+            radius[y * width + x] = static_cast<uint8_t>(static_cast<int32_t>(sqrtf(dx * dx + dy * dy) * scale) & 0xFF);
+        }
+    }
+    gradient_palette(plasma_gradient, sizeof(plasma_gradient) / sizeof(plasma_gradient[0]), palette);
+    return true;
+}
+
+template <uint32_t PIXEL_SIZE>
+void PlasmaEffect::render_rows(uint8_t *dest, uint32_t stride, uint32_t time_ms)
+{
+    // Wavelengths scale with the frame, phases move at different speeds
+    uint32_t step_x = 640 / width;
+    uint32_t step_y = 512 / height;
+    uint32_t step_d = 384 / (width + height);
+    uint32_t phase_x = time_ms * 3 >> 5;
+    uint32_t phase_y = time_ms >> 4;
+    uint32_t phase_d = time_ms * 5 >> 6;
+    uint32_t phase_r = time_ms >> 3;
+    uint32_t cycle = time_ms >> 5;
+
+    for (uint32_t x = 0; x < width; x++)
+    {
+        columns[x] = static_cast<int16_t>(effect_sin(x * step_x + phase_x));
+    }
+    for (uint32_t d = 0; d < static_cast<uint32_t>(width + height); d++)
+    {
+        diagonals[d] = static_cast<int16_t>(effect_sin(d * step_d + phase_d));
+    }
+
+    for (uint32_t y = 0; y < height; y++)
+    {
+        uint8_t *p = dest + y * stride;
+        int32_t row = effect_sin(y * step_y + phase_y) + 512 + 4 * cycle; // Keeps the sum positive
+        const uint8_t *r = radius + y * width;
+        const int16_t *diagonal = diagonals + y;
+        for (uint32_t x = 0; x < width; x++)
+        {
+            int32_t sum = row + columns[x] + diagonal[x] + effect_sin(r[x] - phase_r);
+            effect_put_pixel<PIXEL_SIZE>(p, palette[(sum >> 2) & 0xFF]);
+            p += PIXEL_SIZE;
+        }
+    }
+}
+
+void PlasmaEffect::render(uint8_t *dest, uint32_t stride, uint32_t bytes_per_pixel, uint32_t time_ms)
+{
+    if (bytes_per_pixel == 4)
+    {
+        render_rows<4>(dest, stride, time_ms);
+    }
+    else
+    {
+        render_rows<3>(dest, stride, time_ms);
+    }
+}
+
+bool TunnelEffect::create(uint16_t width, uint16_t height, SceneArena::Region &memory)
+{
+    this->width = width;
+    this->height = height;
+    size_t pixels = static_cast<size_t>(width) * height;
+    angle = memory.allocate<uint8_t>(pixels);
+    depth = memory.allocate<uint8_t>(pixels);
+    shade = memory.allocate<uint8_t>(pixels);
+    palette = memory.allocate<lv_color_t>(256);
+    if (angle == nullptr || depth == nullptr || shade == nullptr || palette == nullptr)
+    {
+        return false;
+    }
+
+    float size = width < height ? width : height;
+    for (uint32_t y = 0; y < height; y++)
+    {
+        for (uint32_t x = 0; x < width; x++)
+        {
+            float dx = x - (width - 1) / 2.0f;
+            float dy = y - (height - 1) / 2.0f;
+            float distance = sqrtf(dx * dx + dy * dy);
+            uint32_t i = y * width + x;
+            angle[i] = static_cast<uint8_t>(static_cast<int32_t>(atan2f(dy, dx) * (128.0f / 3.14159265f)) & 0xFF);
+            depth[i] = static_cast<uint8_t>(static_cast<int32_t>(16.0f * size / (distance + 0.5f)) & 0xFF);
+            int32_t s = static_cast<int32_t>(distance * 32.0f / size);
+            shade[i] = static_cast<uint8_t>((s > 15 ? 15 : s) << 4);
+        }
+    }
+
+    // 16 texel colours sampled from the gradient, each in 16 shades
+    gradient_palette(tunnel_gradient, sizeof(tunnel_gradient) / sizeof(tunnel_gradient[0]), palette);
+    lv_color_t texels[16];
+    for (uint32_t t = 0; t < 16; t++)
+    {
+        texels[t] = palette[t * 16 + 8];
+    }
+    for (uint32_t s = 0; s < 16; s++)
+    {
+        for (uint32_t t = 0; t < 16; t++)
+        {
+            const lv_color_t &c = texels[t];
+            palette[s << 4 | t] = lv_color_make(c.red * (s + 1) / 16, c.green * (s + 1) / 16, c.blue * (s + 1) / 16);
+        }
+    }
+    return true;
+}
+
+template <uint32_t PIXEL_SIZE>
+void TunnelEffect::render_rows(uint8_t *dest, uint32_t stride, uint32_t time_ms)
+{
+    uint32_t forward = time_ms >> 2;
+    uint32_t rotate = time_ms >> 5;
+
+    for (uint32_t y = 0; y < height; y++)
+    {
+        uint8_t *p = dest + y * stride;
+        uint32_t i = y * width;
+        for (uint32_t x = 0; x < width; x++, i++)
+        {
+            uint32_t u = depth[i] + forward;
+            uint32_t v = (angle[i] + rotate) << 1; // Two texture repeats around the tunnel
+            uint32_t texel = ((u ^ v) >> 4) & 0x0F;
+            effect_put_pixel<PIXEL_SIZE>(p, palette[shade[i] | texel]);
+            p += PIXEL_SIZE;
+        }
+    }
+}
+
+void TunnelEffect::render(uint8_t *dest, uint32_t stride, uint32_t bytes_per_pixel, uint32_t time_ms)
+{
+    if (bytes_per_pixel == 4)
+    {
+        render_rows<4>(dest, stride, time_ms);
+    }
+    else
+    {
+        render_rows<3>(dest, stride, time_ms);
+    }
+}
+
+#define STAR_DEPTH 4095 ///< Depth at which stars appear
+#define STAR_SPEED 2    ///< Depth units per millisecond
+
+/// @brief 65536 / (z / 16 + 1) by z / 16, so the projection is a multiplication
+struct StarReciprocals
+{
+    uint32_t value[256];
+
+    constexpr StarReciprocals() : value()
+    {
+        for (uint32_t i = 0; i < 256; i++)
+        {
+            value[i] = 65536 / (i + 1);
+        }
+    }
+};
+
+static constexpr StarReciprocals star_reciprocals;
+
+void StarfieldEffect::place(uint32_t index, uint16_t z)
+{
+    // xorshift32
+    uint32_t r = random_state;
+    r ^= r << 13;
+    r ^= r >> 17;
+    r ^= r << 5;
+    random_state = r;
+    star_x[index] = static_cast<int16_t>(r & 0xFFFF);
+    star_y[index] = static_cast<int16_t>(r >> 16);
+    star_z[index] = z;
+}
+
+bool StarfieldEffect::create(uint16_t width, uint16_t height, SceneArena::Region &memory)
+{
+    this->width = width;
+    this->height = height;
+    star_x = memory.allocate<int16_t>(STARFIELD_STARS);
+    star_y = memory.allocate<int16_t>(STARFIELD_STARS);
+    star_z = memory.allocate<uint16_t>(STARFIELD_STARS);
+    palette = memory.allocate<lv_color_t>(256);
+    if (star_x == nullptr || star_y == nullptr || star_z == nullptr || palette == nullptr)
+    {
+        return false;
+    }
+
+    gradient_palette(starfield_gradient, sizeof(starfield_gradient) / sizeof(starfield_gradient[0]), palette);
+    random_state = 1;
+    last_ms = 0;
+    for (uint32_t i = 0; i < STARFIELD_STARS; i++)
+    {
+        place(i, static_cast<uint16_t>(16 + i * (STAR_DEPTH - 16) / STARFIELD_STARS));
+    }
+    return true;
+}
+
+template <uint32_t PIXEL_SIZE>
+void StarfieldEffect::render_rows(uint8_t *dest, uint32_t stride, uint32_t time_ms)
+{
+    const lv_color_t background = palette[0];
+    for (uint32_t y = 0; y < height; y++)
+    {
+        uint8_t *p = dest + y * stride;
+        for (uint32_t x = 0; x < width; x++)
+        {
+            effect_put_pixel<PIXEL_SIZE>(p, background);
+            p += PIXEL_SIZE;
+        }
+    }
+
+    uint32_t advance = (time_ms - last_ms) * STAR_SPEED;
+    last_ms = time_ms;
+    int32_t centre_x = width / 2;
+    int32_t centre_y = height / 2;
+    int32_t half_size = (width > height ? width : height) / 2;
+    for (uint32_t i = 0; i < STARFIELD_STARS; i++)
+    {
+        if (star_z[i] <= advance + 16)
+        {
+            place(i, STAR_DEPTH);
+            continue;
+        }
+        uint32_t z = star_z[i] - advance;
+        star_z[i] = static_cast<uint16_t>(z);
+
+        // Offsets of up to half the frame at depth 16 shrink with 1 / depth
+        uint32_t reciprocal = star_reciprocals.value[z >> 4];
+        int32_t sx = centre_x + ((star_x[i] * half_size >> 15) * static_cast<int32_t>(reciprocal) >> 12);
+        int32_t sy = centre_y + ((star_y[i] * half_size >> 15) * static_cast<int32_t>(reciprocal) >> 12);
+        if (static_cast<uint32_t>(sx) >= width || static_cast<uint32_t>(sy) >= height)
+        {
+            place(i, STAR_DEPTH);
+            continue;
+        }
+        effect_put_pixel<PIXEL_SIZE>(dest + sy * stride + sx * PIXEL_SIZE, palette[255 - (z >> 4)]);
+    }
+}
+
+void StarfieldEffect::render(uint8_t *dest, uint32_t stride, uint32_t bytes_per_pixel, uint32_t time_ms)
+{
+    if (bytes_per_pixel == 4)
+    {
+        render_rows<4>(dest, stride, time_ms);
+    }
+    else
+    {
+        render_rows<3>(dest, stride, time_ms);
+    }
+}
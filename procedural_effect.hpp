@@ -0,0 +1,138 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "lvgl/src/misc/lv_color.h"
+
+#include "effect_tables.hpp"
+#include "scene_arena.hpp"
+
+// Procedural effects computed with integers from precomputed tables, shown by ProceduralScene.
+
+#define STARFIELD_STARS 256 ///< Stars of StarfieldEffect
+
+/**
+ * @brief Common interface of the procedural effects.
+ */
+class ProceduralEffect
+{
+public:
+    virtual ~ProceduralEffect() = default;
+
+    /// @brief Short name used in the cost report.
+    virtual const char *name() const = 0;
+
+    /**
+     * @brief Builds the tables of the effect.
+     *
+     * @param width Width of the frame in pixels.
+     * @param height Height of the frame in pixels.
+     * @param memory Arena region, valid until the effect is no longer rendered.
+     * @return false if memory could not be allocated.
+     */
+    virtual bool create(uint16_t width, uint16_t height, SceneArena::Region &memory) = 0;
+
+    /**
+     * @brief Renders the frame at a point in time.
+     *
+     * @param dest First pixel of the frame.
+     * @param stride Bytes per row.
+     * @param bytes_per_pixel 3 for RGB888, 4 for XRGB8888.
+     * @param time_ms Time since the effect started. Plasma and tunnel depend on it alone, the starfield
+     *                moves its stars by the time since the previous call (see StarfieldEffect).
+     */
+    virtual void render(uint8_t *dest, uint32_t stride, uint32_t bytes_per_pixel, uint32_t time_ms) = 0;
+};
+
+/**
+ * @brief Plasma: the sum of four sine waves through a cycling palette.
+ *
+ * Horizontal, vertical and diagonal waves are tabulated per column, row and diagonal each
+ * frame, the radial wave uses a per-pixel distance table.
+ */
+class PlasmaEffect : public ProceduralEffect
+{
+private:
+    uint16_t width = 0, height = 0;
+    uint8_t *radius = nullptr;    ///< Distance of each pixel from the centre, in 256-step angle units
+    int16_t *columns = nullptr;   ///< Per frame: horizontal wave per column
+    int16_t *diagonals = nullptr; ///< Per frame: diagonal wave per x + y
+    lv_color_t *palette = nullptr;
+
+    template <uint32_t PIXEL_SIZE>
+    void render_rows(uint8_t *dest, uint32_t stride, uint32_t time_ms);
+
+public:
+    const char *name() const override
+    {
+        return "plasma";
+    }
+
+    bool create(uint16_t width, uint16_t height, SceneArena::Region &memory) override;
+    void render(uint8_t *dest, uint32_t stride, uint32_t bytes_per_pixel, uint32_t time_ms) override;
+};
+
+/**
+ * @brief Flight through a textured tunnel.
+ *
+ * Angle, depth and shade of every pixel are tabulated once. The texture coordinate is the
+ * depth and angle moved by the time, the palette holds 16 colours in 16 shades, so a pixel is
+ * one palette lookup of shade | texel.
+ */
+class TunnelEffect : public ProceduralEffect
+{
+private:
+    uint16_t width = 0, height = 0;
+    uint8_t *angle = nullptr; ///< 256 steps around the centre
+    uint8_t *depth = nullptr; ///< Inverse distance from the centre
+    uint8_t *shade = nullptr; ///< Shade in the upper 4 bits, darker towards the centre
+    lv_color_t *palette = nullptr;
+
+    template <uint32_t PIXEL_SIZE>
+    void render_rows(uint8_t *dest, uint32_t stride, uint32_t time_ms);
+
+public:
+    const char *name() const override
+    {
+        return "tunnel";
+    }
+
+    bool create(uint16_t width, uint16_t height, SceneArena::Region &memory) override;
+    void render(uint8_t *dest, uint32_t stride, uint32_t bytes_per_pixel, uint32_t time_ms) override;
+};
+
+/**
+ * @brief Stars flying towards the viewer.
+ *
+ * The perspective division is a reciprocal table lookup, the brightness a palette lookup
+ * by depth. The frame is cleared row by row before the stars are plotted.
+ * Unlike the other effects it keeps state between frames: the star positions advance by the time
+ * since the previous render() and passed stars are replaced from its own random stream, so a frame
+ * depends on the times of all earlier calls since create().
+ */
+class StarfieldEffect : public ProceduralEffect
+{
+private:
+    uint16_t width = 0, height = 0;
+    int16_t *star_x = nullptr; ///< -32767..32767 across the field of view
+    int16_t *star_y = nullptr;
+    uint16_t *star_z = nullptr; ///< Depth, 12 bits
+    uint32_t last_ms = 0;
+    uint32_t random_state = 1;
+    lv_color_t *palette = nullptr;
+
+    void place(uint32_t index, uint16_t z);
+
+    template <uint32_t PIXEL_SIZE>
+    void render_rows(uint8_t *dest, uint32_t stride, uint32_t time_ms);
+
+public:
+    const char *name() const override
+    {
+        return "starfield";
+    }
+
+    bool create(uint16_t width, uint16_t height, SceneArena::Region &memory) override;
+    void render(uint8_t *dest, uint32_t stride, uint32_t bytes_per_pixel, uint32_t time_ms) override;
+};
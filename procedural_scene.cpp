@@ -0,0 +1,61 @@
+#include "lvgl/src/core/lv_obj.h"
+#include "lvgl/src/display/lv_display.h"
+#include "lvgl/src/tick/lv_tick.h"
+
+#include "procedural_scene.hpp"
+
+bool ProceduralScene::create(SceneArena::Region &memory)
+{
+    data_buf = memory.allocate<uint8_t>(width * height * BYTES_PER_PIXEL);
+    if (data_buf == nullptr || !effect.create(width, height, memory))
+    {
+        printf("Failed to allocate the %s effect\n", effect.name());
+        return false;
+    }
+
+    lv_result_t res = lv_draw_buf_init(&draw_buf, width, height, LV_COLOR_FORMAT_RGB888, LV_STRIDE_AUTO, data_buf, width * height * BYTES_PER_PIXEL);
+    if (res != LV_RESULT_OK)
+    {
+        printf("lv_draw_buf_init failed %d\n", res);
+        return false;
+    }
+
+    screen = lv_obj_create(NULL);
+    canvas = lv_canvas_create(screen);
+    lv_canvas_set_draw_buf(canvas, &draw_buf);
+    lv_obj_center(canvas);
+
+    frames = 0;
+    render_us_total = 0;
+    render_us_max = 0;
+    start_ms = lv_tick_get();
+    effect.render(data_buf, draw_buf.header.stride, BYTES_PER_PIXEL, 0);
+    return true;
+}
+
+void ProceduralScene::update()
+{
+    uint64_t start = time_us_64();
+    effect.render(data_buf, draw_buf.header.stride, BYTES_PER_PIXEL, lv_tick_elaps(start_ms));
+    uint32_t us = static_cast<uint32_t>(time_us_64() - start);
+    render_us_total += us;
+    if (us > render_us_max)
+    {
+        render_us_max = us;
+    }
+    frames++;
+    lv_obj_invalidate(canvas);
+}
+
+void ProceduralScene::destroy()
+{
+    if (frames > 0)
+    {
+        printf("%s: %lu frames, render avg %lu us, max %lu us, %lu ns per pixel\n", effect.name(), (unsigned long)frames,
+               (unsigned long)(render_us_total / frames), (unsigned long)render_us_max,
+               (unsigned long)(render_us_total * 1000 / frames / (width * height)));
+    }
+
+    Scene::destroy();
+    data_buf = nullptr; // Memory is returned with the arena region
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstdio>
+
+#include "pico/stdlib.h"
+
+#include "lvgl/src/misc/lv_color.h"
+#include "lvgl/src/widgets/canvas/lv_canvas.h"
+
+#include "scene.hpp"
+#include "procedural_effect.hpp"
+
+#define BYTES_PER_PIXEL (LV_COLOR_FORMAT_GET_SIZE(LV_COLOR_FORMAT_RGB888))
+
+/**
+ * @brief Shows a ProceduralEffect on an RGB888 canvas in the scene arena.
+ *
+ * Any effect becomes a scene of the demo cycle this way. The render time of the effect is
+ * measured on every frame, frames, average and maximum time and ns per pixel are printed
+ * when the scene ends.
+ */
+class ProceduralScene : public Scene
+{
+private:
+    ProceduralEffect &effect;
+    uint width, height;
+    lv_obj_t *canvas = nullptr;
+    lv_draw_buf_t draw_buf;
+    uint8_t *data_buf = nullptr;
+    uint32_t start_ms = 0;
+
+    uint32_t frames = 0;
+    uint64_t render_us_total = 0;
+    uint32_t render_us_max = 0;
+
+public:
+    ProceduralScene(ProceduralEffect &effect, uint width = 64, uint height = 64) : effect(effect), width(width), height(height)
+    {
+    }
+
+    const char *name() const override
+    {
+        return effect.name();
+    }
+
+    bool create(SceneArena::Region &memory) override;
+
+    void update() override;
+
+    void show() override
+    {
+        lv_screen_load_anim(screen, LV_SCR_LOAD_ANIM_FADE_IN, 1000, 0, false);
+    }
+
+    void destroy() override;
+};
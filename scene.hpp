@@ -0,0 +1,72 @@
+#pragma once
+
+#include "pico/stdlib.h"
+
+#include "lvgl/src/core/lv_obj.h"
+
+#include "scene_arena.hpp"
+
+/**
+ * @brief Common interface of all demo scenes.
+ *
+ * Constructing a scene only records its parameters. All LVGL objects, styles and
+ * buffers are built in create() just before the scene is shown and released again
+ * in destroy() once the transition to the next scene has finished, so only the
+ * visible scene (and the outgoing one during a transition) occupies memory.
+ */
+class Scene
+{
+protected:
+    lv_obj_t *screen = nullptr;
+
+public:
+    virtual ~Scene() = default;
+
+    /// @brief Short name used in memory reports.
+    virtual const char *name() const = 0;
+
+    /**
+     * @brief Builds the screen of the scene.
+     *
+     * @param memory Arena region for the scene's large buffers, valid until destroy().
+     * @return false if memory could not be allocated.
+     */
+    virtual bool create(SceneArena::Region &memory) = 0;
+
+    /// @brief Loads the screen with the scene's transition animation.
+    virtual void show() = 0;
+
+    /// @brief Called once per frame while the scene is active.
+    virtual void update() {}
+
+    /// @brief Deletes the screen and everything created in create().
+    virtual void destroy()
+    {
+        if (screen)
+        {
+            lv_obj_delete(screen);
+            screen = nullptr;
+        }
+    }
+
+    /**
+     * @brief Time until the scene needs its next update(), the main loop does not sleep longer.
+     *
+     * 0 keeps the main loop from sleeping, e.g. while work is spread over several update() calls.
+     */
+    virtual uint32_t next_update_ms() const
+    {
+        return UINT32_MAX;
+    }
+
+    /// @brief Scenes running a finite animation hold the demo timer until it has completed.
+    virtual bool holds_timer() const
+    {
+        return false;
+    }
+
+    lv_obj_t *get_screen() const
+    {
+        return screen;
+    }
+};
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+/**
+ * @brief Double-ended bump allocator for scene memory.
+ *
+ * During a screen transition two scenes are alive: the outgoing one and the incoming one.
+ * The arena hands out one region growing upwards from the start and one growing downwards
+ * from the end, the scene manager alternates between them. Releasing a region resets it
+ * in one step, so the arena can never fragment. The size needed is the largest sum of two
+ * consecutive scenes instead of the sum of all scenes.
+ */
+class SceneArena
+{
+public:
+    /**
+     * @brief One end of the arena, owned by a single scene between create() and destroy().
+     */
+    class Region
+    {
+    private:
+        friend class SceneArena;
+
+        SceneArena *arena = nullptr;
+        bool from_top = false;
+        size_t used_bytes = 0;
+        size_t peak_bytes = 0;
+
+    public:
+        /**
+         * @brief Allocates zero-initialised memory from this region.
+         *
+         * @param bytes Number of bytes.
+         * @return Pointer aligned to 8 bytes, or nullptr if the arena is exhausted.
+         */
+        void *allocate(size_t bytes)
+        {
+            bytes = (bytes + 7u) & ~static_cast<size_t>(7u);
+            size_t other = from_top ? arena->low.used_bytes : arena->high.used_bytes;
+            if (used_bytes + bytes + other > arena->size)
+            {
+                return nullptr;
+            }
+            uint8_t *p = from_top ? arena->base + arena->size - used_bytes - bytes : arena->base + used_bytes;
+            used_bytes += bytes;
+            if (used_bytes > peak_bytes)
+            {
+                peak_bytes = used_bytes;
+            }
+            memset(p, 0, bytes);
+            return p;
+        }
+
+        template <typename T>
+        T *allocate(size_t count)
+        {
+            return static_cast<T *>(allocate(count * sizeof(T)));
+        }
+
+        /// @brief Returns all memory of this region to the arena.
+        void release()
+        {
+            used_bytes = 0;
+        }
+
+        /// @brief Bytes currently allocated from this region.
+        size_t used() const
+        {
+            return used_bytes;
+        }
+
+        /// @brief Highest number of bytes allocated since the peak was last reset.
+        size_t peak() const
+        {
+            return peak_bytes;
+        }
+
+        void reset_peak()
+        {
+            peak_bytes = used_bytes;
+        }
+    };
+
+private:
+    uint8_t *base;
+    size_t size;
+    Region low;
+    Region high;
+
+public:
+    /**
+     * @param memory Backing storage, 8-byte aligned.
+     * @param size Size of the backing storage in bytes.
+     */
+    SceneArena(uint8_t *memory, size_t size) : base(memory), size(size)
+    {
+        low.arena = this;
+        high.arena = this;
+        high.from_top = true;
+    }
+
+    SceneArena(const SceneArena &) = delete;
+    SceneArena &operator=(const SceneArena &) = delete;
+
+    /**
+     * @brief Returns one of the two regions.
+     *
+     * @param index 0 for the bottom region, 1 for the top region.
+     */
+    Region &region(unsigned int index)
+    {
+        return index & 1 ? high : low;
+    }
+
+    size_t capacity() const
+    {
+        return size;
+    }
+};
@@ -0,0 +1,118 @@
+#include <cstdio>
+
+#include "scene_manager.hpp"
+
+#include "lvgl/src/display/lv_display.h"
+#include "lvgl/src/stdlib/lv_mem.h"
+
+/**
+ * @brief Returns the number of bytes currently allocated from the LVGL heap.
+ */
+static size_t lvgl_heap_used()
+{
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    return mon.total_size - mon.free_size;
+}
+
+bool SceneManager::load(size_t index)
+{
+    if (index >= count)
+    {
+        return false;
+    }
+
+    // Two transitions in quick succession - the scene before the previous one has to go first
+    destroy_outgoing();
+
+    Scene *scene = scenes[index];
+    SceneArena::Region &memory = arena.region(region_index);
+
+    size_t lv_heap_before = lvgl_heap_used();
+    memory.reset_peak();
+    if (!scene->create(memory))
+    {
+        printf("Failed to create scene %s\n", scene->name());
+        scene->destroy();
+        memory.release();
+        return false;
+    }
+
+    SceneStats &s = stats[index];
+    size_t lv_heap = lvgl_heap_used() - lv_heap_before;
+    if (lv_heap > s.lv_heap_create)
+    {
+        s.lv_heap_create = lv_heap;
+    }
+    s.activations++;
+
+    outgoing = current;
+    current = index;
+    region_index ^= 1;
+
+    scene->show();
+    return true;
+}
+
+void SceneManager::update()
+{
+    if (current < 0)
+    {
+        return;
+    }
+
+    scenes[current]->update();
+
+    // The transition has finished when the new screen is active and the previous one is gone
+    if (outgoing >= 0 && lv_screen_active() == scenes[current]->get_screen() && lv_display_get_screen_prev(NULL) == NULL)
+    {
+        destroy_outgoing();
+    }
+}
+
+void SceneManager::unload()
+{
+    destroy_outgoing();
+    if (current >= 0)
+    {
+        destroy(current, arena.region(region_index ^ 1));
+        current = -1;
+    }
+}
+
+void SceneManager::destroy_outgoing()
+{
+    if (outgoing < 0)
+    {
+        return;
+    }
+
+    // The outgoing scene owns the region the next scene is about to be created in
+    destroy(outgoing, arena.region(region_index));
+    outgoing = -1;
+}
+
+/**
+ * @brief Records the arena peak of a scene, destroys it and releases its region.
+ */
+void SceneManager::destroy(int index, SceneArena::Region &memory)
+{
+    SceneStats &s = stats[index];
+    if (memory.peak() > s.arena_peak)
+    {
+        s.arena_peak = memory.peak();
+    }
+
+    scenes[index]->destroy();
+    memory.release();
+}
+
+void SceneManager::print_stats() const
+{
+    printf("scene arena %u bytes\n", (unsigned)arena.capacity());
+    for (size_t i = 0; i < count; i++)
+    {
+        printf("scene %-8s created %lu times, arena peak %u bytes, LVGL heap at create %u bytes\n",
+               scenes[i]->name(), (unsigned long)stats[i].activations, (unsigned)stats[i].arena_peak, (unsigned)stats[i].lv_heap_create);
+    }
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+#include "pico/stdlib.h"
+
+#include "scene.hpp"
+#include "scene_arena.hpp"
+
+/**
+ * @brief Builds scenes on demand and releases them once they are no longer visible.
+ *
+ * Loading a scene creates it in the arena region not used by the current scene and
+ * starts its transition. The previous scene is destroyed as soon as the transition
+ * has finished. Peak arena usage and the LVGL heap taken by create() are recorded per scene.
+ */
+class SceneManager
+{
+public:
+    /// @brief Memory statistics of a scene, peak values over all its activations.
+    struct SceneStats
+    {
+        size_t arena_peak;     ///< Bytes taken from the scene arena
+        size_t lv_heap_create; ///< Bytes create() took from the LVGL heap (LV_MEM_SIZE pool), drawing takes more
+        uint32_t activations;  ///< Number of times the scene has been created
+    };
+
+private:
+    Scene **scenes;
+    size_t count;
+    SceneStats *stats;
+    SceneArena arena;
+
+    int current = -1;  ///< Index of the active scene
+    int outgoing = -1; ///< Index of the scene to destroy after the transition
+    uint region_index = 0;
+
+    void destroy_outgoing();
+    void destroy(int index, SceneArena::Region &memory);
+
+public:
+    /**
+     * @param scenes Array of scenes, not created yet.
+     * @param count Number of scenes.
+     * @param arena_memory Backing storage for the scene arena.
+     * @param arena_size Size of the backing storage in bytes.
+     */
+    SceneManager(Scene **scenes, size_t count, uint8_t *arena_memory, size_t arena_size)
+        : scenes(scenes), count(count), stats(new SceneStats[count]()), arena(arena_memory, arena_size)
+    {
+    }
+
+    ~SceneManager()
+    {
+        delete[] stats;
+    }
+
+    /**
+     * @brief Creates a scene and starts its transition.
+     *
+     * A scene still waiting for its predecessor's transition to end is destroyed immediately.
+     *
+     * @param index Index of the scene.
+     * @return false if the scene could not be created.
+     */
+    bool load(size_t index);
+
+    /// @brief Per-frame update of the active scene and deferred destruction of the previous one.
+    void update();
+
+    /**
+     * @brief Destroys the active scene and a previous one still in transition.
+     *
+     * Another screen has to be loaded first, LVGL cannot delete the active screen.
+     */
+    void unload();
+
+    /// @brief Returns the active scene or nullptr.
+    Scene *active() const
+    {
+        return current >= 0 ? scenes[current] : nullptr;
+    }
+
+    /// @brief Returns true while the previous scene is still shown by the transition.
+    bool in_transition() const
+    {
+        return outgoing >= 0;
+    }
+
+    const SceneStats &get_stats(size_t index) const
+    {
+        return stats[index];
+    }
+
+    /// @brief Prints the peak memory usage of every scene.
+    void print_stats() const;
+};
@@ -0,0 +1,21 @@
+#include "pico/rand.h"
+
+#include "scene_random.hpp"
+
+static uint32_t random_state = 1;
+
+void scene_random_seed(uint32_t seed)
+{
+    random_state = seed ? seed : (get_rand_32() | 1); // xorshift32 must not start at 0
+}
+
+uint32_t scene_random()
+{
+    // xorshift32
+    uint32_t x = random_state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    random_state = x;
+    return x;
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstdint>
+
+// Random numbers of the scenes: one xorshift32 stream, seeded once at start-up. With a fixed seed
+// every run places the same balls, sprites and fire sources, so frames can be compared between runs
+// (see the host build in README.md).
+
+/**
+ * @brief Seeds the stream.
+ *
+ * @param seed Any value, 0 seeds from the hardware random number generator (pico_rand) so every boot differs.
+ */
+void scene_random_seed(uint32_t seed);
+
+/// @brief Next number of the stream, never 0.
+uint32_t scene_random();
+
+/// @brief Uniform value in [0, range), range > 0
+static inline uint32_t scene_random_below(uint32_t range)
+{
+    return scene_random() % range;
+}
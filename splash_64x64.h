@@ -0,0 +1,518 @@
+#include "pico.h"
+// Boot splash for a 64x64 panel: vanessa_mai_64x64.h, pre-converted to the driver's pixel format
+// (gamma corrected RGB101010, display order) so it can be shown without any conversion.
+// Regenerate with the same gamma table and channel order as update_bgr() when the image or panel size changes.
+static const uint32_t splash_64x64[64 * 64] = {
+    0x0270b5d6, 0x0260b1d6, 0x0280b9e1, 0x0280b9ed, 0x0280b9ed, 0x0270b5e1, 0x0270b5e1, 0x0210a15b,
+    0x00e04849, 0x00401413, 0x00501816, 0x00501c15, 0x00401412, 0x00501812, 0x00b0401d, 0x01005c26,
+    0x01005c27, 0x0120642a, 0x01206027, 0x00b0401d, 0x0090341c, 0x01006029, 0x0130682b, 0x0110642b,
+    0x01b0903b, 0x01d0a040, 0x01708839, 0x0190903c, 0x01c09c40, 0x0210b047, 0x0250c84d, 0x0220b849,
+    0x0230bc4b, 0x0321087d, 0x03b138ae, 0x03211088, 0x02c0f06f, 0x02e1007d, 0x02c0f072, 0x02c0f072,
+    0x02d0f877, 0x0260d057, 0x01d0a040, 0x01006029, 0x00903c1d, 0x0090381d, 0x00a0381b, 0x00903018,
+    0x00702013, 0x00c03c1c, 0x01105c25, 0x01306c29, 0x01808837, 0x01307c3c, 0x00c06037, 0x01208460,
+    0x0230c156, 0x02c0d631, 0x02a0ca2a, 0x02a0ca2a, 0x02a0c21e, 0x02a0c21e, 0x02a0c217, 0x0280be0b,
+    0x0260b5d6, 0x0270b5e1, 0x0290bded, 0x0290bdf3, 0x0290bdf3, 0x0280b9e7, 0x0250b5c4, 0x0160709e,
+    0x0050241e, 0x00501c16, 0x00501815, 0x00501813, 0x00401011, 0x00501811, 0x00802c16, 0x00803419,
+    0x0080341b, 0x00c04c21, 0x00f05422, 0x00d0441f, 0x00e05424, 0x0130682b, 0x01206429, 0x0150742e,
+    0x01d0a03e, 0x01d0a041, 0x01e0a041, 0x0220b447, 0x0230c04b, 0x01d0a443, 0x01a09840, 0x01c0a043,
+    0x0210b84b, 0x02a0e86a, 0x035120a4, 0x0321189b, 0x02d0fc85, 0x034128c3, 0x03915d01, 0x03a1811f,
+    0x0421f560, 0x0492518e, 0x03f19d1a, 0x02b0f477, 0x0180883a, 0x00d05427, 0x00a03c1e, 0x00502013,
+    0x0030100d, 0x0040180f, 0x00d0441d, 0x01306829, 0x01707c31, 0x01908c3d, 0x00f06435, 0x00b05c35,
+    0x01a0a8ab, 0x0290d9e7, 0x02a0ca37, 0x02a0ca24, 0x02a0ca2a, 0x02a0c224, 0x02a0c21e, 0x0290c211,
+    0x0260b5d6, 0x0280b5db, 0x0280b9e7, 0x0280c1f9, 0x0280c1f3, 0x0290c205, 0x01d0910d, 0x00903c33,
+    0x00401c16, 0x00501416, 0x00501413, 0x00501012, 0x00401011, 0x00501812, 0x00602013, 0x00501c13,
+    0x00702416, 0x00d04820, 0x01306829, 0x01807c2f, 0x01c09035, 0x01e09837, 0x01c09436, 0x01d0983a,
+    0x0200ac40, 0x0220b845, 0x0250cc4e, 0x0260d04f, 0x0230bc4a, 0x01f0b046, 0x0230c04d, 0x0280dc62,
+    0x02f10488, 0x0311109b, 0x02f1089b, 0x02e1049b, 0x034130d5, 0x0432096f, 0x04e2f1f3, 0x0593a24a,
+    0x0593a257, 0x0593a257, 0x05939251, 0x04b2c5db, 0x03513ce1, 0x01e0b84d, 0x0170903e, 0x01006c33,
+    0x0080341d, 0x00401410, 0x00903018, 0x01205c24, 0x0160782e, 0x0190903e, 0x0150803d, 0x00a04c2e,
+    0x0120844f, 0x0230cd43, 0x02a0ce1e, 0x02a0ca31, 0x02a0ca2a, 0x0290c624, 0x02a0c624, 0x02a0c617,
+    0x0270b5d6, 0x0270b5e1, 0x0280b9ed, 0x0280c1f3, 0x0280c205, 0x0230a993, 0x01105c60, 0x0040241b,
+    0x00502019, 0x00501c15, 0x00501812, 0x00401010, 0x00401411, 0x00501811, 0x00501812, 0x00501c13,
+    0x00602416, 0x00c0441e, 0x0170782d, 0x01d09036, 0x01b08834, 0x01a08833, 0x01908834, 0x01a09038,
+    0x0200ac40, 0x0260c849, 0x0290dc54, 0x0270d452, 0x0220b849, 0x0250d052, 0x02d0f877, 0x0321149b,
+    0x03211cab, 0x03512cbf, 0x038140e4, 0x03c1811a, 0x04e2b9bf, 0x07546a79, 0x07a4d6b1, 0x0624368d,
+    0x0593e280, 0x0573c280, 0x04f39279, 0x05039279, 0x04a2e20b, 0x03a19d51, 0x02f128f0, 0x0250ec9b,
+    0x0150883f, 0x0080381c, 0x00803018, 0x01105c25, 0x01306c2a, 0x01608438, 0x01a09c47, 0x00e06036,
+    0x00c0643c, 0x01c0b0c6, 0x0280d1d6, 0x02a0ca2a, 0x02a0ca2a, 0x0290c624, 0x02a0c624, 0x02a0c624,
+    0x0270b5e1, 0x0280bded, 0x0280bdf3, 0x0270bded, 0x0270b9ed, 0x01b088f0, 0x00904033, 0x0050281c,
+    0x00502018, 0x00501c13, 0x00401410, 0x00401813, 0x00502015, 0x00501c13, 0x00502015, 0x00702818,
+    0x00a03c1d, 0x01206829, 0x0160742e, 0x00e04c25, 0x00c04c25, 0x01307031, 0x0180903b, 0x01e0ac45,
+    0x0230c84c, 0x0260d44f, 0x0230c049, 0x01d0a441, 0x0200b447, 0x02a0e467, 0x03111094, 0x03211cab,
+    0x036130ce, 0x03c164fc, 0x04620960, 0x06a3b21e, 0x0a7596b1, 0x0bf64eeb, 0x0ab5e6eb, 0x09155ad5,
+    0x0774c2b1, 0x06543694, 0x05e4068d, 0x05b3f287, 0x04e3565e, 0x04126e11, 0x0381b5ae, 0x02e12505,
+    0x01d0b85b, 0x00e0582a, 0x00903c1c, 0x01306c2a, 0x0160742c, 0x01307030, 0x01909845, 0x01307c40,
+    0x00d06039, 0x01909c97, 0x0270d9b4, 0x02a0d224, 0x02a0ce2a, 0x0290ca2a, 0x0290c224, 0x02a0c224,
+    0x0280bde1, 0x0270bdf3, 0x0280bdf3, 0x0280bdf3, 0x0260b1b9, 0x01607894, 0x00703c25, 0x00602c1e,
+    0x00401816, 0x00401813, 0x00602819, 0x0070341d, 0x00904021, 0x00d04c28, 0x01106830, 0x01608035,
+    0x01908c38, 0x01507832, 0x00f0602b, 0x01307834, 0x01c0a442, 0x0210c04d, 0x0220cc57, 0x0220d059,
+    0x0270e465, 0x02d10075, 0x0260d450, 0x01b0a041, 0x01e0b449, 0x0290ec75, 0x031118a7, 0x038140e1,
+    0x0431d53e, 0x04f2b9b4, 0x08847e51, 0x0d1662dc, 0x0f874310, 0x0f872b10, 0x0e16d309, 0x0c364efa,
+    0x097596dc, 0x07d4fac6, 0x0754b2b8, 0x06a44aa2, 0x0593c280, 0x0482e23d, 0x03d1f5db, 0x03213d3e,
+    0x0230dc88, 0x01508039, 0x01206428, 0x0160782e, 0x0160782e, 0x01005c29, 0x01307839, 0x01508c43,
+    0x00d06037, 0x01308460, 0x0250cd6a, 0x02b0d62a, 0x02a0ca24, 0x02a0c62a, 0x0290c62a, 0x0290c61e,
+    0x0280b9ed, 0x0280bdf9, 0x0280bdf9, 0x0290bdff, 0x02009d43, 0x00f05c4b, 0x00603422, 0x00502018,
+    0x00501815, 0x00903821, 0x01006430, 0x0170843b, 0x01608038, 0x00f0582a, 0x00b04421, 0x00f05825,
+    0x01607831, 0x01908c3a, 0x01c0a443, 0x01c0a846, 0x0190a045, 0x01a0a849, 0x01c0b84e, 0x01f0c04f,
+    0x0290ec6a, 0x03311c85, 0x0280e459, 0x01b0a043, 0x0200bc4e, 0x02c0f882, 0x037134c3, 0x0431dd35,
+    0x067385f9, 0x0b85d2a9, 0x0f4712f2, 0x10175b01, 0x10978718, 0x10d79f20, 0x0f875b18, 0x0d16a709,
+    0x0a75fafa, 0x09156ee3, 0x082522cd, 0x06f47eb1, 0x0603f28d, 0x04e3465e, 0x04225205, 0x0331515b,
+    0x0240e49b, 0x01b09c43, 0x01908432, 0x01b09034, 0x01b08832, 0x01005825, 0x01106830, 0x01709043,
+    0x0110743d, 0x01007046, 0x01d0acf8, 0x02b0da11, 0x02b0ce2a, 0x02a0c62a, 0x02a0c624, 0x02a0c624,
+    0x0280c1f9, 0x0280c1ff, 0x0280bdf3, 0x0260b1ca, 0x019080d5, 0x00a04837, 0x0050281d, 0x00401816,
+    0x00b04427, 0x01909443, 0x01d0a847, 0x01307c35, 0x00b04422, 0x0090341c, 0x0120642d, 0x01f0b048,
+    0x0220c450, 0x01c0ac49, 0x01a0a045, 0x01a0a448, 0x01c0b84f, 0x01a0ac49, 0x0170943c, 0x01b0983a,
+    0x0220b442, 0x0280d44c, 0x02b0e457, 0x02b0ec65, 0x03111091, 0x03a148d5, 0x0411b51f, 0x05b319bf,
+    0x0ae5aa94, 0x0e471301, 0x0f074318, 0x10176f18, 0x1167b718, 0x10d7b720, 0x0e874318, 0x0c66bb10,
+    0x0ab63b09, 0x09b5d2fa, 0x0945aaeb, 0x08250ec6, 0x06a44aa2, 0x05439279, 0x0462ba2a, 0x0371896f,
+    0x0250e491, 0x01e0a844, 0x0210a83d, 0x0210a83d, 0x01d09838, 0x01005c26, 0x00f0602e, 0x01608c41,
+    0x01709847, 0x0130844d, 0x018094b1, 0x0280d1d6, 0x02b0ce37, 0x02b0ce24, 0x02b0ca2a, 0x02a0c224,
+    0x0280c1f9, 0x0290c205, 0x0280bded, 0x0250b1b4, 0x01807cb5, 0x00904434, 0x0080402c, 0x00c05c36,
+    0x01308c46, 0x01609044, 0x0130803c, 0x01608c3e, 0x01909c43, 0x01e0b44c, 0x0220c857, 0x01f0bc4e,
+    0x01d0ac48, 0x01e0b84c, 0x0250dc67, 0x02e1109b, 0x0260e86d, 0x01708837, 0x01708033, 0x0200a83f,
+    0x0260c047, 0x02a0dc50, 0x02e0f86a, 0x03110c88, 0x038134c3, 0x03f19d12, 0x04c28593, 0x08045a44,
+    0x0c363ac6, 0x0e871309, 0x0f475b18, 0x0f878720, 0x10579f20, 0x0fc78718, 0x0d16ff09, 0x0b166301,
+    0x0a15fafa, 0x09b5d2f2, 0x08e582e3, 0x08250ecd, 0x06a44aa2, 0x05439272, 0x04b2f231, 0x03b1a974,
+    0x0250e088, 0x01c09c40, 0x0220a83d, 0x0280c845, 0x0240b842, 0x01306c2b, 0x00d0582b, 0x0130803d,
+    0x01a0ac4d, 0x01a0a865, 0x0170909b, 0x0240c583, 0x02a0ca24, 0x0290ca2a, 0x02a0ca2a, 0x02a0c21e,
+    0x0280c1f9, 0x0280c1f3, 0x0260b9db, 0x0230a989, 0x01507c9b, 0x0090583f, 0x00a06440, 0x00d0703f,
+    0x0100783e, 0x01107c3e, 0x01508c42, 0x01c0ac4c, 0x01f0bc52, 0x0200c454, 0x0200c457, 0x01e0b84e,
+    0x01e0b44c, 0x0270e86f, 0x037140ce, 0x02e10c8e, 0x01608438, 0x01005c2a, 0x01507831, 0x01a08c37,
+    0x01f0a842, 0x0240c84f, 0x0260d860, 0x02b0f882, 0x033124c3, 0x0421e951, 0x0653b224, 0x09e582b8,
+    0x0ca68ef2, 0x0e16e709, 0x0ec74318, 0x0ec75b20, 0x0e874320, 0x0dd71318, 0x0c66a709, 0x0ae63b09,
+    0x09b5bf01, 0x091596fa, 0x08e582eb, 0x085522d5, 0x06f46aa9, 0x05439279, 0x04b2f237, 0x03a19560,
+    0x0200c46f, 0x01307835, 0x01c09438, 0x0240b843, 0x0220b443, 0x0150742e, 0x00b04c25, 0x01107038,
+    0x0190a44a, 0x01b0b06d, 0x01808ca1, 0x0200b13a, 0x0280cde1, 0x02a0ce31, 0x02a0c62a, 0x02a0c624,
+    0x0290c5ff, 0x0280c5f3, 0x0270bdd0, 0x0210a956, 0x01307c7a, 0x00905438, 0x00b05838, 0x00e0703e,
+    0x01108844, 0x0150984a, 0x0190a84d, 0x01b0b04e, 0x01c0b04e, 0x01c0b44f, 0x01d0bc52, 0x01e0c059,
+    0x0230dc72, 0x0250e477, 0x0190a047, 0x00b04c29, 0x00b04825, 0x00c04c26, 0x00e05c29, 0x01307834,
+    0x01909440, 0x01d0ac4a, 0x0240d86d, 0x033128ce, 0x04b26d89, 0x08046a57, 0x0a1596bf, 0x0bc63af2,
+    0x0d96e709, 0x0e872b10, 0x0f074309, 0x10176f18, 0x0e871318, 0x0bf68f09, 0x0b166309, 0x0ae63b09,
+    0x0975ab01, 0x088546f2, 0x085536eb, 0x07d4fadc, 0x06744ab1, 0x05239279, 0x04a2fe3d, 0x03a19565,
+    0x01d0b865, 0x0100642f, 0x01a08c37, 0x0200ac40, 0x0210b443, 0x01808433, 0x00b04c24, 0x00f06834,
+    0x01308440, 0x0180a05e, 0x01a098b8, 0x01e0a51f, 0x0240c58e, 0x0290ca11, 0x02a0c224, 0x0290c21e,
+    0x02a0c60b, 0x0280c1e7, 0x0260bdb9, 0x0220b135, 0x01507c60, 0x00c05836, 0x00d05c35, 0x00e05c30,
+    0x01307838, 0x0190a448, 0x01a0ac4c, 0x0190a44a, 0x01a0b04c, 0x01c0b44f, 0x01c0bc52, 0x01a0ac4c,
+    0x0120803c, 0x00904827, 0x0060341f, 0x00903c21, 0x00904423, 0x00a04c27, 0x00c0582b, 0x00f06c34,
+    0x0120803f, 0x01a0a44f, 0x02e110bf, 0x04e2adbf, 0x08e4fa9b, 0x0b5626eb, 0x0c667afa, 0x0ce68f09,
+    0x0d16bb10, 0x0e46ff09, 0x10976f10, 0x12c7ff27, 0x10976f27, 0x0c664f01, 0x0b560ef2, 0x0b863af2,
+    0x0a15befa, 0x08250eeb, 0x0774c2d5, 0x07a4d6cd, 0x06d45ab1, 0x0543a279, 0x04b2fe3d, 0x03c1b583,
+    0x01e0c472, 0x01006830, 0x01908837, 0x01e0a03d, 0x01f0ac41, 0x01808836, 0x00c04c24, 0x00e06432,
+    0x00f07439, 0x01709c59, 0x01f0b8f8, 0x0200a94d, 0x0240c965, 0x0290d5ca, 0x02a0ca24, 0x0290c217,
+    0x0290c1ff, 0x0270b9e1, 0x0260b5ca, 0x01e09d0d, 0x0130784f, 0x01307c41, 0x0130843f, 0x01809041,
+    0x01c0b84f, 0x01e0b44c, 0x0180903d, 0x01508438, 0x01308037, 0x01307836, 0x01307c34, 0x01508436,
+    0x01307834, 0x00f0682e, 0x00d05c2a, 0x00c05829, 0x00b05429, 0x00a0542a, 0x00c06031, 0x00f0743b,
+    0x0170a04f, 0x02a108ca, 0x0502e1db, 0x0a7596c6, 0x0b863aeb, 0x0b5626eb, 0x0bf63afa, 0x0ca67afa,
+    0x0dd6e709, 0x10178720, 0x10172aeb, 0x0bf55a5e, 0x08b405f9, 0x0824262a, 0x09e536a9, 0x0b15bee3,
+    0x0a7596eb, 0x08e536e3, 0x07a4c2d5, 0x07248ebf, 0x065436a9, 0x05239280, 0x04b2fe4a, 0x03d1dda3,
+    0x01f0cc7d, 0x01106831, 0x01a0903a, 0x0200a83f, 0x0240c049, 0x01c09c3e, 0x00e04c24, 0x00e06430,
+    0x00f07038, 0x01709c52, 0x01e0c0ec, 0x0210b156, 0x0250c593, 0x0290e1bf, 0x02b0ddf9, 0x02a0ce2a,
+    0x0290c5ff, 0x0270bde7, 0x0250b9b4, 0x01d09ce8, 0x0120784b, 0x00e06438, 0x01307c3c, 0x01c0b04d,
+    0x01e0b84f, 0x01b0a045, 0x01909840, 0x0180943e, 0x01b0a042, 0x01c0a843, 0x01c0a841, 0x01c0a440,
+    0x0190983c, 0x01508436, 0x01006c30, 0x00d0602d, 0x00b0582d, 0x00b0582e, 0x00f06c37, 0x01b0b057,
+    0x02d11ce1, 0x04a29dd6, 0x08b522bf, 0x0b5626eb, 0x0b160ee3, 0x0ab5faeb, 0x0ae5fae3, 0x0c664eeb,
+    0x0d967adc, 0x09e48e1e, 0x0461bcf4, 0x02e0f075, 0x0290d860, 0x0280d862, 0x036130b8, 0x0522ad93,
+    0x07a41657, 0x08b4c2b1, 0x0854facd, 0x07247ebf, 0x062416a2, 0x0543b280, 0x04d33a5e, 0x03f201b4,
+    0x0200d082, 0x01207434, 0x01b0983c, 0x01f0a83f, 0x0260cc4d, 0x01f0b045, 0x00e05425, 0x00d0602e,
+    0x0110783a, 0x01709c4b, 0x01d0b8b1, 0x0200b53a, 0x0260c1bf, 0x0280d5ca, 0x0280d9b4, 0x0290ce0b,
+    0x0290c9f9, 0x0270c1e7, 0x0240b18e, 0x018088b1, 0x00c0543c, 0x00e06035, 0x01a0a44b, 0x01f0c054,
+    0x01b09c42, 0x01307433, 0x00e05c2c, 0x01207435, 0x0180943f, 0x01a09c3f, 0x01c0a442, 0x01c0a845,
+    0x01c0a846, 0x01e0b048, 0x01d0b048, 0x01909c42, 0x0130803a, 0x00f06c35, 0x01a0a44f, 0x03413d09,
+    0x04e2fdff, 0x0804d6a2, 0x0a45e6e3, 0x0ae60ee3, 0x0bc63adc, 0x0b160ed5, 0x0ab5aabf, 0x0914c26b,
+    0x0502917e, 0x03e164d9, 0x04a1e901, 0x0803a1b4, 0x091449ff, 0x05226d4d, 0x02d0f075, 0x01d09c44,
+    0x0270dc7a, 0x03f1a93e, 0x0653924a, 0x07546ab1, 0x06040694, 0x0573b280, 0x0503565e, 0x0421f59e,
+    0x0240d882, 0x01507c37, 0x01f0a440, 0x0220b043, 0x0290e054, 0x0250cc4d, 0x01106429, 0x00f0642e,
+    0x0130883f, 0x0180a44d, 0x0190b088, 0x0200c127, 0x0260c1b9, 0x0270c9c4, 0x0260d59e, 0x0270cdb9,
+    0x0290c9f3, 0x0280c1e1, 0x0220a960, 0x01307480, 0x0100703f, 0x01a0a44e, 0x01f0c460, 0x01b0a446,
+    0x00f05c28, 0x00b04822, 0x01508039, 0x0200c052, 0x0220cc59, 0x0200bc4e, 0x01f0b84b, 0x0200bc4c,
+    0x0230c44f, 0x0230c84f, 0x0230c44e, 0x0200b449, 0x01a09841, 0x0200bc52, 0x03b1810d, 0x0653b231,
+    0x0824d6a2, 0x088522b8, 0x09e5d2e3, 0x0b163af2, 0x0b864edc, 0x0a75aabf, 0x08045a6b, 0x0623460b,
+    0x065365ff, 0x08b47e5e, 0x09e4ea8d, 0x0804164a, 0x05e329f9, 0x05e33a05, 0x05930df3, 0x04720960,
+    0x036128ce, 0x02f108c3, 0x04620993, 0x06a3f287, 0x06241694, 0x0573a279, 0x04e2d605, 0x033124d5,
+    0x0150803b, 0x01206c30, 0x01f0a841, 0x01f0a840, 0x0260d44e, 0x0290e459, 0x01607c31, 0x00f0642c,
+    0x01809844, 0x01c0b459, 0x0190b07d, 0x01c0b8d5, 0x0220b96f, 0x0280c5e1, 0x0270c5b4, 0x0260cd93,
+    0x0290c5f9, 0x0270bdca, 0x01e0a11f, 0x0150846a, 0x01809c4c, 0x01d0c062, 0x0200c85e, 0x01a0983f,
+    0x01507c35, 0x01c0a446, 0x01b0a447, 0x01709441, 0x01608c3c, 0x01b0a040, 0x0200b445, 0x0210b046,
+    0x01f0a846, 0x01c09c44, 0x01a09441, 0x01e0a445, 0x0260d465, 0x037140ec, 0x057319ed, 0x07a47e87,
+    0x0804d6a2, 0x09155ac6, 0x0ab60ee3, 0x0c66a6f2, 0x0b863adc, 0x09455ab8, 0x0884b29b, 0x07d45a79,
+    0x06236624, 0x04a24593, 0x03a140ec, 0x0280dc6a, 0x01d09c46, 0x0210b450, 0x03412ce4, 0x04f2d5ff,
+    0x06a3e265, 0x05932a0b, 0x0673922a, 0x08e4eab1, 0x06d47ea2, 0x04d2f21e, 0x032124dd, 0x01206c34,
+    0x00903c1f, 0x01206c2e, 0x0200b044, 0x0200ac42, 0x0230bc48, 0x02c0f065, 0x01b0983c, 0x00e05c2a,
+    0x01c0ac4a, 0x0210d075, 0x01d0c088, 0x01c0bca7, 0x01e0b4f8, 0x0250c19e, 0x0280c5f9, 0x0250c9a9,
+    0x0270c1e7, 0x0240b59e, 0x01d09ce8, 0x01709460, 0x0170a050, 0x0210d475, 0x0250e472, 0x01c0a845,
+    0x01307835, 0x00e05c2d, 0x01207436, 0x0170903e, 0x01808c3c, 0x0180843a, 0x0170803a, 0x01608440,
+    0x01909849, 0x01e0b452, 0x0240d062, 0x02a0f488, 0x030120ca, 0x03d1a948, 0x05433a1e, 0x06a4368d,
+    0x0774b2b1, 0x08e56ee3, 0x0bf67b01, 0x0f476f18, 0x0d96e6fa, 0x0ab5fadc, 0x097546c6, 0x05e32a11,
+    0x038134ec, 0x0290d05b, 0x0220a43d, 0x01f09434, 0x0320dc44, 0x0330e046, 0x01f09c44, 0x03312cf0,
+    0x0603b26b, 0x0b1626fa, 0x0e175b2f, 0x0bf6d320, 0x0624166b, 0x030130f4, 0x01307437, 0x00b03819,
+    0x00a03017, 0x01005c27, 0x0200b044, 0x0230bc47, 0x0230bc46, 0x02c0f467, 0x01f0b045, 0x00e05c2a,
+    0x01c0b04a, 0x0260ec97, 0x01e0c89e, 0x01a0b897, 0x01b0b0bc, 0x01f0ad43, 0x0270c1e1, 0x0270c5d0,
+    0x0270c1d6, 0x0240b574, 0x01b09cae, 0x0190ac65, 0x0210dc80, 0x0260f088, 0x01f0c054, 0x00b04823,
+    0x00602c18, 0x00e05c2d, 0x01709041, 0x01a09841, 0x01808c3a, 0x0170883a, 0x0130803b, 0x01809849,
+    0x0260e48b, 0x03112ce8, 0x03614912, 0x0371490d, 0x03514112, 0x03f1dd83, 0x0503463d, 0x05b3d28d,
+    0x065436a9, 0x088546dc, 0x0ce6d310, 0x12785f3f, 0x13e89347, 0x0f878720, 0x0a75d2eb, 0x06537637,
+    0x037124c3, 0x01e09437, 0x0290d841, 0x04a19c8b, 0x11f5958e, 0x15b6e65e, 0x04e1f548, 0x03e1b556,
+    0x0914fa94, 0x0e171318, 0x10d81747, 0x0d97434f, 0x044285a3, 0x0210b848, 0x02109c2c, 0x0360fc47,
+    0x02d0cc3b, 0x00e04c22, 0x01f0ac43, 0x0270d04f, 0x0240c048, 0x0290e45e, 0x0210c04c, 0x01006830,
+    0x01c0b852, 0x02b108b8, 0x0200ccb5, 0x01509880, 0x01609c88, 0x01c0a109, 0x0240b5ae, 0x0280c5ed,
+    0x0270c1e1, 0x0220b53e, 0x0190a480, 0x01d0c46f, 0x0260f094, 0x0220d875, 0x01006c32, 0x00401811,
+    0x00903c20, 0x01207438, 0x01709041, 0x0190943f, 0x01a0943d, 0x0170883c, 0x01a09c47, 0x0220c06d,
+    0x03613cf8, 0x05e3861e, 0x05e38624, 0x0422018e, 0x03616d4d, 0x040221b4, 0x04d3465e, 0x04e35672,
+    0x060406a2, 0x085546dc, 0x0ca6d310, 0x1358934f, 0x18e9e777, 0x1899af6f, 0x1488ab4f, 0x0fc72b10,
+    0x0823c1e7, 0x043164ca, 0x03610c72, 0x065220bc, 0x13e5f9bf, 0x0ca469d6, 0x0441bd6a, 0x06f3a217,
+    0x1438df4f, 0x13a8ab4f, 0x11f82f4f, 0x0f875b3f, 0x04523979, 0x0210b84a, 0x02b0d040, 0x04413467,
+    0x02c0c840, 0x00a0401e, 0x01e0a840, 0x0250cc4e, 0x0210b043, 0x0260d050, 0x0230d054, 0x01308c3d,
+    0x0200d46d, 0x02d118d1, 0x0200ccae, 0x0130887a, 0x01208c6a, 0x017090b8, 0x0210a179, 0x0290bdf3,
+    0x0260bdc4, 0x01d0a4ec, 0x0170a46d, 0x01f0cc7d, 0x0240ec94, 0x01d0c060, 0x00a04424, 0x00502415,
+    0x00d05c2c, 0x0130843f, 0x0150883d, 0x0190903d, 0x01a0983e, 0x0150803a, 0x01f0b450, 0x032110b8,
+    0x0411bd48, 0x07747e6b, 0x07747e87, 0x041209ae, 0x03f1e99e, 0x0492c611, 0x04a31a57, 0x04a31a65,
+    0x0523928d, 0x07a4d6cd, 0x0c368f10, 0x13087b4f, 0x1989e777, 0x1b9a6f87, 0x1a9a377f, 0x18e9cb6f,
+    0x1237cf18, 0x09445a3d, 0x04c20156, 0x040148e8, 0x03f140e8, 0x03b13905, 0x0411c96a, 0x0a152280,
+    0x11a8473f, 0x0e174327, 0x0f076f2f, 0x0dd6bb10, 0x0502e1e7, 0x033124d1, 0x02d0e86a, 0x01e0983f,
+    0x00c03c1f, 0x00a03c1e, 0x01a0983d, 0x0230c04a, 0x0210b045, 0x0250c84c, 0x0250d45b, 0x01a0ac4d,
+    0x0220e88e, 0x028108d5, 0x01c0c094, 0x01709c97, 0x0150988e, 0x015098a1, 0x01f0a560, 0x0260b1e7,
+    0x0240bd7e, 0x019098a1, 0x0190b06d, 0x0210d88b, 0x0220e088, 0x01a0b854, 0x00a04823, 0x0080341d,
+    0x01006c36, 0x01308840, 0x0160883e, 0x01a0943f, 0x0190903d, 0x01307838, 0x01a0a44e, 0x031124ec,
+    0x04320993, 0x0673f251, 0x06f45a80, 0x04f2fe11, 0x05937644, 0x04f35651, 0x0492f24a, 0x04a2f257,
+    0x04d34672, 0x062426a9, 0x0a15e6fa, 0x10d7ff47, 0x1839cb7f, 0x1aea5390, 0x17995f6f, 0x1438ab47,
+    0x13085f3f, 0x10979f27, 0x0c660ed5, 0x08e49e72, 0x0723c237, 0x0723a22a, 0x0ae52280, 0x0f474309,
+    0x0e475b27, 0x0dd7432f, 0x0f076f2f, 0x0d96bb10, 0x0623762a, 0x032128ec, 0x0270dc75, 0x01a09846,
+    0x0090341e, 0x00a03c1d, 0x01708c3b, 0x01f0b44a, 0x01e0ac45, 0x01f0ac44, 0x0250d460, 0x01f0cc6a,
+    0x01f0d888, 0x0210e8bc, 0x01b0b897, 0x01b0a8b5, 0x0190acb1, 0x0180acae, 0x0220b56f, 0x0270b1db,
+    0x01f0b11a, 0x01609875, 0x0200d48e, 0x0200d485, 0x01a0b460, 0x01a0b454, 0x00d0582a, 0x00904824,
+    0x00f06c37, 0x01508842, 0x01809442, 0x01909440, 0x01508039, 0x01307c39, 0x01a0a850, 0x0401f560,
+    0x09b582dc, 0x0ab60ee3, 0x08550ea9, 0x0653e265, 0x0573865e, 0x04d35665, 0x0482fe51, 0x0462c64a,
+    0x0482e257, 0x0523868d, 0x0774d6e3, 0x0ca6d32f, 0x15191377, 0x1a9a3798, 0x1899977f, 0x1488ab5f,
+    0x13082f3f, 0x11f7e737, 0x0fc78727, 0x0dd6d309, 0x0c663ae3, 0x0dd6a6f2, 0x12c8172f, 0x14d8ab4f,
+    0x1488ab57, 0x13587b4f, 0x0f476f27, 0x0dd6e718, 0x08b49e8d, 0x03d1a956, 0x02c0fca4, 0x01e0b04e,
+    0x00b04822, 0x00a04421, 0x01508439, 0x0200bc4c, 0x0200bc4b, 0x0190983e, 0x0210c859, 0x0220dc82,
+    0x01c0cc82, 0x01e0e0a7, 0x01a0c09b, 0x01b0acb8, 0x01b0b4c6, 0x0190b4bc, 0x0220bd65, 0x0250add0,
+    0x01c0a4ce, 0x01609c6a, 0x01e0d08b, 0x0190b062, 0x0180a852, 0x01c0bc5e, 0x00d05c2d, 0x00904422,
+    0x0110783b, 0x01709446, 0x01709444, 0x01a09842, 0x01307c36, 0x01307c39, 0x01a0a04c, 0x03413cfc,
+    0x07a46a87, 0x0bc64efa, 0x094536a9, 0x0603c257, 0x0523765e, 0x04d3566b, 0x04931a5e, 0x0472d64a,
+    0x0462ba44, 0x0492f26b, 0x05b3d2b1, 0x0975ab09, 0x0f87cf57, 0x16095f87, 0x1839af90, 0x17995f87,
+    0x1608f767, 0x12c82f47, 0x0e471327, 0x0bf67b10, 0x0c667b10, 0x0fc75b27, 0x14d8934f, 0x16a8df57,
+    0x16f8f757, 0x11f7e737, 0x0c368f01, 0x0ca6a709, 0x09e55ad5, 0x04622d98, 0x02c104b5, 0x0210c05b,
+    0x00f0582b, 0x00904421, 0x00f07034, 0x01709844, 0x01e0b44c, 0x01909840, 0x01a0a849, 0x0230e088,
+    0x01e0d891, 0x01e0e4a1, 0x01e0d8a4, 0x01b0b4ab, 0x01b0b4c3, 0x0190b8bc, 0x0200c14d, 0x0260b1d0,
+    0x0160989b, 0x0160a46d, 0x01e0d088, 0x0190b05b, 0x01a0b054, 0x01b0bc60, 0x01107437, 0x00d05426,
+    0x01107838, 0x01609446, 0x01709445, 0x01b0a446, 0x01608439, 0x01107033, 0x01609444, 0x0280f8ab,
+    0x05733a0b, 0x0b160eeb, 0x08e4ea8d, 0x05436637, 0x04d33a4a, 0x04d3566b, 0x04e36672, 0x04b32a65,
+    0x0472c64a, 0x04529e51, 0x04b2fe80, 0x06a45adc, 0x0a762737, 0x0f479f67, 0x1438c77f, 0x16f95f90,
+    0x16a94787, 0x13a84767, 0x0f071347, 0x0bf64f27, 0x0bf67b27, 0x0dd6ff2f, 0x10d79f3f, 0x13e85f4f,
+    0x11f7e73f, 0x0c366301, 0x09455ad5, 0x08e522cd, 0x08048eb8, 0x04a279ca, 0x02f114d5, 0x0210bc60,
+    0x00f0582d, 0x0060341d, 0x00c06030, 0x01308c41, 0x01d0b84d, 0x01b0a847, 0x01308840, 0x0230e48b,
+    0x0250f8ae, 0x01e0e09b, 0x0220f4bc, 0x0210d8b5, 0x01b0b4ae, 0x0190b0ae, 0x0200bd3e, 0x0270b9e1,
+    0x0160988b, 0x0190b475, 0x01c0c47d, 0x01b0bc62, 0x0170a04b, 0x0170ac52, 0x01309042, 0x00b04c24,
+    0x00f06430, 0x01308843, 0x01609846, 0x01b0ac4a, 0x0180983f, 0x01006c31, 0x0130883e, 0x01d0bc60,
+    0x02f11cd5, 0x03915d12, 0x03e1b53e, 0x04929de1, 0x04c31a37, 0x04d34665, 0x05239287, 0x05238680,
+    0x04b30e65, 0x0472c657, 0x0492e279, 0x052376bf, 0x07249f09, 0x0ab62747, 0x1017b777, 0x1518df87,
+    0x16591387, 0x14389377, 0x1127b757, 0x0e86ff3f, 0x0c36632f, 0x0b160f18, 0x0bc66320, 0x0d16bb20,
+    0x0bc5faf2, 0x08e4eab8, 0x0824c2b8, 0x0884facd, 0x06f436a9, 0x04b2ae11, 0x03513d1a, 0x01d0ac54,
+    0x00a04827, 0x0050281a, 0x00c05c2c, 0x0120883e, 0x01b0b04d, 0x01e0b84f, 0x01308440, 0x0210dc82,
+    0x02910cc6, 0x0210f0a7, 0x0210f4b8, 0x0200dcb1, 0x01b0bc97, 0x0180b49b, 0x0200bd3a, 0x0270b9e1,
+    0x0180a882, 0x0170ac5b, 0x01a0b867, 0x01b0b85e, 0x0110783b, 0x01209047, 0x0170a84e, 0x00b05427,
+    0x00c0582d, 0x01509045, 0x01a0a84c, 0x01d0b84f, 0x01b0a847, 0x01307835, 0x01308039, 0x0190a047,
+    0x01c0b450, 0x02e108ae, 0x0411bd48, 0x04322d98, 0x0472ba11, 0x04c32a57, 0x0543b28d, 0x0593e29b,
+    0x04f36680, 0x04b2fe6b, 0x04c2fe87, 0x04e32ab1, 0x05e3c2e3, 0x0774b318, 0x0b563b57, 0x1127e77f,
+    0x13a87b87, 0x12c82f77, 0x10d7b767, 0x0ec71347, 0x0b55fb20, 0x085522fa, 0x07a4c2d5, 0x08248ebf,
+    0x077416a2, 0x06d3e2a2, 0x08b4d6cd, 0x0c660efa, 0x09e522d5, 0x05031a65, 0x03a18983, 0x01d0ac5e,
+    0x00703822, 0x0040281b, 0x00a04c27, 0x01308c3e, 0x01a0b44e, 0x01b0b44f, 0x01609846, 0x01d0c46f,
+    0x02a118d5, 0x027110ca, 0x0200f0a7, 0x0200e8a7, 0x01c0c497, 0x0190b89e, 0x0210c930, 0x0280cddb,
+    0x0150a060, 0x0130984c, 0x01b0b462, 0x01a0b052, 0x01006833, 0x01207839, 0x01b0c062, 0x01007438,
+    0x00904024, 0x01508c43, 0x01b0b050, 0x01e0bc52, 0x0210cc57, 0x01809840, 0x01107034, 0x01809844,
+    0x01d0b850, 0x0280f091, 0x034138f8, 0x03b1a951, 0x043251db, 0x04a2fe3d, 0x05239287, 0x05b3e29b,
+    0x05b3d2a2, 0x0573929b, 0x054376a2, 0x054386b8, 0x0593a2dc, 0x06242709, 0x08852337, 0x0bc64f5f,
+    0x0e46ff6f, 0x0f07436f, 0x0e47135f, 0x0c667b3f, 0x09b56f10, 0x06f45ad5, 0x0603c29b, 0x06d3f2b1,
+    0x07d4b2f2, 0x0804faf2, 0x08550eeb, 0x0d967b18, 0x0f46d327, 0x08248edc, 0x042215db, 0x01c0b067,
+    0x0040301e, 0x00603c23, 0x00704825, 0x0190a445, 0x0270f07d, 0x0210d46d, 0x01c0b854, 0x01c0c46a,
+    0x02b11ce4, 0x02a11ce8, 0x0210f4ae, 0x01f0e89e, 0x01c0c48e, 0x01b0c0ab, 0x0210c923, 0x0280cdca,
+    0x0110944a, 0x0130944c, 0x0190ac54, 0x01308842, 0x01207837, 0x0110682f, 0x0190a84c, 0x01a0bc5e,
+    0x00d05c2e, 0x01207839, 0x01a0a84d, 0x01b0ac4e, 0x0200c85b, 0x01e0b84e, 0x01207837, 0x01307c39,
+    0x01d0b44c, 0x0250e077, 0x02a104b1, 0x03213905, 0x03e1e998, 0x0492d631, 0x04f37680, 0x05e3f2a2,
+    0x065436b8, 0x062416b8, 0x060406b8, 0x05e3d2c6, 0x05b3c2dc, 0x067416fa, 0x07d4c320, 0x09455b47,
+    0x0a75bf4f, 0x0bf64f57, 0x0c667b4f, 0x0a75d32f, 0x0804d701, 0x06d47edc, 0x06a426a9, 0x06d426d5,
+    0x0593665e, 0x0401c974, 0x045221ca, 0x05937694, 0x06d426dc, 0x0603a2b1, 0x0351514d, 0x00f06c3e,
+    0x0050341d, 0x00a0582d, 0x01007838, 0x01809c42, 0x02c10882, 0x02f124b1, 0x01f0d06d, 0x01d0c467,
+    0x02810cca, 0x03013d1a, 0x029118e4, 0x01f0e8a1, 0x01a0bc80, 0x01c0c8a4, 0x0220d50d, 0x0250c598,
+    0x0130984c, 0x0180a452, 0x0180a04b, 0x01107c3c, 0x01207436, 0x0100682f, 0x01207434, 0x01a0b450,
+    0x0190b454, 0x00f07438, 0x01709c47, 0x01c0b854, 0x01e0bc57, 0x0220d065, 0x0190a448, 0x01207c3a,
+    0x01a0a446, 0x0250d867, 0x0260ec88, 0x028100b5, 0x03718951, 0x0482c61e, 0x05239272, 0x062436a9,
+    0x06d47ec6, 0x06a45acd, 0x067436c6, 0x062416cd, 0x062406e3, 0x06d436fa, 0x07547f10, 0x0804d72f,
+    0x08b5373f, 0x09756f3f, 0x0a15ab3f, 0x09b58327, 0x08553709, 0x08b58309, 0x09158301, 0x07744acd,
+    0x06f3c2b1, 0x08544ab8, 0x07a426a9, 0x04a27a05, 0x03716574, 0x02f1252c, 0x01d0c48b, 0x00a04c2f,
+    0x0050341f, 0x00f07033, 0x0200d05b, 0x01f0c04f, 0x01e0b84a, 0x02d1149e, 0x02d11cbc, 0x01f0d880,
+    0x0200e094, 0x03214923, 0x03215123, 0x0230fcbf, 0x01c0cc8e, 0x01b0c49b, 0x01f0c8f8, 0x0220b583,
+    0x01609c50, 0x01308c43, 0x01308441, 0x01308c43, 0x00f06c33, 0x00e05c2a, 0x01607c35, 0x00f0602d,
+    0x01108440, 0x01a0bc5b, 0x01b0b450, 0x01e0c059, 0x01d0bc54, 0x0210cc62, 0x0200cc62, 0x01609445,
+    0x01609444, 0x0210c457, 0x0260e077, 0x0240e088, 0x03013501, 0x046291f9, 0x0523866b, 0x065436a9,
+    0x0724b2d5, 0x07249ed5, 0x06d47ecd, 0x067436dc, 0x06a436eb, 0x07246b01, 0x07549f10, 0x0804fb20,
+    0x0885372f, 0x0855232f, 0x09758337, 0x09b5bf2f, 0x09e5e720, 0x0bf68f2f, 0x0ca6bb2f, 0x0c366318,
+    0x0c360f10, 0x0bc60f18, 0x08e4fae3, 0x04e2b9f9, 0x031124f4, 0x0240e0ae, 0x01a0a860, 0x0090542e,
+    0x00a05c2e, 0x01007836, 0x02910085, 0x031130b5, 0x0150903f, 0x0180ac4c, 0x02b11cbf, 0x02b120ce,
+    0x0200e89e, 0x025100ce, 0x03417951, 0x02c12cfc, 0x01c0d097, 0x01b0c0ab, 0x01f0cd01, 0x0210b160,
+    0x00f07843, 0x00a04c2e, 0x01006c39, 0x01509046, 0x01107c3b, 0x0120682d, 0x01a08836, 0x01106029,
+    0x00803c1e, 0x01107c39, 0x01e0cc6d, 0x0260f491, 0x0220dc72, 0x01e0c05b, 0x0240e07a, 0x01d0bc59,
+    0x01308c43, 0x01b0ac4d, 0x0230d86d, 0x0220dc7a, 0x028100b8, 0x03d1f593, 0x04e35657, 0x062436a2,
+    0x0724b2cd, 0x0724b2cd, 0x06f47ecd, 0x06a45adc, 0x06f47ef2, 0x07249f01, 0x07a4d710, 0x08854720,
+    0x09459727, 0x0975bf2f, 0x0945ab2f, 0x0975bf27, 0x0b867b27, 0x0e472b37, 0x0f876f3f, 0x0ec7432f,
+    0x0e471320, 0x0bf63b01, 0x07d4b2bf, 0x0603b25e, 0x03f1dd74, 0x0260f4b8, 0x01308445, 0x00904c2b,
+    0x01609c46, 0x0170a045, 0x0260f880, 0x033150e4, 0x0190a84a, 0x01308c42, 0x0200e082, 0x028118ce,
+    0x02b130f8, 0x0210f8ca, 0x02811901, 0x03014935, 0x0250fcd1, 0x01e0d0c3, 0x01d0c0dd, 0x01d0a523,
+    0x00c04c42, 0x00703828, 0x00e06033, 0x01509044, 0x01709845, 0x01708035, 0x01707c31, 0x00f05825,
+    0x0070341a, 0x00f0642d, 0x01d0b84d, 0x0240e880, 0x0240f094, 0x0210e488, 0x0210dc80, 0x0230dc7a,
+    0x01a0b04f, 0x0170a04a, 0x0200d46f, 0x0230e080, 0x0220e08b, 0x03113d1a, 0x0472c611, 0x05b40687,
+    0x06f49ebf, 0x0754c2cd, 0x06d48ecd, 0x06a47edc, 0x06f48eeb, 0x07249efa, 0x07a4d709, 0x08854720,
+    0x08b58320, 0x08859720, 0x08e5bf18, 0x0ab66318, 0x0c36e720, 0x0dd72b37, 0x0f878737, 0x0f478727,
+    0x0d974320, 0x09e5aae3, 0x06741694, 0x05939265, 0x03f1dd83, 0x01f0c882, 0x00c05831, 0x00a05c2e,
+    0x01d0c85b, 0x0220e06f, 0x0260f888, 0x02b124ce, 0x0190bc5e, 0x01309845, 0x01d0d87d, 0x01c0d88e,
+    0x026118d9, 0x02812d09, 0x0210fce4, 0x02812116, 0x028114fc, 0x01c0ccae, 0x0190b0b5, 0x018098dd,
+    0x00c04c4a, 0x0040241e, 0x00904024, 0x0130843e, 0x01d0b04c, 0x01c0a03e, 0x01206c2d, 0x00c04c24,
+    0x0080381c, 0x01307835, 0x0210cc57, 0x0280f87d, 0x02710494, 0x025108b1, 0x0220f4a1, 0x0220e082,
+    0x0220dc7a, 0x01c0c060, 0x01e0cc6d, 0x0240e88e, 0x0220dc85, 0x027100bc, 0x03c1dd8e, 0x0523865e,
+    0x06d48eb1, 0x0774d6cd, 0x0724b2cd, 0x06f4b2dc, 0x0724c2eb, 0x0724c2f2, 0x0774eb01, 0x08553710,
+    0x08e59718, 0x08b5bf10, 0x08056eeb, 0x085546d5, 0x0a45fafa, 0x0d16e727, 0x0e86e727, 0x0d562710,
+    0x09e49edc, 0x06d33a8d, 0x05429257, 0x04820205, 0x0361314d, 0x01a0ac5e, 0x00804425, 0x00b05c2f,
+    0x01d0c85b, 0x02a10c9b, 0x02910c9b, 0x02510cae, 0x0160b862, 0x01309043, 0x01e0e082, 0x01c0e49e,
+    0x0220f8ab, 0x02811ce1, 0x021104e1, 0x01f0f0d9, 0x0240fcf8, 0x01f0dcd1, 0x01b0bcd9, 0x01b0acf0,
+    0x01206482, 0x00802c2f, 0x00602c1d, 0x01106c36, 0x0230cc5e, 0x0200b849, 0x0110642a, 0x00c04c26,
+    0x00904423, 0x0160943f, 0x0220d459, 0x0291007d, 0x030138ca, 0x03116d09, 0x02e13cf8, 0x025100b1,
+    0x0240f097, 0x0240f091, 0x0220e085, 0x0220e491, 0x0220ec9b, 0x0220e89e, 0x02f13509, 0x045285e7,
+    0x05e40687, 0x0774d6bf, 0x07d522d5, 0x07a4fae3, 0x0754eae3, 0x0724eaf2, 0x0774fb01, 0x08253710,
+    0x08e59710, 0x0885aafa, 0x0754d6bf, 0x05e32a2a, 0x04b1e9b4, 0x046195a9, 0x045165b4, 0x03e12198,
+    0x0391057e, 0x0380f96f, 0x0320d935, 0x0290b8d5, 0x0220bc8b, 0x01308842, 0x00804c26, 0x01007837,
+    0x01f0d062, 0x02b114ab, 0x02d128c3, 0x027124dd, 0x0170c875, 0x01309446, 0x01e0e48b, 0x01b0d891,
+    0x02510cb1, 0x02e138ec, 0x01f0ecb8, 0x01e0e8c6, 0x01f0e0e1, 0x0200e105, 0x01e0c90d, 0x0200b151,
+    0x01f0a160, 0x016070b1, 0x00703029, 0x00d0582b, 0x0210c862, 0x01f0c04f, 0x00f0642c, 0x00a04423,
+    0x00904424, 0x0170a043, 0x0210cc54, 0x0230e467, 0x02f138d9, 0x03419523, 0x02c12cd9, 0x0250fcab,
+    0x026108bc, 0x026104b5, 0x0250f8a7, 0x0240f0a4, 0x0220f09e, 0x0220eca1, 0x02a10cdd, 0x03618151,
+    0x04a2f211, 0x06544a94, 0x0754eabf, 0x07a50edc, 0x0774fae3, 0x07550ef2, 0x0754eaf2, 0x07a4fb01,
+    0x080536fa, 0x085582eb, 0x0975fafa, 0x0bc66301, 0x0a748e9b, 0x07a2ae37, 0x07522e17, 0x054181e1,
+    0x03e0f598, 0x0360cd6f, 0x0350c965, 0x02e0b912, 0x01c0905e, 0x00a05829, 0x00a0582a, 0x01609c41,
+    0x0260f87d, 0x02c120b1, 0x03115cf4, 0x02b15112, 0x0180cc75, 0x0170ac4e, 0x023100ae, 0x01f0f0ab,
+    0x0220f89b, 0x03418101, 0x02610cc3, 0x0130a87d, 0x0170c0b1, 0x01a0c4dd, 0x01e0ccf0, 0x0200bd27,
+    0x0230ad9e, 0x01b088f8, 0x00b04841, 0x00904026, 0x01b0a44b, 0x0200c85e, 0x00f0642e, 0x0060301d,
+    0x00a04c27, 0x0190a847, 0x01c0bc4c, 0x01e0c454, 0x028114bf, 0x028124d9, 0x01f0e488, 0x01f0d47a,
+    0x027104b1, 0x026108bf, 0x0240fcb1, 0x026100bc, 0x0230f4ae, 0x01e0d488, 0x0250fcc3, 0x03013927,
+    0x03a1b574, 0x04d31a24, 0x06244a94, 0x06f49ebf, 0x0774d6d5, 0x0774eae3, 0x0724eaeb, 0x0754faeb,
+    0x07d522e3, 0x088582f2, 0x0a463b10, 0x0c36e720, 0x0d96ff20, 0x0d95fafa, 0x0b1416bf, 0x09e2fea9,
+    0x0822528d, 0x05b19e44, 0x0521823d, 0x03f11d89, 0x01707848, 0x0050381d, 0x00e07033, 0x01c0bc4c,
+    0x0270fc80, 0x03013cd1, 0x03b20156, 0x02d1651a, 0x0170c067, 0x01d0cc65, 0x02811cd5, 0x023108c3,
+    0x01f0e897, 0x02c130e1, 0x02c130e8, 0x0130ac75, 0x00e09877, 0x0160b8bf, 0x01f0cd12, 0x0220d527,
+    0x0210a983, 0x01d0912c, 0x01507088, 0x00c04c36, 0x01509042, 0x0200d06d, 0x01007035, 0x00402418,
+    0x00c05c2d, 0x0180a848, 0x0190ac49, 0x01b0bc52, 0x0220f8a4, 0x01a0d488, 0x01008c49, 0x0180b05b,
+    0x0230eca1, 0x0250fcb5, 0x026104c3, 0x028114d9, 0x028118d9, 0x0200e89e, 0x01f0e097, 0x02f13116,
+    0x03516d51, 0x03b1bd79, 0x04b2f211, 0x05b3e280, 0x06745ab1, 0x06f4b2cd, 0x0724eadc, 0x077536e3,
+    0x07d55af2, 0x085596f2, 0x09b5fb01, 0x0b568f10, 0x0c66d318, 0x0c36a709, 0x09b55adc, 0x0723869b,
+    0x05e26e6b, 0x04e1de31, 0x044181ed, 0x02b0e8ca, 0x00b04c2a, 0x00604023, 0x0120883a, 0x0210d454,
+    0x0280fc80, 0x0391b50d, 0x0412798e, 0x027128e4, 0x0180bc65, 0x0240f488, 0x02a12ce1, 0x0210f8a4,
+    0x025110ca, 0x028124e4, 0x026118d9, 0x01a0d497, 0x00b0805b, 0x0120a49b, 0x01e0c523, 0x0230c56a,
+    0x01f0995b, 0x01a084dd, 0x01106854, 0x00c05834, 0x00f07037, 0x01a0b457, 0x01509446, 0x00402c1b,
+    0x00a0542c, 0x0180ac4c, 0x01a0b44f, 0x0170ac4f, 0x0190cc80, 0x0120a862, 0x0090683d, 0x0120984f,
+    0x01f0dc97, 0x0220f0ae, 0x025104c6, 0x026110d5, 0x02d13909, 0x02a11cdd, 0x0200e49b, 0x02b124fc,
+    0x0371896f, 0x0361816a, 0x0381956a, 0x045285ed, 0x0573c280, 0x06745ab8, 0x0724d6c6, 0x07d546dc,
+    0x085582f2, 0x0915bf01, 0x09b5fb01, 0x0a160f01, 0x0a162701, 0x09b5d2f2, 0x085522dc, 0x05e3d287,
+    0x04a2c62a, 0x042221e7, 0x03615d4d, 0x01a0a84d, 0x0050341d, 0x00a0582c, 0x01308c3d, 0x01e0c84f,
+    0x02d120a4, 0x03d2153a, 0x0351bd35, 0x020100b8, 0x0200e082, 0x02d12cc6, 0x03015d01, 0x0210ec91,
+    0x024110bf, 0x02d14105, 0x02510cc3, 0x01e0e4ab, 0x00f0986a, 0x00d08c75, 0x01b0b905, 0x0210b165,
+    0x01908cd1, 0x00f06443, 0x00a04c2d, 0x0090442c, 0x0080482c, 0x01007c40, 0x0160a44e, 0x00c05c30,
+    0x01007838, 0x01b0c45e, 0x0170a84c, 0x0130984a, 0x0130a857, 0x01109c59, 0x00a07043, 0x00d08047,
+    0x01c0cc85, 0x0210ecae, 0x024104ce, 0x027118ec, 0x02e14927, 0x03014916, 0x0220f4ae, 0x02b124f8,
+    0x03c1d598, 0x03b1c993, 0x0391b583, 0x03416d51, 0x03e209a9, 0x04e36651, 0x06244a9b, 0x0754eac6,
+    0x08b582e3, 0x09b5e6f2, 0x0a15fafa, 0x0a15faf2, 0x09b5d2f2, 0x091582f2, 0x0824fadc, 0x07246abf,
+    0x0603e28d, 0x04c2d62a, 0x03313d0d, 0x01107838, 0x0050381f, 0x00c0642f, 0x01308c3d, 0x01e0c854,
+    0x034164dd, 0x0371c91f, 0x026120ca, 0x022100ae, 0x02d124bc, 0x03b1dd23, 0x0371c927, 0x025104a4,
+    0x0220f8a1, 0x02d13d01, 0x025104b1, 0x01e0e09e, 0x0150b482, 0x00d08c75, 0x0190a8f8, 0x0200a96f,
+    0x00f07048, 0x00c0543f, 0x00e04c52, 0x0090403a, 0x00703c29, 0x00804c2d, 0x01509c4b, 0x01e0d472,
+    0x0190b859, 0x0160a84e, 0x01209045, 0x01008844, 0x0160ac5b, 0x01f0e49e, 0x0190d088, 0x00b07c44,
+    0x0100904d, 0x0210f0ae, 0x029128fc, 0x02913105, 0x02f1512c, 0x0351a956, 0x027114d1, 0x026108d5,
+    0x03f22dd0, 0x04325de7, 0x03e1f5b4, 0x0391bd93, 0x0301392c, 0x03516548, 0x0472ba05, 0x05b3f28d,
+    0x0774eac6, 0x091582eb, 0x09e5d2f2, 0x0a45faf2, 0x0a15e6f2, 0x0a45d2fa, 0x0a75bef2, 0x094546dc,
+    0x075436a2, 0x04e2ae0b, 0x02a104b1, 0x00a04c28, 0x00704024, 0x00b05c2f, 0x01208c3d, 0x0210dc65,
+    0x03316cf4, 0x0341a92c, 0x027124d1, 0x026108ae, 0x035178ec, 0x04125d56, 0x0371b51f, 0x029118b1,
+    0x0200e080, 0x02b134f4, 0x024104b5, 0x01b0cc80, 0x0180c88e, 0x0100a080, 0x0190b101, 0x0200a97e,
+    0x00a04838, 0x0130689e, 0x01306485, 0x00a04c3b, 0x00d0603b, 0x0100783d, 0x0150a44c, 0x0200e888,
+    0x0200dc80, 0x01008041, 0x00b06c3c, 0x01008849, 0x0200e89e, 0x03116d43, 0x03017948, 0x025118d9,
+    0x0170c46f, 0x0180bc6a, 0x0230fcb5, 0x029128fc, 0x02e14123, 0x0361a956, 0x02b130f0, 0x026108ce,
+    0x03e201ae, 0x0482ba11, 0x042251e1, 0x03d1f5ae, 0x03819d83, 0x02a110ec, 0x0260f0bc, 0x03919d65,
+    0x04e35644, 0x06744aa9, 0x07a4c2c6, 0x085522d5, 0x08e546dc, 0x091536dc, 0x097522dc, 0x08548ebf,
+    0x06537680, 0x0431f5a3, 0x01f0c062, 0x00804822, 0x00904c28, 0x0090602f, 0x01309842, 0x0230ec77,
+    0x02d134dd, 0x0341b53e, 0x02c13cf0, 0x0240fc9b, 0x03d1e91f, 0x04a2e18e, 0x03418916, 0x0261049e,
+    0x01b0bc5e, 0x025114c3, 0x023104b1, 0x0180bc72, 0x0190cc8e, 0x0160c09b, 0x01e0c91f, 0x0220a589,
+    0x00b0443d, 0x01205c7a, 0x00d05846, 0x00d06c3b, 0x01108445, 0x01209048, 0x01309c4c, 0x01209046,
+    0x01b0c05e, 0x0230f491, 0x01d0d075, 0x01e0d88e, 0x02c13516, 0x0371dd98, 0x03e245c4, 0x03e245b4,
+    0x0371e974, 0x02d14905, 0x027110bc, 0x02a124e8, 0x02b13112, 0x02f1411a, 0x029120dd, 0x02911ce4,
+    0x03f215b9, 0x0482ba11, 0x0482c617, 0x04326de7, 0x03b1d59e, 0x03415d48, 0x0240e4a4, 0x0180a05b,
+    0x0210e097, 0x03818943, 0x04b2d611, 0x05b3c28d, 0x067426b1, 0x06f416a9, 0x06a3d29b, 0x05b34679,
+    0x04a25e05, 0x02e114d5, 0x01108039, 0x00b05c2b, 0x0080582c, 0x00b07035, 0x01a0bc4e, 0x0240f882,
+    0x02c138ec, 0x02e15d09, 0x0230f88e, 0x0240f48b, 0x03e1f530, 0x0442796a, 0x0341810d, 0x0261049b,
+    0x01b0c059, 0x0220f8a1, 0x022100b5, 0x01a0c880, 0x0180c485, 0x01a0d0ab, 0x0210d130, 0x0220a583,
+    0x0080402d, 0x00c05440, 0x00e0683c, 0x00e06c37, 0x00e0743f, 0x00c07440, 0x00704c30, 0x00904c2b,
+    0x01309c49, 0x0210ec91, 0x02d130f4, 0x03216d3e, 0x0311795b, 0x0311816a, 0x0361bd83, 0x03c239b4,
+    0x03b245b4, 0x03b22198, 0x0351bd51, 0x02f16523, 0x02a128f4, 0x02911cdd, 0x024104b8, 0x02a11ce1,
+    0x04022dbf, 0x0482ba0b, 0x0472ba05, 0x044279f9, 0x03f209bf, 0x03618160, 0x02b10cd5, 0x0190a85b,
+    0x00904c2f, 0x0060281a, 0x01307034, 0x0270e891, 0x03413912, 0x03816543, 0x03513d30, 0x02c10cd9,
+    0x01f0c46f, 0x01309442, 0x01108439, 0x00f07435, 0x0090582d, 0x0160b04c, 0x0250f880, 0x0220f080,
+    0x029128dd, 0x0230fc9e, 0x01a0b44f, 0x029110a1, 0x03d1f530, 0x03b1e92c, 0x02f150f0, 0x0230f48b,
+    0x01c0c460, 0x01f0e48b, 0x01d0e897, 0x0180c47d, 0x0180c082, 0x01f0ecbc, 0x0240dd3a, 0x02109d83,
+    0x0130843d, 0x01609446, 0x01308840, 0x00f0743b, 0x00a05834, 0x00603828, 0x0090482b, 0x01309c49,
+    0x01b0c467, 0x02810cbf, 0x0371b56f, 0x0371bd8e, 0x0351a989, 0x0321896a, 0x0321b574, 0x038215ae,
+    0x040291f3, 0x04129df9, 0x03d22dae, 0x03419d4d, 0x029124e8, 0x027114ca, 0x0210ec97, 0x0230f4ab,
+    0x0381a974, 0x042245d6, 0x046291f3, 0x045285ed, 0x03f215ca, 0x03819574, 0x02e120f0, 0x01c0b465,
+    0x00a0482b, 0x0030100d, 0x00200808, 0x0050140e, 0x00601c12, 0x00501812, 0x00602015, 0x00804422,
+    0x01008439, 0x0160a446, 0x01309c43, 0x01008039, 0x01209041, 0x0200e46f, 0x01d0cc57, 0x0200e477,
+    0x02a128e1, 0x01c0d06d, 0x0160a048, 0x02d128b8, 0x0381a90d, 0x0361950d, 0x030150ec, 0x01f0dc6d,
+    0x01b0c460, 0x0200e891, 0x01e0e89b, 0x0190cc88, 0x0190c48b, 0x025108dd, 0x02910151, 0x0220a57e,
+    0x0190a047, 0x01509042, 0x01308840, 0x00c06033, 0x00503827, 0x0070402c, 0x01309048, 0x01b0c067,
+    0x0210e485, 0x02f130e4, 0x0381a95b, 0x03d209b4, 0x03a209ae, 0x03a239b9, 0x03e279e7, 0x0422ba05,
+    0x0432e20b, 0x0432c605, 0x041291ed, 0x0391f589, 0x024108c3, 0x01f0e89e, 0x01e0dc85, 0x0190b05e,
+    0x02d120f4, 0x03b1d5a3, 0x040221ca, 0x042245d6, 0x040221c4, 0x0371956f, 0x02c118ec, 0x01c0b460,
+    0x00a04428, 0x00300c0e, 0x0040140f, 0x00702c17, 0x00802c17, 0x0040100f, 0x0030100e, 0x00803c1f,
+    0x01309441, 0x01c0c452, 0x01c0c04f, 0x01a0b44a, 0x01f0d860, 0x01c0cc59, 0x01309842, 0x0231009b,
+    0x02b130e8, 0x01c0cc67, 0x0170a44a, 0x033148d9, 0x035178f4, 0x03316cfc, 0x03216cfc, 0x01c0c862,
+    0x01f0d475, 0x0200e894, 0x01c0e494, 0x01a0d48e, 0x0190c48e, 0x02c12cfc, 0x0311256a, 0x0210a174,
+    0x00d06035, 0x01608c40, 0x01308c42, 0x00906036, 0x00705433, 0x01309449, 0x01e0d06f, 0x0200e08e,
+    0x028100a1, 0x02b1089b, 0x03517927, 0x03d245c4, 0x03c251ca, 0x03f285ed, 0x0432adff, 0x0442c60b,
+    0x0442e217, 0x0432d60b, 0x0422adf3, 0x0361d56a, 0x022104c3, 0x0210f8ab, 0x01a0c872, 0x0110904c,
+    0x0230eca1, 0x03416d48, 0x03e1e9a9, 0x03d1f5ae, 0x03e201b9, 0x03819d74, 0x02a10cd9, 0x0190a04f,
+    0x00904426, 0x00401411, 0x0040100e, 0x00502013, 0x00702c18, 0x00602013, 0x00301410, 0x0060341e,
+    0x01208c3f, 0x01c0c454, 0x01f0d460, 0x0220e46d, 0x01f0d865, 0x01309c44, 0x0160ac49, 0x027118c3,
+    0x02a12ce8, 0x01d0d46f, 0x01c0c457, 0x03a1b50d, 0x0381a912, 0x030150f8, 0x03117909, 0x0200e47d,
+    0x01f0d475, 0x0210ec97, 0x01e0eca7, 0x0180cc8b, 0x01a0cc91, 0x02f14112, 0x03112d6f, 0x02009960,
+    0x0110743c, 0x0170a047, 0x01108c44, 0x0080643a, 0x00c0743e, 0x0210dc7a, 0x0260fca4, 0x0240f4a7,
+    0x02b110b1, 0x02c118b5, 0x03318143, 0x03b209b4, 0x03f239d6, 0x041251e1, 0x040279ed, 0x0422ba05,
+    0x04730e17, 0x0442c5ff, 0x04026dd0, 0x0301793a, 0x02210cd1, 0x025108bf, 0x01a0c47d, 0x0130ac67,
+    0x01e0d082, 0x02d11ce8, 0x0361956a, 0x0391b589, 0x03a1c98e, 0x03618160, 0x028100c3, 0x01509049,
+    0x00a04c28, 0x00702c19, 0x00501c13, 0x00501c13, 0x00602417, 0x00602016, 0x00501c13, 0x0060341d,
+    0x00d07436, 0x0170b44c, 0x0200e06d, 0x0210e872, 0x0190b44c, 0x01108c3f, 0x01a0c860, 0x02a130e1,
+    0x02e148f8, 0x0261049e, 0x0230f082, 0x0381c923, 0x03318901, 0x02e148ec, 0x0361bd35, 0x0220f097,
+    0x01a0bc65, 0x0200e48b, 0x023104c3, 0x01b0d8a4, 0x01f0e8b8, 0x03116530, 0x02e12574, 0x02009d65,
+    0x01609446, 0x01a0b052, 0x0160a454, 0x00d08044, 0x0180b452, 0x02b10c9b, 0x028104ab, 0x0250f097,
+    0x0270f894, 0x02b124e4, 0x03519d74, 0x03d1f5b4, 0x03e215c4, 0x040251db, 0x04026de7, 0x04129df9,
+    0x0422adff, 0x03e251ca, 0x0381dd83, 0x02813105, 0x0200f8b8, 0x025100bf, 0x0200ecab, 0x01b0dc9b,
+    0x0200d891, 0x0280fcae, 0x03013d1f, 0x03516d5b, 0x03416d43, 0x03013d23, 0x0260f4b1, 0x01508c47,
+    0x00a04426, 0x00602816, 0x00702c18, 0x0070281b, 0x00602c1c, 0x00502419, 0x00502016, 0x0060301d,
+    0x0090542c, 0x0130a046, 0x01f0e46d, 0x0240f882, 0x01a0c052, 0x01208c40, 0x01c0d875, 0x02a130dd,
+    0x0361a923, 0x02f138d9, 0x0230f88e, 0x0381f52c, 0x0351b509, 0x028124c6, 0x0311811a, 0x0210f097,
+    0x0180b860, 0x01e0dc82, 0x025110ce, 0x01e0f0c6, 0x024104e1, 0x02f15143, 0x02a1116f, 0x01e09556,
+    0x0180b04e, 0x01c0c06d, 0x0190b86a, 0x0160b057, 0x0240e46f, 0x02a0f880, 0x0190ac57, 0x0120904d,
+    0x01309c50, 0x0220f0ae, 0x0301413a, 0x03618979, 0x03a1d5a3, 0x03c201b9, 0x03d221c4, 0x03d22dc4,
+    0x0391f59e, 0x0361bd6a, 0x02c1491a, 0x01e0f4b5, 0x023100c6, 0x03015127, 0x027124f4, 0x0210f8c6,
+    0x02a114e1, 0x0280fcb1, 0x02a110ce, 0x0321492c, 0x03113d1f, 0x02c118e8, 0x0240dc97, 0x01508c46,
+    0x00803820, 0x00502012, 0x0080341e, 0x00702822, 0x0060281f, 0x00702c1c, 0x00602418, 0x0060341f,
+    0x00704425, 0x01208c3f, 0x01f0dc6a, 0x0240fc88, 0x01f0dc6a, 0x0160a447, 0x01d0e080, 0x027118bf,
+    0x03316cf4, 0x034164f8, 0x02b124c3, 0x03d22d48, 0x03b22148, 0x02e148f4, 0x03015101, 0x01f0e48e,
+    0x01c0cc72, 0x0220ec9b, 0x026114e1, 0x021100dd, 0x025110f4, 0x02a12d30, 0x0260ed60, 0x01e09151,
+    0x0180b859, 0x01f0d088, 0x01c0d080, 0x01c0c85e, 0x0270e05b, 0x02a0f87a, 0x01e0c46a, 0x01709c4e,
+    0x01509c54, 0x01009057, 0x00d08c4f, 0x0130b472, 0x01f0ecae, 0x025110dd, 0x029124f4, 0x028124ec,
+    0x026114d9, 0x022104c6, 0x0160cc8e, 0x0190d89b, 0x03118151, 0x0361d57e, 0x024114e4, 0x02c13512,
+    0x03a1c97e, 0x02d128f4, 0x0250f0a1, 0x02d124e8, 0x0311390d, 0x0280fcbc, 0x01d0bc6d, 0x0120783e,
+    0x0060281a, 0x0030140e, 0x0060281c, 0x0060242b, 0x00602427, 0x00602c1b, 0x00502417, 0x0060301d,
+    0x00503821, 0x00f07c38, 0x0210e872, 0x027110a1, 0x0251048e, 0x01e0d867, 0x0200f494, 0x0200f494,
+    0x0230f88e, 0x02a128d1, 0x02c130d9, 0x0442b983, 0x0452c593, 0x02e140f8, 0x02510cbf, 0x01e0e491,
+    0x024100ae, 0x027114d5, 0x02a12d12, 0x02711d16, 0x02712116, 0x02711527, 0x0220cd4d, 0x01e08556,
+    0x0170a859, 0x0200dc91, 0x01d0d87d, 0x0200d057, 0x02d0fc6f, 0x030120ae, 0x0270ec80, 0x0230cc60,
+    0x028104bf, 0x02811d09, 0x01f0f0c3, 0x0190d494, 0x01b0e097, 0x0200fcb8, 0x02310cd1, 0x025118e8,
+    0x02812d0d, 0x02712501, 0x0150c485, 0x021108c6, 0x03f25dc4, 0x02a1391a, 0x021108d9, 0x03b215a3,
+    0x0452c605, 0x03a1dd98, 0x02a114e1, 0x0270fcab, 0x02d120dd, 0x0260f4a7, 0x0190a854, 0x00f06435,
+    0x00602017, 0x0040140f, 0x00502417, 0x0060242d, 0x00702c36, 0x00703023, 0x00502016, 0x0060341d,
+    0x00604023, 0x00c06832, 0x0251048b, 0x02c128b5, 0x0230f07d, 0x02310094, 0x026120c6, 0x01e0ec85,
+    0x0190c460, 0x023100ab, 0x023100a7, 0x03e25d65, 0x0422ad89, 0x02811cca, 0x01e0e897, 0x01b0d07d,
+    0x026110ca, 0x026114e4, 0x02712509, 0x02812d27, 0x0261150d, 0x0251011f, 0x0210c14d, 0x01e0814d,
+    0x0160a857, 0x01d0d080, 0x01c0cc65, 0x0220c44a, 0x0311086f, 0x035138b5, 0x0270e472, 0x0230d077,
+    0x029114f8, 0x03014965, 0x03316d79, 0x03519d83, 0x0381d593, 0x03a201a9, 0x03e245ca, 0x041285e7,
+    0x0442c60b, 0x0361c979, 0x0180d097, 0x023110e1, 0x02f16d48, 0x01c0e8bc, 0x02e15135, 0x0472fe1e,
+    0x04731a24, 0x0442c605, 0x03a1f5a3, 0x02c120f8, 0x028100ae, 0x0280f89e, 0x01a0ac54, 0x00b0542e,
+    0x00501c15, 0x00501c12, 0x00702c16, 0x00602827, 0x00802c41, 0x00803431, 0x00502013, 0x0070341f,
+    0x00804c29, 0x00a0582c, 0x0220ec75, 0x02911497, 0x01d0c857, 0x0200e885, 0x027128ca, 0x0231089b,
+    0x0190c467, 0x0200f4a4, 0x01e0e491, 0x0351bd27, 0x03b2215b, 0x024100ab, 0x01d0e08e, 0x01b0d07d,
+    0x023104bf, 0x025114e4, 0x02712509, 0x0281292c, 0x0200f8f0, 0x0210e90d, 0x0210b156, 0x01d0794d,
+    0x01209049, 0x01a0c86d, 0x01e0cc5b, 0x0260c846, 0x03311477, 0x03011c91, 0x0220c059, 0x0240e09b,
+    0x02a11916, 0x02f13d65, 0x0341818e, 0x0391d5b4, 0x03d215d0, 0x040251ed, 0x041285ff, 0x0442c60b,
+    0x0442c611, 0x03018151, 0x0180d4a4, 0x021104e1, 0x02110cec, 0x020108dd, 0x03d251bf, 0x04b3924a,
+    0x0493562a, 0x0483461e, 0x0462fe11, 0x03d201c4, 0x02e11923, 0x0260d4b8, 0x01e0b86d, 0x00d0642f,
+    0x00401812, 0x00501c13, 0x00803c1c, 0x00903c25, 0x0090303b, 0x00802c31, 0x00502013, 0x0070381e,
+    0x0090542c, 0x00604427, 0x01a0b44b, 0x02610082, 0x01c0c050, 0x01c0d472, 0x027124c6, 0x028120ae,
+    0x01f0e885, 0x023104b1, 0x0190cc7a, 0x02d150f8, 0x03b21565, 0x026110bc, 0x01e0e08e, 0x01c0d888,
+    0x0210fcbf, 0x026118f0, 0x02a13523, 0x0271252c, 0x01d0e0d9, 0x01d0d0f4, 0x01f0a148, 0x01c06943,
+    0x01008846, 0x0190c467, 0x0230d454, 0x02d0f054, 0x03011482, 0x0250d862, 0x0200b459, 0x0250ecc3,
+    0x02911d2c, 0x02f1496a, 0x0361a99e, 0x03b1f5c4, 0x03e221db, 0x04025df3, 0x04129205, 0x04229e11,
+    0x04229205, 0x02d15d48, 0x01b0e8c6, 0x02d15148, 0x02d15148, 0x02f18156, 0x0493562a, 0x04325211,
+    0x0340fde1, 0x0300c1db, 0x02e0a1e1, 0x02c079e7, 0x02905dd0, 0x02604993, 0x02204d23, 0x01805c72,
+    0x00a03424, 0x0030140d, 0x00602c17, 0x00b04c26, 0x00a04430, 0x00702c24, 0x00602416, 0x00703c1f,
+    0x0090582d, 0x00604028, 0x01509843, 0x0230f077, 0x01d0cc57, 0x0210f085, 0x027120c3, 0x02d134c6,
+    0x02c134d1, 0x024110c6, 0x0130b062, 0x023110bf, 0x0341b543, 0x02610cbf, 0x01b0d485, 0x01d0e08e,
+    0x022108ce, 0x025114f4, 0x02b13d35, 0x02812530, 0x01b0ccc6, 0x01a0c0d5, 0x01e09535, 0x01b06143,
+    0x01309c4d, 0x01f0d872, 0x0260d84e, 0x02e1086d, 0x02c1047a, 0x0200b44d, 0x0210c47d, 0x0240ece1,
+    0x02a11d3e, 0x03317989, 0x03a1e9bf, 0x03e239e1, 0x04025df3, 0x04126dff, 0x0432ba17, 0x0452fe24,
+    0x0452e217, 0x03119574, 0x02411916, 0x03119574, 0x0361f5ae, 0x0402c5ed, 0x0452ae1e, 0x0310c5e7,
+    0x02501dd6, 0x024025b9, 0x02202598, 0x02202d98, 0x02503db9, 0x028049ca, 0x026041a9, 0x02303d6f,
+    0x01e03cfc, 0x01303057, 0x00802423, 0x00703418, 0x00904421, 0x0080341c, 0x00602417, 0x0070381e,
+    0x00b05c2e, 0x0080542e, 0x01309040, 0x01f0d460, 0x01a0b44d, 0x02410094, 0x03016501, 0x032178f4,
+    0x032178fc, 0x02410cbf, 0x0120a057, 0x01d0e897, 0x02c1410d, 0x025108bc, 0x01a0cc7d, 0x01c0e491,
+    0x024110e1, 0x02310cec, 0x02b1413a, 0x02912535, 0x01a0c0ca, 0x0180b4c6, 0x01e0951a, 0x01c0653e,
+    0x0180b85b, 0x0220d460, 0x0260cc49, 0x02d1006d, 0x0260d852, 0x0200b04d, 0x0210c897, 0x0240f501,
+    0x02e14160, 0x03a1e9b9, 0x03f245e7, 0x041285f9, 0x04229205, 0x0432c61e, 0x04630e2a, 0x04733a2a,
+    0x04730e24, 0x03c251e1, 0x0341ddb4, 0x03c25ded, 0x04532a31, 0x04a3763d, 0x03b12e1e, 0x029045ed,
+    0x025035ae, 0x0220317e, 0x02203174, 0x02102d6f, 0x02002d74, 0x02303598, 0x026041b4, 0x026041ae,
+    0x026041a9, 0x0250418e, 0x01f03912, 0x01303057, 0x00903425, 0x00703c1b, 0x0060301b, 0x0060341e,
+    0x00c05c2e, 0x00d06835, 0x01309042, 0x01b0bc4f, 0x01309442, 0x0210e477, 0x0381d530, 0x03c20948,
+    0x03419512, 0x024108bf, 0x01209c57, 0x0170c075, 0x025114d9, 0x023100b5, 0x01b0cc7a, 0x01d0e094,
+    0x02310cdd, 0x02511901, 0x02a13d35, 0x0251091f, 0x0190a8dd, 0x0160a4bf, 0x01909cf0, 0x01c06d3a,
+    0x01e0cc60, 0x0230d050, 0x0280e457, 0x0290e454, 0x0240bc48, 0x0200ac4f, 0x0200c8a4, 0x02911535,
+    0x0371b5a3, 0x040251e1, 0x042291ff, 0x0422ae0b, 0x0432c617, 0x04631a31, 0x0493463d, 0x04b36644,
+    0x04b36644, 0x0493463d, 0x04631a31, 0x04a3664a, 0x05041665, 0x0472862a, 0x02e099ca, 0x024021ae,
+    0x025039a3, 0x02303593, 0x0240359e, 0x02303598, 0x0220358e, 0x02203589, 0x0210317e, 0x02203589,
+    0x02503d9e, 0x026041a3, 0x0260418e, 0x02403d60, 0x01d034e1, 0x01303452, 0x00b03c29, 0x00703c1c,
+    0x00b0582b, 0x00e06c36, 0x01308c41, 0x0180a448, 0x00c06836, 0x0130a04b, 0x02e13cdd, 0x0361b52c,
+    0x02c14901, 0x021104bc, 0x0130ac5e, 0x0130a85e, 0x021100ca, 0x0220fcb8, 0x01b0d080, 0x01d0e094,
+    0x0200f8bf, 0x025118fc, 0x0251190d, 0x01e0d4ec, 0x01a09cfc, 0x01709cd1, 0x017098ce, 0x01a0712c,
+    0x0220d465, 0x0270e462, 0x0290e050, 0x0260bc43, 0x0220b045, 0x01e0a44e, 0x0220d8bf, 0x02e1356a,
+    0x03b1f5c4, 0x04329df9, 0x0452d611, 0x0452f21e, 0x04934637, 0x04c3864a, 0x04d3a251, 0x04e3d257,
+    0x0503e265, 0x0503e26b, 0x0523d26b, 0x05742679, 0x0503a257, 0x038101ed, 0x027031d0, 0x02a041ed,
+    0x029045f3, 0x02703de1, 0x02603dca, 0x02503db4, 0x0230399e, 0x02303993, 0x0230398e, 0x02103583,
+    0x0210357e, 0x02303598, 0x026039a3, 0x0260398e, 0x02503579, 0x02403560, 0x01e038f0, 0x01303c57,
+    0x00f06035, 0x00f07433, 0x0130883f, 0x01509845, 0x00905832, 0x00905c36, 0x01c0c862, 0x02710cab,
+    0x025110ca, 0x022104c3, 0x0180bc6a, 0x0160b86a, 0x0220fcce, 0x0230fcbf, 0x01b0cc7d, 0x01e0e8a1,
+    0x01f0f4b5, 0x01f0f4d1, 0x0220f8f0, 0x01b0c0d9, 0x01b0a112, 0x018094e8, 0x01308cb8, 0x01807101,
+    0x0290fc88, 0x0280e865, 0x0260cc49, 0x0240b440, 0x0210a844, 0x01e0a857, 0x0260f0e4, 0x03518198,
+    0x041251e1, 0x0472fe17, 0x04934631, 0x04c3763d, 0x0503c24a, 0x05440665, 0x05442672, 0x05944a79,
+    0x05b44a87, 0x05b42687, 0x05e45a87, 0x05b43680, 0x03f1421e, 0x028045d6, 0x02803df3, 0x02b04e0b,
+    0x02d04e24, 0x02c04e11, 0x029045ed, 0x027041db, 0x02603dd0, 0x02603dca, 0x02603dbf, 0x025035b4,
+    0x023035a9, 0x02203598, 0x0230359e, 0x025039ae, 0x026039a3, 0x02503989, 0x02403979, 0x02103543,
+    0x01d040ce, 0x0130544d, 0x00f07c39, 0x0110883b, 0x00905430, 0x0060482e, 0x00d06c39, 0x0160ac54,
+    0x01e0f0a4, 0x01d0e89b, 0x0160b45b, 0x01a0d085, 0x023108e4, 0x0200ecb5, 0x01a0c47a, 0x01c0dc97,
+    0x01a0d89e, 0x01b0e4bf, 0x0200f0f8, 0x01d0c101, 0x01d09927, 0x01a08901, 0x013080ab, 0x013068d1,
+    0x0270e87d, 0x0270d85b, 0x0280d04d, 0x0280c84a, 0x0210b44a, 0x01e0b06a, 0x02b1191f, 0x03b1f5c4,
+    0x04529dff, 0x04b34631, 0x04e3a244, 0x0523d251, 0x05b41665, 0x05e45a79, 0x06247e87, 0x06a49e94,
+    0x06749e9b, 0x06549e9b, 0x06d4fa9b, 0x04a25244, 0x02d079e1, 0x02702de1, 0x02b049ff, 0x02b04e17,
+    0x02b04e24, 0x02b04e11, 0x02a045ff, 0x02a045f3, 0x029045ed, 0x029045ed, 0x029041e7, 0x028041db,
+    0x028039db, 0x027039d6, 0x02703dca, 0x025035b9, 0x025035bf, 0x02703db9, 0x02703da3, 0x02403565,
+    0x02203556, 0x02203d3e, 0x01d058c6, 0x01306c57, 0x00905431, 0x0050442a, 0x00704c2f, 0x0130a04e,
+    0x01f0f0a4, 0x0190c87a, 0x0130a857, 0x01c0d891, 0x02310ce4, 0x01f0e8ae, 0x01e0dc91, 0x01e0e4a7,
+    0x0170c897, 0x0190d4b1, 0x0200e0f4, 0x01e0ad1f, 0x01a07530, 0x0190790d, 0x013088bf, 0x013068ce,
+    0x0280f09b, 0x0280d454, 0x02c0ec5e, 0x02d0f877, 0x0220bc52, 0x0200c07d, 0x02f1354d, 0x040245e1,
+    0x04930e17, 0x04f39244, 0x0523e251, 0x05b4165e, 0x06245a79, 0x06749e87, 0x06d4c294, 0x06f4eaa2,
+    0x06d4eaa9, 0x072536b1, 0x06546a8d, 0x03e11a1e, 0x028031e1, 0x02a045f9, 0x02c04e17, 0x02c04e24,
+    0x02b04e17, 0x02b04e0b, 0x02b04a05, 0x02b04a05, 0x02b04a05, 0x02b04a0b, 0x02b04a0b, 0x02a049ff,
+    0x02a045f9, 0x02a045f9, 0x029041ed, 0x027039d6, 0x025035bf, 0x026039d0, 0x028041db, 0x02703db4,
+    0x026039a9, 0x02803dd6, 0x028041f3, 0x027045c4, 0x019044b5, 0x00703c31, 0x00704c2c, 0x01b0c065,
+    0x0220f4a7, 0x0130ac62, 0x0120a057, 0x01a0d491, 0x0210fcce, 0x0210f0b5, 0x0200e8a1, 0x0200e8b5,
+    0x01b0d8b5, 0x0180ccb5, 0x01c0c0f0, 0x01b0911a, 0x01a06923, 0x0190710d, 0x016084d5, 0x016074e1,
+    0x02a10cb8, 0x02a0ec6a, 0x02c0f065, 0x02a0e86d, 0x0210b450, 0x0220cc91, 0x03315d6f, 0x044291f9,
+    0x04d3662a, 0x0543e251, 0x05940657, 0x05e43665, 0x06247e80, 0x06a49e8d, 0x06d4c28d, 0x06d4c29b,
+    0x0674c2a2, 0x07255aa9, 0x0502f25e, 0x031099f3, 0x029035f9, 0x02c04e17, 0x02c04e1e, 0x02b04e11,
+    0x02b04e0b, 0x02c04a0b, 0x02b04a0b, 0x02b04a05, 0x02b04a0b, 0x02c04e17, 0x02c04e1e, 0x02b04e11,
+    0x02b04e0b, 0x02b0460b, 0x02a04605, 0x02a045ff, 0x029041ed, 0x02a04a05, 0x02a04a0b, 0x028041f3,
+    0x029045e7, 0x028045bf, 0x02603da9, 0x027039c4, 0x027039ca, 0x016030a4, 0x00a05433, 0x01a0c867,
+    0x01e0e89b, 0x0120a059, 0x01009452, 0x0190d08e, 0x024114e4, 0x023104ca, 0x01f0e4a1, 0x0210f0c3,
+    0x01c0e0bf, 0x01a0d0ce, 0x01c0a90d, 0x01b0791f, 0x01906516, 0x01806905, 0x017084e8, 0x01707cf0,
+    0x0290f891, 0x02a0e460, 0x02e1007a, 0x02b0f47a, 0x0200b052, 0x0230d4a7, 0x03618989, 0x0482d605,
+    0x05038637, 0x0543d24a, 0x0573f251, 0x0573f25e, 0x05b4266b, 0x06546a80, 0x06749e87, 0x06a4b294,
+    0x06d4eaa2, 0x0674c29b, 0x04216631, 0x029041ed, 0x02c04e1e, 0x02d05a2a, 0x02d0561e, 0x02b04e0b,
+    0x02b04a05, 0x02b04a05, 0x02b04a0b, 0x02b04a0b, 0x02e04e11, 0x02c04e17, 0x02c04e1e, 0x02c04e11,
+    0x02b04e11, 0x02b04e11, 0x02b0460b, 0x02a041ff, 0x02b04205, 0x02a0460b, 0x02b04a11, 0x02c04e17,
+    0x02b04a05, 0x02a04de1, 0x027049a3, 0x0230356f, 0x02402d98, 0x02002d4d, 0x01305c6d, 0x0190c45b,
+    0x01c0d485, 0x01109852, 0x00f08c4f, 0x01a0d08b, 0x02c14116, 0x029128fc, 0x01b0d097, 0x0210f4ca,
+    0x023108e8, 0x01d0cce8, 0x01a08112, 0x01a0651a, 0x0190610d, 0x01706105, 0x01707cf8, 0x018074f8,
+};
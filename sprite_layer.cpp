@@ -0,0 +1,364 @@
+#include <algorithm>
+#include <cstring>
+
+#include "lvgl/src/draw/lv_draw.h"
+#include "lvgl/src/misc/lv_area_private.h"
+#include "lvgl/src/misc/lv_math.h"
+
+#include "sprite_layer.hpp"
+
+/**
+ * @brief Blends one sprite row into a layer row.
+ *
+ * @param dst First destination pixel.
+ * @param sprite Sprite, its image and palette.
+ * @param src_row Row within the sprite image.
+ * @param src_x First column within the sprite image.
+ * @param n Number of pixels.
+ */
+template <lv_color_format_t CF>
+static void blit_row(uint8_t *dst, const Sprite &sprite, int32_t src_row, int32_t src_x, int32_t n)
+{
+    constexpr int32_t px = CF == LV_COLOR_FORMAT_RGB888 ? 3 : 4;
+    const SpriteImage &image = *sprite.image;
+    bool indexed = image.format == SPRITE_FORMAT_INDEXED8;
+    const uint8_t *indices = indexed ? image.data + src_row * image.width + src_x : nullptr;
+    const lv_color32_t *colours = indexed ? nullptr : reinterpret_cast<const lv_color32_t *>(image.data) + src_row * image.width + src_x;
+    const lv_color32_t *palette = sprite.palette != nullptr ? sprite.palette : image.palette;
+    uint32_t opa = sprite.opa;
+
+    for (int32_t i = 0; i < n; i++, dst += px)
+    {
+        // The same arithmetic as LVGL's image blending, so a sprite looks like an lv_image
+        lv_color32_t c = indexed ? palette[indices[i]] : colours[i];
+        uint32_t a = opa >= LV_OPA_MAX ? c.alpha : LV_OPA_MIX2(c.alpha, opa);
+        if (a == LV_OPA_TRANSP)
+        {
+            continue;
+        }
+        if (a >= LV_OPA_MAX)
+        {
+            dst[0] = c.blue;
+            dst[1] = c.green;
+            dst[2] = c.red;
+            if (px == 4)
+            {
+                dst[3] = 0xff;
+            }
+            continue;
+        }
+
+        uint32_t da = CF == LV_COLOR_FORMAT_ARGB8888 ? dst[3] : 0xff;
+        if (da == 0xff)
+        {
+            uint32_t inv = 255 - a;
+            dst[0] = (c.blue * a + dst[0] * inv) >> 8;
+            dst[1] = (c.green * a + dst[1] * inv) >> 8;
+            dst[2] = (c.red * a + dst[2] * inv) >> 8;
+        }
+        else
+        {
+            // Transparent destination of an intermediate layer: a over da
+            uint32_t dw = LV_UDIV255(da * (255 - a));
+            uint32_t out = a + dw;
+            dst[0] = (c.blue * a + dst[0] * dw) / out;
+            dst[1] = (c.green * a + dst[1] * dw) / out;
+            dst[2] = (c.red * a + dst[2] * dw) / out;
+            dst[3] = out;
+        }
+    }
+}
+
+bool SpriteLayer::create(lv_obj_t *parent, int32_t width, int32_t height, uint16_t capacity, SceneArena::Region &memory)
+{
+    count = capacity;
+    this->height = height;
+    sprites = memory.allocate<Sprite>(count);
+    drawn = memory.allocate<Box>(count);
+    order = memory.allocate<uint16_t>(count);
+    rank = memory.allocate<uint16_t>(count);
+    visible = memory.allocate<uint16_t>(count);
+    active = memory.allocate<uint16_t>(count);
+    merged = memory.allocate<uint16_t>(count);
+    row_start = memory.allocate<uint16_t>(height + 1);
+    dirty = memory.allocate<uint16_t>(count);
+    dirty_flag = memory.allocate<uint8_t>(count);
+    if (sprites == nullptr || drawn == nullptr || order == nullptr || rank == nullptr || visible == nullptr || active == nullptr ||
+        merged == nullptr || row_start == nullptr || dirty == nullptr || dirty_flag == nullptr)
+    {
+        return false;
+    }
+
+    for (uint16_t i = 0; i < count; i++)
+    {
+        sprites[i].opa = LV_OPA_COVER;
+        drawn[i] = {0, 0, -1, -1};
+    }
+    dirty_count = 0;
+    order_valid = false;
+    stats = {};
+
+    obj = lv_obj_create(parent);
+    lv_obj_remove_style_all(obj);
+    lv_obj_remove_flag(obj, static_cast<lv_obj_flag_t>(LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE));
+    lv_obj_set_size(obj, width, height);
+    lv_obj_add_event_cb(obj, draw_event, LV_EVENT_DRAW_MAIN, this);
+    lv_obj_add_event_cb(obj, delete_event, LV_EVENT_DELETE, this);
+    return true;
+}
+
+void SpriteLayer::touch(uint16_t index)
+{
+    if (!dirty_flag[index])
+    {
+        dirty_flag[index] = 1;
+        dirty[dirty_count++] = index;
+    }
+}
+
+void SpriteLayer::set_image(uint16_t index, const SpriteImage *image)
+{
+    if (sprites[index].image != image)
+    {
+        touch(index);
+        sprites[index].image = image;
+    }
+}
+
+void SpriteLayer::set_palette(uint16_t index, const lv_color32_t *palette)
+{
+    if (sprites[index].palette != palette)
+    {
+        touch(index);
+        sprites[index].palette = palette;
+    }
+}
+
+void SpriteLayer::set_position(uint16_t index, int16_t x, int16_t y)
+{
+    if (sprites[index].x != x || sprites[index].y != y)
+    {
+        touch(index);
+        sprites[index].x = x;
+        sprites[index].y = y;
+    }
+}
+
+void SpriteLayer::set_z(uint16_t index, int16_t z)
+{
+    if (sprites[index].z != z)
+    {
+        touch(index);
+        sprites[index].z = z;
+        order_valid = false;
+    }
+}
+
+void SpriteLayer::set_opa(uint16_t index, lv_opa_t opa)
+{
+    if (sprites[index].opa != opa)
+    {
+        touch(index);
+        sprites[index].opa = opa;
+    }
+}
+
+void SpriteLayer::invalidate()
+{
+    stats.dirty = dirty_count;
+    if (obj == nullptr || dirty_count == 0)
+    {
+        return;
+    }
+
+    lv_area_t coords;
+    lv_obj_get_coords(obj, &coords);
+    bool each = dirty_count <= SPRITE_LAYER_DIRTY_AREAS;
+    Box bounds = {INT16_MAX, INT16_MAX, INT16_MIN, INT16_MIN};
+    for (uint16_t k = 0; k < dirty_count; k++)
+    {
+        uint16_t i = dirty[k];
+        dirty_flag[i] = 0;
+        Box areas[2] = {drawn[i], box_of(sprites[i])};
+        drawn[i] = areas[1];
+        for (const Box &b : areas)
+        {
+            if (b.x2 < b.x1)
+            {
+                continue;
+            }
+            if (each)
+            {
+                lv_area_t a = {coords.x1 + b.x1, coords.y1 + b.y1, coords.x1 + b.x2, coords.y1 + b.y2};
+                lv_obj_invalidate_area(obj, &a);
+            }
+            else
+            {
+                bounds = {std::min(bounds.x1, b.x1), std::min(bounds.y1, b.y1), std::max(bounds.x2, b.x2), std::max(bounds.y2, b.y2)};
+            }
+        }
+    }
+    dirty_count = 0;
+
+    if (!each && bounds.x1 <= bounds.x2)
+    {
+        lv_area_t a = {coords.x1 + bounds.x1, coords.y1 + bounds.y1, coords.x1 + bounds.x2, coords.y1 + bounds.y2};
+        lv_obj_invalidate_area(obj, &a);
+    }
+}
+
+void SpriteLayer::sort()
+{
+    for (uint16_t i = 0; i < count; i++)
+    {
+        order[i] = i;
+    }
+    // Ties are broken by the index, so std::sort gives a stable order without a temporary buffer
+    std::sort(order, order + count, [this](uint16_t a, uint16_t b) { return sprites[a].z != sprites[b].z ? sprites[a].z < sprites[b].z : a < b; });
+    for (uint16_t k = 0; k < count; k++)
+    {
+        rank[order[k]] = k;
+    }
+    order_valid = true;
+}
+
+void SpriteLayer::draw_event(lv_event_t *e)
+{
+    static_cast<SpriteLayer *>(lv_event_get_user_data(e))->draw(lv_event_get_layer(e));
+}
+
+void SpriteLayer::delete_event(lv_event_t *e)
+{
+    static_cast<SpriteLayer *>(lv_event_get_user_data(e))->obj = nullptr;
+}
+
+void SpriteLayer::draw(lv_layer_t *layer)
+{
+    stats.sprites = 0;
+    stats.rows = 0;
+    stats.pixels = 0;
+
+    lv_area_t coords;
+    lv_obj_get_coords(obj, &coords);
+    lv_area_t clip;
+    if (!lv_area_intersect(&clip, &layer->_clip_area, &coords))
+    {
+        return;
+    }
+
+    lv_color_format_t cf = layer->color_format;
+    if (cf != LV_COLOR_FORMAT_RGB888 && cf != LV_COLOR_FORMAT_XRGB8888 && cf != LV_COLOR_FORMAT_ARGB8888)
+    {
+        LV_LOG_WARN("sprite layer: unsupported colour format %d", cf);
+        return;
+    }
+
+    // The sprites are written into the buffer right away, so everything queued below them must be drawn first
+    while (layer->draw_task_head)
+    {
+        lv_draw_dispatch_wait_for_request();
+        lv_draw_dispatch();
+    }
+    if (lv_draw_layer_alloc_buf(layer) == nullptr)
+    {
+        return;
+    }
+
+    if (!order_valid)
+    {
+        sort();
+    }
+
+    // Clip area relative to the layer object
+    int32_t cx1 = clip.x1 - coords.x1;
+    int32_t cx2 = clip.x2 - coords.x1;
+    int32_t cy1 = clip.y1 - coords.y1;
+    int32_t cy2 = std::min<int32_t>(clip.y2 - coords.y1, height - 1);
+    int32_t rows = cy2 - cy1 + 1;
+    if (rows <= 0)
+    {
+        return;
+    }
+
+    // Bucket the sprites intersecting the clip area by their first row in it, in z-order within each row
+    memset(row_start, 0, (rows + 1) * sizeof(uint16_t));
+    uint16_t n = 0;
+    for (uint16_t k = 0; k < count; k++)
+    {
+        uint16_t i = order[k];
+        Box b = box_of(sprites[i]);
+        if (b.x2 < cx1 || b.x1 > cx2 || b.y2 < cy1 || b.y1 > cy2)
+        {
+            continue;
+        }
+        merged[n++] = i;
+        row_start[std::max<int32_t>(b.y1, cy1) - cy1 + 1]++;
+    }
+    for (int32_t r = 0; r < rows; r++)
+    {
+        row_start[r + 1] += row_start[r];
+    }
+    for (uint16_t k = 0; k < n; k++)
+    {
+        uint16_t i = merged[k];
+        visible[row_start[std::max<int32_t>(sprites[i].y, cy1) - cy1]++] = i;
+    }
+    // row_start[r] now holds the end of row r, shift back to starts
+    for (int32_t r = rows; r > 0; r--)
+    {
+        row_start[r] = row_start[r - 1];
+    }
+    row_start[0] = 0;
+    stats.sprites = n;
+
+    // Sweep the rows, the active list holds the sprites covering the row in z-order
+    uint16_t n_active = 0;
+    for (int32_t r = 0; r < rows; r++)
+    {
+        int32_t y = cy1 + r;
+        uint16_t s = row_start[r];
+        uint16_t e = row_start[r + 1];
+        if (s < e)
+        {
+            uint16_t a = 0;
+            uint16_t m = 0;
+            while (a < n_active || s < e)
+            {
+                merged[m++] = s == e || (a < n_active && rank[active[a]] < rank[visible[s]]) ? active[a++] : visible[s++];
+            }
+            std::swap(active, merged);
+            n_active = m;
+        }
+
+        uint8_t *row = static_cast<uint8_t *>(lv_draw_layer_go_to_xy(layer, 0, coords.y1 + y - layer->buf_area.y1));
+        uint16_t keep = 0;
+        for (uint16_t k = 0; k < n_active; k++)
+        {
+            uint16_t i = active[k];
+            const Sprite &sprite = sprites[i];
+            int32_t x1 = std::max<int32_t>(sprite.x, cx1);
+            int32_t x2 = std::min<int32_t>(sprite.x + sprite.image->width - 1, cx2);
+            uint8_t *dst = row + (coords.x1 + x1 - layer->buf_area.x1) * (cf == LV_COLOR_FORMAT_RGB888 ? 3 : 4);
+            switch (cf)
+            {
+            case LV_COLOR_FORMAT_RGB888:
+                blit_row<LV_COLOR_FORMAT_RGB888>(dst, sprite, y - sprite.y, x1 - sprite.x, x2 - x1 + 1);
+                break;
+            case LV_COLOR_FORMAT_XRGB8888:
+                blit_row<LV_COLOR_FORMAT_XRGB8888>(dst, sprite, y - sprite.y, x1 - sprite.x, x2 - x1 + 1);
+                break;
+            default:
+                blit_row<LV_COLOR_FORMAT_ARGB8888>(dst, sprite, y - sprite.y, x1 - sprite.x, x2 - x1 + 1);
+                break;
+            }
+            stats.rows++;
+            stats.pixels += x2 - x1 + 1;
+
+            if (sprite.y + sprite.image->height - 1 > y)
+            {
+                active[keep++] = i; // Still covers the next row
+            }
+        }
+        n_active = keep;
+    }
+}
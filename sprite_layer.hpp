@@ -0,0 +1,148 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "lvgl/src/core/lv_obj.h"
+#include "lvgl/src/misc/lv_color.h"
+
+#include "scene_arena.hpp"
+
+// A layer of many small sprites, drawn by one LVGL object's own draw handler row by row instead of
+// one lv_image, draw task and blend call per sprite.
+
+#define SPRITE_LAYER_DIRTY_AREAS 8 ///< Changed sprites invalidated one by one, above this their bounding box is invalidated once
+
+/// @brief Pixel format of a sprite image
+enum SpriteFormat : uint8_t
+{
+    SPRITE_FORMAT_INDEXED8, ///< One byte per pixel, an index into a palette of lv_color32_t with alpha
+    SPRITE_FORMAT_ARGB8888, ///< lv_color32_t per pixel
+};
+
+/// @brief Pixels shared by any number of sprites
+struct SpriteImage
+{
+    const uint8_t *data; ///< Rows without padding
+    const lv_color32_t *palette; ///< Default palette of an indexed image
+    uint16_t width;
+    uint16_t height;
+    SpriteFormat format;
+};
+
+/// @brief State of one sprite
+struct Sprite
+{
+    const SpriteImage *image;    ///< nullptr hides the sprite
+    const lv_color32_t *palette; ///< Replaces the image's palette, nullptr for the image's own
+    int16_t x;                   ///< Left edge relative to the layer
+    int16_t y;                   ///< Top edge relative to the layer
+    int16_t z;                   ///< Higher is drawn on top, equal z in index order
+    lv_opa_t opa;
+};
+
+/// @brief Counters of the last draw of the layer
+struct SpriteLayerInfo
+{
+    uint32_t sprites; ///< Sprites intersecting the redrawn area
+    uint32_t rows;    ///< Sprite rows blitted
+    uint32_t pixels;  ///< Pixels blitted
+    uint32_t dirty;   ///< Sprites changed since the previous invalidate()
+};
+
+/**
+ * @brief Sprite layer widget.
+ *
+ * Change sprites with the setters, then call invalidate() once per frame before LVGL refreshes.
+ * The layer draws into RGB888, XRGB8888 and ARGB8888 buffers, so it also works inside an
+ * intermediate layer, e.g. during a fade.
+ */
+class SpriteLayer
+{
+private:
+    struct Box
+    {
+        int16_t x1, y1, x2, y2; ///< Inclusive, x2 < x1 for an empty box
+    };
+
+    lv_obj_t *obj = nullptr;
+    Sprite *sprites = nullptr;
+    Box *drawn = nullptr;     ///< Area of each sprite at the last invalidate(), relative to the layer
+    uint16_t *order = nullptr; ///< Sprite indices sorted by z
+    uint16_t *rank = nullptr;  ///< Position of each sprite in order
+    uint16_t *visible = nullptr; ///< Scratch: sprites intersecting the clip area, by start row
+    uint16_t *active = nullptr;  ///< Scratch: sprites covering the current row, in z-order
+    uint16_t *merged = nullptr;  ///< Scratch: active list with the sprites starting on the current row merged in
+    uint16_t *row_start = nullptr; ///< Scratch: first entry of each row in visible
+    uint16_t *dirty = nullptr;   ///< Sprites changed since the last invalidate()
+    uint8_t *dirty_flag = nullptr;
+    uint16_t count = 0;
+    uint16_t dirty_count = 0;
+    uint16_t height = 0;
+    bool order_valid = false;
+    SpriteLayerInfo stats = {};
+
+    static void draw_event(lv_event_t *e);
+    static void delete_event(lv_event_t *e);
+    void draw(lv_layer_t *layer);
+    void sort();
+    void touch(uint16_t index);
+
+    /// @brief Area covered by a sprite, relative to the layer.
+    Box box_of(const Sprite &sprite) const
+    {
+        if (sprite.image == nullptr || sprite.opa <= LV_OPA_MIN)
+        {
+            return {0, 0, -1, -1};
+        }
+        return {sprite.x, sprite.y, static_cast<int16_t>(sprite.x + sprite.image->width - 1), static_cast<int16_t>(sprite.y + sprite.image->height - 1)};
+    }
+
+public:
+    /**
+     * @brief Creates the layer object and allocates the sprites.
+     *
+     * All sprites start hidden. The memory must stay valid until the object is deleted.
+     *
+     * @param parent Parent object.
+     * @param width Width of the layer in pixels.
+     * @param height Height of the layer in pixels.
+     * @param capacity Number of sprites, at most 65535.
+     * @param memory Arena region for the sprite state.
+     * @return false if memory could not be allocated.
+     */
+    bool create(lv_obj_t *parent, int32_t width, int32_t height, uint16_t capacity, SceneArena::Region &memory);
+
+    void set_image(uint16_t index, const SpriteImage *image);
+    void set_palette(uint16_t index, const lv_color32_t *palette);
+    void set_position(uint16_t index, int16_t x, int16_t y);
+    void set_z(uint16_t index, int16_t z);
+    void set_opa(uint16_t index, lv_opa_t opa);
+
+    const Sprite &get(uint16_t index) const
+    {
+        return sprites[index];
+    }
+
+    uint16_t capacity() const
+    {
+        return count;
+    }
+
+    /**
+     * @brief Invalidates the old and new areas of all sprites changed since the last call.
+     *
+     * Call once per frame after moving the sprites.
+     */
+    void invalidate();
+
+    lv_obj_t *get_obj() const
+    {
+        return obj;
+    }
+
+    const SpriteLayerInfo &info() const
+    {
+        return stats;
+    }
+};
@@ -0,0 +1,154 @@
+#include "lvgl/src/core/lv_obj.h"
+#include "lvgl/src/display/lv_display.h"
+
+#include "sprite_swarm.hpp"
+#include "scene_random.hpp"
+
+static const lv_color32_t base_colours[SPRITE_SWARM_PALETTES] = {
+    {60, 60, 230, 255},  // red (blue, green, red, alpha)
+    {60, 220, 60, 255},  // green
+    {230, 110, 40, 255}, // blue
+    {40, 210, 240, 255}, // yellow
+    {220, 60, 220, 255}, // magenta
+    {230, 220, 40, 255}, // cyan
+};
+
+bool SpriteSwarm::create_images(SceneArena::Region &memory)
+{
+    for (int s = 0; s < SPRITE_SWARM_SIZES; s++)
+    {
+        int size = 5 + 2 * s;
+        uint8_t *data = memory.allocate<uint8_t>(size * size);
+        if (data == nullptr)
+        {
+            return false;
+        }
+
+        // Doubled coordinates relative to the centre, so odd sizes stay integral
+        for (int y = 0; y < size; y++)
+        {
+            for (int x = 0; x < size; x++)
+            {
+                int cx = 2 * x + 1 - size;
+                int cy = 2 * y + 1 - size;
+                int d2 = cx * cx + cy * cy;
+                uint8_t index = 0; // Outside
+                if (d2 <= (size - 2) * (size - 2))
+                {
+                    // Shade by the distance from a highlight in the upper left quarter
+                    int hx = cx + size / 2;
+                    int hy = cy + size / 2;
+                    int shade = (hx * hx + hy * hy) * 6 / (2 * size * size);
+                    index = static_cast<uint8_t>(1 + (shade < 5 ? shade : 5));
+                }
+                else if (d2 <= size * size)
+                {
+                    index = SPRITE_SWARM_SHADES - 1; // Rim
+                }
+                data[y * size + x] = index;
+            }
+        }
+        images[s] = {data, nullptr, static_cast<uint16_t>(size), static_cast<uint16_t>(size), SPRITE_FORMAT_INDEXED8};
+    }
+
+    palettes = memory.allocate<lv_color32_t>(SPRITE_SWARM_PALETTES * SPRITE_SWARM_SHADES);
+    if (palettes == nullptr)
+    {
+        return false;
+    }
+    for (int p = 0; p < SPRITE_SWARM_PALETTES; p++)
+    {
+        const lv_color32_t &c = base_colours[p];
+        lv_color32_t *palette = palettes + p * SPRITE_SWARM_SHADES;
+        palette[0] = {0, 0, 0, 0};
+        palette[1] = {static_cast<uint8_t>((c.blue + 255) / 2), static_cast<uint8_t>((c.green + 255) / 2), static_cast<uint8_t>((c.red + 255) / 2), 255};
+        for (int k = 2; k < SPRITE_SWARM_SHADES - 1; k++)
+        {
+            int f = 255 - (k - 2) * 36;
+            palette[k] = {static_cast<uint8_t>(c.blue * f / 255), static_cast<uint8_t>(c.green * f / 255), static_cast<uint8_t>(c.red * f / 255), 255};
+        }
+        palette[SPRITE_SWARM_SHADES - 1] = {static_cast<uint8_t>(c.blue / 2), static_cast<uint8_t>(c.green / 2), static_cast<uint8_t>(c.red / 2), 128};
+    }
+    for (int s = 0; s < SPRITE_SWARM_SIZES; s++)
+    {
+        images[s].palette = palettes;
+    }
+    return true;
+}
+
+bool SpriteSwarm::create(SceneArena::Region &memory)
+{
+    pos_x = memory.allocate<int16_t>(count);
+    pos_y = memory.allocate<int16_t>(count);
+    vel_x = memory.allocate<int8_t>(count);
+    vel_y = memory.allocate<int8_t>(count);
+    if (pos_x == nullptr || pos_y == nullptr || vel_x == nullptr || vel_y == nullptr || !create_images(memory))
+    {
+        printf("Failed to allocate the sprite state\n");
+        return false;
+    }
+
+    screen = lv_obj_create(NULL);
+    lv_obj_set_style_bg_color(screen, lv_color_make(10, 10, 40), LV_PART_MAIN);
+    if (!layer.create(screen, width, height, count, memory))
+    {
+        printf("Failed to allocate the sprite layer\n");
+        return false;
+    }
+    lv_obj_center(layer.get_obj());
+
+    for (uint i = 0; i < count; i++)
+    {
+        int s = scene_random_below(SPRITE_SWARM_SIZES);
+        int size = images[s].width;
+        pos_x[i] = static_cast<int16_t>(scene_random_below((width - size) << 4));
+        pos_y[i] = static_cast<int16_t>(scene_random_below((height - size) << 4));
+        vel_x[i] = static_cast<int8_t>(static_cast<int>(scene_random_below(31)) - 15);
+        vel_y[i] = static_cast<int8_t>(static_cast<int>(scene_random_below(31)) - 15);
+        if (vel_x[i] == 0)
+        {
+            vel_x[i] = 7;
+        }
+
+        layer.set_image(i, &images[s]);
+        layer.set_palette(i, palettes + (i % SPRITE_SWARM_PALETTES) * SPRITE_SWARM_SHADES);
+        layer.set_z(i, static_cast<int16_t>(s));
+        layer.set_position(i, pos_x[i] >> 4, pos_y[i] >> 4);
+    }
+    layer.invalidate();
+    frame = 0;
+    return true;
+}
+
+void SpriteSwarm::update()
+{
+    frame++;
+    for (uint i = 0; i < count; i++)
+    {
+        const Sprite &sprite = layer.get(i);
+        int max_x = (width - sprite.image->width) << 4;
+        int max_y = (height - sprite.image->height) << 4;
+        int x = pos_x[i] + vel_x[i];
+        int y = pos_y[i] + vel_y[i];
+        if (x < 0 || x > max_x)
+        {
+            vel_x[i] = static_cast<int8_t>(-vel_x[i]);
+            x = x < 0 ? 0 : max_x;
+        }
+        if (y < 0 || y > max_y)
+        {
+            vel_y[i] = static_cast<int8_t>(-vel_y[i]);
+            y = y < 0 ? 0 : max_y;
+        }
+        pos_x[i] = static_cast<int16_t>(x);
+        pos_y[i] = static_cast<int16_t>(y);
+        layer.set_position(i, x >> 4, y >> 4);
+
+        if (i % 8 == 0)
+        {
+            uint32_t phase = (frame * 4 + i) & 511; // Triangle wave between 64 and 255
+            layer.set_opa(i, static_cast<lv_opa_t>(64 + (phase < 256 ? phase : 511 - phase) * 191 / 255));
+        }
+    }
+    layer.invalidate();
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstdio>
+
+#include "pico/stdlib.h"
+
+#include "lvgl/src/misc/lv_color.h"
+
+#include "scene.hpp"
+#include "sprite_layer.hpp"
+
+#define SPRITE_SWARM_SIZES 3    ///< Ball images of 5, 7 and 9 pixels
+#define SPRITE_SWARM_PALETTES 6 ///< Colour variants sharing the ball images
+#define SPRITE_SWARM_SHADES 8   ///< Palette entries: transparent, six shades, half-transparent rim
+
+/**
+ * @brief Many shaded balls moving on a SpriteLayer.
+ *
+ * Three indexed ball images are shared by all sprites and coloured through six palettes.
+ * Larger balls fly in front of smaller ones, every eighth ball pulses its opacity.
+ * Positions are fixed point with 4 fractional bits.
+ */
+class SpriteSwarm : public Scene
+{
+private:
+    uint count;
+    uint width, height;
+
+    SpriteLayer layer;
+    SpriteImage images[SPRITE_SWARM_SIZES];
+    lv_color32_t *palettes = nullptr; ///< SPRITE_SWARM_PALETTES * SPRITE_SWARM_SHADES entries
+    int16_t *pos_x = nullptr;
+    int16_t *pos_y = nullptr;
+    int8_t *vel_x = nullptr;
+    int8_t *vel_y = nullptr;
+    uint32_t frame = 0;
+
+    bool create_images(SceneArena::Region &memory);
+
+public:
+    explicit SpriteSwarm(uint count = 256, uint width = 64, uint height = 64) : count(count), width(width), height(height)
+    {
+    }
+
+    const char *name() const override
+    {
+        return "sprites";
+    }
+
+    bool create(SceneArena::Region &memory) override;
+
+    void update() override;
+
+    void show() override
+    {
+        lv_screen_load_anim(screen, LV_SCR_LOAD_ANIM_FADE_IN, 1000, 0, false);
+    }
+
+    void destroy() override
+    {
+        Scene::destroy();
+        palettes = nullptr; // Memory is returned with the arena region
+        pos_x = pos_y = nullptr;
+        vel_x = vel_y = nullptr;
+    }
+
+    const SpriteLayer &get_layer() const
+    {
+        return layer;
+    }
+};
@@ -0,0 +1,286 @@
+#include <cstring>
+
+#include "lvgl/src/draw/lv_draw_buf.h"
+#include "lvgl/src/misc/cache/instance/lv_image_cache.h"
+#include "lvgl/src/misc/lv_anim.h"
+#include "lvgl/src/misc/lv_text_private.h"
+#include "lvgl/src/stdlib/lv_mem.h"
+#include "lvgl/src/widgets/image/lv_image.h"
+
+#include "text_strip.hpp"
+
+static_assert(GLYPH_ATLAS_CELL_SIZE % LV_DRAW_BUF_STRIDE_ALIGN == 0, "a cell row must hold the stride of any glyph fitting the cell");
+
+/// @brief A decoded glyph, ready to be blended as an A8 mask
+struct Glyph
+{
+    const uint8_t *bitmap; ///< nullptr for glyphs without pixels, e.g. space
+    uint32_t stride;
+    uint16_t box_w;
+    uint16_t box_h;
+    int16_t ofs_x;
+    int16_t ofs_y;
+};
+
+/// @brief One cell of the atlas
+struct GlyphCell
+{
+    alignas(LV_DRAW_BUF_ALIGN) uint8_t bitmap[GLYPH_ATLAS_CELL_SIZE * GLYPH_ATLAS_CELL_SIZE];
+    const lv_font_t *font; ///< Font the glyph was requested from, nullptr for a free cell
+    uint32_t letter;
+    uint32_t last_use;
+    Glyph glyph;
+};
+
+static GlyphCell cells[GLYPH_ATLAS_CELLS];
+static GlyphAtlasInfo counters;
+static uint32_t use_clock = 0;           ///< Incremented on every lookup, orders the cells by their last use
+static lv_draw_buf_t *oversize = nullptr; ///< Scratch buffer for glyphs larger than a cell, reused by the next one
+
+/**
+ * @brief Decodes a glyph into an A8 buffer.
+ *
+ * @return false if the font has no A8-convertible bitmap for the letter.
+ */
+static bool decode(lv_font_glyph_dsc_t &dsc, lv_draw_buf_t *draw_buf, Glyph &glyph)
+{
+    bool ok = lv_font_get_glyph_bitmap(&dsc, draw_buf) != nullptr;
+    lv_font_glyph_release_draw_data(&dsc);
+    glyph.bitmap = ok ? draw_buf->data : nullptr;
+    glyph.stride = draw_buf->header.stride;
+    return ok;
+}
+
+/**
+ * @brief Returns the decoded glyph of a letter.
+ *
+ * The glyph stays valid until the next lookup.
+ *
+ * @return false if the letter has no glyph in the font.
+ */
+static bool lookup(const lv_font_t *font, uint32_t letter, Glyph &glyph)
+{
+    use_clock++;
+
+    GlyphCell *victim = &cells[0];
+    for (GlyphCell &cell : cells)
+    {
+        if (cell.font == font && cell.letter == letter)
+        {
+            counters.hits++;
+            cell.last_use = use_clock;
+            glyph = cell.glyph;
+            return true;
+        }
+        if (victim->font != nullptr && (cell.font == nullptr || cell.last_use < victim->last_use))
+        {
+            victim = &cell;
+        }
+    }
+
+    lv_font_glyph_dsc_t dsc;
+    if (!lv_font_get_glyph_dsc(font, &dsc, letter, 0) || dsc.resolved_font == nullptr)
+    {
+        return false;
+    }
+    glyph.bitmap = nullptr;
+    glyph.stride = 0;
+    glyph.box_w = dsc.box_w;
+    glyph.box_h = dsc.box_h;
+    glyph.ofs_x = dsc.ofs_x;
+    glyph.ofs_y = dsc.ofs_y;
+    if (dsc.box_w == 0 || dsc.box_h == 0 || dsc.format <= LV_FONT_GLYPH_FORMAT_NONE || dsc.format >= LV_FONT_GLYPH_FORMAT_IMAGE)
+    {
+        return true; // Nothing to draw, or not a bitmap which can be blended as A8
+    }
+
+    if (dsc.box_w > GLYPH_ATLAS_CELL_SIZE || dsc.box_h > GLYPH_ATLAS_CELL_SIZE)
+    {
+        counters.oversize++;
+        lv_draw_buf_t *draw_buf = oversize ? lv_draw_buf_reshape(oversize, LV_COLOR_FORMAT_A8, dsc.box_w, dsc.box_h, LV_STRIDE_AUTO) : nullptr;
+        if (draw_buf == nullptr)
+        {
+            if (oversize)
+            {
+                lv_draw_buf_destroy(oversize);
+            }
+            oversize = draw_buf = lv_draw_buf_create(dsc.box_w, dsc.box_h, LV_COLOR_FORMAT_A8, LV_STRIDE_AUTO);
+            if (draw_buf == nullptr)
+            {
+                return false;
+            }
+        }
+        return decode(dsc, draw_buf, glyph);
+    }
+
+    counters.misses++;
+    if (victim->font != nullptr)
+    {
+        counters.evictions++;
+    }
+    else
+    {
+        counters.cells++;
+    }
+    victim->font = nullptr;
+
+    lv_draw_buf_t draw_buf;
+    lv_draw_buf_init(&draw_buf, dsc.box_w, dsc.box_h, LV_COLOR_FORMAT_A8, LV_STRIDE_AUTO, victim->bitmap, sizeof(victim->bitmap));
+    if (!decode(dsc, &draw_buf, glyph))
+    {
+        counters.cells--;
+        return true;
+    }
+    victim->font = font;
+    victim->letter = letter;
+    victim->last_use = use_clock;
+    victim->glyph = glyph;
+    return true;
+}
+
+void glyph_atlas_info(GlyphAtlasInfo &info)
+{
+    info = counters;
+}
+
+void glyph_atlas_clear()
+{
+    memset(cells, 0, sizeof(cells));
+    memset(&counters, 0, sizeof(counters));
+    use_clock = 0;
+    if (oversize)
+    {
+        lv_draw_buf_destroy(oversize);
+        oversize = nullptr;
+    }
+}
+
+/// @brief Blends an A8 glyph into the strip, clipped to the strip.
+static void blend_glyph(uint8_t *dest, uint32_t stride, int32_t width, int32_t height, int32_t x, int32_t y, const Glyph &glyph)
+{
+    int32_t x1 = x < 0 ? 0 : x;
+    int32_t y1 = y < 0 ? 0 : y;
+    int32_t x2 = x + glyph.box_w < width ? x + glyph.box_w : width;
+    int32_t y2 = y + glyph.box_h < height ? y + glyph.box_h : height;
+    for (int32_t row = y1; row < y2; row++)
+    {
+        const uint8_t *src = glyph.bitmap + (row - y) * glyph.stride + (x1 - x);
+        uint8_t *dst = dest + row * stride + x1;
+        for (int32_t col = x1; col < x2; col++, src++, dst++)
+        {
+            // Coverage of overlapping glyphs combines like letters drawn over each other
+            *dst = static_cast<uint8_t>(*dst + *src - (*dst * *src + 127) / 255);
+        }
+    }
+}
+
+bool TextStrip::render(const char *text, const lv_font_t *font, SceneArena::Region &memory, uint32_t gap)
+{
+    // First pass: the width of the widest line, with the kerning between neighbouring letters
+    int32_t width = 0;
+    int32_t lines = 1;
+    int32_t line_width = 0;
+    uint32_t i = 0;
+    uint32_t letter = lv_text_encoded_next(text, &i);
+    while (letter != 0)
+    {
+        uint32_t next = lv_text_encoded_next(text, &i);
+        if (letter == '\n')
+        {
+            lines++;
+            line_width = 0;
+        }
+        else
+        {
+            line_width += lv_font_get_glyph_width(font, letter, next);
+            width = line_width > width ? line_width : width;
+        }
+        letter = next;
+    }
+    width += gap * lv_font_get_glyph_width(font, ' ', ' ');
+
+    int32_t line_height = lv_font_get_line_height(font);
+    int32_t height = lines * line_height;
+    if (width == 0)
+    {
+        return false;
+    }
+
+    // The image decoder would copy a strip whose stride does not have the draw buffer alignment
+    uint32_t stride = lv_draw_buf_width_to_stride(width, LV_COLOR_FORMAT_A8);
+    uint8_t *pixels = memory.allocate<uint8_t>(stride * height); // Zero-initialised
+    if (pixels == nullptr)
+    {
+        return false;
+    }
+
+    // Second pass: blend the decoded glyphs at their kerned positions
+    int32_t x = 0;
+    int32_t baseline = line_height - font->base_line;
+    i = 0;
+    letter = lv_text_encoded_next(text, &i);
+    while (letter != 0)
+    {
+        uint32_t next = lv_text_encoded_next(text, &i);
+        if (letter == '\n')
+        {
+            x = 0;
+            baseline += line_height;
+        }
+        else if (!lv_text_is_marker(letter))
+        {
+            Glyph glyph;
+            if (lookup(font, letter, glyph) && glyph.bitmap != nullptr)
+            {
+                blend_glyph(pixels, stride, width, height, x + glyph.ofs_x, baseline - glyph.box_h - glyph.ofs_y, glyph);
+            }
+            x += lv_font_get_glyph_width(font, letter, next);
+        }
+        letter = next;
+    }
+
+    image.header.magic = LV_IMAGE_HEADER_MAGIC;
+    image.header.cf = LV_COLOR_FORMAT_A8;
+    image.header.w = width;
+    image.header.h = height;
+    image.header.stride = stride;
+    image.data_size = stride * height;
+    image.data = pixels;
+    return true;
+}
+
+lv_obj_t *TextStrip::create_label(lv_obj_t *parent, lv_color_t color, lv_opa_t opa) const
+{
+    lv_obj_t *obj = lv_image_create(parent);
+    lv_image_set_src(obj, &image);
+    lv_obj_set_style_image_recolor(obj, color, LV_PART_MAIN);
+    lv_obj_set_style_image_recolor_opa(obj, LV_OPA_COVER, LV_PART_MAIN);
+    lv_obj_set_style_image_opa(obj, opa, LV_PART_MAIN);
+    return obj;
+}
+
+lv_obj_t *TextStrip::create_ticker(lv_obj_t *parent, int32_t width, lv_color_t color, uint32_t speed) const
+{
+    lv_obj_t *obj = create_label(parent, color);
+    lv_image_set_inner_align(obj, LV_IMAGE_ALIGN_TILE);
+    lv_obj_set_width(obj, width);
+
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_var(&a, obj);
+    lv_anim_set_exec_cb(&a, (lv_anim_exec_xcb_t)lv_image_set_offset_x);
+    lv_anim_set_values(&a, 0, -static_cast<int32_t>(image.header.w));
+    lv_anim_set_duration(&a, lv_anim_speed(speed));
+    lv_anim_set_repeat_count(&a, LV_ANIM_REPEAT_INFINITE);
+    lv_anim_start(&a);
+    return obj;
+}
+
+void TextStrip::release()
+{
+    if (image.data != nullptr)
+    {
+        lv_image_cache_drop(&image);
+    }
+    image = {};
+}
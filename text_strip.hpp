@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "lvgl/src/core/lv_obj.h"
+#include "lvgl/src/draw/lv_image_dsc.h"
+#include "lvgl/src/font/lv_font.h"
+
+#include "scene_arena.hpp"
+
+// Text rasterised once into an A8 strip and shown by an lv_image instead of an lv_label, which
+// decodes and blends every glyph on every frame. Decoded glyphs are shared through an atlas.
+
+#define GLYPH_ATLAS_CELLS 32      ///< Glyphs kept decoded, the least recently used one is replaced
+#define GLYPH_ATLAS_CELL_SIZE 16  ///< Width and height of a cell in pixels, larger glyphs are decoded on every use
+#define TEXT_STRIP_TICKER_GAP 3   ///< Spaces between the end and the restart of a ticker's text, as LV_LABEL_WAIT_CHAR_COUNT
+
+/// @brief Counters of the glyph atlas since the last glyph_atlas_clear()
+struct GlyphAtlasInfo
+{
+    uint32_t hits;
+    uint32_t misses;    ///< Glyphs decoded into a cell
+    uint32_t evictions; ///< Misses which replaced another glyph
+    uint32_t oversize;  ///< Glyphs larger than a cell, decoded without caching
+    uint32_t cells;     ///< Cells in use
+};
+
+/// @brief Copies the atlas counters.
+void glyph_atlas_info(GlyphAtlasInfo &info);
+
+/// @brief Empties the atlas and resets its counters, e.g. after unloading a font.
+void glyph_atlas_clear();
+
+/**
+ * @brief A text rasterised into an A8 image.
+ *
+ * Lines are separated by '\n' and left aligned like in an lv_label without letter and line spacing.
+ * The pixels come from the scene arena, so the strip and all objects showing it must be gone
+ * before the scene's region is released.
+ */
+class TextStrip
+{
+private:
+    lv_image_dsc_t image = {};
+
+public:
+    /**
+     * @brief Rasterises a text.
+     *
+     * @param text UTF-8 text.
+     * @param font Font including its fallbacks.
+     * @param memory Arena region for the pixels.
+     * @param gap Spaces appended to the widest line, TEXT_STRIP_TICKER_GAP for a ticker.
+     * @return false if the text is empty or memory could not be allocated.
+     */
+    bool render(const char *text, const lv_font_t *font, SceneArena::Region &memory, uint32_t gap = 0);
+
+    /**
+     * @brief Creates an image showing the strip.
+     *
+     * @param color Text colour, applied as image recolour.
+     * @param opa Text opacity.
+     */
+    lv_obj_t *create_label(lv_obj_t *parent, lv_color_t color, lv_opa_t opa = LV_OPA_COVER) const;
+
+    /**
+     * @brief Creates an image scrolling the strip circularly from right to left.
+     *
+     * @param width Width of the visible window in pixels.
+     * @param speed Scroll speed in pixels per second.
+     */
+    lv_obj_t *create_ticker(lv_obj_t *parent, int32_t width, lv_color_t color, uint32_t speed) const;
+
+    /// @brief Forgets the pixels. Call after deleting the objects showing the strip.
+    void release();
+
+    const lv_image_dsc_t *get_image() const
+    {
+        return &image;
+    }
+};
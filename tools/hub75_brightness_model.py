@@ -0,0 +1,62 @@
+#!/usr/bin/env python3
+"""
+Luminance model of the HUB75 driver's global brightness control.
+
+hub75_set_brightness() scales the OEn pulse width of every bit plane instead of the pixel values.
+The model repeats the driver's integer arithmetic (set_row_in_bit_plane() in hub75.cpp):
+  - bit plane b is lit for (oen_base << b) + 1 cycles at full brightness,
+  - scaled width = ((oen_base << b) + 1) * scale + 128 >> 8, scale = brightness + (brightness >> 7),
+  - widths below the minimum pulse are raised to it (at least 1 cycle, the PIO minimum).
+The luminance of a 10-bit value is the sum of the widths of its set bits.
+
+For each brightness the model prints the luminance of full white relative to full brightness and
+the largest deviation of any 10-bit value from the ideal, linearly scaled luminance - in units of
+the least significant bit at that brightness and relative to the value itself.
+"""
+
+import argparse
+
+BIT_DEPTH = 10
+
+
+def plane_widths(oen_base, brightness, min_pulse):
+    scale = brightness + (brightness >> 7)
+    widths = []
+    for plane in range(BIT_DEPTH):
+        width = (((oen_base << plane) + 1) * scale + 128) >> 8
+        widths.append(max(width, min_pulse, 1))
+    return widths
+
+
+def luminance(value, widths):
+    return sum(w for plane, w in enumerate(widths) if value >> plane & 1)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--oen-base", type=int, default=6, help="OEn base pulse from the timing calculator")
+    parser.add_argument("--min-pulse", type=int, default=1, help="shortest OEn pulse in cycles")
+    parser.add_argument("--min-value", type=int, default=16, help="smallest 10-bit value for the relative error")
+    args = parser.parse_args()
+
+    full = plane_widths(args.oen_base, 255, 1)
+    white = luminance((1 << BIT_DEPTH) - 1, full)
+    print("OEn base %d cycles, minimum pulse %d cycles" % (args.oen_base, args.min_pulse))
+    print("%-11s %8s %12s %16s" % ("brightness", "white", "max err LSB", "max err (>= %d)" % args.min_value))
+    for brightness in (255, 192, 128, 64, 32, 16, 8, 4, 1):
+        widths = plane_widths(args.oen_base, brightness, args.min_pulse)
+        factor = (brightness + (brightness >> 7)) / 256
+        lsb = full[0] * factor
+        worst_lsb = 0.0
+        worst_rel = 0.0
+        for value in range(1, 1 << BIT_DEPTH):
+            ideal = luminance(value, full) * factor
+            error = abs(luminance(value, widths) - ideal)
+            worst_lsb = max(worst_lsb, error / lsb)
+            if value >= args.min_value:
+                worst_rel = max(worst_rel, error / ideal)
+        print("%-11d %7.2f%% %12.2f %15.2f%%" % (brightness, 100.0 * luminance((1 << BIT_DEPTH) - 1, widths) / white, worst_lsb, 100.0 * worst_rel))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,198 @@
+#!/usr/bin/env python3
+"""
+Encodes an animation into the delta/RLE clip format played by ClipAnimation (see clip_decoder.hpp).
+
+Frames are read from a file of raw RGB888 frames (width * height * 3 bytes each, e.g. produced by
+`ffmpeg -i logo.mp4 -s 64x64 -f rawvideo -pix_fmt rgb24 logo.rgb`) or a built-in demo animation
+is generated. The output is a C header with the clip as a const array, which the linker places
+in flash, or a binary file.
+
+Every row is encoded against the same row of the previous frame: unchanged pixels are skipped,
+runs of one colour are filled and everything else is copied. Unchanged rows are skipped as a
+whole. The first frame is encoded as a key frame, so the clip can loop.
+
+Prints the raw and encoded size and the compression ratio.
+"""
+
+import argparse
+import math
+import struct
+import sys
+
+CLIP_MAGIC = 0x41353748
+OP_SKIP = 0x00
+OP_FILL = 0x40
+OP_COPY = 0x80
+OP_SKIP_ROWS = 0xc0
+MAX_COUNT = 64
+
+
+def demo_frames(width, height, count):
+    """A pulsing diamond with an orbiting comet over a static gradient background."""
+    background = bytearray(width * height * 3)
+    for y in range(height):
+        for x in range(width):
+            i = (y * width + x) * 3
+            background[i] = 10 + 30 * y // height
+            background[i + 1] = 0
+            background[i + 2] = 20 + 40 * x // width
+
+    cx, cy = width / 2, height / 2
+    for t in range(count):
+        frame = bytearray(background)
+        phase = 2 * math.pi * t / count
+        radius = min(width, height) * (0.18 + 0.06 * math.sin(2 * phase))
+        for y in range(height):
+            for x in range(width):
+                if abs(x + 0.5 - cx) + abs(y + 0.5 - cy) < radius:
+                    i = (y * width + x) * 3
+                    frame[i:i + 3] = bytes((255, 160, 0))
+        for k in range(6):
+            a = phase - k * 0.12
+            px = int(cx + math.cos(a) * width * 0.38)
+            py = int(cy + math.sin(a) * height * 0.38)
+            level = 255 - k * 40
+            for dy in range(-1, 2):
+                for dx in range(-1, 2):
+                    x, y = px + dx, py + dy
+                    if 0 <= x < width and 0 <= y < height:
+                        i = (y * width + x) * 3
+                        frame[i:i + 3] = bytes((level // 4, level, level))
+        yield bytes(frame)
+
+
+def raw_frames(path, frame_size):
+    with open(path, "rb") as f:
+        while True:
+            frame = f.read(frame_size)
+            if len(frame) < frame_size:
+                return
+            yield frame
+
+
+def to_bgr(frame):
+    """LVGL's RGB888 is B, G, R in memory - store it that way so the decoder copies pixels unchanged."""
+    out = bytearray(frame)
+    out[0::3] = frame[2::3]
+    out[2::3] = frame[0::3]
+    return bytes(out)
+
+
+def encode_row(row, prev, width):
+    px = [row[i * 3:i * 3 + 3] for i in range(width)]
+    old = [prev[i * 3:i * 3 + 3] for i in range(width)] if prev is not None else None
+
+    def same(i):
+        return old is not None and px[i] == old[i]
+
+    def fill_length(i):
+        n = 1
+        while i + n < width and n < MAX_COUNT and px[i + n] == px[i]:
+            n += 1
+        return n
+
+    out = bytearray()
+    x = 0
+    while x < width:
+        if same(x):
+            n = 1
+            while x + n < width and n < MAX_COUNT and same(x + n):
+                n += 1
+            out.append(OP_SKIP | (n - 1))
+        elif fill_length(x) >= 3:
+            n = fill_length(x)
+            out.append(OP_FILL | (n - 1))
+            out += px[x]
+        else:
+            # Literal run until a skip of two pixels or a fill of three pixels starts
+            n = 1
+            while x + n < width and n < MAX_COUNT:
+                i = x + n
+                if (same(i) and i + 1 < width and same(i + 1)) or fill_length(i) >= 3:
+                    break
+                n += 1
+            out.append(OP_COPY | (n - 1))
+            for i in range(x, x + n):
+                out += px[i]
+        x += n
+    return bytes(out)
+
+
+def encode_frame(frame, prev, width, height):
+    stride = width * 3
+    out = bytearray()
+    skipped = 0
+    for y in range(height):
+        row = frame[y * stride:(y + 1) * stride]
+        if prev is not None and row == prev[y * stride:(y + 1) * stride]:
+            skipped += 1
+            if skipped == MAX_COUNT:
+                out.append(OP_SKIP_ROWS | (skipped - 1))
+                skipped = 0
+            continue
+        if skipped:
+            out.append(OP_SKIP_ROWS | (skipped - 1))
+            skipped = 0
+        out += encode_row(row, None if prev is None else prev[y * stride:(y + 1) * stride], width)
+    if skipped:
+        out.append(OP_SKIP_ROWS | (skipped - 1))
+    return bytes(out)
+
+
+def encode_clip(frames, width, height, frame_ms):
+    encoded = []
+    prev = None
+    for frame in frames:
+        encoded.append(encode_frame(to_bgr(frame), prev, width, height))
+        prev = to_bgr(frame)
+    if not encoded:
+        raise ValueError("no frames")
+
+    header = struct.pack("<IHHHH", CLIP_MAGIC, width, height, len(encoded), frame_ms)
+    offset = len(header) + 4 * len(encoded)
+    table = bytearray()
+    for data in encoded:
+        table += struct.pack("<I", offset)
+        offset += len(data)
+    return header + bytes(table) + b"".join(encoded), len(encoded)
+
+
+def write_header(path, name, clip, width, height, count):
+    with open(path, "w") as f:
+        f.write("// Generated by tools/hub75_clip.py - %dx%d, %d frames, %d bytes\n" % (width, height, count, len(clip)))
+        f.write("#pragma once\n\n#include <cstdint>\n\n")
+        f.write("static const uint8_t %s[%d] __attribute__((aligned(4))) = {\n" % (name, len(clip)))
+        for i in range(0, len(clip), 16):
+            f.write("    " + ", ".join("0x%02x" % b for b in clip[i:i + 16]) + ",\n")
+        f.write("};\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("output", help="output file, .h for a C header, anything else for binary")
+    parser.add_argument("--input", help="raw RGB888 frames, default is the demo animation")
+    parser.add_argument("--width", type=int, default=64)
+    parser.add_argument("--height", type=int, default=64)
+    parser.add_argument("--frame-ms", type=int, default=40, help="display time of one frame")
+    parser.add_argument("--frames", type=int, default=50, help="number of demo frames")
+    parser.add_argument("--name", default="clip_64x64", help="array name in the C header")
+    args = parser.parse_args()
+
+    if args.input:
+        frames = raw_frames(args.input, args.width * args.height * 3)
+    else:
+        frames = demo_frames(args.width, args.height, args.frames)
+
+    clip, count = encode_clip(frames, args.width, args.height, args.frame_ms)
+    raw = count * args.width * args.height * 3
+    if args.output.endswith(".h"):
+        write_header(args.output, args.name, clip, args.width, args.height, count)
+    else:
+        with open(args.output, "wb") as f:
+            f.write(clip)
+    print("%d frames, raw %d bytes, encoded %d bytes, ratio %.1f:1" % (count, raw, len(clip), raw / len(clip)))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,164 @@
+#!/usr/bin/env python3
+"""
+Converts a GIF file into a C header for the GifAnimation scene (see gif_animation.hpp).
+
+The GIF is embedded unchanged as a const array, which the linker places in flash;
+GifDecoder (gif_decoder.hpp) decodes it at run time. Without an input file a demo animation (a rotating
+pinwheel) is generated and encoded as GIF89a.
+
+Prints the size, number of frames and the sum of the frame delays.
+"""
+
+import argparse
+import math
+import struct
+import sys
+
+
+def lzw_encode(indices, min_code_size):
+    """GIF variant of LZW, returns the packed code stream."""
+    clear = 1 << min_code_size
+    end = clear + 1
+    out = bytearray()
+    bits = 0
+    nbits = 0
+
+    def emit(code, size):
+        nonlocal bits, nbits
+        bits |= code << nbits
+        nbits += size
+        while nbits >= 8:
+            out.append(bits & 0xff)
+            bits >>= 8
+            nbits -= 8
+
+    def reset():
+        return {bytes([i]): i for i in range(clear)}, end + 1, min_code_size + 1
+
+    table, next_code, code_size = reset()
+    emit(clear, code_size)
+    prefix = b""
+    for index in indices:
+        candidate = prefix + bytes([index])
+        if candidate in table:
+            prefix = candidate
+            continue
+        emit(table[prefix], code_size)
+        if next_code < 4096:
+            table[candidate] = next_code
+            next_code += 1
+            if next_code > (1 << code_size) and code_size < 12:
+                code_size += 1
+        else:
+            emit(clear, code_size)
+            table, next_code, code_size = reset()
+        prefix = bytes([index])
+    if prefix:
+        emit(table[prefix], code_size)
+    emit(end, code_size)
+    if nbits:
+        out.append(bits & 0xff)
+    return bytes(out)
+
+
+def sub_blocks(data):
+    out = bytearray()
+    for i in range(0, len(data), 255):
+        chunk = data[i:i + 255]
+        out.append(len(chunk))
+        out += chunk
+    out.append(0)
+    return bytes(out)
+
+
+def encode_gif(frames, width, height, palette, delay_cs):
+    """frames: lists of palette indices, palette: 256 (r, g, b) tuples."""
+    out = bytearray(b"GIF89a")
+    out += struct.pack("<HHBBB", width, height, 0xf7, 0, 0)  # Global colour table with 256 entries
+    for r, g, b in palette:
+        out += bytes((r, g, b))
+    out += b"\x21\xff\x0bNETSCAPE2.0\x03\x01\x00\x00\x00"  # Loop forever
+    for indices in frames:
+        out += b"\x21\xf9\x04" + struct.pack("<BHBB", 0x04, delay_cs, 0, 0)  # Do not dispose
+        out += b"\x2c" + struct.pack("<HHHHB", 0, 0, width, height, 0)
+        out.append(8)
+        out += sub_blocks(lzw_encode(indices, 8))
+    out.append(0x3b)
+    return bytes(out)
+
+
+def demo_gif(width, height, count, delay_cs):
+    palette = []
+    for i in range(256):
+        if i < 24:
+            h = i / 24.0
+            r = int(127 + 127 * math.cos(2 * math.pi * h))
+            g = int(127 + 127 * math.cos(2 * math.pi * (h - 1 / 3)))
+            b = int(127 + 127 * math.cos(2 * math.pi * (h - 2 / 3)))
+            palette.append((r, g, b))
+        else:
+            palette.append((0, 0, 0))
+
+    cx, cy = (width - 1) / 2, (height - 1) / 2
+    frames = []
+    for t in range(count):
+        indices = []
+        for y in range(height):
+            for x in range(width):
+                dx, dy = x - cx, y - cy
+                if dx * dx + dy * dy > (min(width, height) / 2) ** 2:
+                    indices.append(255)
+                    continue
+                angle = (math.atan2(dy, dx) / (2 * math.pi) + t / count) % 1.0
+                indices.append(int(angle * 8) * 3 % 24)
+        frames.append(indices)
+    return encode_gif(frames, width, height, palette, delay_cs)
+
+
+def gif_info(data):
+    """Number of frames and total delay in ms."""
+    frames = 0
+    delay = 0
+    i = data.find(b"\x21\xf9\x04")
+    while i >= 0:
+        frames += 1
+        delay += struct.unpack("<H", data[i + 4:i + 6])[0] * 10
+        i = data.find(b"\x21\xf9\x04", i + 8)
+    return frames, delay
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("output", help="C header to write")
+    parser.add_argument("--input", help="GIF file, default is the demo animation")
+    parser.add_argument("--width", type=int, default=64, help="demo width")
+    parser.add_argument("--height", type=int, default=64, help="demo height")
+    parser.add_argument("--frames", type=int, default=24, help="number of demo frames")
+    parser.add_argument("--delay", type=int, default=5, help="demo frame delay in 1/100 s")
+    parser.add_argument("--name", default="gif_64x64", help="array name in the C header")
+    args = parser.parse_args()
+
+    if args.input:
+        with open(args.input, "rb") as f:
+            data = f.read()
+        if not data.startswith(b"GIF89a"):
+            print("%s is not a GIF89a file" % args.input)
+            return 1
+    else:
+        data = demo_gif(args.width, args.height, args.frames, args.delay)
+
+    width, height = struct.unpack("<HH", data[6:10])
+    frames, delay = gif_info(data)
+    with open(args.output, "w") as f:
+        f.write("// Generated by tools/hub75_gif.py - %dx%d, %d frames, %d bytes\n" % (width, height, frames, len(data)))
+        f.write("#pragma once\n\n#include <cstdint>\n\n")
+        f.write("static const uint8_t %s[%d] = {\n" % (args.name, len(data)))
+        for i in range(0, len(data), 16):
+            f.write("    " + ", ".join("0x%02x" % b for b in data[i:i + 16]) + ",\n")
+        f.write("};\n")
+    print("%dx%d, %d frames, %d bytes, loop %d ms" % (width, height, frames, len(data), delay))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
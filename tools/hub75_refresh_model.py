@@ -0,0 +1,62 @@
+#!/usr/bin/env python3
+"""
+Cycle model of the HUB75 driver's refresh rate for different chain configurations.
+
+Counts PIO cycles per row address and bit plane from the programs in hub75.pio:
+  - hub75_data_rgb888 needs 16 cycles per column (7 for the upper and 9 for the lower pixel),
+    plus 8 dummy pixels (4 columns) at the end of every row.
+  - hub75_row needs 8 cycles for the row select, 8 cycles for LATCH, (6 << bit_plane) + 1
+    cycles of OEn and 1 cycle to report the end of the pulse.
+  - The DMA interrupt which starts the next row costs a fixed number of cycles (--irq-cycles).
+Shifting the next row only starts after the OEn pulse of the current row has finished, so the
+phases add up. Parallel chains shift at the same time, so only the columns of one chain count.
+
+Prints refresh rate and DMA throughput for 1 to 8 panels in one chain and split over two chains.
+"""
+
+import argparse
+
+BIT_DEPTH = 10
+CYCLES_PER_COLUMN = 16
+DUMMY_COLUMNS = 4
+ROW_SELECT_CYCLES = 8
+LATCH_CYCLES = 8
+
+
+def frame_cycles(columns, scan, irq_cycles):
+    """PIO cycles to show all bit planes of all row addresses once."""
+    total = 0
+    for plane in range(BIT_DEPTH):
+        shift = (columns + DUMMY_COLUMNS) * CYCLES_PER_COLUMN
+        oen = (6 << plane) + 1 + 1
+        total += shift + ROW_SELECT_CYCLES + LATCH_CYCLES + oen + irq_cycles
+    return total * scan
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--clock-mhz", type=float, default=250.0, help="system clock")
+    parser.add_argument("--panel-width", type=int, default=64)
+    parser.add_argument("--panel-height", type=int, default=64)
+    parser.add_argument("--irq-cycles", type=int, default=150, help="interrupt entry, handler and DMA restart")
+    args = parser.parse_args()
+
+    scan = args.panel_height // 2
+    clock = args.clock_mhz * 1e6
+    print("%d x %d panels, 1/%d scan, %.0f MHz, %d bit planes" % (args.panel_width, args.panel_height, scan, args.clock_mhz, BIT_DEPTH))
+    print("%-8s %-7s %12s %14s %18s" % ("panels", "chains", "refresh Hz", "shift share", "DMA MB/s (total)"))
+    for panels in (1, 2, 4, 8):
+        for chains in (1, 2):
+            if panels % chains:
+                continue
+            columns = panels // chains * args.panel_width
+            cycles = frame_cycles(columns, scan, args.irq_cycles)
+            shift = (columns + DUMMY_COLUMNS) * CYCLES_PER_COLUMN * BIT_DEPTH * scan
+            refresh = clock / cycles
+            # Every refresh transfers each 32-bit frame buffer word once per bit plane
+            words = (columns + DUMMY_COLUMNS) * 2 * chains * scan * BIT_DEPTH
+            print("%-8d %-7d %12.0f %13.0f%% %18.1f" % (panels, chains, refresh, 100.0 * shift / cycles, words * 4 * refresh / 1e6))
+
+
+if __name__ == "__main__":
+    main()
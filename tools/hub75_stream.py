@@ -0,0 +1,170 @@
+#!/usr/bin/env python3
+"""
+Streams frames to a hub75_lvgl panel over USB CDC (see usb_stream.hpp for the protocol).
+
+Frames are either read from a file of raw RGB888 frames (width * height * 3 bytes each,
+e.g. produced by `ffmpeg -i clip.mp4 -s 64x64 -f rawvideo -pix_fmt rgb24 clip.rgb`) or a
+moving test pattern is generated. Only one frame is in flight: the next frame is sent after
+the panel has acknowledged the previous one. Frames which became due in the meantime are
+dropped, not queued, so the panel always shows the most recent content.
+
+Only the bounding box of the pixels which differ from the previous acknowledged frame is
+sent (STREAM_FLAG_DIRTY_RECT), unless --full is given. A frame without acknowledgement is
+followed by a full frame, as the panel content is unknown then.
+
+Prints sustained fps, dropped frames and acknowledgement latency.
+
+Requires pyserial (pip install pyserial).
+"""
+
+import argparse
+import struct
+import sys
+import time
+
+import serial
+
+STREAM_MAGIC = 0x46353748
+STREAM_FLAG_DIRTY_RECT = 0x01
+FORMAT_RGB888 = 0
+
+
+def test_pattern(width, height, t):
+    """Diagonal colour bands moving with time t (frame number)."""
+    frame = bytearray(width * height * 3)
+    i = 0
+    for y in range(height):
+        for x in range(width):
+            v = (x + y + t) & 0xff
+            frame[i] = v
+            frame[i + 1] = (v * 2 + 85) & 0xff
+            frame[i + 2] = 255 - v
+            i += 3
+    return bytes(frame)
+
+
+def dirty_rect(previous, frame, width, height):
+    """Bounding box (x, y, w, h) of the pixels in which frame differs from previous.
+
+    An unchanged frame still sends its top-left pixel, so the panel keeps the stream alive.
+    """
+    stride = width * 3
+    rows = [y for y in range(height) if previous[y * stride:(y + 1) * stride] != frame[y * stride:(y + 1) * stride]]
+    if not rows:
+        return 0, 0, 1, 1
+    top, bottom = rows[0], rows[-1]
+    left, right = width, -1
+    for y in range(top, bottom + 1):
+        row = y * stride
+        for x in range(width):
+            i = row + x * 3
+            if previous[i:i + 3] != frame[i:i + 3]:
+                left = min(left, x)
+                right = max(right, x)
+                break
+        for x in range(width - 1, right, -1):
+            i = row + x * 3
+            if previous[i:i + 3] != frame[i:i + 3]:
+                right = x
+                break
+    return left, top, right - left + 1, bottom - top + 1
+
+
+def crop(frame, width, x, y, w, h):
+    stride = width * 3
+    return b"".join(frame[(y + row) * stride + x * 3:(y + row) * stride + (x + w) * 3] for row in range(h))
+
+
+def raw_frames(path, frame_size):
+    with open(path, "rb") as f:
+        while True:
+            frame = f.read(frame_size)
+            if len(frame) < frame_size:
+                f.seek(0)
+                continue
+            yield frame
+
+
+def wait_ack(port, sequence, timeout):
+    """Reads lines until 'ACK <sequence>' arrives. Other lines are the firmware's log output."""
+    deadline = time.monotonic() + timeout
+    while time.monotonic() < deadline:
+        line = port.readline().decode(errors="replace").strip()
+        if line.startswith("ACK "):
+            if int(line[4:]) == sequence:
+                return True
+        elif line:
+            print(f"panel: {line}")
+    return False
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("port", help="serial port of the Pico, e.g. /dev/ttyACM0")
+    parser.add_argument("--width", type=int, default=64)
+    parser.add_argument("--height", type=int, default=64)
+    parser.add_argument("--fps", type=float, default=60.0, help="rate at which frames become due")
+    parser.add_argument("--frames", type=int, default=600, help="number of frames to send")
+    parser.add_argument("--input", help="file of raw RGB888 frames, default: generated test pattern")
+    parser.add_argument("--full", action="store_true", help="always send full frames instead of dirty rectangles")
+    args = parser.parse_args()
+
+    frame_size = args.width * args.height * 3
+    source = raw_frames(args.input, frame_size) if args.input else None
+    port = serial.Serial(args.port, timeout=0.1)
+
+    period = 1.0 / args.fps
+    start = time.monotonic()
+    sequence = 0
+    dropped = 0
+    latencies = []
+    sent = 0
+    payload_bytes = 0
+    previous = None  # Last acknowledged frame
+
+    while sent < args.frames:
+        # Frames due while the previous one was in flight are skipped, not queued
+        due = int((time.monotonic() - start) / period)
+        if due > sequence + 1:
+            dropped += due - sequence - 1
+            sequence = due - 1
+        sequence += 1
+
+        frame = next(source) if source else test_pattern(args.width, args.height, sequence)
+        if args.full or previous is None:
+            flags, x, y, w, h = 0, 0, 0, args.width, args.height
+            payload = frame
+        else:
+            x, y, w, h = dirty_rect(previous, frame, args.width, args.height)
+            flags = STREAM_FLAG_DIRTY_RECT
+            payload = crop(frame, args.width, x, y, w, h)
+        header = struct.pack("<IIBBHHHHH", STREAM_MAGIC, sequence & 0xffffffff, FORMAT_RGB888, flags, x, y, w, h, 0)
+
+        t0 = time.monotonic()
+        port.write(header)
+        port.write(payload)
+        if not wait_ack(port, sequence, 1.0):
+            print(f"frame {sequence}: no acknowledgement", file=sys.stderr)
+            previous = None
+            continue
+        latencies.append(time.monotonic() - t0)
+        previous = frame
+        sent += 1
+        payload_bytes += len(payload)
+
+        # Do not run ahead of the requested frame rate
+        next_due = start + (sequence + 1) * period
+        delay = next_due - time.monotonic()
+        if delay > 0:
+            time.sleep(delay)
+
+    elapsed = time.monotonic() - start
+    latencies.sort()
+    print(f"{args.width}x{args.height}: {sent} frames in {elapsed:.2f} s = {sent / elapsed:.1f} fps, {dropped} dropped, "
+          f"{payload_bytes / max(sent, 1) / 1024:.1f} KB payload per frame")
+    print(f"latency ms: median {1000 * latencies[len(latencies) // 2]:.1f}, "
+          f"p95 {1000 * latencies[int(len(latencies) * 0.95)]:.1f}, max {1000 * latencies[-1]:.1f}")
+
+
+if __name__ == "__main__":
+    main()
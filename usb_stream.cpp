@@ -0,0 +1,143 @@
+#include <cstdio>
+#include <cstring>
+
+#include "pico/stdio.h"
+
+#include "hub75.hpp"
+#include "usb_stream.hpp"
+
+/**
+ * @brief Validates a complete header and prepares reception of the payload.
+ *
+ * @param now_ms Current time in milliseconds.
+ * @return false if the header is corrupt and the receiver has to resynchronise.
+ */
+bool UsbStreamReceiver::accept_header(uint32_t now_ms)
+{
+    if (header.magic != STREAM_MAGIC || header.format > STREAM_FORMAT_RGB101010)
+    {
+        return false;
+    }
+
+    if (!(header.flags & STREAM_FLAG_DIRTY_RECT))
+    {
+        header.x = 0;
+        header.y = 0;
+        header.w = width;
+        header.h = height;
+    }
+    if (header.w == 0 || header.h == 0 || header.x + header.w > width || header.y + header.h > height)
+    {
+        return false;
+    }
+
+    // A new session after the timeout counts its sequence numbers from anew
+    if (have_sequence && now_ms - last_frame_ms >= STREAM_TIMEOUT_MS)
+    {
+        have_sequence = false;
+    }
+    // A frame older than the one already shown is late - read it, but do not display it
+    discard = have_sequence && static_cast<int32_t>(header.sequence - last_sequence) <= 0;
+
+    row = 0;
+    row_fill = 0;
+    row_bytes = header.w * (header.format == STREAM_FORMAT_RGB888 ? 3 : 4);
+    state = STATE_PAYLOAD;
+    return true;
+}
+
+/**
+ * @brief Writes a received row into the frame buffer.
+ *
+ * @return true if it was the last row of the frame.
+ */
+bool UsbStreamReceiver::finish_row()
+{
+    if (!discard)
+    {
+        if (claim_panel != nullptr)
+        {
+            claim_panel();
+        }
+        if (header.format == STREAM_FORMAT_RGB888)
+        {
+            update_row(header.x, header.y + row, reinterpret_cast<const uint8_t *>(row_buf), header.w);
+        }
+        else
+        {
+            load_row(header.x, header.y + row, row_buf, header.w);
+        }
+    }
+    row_fill = 0;
+    return ++row == header.h;
+}
+
+bool UsbStreamReceiver::poll(uint32_t now_ms)
+{
+    if (state == STATE_PAYLOAD && now_ms - last_data_ms > STREAM_STALL_MS)
+    {
+        state = STATE_HEADER; // Sender has gone away in the middle of a frame
+        header_fill = 0;
+    }
+
+    while (true)
+    {
+        uint8_t *dst;
+        uint want;
+        if (state == STATE_HEADER)
+        {
+            dst = reinterpret_cast<uint8_t *>(&header) + header_fill;
+            want = sizeof(header) - header_fill;
+        }
+        else
+        {
+            dst = reinterpret_cast<uint8_t *>(row_buf) + row_fill;
+            want = row_bytes - row_fill;
+        }
+
+        int n = stdio_get_until(reinterpret_cast<char *>(dst), want, get_absolute_time());
+        if (n <= 0)
+        {
+            return false;
+        }
+        last_data_ms = now_ms;
+
+        if (state == STATE_HEADER)
+        {
+            header_fill += n;
+            if (header_fill < sizeof(header))
+            {
+                continue;
+            }
+            header_fill = 0;
+            if (!accept_header(now_ms))
+            {
+                // Resynchronise: drop the first byte and look for the magic again
+                uint8_t *bytes = reinterpret_cast<uint8_t *>(&header);
+                memmove(bytes, bytes + 1, sizeof(header) - 1);
+                header_fill = sizeof(header) - 1;
+            }
+            continue;
+        }
+
+        row_fill += n;
+        if (row_fill < row_bytes || !finish_row())
+        {
+            continue;
+        }
+
+        // Frame complete
+        state = STATE_HEADER;
+        printf("ACK %lu\n", (unsigned long)header.sequence);
+        if (discard)
+        {
+            frames_dropped++;
+            return false;
+        }
+        have_sequence = true;
+        last_sequence = header.sequence;
+        last_frame_ms = now_ms;
+        frames_shown++;
+        return true;
+    }
+}
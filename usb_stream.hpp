@@ -0,0 +1,121 @@
+#pragma once
+
+#include "pico/stdlib.h"
+
+#define STREAM_MAGIC 0x46353748u   ///< "H75F" as little endian 32-bit word
+#define STREAM_FLAG_DIRTY_RECT 0x01 ///< Header carries a dirty rectangle, otherwise the payload is a full frame
+#define STREAM_TIMEOUT_MS 1000      ///< The stream releases the panel after this time without a frame
+#define STREAM_STALL_MS 500         ///< An incomplete frame is abandoned after this time without data
+
+/// @brief Pixel format of a stream payload
+enum StreamFormat : uint8_t
+{
+    STREAM_FORMAT_RGB888 = 0,    ///< 3 bytes per pixel, R, G, B
+    STREAM_FORMAT_RGB101010 = 1, ///< 32-bit little endian words, already in the driver's format (not interleaved)
+};
+
+/**
+ * @brief Header preceding every streamed frame (little endian).
+ *
+ * The payload follows immediately: h rows of w pixels in the given format.
+ */
+struct __attribute__((packed)) StreamHeader
+{
+    uint32_t magic;    ///< STREAM_MAGIC
+    uint32_t sequence; ///< Increments with every frame sent
+    uint8_t format;    ///< StreamFormat
+    uint8_t flags;     ///< STREAM_FLAG_*
+    uint16_t x;        ///< Dirty rectangle, ignored without STREAM_FLAG_DIRTY_RECT
+    uint16_t y;
+    uint16_t w;
+    uint16_t h;
+    uint16_t reserved;
+};
+
+static_assert(sizeof(StreamHeader) == 20, "StreamHeader must be packed");
+
+/**
+ * @brief Receives frames streamed by a host over USB CDC and writes them into the driver's frame buffer.
+ *
+ * The payload is read row by row into a single row buffer and converted (RGB888) or copied
+ * (RGB101010) straight into the frame buffer - there is no intermediate full-frame copy.
+ * Every completed frame is acknowledged with a line "ACK <sequence>", and the host sends the
+ * next frame only after the acknowledgement. Frames the host produces meanwhile are dropped
+ * on the host side instead of being queued. Frames arriving with an outdated sequence number
+ * are consumed and discarded. After STREAM_TIMEOUT_MS without a frame a new session begins,
+ * whose sequence numbers may start anew (e.g. the host tool has been restarted).
+ */
+class UsbStreamReceiver
+{
+private:
+    enum State
+    {
+        STATE_HEADER,
+        STATE_PAYLOAD
+    };
+
+    uint width, height;
+    void (*claim_panel)(); ///< Called before a row is written into the frame buffer, may be nullptr
+    uint32_t *row_buf;     ///< One row of the widest format
+
+    State state = STATE_HEADER;
+    StreamHeader header;
+    uint header_fill = 0;
+    uint row = 0;
+    uint row_fill = 0;
+    uint row_bytes = 0;
+    bool discard = false;
+
+    bool have_sequence = false;
+    uint32_t last_sequence = 0;
+    uint32_t last_frame_ms = 0;
+    uint32_t last_data_ms = 0;
+
+    uint32_t frames_shown = 0;
+    uint32_t frames_dropped = 0;
+
+    bool accept_header(uint32_t now_ms);
+    bool finish_row();
+
+public:
+    /**
+     * @param width Panel width in pixels.
+     * @param height Panel height in pixels.
+     * @param claim_panel Called before every row written into the frame buffer, so the caller can take
+     *                    the converter from another core. Must return quickly if it already owns it.
+     */
+    UsbStreamReceiver(uint width, uint height, void (*claim_panel)() = nullptr) : width(width), height(height), claim_panel(claim_panel)
+    {
+        row_buf = new uint32_t[width]();
+    }
+
+    ~UsbStreamReceiver()
+    {
+        delete[] row_buf;
+    }
+
+    /**
+     * @brief Processes the bytes available on stdin without blocking.
+     *
+     * @param now_ms Current time in milliseconds.
+     * @return true if a frame has been completed and written to the frame buffer.
+     */
+    bool poll(uint32_t now_ms);
+
+    /// @brief true while frames keep arriving or a frame is partly written - the stream owns the panel then.
+    bool active(uint32_t now_ms) const
+    {
+        bool writing = state == STATE_PAYLOAD && !discard && row != 0;
+        return writing || (frames_shown != 0 && now_ms - last_frame_ms < STREAM_TIMEOUT_MS);
+    }
+
+    uint32_t shown() const
+    {
+        return frames_shown;
+    }
+
+    uint32_t dropped() const
+    {
+        return frames_dropped;
+    }
+};